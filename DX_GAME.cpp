@@ -6,6 +6,7 @@
 #include "src/ecs/World.h"
 #include "src/game/scenes/TitleScene.h"
 #include "src/game/scenes/WikiGolfScene.h"
+#include "src/game/systems/ArticleTextRenderSystem.h"
 #include "src/game/systems/RenderSystem.h"
 #include "src/game/systems/SkyboxRenderSystem.h"
 #include "src/game/systems/UIBarGaugeRenderSystem.h" // 追加
@@ -174,6 +175,9 @@ int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE hPrevInstance,
       // 3Dシーン描画
       game::systems::RenderSystem(ctx);
 
+      // 床の記事の文字 (SDF グリフ)
+      game::systems::ArticleTextRenderSystem(ctx);
+
       // UI描画
       uiImageRenderSystem(ctx);
       uiBarGaugeRenderSystem(ctx); // 追加
@@ -0,0 +1,130 @@
+#include "src/graphics/ArticleLayout.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+// 記事のレイアウト（行分割・リンク矩形・見出し）の時間を、記事の長さと
+// テクスチャ幅を変えて測る。寸法は同梱の表を使うので、DirectWrite の
+// 寸法ではフォント呼び出しの分だけ遅くなる。
+// キャッシュに当たったときの時間（キーのハッシュ）も並べる。
+
+using graphics::ArticleLayout;
+using graphics::ArticleLayoutCache;
+using graphics::ArticleLayoutCacheStats;
+using graphics::ArticleLayoutEngine;
+using graphics::ArticleLayoutInput;
+using graphics::TableGlyphMetrics;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+/// @brief UTF-8 で1文字足す
+void AppendUtf8(std::string &out, char32_t c) {
+  if (c < 0x80) {
+    out.push_back(static_cast<char>(c));
+  } else if (c < 0x800) {
+    out.push_back(static_cast<char>(0xC0 | (c >> 6)));
+    out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+  } else {
+    out.push_back(static_cast<char>(0xE0 | (c >> 12)));
+    out.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+  }
+}
+
+/// @brief 日本語の記事に似た本文（漢字・かな・句読点・英単語・見出し）
+std::string MakeArticle(size_t chars, std::mt19937 &rng) {
+  const std::u32string common = U"のはにをとがでてしたる。、";
+  std::string text;
+  size_t count = 0;
+  size_t sinceBreak = 0;
+  while (count < chars) {
+    if (sinceBreak > 300 && rng() % 40 == 0) {
+      text += rng() % 3 == 0 ? "\n== 概要と歴史 ==\n" : "\n";
+      sinceBreak = 0;
+      continue;
+    }
+    if (rng() % 12 == 0) {
+      text += " Wikipedia ";
+      count += 11;
+    }
+    const int run = 1 + static_cast<int>(rng() % 4);
+    for (int i = 0; i < run; ++i) {
+      AppendUtf8(text, static_cast<char32_t>(0x4E00 + rng() % 600));
+    }
+    AppendUtf8(text, common[rng() % common.size()]);
+    count += run + 1;
+    sinceBreak += run + 1;
+  }
+  return text;
+}
+
+template <typename Fn> double MeasureMs(int runs, Fn &&fn) {
+  fn();
+  const auto start = Clock::now();
+  for (int i = 0; i < runs; ++i) {
+    fn();
+  }
+  const auto end = Clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count() / runs;
+}
+
+} // namespace
+
+int main() {
+  TableGlyphMetrics metrics;
+  ArticleLayoutEngine engine(metrics);
+
+  std::printf("%9s %6s %7s %7s %7s %10s %11s %10s\n", "chars", "width",
+              "lines", "links", "runs", "layout ms", "Mchar/s", "hit us");
+
+  const size_t lengths[] = {5000, 20000, 80000};
+  const uint32_t widths[] = {1500, 3000};
+  for (size_t length : lengths) {
+    std::mt19937 rng(static_cast<uint32_t>(length));
+    ArticleLayoutInput input;
+    input.title = "ベンチマーク";
+    input.text = MakeArticle(length, rng);
+    input.targetPage = "目標";
+    // 本文から取った語（現れる）と、現れない語を半分ずつ
+    for (int i = 0; i < 300; ++i) {
+      std::string title;
+      if (i % 2 == 0) {
+        size_t pos = rng() % (input.text.size() - 12);
+        while ((static_cast<unsigned char>(input.text[pos]) & 0xC0) == 0x80) {
+          ++pos;
+        }
+        title = input.text.substr(pos, 6);
+      } else {
+        AppendUtf8(title, static_cast<char32_t>(0x4E00 + rng() % 600));
+        AppendUtf8(title, static_cast<char32_t>(0x4E00 + rng() % 600));
+        AppendUtf8(title, static_cast<char32_t>(0x4E00 + rng() % 600));
+      }
+      input.links.push_back({title, i == 1 ? "目標" : title});
+    }
+
+    for (uint32_t width : widths) {
+      ArticleLayout layout;
+      const double layoutMs =
+          MeasureMs(5, [&] { layout = engine.Layout(input, width, 32768); });
+
+      ArticleLayoutCache cache;
+      ArticleLayoutCacheStats stats;
+      cache.GetOrLayout(engine, input, width, 32768, &stats);
+      const double hitMs = MeasureMs(20, [&] {
+        cache.GetOrLayout(engine, input, width, 32768, &stats);
+      });
+
+      std::printf("%9zu %6u %7zu %7zu %7zu %10.3f %11.2f %10.1f\n", length,
+                  width, layout.lineCount, layout.links.size(),
+                  layout.runs.size(), layoutMs,
+                  layout.text.size() / (layoutMs * 1000.0), hitMs * 1000.0);
+      if (!stats.hit) {
+        std::printf("  (cache missed)\n");
+      }
+    }
+  }
+  return 0;
+}
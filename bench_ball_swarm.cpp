@@ -0,0 +1,107 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/BallSwarm.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// LoadingScene のボール群をヘッドレスで回し、1フレームあたりの時間を測る。
+// 旧実装相当の O(N^2) ペア探索も同じ条件で計測して比較する。
+
+using game::systems::BallSwarm;
+using game::systems::BallSwarmConfig;
+using Clock = std::chrono::steady_clock;
+
+static BallSwarmConfig MakeConfig(int count) {
+  // 350球のアリーナ面積を基準に、球数に比例して床面積を広げる
+  BallSwarmConfig config;
+  const float scale = std::sqrt(static_cast<float>(count) / 350.0f);
+  config.wallX *= std::max(scale, 1.0f);
+  config.wallZ *= std::max(scale, 1.0f);
+  return config;
+}
+
+static void Fill(BallSwarm &swarm, int count) {
+  std::mt19937 rng(1234);
+  const auto &c = swarm.GetConfig();
+  std::uniform_real_distribution<float> distX(-c.wallX, c.wallX);
+  std::uniform_real_distribution<float> distZ(-c.wallZ, c.wallZ);
+  std::uniform_real_distribution<float> distY(c.floorY, c.floorY + 40.0f);
+  std::uniform_real_distribution<float> distV(-20.0f, 20.0f);
+  for (int i = 0; i < count; ++i) {
+    swarm.AddBall(distX(rng), distY(rng), distZ(rng), distV(rng), -16.0f,
+                  distV(rng));
+  }
+}
+
+/// @brief 旧 LoadingScene と同じ総当たりペア判定（比較用）
+static double BruteForcePairScanMs(const BallSwarm &swarm, int subSteps) {
+  const float minDist = swarm.GetConfig().radius * 2.0f;
+  const size_t n = swarm.GetCount();
+  volatile size_t hits = 0;
+  auto start = Clock::now();
+  for (int s = 0; s < subSteps; ++s) {
+    size_t local = 0;
+    for (size_t i = 0; i < n; ++i) {
+      for (size_t j = i + 1; j < n; ++j) {
+        float dx = swarm.GetX(j) - swarm.GetX(i);
+        float dy = swarm.GetY(j) - swarm.GetY(i);
+        float dz = swarm.GetZ(j) - swarm.GetZ(i);
+        if (dx * dx + dy * dy + dz * dz < minDist * minDist) {
+          ++local;
+        }
+      }
+    }
+    hits = hits + local;
+  }
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+static double StepMs(BallSwarm &swarm, core::ThreadPool *pool, int frames) {
+  auto start = Clock::now();
+  for (int f = 0; f < frames; ++f) {
+    swarm.Step(1.0f / 60.0f, pool);
+  }
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+             .count() /
+         frames;
+}
+
+int main() {
+  core::ThreadPool &pool = core::ThreadPool::Shared();
+  std::printf("threads=%zu (workers + caller)\n", pool.GetConcurrency());
+  std::printf("%8s %14s %14s %14s\n", "balls", "N^2 scan ms", "grid 1T ms",
+              "grid MT ms");
+
+  const int counts[] = {350, 2000, 10000, 30000, 60000};
+  for (int count : counts) {
+    BallSwarm serial(MakeConfig(count));
+    BallSwarm parallel(MakeConfig(count));
+    Fill(serial, count);
+    Fill(parallel, count);
+
+    // 落下中の混雑した状態で計測する
+    for (int f = 0; f < 20; ++f) {
+      serial.Step(1.0f / 60.0f, nullptr);
+      parallel.Step(1.0f / 60.0f, &pool);
+    }
+
+    const int frames = (count <= 2000) ? 60 : 10;
+    double brute = -1.0;
+    if (count <= 10000) {
+      brute = BruteForcePairScanMs(serial, serial.GetConfig().subSteps);
+    }
+    const double single = StepMs(serial, nullptr, frames);
+    const double multi = StepMs(parallel, &pool, frames);
+
+    if (brute >= 0.0) {
+      std::printf("%8d %14.3f %14.3f %14.3f\n", count, brute, single, multi);
+    } else {
+      std::printf("%8d %14s %14.3f %14.3f\n", count, "(skipped)", single,
+                  multi);
+    }
+  }
+  return 0;
+}
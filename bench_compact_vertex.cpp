@@ -0,0 +1,148 @@
+#include "src/graphics/CompactVertex.h"
+#include "src/graphics/MeshOptimizer.h"
+#include "src/graphics/TangentGenerator.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// Vertex（72 バイト）と CompactVertex（24 バイト）のメモリ・頂点フェッチ量と、
+// 詰めて戻したときの誤差。形は bench_mesh_simplifier と同じく細かい球、
+// golfball.fbx 相当のくぼみ付きの球、TerrainGenerator 相当の起伏のある格子。
+// 「fetch」は最適化後のインデックス順で頂点シェーダーが読むバイト数
+// （AnalyzeVertexFetch、64 バイトのキャッシュライン単位）。
+// 「rel」は位置の誤差を境界の最も長い辺で割ったもの。terrain は整数の格子で
+// 正規化した位置が half で割り切れるため、half の誤差が小さく出る。
+
+using graphics::CompactVertex;
+using graphics::PositionEncoding;
+using graphics::Vertex;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct TestMesh {
+  const char *name = "";
+  std::vector<Vertex> vertices;
+  std::vector<uint32_t> indices;
+};
+
+/// dimples > 0 なら経度・緯度方向にくぼみを付ける
+TestMesh MakeSphere(const char *name, int segments, int dimples) {
+  TestMesh mesh;
+  mesh.name = name;
+  const float pi = 3.14159265358979f;
+  const float r = 1.0f / (segments - 1);
+  for (int ring = 0; ring < segments; ++ring) {
+    for (int s = 0; s < segments; ++s) {
+      const float theta = pi * ring * r;
+      const float phi = 2 * pi * s * r;
+      const float y = std::sin(-pi * 0.5f + theta);
+      const float x = std::cos(phi) * std::sin(theta);
+      const float z = std::sin(phi) * std::sin(theta);
+      float radius = 0.5f;
+      if (dimples > 0) {
+        const float d = std::sin(theta * dimples) * std::sin(phi * dimples);
+        radius -= 0.01f * d * d;
+      }
+      Vertex v{};
+      v.position = {x * radius, y * radius, z * radius};
+      v.normal = {x, y, z};
+      v.texCoord = {s * r, ring * r};
+      v.color = {1, 1, 1, 1};
+      mesh.vertices.push_back(v);
+    }
+  }
+  for (int ring = 0; ring < segments - 1; ++ring) {
+    for (int s = 0; s < segments - 1; ++s) {
+      const uint32_t current = ring * segments + s;
+      const uint32_t next = current + segments;
+      mesh.indices.insert(mesh.indices.end(), {current, next, current + 1,
+                                               current + 1, next, next + 1});
+    }
+  }
+  return mesh;
+}
+
+TestMesh MakeTerrain(int n) {
+  TestMesh mesh;
+  mesh.name = "terrain";
+  for (int y = 0; y <= n; ++y) {
+    for (int x = 0; x <= n; ++x) {
+      Vertex v{};
+      const float h = 4.0f * std::sin(x * 0.05f) * std::cos(y * 0.07f);
+      v.position = {static_cast<float>(x), h, static_cast<float>(y)};
+      v.normal = {0, 1, 0};
+      v.texCoord = {static_cast<float>(x) / n, static_cast<float>(y) / n};
+      v.color = {0.3f, 0.6f + 0.05f * h, 0.2f, 1.0f};
+      mesh.vertices.push_back(v);
+    }
+  }
+  const uint32_t row = n + 1;
+  for (int y = 0; y < n; ++y) {
+    for (int x = 0; x < n; ++x) {
+      const uint32_t a = y * row + x;
+      mesh.indices.insert(mesh.indices.end(), {a, a + row, a + 1, a + 1,
+                                               a + row, a + row + 1});
+    }
+  }
+  return mesh;
+}
+
+} // namespace
+
+int main() {
+  std::vector<TestMesh> meshes;
+  meshes.push_back(MakeSphere("sphere64", 64, 0));
+  meshes.push_back(MakeSphere("golfball", 128, 18));
+  meshes.push_back(MakeTerrain(256));
+
+  std::printf("%-9s %7s %9s %9s %7s %10s %10s %7s\n", "mesh", "verts",
+              "VB 72B", "VB 24B", "saved", "fetch 72B", "fetch 24B",
+              "saved");
+  for (TestMesh &mesh : meshes) {
+    graphics::ComputeTangents(mesh.vertices, mesh.indices);
+    graphics::OptimizeMesh(mesh.vertices, mesh.indices);
+    const size_t n = mesh.vertices.size();
+    const graphics::VertexFetchStats full =
+        graphics::AnalyzeVertexFetch(mesh.indices, n, sizeof(Vertex));
+    const graphics::VertexFetchStats compact =
+        graphics::AnalyzeVertexFetch(mesh.indices, n, sizeof(CompactVertex));
+    std::printf("%-9s %7zu %8.1fK %8.1fK %6.1f%% %9.1fK %9.1fK %6.1f%%\n",
+                mesh.name, n, n * sizeof(Vertex) / 1024.0,
+                n * sizeof(CompactVertex) / 1024.0,
+                100.0 * (1.0 - double(sizeof(CompactVertex)) / sizeof(Vertex)),
+                full.bytesFetched / 1024.0, compact.bytesFetched / 1024.0,
+                100.0 * (1.0 - double(compact.bytesFetched) /
+                                   full.bytesFetched));
+  }
+
+  std::printf("\n%-9s %-7s %10s %9s %9s %9s %9s %9s %8s\n", "mesh", "pos",
+              "pos err", "rel", "n deg", "t deg", "b deg", "uv err",
+              "ms");
+  for (const TestMesh &mesh : meshes) {
+    for (PositionEncoding encoding :
+         {PositionEncoding::kSnorm16, PositionEncoding::kHalf}) {
+      std::vector<CompactVertex> compact;
+      graphics::PositionQuantization quantization;
+      const auto start = Clock::now();
+      graphics::EncodeCompactVertices(mesh.vertices.data(),
+                                      mesh.vertices.size(), encoding, compact,
+                                      quantization);
+      const double ms =
+          std::chrono::duration<double, std::milli>(Clock::now() - start)
+              .count();
+      const graphics::CompactVertexError e =
+          graphics::MeasureCompactVertexError(mesh.vertices.data(),
+                                              compact.data(), compact.size(),
+                                              encoding, quantization);
+      std::printf("%-9s %-7s %10.6f %9.2e %9.5f %9.5f %9.5f %9.6f %8.2f\n",
+                  mesh.name,
+                  encoding == PositionEncoding::kHalf ? "half" : "snorm16",
+                  e.position, e.position / (2.0f * quantization.scale),
+                  e.normalDegrees, e.tangentDegrees, e.bitangentDegrees,
+                  e.texCoord, ms);
+    }
+  }
+  return 0;
+}
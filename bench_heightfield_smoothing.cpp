@@ -0,0 +1,106 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/HeightFieldFilter.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// ハイトマップのスムージングを解像度ごとに計測する。
+// legacy は旧 TerrainGenerator::ApplySmoothing と同じ
+// 「境界チェック付き GetHeight + 毎パス全体コピー」の 3x3 平均。
+
+using namespace game::systems;
+using Clock = std::chrono::steady_clock;
+
+static float GetHeight(const std::vector<float> &map, int w, int h, int x,
+                       int z) {
+  if (x < 0 || x >= w || z < 0 || z >= h)
+    return 0.0f;
+  return map[z * w + x];
+}
+
+static void LegacySmooth(std::vector<float> &map, int w, int h, int iters) {
+  std::vector<float> temp = map;
+  for (int it = 0; it < iters; ++it) {
+    for (int z = 1; z < h - 1; ++z) {
+      for (int x = 1; x < w - 1; ++x) {
+        float sum = 0.0f;
+        for (int dz = -1; dz <= 1; ++dz) {
+          for (int dx = -1; dx <= 1; ++dx) {
+            sum += GetHeight(map, w, h, x + dx, z + dz);
+          }
+        }
+        temp[z * w + x] = sum / 9.0f;
+      }
+    }
+    map = temp;
+  }
+}
+
+template <typename Fn> static double TimeMs(int runs, Fn &&fn) {
+  auto start = Clock::now();
+  for (int i = 0; i < runs; ++i) {
+    fn();
+  }
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+             .count() /
+         runs;
+}
+
+int main() {
+  core::ThreadPool &pool = core::ThreadPool::Shared();
+  std::printf("threads=%zu (workers + caller), 3 iterations per run\n",
+              pool.GetConcurrency());
+  std::printf("%10s %11s %11s %11s %11s %11s %10s\n", "resolution",
+              "legacy ms", "r1 1T ms", "r1 MT ms", "r8 MT ms", "gauss MT",
+              "r1 Mcell/s");
+
+  const int resolutions[] = {512, 2048, 4096};
+  for (int res : resolutions) {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(-3.0f, 3.0f);
+    std::vector<float> source(static_cast<size_t>(res) * res);
+    for (float &v : source) {
+      v = dist(rng);
+    }
+
+    const int runs = (res <= 512) ? 10 : 2;
+    std::vector<float> work;
+
+    const double legacy = TimeMs(runs, [&]() {
+      work = source;
+      LegacySmooth(work, res, res, 3);
+    });
+
+    SmoothingSettings box1;
+    const double single = TimeMs(runs, [&]() {
+      work = source;
+      SmoothHeightField(work, res, res, box1, nullptr);
+    });
+    const double multi = TimeMs(runs, [&]() {
+      work = source;
+      SmoothHeightField(work, res, res, box1, &pool);
+    });
+
+    SmoothingSettings box8 = box1;
+    box8.radius = 8;
+    const double wide = TimeMs(runs, [&]() {
+      work = source;
+      SmoothHeightField(work, res, res, box8, &pool);
+    });
+
+    SmoothingSettings gauss;
+    gauss.mode = SmoothingMode::Gaussian;
+    gauss.edge = SmoothingEdge::Clamp;
+    gauss.sigma = 4.0f;
+    const double gaussian = TimeMs(runs, [&]() {
+      work = source;
+      SmoothHeightField(work, res, res, gauss, &pool);
+    });
+
+    const double mcells = 3.0 * res * res / (multi * 1000.0);
+    std::printf("%5dx%-4d %11.2f %11.2f %11.2f %11.2f %11.2f %10.1f\n", res,
+                res, legacy, single, multi, wide, gaussian, mcells);
+  }
+  return 0;
+}
@@ -0,0 +1,94 @@
+#include "src/core/IncrementalJob.h"
+#include "src/game/systems/TerrainGenerationJob.h"
+#include "src/game/systems/TerrainGenerator.h"
+#include "src/graphics/SkyboxFaceGenerator.h"
+#include "src/graphics/SkyboxGenerationJob.h"
+#include <chrono>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <vector>
+
+// 生成処理を一括で呼んだときのメインスレッドの停止時間と、
+// フレーム予算つきジョブに分けたときの 1 フレームの最悪時間・
+// プレビューが出るまでのフレーム数・完成までのフレーム数を比べる。
+// いずれも単一スレッド（プールなし）で測る。
+
+using game::systems::TerrainConfig;
+using game::systems::TerrainGenerationJob;
+using game::systems::TerrainGenerator;
+using graphics::SkyboxTheme;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+double MeasureMs(const std::function<void()> &fn) {
+  const auto start = Clock::now();
+  fn();
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+/// @brief ジョブを予算つきで毎フレーム進め、結果を1行出す
+void RunFrames(const char *name, double blockingMs, double budgetMs,
+               const std::shared_ptr<core::IncrementalJob> &job) {
+  core::FrameBudgetRunner runner;
+  runner.Add(job);
+  int previewFrame = -1;
+  int frames = 0;
+  while (!runner.IsIdle()) {
+    runner.Tick(budgetMs);
+    ++frames;
+    if (previewFrame < 0 && job->GetQuality() > 0) {
+      previewFrame = frames;
+    }
+  }
+  const core::FrameBudgetStats &stats = runner.GetStats();
+  std::printf("%-16s %11.1f %8.1f %10.2f %9d %8d %10.1f\n", name, blockingMs,
+              budgetMs, stats.worstMs, previewFrame, frames, stats.totalMs);
+}
+
+} // namespace
+
+int main() {
+  std::printf("%-16s %11s %8s %10s %9s %8s %10s\n", "job", "blocking ms",
+              "budget", "worst ms", "preview", "frames", "total ms");
+
+  for (int faceSize : {256, 512}) {
+    DirectX::XMFLOAT3 top, horizon, bottom;
+    graphics::GetSkyboxThemeColors(SkyboxTheme::SpaceAstronomy, top, horizon,
+                                   bottom);
+    std::vector<std::vector<uint8_t>> faces;
+    const double blockingMs = MeasureMs([&] {
+      graphics::GenerateSkyboxFaces(top, horizon, bottom, faceSize,
+                                    SkyboxTheme::SpaceAstronomy, faces);
+    });
+    char name[32];
+    std::snprintf(name, sizeof(name), "skybox %d", faceSize);
+    for (double budget : {2.0, 4.0, 8.0}) {
+      RunFrames(name, blockingMs, budget,
+                std::make_shared<graphics::SkyboxGenerationJob>(
+                    SkyboxTheme::SpaceAstronomy, faceSize, faceSize / 8));
+    }
+  }
+
+  const std::vector<DirectX::XMFLOAT2> holes = {
+      {-5.0f, 8.0f}, {4.0f, -6.5f}, {6.0f, 10.0f}, {-3.0f, -10.0f}};
+  for (int resolution : {128, 256}) {
+    TerrainConfig config;
+    config.resolutionX = resolution;
+    config.resolutionZ = resolution;
+    config.noiseAmplitude = 0.4f;
+    const double blockingMs = MeasureMs([&] {
+      TerrainGenerator::GenerateTerrain("Mount Fuji", holes, config, nullptr);
+    });
+    char name[32];
+    std::snprintf(name, sizeof(name), "terrain %d", resolution);
+    for (double budget : {2.0, 4.0, 8.0}) {
+      RunFrames(name, blockingMs, budget,
+                std::make_shared<TerrainGenerationJob>("Mount Fuji", holes,
+                                                       config));
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,69 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/IncrementalTerrainGenerator.h"
+#include "src/game/systems/TerrainGenerator.h"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// ホールを1つ動かしたときの再生成時間を、全体生成と差分更新で比べる。
+// ホールを密に並べているので、グリーンが重なる後続ホールも作り直される。
+
+using game::systems::IncrementalTerrainGenerator;
+using game::systems::TerrainConfig;
+using game::systems::TerrainGenerator;
+using game::systems::TerrainUpdateStats;
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+int main() {
+  core::ThreadPool &pool = core::ThreadPool::Shared();
+  std::printf("threads=%zu (workers + caller), 40 holes, move 1 hole\n",
+              pool.GetConcurrency());
+  std::printf("%10s %10s %12s %10s %9s %12s\n", "resolution", "full ms",
+              "update ms", "speedup", "platforms", "vertex area");
+
+  std::vector<DirectX::XMFLOAT2> holes;
+  for (int i = 0; i < 40; ++i) {
+    holes.push_back({-16.0f + (i % 8) * 4.5f, -24.0f + (i / 8) * 11.0f});
+  }
+
+  const int resolutions[] = {256, 512, 1024, 2048};
+  for (int res : resolutions) {
+    TerrainConfig config;
+    config.resolutionX = res;
+    config.resolutionZ = res;
+    config.worldWidth = 40.0f;
+    config.worldDepth = 60.0f;
+    config.noiseAmplitude = 0.5f;
+
+    auto start = Clock::now();
+    TerrainGenerator::GenerateTerrain("Benchmark", holes, config, &pool);
+    const double fullMs = ElapsedMs(start);
+
+    IncrementalTerrainGenerator inc;
+    inc.Generate("Benchmark", holes, config, &pool);
+
+    // 同じホールを往復させて、毎回同じ量の差分を作る
+    const int runs = 10;
+    TerrainUpdateStats stats;
+    start = Clock::now();
+    for (int i = 0; i < runs; ++i) {
+      std::vector<DirectX::XMFLOAT2> moved = holes;
+      moved[20].x += (i % 2 == 0) ? 0.8f : 0.0f;
+      inc.SetHoles(moved);
+      stats = inc.Update(&pool);
+    }
+    const double updateMs = ElapsedMs(start) / runs;
+
+    const double area = static_cast<double>(stats.vertexRect.Area()) /
+                        (static_cast<double>(res) * res);
+    std::printf("%5dx%-4d %10.2f %12.3f %9.1fx %9zu %11.2f%%\n", res, res,
+                fullMs, updateMs, fullMs / updateMs, stats.changedPlatforms,
+                area * 100.0);
+  }
+  return 0;
+}
@@ -0,0 +1,328 @@
+#include "src/core/KeywordClassifier.h"
+#include "src/game/systems/TerrainBiome.h"
+#include "src/graphics/SkyboxThemeClassifier.h"
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+// 記事の抜粋からテーマを選ぶ時間。キーワードごとに本文全体を小文字化して
+// find する旧実装（最初に当たったテーマ）と、オートマトンで全テーマを
+// 1回の走査で採点する分類器を比べる。カテゴリからのバイオーム選択も同様。
+
+using graphics::SkyboxTheme;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+// ---- 旧実装（SkyboxTextureGenerator / WikiTerrainSystem から移す前の形）
+
+std::string ToLower(const std::string &text) {
+  std::string result = text;
+  std::transform(result.begin(), result.end(), result.begin(),
+                 [](unsigned char c) { return std::tolower(c); });
+  return result;
+}
+
+bool ContainsKeyword(const std::string &text, const std::string &keyword) {
+  return ToLower(text).find(ToLower(keyword)) != std::string::npos;
+}
+
+bool ContainsAnyKeyword(const std::string &text,
+                        const std::vector<std::string> &keywords) {
+  for (const auto &keyword : keywords) {
+    if (ContainsKeyword(text, keyword)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+SkyboxTheme LegacyDetermineTheme(const std::string &pageTitle,
+                                 const std::string &pageExtract) {
+
+  std::string combined = pageTitle + " " + pageExtract;
+
+  // 優先度順にテーマ判定（より具体的なものから）
+
+  // 宇宙・天文
+  if (ContainsAnyKeyword(combined, {"宇宙", "天文", "惑星", "星", "銀河", "月",
+                                    "太陽系", "ブラックホール", "彗星", "space",
+                                    "astronomy", "planet", "galaxy"})) {
+    return SkyboxTheme::SpaceAstronomy;
+  }
+
+  // 海洋・水中
+  if (ContainsAnyKeyword(combined, {"海", "海洋", "水中", "深海", "サンゴ礁",
+                                    "イルカ", "クジラ", "魚", "ocean", "sea",
+                                    "underwater", "marine"})) {
+    return SkyboxTheme::Ocean;
+  }
+
+  // 火山
+  if (ContainsAnyKeyword(combined, {"火山", "噴火", "溶岩", "マグマ", "volcano",
+                                    "lava", "eruption"})) {
+    return SkyboxTheme::Volcano;
+  }
+
+  // 極地・雪
+  if (ContainsAnyKeyword(combined, {"極地", "南極", "北極", "氷河", "雪",
+                                    "オーロラ", "polar", "arctic", "antarctica",
+                                    "glacier", "snow"})) {
+    return SkyboxTheme::Polar;
+  }
+
+  // 砂漠
+  if (ContainsAnyKeyword(combined, {"砂漠", "サハラ", "乾燥", "オアシス",
+                                    "desert", "sahara", "dune"})) {
+    return SkyboxTheme::Desert;
+  }
+
+  // 森林・ジャングル
+  if (ContainsAnyKeyword(combined,
+                         {"森", "森林", "ジャングル", "熱帯雨林", "木",
+                          "forest", "jungle", "rainforest", "woods"})) {
+    return SkyboxTheme::Forest;
+  }
+
+  // 山岳・登山
+  if (ContainsAnyKeyword(combined,
+                         {"山", "登山", "高山", "ヒマラヤ", "アルプス",
+                          "mountain", "climbing", "peak", "summit"})) {
+    return SkyboxTheme::Mountain;
+  }
+
+  // ホラー・オカルト
+  if (ContainsAnyKeyword(combined,
+                         {"ホラー", "幽霊", "お化け", "オカルト", "怪談",
+                          "呪い", "horror", "ghost", "haunted", "occult"})) {
+    return SkyboxTheme::Horror;
+  }
+
+  // ファンタジー
+  if (ContainsAnyKeyword(combined,
+                         {"魔法", "魔術", "ドラゴン", "エルフ", "ファンタジー",
+                          "fantasy", "magic", "wizard", "dragon"})) {
+    return SkyboxTheme::Fantasy;
+  }
+
+  // SF・未来
+  if (ContainsAnyKeyword(combined,
+                         {"SF", "サイエンスフィクション", "未来", "ロボット",
+                          "AI", "サイバー", "sci-fi", "science fiction",
+                          "cyberpunk", "futuristic"})) {
+    return SkyboxTheme::SciFi;
+  }
+
+  // 戦争・軍事
+  if (ContainsAnyKeyword(combined,
+                         {"戦争", "軍事", "兵器", "戦闘", "軍隊", "war",
+                          "military", "battle", "weapon", "soldier"})) {
+    return SkyboxTheme::War;
+  }
+
+  // 中世・城
+  if (ContainsAnyKeyword(combined,
+                         {"中世", "城", "騎士", "王国", "貴族", "medieval",
+                          "castle", "knight", "kingdom"})) {
+    return SkyboxTheme::Medieval;
+  }
+
+  // 歴史・古代
+  if (ContainsAnyKeyword(combined,
+                         {"歴史", "古代", "遺跡", "文明", "考古学", "history",
+                          "ancient", "civilization", "archaeology", "ruins"})) {
+    return SkyboxTheme::HistoryAncient;
+  }
+
+  // 宗教・神話
+  if (ContainsAnyKeyword(combined, {"宗教", "神", "仏教", "キリスト教", "神話",
+                                    "寺", "教会", "religion", "god",
+                                    "mythology", "temple", "shrine"})) {
+    return SkyboxTheme::Religion;
+  }
+
+  // 都市・建築
+  if (ContainsAnyKeyword(combined,
+                         {"都市", "建築", "ビル", "摩天楼", "都会", "city",
+                          "urban", "building", "architecture", "skyscraper"})) {
+    return SkyboxTheme::Urban;
+  }
+
+  // 医療・生物
+  if (ContainsAnyKeyword(combined,
+                         {"医療", "医学", "病院", "生物", "細胞", "DNA",
+                          "medical", "medicine", "biology", "hospital"})) {
+    return SkyboxTheme::Medical;
+  }
+
+  // 科学・技術
+  if (ContainsAnyKeyword(combined, {"科学", "技術", "物理", "化学", "工学",
+                                    "science", "technology", "physics",
+                                    "chemistry", "engineering"})) {
+    return SkyboxTheme::ScienceTech;
+  }
+
+  // 音楽
+  if (ContainsAnyKeyword(combined,
+                         {"音楽", "楽器", "演奏", "コンサート", "オーケストラ",
+                          "music", "instrument", "concert", "orchestra"})) {
+    return SkyboxTheme::Music;
+  }
+
+  // 芸術・美術
+  if (ContainsAnyKeyword(combined,
+                         {"芸術", "美術", "絵画", "彫刻", "芸術家", "art",
+                          "painting", "sculpture", "artist", "gallery"})) {
+    return SkyboxTheme::Art;
+  }
+
+  // 文学
+  if (ContainsAnyKeyword(combined,
+                         {"文学", "小説", "詩", "作家", "文芸", "literature",
+                          "novel", "poetry", "writer", "author"})) {
+    return SkyboxTheme::Literature;
+  }
+
+  // 食品・料理
+  if (ContainsAnyKeyword(combined, {"料理", "食品", "レシピ", "グルメ",
+                                    "レストラン", "food", "cooking", "cuisine",
+                                    "recipe", "restaurant"})) {
+    return SkyboxTheme::Food;
+  }
+
+  // スポーツ
+  if (ContainsAnyKeyword(combined, {"スポーツ", "競技", "選手", "オリンピック",
+                                    "野球", "サッカー", "sports", "athlete",
+                                    "olympics", "game"})) {
+    return SkyboxTheme::Sports;
+  }
+
+  // 夕暮れ・夜
+  if (ContainsAnyKeyword(combined, {"夜", "夕暮れ", "夕焼け", "黄昏", "night",
+                                    "sunset", "dusk", "twilight"})) {
+    return SkyboxTheme::Sunset;
+  }
+
+  // レトロ
+  if (ContainsAnyKeyword(combined, {"レトロ", "昭和", "ヴィンテージ", "古い",
+                                    "retro", "vintage", "classic", "old"})) {
+    return SkyboxTheme::Retro;
+  }
+
+  return SkyboxTheme::Default;
+}
+
+int LegacyBiome(const std::vector<std::string> &categories) {
+  for (const auto &cat : categories) {
+    if (cat.find("歴史") != std::string::npos ||
+        cat.find("戦争") != std::string::npos ||
+        cat.find("事件") != std::string::npos ||
+        cat.find("政治") != std::string::npos ||
+        cat.find("古代") != std::string::npos) {
+      return 1;
+    }
+    if (cat.find("科学") != std::string::npos ||
+        cat.find("技術") != std::string::npos ||
+        cat.find("数学") != std::string::npos ||
+        cat.find("物理") != std::string::npos ||
+        cat.find("コンピュータ") != std::string::npos ||
+        cat.find("宇宙") != std::string::npos) {
+      return 2;
+    }
+    if (cat.find("地理") != std::string::npos ||
+        cat.find("地形") != std::string::npos ||
+        cat.find("生物") != std::string::npos ||
+        cat.find("植物") != std::string::npos ||
+        cat.find("動物") != std::string::npos ||
+        cat.find("山") != std::string::npos) {
+      return 3;
+    }
+  }
+  return -1;
+}
+
+// ---- 入力
+
+/// @brief 日本語の記事に似た UTF-8 の本文。キーワードはほとんど含まない
+std::string MakeExtract(size_t bytes, std::mt19937 &rng) {
+  const char *const common[] = {"の", "は", "に", "を", "と", "が",
+                                "で", "た", "。", "、"};
+  std::string text;
+  text.reserve(bytes + 8);
+  while (text.size() < bytes) {
+    const int run = 1 + static_cast<int>(rng() % 4);
+    for (int i = 0; i < run; ++i) {
+      // 「一」から始まる漢字のうち先頭の 600 字
+      const uint32_t code = 0x4E00 + rng() % 600;
+      text.push_back(static_cast<char>(0xE0 | (code >> 12)));
+      text.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+      text.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+    text += common[rng() % 10];
+    if (rng() % 40 == 0) {
+      text += " the history of music";
+    }
+  }
+  return text;
+}
+
+template <typename Fn> double MeasureUs(int runs, Fn &&fn) {
+  fn();
+  const auto start = Clock::now();
+  for (int i = 0; i < runs; ++i) {
+    fn();
+  }
+  return std::chrono::duration<double, std::micro>(Clock::now() - start)
+             .count() /
+         runs;
+}
+
+} // namespace
+
+int main() {
+  std::printf("%9s %12s %12s %9s %16s %16s\n", "bytes", "legacy us",
+              "scan us", "speedup", "legacy", "classifier");
+
+  for (size_t bytes : {1000, 10000, 100000, 1000000}) {
+    std::mt19937 rng(static_cast<uint32_t>(bytes));
+    const std::string title = "テスト";
+    const std::string extract = MakeExtract(bytes, rng);
+    const int runs = bytes >= 1000000 ? 3 : 30;
+
+    SkyboxTheme legacy = SkyboxTheme::Default;
+    SkyboxTheme theme = SkyboxTheme::Default;
+    const double legacyUs = MeasureUs(
+        runs, [&] { legacy = LegacyDetermineTheme(title, extract); });
+    const double scanUs = MeasureUs(
+        runs, [&] { theme = graphics::ClassifySkyboxTheme(title, extract); });
+    std::printf("%9zu %12.1f %12.1f %8.1fx %16s %16s\n", bytes, legacyUs,
+                scanUs, legacyUs / scanUs, graphics::GetSkyboxThemeName(legacy),
+                graphics::GetSkyboxThemeName(theme));
+  }
+
+  // 記事のカテゴリは 10〜30 個程度
+  std::vector<std::string> categories;
+  for (int i = 0; i < 24; ++i) {
+    categories.push_back("日本の人物" + std::to_string(i));
+  }
+  categories.push_back("日本の山");
+  // 毎回並びを回して、ループの外へ計算を出されないようにする
+  int legacy = -1;
+  int biome = -1;
+  const double legacyUs = MeasureUs(1000, [&] {
+    std::rotate(categories.begin(), categories.begin() + 1, categories.end());
+    legacy = LegacyBiome(categories);
+  });
+  const double scanUs = MeasureUs(1000, [&] {
+    std::rotate(categories.begin(), categories.begin() + 1, categories.end());
+    biome = game::systems::ClassifyTerrainBiome(categories);
+  });
+  std::printf("\nbiome (%zu categories): legacy %.2f us -> %d, "
+              "classifier %.2f us -> %d\n",
+              categories.size(), legacyUs, legacy, scanUs, biome);
+  return 0;
+}
@@ -0,0 +1,152 @@
+#include "src/core/MappedFile.h"
+#include "src/graphics/MeshCache.h"
+#include "src/graphics/ObjLoader.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+#if __has_include(<assimp/Importer.hpp>)
+#include "src/graphics/FbxLoader.h"
+#define BENCH_WITH_ASSIMP 1
+#endif
+
+// 前処理済みメッシュ（.wgmesh）と元の OBJ の読み込み時間の比較。
+// 一時ディレクトリに格子の OBJ を書き、ObjLoader（解析 + 接線生成）と
+// キャッシュのマップ（ソースのハッシュ確認あり・なし）を比べる。
+// Assimp の行はヘッダがある環境（FbxLoader.cpp と assimp をリンク）だけ出る。
+
+using graphics::MeshCacheView;
+using graphics::Submesh;
+using graphics::Vertex;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+double Ms(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+void WriteGridObj(const std::string &path, int n) {
+  std::ofstream file(path);
+  for (int y = 0; y <= n; ++y) {
+    for (int x = 0; x <= n; ++x) {
+      file << "v " << x * 0.1f << " " << ((x * 7 + y * 13) % 17) * 0.01f
+           << " " << y * 0.1f << "\n";
+    }
+  }
+  for (int y = 0; y <= n; ++y) {
+    for (int x = 0; x <= n; ++x) {
+      file << "vt " << static_cast<float>(x) / n << " "
+           << static_cast<float>(y) / n << "\n";
+    }
+  }
+  file << "vn 0 1 0\n";
+  const int row = n + 1;
+  for (int y = 0; y < n; ++y) {
+    for (int x = 0; x < n; ++x) {
+      const int a = y * row + x + 1;
+      const int b = a + 1;
+      const int c = a + row;
+      const int d = c + 1;
+      file << "f " << a << "/" << a << "/1 " << c << "/" << c << "/1 " << b
+           << "/" << b << "/1\n";
+      file << "f " << b << "/" << b << "/1 " << c << "/" << c << "/1 " << d
+           << "/" << d << "/1\n";
+    }
+  }
+}
+
+/// @brief 最良値を取る（1 コアの環境ではばらつきが大きい）
+template <typename F> double BestOf(int runs, F &&body) {
+  double best = 1e30;
+  for (int i = 0; i < runs; ++i) {
+    const auto start = Clock::now();
+    body();
+    best = std::min(best, Ms(start));
+  }
+  return best;
+}
+
+} // namespace
+
+int main() {
+  const std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / "bench_mesh_cache";
+  std::filesystem::create_directories(dir);
+
+  std::printf("%6s %10s %10s %12s %12s %12s %12s %8s\n", "grid", "obj MB",
+              "cache MB", "ObjLoader ms", "assimp ms", "map+hash ms",
+              "map only ms", "speedup");
+  for (int n : {64, 256, 512}) {
+    const std::string source = (dir / "grid.obj").string();
+    WriteGridObj(source, n);
+
+    std::vector<Vertex> vertices;
+    std::vector<uint32_t> indices;
+    const double objMs = BestOf(3, [&]() {
+      graphics::ObjLoader::Load(source, vertices, indices);
+    });
+
+    double assimpMs = -1.0;
+#ifdef BENCH_WITH_ASSIMP
+    assimpMs = BestOf(3, [&]() {
+      std::vector<Vertex> v;
+      std::vector<uint32_t> i;
+      graphics::FbxLoader::Load(source, v, i);
+    });
+#endif
+
+    std::vector<Submesh> submeshes;
+    graphics::ConvertMeshToCache(
+        source,
+        [](const std::string &path, std::vector<Vertex> &v,
+           std::vector<uint32_t> &i, std::vector<Submesh> &) {
+          return graphics::ObjLoader::Load(path, v, i);
+        },
+        vertices, indices, submeshes);
+
+    // 読んだ頂点を触るまでを含める（転送の代わりに総和を取る）
+    volatile float sink = 0.0f;
+    bool ok = true;
+    const double hashedMs = BestOf(5, [&]() {
+      core::MappedFile file;
+      MeshCacheView view;
+      ok &= graphics::OpenMeshCache(source, file, view);
+      float sum = 0.0f;
+      for (uint32_t i = 0; i < view.GetVertexCount(); ++i) {
+        sum += view.Vertices()[i].position.y;
+      }
+      sink = sum;
+    });
+    const double mapMs = BestOf(5, [&]() {
+      core::MappedFile file;
+      MeshCacheView view;
+      ok &= file.Open(graphics::MeshCachePathFor(source)) &&
+            view.Parse(file.Data(), file.Size());
+      float sum = 0.0f;
+      for (uint32_t i = 0; i < view.GetVertexCount(); ++i) {
+        sum += view.Vertices()[i].position.y;
+      }
+      sink = sum;
+    });
+    (void)sink;
+
+    const double objMb = std::filesystem::file_size(source) / 1048576.0;
+    const double cacheMb =
+        std::filesystem::file_size(graphics::MeshCachePathFor(source)) /
+        1048576.0;
+    char assimpText[16] = "n/a";
+    if (assimpMs >= 0.0) {
+      std::snprintf(assimpText, sizeof(assimpText), "%.1f", assimpMs);
+    }
+    std::printf("%6d %10.2f %10.2f %12.1f %12s %12.2f %12.2f %7.1fx%s\n", n,
+                objMb, cacheMb, objMs, assimpText, hashedMs, mapMs,
+                objMs / hashedMs, ok ? "" : "  FAILED");
+  }
+  std::filesystem::remove_all(dir);
+  return 0;
+}
@@ -0,0 +1,134 @@
+#include "src/graphics/MeshOptimizer.h"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// OptimizeMesh の前後で頂点キャッシュ（ACMR / ATVR、FIFO 16）と
+// 頂点フェッチ（16KB の行キャッシュでの読み込み量）を比べる。
+// 形は MeshPrimitives::CreateSphere と同じ並びの球、TerrainGenerator の
+// 行順の格子、三角形がばらばらに並んだ OBJ 相当の格子。
+
+using graphics::Vertex;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct TestMesh {
+  const char *name = "";
+  std::vector<Vertex> vertices;
+  std::vector<uint32_t> indices;
+};
+
+TestMesh MakeSphere(int segments) {
+  TestMesh mesh;
+  mesh.name = "sphere";
+  const float pi = 3.14159265358979f;
+  const float r = 1.0f / (segments - 1);
+  for (int ring = 0; ring < segments; ++ring) {
+    for (int s = 0; s < segments; ++s) {
+      const float y = std::sin(-pi * 0.5f + pi * ring * r);
+      const float x = std::cos(2 * pi * s * r) * std::sin(pi * ring * r);
+      const float z = std::sin(2 * pi * s * r) * std::sin(pi * ring * r);
+      Vertex v{};
+      v.position = {x * 0.5f, y * 0.5f, z * 0.5f};
+      v.normal = {x, y, z};
+      v.texCoord = {s * r, ring * r};
+      v.color = {1, 1, 1, 1};
+      mesh.vertices.push_back(v);
+    }
+  }
+  for (int ring = 0; ring < segments - 1; ++ring) {
+    for (int s = 0; s < segments - 1; ++s) {
+      const uint32_t current = ring * segments + s;
+      const uint32_t next = current + segments;
+      mesh.indices.insert(mesh.indices.end(), {current, next, current + 1,
+                                               current + 1, next, next + 1});
+    }
+  }
+  return mesh;
+}
+
+TestMesh MakeGrid(int n, bool shuffled) {
+  TestMesh mesh;
+  mesh.name = shuffled ? "obj soup" : "terrain";
+  for (int y = 0; y <= n; ++y) {
+    for (int x = 0; x <= n; ++x) {
+      Vertex v{};
+      v.position = {static_cast<float>(x), 0.0f, static_cast<float>(y)};
+      v.normal = {0, 1, 0};
+      v.texCoord = {static_cast<float>(x) / n, static_cast<float>(y) / n};
+      mesh.vertices.push_back(v);
+    }
+  }
+  std::vector<std::array<uint32_t, 3>> triangles;
+  const uint32_t row = n + 1;
+  for (int y = 0; y < n; ++y) {
+    for (int x = 0; x < n; ++x) {
+      const uint32_t a = y * row + x;
+      triangles.push_back({a, a + row, a + 1});
+      triangles.push_back({a + 1, a + row, a + row + 1});
+    }
+  }
+  if (shuffled) {
+    std::shuffle(triangles.begin(), triangles.end(), std::mt19937(7));
+    // OBJ の読み込みで頂点が初出順になった状態も崩しておく
+    std::vector<uint32_t> permutation(mesh.vertices.size());
+    for (uint32_t i = 0; i < permutation.size(); ++i) {
+      permutation[i] = i;
+    }
+    std::shuffle(permutation.begin(), permutation.end(), std::mt19937(8));
+    std::vector<Vertex> scrambled(mesh.vertices.size());
+    for (size_t i = 0; i < permutation.size(); ++i) {
+      scrambled[permutation[i]] = mesh.vertices[i];
+    }
+    mesh.vertices.swap(scrambled);
+    for (auto &t : triangles) {
+      for (uint32_t &index : t) {
+        index = permutation[index];
+      }
+    }
+  }
+  for (const auto &t : triangles) {
+    mesh.indices.insert(mesh.indices.end(), t.begin(), t.end());
+  }
+  return mesh;
+}
+
+} // namespace
+
+int main() {
+  std::vector<TestMesh> meshes;
+  meshes.push_back(MakeSphere(16));
+  meshes.push_back(MakeSphere(64));
+  meshes.push_back(MakeGrid(128, false));
+  meshes.push_back(MakeGrid(512, true));
+
+  std::printf("%-10s %8s %7s %7s %7s %7s %9s %9s %9s\n", "mesh", "tris",
+              "ACMR", "->", "ATVR", "->", "overfetch", "->", "ms");
+  for (TestMesh &mesh : meshes) {
+    const auto cacheBefore =
+        graphics::AnalyzeVertexCache(mesh.indices, mesh.vertices.size());
+    const auto fetchBefore = graphics::AnalyzeVertexFetch(
+        mesh.indices, mesh.vertices.size(), sizeof(Vertex));
+
+    const auto start = Clock::now();
+    graphics::OptimizeMesh(mesh.vertices, mesh.indices);
+    const double ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count();
+
+    const auto cacheAfter =
+        graphics::AnalyzeVertexCache(mesh.indices, mesh.vertices.size());
+    const auto fetchAfter = graphics::AnalyzeVertexFetch(
+        mesh.indices, mesh.vertices.size(), sizeof(Vertex));
+    std::printf("%-10s %8u %7.3f %7.3f %7.3f %7.3f %9.3f %9.3f %9.2f\n",
+                mesh.name, cacheBefore.triangles, cacheBefore.acmr,
+                cacheAfter.acmr, cacheBefore.atvr, cacheAfter.atvr,
+                fetchBefore.overfetch, fetchAfter.overfetch, ms);
+  }
+  return 0;
+}
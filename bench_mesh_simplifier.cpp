@@ -0,0 +1,124 @@
+#include "src/graphics/MeshOptimizer.h"
+#include "src/graphics/MeshSimplifier.h"
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// BuildMeshLods の LOD の列（三角形数・誤差）と作る時間。
+// 形は builtin/sphere（16 分割）、細かい球、golfball.fbx 相当のくぼみ付きの
+// 球、TerrainGenerator 相当の起伏のある格子。
+// 「切替」は既定の 1 ピクセルの誤差でその段が選ばれる画面上の大きさ。
+
+using graphics::MeshLod;
+using graphics::Vertex;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct TestMesh {
+  const char *name = "";
+  std::vector<Vertex> vertices;
+  std::vector<uint32_t> indices;
+};
+
+/// dimples > 0 なら経度・緯度方向にくぼみを付ける
+TestMesh MakeSphere(const char *name, int segments, int dimples) {
+  TestMesh mesh;
+  mesh.name = name;
+  const float pi = 3.14159265358979f;
+  const float r = 1.0f / (segments - 1);
+  for (int ring = 0; ring < segments; ++ring) {
+    for (int s = 0; s < segments; ++s) {
+      const float theta = pi * ring * r;
+      const float phi = 2 * pi * s * r;
+      const float y = std::sin(-pi * 0.5f + theta);
+      const float x = std::cos(phi) * std::sin(theta);
+      const float z = std::sin(phi) * std::sin(theta);
+      float radius = 0.5f;
+      if (dimples > 0) {
+        const float d = std::sin(theta * dimples) * std::sin(phi * dimples);
+        radius -= 0.01f * d * d;
+      }
+      Vertex v{};
+      v.position = {x * radius, y * radius, z * radius};
+      v.normal = {x, y, z};
+      v.texCoord = {s * r, ring * r};
+      v.color = {1, 1, 1, 1};
+      mesh.vertices.push_back(v);
+    }
+  }
+  for (int ring = 0; ring < segments - 1; ++ring) {
+    for (int s = 0; s < segments - 1; ++s) {
+      const uint32_t current = ring * segments + s;
+      const uint32_t next = current + segments;
+      mesh.indices.insert(mesh.indices.end(), {current, next, current + 1,
+                                               current + 1, next, next + 1});
+    }
+  }
+  return mesh;
+}
+
+TestMesh MakeTerrain(int n) {
+  TestMesh mesh;
+  mesh.name = "terrain";
+  for (int y = 0; y <= n; ++y) {
+    for (int x = 0; x <= n; ++x) {
+      Vertex v{};
+      const float h = 4.0f * std::sin(x * 0.05f) * std::cos(y * 0.07f);
+      v.position = {static_cast<float>(x), h, static_cast<float>(y)};
+      v.normal = {0, 1, 0};
+      v.texCoord = {static_cast<float>(x) / n, static_cast<float>(y) / n};
+      mesh.vertices.push_back(v);
+    }
+  }
+  const uint32_t row = n + 1;
+  for (int y = 0; y < n; ++y) {
+    for (int x = 0; x < n; ++x) {
+      const uint32_t a = y * row + x;
+      mesh.indices.insert(mesh.indices.end(), {a, a + row, a + 1, a + 1,
+                                               a + row, a + row + 1});
+    }
+  }
+  return mesh;
+}
+
+} // namespace
+
+int main() {
+  std::vector<TestMesh> meshes;
+  meshes.push_back(MakeSphere("sphere16", 16, 0));
+  meshes.push_back(MakeSphere("sphere64", 64, 0));
+  meshes.push_back(MakeSphere("golfball", 128, 18));
+  meshes.push_back(MakeTerrain(256));
+
+  std::printf("%-10s %4s %9s %8s %9s %10s %9s\n", "mesh", "lod", "tris",
+              "ratio", "error", "switch px", "ms");
+  for (TestMesh &mesh : meshes) {
+    graphics::OptimizeMesh(mesh.vertices, mesh.indices);
+    const size_t sourceTriangles = mesh.indices.size() / 3;
+
+    const auto start = Clock::now();
+    const std::vector<MeshLod> lods =
+        graphics::BuildMeshLods(mesh.vertices, mesh.indices);
+    const double ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count();
+
+    for (size_t i = 0; i < lods.size(); ++i) {
+      const MeshLod &lod = lods[i];
+      const double switchPx =
+          lod.error > 0.0f ? graphics::kLodPixelError / lod.error : 0.0;
+      std::printf("%-10s %4zu %9u %7.1f%% %9.5f %10.0f", mesh.name, i,
+                  lod.indexCount / 3,
+                  100.0 * lod.indexCount / 3 / sourceTriangles, lod.error,
+                  switchPx);
+      if (i == 0) {
+        std::printf(" %9.2f  (%.2f Mtri/s)", ms,
+                    sourceTriangles / (ms * 1000.0));
+      }
+      std::printf("\n");
+    }
+  }
+  return 0;
+}
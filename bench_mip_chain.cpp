@@ -0,0 +1,92 @@
+#include "src/core/ThreadPool.h"
+#include "src/graphics/MipChain.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// ミップチェーン（レベル 1 から 1x1 まで）の生成速度を、入力（レベル 0）の
+// 画素数あたりで測る。画像は記事テクスチャに近い「白地に黒い文字の点」。
+// hash は SSE2 版とスカラー版（-U__SSE2__）の結果の一致確認用。
+
+using graphics::MipChainSettings;
+using graphics::MipFilter;
+using graphics::MipLevel;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+std::vector<uint8_t> MakeArticleLike(uint32_t w, uint32_t h) {
+  std::mt19937 rng(w * 31 + h);
+  std::vector<uint8_t> image(static_cast<size_t>(w) * h * 4, 250);
+  for (size_t i = 0; i < image.size() / 4; ++i) {
+    if (rng() % 9 == 0) {
+      const uint8_t ink = static_cast<uint8_t>(rng() % 64);
+      image[i * 4] = image[i * 4 + 1] = image[i * 4 + 2] = ink;
+    }
+    image[i * 4 + 3] = 255;
+  }
+  return image;
+}
+
+uint64_t Hash(const std::vector<MipLevel> &levels) {
+  uint64_t h = 1469598103934665603ull;
+  for (const MipLevel &level : levels) {
+    for (uint8_t v : level.pixels) {
+      h = (h ^ v) * 1099511628211ull;
+    }
+  }
+  return h;
+}
+
+const char *FilterName(const MipChainSettings &s) {
+  if (s.filter == MipFilter::Box) {
+    return s.srgb ? "box-srgb" : "box";
+  }
+  return s.srgb ? "kaiser-srgb" : "kaiser";
+}
+
+} // namespace
+
+int main() {
+  core::ThreadPool &pool = core::ThreadPool::Shared();
+  std::printf("threads: %zu\n\n", pool.GetConcurrency());
+  std::printf("%11s %12s %8s %10s %10s %18s\n", "size", "filter", "pool",
+              "ms", "MPix/s", "hash");
+
+  const uint32_t sizes[][2] = {{1024, 1024}, {4096, 4096}, {3000, 8192}};
+  for (const auto &size : sizes) {
+    const uint32_t w = size[0], h = size[1];
+    const std::vector<uint8_t> image = MakeArticleLike(w, h);
+    for (MipFilter filter : {MipFilter::Box, MipFilter::Kaiser}) {
+      for (bool srgb : {false, true}) {
+        MipChainSettings settings;
+        settings.filter = filter;
+        settings.srgb = srgb;
+        for (bool parallel : {false, true}) {
+          std::vector<MipLevel> levels;
+          graphics::GenerateMipChain(image.data(), w, h, w * 4, settings,
+                                     levels, parallel ? &pool : nullptr);
+          const int runs = w * h > 4000000 ? 2 : 5;
+          double best = 1e30;
+          for (int r = 0; r < runs; ++r) {
+            const auto start = Clock::now();
+            graphics::GenerateMipChain(image.data(), w, h, w * 4, settings,
+                                       levels, parallel ? &pool : nullptr);
+            best = std::min(best, std::chrono::duration<double, std::milli>(
+                                      Clock::now() - start)
+                                      .count());
+          }
+          char label[32];
+          std::snprintf(label, sizeof(label), "%ux%u", w, h);
+          std::printf("%11s %12s %8s %10.2f %10.1f %18llx\n", label,
+                      FilterName(settings), parallel ? "yes" : "no", best,
+                      static_cast<double>(w) * h / (best * 1000.0),
+                      static_cast<unsigned long long>(Hash(levels)));
+        }
+      }
+    }
+  }
+  return 0;
+}
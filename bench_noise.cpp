@@ -0,0 +1,161 @@
+#include "src/core/Noise.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// ノイズ1サンプルあたりのスループットを比較する。
+// legacy は旧 SkyboxTextureGenerator の GenerateNoise / GenerateFBM /
+// GenerateWorleyNoise と同じ実装（ハッシュをラムダで毎回組み立てる）。
+
+namespace noise = core::noise;
+using Clock = std::chrono::steady_clock;
+
+static float LegacyNoise(float x, float y, float z) {
+  int xi = static_cast<int>(std::floor(x));
+  int yi = static_cast<int>(std::floor(y));
+  int zi = static_cast<int>(std::floor(z));
+  float xf = x - xi, yf = y - yi, zf = z - zi;
+  float u = xf * xf * (3.0f - 2.0f * xf);
+  float v = yf * yf * (3.0f - 2.0f * yf);
+  float w = zf * zf * (3.0f - 2.0f * zf);
+  auto hash = [](int a, int b, int c) -> float {
+    int n = a * 374761393 + b * 668265263 + c;
+    n = (n ^ (n >> 13)) * 1274126177;
+    return static_cast<float>((n ^ (n >> 16)) & 0x7FFFFFFF) / 2147483647.0f;
+  };
+  float c00 = hash(xi, yi, zi) * (1 - u) + hash(xi + 1, yi, zi) * u;
+  float c10 = hash(xi, yi + 1, zi) * (1 - u) + hash(xi + 1, yi + 1, zi) * u;
+  float c01 = hash(xi, yi, zi + 1) * (1 - u) + hash(xi + 1, yi, zi + 1) * u;
+  float c11 =
+      hash(xi, yi + 1, zi + 1) * (1 - u) + hash(xi + 1, yi + 1, zi + 1) * u;
+  float c0 = c00 * (1 - v) + c10 * v;
+  float c1 = c01 * (1 - v) + c11 * v;
+  return c0 * (1 - w) + c1 * w;
+}
+
+static float LegacyFBM(float x, float y, float z, int octaves) {
+  float value = 0.0f, amplitude = 1.0f, frequency = 1.0f, maxValue = 0.0f;
+  for (int i = 0; i < octaves; ++i) {
+    value +=
+        LegacyNoise(x * frequency, y * frequency, z * frequency) * amplitude;
+    maxValue += amplitude;
+    amplitude *= 0.5f;
+    frequency *= 2.0f;
+  }
+  return value / maxValue;
+}
+
+static float LegacyWorley(float x, float y, float z) {
+  int xi = static_cast<int>(std::floor(x));
+  int yi = static_cast<int>(std::floor(y));
+  int zi = static_cast<int>(std::floor(z));
+  float minDist = 10.0f;
+  for (int dx = -1; dx <= 1; ++dx) {
+    for (int dy = -1; dy <= 1; ++dy) {
+      for (int dz = -1; dz <= 1; ++dz) {
+        int cx = xi + dx, cy = yi + dy, cz = zi + dz;
+        auto hash = [](int a, int b, int c) -> float {
+          int n = a * 374761393 + b * 668265263 + c;
+          n = (n ^ (n >> 13)) * 1274126177;
+          return static_cast<float>((n ^ (n >> 16)) & 0x7FFFFFFF) /
+                 2147483647.0f;
+        };
+        float px = cx + hash(cx, cy, cz);
+        float py = cy + hash(cx + 1, cy, cz);
+        float pz = cz + hash(cx, cy + 1, cz);
+        float dist = std::sqrt((x - px) * (x - px) + (y - py) * (y - py) +
+                               (z - pz) * (z - pz));
+        minDist = std::min(minDist, dist);
+      }
+    }
+  }
+  return 1.0f - std::min(minDist, 1.0f);
+}
+
+struct Samples {
+  std::vector<float> xs, ys, zs, out;
+};
+
+template <typename Fn>
+static double MSamplesPerSec(const Samples &s, int runs, Fn &&fn) {
+  auto start = Clock::now();
+  for (int r = 0; r < runs; ++r) {
+    fn();
+  }
+  const double sec =
+      std::chrono::duration<double>(Clock::now() - start).count();
+  return static_cast<double>(s.xs.size()) * runs / sec / 1e6;
+}
+
+int main() {
+  // 512x512 のスカイボックス1面ぶんの方向相当
+  const size_t count = 512 * 512;
+  Samples s;
+  s.xs.resize(count);
+  s.ys.resize(count);
+  s.zs.resize(count);
+  s.out.resize(count);
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<float> dist(-3.0f, 3.0f);
+  for (size_t i = 0; i < count; ++i) {
+    s.xs[i] = dist(rng);
+    s.ys[i] = dist(rng);
+    s.zs[i] = dist(rng);
+  }
+  const int runs = 3;
+  float *out = s.out.data();
+  const float *xs = s.xs.data();
+  const float *ys = s.ys.data();
+  const float *zs = s.zs.data();
+
+  noise::FractalSettings fbm5;
+  fbm5.basis = noise::Basis::Value;
+  fbm5.octaves = 5;
+
+  std::printf("%-14s %12s %12s %12s   (Msamples/s)\n", "function", "legacy",
+              "scalar", "batch");
+
+  auto row = [&](const char *name, auto legacy, auto scalar, auto batch) {
+    const double a = legacy ? MSamplesPerSec(s, runs, [&]() {
+                                for (size_t i = 0; i < count; ++i) {
+                                  out[i] = legacy(xs[i], ys[i], zs[i]);
+                                }
+                              })
+                            : 0.0;
+    const double b = MSamplesPerSec(s, runs, [&]() {
+      for (size_t i = 0; i < count; ++i) {
+        out[i] = scalar(xs[i], ys[i], zs[i]);
+      }
+    });
+    const double c = MSamplesPerSec(s, runs, [&]() { batch(); });
+    if (legacy) {
+      std::printf("%-14s %12.2f %12.2f %12.2f\n", name, a, b, c);
+    } else {
+      std::printf("%-14s %12s %12.2f %12.2f\n", name, "-", b, c);
+    }
+  };
+
+  using Fn3 = float (*)(float, float, float);
+  row("value", static_cast<Fn3>(LegacyNoise),
+      [](float x, float y, float z) { return noise::Value3(x, y, z); },
+      [&]() { noise::Value3Batch(xs, ys, zs, out, count); });
+  row("fbm5 (value)",
+      static_cast<Fn3>([](float x, float y, float z) {
+        return LegacyFBM(x, y, z, 5);
+      }),
+      [&](float x, float y, float z) { return noise::Fbm3(x, y, z, fbm5); },
+      [&]() { noise::Fbm3Batch(xs, ys, zs, out, count, fbm5); });
+  row("worley", static_cast<Fn3>(LegacyWorley),
+      [](float x, float y, float z) { return noise::Worley3(x, y, z); },
+      [&]() { noise::Worley3Batch(xs, ys, zs, out, count); });
+  row("perlin3", static_cast<Fn3>(nullptr),
+      [](float x, float y, float z) { return noise::Perlin3(x, y, z); },
+      [&]() { noise::Perlin3Batch(xs, ys, zs, out, count); });
+  row("simplex2", static_cast<Fn3>(nullptr),
+      [](float x, float y, float) { return noise::Simplex2(x, y); },
+      [&]() { noise::Simplex2Batch(xs, ys, out, count); });
+  return 0;
+}
@@ -0,0 +1,100 @@
+#include "src/core/ThreadPool.h"
+#include "src/graphics/ObjLoader.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+// ObjLoader の 1 スレッドと並列読み込みの比較（接線生成を含む読み込み全体）。
+// 一時ディレクトリに格子の OBJ（既定 100 MB、引数で MB を指定）を書いて読む。
+// 並列の結果が 1 スレッドと一致するかも確かめる。
+
+using graphics::Vertex;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+double Ms(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+/// 格子 1 マスあたりおよそ 135 バイトになる
+void WriteGridObj(const std::string &path, int n) {
+  std::ofstream file(path, std::ios::binary);
+  for (int y = 0; y <= n; ++y) {
+    for (int x = 0; x <= n; ++x) {
+      file << "v " << x * 0.1f << " " << ((x * 7 + y * 13) % 17) * 0.01f
+           << " " << y * 0.1f << "\n";
+    }
+  }
+  for (int y = 0; y <= n; ++y) {
+    for (int x = 0; x <= n; ++x) {
+      file << "vt " << static_cast<float>(x) / n << " "
+           << static_cast<float>(y) / n << "\n";
+    }
+  }
+  file << "vn 0 1 0\n";
+  const int row = n + 1;
+  for (int y = 0; y < n; ++y) {
+    for (int x = 0; x < n; ++x) {
+      const int a = y * row + x + 1;
+      const int b = a + 1;
+      const int c = a + row;
+      const int d = c + 1;
+      file << "f " << a << "/" << a << "/1 " << c << "/" << c << "/1 " << b
+           << "/" << b << "/1\n";
+      file << "f " << b << "/" << b << "/1 " << c << "/" << c << "/1 " << d
+           << "/" << d << "/1\n";
+    }
+  }
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  const double targetMb = argc > 1 ? std::atof(argv[1]) : 100.0;
+  const int n = std::max(
+      8, static_cast<int>(std::sqrt(targetMb * 1048576.0 / 135.0)));
+  const std::filesystem::path path =
+      std::filesystem::temp_directory_path() / "bench_obj_loader.obj";
+  WriteGridObj(path.string(), n);
+  const double mb = std::filesystem::file_size(path) / 1048576.0;
+
+  core::ThreadPool &pool = core::ThreadPool::Shared();
+  std::printf("%.1f MB OBJ (%dx%d grid), threads: %zu\n\n", mb, n, n,
+              pool.GetConcurrency());
+  std::printf("%10s %10s %10s %12s %10s\n", "mode", "ms", "MB/s", "vertices",
+              "indices");
+
+  std::vector<Vertex> serialVertices;
+  std::vector<uint32_t> serialIndices;
+  auto start = Clock::now();
+  graphics::ObjLoader::Load(path.string(), serialVertices, serialIndices);
+  const double serialMs = Ms(start);
+  std::printf("%10s %10.1f %10.1f %12zu %10zu\n", "serial", serialMs,
+              mb / (serialMs / 1000.0), serialVertices.size(),
+              serialIndices.size());
+
+  std::vector<Vertex> vertices;
+  std::vector<uint32_t> indices;
+  start = Clock::now();
+  graphics::ObjLoader::Load(path.string(), vertices, indices, &pool);
+  const double parallelMs = Ms(start);
+  const bool identical =
+      vertices.size() == serialVertices.size() && indices == serialIndices &&
+      std::memcmp(vertices.data(), serialVertices.data(),
+                  vertices.size() * sizeof(Vertex)) == 0;
+  std::printf("%10s %10.1f %10.1f %12zu %10zu%s\n", "parallel", parallelMs,
+              mb / (parallelMs / 1000.0), vertices.size(), indices.size(),
+              identical ? "" : "  MISMATCH");
+  std::printf("\nspeedup: %.2fx\n", serialMs / parallelMs);
+
+  std::filesystem::remove(path);
+  return 0;
+}
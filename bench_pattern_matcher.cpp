@@ -0,0 +1,102 @@
+#include "src/core/PatternMatcher.h"
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+// 長い記事からリンク名の全出現を探す時間を、リンクごとに find を繰り返す
+// 旧実装と、オートマトンの構築＋1回の走査で比べる。
+
+using core::PatternMatch;
+using core::WPatternMatcher;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+/// @brief 日本語の記事に似た本文（漢字・かな・句読点）
+std::wstring MakeArticle(size_t length, std::mt19937 &rng) {
+  const std::wstring common = L"のはにをとがでてしたる。、";
+  std::wstring text;
+  text.reserve(length);
+  while (text.size() < length) {
+    const int run = 1 + static_cast<int>(rng() % 4);
+    for (int i = 0; i < run; ++i) {
+      text.push_back(static_cast<wchar_t>(0x4E00 + rng() % 600));
+    }
+    text.push_back(common[rng() % common.size()]);
+  }
+  text.resize(length);
+  return text;
+}
+
+template <typename Fn> double MeasureMs(int runs, Fn &&fn) {
+  fn();
+  const auto start = Clock::now();
+  for (int i = 0; i < runs; ++i) {
+    fn();
+  }
+  const auto end = Clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count() / runs;
+}
+
+} // namespace
+
+int main() {
+  std::printf("%9s %7s %9s %11s %11s %11s %9s\n", "chars", "links",
+              "matches", "find ms", "build ms", "scan ms", "speedup");
+
+  const size_t lengths[] = {5000, 50000, 200000};
+  const size_t linkCounts[] = {100, 300, 800};
+  for (size_t length : lengths) {
+    for (size_t linkCount : linkCounts) {
+      std::mt19937 rng(static_cast<uint32_t>(length + linkCount));
+      const std::wstring article = MakeArticle(length, rng);
+
+      // 半分は本文中の語、残りは本文にないことが多い語
+      std::vector<std::wstring> titles;
+      for (size_t i = 0; i < linkCount; ++i) {
+        const size_t len = 2 + rng() % 4;
+        if (i % 2 == 0) {
+          titles.push_back(article.substr(rng() % (length - len), len));
+        } else {
+          std::wstring title;
+          for (size_t k = 0; k < len; ++k) {
+            title.push_back(static_cast<wchar_t>(0x4E00 + rng() % 600));
+          }
+          titles.push_back(title);
+        }
+      }
+      const std::vector<std::wstring_view> views(titles.begin(),
+                                                 titles.end());
+
+      size_t naiveMatches = 0;
+      const double findMs = MeasureMs(3, [&] {
+        naiveMatches = 0;
+        for (const auto &title : titles) {
+          size_t pos = article.find(title);
+          while (pos != std::wstring::npos) {
+            ++naiveMatches;
+            pos = article.find(title, pos + 1);
+          }
+        }
+      });
+
+      WPatternMatcher matcher;
+      const double buildMs = MeasureMs(3, [&] { matcher.Build(views); });
+      std::vector<PatternMatch> matches;
+      const double scanMs = MeasureMs(3, [&] {
+        matches.clear();
+        matcher.FindAll(article, matches);
+      });
+
+      std::printf("%9zu %7zu %9zu %11.3f %11.3f %11.3f %8.1fx\n", length,
+                  linkCount, matches.size(), findMs, buildMs, scanMs,
+                  findMs / (buildMs + scanMs));
+      if (matches.size() != naiveMatches) {
+        std::printf("  (match count differs: find=%zu)\n", naiveMatches);
+      }
+    }
+  }
+  return 0;
+}
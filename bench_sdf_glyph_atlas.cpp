@@ -0,0 +1,161 @@
+#include "src/graphics/ArticleGlyphInstances.h"
+#include "src/graphics/SdfGlyphAtlas.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+// SDF グリフアトラスの生成時間と、記事1ページ分の四角形（インスタンス）を
+// 作る時間を測る。メモリは、記事全体を1枚のテクスチャ（BGRA8）に描く
+// 従来方式と、アトラス＋インスタンスバッファで比べる。
+// アウトラインは漢字程度の複雑さ（画 3〜8 本 + 曲線 1 本、辺 100 前後）を
+// 合成する。
+
+using graphics::ArticleFont;
+using graphics::GlyphInstance;
+using graphics::GlyphOutline;
+using graphics::GlyphOutlineProvider;
+using graphics::SdfGlyphAtlas;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+/// @brief 文字ごとに決まった画と曲線からなる合成アウトライン
+class SyntheticOutlines final : public GlyphOutlineProvider {
+public:
+  bool GetOutline(ArticleFont, char32_t c,
+                  GlyphOutline &outline) const override {
+    outline.contours.clear();
+    if (c == U' ' || c == U'\n') {
+      return true;
+    }
+    std::mt19937 rng(static_cast<uint32_t>(c));
+    std::uniform_real_distribution<float> pos(0.1f, 0.8f);
+    const int strokes = 3 + static_cast<int>(rng() % 6);
+    for (int i = 0; i < strokes; ++i) {
+      const float x = pos(rng);
+      const float y = pos(rng) - 0.1f;
+      const bool horizontal = rng() % 2 == 0;
+      const float w = horizontal ? 0.1f + pos(rng) * 0.5f : 0.07f;
+      const float h = horizontal ? 0.07f : 0.1f + pos(rng) * 0.5f;
+      outline.contours.push_back(
+          {{x, y}, {x + w, y}, {x + w, y + h}, {x, y + h}});
+    }
+    // 払い・はねの代わりの円弧（32 分割の輪）
+    std::vector<graphics::GlyphPoint> outer, inner;
+    const float cx = pos(rng), cy = pos(rng) - 0.1f;
+    for (int i = 0; i < 32; ++i) {
+      const float a = 6.2831853f * i / 32.0f;
+      outer.push_back({cx + 0.2f * std::cos(a), cy + 0.2f * std::sin(a)});
+      inner.push_back({cx + 0.13f * std::cos(-a), cy + 0.13f * std::sin(-a)});
+    }
+    outline.contours.push_back(outer);
+    outline.contours.push_back(inner);
+    return true;
+  }
+};
+
+/// @brief UTF-8 で1文字足す
+void AppendUtf8(std::string &out, char32_t c) {
+  if (c < 0x80) {
+    out.push_back(static_cast<char>(c));
+  } else if (c < 0x800) {
+    out.push_back(static_cast<char>(0xC0 | (c >> 6)));
+    out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+  } else {
+    out.push_back(static_cast<char>(0xE0 | (c >> 12)));
+    out.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+    out.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+  }
+}
+
+/// @brief 漢字 600 種と句読点からなる本文（段落あり）
+std::string MakeArticle(size_t chars, std::mt19937 &rng) {
+  std::string text;
+  for (size_t i = 0; i < chars; ++i) {
+    if (i % 400 == 399) {
+      text += "\n";
+    } else if (rng() % 12 == 0) {
+      AppendUtf8(text, U'。');
+    } else {
+      AppendUtf8(text, static_cast<char32_t>(0x4E00 + rng() % 600));
+    }
+  }
+  return text;
+}
+
+} // namespace
+
+int main() {
+  SyntheticOutlines outlines;
+
+  // 1) アトラスの生成（グリフ数と解像度を変える）
+  std::printf("%7s %6s %10s %10s %9s %8s\n", "glyphs", "ppem", "total ms",
+              "us/glyph", "atlas MB", "used %");
+  const size_t glyphCounts[] = {500, 2000};
+  const float resolutions[] = {32.0f, 48.0f};
+  for (float ppem : resolutions) {
+    for (size_t count : glyphCounts) {
+      graphics::SdfAtlasConfig config;
+      config.pixelsPerEm = ppem;
+      config.spread = ppem / 8.0f;
+      config.size = ppem > 32.0f ? 4096 : 2048;
+      SdfGlyphAtlas atlas(config);
+      const auto start = Clock::now();
+      for (size_t i = 0; i < count; ++i) {
+        atlas.GetOrAdd(ArticleFont::Body, static_cast<char32_t>(0x4E00 + i),
+                       outlines);
+      }
+      const double ms =
+          std::chrono::duration<double, std::milli>(Clock::now() - start)
+              .count();
+      const double atlasMB = atlas.GetPixels().size() / 1048576.0;
+      std::printf("%7zu %6.0f %10.2f %10.1f %9.1f %7.1f%%%s\n", count, ppem,
+                  ms, ms * 1000.0 / count, atlasMB,
+                  100.0 * atlas.GetStats().usedHeight / config.size,
+                  atlas.GetStats().failed ? " (full)" : "");
+    }
+  }
+
+  // 2) 記事1ページ分のインスタンス（アトラスは温まった状態）とメモリ
+  std::printf("\n%9s %8s %10s %11s %10s %11s %10s\n", "chars", "quads",
+              "build ms", "inst MB", "atlas MB", "full MB", "ratio");
+  graphics::TableGlyphMetrics metrics;
+  graphics::ArticleLayoutEngine engine(metrics);
+  SdfGlyphAtlas atlas;
+  const size_t lengths[] = {5000, 20000, 80000};
+  for (size_t length : lengths) {
+    std::mt19937 rng(static_cast<uint32_t>(length));
+    graphics::ArticleLayoutInput input;
+    input.title = "ベンチマーク";
+    input.text = MakeArticle(length, rng);
+    const uint32_t width = 3000;
+    const graphics::ArticleLayout layout = engine.Layout(input, width, 32768);
+
+    std::vector<GlyphInstance> instances;
+    graphics::BuildGlyphInstances(layout, atlas, outlines, instances);
+    const int runs = 10;
+    const auto start = Clock::now();
+    for (int i = 0; i < runs; ++i) {
+      graphics::BuildGlyphInstances(layout, atlas, outlines, instances);
+    }
+    const double ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count() /
+        runs;
+
+    // 従来方式は本文の下端まで（LoadPage と同じく 32768 で頭打ち）
+    const double height = std::min(layout.bodyBottom + 200.0f, 32768.0f);
+    const double fullMB = width * height * 4.0 / 1048576.0;
+    const double instMB =
+        instances.size() * sizeof(GlyphInstance) / 1048576.0;
+    const double atlasMB = atlas.GetPixels().size() / 1048576.0;
+    std::printf("%9zu %8zu %10.3f %11.2f %10.1f %11.1f %9.1f%%\n", length,
+                instances.size(), ms, instMB, atlasMB, fullMB,
+                100.0 * (instMB + atlasMB) / fullMB);
+  }
+  return 0;
+}
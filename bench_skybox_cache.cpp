@@ -0,0 +1,117 @@
+#include "src/core/MappedFile.h"
+#include "src/core/ThreadPool.h"
+#include "src/graphics/BlockCompression.h"
+#include "src/graphics/SkyboxCache.h"
+#include "src/graphics/SkyboxFaceGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+// スカイボックスの圧縮キャッシュ（.wgsky）と PNG の比較。符号化時間、
+// マップ + 検証の時間、ファイルと VRAM の大きさ、復号した段 0 の PSNR を出す。
+// PNG は同梱の Assets/textures/runtime_skybox/skybox_Default_*.png の
+// ファイルの大きさのみ（WIC での展開時間はゲーム側のログで見る）。
+
+using graphics::BlockFormat;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+double Ms(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+double Psnr(const std::vector<uint8_t> &a, const std::vector<uint8_t> &b) {
+  double sum = 0.0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    const double d = static_cast<double>(a[i]) - b[i];
+    sum += d * d;
+  }
+  if (sum == 0.0) {
+    return 99.0;
+  }
+  return 10.0 * std::log10(255.0 * 255.0 / (sum / a.size()));
+}
+
+uintmax_t PngBytes() {
+  uintmax_t bytes = 0;
+  for (const char *face : {"px", "nx", "py", "ny", "pz", "nz"}) {
+    std::error_code ec;
+    const uintmax_t size = std::filesystem::file_size(
+        std::string("Assets/textures/runtime_skybox/skybox_Default_") + face +
+            ".png",
+        ec);
+    bytes += ec ? 0 : size;
+  }
+  return bytes;
+}
+
+} // namespace
+
+int main() {
+  core::ThreadPool &pool = core::ThreadPool::Shared();
+  const uint32_t faceSize = 512;
+  DirectX::XMFLOAT3 top, horizon, bottom;
+  graphics::GetSkyboxThemeColors(graphics::SkyboxTheme::Default, top, horizon,
+                                 bottom);
+  std::vector<std::vector<uint8_t>> faces;
+  graphics::GenerateSkyboxFaces(top, horizon, bottom, faceSize,
+                                graphics::SkyboxTheme::Default, faces, &pool);
+
+  const uint64_t rgbaBytes = 6ull * faceSize * faceSize * 4;
+  std::printf("threads: %zu, face %u, Default theme\n\n",
+              pool.GetConcurrency(), faceSize);
+  std::printf("%8s %10s %10s %10s %8s %8s\n", "format", "encode ms",
+              "load ms", "KB", "mips", "PSNR");
+  std::printf("%8s %10s %10s %10llu %8d %8s\n", "PNG", "-", "-",
+              static_cast<unsigned long long>(PngBytes() / 1024), 1, "-");
+  std::printf("%8s %10s %10s %10llu %8d %8s\n", "RGBA8", "-", "-",
+              static_cast<unsigned long long>(rgbaBytes / 1024), 1, "-");
+
+  graphics::MipChainSettings mips;
+  mips.filter = graphics::MipFilter::Kaiser;
+  mips.srgb = true;
+  const std::filesystem::path path =
+      std::filesystem::temp_directory_path() / "bench_skybox_cache.wgsky";
+
+  for (BlockFormat format : {BlockFormat::BC1, BlockFormat::BC7}) {
+    std::vector<uint8_t> bytes;
+    auto start = Clock::now();
+    graphics::EncodeSkyboxCache(faces, faceSize, format, mips, bytes, &pool);
+    const double encodeMs = Ms(start);
+    graphics::WriteSkyboxCache(path, bytes);
+
+    // 読み込みはマップ + チェックサム検証まで（GPU への転送は含まない）
+    double loadMs = 1e30;
+    core::MappedFile file;
+    graphics::SkyboxCacheView view;
+    for (int r = 0; r < 5; ++r) {
+      file.Close();
+      start = Clock::now();
+      if (!file.Open(path) || !view.Parse(file.Data(), file.Size())) {
+        std::printf("failed to load %s\n", path.string().c_str());
+        return 1;
+      }
+      loadMs = std::min(loadMs, Ms(start));
+    }
+
+    std::vector<uint8_t> decoded(faces[0].size());
+    double psnr = 99.0;
+    for (uint32_t face = 0; face < 6; ++face) {
+      graphics::DecompressImage(view.Level(face, 0), faceSize, faceSize,
+                                format, decoded.data());
+      psnr = std::min(psnr, Psnr(faces[face], decoded));
+    }
+    std::printf("%8s %10.1f %10.2f %10llu %8u %8.1f\n",
+                format == BlockFormat::BC1 ? "BC1" : "BC7", encodeMs, loadMs,
+                static_cast<unsigned long long>(file.Size() / 1024),
+                view.GetMipLevels(), psnr);
+    file.Close();
+  }
+  std::filesystem::remove(path);
+  return 0;
+}
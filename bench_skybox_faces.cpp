@@ -0,0 +1,67 @@
+#include "src/core/ThreadPool.h"
+#include "src/graphics/SkyboxFaceGenerator.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// スカイボックス6面の生成時間。1スレッドとプール（行の帯ごとに並列）を
+// 比べる。hash は SSE2 版とスカラー版（-U__SSE2__）、スレッド数による
+// 結果の一致確認用。
+
+using graphics::SkyboxTheme;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+uint64_t Hash(const std::vector<std::vector<uint8_t>> &faces) {
+  uint64_t h = 1469598103934665603ull;
+  for (const std::vector<uint8_t> &face : faces) {
+    for (uint8_t v : face) {
+      h = (h ^ v) * 1099511628211ull;
+    }
+  }
+  return h;
+}
+
+} // namespace
+
+int main() {
+  core::ThreadPool &pool = core::ThreadPool::Shared();
+  std::printf("threads: %zu\n\n", pool.GetConcurrency());
+  std::printf("%6s %16s %6s %10s %10s %18s\n", "face", "theme", "pool", "ms",
+              "MPix/s", "hash");
+
+  const struct {
+    SkyboxTheme theme;
+    const char *name;
+  } themes[] = {{SkyboxTheme::Default, "Default"},
+                {SkyboxTheme::SpaceAstronomy, "SpaceAstronomy"},
+                {SkyboxTheme::SciFi, "SciFi"}};
+
+  for (int faceSize : {512, 2048}) {
+    for (const auto &entry : themes) {
+      DirectX::XMFLOAT3 top, horizon, bottom;
+      graphics::GetSkyboxThemeColors(entry.theme, top, horizon, bottom);
+      for (bool parallel : {false, true}) {
+        std::vector<std::vector<uint8_t>> faces;
+        const int runs = faceSize > 1024 ? 1 : 3;
+        double best = 1e30;
+        for (int r = 0; r < runs; ++r) {
+          const auto start = Clock::now();
+          graphics::GenerateSkyboxFaces(top, horizon, bottom, faceSize,
+                                        entry.theme, faces,
+                                        parallel ? &pool : nullptr);
+          best = std::min(best, std::chrono::duration<double, std::milli>(
+                                    Clock::now() - start)
+                                    .count());
+        }
+        std::printf("%6d %16s %6s %10.1f %10.2f %18llx\n", faceSize,
+                    entry.name, parallel ? "yes" : "no", best,
+                    6.0 * faceSize * faceSize / (best * 1000.0),
+                    static_cast<unsigned long long>(Hash(faces)));
+      }
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,127 @@
+#include "src/game/systems/SphereContactSolver.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// PhysicsSystem と同じ 240Hz サブステップで静的球の床に球の柱を積ませ、
+// ウォームスタート有無の反復回数と1ステップの時間を比較する。
+// 前半は落下・着地、後半（積み重なった状態）だけを集計する。
+
+using game::systems::SphereBody;
+using game::systems::SphereContactSolver;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr float kRadius = 0.5f;
+constexpr float kDt = 1.0f / 240.0f;
+
+constexpr int kStackHeight = 10;
+
+int PileSide(int count) {
+  const int columns = (count + kStackHeight - 1) / kStackHeight;
+  return std::max(1, static_cast<int>(std::ceil(std::sqrt(columns))));
+}
+
+std::vector<SphereBody> MakePile(int count) {
+  // side x side 本の柱に最大 kStackHeight 段ずつ積む。
+  // 柱の真下には静的球の床を置き、わずかな隙間から落として着地させる。
+  const int side = PileSide(count);
+  std::vector<SphereBody> bodies;
+  bodies.reserve(count + side * side);
+
+  for (int z = 0; z < side; ++z) {
+    for (int x = 0; x < side; ++x) {
+      SphereBody floor;
+      floor.id = 0x80000000u | static_cast<uint32_t>(bodies.size());
+      floor.position[0] = x * 1.5f;
+      floor.position[1] = -kRadius;
+      floor.position[2] = z * 1.5f;
+      floor.radius = kRadius;
+      floor.invMass = 0.0f;
+      bodies.push_back(floor);
+    }
+  }
+
+  for (int i = 0; i < count; ++i) {
+    const int column = i % (side * side);
+    const int level = i / (side * side);
+    SphereBody b;
+    b.id = static_cast<uint32_t>(i);
+    b.position[0] = (column % side) * 1.5f;
+    b.position[1] = kRadius + 0.02f + level * 1.02f;
+    b.position[2] = (column / side) * 1.5f;
+    b.radius = kRadius;
+    b.invMass = 1.0f;
+    b.restitution = 0.3f;
+    bodies.push_back(b);
+  }
+  return bodies;
+}
+
+struct Result {
+  double avgIterations = 0.0;
+  double msPerStep = 0.0;
+};
+
+Result Run(int count, bool warmStart, int steps) {
+  std::vector<SphereBody> bodies = MakePile(count);
+
+  SphereContactSolver solver;
+  auto settings = solver.GetSettings();
+  settings.warmStart = warmStart;
+  settings.maxIterations = 30;
+  solver.SetSettings(settings);
+
+  long long iterationSum = 0;
+  double solveMs = 0.0;
+  const int measureFrom = steps / 2;
+  for (int s = 0; s < steps; ++s) {
+    for (auto &b : bodies) {
+      if (b.invMass > 0.0f) {
+        b.velocity[1] -= 9.8f * kDt;
+      }
+    }
+
+    const auto start = Clock::now();
+    const int iterations = solver.Solve(bodies, kDt).iterations;
+    const double ms =
+        std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+    if (s >= measureFrom) {
+      iterationSum += iterations;
+      solveMs += ms;
+    }
+
+    for (auto &b : bodies) {
+      if (b.invMass <= 0.0f) {
+        continue;
+      }
+      for (int k = 0; k < 3; ++k) {
+        b.position[k] += b.velocity[k] * kDt;
+      }
+    }
+  }
+
+  Result r;
+  r.avgIterations = static_cast<double>(iterationSum) / (steps - measureFrom);
+  r.msPerStep = solveMs / (steps - measureFrom);
+  return r;
+}
+
+} // namespace
+
+int main() {
+  std::printf("%8s %12s %12s %12s %12s\n", "balls", "cold iters", "warm iters",
+              "cold ms", "warm ms");
+  const int counts[] = {10, 100, 1000, 10000};
+  for (int count : counts) {
+    const int steps = (count >= 10000) ? 480 : 960;
+    const Result cold = Run(count, false, steps);
+    const Result warm = Run(count, true, steps);
+    std::printf("%8d %12.2f %12.2f %12.3f %12.3f\n", count, cold.avgIterations,
+                warm.avgIterations, cold.msPerStep, warm.msPerStep);
+  }
+  return 0;
+}
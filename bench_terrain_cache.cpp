@@ -0,0 +1,64 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/TerrainCache.h"
+#include <cstdio>
+#include <filesystem>
+#include <vector>
+
+// ページ読み込み時の地形取得を、キャッシュなし（生成＋保存）と
+// キャッシュあり（メモリマップして展開）で比べる。
+
+using game::systems::TerrainCache;
+using game::systems::TerrainCacheStats;
+using game::systems::TerrainConfig;
+
+int main() {
+  core::ThreadPool &pool = core::ThreadPool::Shared();
+  const std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / "wikigolf_terrain_cache_bench";
+  std::filesystem::remove_all(dir);
+  TerrainCache cache(dir);
+
+  std::printf("threads=%zu (workers + caller), 40 holes\n",
+              pool.GetConcurrency());
+  std::printf("%10s %10s %10s %9s %10s %10s %7s\n", "resolution", "cold ms",
+              "warm ms", "speedup", "raw KB", "file KB", "ratio");
+
+  std::vector<DirectX::XMFLOAT2> holes;
+  for (int i = 0; i < 40; ++i) {
+    holes.push_back({-16.0f + (i % 8) * 4.5f, -24.0f + (i / 8) * 11.0f});
+  }
+
+  // 128 はゲーム内の既定解像度
+  const int resolutions[] = {128, 256, 512, 1024};
+  for (int res : resolutions) {
+    TerrainConfig config;
+    config.resolutionX = res;
+    config.resolutionZ = res;
+    config.worldWidth = 40.0f;
+    config.worldDepth = 60.0f;
+    config.noiseAmplitude = 0.5f;
+
+    TerrainCacheStats cold;
+    cache.GetOrGenerate("Benchmark", holes, config, &pool, &cold);
+
+    const int runs = 5;
+    double warmMs = 0.0;
+    TerrainCacheStats warm;
+    for (int i = 0; i < runs; ++i) {
+      cache.GetOrGenerate("Benchmark", holes, config, &pool, &warm);
+      warmMs += warm.elapsedMs;
+    }
+    warmMs /= runs;
+
+    std::printf("%5dx%-4d %10.2f %10.2f %8.1fx %10zu %10zu %6.1f%%\n", res,
+                res, cold.elapsedMs, warmMs, cold.elapsedMs / warmMs,
+                cold.rawBytes / 1024, cold.fileBytes / 1024,
+                100.0 * cold.fileBytes / cold.rawBytes);
+    if (!warm.hit) {
+      std::printf("  (warm load missed the cache)\n");
+    }
+  }
+
+  std::filesystem::remove_all(dir);
+  return 0;
+}
@@ -0,0 +1,80 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/TerrainChunks.h"
+#include "src/game/systems/TerrainGenerator.h"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// 大きなフィールドで TerrainChunkTree の構築時間と、
+// 地表すれすれのカメラから選ばれる三角形数を単一メッシュと比べる。
+
+using game::systems::TerrainChunkSettings;
+using game::systems::TerrainChunkTree;
+using game::systems::TerrainConfig;
+using game::systems::TerrainData;
+using game::systems::TerrainGenerator;
+using game::systems::TerrainLodQuery;
+using Clock = std::chrono::steady_clock;
+
+static double ElapsedMs(Clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(Clock::now() - start)
+      .count();
+}
+
+int main() {
+  core::ThreadPool &pool = core::ThreadPool::Shared();
+  std::printf("threads=%zu (workers + caller), chunk=32 cells, 1080p 45deg, "
+              "2px\n",
+              pool.GetConcurrency());
+  std::printf("%10s %7s %10s %10s %12s %12s %10s %10s\n", "resolution",
+              "chunks", "serial ms", "pool ms", "full tris", "all-LOD tris",
+              "view tris", "select us");
+
+  std::vector<DirectX::XMFLOAT2> holes;
+  for (int i = 0; i < 40; ++i) {
+    holes.push_back({-16.0f + (i % 8) * 4.5f, -24.0f + (i / 8) * 11.0f});
+  }
+
+  const int resolutions[] = {513, 1025, 2049};
+  for (int res : resolutions) {
+    TerrainConfig config;
+    config.resolutionX = res;
+    config.resolutionZ = res;
+    config.worldWidth = 40.0f;
+    config.worldDepth = 60.0f;
+    config.noiseAmplitude = 0.5f;
+    const TerrainData data =
+        TerrainGenerator::GenerateTerrain("Benchmark", holes, config, &pool);
+
+    TerrainChunkSettings settings;
+    TerrainChunkTree tree;
+    auto start = Clock::now();
+    tree.Build(data, settings, nullptr);
+    const double serialMs = ElapsedMs(start);
+    start = Clock::now();
+    tree.Build(data, settings, &pool);
+    const double poolMs = ElapsedMs(start);
+
+    // ティーショット位置（手前の端）から奥を見る想定
+    TerrainLodQuery query;
+    query.projectionScale =
+        TerrainChunkTree::ComputeProjectionScale(0.785398f, 1080.0f);
+    query.cameraPosition[0] = 0.0f;
+    query.cameraPosition[1] = 3.0f;
+    query.cameraPosition[2] = -28.0f;
+    std::vector<uint32_t> selected;
+    const int runs = 1000;
+    size_t viewTris = 0;
+    start = Clock::now();
+    for (int i = 0; i < runs; ++i) {
+      viewTris = tree.SelectLod(query, selected).triangleCount;
+    }
+    const double selectUs = ElapsedMs(start) * 1000.0 / runs;
+
+    std::printf("%5dx%-4d %7zu %10.2f %10.2f %12zu %12zu %10zu %10.2f\n", res,
+                res, tree.GetChunks().size(), serialMs, poolMs,
+                data.indices.size() / 3, tree.GetTotalTriangleCount(),
+                viewTris, selectUs);
+  }
+  return 0;
+}
@@ -0,0 +1,55 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/TerrainGenerator.h"
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// TerrainGenerator::GenerateTerrain を解像度ごとに単一スレッド／共有プールで
+// 計測する。WikiTerrainSystem と同じ程度のホール数を置く。
+
+using game::systems::TerrainConfig;
+using game::systems::TerrainGenerator;
+using Clock = std::chrono::steady_clock;
+
+static double GenerateMs(const TerrainConfig &config,
+                         const std::vector<DirectX::XMFLOAT2> &holes,
+                         core::ThreadPool *pool, int runs) {
+  auto start = Clock::now();
+  size_t sink = 0;
+  for (int i = 0; i < runs; ++i) {
+    sink += TerrainGenerator::GenerateTerrain("Benchmark", holes, config, pool)
+                .vertices.size();
+  }
+  const double ms =
+      std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+  return (sink > 0) ? ms / runs : 0.0;
+}
+
+int main() {
+  core::ThreadPool &pool = core::ThreadPool::Shared();
+  std::printf("threads=%zu (workers + caller)\n", pool.GetConcurrency());
+  std::printf("%10s %12s %12s %10s\n", "resolution", "serial ms", "pool ms",
+              "speedup");
+
+  // 記事リンク数 40 本相当のホールを格子状に散らす
+  std::vector<DirectX::XMFLOAT2> holes;
+  for (int i = 0; i < 40; ++i) {
+    holes.push_back({-16.0f + (i % 8) * 4.5f, -24.0f + (i / 8) * 11.0f});
+  }
+
+  const int resolutions[] = {128, 512, 2048};
+  for (int res : resolutions) {
+    TerrainConfig config;
+    config.resolutionX = res;
+    config.resolutionZ = res;
+    config.worldWidth = 40.0f;
+    config.worldDepth = 60.0f;
+
+    const int runs = (res <= 128) ? 20 : (res <= 512 ? 5 : 1);
+    const double serial = GenerateMs(config, holes, nullptr, runs);
+    const double parallel = GenerateMs(config, holes, &pool, runs);
+    std::printf("%5dx%-4d %12.2f %12.2f %9.2fx\n", res, res, serial, parallel,
+                serial / parallel);
+  }
+  return 0;
+}
@@ -0,0 +1,154 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/TerrainGenerator.h"
+#include "src/game/systems/TerrainHeightPyramid.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// 斜めに地面へ向かうレイを、ピラミッドのキャストと
+// 固定刻みの高さサンプリング（1/4セルごと）で比べる。
+
+using game::systems::TerrainConfig;
+using game::systems::TerrainData;
+using game::systems::TerrainGenerator;
+using game::systems::TerrainHeightPyramid;
+using game::systems::TerrainRayHit;
+
+namespace {
+
+struct Ray {
+  DirectX::XMFLOAT3 origin;
+  DirectX::XMFLOAT3 direction; ///< 単位ベクトル
+};
+
+/// @brief 頂点の高さを双線形補間する（従来の GetHeight 相当）
+float SampleHeight(const TerrainHeightPyramid &pyramid,
+                   const TerrainConfig &config, float px, float pz) {
+  const float u = px / config.worldWidth + 0.5f;
+  const float v = 0.5f - pz / config.worldDepth;
+  const float fx = std::clamp(u, 0.0f, 1.0f) * (config.resolutionX - 1);
+  const float fz = std::clamp(v, 0.0f, 1.0f) * (config.resolutionZ - 1);
+  const int x0 = std::min(static_cast<int>(fx), config.resolutionX - 2);
+  const int z0 = std::min(static_cast<int>(fz), config.resolutionZ - 2);
+  const float tx = fx - x0;
+  const float tz = fz - z0;
+  const float h0 = pyramid.GetVertexHeight(x0, z0) * (1.0f - tx) +
+                   pyramid.GetVertexHeight(x0 + 1, z0) * tx;
+  const float h1 = pyramid.GetVertexHeight(x0, z0 + 1) * (1.0f - tx) +
+                   pyramid.GetVertexHeight(x0 + 1, z0 + 1) * tx;
+  return h0 * (1.0f - tz) + h1 * tz;
+}
+
+/// @brief 固定刻みで進め、地面より下になった最初の距離を返す
+bool March(const TerrainHeightPyramid &pyramid, const TerrainConfig &config,
+           const Ray &ray, float maxDistance, float step, float &outDist) {
+  for (float t = 0.0f; t <= maxDistance; t += step) {
+    const float px = ray.origin.x + ray.direction.x * t;
+    const float py = ray.origin.y + ray.direction.y * t;
+    const float pz = ray.origin.z + ray.direction.z * t;
+    if (std::fabs(px) > config.worldWidth * 0.5f ||
+        std::fabs(pz) > config.worldDepth * 0.5f) {
+      return false; // 地形の外へ出た
+    }
+    if (py <= SampleHeight(pyramid, config, px, pz)) {
+      outDist = t;
+      return true;
+    }
+  }
+  return false;
+}
+
+template <typename Fn> double MeasureMs(Fn &&fn) {
+  const auto start = std::chrono::steady_clock::now();
+  fn();
+  const auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
+int main() {
+  core::ThreadPool &pool = core::ThreadPool::Shared();
+  std::printf("%10s %8s %12s %12s %12s %9s %10s\n", "resolution", "levels",
+              "ray/s", "sphere/s", "march/s", "speedup", "hit match");
+
+  const int resolutions[] = {128, 512, 1024};
+  for (int res : resolutions) {
+    TerrainConfig config;
+    config.resolutionX = res;
+    config.resolutionZ = res;
+    config.worldWidth = 40.0f;
+    config.worldDepth = 60.0f;
+    config.noiseAmplitude = 0.5f;
+    const TerrainData data =
+        TerrainGenerator::GenerateTerrain("Benchmark", {}, config, &pool);
+
+    TerrainHeightPyramid pyramid;
+    pyramid.Build(data, &pool);
+
+    // 地形の上空から斜め下へ向かうレイ
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+    std::vector<Ray> rays(20000);
+    for (Ray &ray : rays) {
+      ray.origin = {unit(rng) * 18.0f, 6.0f + unit(rng) * 2.0f,
+                    unit(rng) * 28.0f};
+      const float dx = unit(rng);
+      const float dz = unit(rng);
+      const float dy = -0.15f - 0.35f * (unit(rng) * 0.5f + 0.5f);
+      const float len = std::sqrt(dx * dx + dy * dy + dz * dz);
+      ray.direction = {dx / len, dy / len, dz / len};
+    }
+    const float maxDistance = 80.0f;
+    const float step = 0.25f * config.worldWidth / (res - 1);
+
+    int rayHits = 0;
+    std::vector<float> rayDist(rays.size(), -1.0f);
+    const double rayMs = MeasureMs([&] {
+      for (size_t i = 0; i < rays.size(); ++i) {
+        TerrainRayHit hit;
+        if (pyramid.Raycast(rays[i].origin, rays[i].direction, maxDistance,
+                            hit)) {
+          rayDist[i] = hit.distance;
+          ++rayHits;
+        }
+      }
+    });
+
+    const double sphereMs = MeasureMs([&] {
+      for (const Ray &ray : rays) {
+        TerrainRayHit hit;
+        pyramid.SphereCast(ray.origin, ray.direction, 0.3f, maxDistance, hit);
+      }
+    });
+
+    // マーチングは遅いので一部のレイだけで測る
+    const size_t marchCount = std::min<size_t>(rays.size(), 2000);
+    int agree = 0;
+    const double marchMs = MeasureMs([&] {
+      for (size_t i = 0; i < marchCount; ++i) {
+        float dist = 0.0f;
+        const bool hit =
+            March(pyramid, config, rays[i], maxDistance, step, dist);
+        if (hit == (rayDist[i] >= 0.0f) &&
+            (!hit || std::fabs(dist - rayDist[i]) <= step * 4.0f)) {
+          ++agree;
+        }
+      }
+    });
+
+    const double rayRate = rays.size() / (rayMs / 1000.0);
+    const double marchRate = marchCount / (marchMs / 1000.0);
+    std::printf("%5dx%-4d %8d %12.0f %12.0f %12.0f %8.1fx %9.1f%%\n", res, res,
+                pyramid.GetLevelCount(), rayRate,
+                rays.size() / (sphereMs / 1000.0), marchRate,
+                rayRate / marchRate, 100.0 * agree / marchCount);
+    if (rayHits == 0) {
+      std::printf("  (no ray hit the terrain)\n");
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,145 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/TerrainGenerator.h"
+#include "src/game/systems/TerrainSampler.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+// 1〜100k 点の高さ・法線・マテリアルの標本化を、バッチ API と
+// 旧実装相当（1点ずつ、高さは双線形・法線は頂点法線の補間）で比べる。
+
+using DirectX::XMFLOAT3;
+using game::systems::TerrainConfig;
+using game::systems::TerrainData;
+using game::systems::TerrainGenerator;
+using game::systems::TerrainSampler;
+using game::systems::TerrainSamples;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+/// @brief 旧 PhysicsSystem の GetTerrainHeightAndNormal と同じ処理
+bool LegacySample(const TerrainData &terrain, float x, float z, float &outH,
+                  XMFLOAT3 &outN, uint8_t &outMat) {
+  const int resX = terrain.config.resolutionX;
+  const int resZ = terrain.config.resolutionZ;
+  const float u = x / terrain.config.worldWidth + 0.5f;
+  const float v = 0.5f - z / terrain.config.worldDepth;
+  if (u < 0.0f || u >= 1.0f || v < 0.0f || v >= 1.0f) {
+    outH = 0.0f;
+    outN = {0, 1, 0};
+    outMat = 0;
+    return false;
+  }
+  const float fx = u * (resX - 1);
+  const float fz = v * (resZ - 1);
+  const int ix = std::clamp(static_cast<int>(fx), 0, resX - 2);
+  const int iz = std::clamp(static_cast<int>(fz), 0, resZ - 2);
+  const float dx = fx - ix;
+  const float dz = fz - iz;
+  const size_t i00 = static_cast<size_t>(iz) * resX + ix;
+  const size_t i10 = i00 + 1, i01 = i00 + resX, i11 = i01 + 1;
+  const float *h = terrain.heightMap.data();
+  const float h0 = h[i00] * (1.0f - dx) + h[i10] * dx;
+  const float h1 = h[i01] * (1.0f - dx) + h[i11] * dx;
+  outH = h0 * (1.0f - dz) + h1 * dz;
+
+  const XMFLOAT3 *n = terrain.normals.data();
+  auto lerp = [](const XMFLOAT3 &a, const XMFLOAT3 &b, float t) {
+    return XMFLOAT3{a.x + (b.x - a.x) * t, a.y + (b.y - a.y) * t,
+                    a.z + (b.z - a.z) * t};
+  };
+  const XMFLOAT3 n0 = lerp(n[i00], n[i10], dx);
+  const XMFLOAT3 n1 = lerp(n[i01], n[i11], dx);
+  const XMFLOAT3 nn = lerp(n0, n1, dz);
+  const float len = std::sqrt(nn.x * nn.x + nn.y * nn.y + nn.z * nn.z);
+  outN = {nn.x / len, nn.y / len, nn.z / len};
+  outMat = terrain.materialMap[static_cast<size_t>(fz) * resX +
+                               static_cast<size_t>(fx)];
+  return true;
+}
+
+/// @brief 合計 total 点分になるまで fn を繰り返し、1点あたりの ns を返す
+template <typename Fn> double NsPerPoint(size_t count, Fn &&fn) {
+  const size_t total = 4000000;
+  const size_t reps = std::max<size_t>(1, total / count);
+  fn(); // ウォームアップ
+  const auto start = Clock::now();
+  for (size_t r = 0; r < reps; ++r) {
+    fn();
+  }
+  const auto end = Clock::now();
+  return std::chrono::duration<double, std::nano>(end - start).count() /
+         (static_cast<double>(reps) * count);
+}
+
+} // namespace
+
+int main() {
+  TerrainConfig config;
+  config.resolutionX = 128;
+  config.resolutionZ = 128;
+  config.worldWidth = 40.0f;
+  config.worldDepth = 60.0f;
+  config.noiseAmplitude = 0.5f;
+  const TerrainData data = TerrainGenerator::GenerateTerrain(
+      "Benchmark", {}, config, &core::ThreadPool::Shared());
+
+  TerrainSampler sampler;
+  sampler.Build(data);
+
+  const size_t maxCount = 100000;
+  std::mt19937 rng(1234);
+  std::uniform_real_distribution<float> distX(-19.9f, 19.9f);
+  std::uniform_real_distribution<float> distZ(-29.9f, 29.9f);
+  std::vector<float> xs(maxCount), zs(maxCount);
+  for (size_t i = 0; i < maxCount; ++i) {
+    xs[i] = distX(rng);
+    zs[i] = distZ(rng);
+  }
+  std::vector<float> height(maxCount), nx(maxCount), ny(maxCount),
+      nz(maxCount);
+  std::vector<uint8_t> material(maxCount);
+  TerrainSamples out;
+  out.height = height.data();
+  out.normalX = nx.data();
+  out.normalY = ny.data();
+  out.normalZ = nz.data();
+  out.material = material.data();
+
+  std::printf("terrain %dx%d, height + normal + material per point\n",
+              config.resolutionX, config.resolutionZ);
+  std::printf("%8s %12s %12s %12s %9s %12s\n", "points", "legacy ns",
+              "single ns", "batch ns", "speedup", "batch Mpt/s");
+
+  volatile float sink = 0.0f;
+  const size_t counts[] = {1, 10, 100, 1000, 10000, 100000};
+  for (size_t count : counts) {
+    const double legacyNs = NsPerPoint(count, [&] {
+      for (size_t i = 0; i < count; ++i) {
+        XMFLOAT3 n;
+        LegacySample(data, xs[i], zs[i], height[i], n, material[i]);
+        nx[i] = n.x;
+      }
+      sink = sink + height[count - 1];
+    });
+    const double singleNs = NsPerPoint(count, [&] {
+      for (size_t i = 0; i < count; ++i) {
+        XMFLOAT3 n;
+        sampler.SamplePoint(xs[i], zs[i], height[i], n, material[i]);
+        nx[i] = n.x;
+      }
+      sink = sink + height[count - 1];
+    });
+    const double batchNs = NsPerPoint(count, [&] {
+      sampler.Sample(xs.data(), zs.data(), count, out);
+      sink = sink + height[count - 1];
+    });
+    std::printf("%8zu %12.2f %12.2f %12.2f %8.1fx %12.1f\n", count, legacyNs,
+                singleNs, batchNs, legacyNs / batchNs, 1000.0 / batchNs);
+  }
+  return 0;
+}
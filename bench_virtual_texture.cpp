@@ -0,0 +1,79 @@
+#include "src/graphics/VirtualTextureCache.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+
+// 長い記事をカメラが先頭から末尾まで流し見るときの、記事テクスチャの
+// 常駐メモリと最初のフレームまでにラスタライズする画素数を、
+// 全体を1枚で描く従来方式と比べる。
+// ラスタライズ（DirectWrite）の時間は描く画素数にほぼ比例するので、
+// 画素数の比を初回フレームまでの時間の目安にする。
+
+using graphics::VirtualTextureCache;
+using graphics::VirtualTextureConfig;
+
+int main() {
+  std::printf("%11s %9s %9s %8s %12s %12s %8s %7s %9s %8s\n", "article",
+              "full MB", "peak MB", "ratio", "full Mpx", "first Mpx", "ratio",
+              "frames", "uploads", "us/frm");
+
+  // 幅 3000 のフィールドに、記事の長さだけを変える（32768 は LoadPage の上限）
+  const uint32_t heights[] = {4096, 8192, 16384, 32768};
+  for (uint32_t height : heights) {
+    VirtualTextureConfig config;
+    config.width = 3000;
+    config.height = height;
+    VirtualTextureCache cache(config);
+
+    // 画面に映るのは記事の 3000 x 2400 程度。手前ほど優先する
+    // 4 段に分けて要求する（地形チャンクごとの要求を真似る）
+    const float viewV = 2400.0f / height;
+    const int frames = 600;
+    size_t firstFrameUploads = 0;
+    int framesToResident = -1;
+    uint64_t peakBytes = 0;
+    double totalUs = 0.0;
+
+    for (int frame = 0; frame < frames; ++frame) {
+      const float top =
+          (1.0f - viewV) * static_cast<float>(frame) / (frames - 1);
+      const auto start = std::chrono::steady_clock::now();
+      cache.BeginFrame();
+      for (int band = 0; band < 4; ++band) {
+        const float v0 = top + viewV * band / 4.0f;
+        cache.RequestRegion(0.0f, v0, 1.0f, v0 + viewV / 4.0f,
+                            static_cast<float>(band));
+      }
+      const auto &uploads = cache.EndFrame();
+      totalUs += std::chrono::duration<double, std::micro>(
+                     std::chrono::steady_clock::now() - start)
+                     .count();
+
+      if (frame == 0) {
+        firstFrameUploads = uploads.size();
+      }
+      if (framesToResident < 0 && cache.GetStats().missingTiles == 0) {
+        framesToResident = frame + 1;
+      }
+      peakBytes = std::max(peakBytes, cache.GetStats().TotalBytes());
+    }
+
+    const auto &stats = cache.GetStats();
+    const uint64_t fullBytes = cache.GetFullTextureBytes();
+    const uint64_t fullPixels = static_cast<uint64_t>(config.width) * height;
+    const uint64_t slot = cache.GetSlotSize();
+    const uint64_t firstPixels =
+        static_cast<uint64_t>(cache.GetFallbackWidth()) *
+            cache.GetFallbackHeight() +
+        firstFrameUploads * slot * slot;
+
+    std::printf("%5ux%-5u %9.1f %9.1f %7.1f%% %12.2f %12.2f %7.1f%% %7d "
+                "%9zu %8.2f\n",
+                config.width, height, fullBytes / 1048576.0,
+                peakBytes / 1048576.0, 100.0 * peakBytes / fullBytes,
+                fullPixels / 1e6, firstPixels / 1e6,
+                100.0 * firstPixels / fullPixels, framesToResident,
+                stats.totalUploads, totalUs / frames);
+  }
+  return 0;
+}
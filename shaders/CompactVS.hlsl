@@ -0,0 +1,61 @@
+/**
+ * @file CompactVS.hlsl
+ * @brief 量子化した頂点（graphics::CompactVertex, 24 バイト）用の頂点シェーダー
+ * @details 出力は BasicVS と同じなので BasicPS と組み合わせる。
+ *          正規化した位置の戻しは World に含まれる（Mesh::GetPositionTransform）。
+ */
+
+cbuffer ConstantBuffer : register(b0) {
+    matrix World;
+    matrix View;
+    matrix Projection;
+    float4 MaterialColor;
+    float4 MaterialFlags; // x: hasDiffuse, y: hasNormalMap
+};
+
+struct VS_INPUT {
+    float4 position : POSITION; // xyz: 正規化した位置、w: 接線の向き（±1）
+    float2 normal : NORMAL;     // 八面体写像
+    float2 tangent : TANGENT;   // 八面体写像
+    float2 texCoord : TEXCOORD;
+    float4 color : COLOR;
+};
+
+struct VS_OUTPUT {
+    float4 position : SV_POSITION;
+    float3 normal : NORMAL;
+    float2 texCoord : TEXCOORD;
+    float4 color : COLOR;
+    float3 tangent : TANGENT;
+    float3 bitangent : BINORMAL;
+};
+
+// CompactVertex.cpp の DecodeOctahedral と同じ計算
+float3 DecodeOctahedral(float2 e) {
+    float3 n = float3(e, 1.0f - abs(e.x) - abs(e.y));
+    float t = saturate(-n.z);
+    n.xy += (n.xy >= 0.0f) ? -t : t;
+    return normalize(n);
+}
+
+VS_OUTPUT main(VS_INPUT input) {
+    VS_OUTPUT output;
+
+    float4 worldPos = mul(float4(input.position.xyz, 1.0f), World);
+    float4 viewPos = mul(worldPos, View);
+    output.position = mul(viewPos, Projection);
+
+    float3 normal = DecodeOctahedral(input.normal);
+    float3 tangent = DecodeOctahedral(input.tangent);
+    float handedness = input.position.w < 0.0f ? -1.0f : 1.0f;
+    float3 bitangent = normalize(cross(normal, tangent)) * handedness;
+
+    float3x3 world3x3 = (float3x3)World;
+    output.normal = mul(normal, world3x3);
+    output.tangent = mul(tangent, world3x3);
+    output.bitangent = mul(bitangent, world3x3);
+    output.texCoord = input.texCoord;
+    output.color = input.color * MaterialColor;
+
+    return output;
+}
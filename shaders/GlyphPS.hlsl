@@ -0,0 +1,47 @@
+struct PS_INPUT {
+    float4 Pos : SV_POSITION;
+    float3 WorldPos : POSITION;
+    float2 Tex : TEXCOORD0;
+    float4 Color : COLOR0;
+    nointerpolation uint Flags : TEXCOORD1;
+};
+
+cbuffer ConstantBuffer : register(b0) {
+    matrix ViewProjection;
+    float4 LightDir;
+    float4 CameraPos;
+    float4 Field;
+    float4 HeightGrid;
+};
+
+Texture2D<float> g_Atlas : register(t0); // 0.5 が輪郭の距離場
+SamplerState g_Sampler : register(s0);
+
+float4 main(PS_INPUT input) : SV_TARGET {
+    // 1. 距離場から被覆率。画面上 1px 分の幅でぼかす（拡大しても縁が鋭い）
+    //    微分は分岐の外で取る
+    float d = g_Atlas.Sample(g_Sampler, input.Tex);
+    float w = max(fwidth(d), 1e-4f);
+    float alpha = smoothstep(0.5f - w, 0.5f + w, d);
+    if (input.Flags & 1) {
+        alpha = 1.0f; // ボタン・罫線
+    }
+    alpha *= input.Color.a;
+    clip(alpha - 1.0f / 255.0f);
+
+    // 2. ライティング（床の法線は上向きとみなす。TerrainPS と同じ光）
+    float3 N = float3(0.0f, 1.0f, 0.0f);
+    float3 L = normalize(-LightDir.xyz);
+    float diff = max(dot(N, L), 0.0f);
+    float3 ambient = float3(0.4f, 0.4f, 0.5f);
+    float3 lightColor = float3(1.0f, 0.95f, 0.9f);
+    float3 color = input.Color.rgb * (ambient + lightColor * diff);
+
+    // 3. フォグ（TerrainPS と同じ）
+    float dist = distance(CameraPos.xyz, input.WorldPos);
+    float fogFactor = saturate((dist - 20.0f) / (120.0f - 20.0f));
+    float3 fogColor = float3(0.7f, 0.85f, 1.0f);
+    color = lerp(color, fogColor, fogFactor);
+
+    return float4(color, alpha);
+}
@@ -0,0 +1,72 @@
+// 記事の文字（SDF グリフ）。1文字1インスタンスで、床の高さに沿わせて置く
+
+cbuffer ConstantBuffer : register(b0) {
+    matrix ViewProjection;
+    float4 LightDir;
+    float4 CameraPos;
+    float4 Field;      // x, y: ワールド幅・奥行き, z, w: 記事のピクセル寸法
+    float4 HeightGrid; // x, y: 高さの解像度, z: 浮かせる量, w: 距離あたり
+};
+
+struct GlyphInstance {
+    float4 Rect;  // x, y, 幅, 高さ（記事のピクセル）
+    float4 Uv;    // u0, v0, u1, v1（アトラス）
+    uint Color;   // RGBA8（R が最下位バイト）
+    uint Flags;   // 1: 塗りつぶし
+    float2 Pad;
+};
+
+StructuredBuffer<GlyphInstance> g_Instances : register(t0);
+Texture2D<float> g_Height : register(t1);
+SamplerState g_Sampler : register(s0);
+
+struct VS_INPUT {
+    float3 Pos : POSITION; // 0..1 の四角形
+    float3 Normal : NORMAL;
+    float2 Tex : TEXCOORD0;
+    float4 Color : COLOR0;
+    float3 Tangent : TANGENT;
+    float3 Bitangent : BINORMAL;
+    uint InstanceId : SV_InstanceID;
+};
+
+struct PS_INPUT {
+    float4 Pos : SV_POSITION;
+    float3 WorldPos : POSITION;
+    float2 Tex : TEXCOORD0;
+    float4 Color : COLOR0;
+    nointerpolation uint Flags : TEXCOORD1;
+};
+
+float4 UnpackColor(uint c) {
+    return float4(c & 0xFF, (c >> 8) & 0xFF, (c >> 16) & 0xFF, c >> 24) /
+           255.0f;
+}
+
+PS_INPUT main(VS_INPUT input) {
+    PS_INPUT output = (PS_INPUT)0;
+    GlyphInstance g = g_Instances[input.InstanceId];
+
+    // 記事のピクセル → 記事全体の UV → 床のワールド座標
+    float2 pixel = g.Rect.xy + input.Pos.xy * g.Rect.zw;
+    float2 uv = saturate(pixel / Field.zw);
+    float3 world;
+    world.x = (uv.x - 0.5f) * Field.x;
+    world.z = (0.5f - uv.y) * Field.y;
+
+    // 頂点 (x, z) の高さは texel (x, z) の中心にある
+    float2 res = HeightGrid.xy;
+    float2 heightUv = (uv * (res - 1.0f) + 0.5f) / res;
+    world.y = g_Height.SampleLevel(g_Sampler, heightUv, 0);
+
+    // 床との深度の奪い合いを避けて少し浮かせる
+    float dist = distance(CameraPos.xyz, world);
+    world.y += HeightGrid.z + HeightGrid.w * dist;
+
+    output.WorldPos = world;
+    output.Pos = mul(float4(world, 1.0f), ViewProjection);
+    output.Tex = lerp(g.Uv.xy, g.Uv.zw, input.Pos.xy);
+    output.Color = UnpackColor(g.Color);
+    output.Flags = g.Flags;
+    return output;
+}
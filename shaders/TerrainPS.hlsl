@@ -14,11 +14,30 @@ cbuffer ConstantBuffer : register(b0) {
     float4 MaterialFlags; // x: hasTexture, y: hasNormalMap (unused here)
     float4 LightDir;
     float4 CameraPos;
+    float4 VirtualTexture; // x, y: 大きさ（タイル単位）, z: 有効なら 1
 };
 
-Texture2D g_Texture : register(t0);
+Texture2D g_Texture : register(t0);           // 仮想テクスチャ時は低解像度版
+Texture2D g_VirtualAtlas : register(t2);      // 常駐タイル
+Texture2D<float4> g_PageTable : register(t3); // タイル → アトラス上の位置
 SamplerState g_Sampler : register(s0);
 
+// 仮想テクスチャを引く。タイルが常駐していなければ低解像度版
+float4 SampleVirtual(float2 uv) {
+    float2 tileCoord = uv * VirtualTexture.xy;
+    int2 tiles = int2(ceil(VirtualTexture.xy));
+    int2 tile = clamp(int2(floor(tileCoord)), int2(0, 0), tiles - 1);
+    float4 entry = g_PageTable.Load(int3(tile, 0));
+    if (entry.z > 0.0f) {
+        // タイル内の位置。タイルの境目で微分が飛ぶので LOD 0 を直接引く
+        float2 local = saturate(tileCoord - tile);
+        return g_VirtualAtlas.SampleLevel(g_Sampler,
+                                          entry.xy + local * entry.zw, 0);
+    }
+    // 低解像度版もミップを持たない
+    return g_Texture.SampleLevel(g_Sampler, uv, 0);
+}
+
 float4 main(PS_INPUT input) : SV_TARGET {
     // 1. ベースカラー (頂点カラー * テクスチャ)
     float4 baseColor = input.Color;
@@ -26,7 +45,12 @@ float4 main(PS_INPUT input) : SV_TARGET {
     // テクスチャサンプリング
     // ※テクスチャがバインドされていない場合の挙動は不定だが、
     //   白テクスチャ扱いになることを期待するか、アプリケーション側で保証する。
-    float4 texColor = g_Texture.Sample(g_Sampler, input.Tex);
+    float4 texColor;
+    if (VirtualTexture.z > 0.0f) {
+        texColor = SampleVirtual(input.Tex);
+    } else {
+        texColor = g_Texture.Sample(g_Sampler, input.Tex);
+    }
     
     baseColor *= texColor;
 
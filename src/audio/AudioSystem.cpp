@@ -159,14 +159,39 @@ void AudioSystem::PlayBGM(core::GameContext &ctx, const std::string &name,
     return; // 同じBGMなら何もしない
   }
 
+  std::string path = FindAudioPath(name);
+  resources::ResourceManager &resource = ctx.resource;
+  if (m_pendingBgmName == name && resource.GetPendingLoad(path) != 0) {
+    return; // 同じBGMの展開待ち
+  }
+
   StopBGM();
 
-  std::string path = FindAudioPath(name);
-  auto handle = ctx.resource.LoadAudio(path);
-  auto *clip = ctx.resource.GetAudio(handle);
+  auto handle = resource.LoadAudioAsync(path);
+  if (resource.GetPendingLoad(path) == 0) {
+    StartBGM(name, resource.GetAudio(handle), volume);
+    return;
+  }
+
+  // MP3 の展開を待つ間はシーンを止めず、終わったフレームから鳴らす
+  m_pendingBgmName = name;
+  resource.LoadAudioAsync(path, [this, &resource, name, handle,
+                                 volume](bool) {
+    if (m_pendingBgmName != name) {
+      return; // 待つ間に別の曲へ切り替わったか停止された
+    }
+    m_pendingBgmName.clear();
+    StartBGM(name, resource.GetAudio(handle), volume);
+  });
+}
+
+void AudioSystem::StartBGM(const std::string &name,
+                           const audio::AudioClip *clip, float volume) {
+  if (!m_xaudio2)
+    return;
 
   if (!clip || clip->buffer.empty()) {
-    LOG_WARN("Audio", "BGM not found: {} (searched as {})", name, path);
+    LOG_WARN("Audio", "BGM not found: {}", name);
     return;
   }
 
@@ -205,6 +230,7 @@ void AudioSystem::StopBGM() {
     m_bgmVoice = nullptr;
   }
   m_currentBgmName.clear();
+  m_pendingBgmName.clear();
 }
 
 void AudioSystem::SetMasterVolume(float volume) {
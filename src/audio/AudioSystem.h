@@ -15,6 +15,9 @@
 namespace core {
 struct GameContext;
 }
+namespace audio {
+struct AudioClip;
+}
 
 namespace game::systems {
 
@@ -51,6 +54,7 @@ public:
               float volume = 1.0f, float pitch = 0.0f);
 
   /// @brief BGMを再生（ループ）
+  /// @details 初回は展開をワーカーで行い、終わったフレームから鳴らす
   /// @param name ファイル名
   void PlayBGM(core::GameContext &ctx, const std::string &name,
                float volume = 0.6f);
@@ -62,6 +66,10 @@ public:
   void SetMasterVolume(float volume);
 
 private:
+  /// @brief 展開済みのクリップで BGM のボイスを作って鳴らす
+  void StartBGM(const std::string &name, const audio::AudioClip *clip,
+                float volume);
+
   Microsoft::WRL::ComPtr<IXAudio2> m_xaudio2;
   IXAudio2MasteringVoice *m_masterVoice = nullptr;
 
@@ -77,6 +85,7 @@ private:
   // BGM用
   IXAudio2SourceVoice *m_bgmVoice = nullptr;
   std::string m_currentBgmName;
+  std::string m_pendingBgmName; ///< 展開を待っている BGM
   VoiceCallback m_bgmCallback; // ループするのでEndは来ないが
 };
 
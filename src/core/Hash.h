@@ -0,0 +1,33 @@
+#pragma once
+/**
+ * @file Hash.h
+ * @brief キャッシュのキーやチェックサムに使うバイト列ハッシュ
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace core {
+
+/// @brief 8 バイト単位で混ぜる 64bit ハッシュ（FNV-1a の語単位版）
+inline uint64_t HashBytes(const uint8_t *data, size_t size, uint64_t seed) {
+  constexpr uint64_t kPrime = 0x100000001b3ull;
+  uint64_t h = seed ^ (size * 0x9e3779b97f4a7c15ull);
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, data + i, sizeof(word));
+    h = (h ^ word) * kPrime;
+    h ^= h >> 29;
+  }
+  for (; i < size; ++i) {
+    h = (h ^ data[i]) * kPrime;
+  }
+  h ^= h >> 32;
+  h *= 0xd6e8feb86659fd93ull;
+  h ^= h >> 32;
+  return h;
+}
+
+} // namespace core
@@ -0,0 +1,90 @@
+/**
+ * @file IncrementalJob.cpp
+ * @brief 時間予算つきジョブの実行
+ */
+
+#include "IncrementalJob.h"
+#include <algorithm>
+#include <chrono>
+
+namespace core {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double ElapsedMs(Clock::time_point start, Clock::time_point end) {
+  return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+} // namespace
+
+JobSliceStats IncrementalJob::RunFor(double budgetMs) {
+  JobSliceStats stats;
+  const Clock::time_point start = Clock::now();
+  Clock::time_point now = start;
+  while (!m_finished && !IsCancelled()) {
+    const double projectedMs = ElapsedMs(start, now) + m_stepEstimateMs;
+    if (stats.steps > 0 && projectedMs > budgetMs) {
+      break;
+    }
+    const Clock::time_point stepStart = now;
+    m_finished = !Step();
+    now = Clock::now();
+    ++stats.steps;
+
+    // 重くなったらすぐ追従し、軽くなったらゆっくり下げる
+    const double stepMs = ElapsedMs(stepStart, now);
+    m_stepEstimateMs = stepMs > m_stepEstimateMs
+                           ? stepMs
+                           : m_stepEstimateMs * 0.75 + stepMs * 0.25;
+  }
+  stats.elapsedMs = ElapsedMs(start, now);
+  stats.finished = m_finished;
+  return stats;
+}
+
+void IncrementalJob::RunToCompletion() {
+  while (!m_finished && !IsCancelled()) {
+    m_finished = !Step();
+  }
+}
+
+void FrameBudgetRunner::Add(std::shared_ptr<IncrementalJob> job) {
+  if (job) {
+    m_jobs.push_back(std::move(job));
+  }
+}
+
+double FrameBudgetRunner::Tick(double budgetMs) {
+  if (m_jobs.empty()) {
+    return 0.0;
+  }
+  const Clock::time_point start = Clock::now();
+  for (size_t i = 0; i < m_jobs.size(); ++i) {
+    IncrementalJob &job = *m_jobs[i];
+    const double remaining = budgetMs - ElapsedMs(start, Clock::now());
+    // 最低1 Step を保証するのは先頭のジョブだけ（後ろは収まるときだけ）
+    if (i > 0 && (remaining <= 0.0 || job.GetStepEstimateMs() > remaining)) {
+      break;
+    }
+    if (!job.IsCancelled()) {
+      job.RunFor(remaining);
+    }
+  }
+  m_jobs.erase(std::remove_if(m_jobs.begin(), m_jobs.end(),
+                              [](const std::shared_ptr<IncrementalJob> &job) {
+                                return job->IsFinished() ||
+                                       job->IsCancelled();
+                              }),
+               m_jobs.end());
+
+  const double elapsed = ElapsedMs(start, Clock::now());
+  ++m_stats.frames;
+  m_stats.lastMs = elapsed;
+  m_stats.worstMs = std::max(m_stats.worstMs, elapsed);
+  m_stats.totalMs += elapsed;
+  return elapsed;
+}
+
+} // namespace core
@@ -0,0 +1,105 @@
+#pragma once
+/**
+ * @file IncrementalJob.h
+ * @brief フレームごとの時間予算で少しずつ進める中断可能な処理
+ */
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace core {
+
+/// @brief RunFor 1回分の結果
+struct JobSliceStats {
+  uint32_t steps = 0;      ///< 実行した Step の回数
+  double elapsedMs = 0.0;  ///< 呼び出しスレッドで使った時間
+  bool finished = false;   ///< 全ての作業が終わった
+};
+
+/**
+ * @brief 生成処理を小さな Step に分けて、フレームをまたいで進めるジョブ
+ * @details 派生クラスは Step で数 ms 以下の作業を1単位だけ進め、
+ *          残りがあれば true を返す。途中の状態はメンバに持つ。
+ *          粗い結果から先に作る場合は GetQuality を段階ごとに上げ、
+ *          呼び出し側はその時点で最良の結果を表示に使える。
+ *          RunFor は直近の Step の所要時間から次の Step が予算に収まるかを
+ *          見積もり、収まらなければそのフレームは打ち切る
+ *          （ただし進行を保証するため、1回の呼び出しで最低1 Step は進める）。
+ *          Cancel はどのスレッドから呼んでもよく、次の Step の前に止まる。
+ */
+class IncrementalJob {
+public:
+  virtual ~IncrementalJob() = default;
+
+  /// @brief 予算 budgetMs の範囲で Step を繰り返す
+  JobSliceStats RunFor(double budgetMs);
+
+  /// @brief 予算を気にせず最後まで進める（取り消されたら止まる）
+  void RunToCompletion();
+
+  /// @brief 取り消しを要求する
+  void Cancel() { m_cancelled.store(true, std::memory_order_relaxed); }
+  bool IsCancelled() const {
+    return m_cancelled.load(std::memory_order_relaxed);
+  }
+
+  bool IsFinished() const { return m_finished; }
+
+  /// @brief 次の Step にかかる時間の見積もり（未実行なら 0）
+  double GetStepEstimateMs() const { return m_stepEstimateMs; }
+
+  /// @brief 進捗（0〜1）
+  virtual float GetProgress() const = 0;
+
+  /// @brief 今使える結果の品質段階（0 なら未だない。大きいほど良い）
+  virtual int GetQuality() const = 0;
+
+  /// @brief 最終結果の品質段階
+  virtual int GetMaxQuality() const = 0;
+
+protected:
+  /// @brief 作業を1単位だけ進める
+  /// @return まだ残りがあれば true
+  virtual bool Step() = 0;
+
+private:
+  std::atomic<bool> m_cancelled{false};
+  bool m_finished = false;
+  double m_stepEstimateMs = 0.0; ///< 次の Step にかかる時間の見積もり
+};
+
+/// @brief FrameBudgetRunner の集計
+struct FrameBudgetStats {
+  uint64_t frames = 0;   ///< 作業をした Tick の回数
+  double lastMs = 0.0;   ///< 直前の Tick で使った時間
+  double worstMs = 0.0;  ///< 1回の Tick で使った最大の時間
+  double totalMs = 0.0;
+};
+
+/**
+ * @brief 複数のジョブを1フレームの予算で順に進める
+ * @details 登録順に前のジョブから進め、終わったもの・取り消されたものは外す。
+ *          メインスレッドから毎フレーム Tick を呼ぶ想定。
+ */
+class FrameBudgetRunner {
+public:
+  void Add(std::shared_ptr<IncrementalJob> job);
+
+  /// @brief 予算 budgetMs の範囲でジョブを進め、使った時間を返す
+  double Tick(double budgetMs);
+
+  bool IsIdle() const { return m_jobs.empty(); }
+  size_t GetJobCount() const { return m_jobs.size(); }
+
+  const FrameBudgetStats &GetStats() const { return m_stats; }
+  void ResetStats() { m_stats = {}; }
+
+private:
+  std::vector<std::shared_ptr<IncrementalJob>> m_jobs;
+  FrameBudgetStats m_stats;
+};
+
+} // namespace core
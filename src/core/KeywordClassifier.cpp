@@ -0,0 +1,119 @@
+/**
+ * @file KeywordClassifier.cpp
+ * @brief 重み付きキーワード分類器の実装
+ */
+
+#include "KeywordClassifier.h"
+#include <algorithm>
+
+namespace core {
+
+namespace {
+
+char ToLowerAscii(char c) {
+  return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+bool IsWordChar(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         (c >= '0' && c <= '9');
+}
+
+/// @brief 英数字で始まり英数字で終わる ASCII だけのキーワードか
+bool IsAsciiWord(std::string_view keyword) {
+  if (keyword.empty() || !IsWordChar(keyword.front()) ||
+      !IsWordChar(keyword.back())) {
+    return false;
+  }
+  return std::all_of(keyword.begin(), keyword.end(), [](char c) {
+    return static_cast<unsigned char>(c) < 0x80;
+  });
+}
+
+/// @brief text[position, position + length) が単語として現れているか
+/// @details 直後の s は複数形として読み飛ばす（"planets" は "planet"）。
+bool IsWholeWord(std::string_view text, size_t position, size_t length) {
+  if (position > 0 && IsWordChar(text[position - 1])) {
+    return false;
+  }
+  size_t end = position + length;
+  if (end < text.size() && text[end] == 's') {
+    ++end;
+  }
+  return end >= text.size() || !IsWordChar(text[end]);
+}
+
+} // namespace
+
+uint32_t KeywordClassifier::AddLabel(std::string name) {
+  m_labelNames.push_back(std::move(name));
+  return static_cast<uint32_t>(m_labelNames.size() - 1);
+}
+
+void KeywordClassifier::AddKeyword(uint32_t label, std::string_view keyword,
+                                   float weight) {
+  std::string lowered(keyword);
+  std::transform(lowered.begin(), lowered.end(), lowered.begin(),
+                 ToLowerAscii);
+  m_keywords.push_back({label, weight, IsAsciiWord(lowered)});
+  m_patterns.push_back(std::move(lowered));
+}
+
+void KeywordClassifier::AddKeywords(
+    uint32_t label, std::initializer_list<std::string_view> list,
+    float weight) {
+  for (std::string_view keyword : list) {
+    AddKeyword(label, keyword, weight);
+  }
+}
+
+void KeywordClassifier::Compile() {
+  m_matcher.Build({m_patterns.begin(), m_patterns.end()});
+}
+
+void KeywordClassifier::Classify(const std::vector<KeywordSource> &sources,
+                                 std::vector<KeywordScore> &ranked) const {
+  ranked.clear();
+  std::vector<float> scores(m_labelNames.size(), 0.0f);
+  std::vector<uint32_t> hits(m_keywords.size());
+  std::vector<PatternMatch> matches;
+  std::string lowered;
+
+  for (const KeywordSource &source : sources) {
+    lowered.resize(source.text.size());
+    std::transform(source.text.begin(), source.text.end(), lowered.begin(),
+                   ToLowerAscii);
+    matches.clear();
+    m_matcher.FindAll(lowered, matches);
+
+    std::fill(hits.begin(), hits.end(), 0u);
+    for (const PatternMatch &match : matches) {
+      const Keyword &keyword = m_keywords[match.pattern];
+      if (hits[match.pattern] >= m_maxHitsPerKeyword ||
+          (keyword.wholeWord &&
+           !IsWholeWord(lowered, match.position, match.length))) {
+        continue;
+      }
+      ++hits[match.pattern];
+      scores[keyword.label] += keyword.weight * source.weight;
+    }
+  }
+
+  float total = 0.0f;
+  for (uint32_t label = 0; label < scores.size(); ++label) {
+    if (scores[label] > 0.0f) {
+      ranked.push_back({label, scores[label], 0.0f});
+      total += scores[label];
+    }
+  }
+  // 安定ソートなので同点はラベルの番号順（= 追加した順）
+  std::stable_sort(ranked.begin(), ranked.end(),
+                   [](const KeywordScore &a, const KeywordScore &b) {
+                     return a.score > b.score;
+                   });
+  for (KeywordScore &entry : ranked) {
+    entry.confidence = entry.score / total;
+  }
+}
+
+} // namespace core
@@ -0,0 +1,85 @@
+#pragma once
+/**
+ * @file KeywordClassifier.h
+ * @brief 重み付きキーワードで本文を複数のラベルに採点する分類器
+ */
+
+#include "PatternMatcher.h"
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace core {
+
+/// @brief 1ラベルの採点結果
+struct KeywordScore {
+  uint32_t label;   ///< AddLabel が返した番号
+  float score;      ///< 一致したキーワードの重みの合計
+  float confidence; ///< 全ラベルの合計に対する割合（0〜1）
+};
+
+/// @brief 採点する本文とその重み（タイトルを本文より重く見る等）
+struct KeywordSource {
+  std::string_view text;
+  float weight = 1.0f;
+};
+
+/**
+ * @brief 全ラベルのキーワードを1つのオートマトンにまとめた分類器
+ * @details Compile で全キーワードを PatternMatcher に1度だけ登録し、
+ *          Classify は本文ごとに1回の走査ですべてのラベルを採点する。
+ *          英字は大文字・小文字を区別しない（ASCII のみ）。
+ *          英数字だけのキーワードは単語としての一致だけを数え
+ *          （"ai" は "said" に一致しない）、末尾の複数形の s は許す。
+ *          それ以外（日本語など）は部分一致でよい。
+ *          1キーワードの出現は maxHitsPerKeyword 回まで数えるので、
+ *          長い本文で1語が繰り返されても他のラベルを押し流さない。
+ */
+class KeywordClassifier {
+public:
+  /// @brief ラベルを追加する。同点のときは先に追加したラベルが上になる
+  uint32_t AddLabel(std::string name);
+
+  /// @brief ラベルにキーワードを足す（Compile までは何度でも呼べる）
+  void AddKeyword(uint32_t label, std::string_view keyword,
+                  float weight = 1.0f);
+
+  /// @brief 同じ重みのキーワードをまとめて足す
+  void AddKeywords(uint32_t label, std::initializer_list<std::string_view> list,
+                   float weight = 1.0f);
+
+  /// @brief キーワードからオートマトンを作る
+  void Compile();
+
+  /// @brief 1キーワードを数える出現回数の上限（本文ごと）
+  void SetMaxHitsPerKeyword(uint32_t hits) { m_maxHitsPerKeyword = hits; }
+
+  size_t GetLabelCount() const { return m_labelNames.size(); }
+  const std::string &GetLabelName(uint32_t label) const {
+    return m_labelNames[label];
+  }
+
+  /**
+   * @brief すべての本文を採点し、点のあるラベルを点の高い順に返す
+   * @param ranked 作り直される。どのキーワードも現れなければ空
+   */
+  void Classify(const std::vector<KeywordSource> &sources,
+                std::vector<KeywordScore> &ranked) const;
+
+private:
+  struct Keyword {
+    uint32_t label;
+    float weight;
+    bool wholeWord; ///< 英数字のキーワード（単語の境界で区切る）
+  };
+
+  std::vector<std::string> m_labelNames;
+  std::vector<std::string> m_patterns; ///< 小文字にしたキーワード
+  std::vector<Keyword> m_keywords;     ///< m_patterns と同じ順
+  PatternMatcher m_matcher;
+  uint32_t m_maxHitsPerKeyword = 3;
+};
+
+} // namespace core
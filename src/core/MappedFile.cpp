@@ -0,0 +1,162 @@
+/**
+ * @file MappedFile.cpp
+ * @brief 読み取り専用メモリマップドファイルの実装
+ */
+
+#include "MappedFile.h"
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace core {
+
+MappedFile::~MappedFile() { Close(); }
+
+MappedFile::MappedFile(MappedFile &&other) noexcept {
+  *this = std::move(other);
+}
+
+MappedFile &MappedFile::operator=(MappedFile &&other) noexcept {
+  if (this != &other) {
+    Close();
+    std::swap(m_data, other.m_data);
+    std::swap(m_size, other.m_size);
+#ifdef _WIN32
+    std::swap(m_file, other.m_file);
+    std::swap(m_mapping, other.m_mapping);
+#endif
+  }
+  return *this;
+}
+
+#ifdef _WIN32
+
+bool MappedFile::Open(const std::filesystem::path &path) {
+  Close();
+  HANDLE file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+  if (file == INVALID_HANDLE_VALUE) {
+    return false;
+  }
+  LARGE_INTEGER size{};
+  if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0) {
+    CloseHandle(file);
+    return false;
+  }
+  HANDLE mapping =
+      CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+  if (!mapping) {
+    CloseHandle(file);
+    return false;
+  }
+  const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+  if (!view) {
+    CloseHandle(mapping);
+    CloseHandle(file);
+    return false;
+  }
+  m_file = file;
+  m_mapping = mapping;
+  m_data = static_cast<const uint8_t *>(view);
+  m_size = static_cast<size_t>(size.QuadPart);
+  return true;
+}
+
+void MappedFile::Close() {
+  if (m_data) {
+    UnmapViewOfFile(m_data);
+  }
+  if (m_mapping) {
+    CloseHandle(static_cast<HANDLE>(m_mapping));
+  }
+  if (m_file) {
+    CloseHandle(static_cast<HANDLE>(m_file));
+  }
+  m_data = nullptr;
+  m_size = 0;
+  m_mapping = nullptr;
+  m_file = nullptr;
+}
+
+#else
+
+bool MappedFile::Open(const std::filesystem::path &path) {
+  Close();
+  const int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat st {};
+  if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+    close(fd);
+    return false;
+  }
+  void *view = mmap(nullptr, static_cast<size_t>(st.st_size), PROT_READ,
+                    MAP_PRIVATE, fd, 0);
+  // マップはファイル記述子を閉じても有効
+  close(fd);
+  if (view == MAP_FAILED) {
+    return false;
+  }
+  m_data = static_cast<const uint8_t *>(view);
+  m_size = static_cast<size_t>(st.st_size);
+  return true;
+}
+
+void MappedFile::Close() {
+  if (m_data) {
+    munmap(const_cast<uint8_t *>(m_data), m_size);
+  }
+  m_data = nullptr;
+  m_size = 0;
+}
+
+#endif
+
+bool WriteFileAtomically(const std::filesystem::path &path,
+                         const uint8_t *data, size_t size) {
+  std::error_code ec;
+  if (path.has_parent_path()) {
+    std::filesystem::create_directories(path.parent_path(), ec);
+  }
+  // 同じファイルを別のプロセス（ゲームを2つ、SkyboxGen とゲームなど）が
+  // 同時に書いても一時ファイルが重ならないよう、名前に乱数を付ける
+  static thread_local std::mt19937_64 random{std::random_device{}()};
+  char suffix[24];
+  std::snprintf(suffix, sizeof(suffix), ".%016llx.tmp",
+                static_cast<unsigned long long>(random()));
+  std::filesystem::path tempPath = path;
+  tempPath += suffix;
+  {
+    std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      return false;
+    }
+    file.write(reinterpret_cast<const char *>(data),
+               static_cast<std::streamsize>(size));
+    if (!file) {
+      file.close();
+      std::filesystem::remove(tempPath, ec);
+      return false;
+    }
+  }
+  std::filesystem::rename(tempPath, path, ec);
+  if (ec) {
+    std::filesystem::remove(tempPath, ec);
+    return false;
+  }
+  return true;
+}
+
+} // namespace core
@@ -0,0 +1,52 @@
+#pragma once
+/**
+ * @file MappedFile.h
+ * @brief 読み取り専用のメモリマップドファイル
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace core {
+
+/// @brief ファイル全体を読み取り専用でメモリに割り当てる
+/// @details ReadFile でバッファへコピーせず、ページキャッシュを直接読む。
+///          マップ中のファイルは Windows では削除・置換できないので、
+///          書き換える前に Close すること。
+class MappedFile {
+public:
+  MappedFile() = default;
+  ~MappedFile();
+
+  MappedFile(const MappedFile &) = delete;
+  MappedFile &operator=(const MappedFile &) = delete;
+  MappedFile(MappedFile &&other) noexcept;
+  MappedFile &operator=(MappedFile &&other) noexcept;
+
+  /// @brief ファイルを開いて割り当てる（空のファイルは失敗扱い）
+  bool Open(const std::filesystem::path &path);
+
+  void Close();
+
+  bool IsOpen() const { return m_data != nullptr; }
+  const uint8_t *Data() const { return m_data; }
+  size_t Size() const { return m_size; }
+
+private:
+  const uint8_t *m_data = nullptr;
+  size_t m_size = 0;
+#ifdef _WIN32
+  void *m_file = nullptr;    ///< HANDLE
+  void *m_mapping = nullptr; ///< HANDLE
+#endif
+};
+
+/// @brief 一時ファイルへ書いてから置き換える（読み込み中の壊れたファイルを防ぐ）
+/// @details 親ディレクトリがなければ作る。一時ファイルは
+///          "<path>.<乱数>.tmp" なので、同じ path へ同時に書いても
+///          互いの一時ファイルを壊さない（最後に置き換えた方が残る）。
+bool WriteFileAtomically(const std::filesystem::path &path,
+                         const uint8_t *data, size_t size);
+
+} // namespace core
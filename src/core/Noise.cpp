@@ -0,0 +1,589 @@
+/**
+ * @file Noise.cpp
+ * @brief 手続きノイズの実装
+ */
+
+#include "Noise.h"
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define CORE_NOISE_SSE2 1
+#endif
+
+namespace core::noise {
+
+namespace {
+
+// カーネルは「レーン型」L を引数に取るテンプレートで1度だけ書き、
+// スカラー（1要素）と SSE2（4要素）の両方に展開する。
+// 各レーンで同じ IEEE 演算を同じ順序で行うので、結果は一致する。
+
+/// @brief スカラーレーン
+struct ScalarLanes {
+  using F = float;
+  using I = int32_t;
+  using M = bool;
+
+  static F Set(float v) { return v; }
+  static I SetI(int32_t v) { return v; }
+
+  /// @brief 切り捨て変換で求める floor（|x| < 2^31 で正確）
+  static F Floor(F x) {
+    F f = static_cast<F>(static_cast<I>(x));
+    return f - ((f > x) ? 1.0f : 0.0f);
+  }
+  static I ToInt(F x) { return static_cast<I>(x); }
+  static F ToFloat(I x) { return static_cast<F>(x); }
+
+  // 符号付きオーバーフローを避けるため加算・乗算は符号なしで行う
+  static I Add(I a, I b) {
+    return static_cast<I>(static_cast<uint32_t>(a) + static_cast<uint32_t>(b));
+  }
+  static I Mul(I a, I b) {
+    return static_cast<I>(static_cast<uint32_t>(a) * static_cast<uint32_t>(b));
+  }
+  static I Xor(I a, I b) { return a ^ b; }
+  static I And(I a, I b) { return a & b; }
+  static I Sra(I a, int s) { return a >> s; }
+  static I Srl(I a, int s) {
+    return static_cast<I>(static_cast<uint32_t>(a) >> s);
+  }
+
+  static M LessI(I a, I b) { return a < b; }
+  static M EqualI(I a, I b) { return a == b; }
+  static M NonZeroI(I a) { return a != 0; }
+  static M Less(F a, F b) { return a < b; }
+  static M Greater(F a, F b) { return a > b; }
+  static M Or(M a, M b) { return a || b; }
+
+  static F Select(M m, F a, F b) { return m ? a : b; }
+  /// @brief SSE2 の minps と同じく「a < b なら a、そうでなければ b」
+  static F Min(F a, F b) { return (a < b) ? a : b; }
+  static F Max(F a, F b) { return (a > b) ? a : b; }
+  static F Sqrt(F a) { return std::sqrt(a); }
+  static F Abs(F a) { return std::fabs(a); }
+};
+
+#ifdef CORE_NOISE_SSE2
+
+/// @brief 4要素の float（演算子でカーネルをスカラーと共通に書くための薄い包み）
+struct F4 {
+  __m128 v;
+};
+inline F4 operator+(F4 a, F4 b) { return {_mm_add_ps(a.v, b.v)}; }
+inline F4 operator-(F4 a, F4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline F4 operator*(F4 a, F4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+inline F4 operator/(F4 a, F4 b) { return {_mm_div_ps(a.v, b.v)}; }
+inline F4 operator+(F4 a, float b) { return a + F4{_mm_set1_ps(b)}; }
+inline F4 operator-(F4 a, float b) { return a - F4{_mm_set1_ps(b)}; }
+inline F4 operator*(F4 a, float b) { return a * F4{_mm_set1_ps(b)}; }
+inline F4 operator/(F4 a, float b) { return a / F4{_mm_set1_ps(b)}; }
+inline F4 operator+(float a, F4 b) { return F4{_mm_set1_ps(a)} + b; }
+inline F4 operator-(float a, F4 b) { return F4{_mm_set1_ps(a)} - b; }
+inline F4 operator*(float a, F4 b) { return F4{_mm_set1_ps(a)} * b; }
+inline F4 operator-(F4 a) { return {_mm_xor_ps(a.v, _mm_set1_ps(-0.0f))}; }
+inline F4 &operator+=(F4 &a, F4 b) { return a = a + b; }
+inline F4 &operator*=(F4 &a, F4 b) { return a = a * b; }
+
+/// @brief SSE2 レーン（4要素）
+struct SseLanes {
+  using F = F4;
+  using I = __m128i;
+  using M = __m128;
+
+  static F Set(float v) { return {_mm_set1_ps(v)}; }
+  static I SetI(int32_t v) { return _mm_set1_epi32(v); }
+
+  static F Floor(F x) {
+    __m128 f = _mm_cvtepi32_ps(_mm_cvttps_epi32(x.v));
+    __m128 adjust = _mm_and_ps(_mm_cmpgt_ps(f, x.v), _mm_set1_ps(1.0f));
+    return {_mm_sub_ps(f, adjust)};
+  }
+  static I ToInt(F x) { return _mm_cvttps_epi32(x.v); }
+  static F ToFloat(I x) { return {_mm_cvtepi32_ps(x)}; }
+
+  static I Add(I a, I b) { return _mm_add_epi32(a, b); }
+  /// @brief 32bit 乗算の下位（SSE2 には pmulld がないので2回に分ける）
+  static I Mul(I a, I b) {
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+  }
+  static I Xor(I a, I b) { return _mm_xor_si128(a, b); }
+  static I And(I a, I b) { return _mm_and_si128(a, b); }
+  static I Sra(I a, int s) { return _mm_sra_epi32(a, _mm_cvtsi32_si128(s)); }
+  static I Srl(I a, int s) { return _mm_srl_epi32(a, _mm_cvtsi32_si128(s)); }
+
+  static M LessI(I a, I b) { return _mm_castsi128_ps(_mm_cmplt_epi32(a, b)); }
+  static M EqualI(I a, I b) { return _mm_castsi128_ps(_mm_cmpeq_epi32(a, b)); }
+  static M NonZeroI(I a) {
+    return _mm_castsi128_ps(_mm_xor_si128(
+        _mm_cmpeq_epi32(a, _mm_setzero_si128()), _mm_set1_epi32(-1)));
+  }
+  static M Less(F a, F b) { return _mm_cmplt_ps(a.v, b.v); }
+  static M Greater(F a, F b) { return _mm_cmpgt_ps(a.v, b.v); }
+  static M Or(M a, M b) { return _mm_or_ps(a, b); }
+
+  static F Select(M m, F a, F b) {
+    return {_mm_or_ps(_mm_and_ps(m, a.v), _mm_andnot_ps(m, b.v))};
+  }
+  static F Min(F a, F b) { return {_mm_min_ps(a.v, b.v)}; }
+  static F Max(F a, F b) { return {_mm_max_ps(a.v, b.v)}; }
+  static F Sqrt(F a) { return {_mm_sqrt_ps(a.v)}; }
+  static F Abs(F a) { return {_mm_andnot_ps(_mm_set1_ps(-0.0f), a.v)}; }
+};
+
+#endif
+
+// ---------------------------------------------------------------------------
+// ハッシュ
+// ---------------------------------------------------------------------------
+
+/// @brief 格子値ハッシュ [0, 1]
+/// @details seed = 0 のとき旧 SkyboxTextureGenerator の hash(a, b, c) と一致する。
+template <typename L>
+typename L::F ValueHash(typename L::I a, typename L::I b, typename L::I c,
+                        typename L::I seedTerm) {
+  using I = typename L::I;
+  I n = L::Add(L::Add(L::Mul(a, L::SetI(374761393)),
+                      L::Mul(b, L::SetI(668265263))),
+               c);
+  n = L::Add(n, seedTerm);
+  n = L::Mul(L::Xor(n, L::Sra(n, 13)), L::SetI(1274126177));
+  I bits = L::And(L::Xor(n, L::Sra(n, 16)), L::SetI(0x7FFFFFFF));
+  return L::ToFloat(bits) / 2147483647.0f;
+}
+
+/// @brief 勾配選択用ハッシュ（上位ビットほど良く混ざる）
+template <typename L>
+typename L::I GradientHash(typename L::I a, typename L::I b, typename L::I c,
+                           typename L::I seed) {
+  using I = typename L::I;
+  I h = L::Xor(L::Xor(L::Mul(a, L::SetI(501125321)),
+                      L::Mul(b, L::SetI(1136930381))),
+               L::Xor(L::Mul(c, L::SetI(1720413743)), seed));
+  h = L::Mul(h, L::SetI(0x27d4eb2d));
+  h = L::Xor(h, L::Srl(h, 15));
+  h = L::Mul(h, L::SetI(0x2c1b3c6d));
+  return h;
+}
+
+/// @brief seed をハッシュへ足し込む項（seed = 0 なら 0）
+inline int32_t ValueSeedTerm(uint32_t seed) {
+  return static_cast<int32_t>(seed * 1013904223u);
+}
+
+template <typename L> typename L::F Lerp(typename L::F a, typename L::F b,
+                                         typename L::F t) {
+  return a + (b - a) * t;
+}
+
+// ---------------------------------------------------------------------------
+// 基底ノイズ
+// ---------------------------------------------------------------------------
+
+template <typename L>
+typename L::F Value3Kernel(typename L::F x, typename L::F y, typename L::F z,
+                           uint32_t seed) {
+  using F = typename L::F;
+  using I = typename L::I;
+  const I seedTerm = L::SetI(ValueSeedTerm(seed));
+
+  F xf0 = L::Floor(x);
+  F yf0 = L::Floor(y);
+  F zf0 = L::Floor(z);
+  I xi = L::ToInt(xf0);
+  I yi = L::ToInt(yf0);
+  I zi = L::ToInt(zf0);
+  I one = L::SetI(1);
+  I xi1 = L::Add(xi, one);
+  I yi1 = L::Add(yi, one);
+  I zi1 = L::Add(zi, one);
+
+  F xf = x - xf0;
+  F yf = y - yf0;
+  F zf = z - zf0;
+
+  // スムーズステップ
+  F u = xf * xf * (3.0f - 2.0f * xf);
+  F v = yf * yf * (3.0f - 2.0f * yf);
+  F w = zf * zf * (3.0f - 2.0f * zf);
+
+  F c000 = ValueHash<L>(xi, yi, zi, seedTerm);
+  F c100 = ValueHash<L>(xi1, yi, zi, seedTerm);
+  F c010 = ValueHash<L>(xi, yi1, zi, seedTerm);
+  F c110 = ValueHash<L>(xi1, yi1, zi, seedTerm);
+  F c001 = ValueHash<L>(xi, yi, zi1, seedTerm);
+  F c101 = ValueHash<L>(xi1, yi, zi1, seedTerm);
+  F c011 = ValueHash<L>(xi, yi1, zi1, seedTerm);
+  F c111 = ValueHash<L>(xi1, yi1, zi1, seedTerm);
+
+  F c00 = c000 * (1.0f - u) + c100 * u;
+  F c10 = c010 * (1.0f - u) + c110 * u;
+  F c01 = c001 * (1.0f - u) + c101 * u;
+  F c11 = c011 * (1.0f - u) + c111 * u;
+
+  F c0 = c00 * (1.0f - v) + c10 * v;
+  F c1 = c01 * (1.0f - v) + c11 * v;
+
+  return c0 * (1.0f - w) + c1 * w;
+}
+
+/// @brief 立方体の12辺方向から勾配を選び、オフセットとの内積を返す
+template <typename L>
+typename L::F Grad3(typename L::I hash, typename L::F x, typename L::F y,
+                    typename L::F z) {
+  using F = typename L::F;
+  using I = typename L::I;
+  using M = typename L::M;
+  I h = L::Srl(hash, 28); // 0..15
+  M lt8 = L::LessI(h, L::SetI(8));
+  M lt4 = L::LessI(h, L::SetI(4));
+  M h12or14 =
+      L::Or(L::EqualI(h, L::SetI(12)), L::EqualI(h, L::SetI(14)));
+  F u = L::Select(lt8, x, y);
+  F v = L::Select(lt4, y, L::Select(h12or14, x, z));
+  M negU = L::NonZeroI(L::And(h, L::SetI(1)));
+  M negV = L::NonZeroI(L::And(h, L::SetI(2)));
+  return L::Select(negU, -u, u) + L::Select(negV, -v, v);
+}
+
+template <typename L>
+typename L::F Perlin3Kernel(typename L::F x, typename L::F y, typename L::F z,
+                            uint32_t seed) {
+  using F = typename L::F;
+  using I = typename L::I;
+  const I s = L::SetI(static_cast<int32_t>(seed));
+
+  F xf0 = L::Floor(x);
+  F yf0 = L::Floor(y);
+  F zf0 = L::Floor(z);
+  I xi = L::ToInt(xf0);
+  I yi = L::ToInt(yf0);
+  I zi = L::ToInt(zf0);
+  I one = L::SetI(1);
+  I xi1 = L::Add(xi, one);
+  I yi1 = L::Add(yi, one);
+  I zi1 = L::Add(zi, one);
+
+  F fx = x - xf0;
+  F fy = y - yf0;
+  F fz = z - zf0;
+  F fx1 = fx - 1.0f;
+  F fy1 = fy - 1.0f;
+  F fz1 = fz - 1.0f;
+
+  // 5次の補間曲線 6t^5 - 15t^4 + 10t^3
+  F u = fx * fx * fx * (fx * (fx * 6.0f - 15.0f) + 10.0f);
+  F v = fy * fy * fy * (fy * (fy * 6.0f - 15.0f) + 10.0f);
+  F w = fz * fz * fz * (fz * (fz * 6.0f - 15.0f) + 10.0f);
+
+  F g000 = Grad3<L>(GradientHash<L>(xi, yi, zi, s), fx, fy, fz);
+  F g100 = Grad3<L>(GradientHash<L>(xi1, yi, zi, s), fx1, fy, fz);
+  F g010 = Grad3<L>(GradientHash<L>(xi, yi1, zi, s), fx, fy1, fz);
+  F g110 = Grad3<L>(GradientHash<L>(xi1, yi1, zi, s), fx1, fy1, fz);
+  F g001 = Grad3<L>(GradientHash<L>(xi, yi, zi1, s), fx, fy, fz1);
+  F g101 = Grad3<L>(GradientHash<L>(xi1, yi, zi1, s), fx1, fy, fz1);
+  F g011 = Grad3<L>(GradientHash<L>(xi, yi1, zi1, s), fx, fy1, fz1);
+  F g111 = Grad3<L>(GradientHash<L>(xi1, yi1, zi1, s), fx1, fy1, fz1);
+
+  F x00 = Lerp<L>(g000, g100, u);
+  F x10 = Lerp<L>(g010, g110, u);
+  F x01 = Lerp<L>(g001, g101, u);
+  F x11 = Lerp<L>(g011, g111, u);
+  F y0 = Lerp<L>(x00, x10, v);
+  F y1 = Lerp<L>(x01, x11, v);
+  return Lerp<L>(y0, y1, w);
+}
+
+/// @brief 8方向の2D勾配（(±1, ±2) と (±2, ±1)）との内積
+template <typename L>
+typename L::F Grad2(typename L::I hash, typename L::F x, typename L::F y) {
+  using F = typename L::F;
+  using I = typename L::I;
+  using M = typename L::M;
+  I h = L::Srl(hash, 29); // 0..7
+  M lt4 = L::LessI(h, L::SetI(4));
+  F u = L::Select(lt4, x, y);
+  F v = L::Select(lt4, y, x);
+  M negU = L::NonZeroI(L::And(h, L::SetI(1)));
+  M negV = L::NonZeroI(L::And(h, L::SetI(2)));
+  F v2 = v * 2.0f;
+  return L::Select(negU, -u, u) + L::Select(negV, -v2, v2);
+}
+
+template <typename L>
+typename L::F Simplex2Kernel(typename L::F x, typename L::F y, uint32_t seed) {
+  using F = typename L::F;
+  using I = typename L::I;
+  using M = typename L::M;
+  constexpr float kF2 = 0.366025403784f; // (sqrt(3) - 1) / 2
+  constexpr float kG2 = 0.211324865405f; // (3 - sqrt(3)) / 6
+  const I s = L::SetI(static_cast<int32_t>(seed));
+  const I zero = L::SetI(0);
+
+  // 斜交座標で所属する単体を求める
+  F skew = (x + y) * kF2;
+  F i = L::Floor(x + skew);
+  F j = L::Floor(y + skew);
+  F unskew = (i + j) * kG2;
+  F x0 = x - (i - unskew);
+  F y0 = y - (j - unskew);
+
+  M lower = L::Greater(x0, y0);
+  F i1 = L::Select(lower, L::Set(1.0f), L::Set(0.0f));
+  F j1 = 1.0f - i1;
+
+  F x1 = x0 - i1 + kG2;
+  F y1 = y0 - j1 + kG2;
+  F x2 = x0 - 1.0f + 2.0f * kG2;
+  F y2 = y0 - 1.0f + 2.0f * kG2;
+
+  I ii = L::ToInt(i);
+  I jj = L::ToInt(j);
+  I h0 = GradientHash<L>(ii, jj, zero, s);
+  I h1 = GradientHash<L>(L::ToInt(i + i1), L::ToInt(j + j1), zero, s);
+  I h2 = GradientHash<L>(L::Add(ii, L::SetI(1)), L::Add(jj, L::SetI(1)),
+                         zero, s);
+
+  auto corner = [&](I h, F cx, F cy) {
+    F t = 0.5f - cx * cx - cy * cy;
+    F t2 = t * t;
+    F contribution = t2 * t2 * Grad2<L>(h, cx, cy);
+    return L::Select(L::Less(t, L::Set(0.0f)), L::Set(0.0f), contribution);
+  };
+
+  // 勾配の長さが sqrt(5) なので、おおよそ [-1, 1] に収まる係数を掛ける
+  return (corner(h0, x0, y0) + corner(h1, x1, y1) + corner(h2, x2, y2)) *
+         45.23f;
+}
+
+template <typename L>
+typename L::F Worley3Kernel(typename L::F x, typename L::F y, typename L::F z,
+                            uint32_t seed) {
+  using F = typename L::F;
+  using I = typename L::I;
+  const I seedTerm = L::SetI(ValueSeedTerm(seed));
+  const I one = L::SetI(1);
+
+  I xi = L::ToInt(L::Floor(x));
+  I yi = L::ToInt(L::Floor(y));
+  I zi = L::ToInt(L::Floor(z));
+
+  F minDist = L::Set(10.0f);
+
+  // 周辺セルを探索（旧 GenerateWorleyNoise と同じ特徴点配置）
+  for (int dx = -1; dx <= 1; ++dx) {
+    for (int dy = -1; dy <= 1; ++dy) {
+      for (int dz = -1; dz <= 1; ++dz) {
+        I cx = L::Add(xi, L::SetI(dx));
+        I cy = L::Add(yi, L::SetI(dy));
+        I cz = L::Add(zi, L::SetI(dz));
+
+        F px = L::ToFloat(cx) + ValueHash<L>(cx, cy, cz, seedTerm);
+        F py = L::ToFloat(cy) + ValueHash<L>(L::Add(cx, one), cy, cz, seedTerm);
+        F pz = L::ToFloat(cz) + ValueHash<L>(cx, L::Add(cy, one), cz, seedTerm);
+
+        F dist = L::Sqrt((x - px) * (x - px) + (y - py) * (y - py) +
+                         (z - pz) * (z - pz));
+        minDist = L::Min(minDist, dist);
+      }
+    }
+  }
+  return minDist;
+}
+
+template <typename L>
+typename L::F BasisKernel(Basis basis, typename L::F x, typename L::F y,
+                          typename L::F z, uint32_t seed) {
+  switch (basis) {
+  case Basis::Value:
+    return Value3Kernel<L>(x, y, z, seed);
+  case Basis::Simplex:
+    return Simplex2Kernel<L>(x, y, seed);
+  case Basis::Perlin:
+  default:
+    return Perlin3Kernel<L>(x, y, z, seed);
+  }
+}
+
+template <typename L>
+typename L::F FbmKernel(typename L::F x, typename L::F y, typename L::F z,
+                        const FractalSettings &settings, uint32_t seed) {
+  using F = typename L::F;
+  F value = L::Set(0.0f);
+  float amplitude = 1.0f;
+  float frequency = settings.frequency;
+  float maxValue = 0.0f;
+
+  for (int i = 0; i < settings.octaves; ++i) {
+    value += BasisKernel<L>(settings.basis, x * frequency, y * frequency,
+                            z * frequency, seed) *
+             amplitude;
+    maxValue += amplitude;
+    amplitude *= settings.gain;
+    frequency *= settings.lacunarity;
+  }
+
+  if (settings.normalize && maxValue > 0.0f) {
+    return value / maxValue;
+  }
+  return value;
+}
+
+template <typename L>
+typename L::F RidgedKernel(typename L::F x, typename L::F y, typename L::F z,
+                           const FractalSettings &settings, uint32_t seed) {
+  using F = typename L::F;
+  F value = L::Set(0.0f);
+  float amplitude = 1.0f;
+  float frequency = settings.frequency;
+  float maxValue = 0.0f;
+
+  for (int i = 0; i < settings.octaves; ++i) {
+    F n = BasisKernel<L>(settings.basis, x * frequency, y * frequency,
+                         z * frequency, seed);
+    if (settings.basis == Basis::Value) {
+      n = n * 2.0f - 1.0f; // [-1, 1] にそろえる
+    }
+    F ridge = 1.0f - L::Abs(n);
+    value += ridge * ridge * amplitude;
+    maxValue += amplitude;
+    amplitude *= settings.gain;
+    frequency *= settings.lacunarity;
+  }
+
+  if (settings.normalize && maxValue > 0.0f) {
+    return value / maxValue;
+  }
+  return value;
+}
+
+// ---------------------------------------------------------------------------
+// バッチ実行
+// ---------------------------------------------------------------------------
+
+/// @brief 4要素ずつ SSE2 で、端数はスカラーで評価する
+/// @param kernel kernel(lanesTag, x, y, z) -> F
+template <typename Kernel>
+void RunBatch(const float *xs, const float *ys, const float *zs, float *out,
+              size_t count, Kernel &&kernel) {
+  size_t i = 0;
+#ifdef CORE_NOISE_SSE2
+  for (; i + 4 <= count; i += 4) {
+    F4 x{_mm_loadu_ps(xs + i)};
+    F4 y{_mm_loadu_ps(ys + i)};
+    F4 z{zs ? _mm_loadu_ps(zs + i) : _mm_setzero_ps()};
+    _mm_storeu_ps(out + i, kernel(SseLanes{}, x, y, z).v);
+  }
+#endif
+  for (; i < count; ++i) {
+    out[i] = kernel(ScalarLanes{}, xs[i], ys[i], zs ? zs[i] : 0.0f);
+  }
+}
+
+} // namespace
+
+float Value3(float x, float y, float z, uint32_t seed) {
+  return Value3Kernel<ScalarLanes>(x, y, z, seed);
+}
+
+float Perlin3(float x, float y, float z, uint32_t seed) {
+  return Perlin3Kernel<ScalarLanes>(x, y, z, seed);
+}
+
+float Simplex2(float x, float y, uint32_t seed) {
+  return Simplex2Kernel<ScalarLanes>(x, y, seed);
+}
+
+float Worley3(float x, float y, float z, uint32_t seed) {
+  return Worley3Kernel<ScalarLanes>(x, y, z, seed);
+}
+
+float Fbm3(float x, float y, float z, const FractalSettings &settings,
+           uint32_t seed) {
+  return FbmKernel<ScalarLanes>(x, y, z, settings, seed);
+}
+
+float Ridged3(float x, float y, float z, const FractalSettings &settings,
+              uint32_t seed) {
+  return RidgedKernel<ScalarLanes>(x, y, z, settings, seed);
+}
+
+void Value3Batch(const float *xs, const float *ys, const float *zs,
+                 float *out, size_t count, uint32_t seed) {
+  RunBatch(xs, ys, zs, out, count, [seed](auto lanes, auto x, auto y, auto z) {
+    return Value3Kernel<decltype(lanes)>(x, y, z, seed);
+  });
+}
+
+void Perlin3Batch(const float *xs, const float *ys, const float *zs,
+                  float *out, size_t count, uint32_t seed) {
+  RunBatch(xs, ys, zs, out, count, [seed](auto lanes, auto x, auto y, auto z) {
+    return Perlin3Kernel<decltype(lanes)>(x, y, z, seed);
+  });
+}
+
+void Simplex2Batch(const float *xs, const float *ys, float *out, size_t count,
+                   uint32_t seed) {
+  RunBatch(xs, ys, nullptr, out, count,
+           [seed](auto lanes, auto x, auto y, auto) {
+             return Simplex2Kernel<decltype(lanes)>(x, y, seed);
+           });
+}
+
+void Worley3Batch(const float *xs, const float *ys, const float *zs,
+                  float *out, size_t count, uint32_t seed) {
+  RunBatch(xs, ys, zs, out, count, [seed](auto lanes, auto x, auto y, auto z) {
+    return Worley3Kernel<decltype(lanes)>(x, y, z, seed);
+  });
+}
+
+void Fbm3Batch(const float *xs, const float *ys, const float *zs, float *out,
+               size_t count, const FractalSettings &settings, uint32_t seed) {
+  RunBatch(xs, ys, zs, out, count,
+           [&settings, seed](auto lanes, auto x, auto y, auto z) {
+             return FbmKernel<decltype(lanes)>(x, y, z, settings, seed);
+           });
+}
+
+void Ridged3Batch(const float *xs, const float *ys, const float *zs,
+                  float *out, size_t count, const FractalSettings &settings,
+                  uint32_t seed) {
+  RunBatch(xs, ys, zs, out, count,
+           [&settings, seed](auto lanes, auto x, auto y, auto z) {
+             return RidgedKernel<decltype(lanes)>(x, y, z, settings, seed);
+           });
+}
+
+void Fbm2Row(float x0, float y, float stepX, size_t count,
+             const FractalSettings &settings, uint32_t seed, float *out) {
+  // 座標をスタック上の小さなブロックに展開してバッチ評価する
+  constexpr size_t kBlock = 64;
+  float xs[kBlock];
+  float ys[kBlock];
+  for (size_t base = 0; base < count; base += kBlock) {
+    const size_t n = (count - base < kBlock) ? count - base : kBlock;
+    for (size_t i = 0; i < n; ++i) {
+      xs[i] = x0 + static_cast<float>(base + i) * stepX;
+      ys[i] = y;
+    }
+    RunBatch(xs, ys, nullptr, out + base, n,
+             [&settings, seed](auto lanes, auto px, auto py, auto pz) {
+               return FbmKernel<decltype(lanes)>(px, py, pz, settings, seed);
+             });
+  }
+}
+
+uint32_t SeedFromString(std::string_view text) {
+  uint32_t hash = 2166136261u;
+  for (unsigned char c : text) {
+    hash ^= c;
+    hash *= 16777619u;
+  }
+  return hash;
+}
+
+} // namespace core::noise
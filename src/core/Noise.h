@@ -0,0 +1,81 @@
+#pragma once
+/**
+ * @file Noise.h
+ * @brief 地形・スカイボックス共通の手続きノイズ（スカラー／バッチ SIMD）
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace core::noise {
+
+/// @brief フラクタルの基底ノイズ
+enum class Basis {
+  Value,   ///< 格子値ノイズ [0, 1]（従来のスカイボックスと同じハッシュ）
+  Perlin,  ///< 勾配ノイズ 約[-1, 1]
+  Simplex, ///< 2D シンプレックス 約[-1, 1]（z は無視）
+};
+
+/// @brief FBM / リッジの設定
+struct FractalSettings {
+  Basis basis = Basis::Perlin;
+  int octaves = 5;
+  float frequency = 1.0f;  ///< 第1オクターブの周波数
+  float lacunarity = 2.0f; ///< オクターブごとの周波数倍率
+  float gain = 0.5f;       ///< オクターブごとの振幅倍率
+  bool normalize = true;   ///< 振幅の総和で割って基底と同じ範囲に収める
+};
+
+// 1点ずつ評価する版。バッチ版と同じ演算順で計算するため、
+// どちらで求めてもビット単位で一致する。
+// 整数ハッシュと SSE2 の四則・sqrt のみを使い、三角関数や FMA に頼らないので
+// x64 の CPU 間でも結果は変わらない。
+
+/// @brief 格子値ノイズ [0, 1]
+float Value3(float x, float y, float z, uint32_t seed = 0);
+
+/// @brief 3D パーリンノイズ 約[-1, 1]
+float Perlin3(float x, float y, float z, uint32_t seed = 0);
+
+/// @brief 2D シンプレックスノイズ 約[-1, 1]
+float Simplex2(float x, float y, uint32_t seed = 0);
+
+/// @brief ウォーリーノイズ（最近傍特徴点までの距離 F1）
+/// @details 周囲 27 セルに1点ずつ特徴点を置く。
+float Worley3(float x, float y, float z, uint32_t seed = 0);
+
+/// @brief フラクタルブラウン運動
+float Fbm3(float x, float y, float z, const FractalSettings &settings,
+           uint32_t seed = 0);
+
+/// @brief リッジノイズ（(1 - |n|)^2 を重ねた尾根状の起伏）
+float Ridged3(float x, float y, float z, const FractalSettings &settings,
+              uint32_t seed = 0);
+
+// バッチ版。座標は SoA で渡し、4 要素ずつ SSE2 で評価する。
+
+void Value3Batch(const float *xs, const float *ys, const float *zs,
+                 float *out, size_t count, uint32_t seed = 0);
+void Perlin3Batch(const float *xs, const float *ys, const float *zs,
+                  float *out, size_t count, uint32_t seed = 0);
+void Simplex2Batch(const float *xs, const float *ys, float *out, size_t count,
+                   uint32_t seed = 0);
+void Worley3Batch(const float *xs, const float *ys, const float *zs,
+                  float *out, size_t count, uint32_t seed = 0);
+void Fbm3Batch(const float *xs, const float *ys, const float *zs, float *out,
+               size_t count, const FractalSettings &settings,
+               uint32_t seed = 0);
+void Ridged3Batch(const float *xs, const float *ys, const float *zs,
+                  float *out, size_t count, const FractalSettings &settings,
+                  uint32_t seed = 0);
+
+/// @brief y 一定の行を FBM で埋める（ハイトマップの1行など）
+/// @details 点 i は (x0 + i * stepX, y, 0) で評価する。
+void Fbm2Row(float x0, float y, float stepX, size_t count,
+             const FractalSettings &settings, uint32_t seed, float *out);
+
+/// @brief 文字列からシードを作る（FNV-1a）
+uint32_t SeedFromString(std::string_view text);
+
+} // namespace core::noise
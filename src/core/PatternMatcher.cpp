@@ -0,0 +1,231 @@
+/**
+ * @file PatternMatcher.cpp
+ * @brief Aho–Corasick オートマトンの実装
+ */
+
+#include "PatternMatcher.h"
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+namespace core {
+
+namespace {
+
+/// @brief 文字の途中にあたるコード単位か
+/// @details UTF-8 の継続バイト、UTF-16 の下位サロゲート。
+///          wchar_t が 32 ビットの環境では1単位が1文字なので常に false。
+template <typename CharT> bool IsContinuation(CharT c) {
+  if constexpr (sizeof(CharT) == 1) {
+    return (static_cast<unsigned char>(c) & 0xC0) == 0x80;
+  } else if constexpr (sizeof(CharT) == 2) {
+    const auto u = static_cast<uint16_t>(c);
+    return u >= 0xDC00 && u <= 0xDFFF;
+  } else {
+    return false;
+  }
+}
+
+/// @brief これ以下の辺数なら二分探索せず順に見る
+constexpr uint32_t kLinearEdges = 8;
+
+/// @brief 根の遷移表の大きさ（UTF-8 は 256、UTF-16 は BMP 全体）
+template <typename CharT> constexpr size_t RootTableSize() {
+  return sizeof(CharT) == 1 ? 256 : 65536;
+}
+
+/// @brief 表の添字（範囲外なら RootTableSize 以上を返す）
+template <typename CharT> size_t UnitIndex(CharT c) {
+  if constexpr (sizeof(CharT) == 1) {
+    return static_cast<unsigned char>(c);
+  } else {
+    return static_cast<size_t>(static_cast<std::make_unsigned_t<CharT>>(c));
+  }
+}
+
+} // namespace
+
+template <typename CharT>
+void BasicPatternMatcher<CharT>::Build(const std::vector<View> &patterns) {
+  Clear();
+
+  // 1) トライ（構築中だけ子を状態ごとの配列で持つ）
+  std::vector<std::vector<std::pair<CharT, int32_t>>> children(1);
+  std::vector<int32_t> lastPattern(1, -1);
+  m_nodes.resize(1);
+  m_patternLengths.resize(patterns.size());
+  m_nextPattern.assign(patterns.size(), -1);
+
+  for (size_t p = 0; p < patterns.size(); ++p) {
+    const View pattern = patterns[p];
+    m_patternLengths[p] = static_cast<uint32_t>(pattern.size());
+    // 文字の途中から始まるパターンは境界にそろった出現を持たない
+    if (pattern.empty() || IsContinuation(pattern.front())) {
+      continue;
+    }
+    int32_t node = 0;
+    for (CharT c : pattern) {
+      auto &list = children[node];
+      auto it = std::find_if(list.begin(), list.end(),
+                             [c](const auto &e) { return e.first == c; });
+      if (it != list.end()) {
+        node = it->second;
+        continue;
+      }
+      const int32_t next = static_cast<int32_t>(m_nodes.size());
+      m_nodes.emplace_back();
+      children.emplace_back();
+      lastPattern.push_back(-1);
+      children[node].push_back({c, next});
+      node = next;
+    }
+    // 同じ状態で終わるパターンは番号の昇順につなぐ
+    const int32_t id = static_cast<int32_t>(p);
+    if (lastPattern[node] < 0) {
+      m_nodes[node].firstPattern = id;
+    } else {
+      m_nextPattern[lastPattern[node]] = id;
+    }
+    lastPattern[node] = id;
+  }
+
+  // 2) 辺を文字の昇順で1本の配列に詰める
+  for (size_t n = 0; n < m_nodes.size(); ++n) {
+    auto &list = children[n];
+    std::sort(list.begin(), list.end(),
+              [](const auto &a, const auto &b) { return a.first < b.first; });
+    m_nodes[n].edgeBegin = static_cast<uint32_t>(m_edgeChars.size());
+    for (const auto &e : list) {
+      m_edgeChars.push_back(e.first);
+      m_edgeTargets.push_back(e.second);
+    }
+    m_nodes[n].edgeEnd = static_cast<uint32_t>(m_edgeChars.size());
+  }
+
+  m_rootNext.assign(RootTableSize<CharT>(), 0);
+  for (uint32_t e = m_nodes[0].edgeBegin; e < m_nodes[0].edgeEnd; ++e) {
+    const size_t unit = UnitIndex(m_edgeChars[e]);
+    if (unit < m_rootNext.size()) {
+      m_rootNext[unit] = m_edgeTargets[e];
+    }
+  }
+
+  // 3) 幅優先で失敗リンクと出力リンクを張る
+  std::vector<int32_t> queue;
+  queue.reserve(m_nodes.size());
+  for (uint32_t e = m_nodes[0].edgeBegin; e < m_nodes[0].edgeEnd; ++e) {
+    queue.push_back(m_edgeTargets[e]);
+  }
+  for (size_t head = 0; head < queue.size(); ++head) {
+    const int32_t node = queue[head];
+    for (uint32_t e = m_nodes[node].edgeBegin; e < m_nodes[node].edgeEnd;
+         ++e) {
+      const CharT c = m_edgeChars[e];
+      const int32_t child = m_edgeTargets[e];
+      Node &target = m_nodes[child];
+      target.fail = Step(m_nodes[node].fail, c);
+      const Node &fail = m_nodes[target.fail];
+      target.output = (fail.firstPattern >= 0) ? target.fail : fail.output;
+      queue.push_back(child);
+    }
+  }
+}
+
+template <typename CharT> void BasicPatternMatcher<CharT>::Clear() {
+  m_rootNext.clear();
+  m_nodes.clear();
+  m_edgeChars.clear();
+  m_edgeTargets.clear();
+  m_patternLengths.clear();
+  m_nextPattern.clear();
+}
+
+template <typename CharT>
+int32_t BasicPatternMatcher<CharT>::Child(int32_t node, CharT c) const {
+  const Node &n = m_nodes[node];
+  if (n.edgeEnd - n.edgeBegin <= kLinearEdges) {
+    for (uint32_t e = n.edgeBegin; e < n.edgeEnd; ++e) {
+      if (m_edgeChars[e] == c) {
+        return m_edgeTargets[e];
+      }
+    }
+    return -1;
+  }
+  const CharT *begin = m_edgeChars.data() + n.edgeBegin;
+  const CharT *end = m_edgeChars.data() + n.edgeEnd;
+  const CharT *it = std::lower_bound(begin, end, c);
+  if (it == end || *it != c) {
+    return -1;
+  }
+  return m_edgeTargets[n.edgeBegin + (it - begin)];
+}
+
+template <typename CharT>
+int32_t BasicPatternMatcher<CharT>::RootNext(CharT c) const {
+  const size_t unit = UnitIndex(c);
+  if (unit < m_rootNext.size()) {
+    return m_rootNext[unit];
+  }
+  return std::max(Child(0, c), 0);
+}
+
+template <typename CharT>
+int32_t BasicPatternMatcher<CharT>::Step(int32_t node, CharT c) const {
+  while (node != 0) {
+    const int32_t next = Child(node, c);
+    if (next >= 0) {
+      return next;
+    }
+    node = m_nodes[node].fail;
+  }
+  return RootNext(c);
+}
+
+template <typename CharT>
+template <typename Fn>
+void BasicPatternMatcher<CharT>::Scan(View text, Fn &&onMatch) const {
+  if (m_nodes.size() <= 1) {
+    return;
+  }
+  int32_t node = 0;
+  for (size_t i = 0; i < text.size(); ++i) {
+    node = Step(node, text[i]);
+    int32_t state = node;
+    if (m_nodes[state].firstPattern < 0) {
+      state = m_nodes[state].output;
+    }
+    if (state < 0) {
+      continue;
+    }
+    // 次の単位が文字の途中なら、この位置で終わる出現はすべて文字を割る
+    if (i + 1 < text.size() && IsContinuation(text[i + 1])) {
+      continue;
+    }
+    for (; state >= 0; state = m_nodes[state].output) {
+      for (int32_t p = m_nodes[state].firstPattern; p >= 0;
+           p = m_nextPattern[p]) {
+        onMatch(i + 1 - m_patternLengths[p], static_cast<uint32_t>(p));
+      }
+    }
+  }
+}
+
+template <typename CharT>
+void BasicPatternMatcher<CharT>::FindAll(View text,
+                                         std::vector<PatternMatch> &out) const {
+  Scan(text, [&](size_t position, uint32_t pattern) {
+    out.push_back({position, m_patternLengths[pattern], pattern});
+  });
+}
+
+template <typename CharT>
+void BasicPatternMatcher<CharT>::FindPresent(View text,
+                                             std::vector<bool> &present) const {
+  present.assign(m_patternLengths.size(), false);
+  Scan(text, [&](size_t, uint32_t pattern) { present[pattern] = true; });
+}
+
+template class BasicPatternMatcher<char>;
+template class BasicPatternMatcher<wchar_t>;
+
+} // namespace core
@@ -0,0 +1,89 @@
+#pragma once
+/**
+ * @file PatternMatcher.h
+ * @brief 複数の文字列を1回の走査で探す Aho–Corasick オートマトン
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace core {
+
+/// @brief 1つの出現
+struct PatternMatch {
+  size_t position;  ///< 本文中の開始位置（コード単位）
+  uint32_t length;  ///< 長さ（コード単位）
+  uint32_t pattern; ///< Build に渡した順の番号
+};
+
+/// @brief 複数パターンの一括検索
+/// @details Build で全パターンのトライと失敗リンクを1度だけ作り、
+///          FindAll は本文を先頭から1度なめるだけで、すべてのパターンの
+///          すべての出現（重なりや同じパターンの重複も含む）を返す。
+///          std::basic_string::find をパターンごと・出現ごとに
+///          繰り返した場合と同じ集合になる。
+///          比較はコード単位（UTF-8 のバイト、UTF-16 の 16 ビット値）で
+///          行うが、マルチバイト文字・サロゲートペアの途中から始まる
+///          出現は捨てるので、文字の境界にそろった出現だけが返る。
+///          空のパターンはどこにも一致しない。
+template <typename CharT> class BasicPatternMatcher {
+public:
+  using View = std::basic_string_view<CharT>;
+
+  /// @brief パターンからオートマトンを作る（以前の内容は捨てる）
+  void Build(const std::vector<View> &patterns);
+
+  void Clear();
+
+  size_t GetPatternCount() const { return m_patternLengths.size(); }
+
+  /// @brief すべての出現を、出現の終わりの位置順に out へ追加する
+  /// @details 終わりが同じ出現は長い順。
+  void FindAll(View text, std::vector<PatternMatch> &out) const;
+
+  /// @brief パターンごとに、本文に1度でも現れるかを求める
+  /// @param present GetPatternCount() 要素に作り直される
+  void FindPresent(View text, std::vector<bool> &present) const;
+
+private:
+  /// @brief 状態 node で文字 c を読んだ遷移先（なければ -1）
+  int32_t Child(int32_t node, CharT c) const;
+
+  /// @brief 根で文字 c を読んだ遷移先（なければ根）
+  int32_t RootNext(CharT c) const;
+
+  /// @brief 失敗リンクをたどって次の状態を求める
+  int32_t Step(int32_t node, CharT c) const;
+
+  template <typename Fn> void Scan(View text, Fn &&onMatch) const;
+
+  struct Node {
+    uint32_t edgeBegin = 0;    ///< m_edgeChars / m_edgeTargets の範囲
+    uint32_t edgeEnd = 0;
+    int32_t fail = 0;          ///< 最長の真の接尾辞にあたる状態
+    int32_t output = -1;       ///< 接尾辞で、パターンが終わる最も近い状態
+    int32_t firstPattern = -1; ///< この状態で終わるパターン（連結リスト）
+  };
+
+  /// 根からの遷移をコード単位で直接引く表（0 は遷移なし）。
+  /// 記事の大半の文字はどのパターンの先頭でもないので、根にいる間は
+  /// 1回の表引きで読み飛ばせる
+  std::vector<int32_t> m_rootNext;
+
+  std::vector<Node> m_nodes;      ///< [0] が根
+  std::vector<CharT> m_edgeChars; ///< 状態ごとに文字の昇順
+  std::vector<int32_t> m_edgeTargets;
+  std::vector<uint32_t> m_patternLengths;
+  std::vector<int32_t> m_nextPattern; ///< 同じ状態で終わる次のパターン
+};
+
+using PatternMatcher = BasicPatternMatcher<char>;     ///< UTF-8
+using WPatternMatcher = BasicPatternMatcher<wchar_t>; ///< UTF-16
+
+extern template class BasicPatternMatcher<char>;
+extern template class BasicPatternMatcher<wchar_t>;
+
+} // namespace core
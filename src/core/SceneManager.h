@@ -4,8 +4,11 @@
  * @brief シーン管理（スタック方式）
  */
 
+#include "../resources/ResourceManager.h"
+#include "GameContext.h"
 #include "Logger.h"
 #include "Scene.h"
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -35,11 +38,17 @@ public:
     return m_sceneStack.empty() ? nullptr : m_sceneStack.back().get();
   }
 
+  /// @brief 1フレームで非同期ロードの GPU 転送に使う時間
+  static constexpr double kAsyncUploadBudgetMs = 2.0;
+
   /// @brief フレーム更新（遷移処理とOnUpdate呼び出し）
   void Update(GameContext &ctx) {
     // 遷移リクエストを処理
     ProcessPendingOp(ctx);
 
+    // 非同期ロードの仕上げ（完了通知もここから呼ばれる）
+    ctx.resource.Update(kAsyncUploadBudgetMs);
+
     // 現在のシーンを更新
     if (auto *scene = Current()) {
       scene->OnUpdate(ctx);
@@ -49,15 +58,35 @@ public:
   /// @brief シーンスタックが空か
   bool IsEmpty() const { return m_sceneStack.empty(); }
 
+  /// @brief 直前の OnEnter にかかった時間（そのフレームが止まった時間）
+  double GetLastEnterMs() const { return m_lastEnterMs; }
+
 private:
   enum class Op { None, Push, Pop, Change };
 
+  /// @brief OnEnter を呼び、かかった時間と同期ロードの内訳を記録する
+  void EnterScene(Scene &scene, GameContext &ctx) {
+    using Clock = std::chrono::steady_clock;
+    const resources::ResourceLoadStats before = ctx.resource.GetLoadStats();
+    const Clock::time_point start = Clock::now();
+    scene.OnEnter(ctx);
+    m_lastEnterMs =
+        std::chrono::duration<double, std::milli>(Clock::now() - start)
+            .count();
+    const resources::ResourceLoadStats after = ctx.resource.GetLoadStats();
+    LOG_INFO("SceneManager",
+             "Entered {} in {:.1f} ms (sync loads: {} / {:.1f} ms, "
+             "async pending: {})",
+             scene.GetName(), m_lastEnterMs, after.syncLoads - before.syncLoads,
+             after.syncMs - before.syncMs, after.asyncPending);
+  }
+
   void ProcessPendingOp(GameContext &ctx) {
     switch (m_pendingOp) {
     case Op::Push:
       if (m_pendingScene) {
         LOG_INFO("SceneManager", "Push: {}", m_pendingScene->GetName());
-        m_pendingScene->OnEnter(ctx);
+        EnterScene(*m_pendingScene, ctx);
         m_sceneStack.push_back(std::move(m_pendingScene));
       }
       break;
@@ -78,7 +107,7 @@ private:
           m_sceneStack.pop_back();
         }
         LOG_INFO("SceneManager", "Change to: {}", m_pendingScene->GetName());
-        m_pendingScene->OnEnter(ctx);
+        EnterScene(*m_pendingScene, ctx);
         m_sceneStack.push_back(std::move(m_pendingScene));
       }
       break;
@@ -93,6 +122,7 @@ private:
   std::vector<std::unique_ptr<Scene>> m_sceneStack;
   Op m_pendingOp = Op::None;
   std::unique_ptr<Scene> m_pendingScene;
+  double m_lastEnterMs = 0.0;
 };
 
 } // namespace core
@@ -0,0 +1,121 @@
+/**
+ * @file ThreadPool.cpp
+ * @brief 汎用ワーカープールの実装
+ */
+
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace core {
+
+ThreadPool::ThreadPool(size_t workerCount) {
+  if (workerCount == 0) {
+    const unsigned hw = std::thread::hardware_concurrency();
+    workerCount = (hw > 1) ? static_cast<size_t>(hw - 1) : 1;
+  }
+  m_workers.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; ++i) {
+    m_workers.emplace_back([this]() { WorkerLoop(); });
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stopping = true;
+  }
+  m_cv.notify_all();
+  for (auto &worker : m_workers) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+ThreadPool &ThreadPool::Shared() {
+  static ThreadPool pool;
+  return pool;
+}
+
+void ThreadPool::Enqueue(std::function<void()> job) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.push_back(std::move(job));
+  }
+  m_cv.notify_one();
+}
+
+void ThreadPool::WorkerLoop() {
+  for (;;) {
+    std::function<void()> job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_cv.wait(lock, [this]() { return m_stopping || !m_queue.empty(); });
+      if (m_stopping && m_queue.empty()) {
+        return;
+      }
+      job = std::move(m_queue.front());
+      m_queue.pop_front();
+    }
+    job();
+  }
+}
+
+void ThreadPool::ParallelFor(size_t count, size_t grainSize,
+                             const std::function<void(size_t, size_t)> &fn) {
+  if (count == 0) {
+    return;
+  }
+
+  const size_t concurrency = GetConcurrency();
+  if (grainSize == 0) {
+    // スレッドあたり4チャンク程度に分けて負荷の偏りを吸収する
+    grainSize = std::max<size_t>(1, count / (concurrency * 4));
+  }
+  const size_t chunkCount = (count + grainSize - 1) / grainSize;
+  if (chunkCount <= 1 || m_workers.empty()) {
+    fn(0, count);
+    return;
+  }
+
+  // 遅れて起動したヘルパーが参照しても安全なよう共有状態にする
+  struct Job {
+    std::atomic<size_t> next{0};
+    std::atomic<size_t> done{0};
+    std::mutex mutex;
+    std::condition_variable cv;
+  };
+  auto job = std::make_shared<Job>();
+
+  auto runChunks = [job, count, grainSize, chunkCount, &fn]() {
+    for (;;) {
+      const size_t chunk = job->next.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= chunkCount) {
+        return;
+      }
+      const size_t begin = chunk * grainSize;
+      const size_t end = std::min(begin + grainSize, count);
+      fn(begin, end);
+      if (job->done.fetch_add(1, std::memory_order_acq_rel) + 1 ==
+          chunkCount) {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->cv.notify_all();
+      }
+    }
+  };
+
+  // fn は呼び出し元のスタックにあるため、全チャンク完了まで必ず待つ。
+  // 完了後に起動したヘルパーは next が上限を超えているので fn に触れない。
+  const size_t helpers = std::min(m_workers.size(), chunkCount - 1);
+  for (size_t i = 0; i < helpers; ++i) {
+    Enqueue(runChunks);
+  }
+  runChunks();
+
+  std::unique_lock<std::mutex> lock(job->mutex);
+  job->cv.wait(lock, [&job, chunkCount]() {
+    return job->done.load(std::memory_order_acquire) == chunkCount;
+  });
+}
+
+} // namespace core
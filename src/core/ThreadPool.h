@@ -0,0 +1,74 @@
+#pragma once
+/**
+ * @file ThreadPool.h
+ * @brief 汎用ワーカープール（ParallelFor / 非同期タスク）
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace core {
+
+/// @brief 固定数のワーカースレッドを持つタスクプール
+/// @details ParallelFor は呼び出しスレッドも処理に参加するため、
+///          ワーカー内から入れ子で呼んでもデッドロックしない。
+///          チャンクの割り当て順は不定なので、決定的な結果が必要な処理は
+///          「インデックスごとに出力先が決まる」形で書くこと。
+class ThreadPool {
+public:
+  /// @brief コンストラクタ
+  /// @param workerCount ワーカー数（0なら hardware_concurrency - 1）
+  explicit ThreadPool(size_t workerCount = 0);
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  /// @brief プロセス共通のプールを取得
+  static ThreadPool &Shared();
+
+  /// @brief ワーカー数（呼び出しスレッドは含まない）
+  size_t GetWorkerCount() const { return m_workers.size(); }
+
+  /// @brief 並列に処理できるスレッド数（ワーカー＋呼び出し元）
+  size_t GetConcurrency() const { return m_workers.size() + 1; }
+
+  /// @brief [0, count) を grainSize 単位のチャンクに分けて並列実行する
+  /// @param count 要素数
+  /// @param grainSize 1チャンクあたりの要素数（0なら自動）
+  /// @param fn fn(begin, end) を各チャンクで呼ぶ
+  void ParallelFor(size_t count, size_t grainSize,
+                   const std::function<void(size_t, size_t)> &fn);
+
+  /// @brief タスクを投入し、結果の future を返す
+  template <typename F>
+  auto Submit(F &&fn) -> std::future<std::invoke_result_t<std::decay_t<F>>> {
+    using R = std::invoke_result_t<std::decay_t<F>>;
+    auto task =
+        std::make_shared<std::packaged_task<R()>>(std::forward<F>(fn));
+    std::future<R> result = task->get_future();
+    Enqueue([task]() { (*task)(); });
+    return result;
+  }
+
+private:
+  void Enqueue(std::function<void()> job);
+  void WorkerLoop();
+
+  std::vector<std::thread> m_workers;
+  std::deque<std::function<void()>> m_queue;
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  bool m_stopping = false;
+};
+
+} // namespace core
@@ -0,0 +1,36 @@
+#pragma once
+/**
+ * @file ArticleText.h
+ * @brief 床に SDF グリフで描く記事の文字
+ */
+
+#include "../../graphics/SdfArticleText.h"
+#include <d3d11.h>
+#include <memory>
+#include <wrl/client.h>
+
+namespace game::components {
+
+/**
+ * @brief 記事の文字コンポーネント
+ *
+ * 文字の四角形は地形の高さテクスチャを引いて床に沿わせる
+ */
+struct ArticleText {
+  /// @brief グリフの四角形とアトラス
+  std::shared_ptr<graphics::SdfArticleText> text;
+
+  /// @brief 地形の高さ（R32_FLOAT、resX x resZ）
+  Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> heightSRV;
+  int heightResX = 0;
+  int heightResZ = 0;
+
+  /// @brief フィールドのワールド寸法（記事全体がここに収まる）
+  float fieldWidth = 0.0f;
+  float fieldDepth = 0.0f;
+
+  /// @brief 描画の有効/無効
+  bool isVisible = true;
+};
+
+} // namespace game::components
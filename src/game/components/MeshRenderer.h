@@ -14,6 +14,8 @@ struct MeshRenderer {
   resources::MeshHandle mesh;
   resources::ShaderHandle shader;
   bool isVisible = true;
+  // isVisible が false でもミニマップには描く（視錐台外の地形チャンク）
+  bool showOnMinimap = false;
   DirectX::XMFLOAT4 color = {1.0f, 1.0f, 1.0f, 1.0f}; // マテリアルカラー
 
   // テクスチャ（オプション）
@@ -22,6 +24,16 @@ struct MeshRenderer {
   Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> normalMapSRV;
   bool hasNormalMap = false;
 
+  // 仮想テクスチャ（オプション）。textureSRV には低解像度版を入れる
+  Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> virtualAtlasSRV; // t2
+  Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> pageTableSRV;    // t3
+  // x, y: 大きさ（タイル単位）, z: 有効なら 1
+  DirectX::XMFLOAT4 virtualTexture = {0, 0, 0, 0};
+
+  // ミニマップでは textureSRV の代わりにこれを貼る（SDF 文字の地形は
+  // 文字を別の四角形で描くので、文字入りの低解像度版をここに入れる）
+  Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> minimapSRV;
+
   // 追加フラグ（シェーダー用）
   DirectX::XMFLOAT4 customFlags = {0, 0, 0, 0};
   bool isTransparent = false;
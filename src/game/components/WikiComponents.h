@@ -5,6 +5,7 @@
  */
 
 #include "../systems/TerrainGenerator.h"
+#include "../systems/TerrainSampler.h"
 #include "../systems/WikiClient.h"
 #include "../systems/WikiShortestPath.h"
 #include <DirectXMath.h>
@@ -22,6 +23,8 @@ namespace game::components {
  */
 struct TerrainCollider {
   std::shared_ptr<game::systems::TerrainData> data;
+  /// 高さ・法線・マテリアルの標本化（WikiTerrainSystem と共有）
+  std::shared_ptr<const game::systems::TerrainSampler> sampler;
 };
 
 /**
@@ -8,6 +8,7 @@
 #include "../../core/Input.h"
 #include "../../core/Logger.h"
 #include "../../core/SceneManager.h"
+#include "../../core/ThreadPool.h"
 #include "../components/Camera.h"
 #include "../components/MeshRenderer.h"
 #include "../components/Transform.h"
@@ -31,6 +32,22 @@ void LoadingScene::OnEnter(core::GameContext &ctx) {
   LOG_INFO("LoadingScene", "OnEnter");
 
   m_balls.clear();
+  {
+    const float renderRadius = BALL_RADIUS * BALL_MODEL_SCALE;
+    systems::BallSwarmConfig swarmConfig;
+    swarmConfig.radius = renderRadius;
+    swarmConfig.gravity = GRAVITY;
+    swarmConfig.restitution = RESTITUTION;
+    swarmConfig.floorFriction = FRICTION;
+    swarmConfig.airDrag = AIR_DRAG;
+    swarmConfig.floorY = FLOOR_Y + 0.3f + renderRadius;
+    swarmConfig.wallX = ARENA_HALF_WIDTH - renderRadius;
+    swarmConfig.wallZ = ARENA_HALF_DEPTH - renderRadius;
+    swarmConfig.settleThreshold = SETTLE_THRESHOLD;
+    swarmConfig.subSteps = 8;
+    m_swarm.SetConfig(swarmConfig);
+    m_swarm.Clear();
+  }
   m_spawnedCount = 0;
   m_spawnTimer = 0.0f;
   m_fadeAlpha = 0.0f;
@@ -168,8 +185,8 @@ void LoadingScene::OnEnter(core::GameContext &ctx) {
   // マウスカーソルを非表示
   ctx.input.SetMouseCursorVisible(false);
 
-  // ゴルフボールメッシュをロード
-  m_ballMeshHandle = ctx.resource.LoadMesh("Assets/models/golfball.fbx");
+  // ゴルフボールメッシュをロード（Assimp での読み込みはワーカー）
+  m_ballMeshHandle = ctx.resource.LoadMeshAsync("Assets/models/golfball.fbx");
 
   // カメラを作成
   m_cameraEntity = CreateEntity(ctx.world);
@@ -368,194 +385,71 @@ void LoadingScene::SpawnBall(core::GameContext &ctx) {
   mr.normalMapSRV = ctx.resource.LoadTextureSRV("Assets/models/golfball_n.png");
   mr.hasNormalMap = static_cast<bool>(mr.normalMapSRV);
 
-  // ボール状態を記録
+  // ボール状態を記録（m_balls と m_swarm のインデックスは一致させる）
   BallState ball{};
   ball.entity = entity;
-  ball.velocity = {distVelX(rng), -16.0f, distVelZ(rng)};
   ball.angularVelocity = {spinDist(rng) * 0.8f, spinDist(rng),
                           spinDist(rng) * 0.6f};
-  ball.settled = false;
   m_balls.push_back(ball);
+  const float velX = distVelX(rng);
+  const float velZ = distVelZ(rng);
+  m_swarm.AddBall(tr.position.x, tr.position.y, tr.position.z, velX, -16.0f,
+                  velZ);
 
   m_spawnedCount++;
 }
 
 void LoadingScene::UpdatePhysics(core::GameContext &ctx, float dt) {
-  const float renderRadius = BALL_RADIUS * BALL_MODEL_SCALE;
-  const float floorY = FLOOR_Y + 0.3f + renderRadius;
-  const float wallX = ARENA_HALF_WIDTH - renderRadius;
-  const float wallZ = ARENA_HALF_DEPTH - renderRadius;
-
-  // サブステップ数（貫通防止のため分割実行）
-  const int subSteps = 8;
-  const float subDt = dt / subSteps;
-
-  for (int step = 0; step < subSteps; ++step) {
-    for (auto &ball : m_balls) {
-      if (!ctx.world.IsAlive(ball.entity) || ball.settled) {
-        continue;
-      }
-
-      auto *tr = ctx.world.Get<components::Transform>(ball.entity);
-      if (!tr)
-        continue;
-
-      // 重力を適用
-      ball.velocity.y += GRAVITY * subDt;
-
-      // 空気抵抗
-      float subDrag = std::pow(AIR_DRAG, subDt * 60.0f);
-      ball.velocity.x *= subDrag;
-      ball.velocity.z *= subDrag;
-
-      // 位置を更新
-      tr->position.x += ball.velocity.x * subDt;
-      tr->position.y += ball.velocity.y * subDt;
-      tr->position.z += ball.velocity.z * subDt;
-
-      // 回転を更新
-      DirectX::XMVECTOR currentRot = DirectX::XMLoadFloat4(&tr->rotation);
-      DirectX::XMVECTOR deltaRot = DirectX::XMQuaternionRotationRollPitchYaw(
-          ball.angularVelocity.x * subDt, ball.angularVelocity.y * subDt,
-          ball.angularVelocity.z * subDt);
-      auto nextRot = DirectX::XMQuaternionNormalize(
-          DirectX::XMQuaternionMultiply(deltaRot, currentRot));
-      DirectX::XMStoreFloat4(&tr->rotation, nextRot);
-      float subAngDrag = std::pow(ANGULAR_DAMPING, subDt * 60.0f);
-      ball.angularVelocity.x *= subAngDrag;
-      ball.angularVelocity.y *= subAngDrag;
-      ball.angularVelocity.z *= subAngDrag;
-
-      // 床との衝突
-      if (tr->position.y < floorY) {
-        tr->position.y = floorY;
-        if (ball.velocity.y < -0.5f) {
-          ball.velocity.y = -ball.velocity.y * RESTITUTION;
-        } else {
-          ball.velocity.y = 0.0f;
-        }
-        const float subFriction = std::pow(FRICTION, subDt * 60.0f);
-        ball.velocity.x *= subFriction;
-        ball.velocity.z *= subFriction;
-      }
-
-      // 壁との衝突
-      const float wallMinX = -wallX, wallMaxX = wallX;
-      const float wallMinZ = -wallZ, wallMaxZ = wallZ;
-      if (tr->position.x < wallMinX) {
-        tr->position.x = wallMinX;
-        ball.velocity.x = -ball.velocity.x * RESTITUTION;
-      } else if (tr->position.x > wallMaxX) {
-        tr->position.x = wallMaxX;
-        ball.velocity.x = -ball.velocity.x * RESTITUTION;
-      }
-      if (tr->position.z < wallMinZ) {
-        tr->position.z = wallMinZ;
-        ball.velocity.z = -ball.velocity.z * RESTITUTION;
-      } else if (tr->position.z > wallMaxZ) {
-        tr->position.z = wallMaxZ;
-        ball.velocity.z = -ball.velocity.z * RESTITUTION;
-      }
-    }
-  }
+  // 並進・床/壁・ボール同士の衝突はサブステップ込みで BallSwarm が解く
+  m_swarm.Step(dt, &core::ThreadPool::Shared());
 
-  // ボール同士の衝突 (N^2だがサブステップ化で安定)
-  for (size_t i = 0; i < m_balls.size(); i++) {
+  const float angDrag = std::pow(ANGULAR_DAMPING, dt * 60.0f);
+  for (size_t i = 0; i < m_balls.size(); ++i) {
     auto &ball = m_balls[i];
-    if (!ctx.world.IsAlive(ball.entity))
+    if (!ctx.world.IsAlive(ball.entity)) {
       continue;
+    }
     auto *tr = ctx.world.Get<components::Transform>(ball.entity);
-    if (!tr)
+    if (!tr) {
       continue;
-
-    for (size_t j = i + 1; j < m_balls.size(); j++) {
-      auto &other = m_balls[j];
-      if (!ctx.world.IsAlive(other.entity) || (ball.settled && other.settled))
-        continue;
-
-      auto *otherTr = ctx.world.Get<components::Transform>(other.entity);
-      if (!otherTr)
-        continue;
-
-      float dx = otherTr->position.x - tr->position.x;
-      float dy = otherTr->position.y - tr->position.y;
-      float dz = otherTr->position.z - tr->position.z;
-      float distSq = dx * dx + dy * dy + dz * dz;
-      float minDist = renderRadius * 2.0f;
-
-      if (distSq < minDist * minDist && distSq > 0.0001f) {
-        float dist = std::sqrt(distSq);
-        float overlap = (minDist - dist);
-        float nx = dx / dist, ny = dy / dist, nz = dz / dist;
-
-        float p1 = ball.settled ? 0.0f : (other.settled ? 1.0f : 0.5f);
-        float p2 = 1.0f - p1;
-
-        tr->position.x -= nx * overlap * p1;
-        tr->position.y -= ny * overlap * p1;
-        tr->position.z -= nz * overlap * p1;
-        otherTr->position.x += nx * overlap * p2;
-        otherTr->position.y += ny * overlap * p2;
-        otherTr->position.z += nz * overlap * p2;
-
-        float rvx = other.velocity.x - ball.velocity.x;
-        float rvy = other.velocity.y - ball.velocity.y;
-        float rvz = other.velocity.z - ball.velocity.z;
-        float velAlongNormal = rvx * nx + rvy * ny + rvz * nz;
-
-        if (velAlongNormal < 0) {
-          float jVal = -(1 + RESTITUTION) * velAlongNormal * 0.5f;
-          float ix = nx * jVal, iy = ny * jVal, iz = nz * jVal;
-          if (!ball.settled) {
-            ball.velocity.x -= ix; ball.velocity.y -= iy; ball.velocity.z -= iz;
-          }
-          if (!other.settled) {
-            other.velocity.x += ix; other.velocity.y += iy; other.velocity.z += iz;
-          }
-          if (jVal > 0.5f) { ball.settled = other.settled = false; }
-        }
-      }
     }
 
-    float speedSq = ball.velocity.x * ball.velocity.x + ball.velocity.y * ball.velocity.y + ball.velocity.z * ball.velocity.z;
-    if (speedSq < SETTLE_THRESHOLD * SETTLE_THRESHOLD * 0.5f && tr->position.y <= floorY + 0.1f) {
-      ball.settled = true;
-      ball.velocity = {0,0,0}; ball.angularVelocity = {0,0,0};
-    } else {
-      ball.settled = false;
+    tr->position = {m_swarm.GetX(i), m_swarm.GetY(i), m_swarm.GetZ(i)};
+
+    if (m_swarm.IsSettled(i)) {
+      ball.angularVelocity = {0.0f, 0.0f, 0.0f};
+      continue;
     }
+
+    // 回転を更新
+    DirectX::XMVECTOR currentRot = DirectX::XMLoadFloat4(&tr->rotation);
+    DirectX::XMVECTOR deltaRot = DirectX::XMQuaternionRotationRollPitchYaw(
+        ball.angularVelocity.x * dt, ball.angularVelocity.y * dt,
+        ball.angularVelocity.z * dt);
+    auto nextRot = DirectX::XMQuaternionNormalize(
+        DirectX::XMQuaternionMultiply(deltaRot, currentRot));
+    DirectX::XMStoreFloat4(&tr->rotation, nextRot);
+    ball.angularVelocity.x *= angDrag;
+    ball.angularVelocity.y *= angDrag;
+    ball.angularVelocity.z *= angDrag;
   }
 
   // ログ用メトリクス
-  int settledCount = 0;
-  int moving = 0;
-  float maxSpeed = 0.0f, speedAccum = 0.0f;
-  int speedCount = 0;
-  m_hasMovingSample = false;
-  for (const auto &ball : m_balls) {
-    if (!ctx.world.IsAlive(ball.entity)) continue;
-    if (ball.settled) settledCount++;
-    else {
-      moving++;
-      float speed = std::sqrt(ball.velocity.x * ball.velocity.x + ball.velocity.y * ball.velocity.y + ball.velocity.z * ball.velocity.z);
-      maxSpeed = std::max(maxSpeed, speed);
-      speedAccum += speed;
-      speedCount++;
-      if (!m_hasMovingSample) {
-        if (auto *tr = ctx.world.Get<components::Transform>(ball.entity)) {
-            m_lastMovingPos = tr->position;
-            m_hasMovingSample = true;
-        }
-      }
-    }
+  const auto &stats = m_swarm.GetStats();
+  m_movingCount = stats.movingCount;
+  m_maxSpeed = stats.maxSpeed;
+  m_avgSpeed = stats.avgSpeed;
+  m_settledCount = stats.settledCount;
+  m_hasMovingSample = stats.hasMovingSample;
+  if (m_hasMovingSample) {
+    m_lastMovingPos = {stats.samplePos[0], stats.samplePos[1],
+                       stats.samplePos[2]};
   }
-  m_movingCount = moving; m_maxSpeed = maxSpeed; m_settledCount = settledCount;
-  m_avgSpeed = (speedCount > 0) ? speedAccum / speedCount : 0.0f;
 }
 
 bool LoadingScene::AreAllBallsSettled() {
   if (m_spawnedCount < TOTAL_BALLS) return false;
-  for (const auto &ball : m_balls) { if (!ball.settled) return false; }
+  for (size_t i = 0; i < m_swarm.GetCount(); ++i) { if (!m_swarm.IsSettled(i)) return false; }
   if (!m_allSettledLogged) { LOG_INFO("LoadingScene", "All balls settled"); m_allSettledLogged = true; }
   return true;
 }
@@ -794,6 +688,7 @@ void LoadingScene::OnExit(core::GameContext &ctx) {
   LOG_INFO("LoadingScene", "OnExit");
 
   m_balls.clear();
+  m_swarm.Clear();
   m_wallEntities.clear();
 
   // 基底クラスのクリーンアップ（全エンティティ破棄）
@@ -9,6 +9,7 @@
 #include "../../graphics/TextStyle.h"
 #include "../../resources/ResourceManager.h"
 #include "../components/WikiComponents.h"
+#include "../systems/BallSwarm.h"
 #include <DirectXMath.h>
 #include <atomic>
 #include <functional>
@@ -39,12 +40,11 @@ public:
   void OnExit(core::GameContext &ctx) override;
 
 private:
-  /// @brief ゴルフボールの状態
+  /// @brief ゴルフボールの描画側の状態
+  /// @note 位置・速度・静止判定は m_swarm の同じインデックスが持つ
   struct BallState {
     ecs::Entity entity;
-    DirectX::XMFLOAT3 velocity;
     DirectX::XMFLOAT3 angularVelocity;
-    bool settled; ///< 静止したかどうか
   };
 
   /// @brief ゴルフボールをスポーンする
@@ -76,6 +76,7 @@ private:
 
   // ボール関連
   std::vector<BallState> m_balls;
+  systems::BallSwarm m_swarm; ///< 並進と衝突（空間ハッシュ＋並列解法）
   resources::MeshHandle m_ballMeshHandle;
   int m_spawnedCount = 0;
   float m_spawnTimer = 0.0f;
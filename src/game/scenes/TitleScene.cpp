@@ -47,8 +47,9 @@ void TitleScene::OnEnter(core::GameContext &ctx) {
   // --- リソースロード ---
   auto basicShader = ctx.resource.LoadShader(
       "Basic", L"Assets/shaders/BasicVS.hlsl", L"Assets/shaders/BasicPS.hlsl");
-  auto ballMesh = ctx.resource.LoadMesh("Assets/models/golfball.fbx");
-  auto clubMesh = ctx.resource.LoadMesh("Assets/models/golf_club.fbx");
+  // FBX の読み込みはワーカーで行い、届くまでクラブは描かれない
+  auto ballMesh = ctx.resource.LoadMeshAsync("Assets/models/golfball.fbx");
+  auto clubMesh = ctx.resource.LoadMeshAsync("Assets/models/golf_club.fbx");
   auto cubeMesh = ctx.resource.LoadMesh("builtin/cube");
   auto sphereMesh = ctx.resource.LoadMesh("builtin/sphere");
   auto planeMesh = ctx.resource.LoadMesh("builtin/plane");
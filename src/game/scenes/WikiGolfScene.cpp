@@ -3,6 +3,7 @@
 #include "../../core/GameContext.h"
 #include "../../core/Input.h"
 #include "../../core/Logger.h"
+#include "../../core/PatternMatcher.h"
 #include "../../core/SceneManager.h"
 #include "../../core/StringUtils.h"
 #include "../../ecs/World.h"
@@ -25,10 +26,13 @@
 #include "TitleScene.h"
 #include <DirectXMath.h>
 #include <algorithm>
+#include <chrono>
 #include <cmath>
 #include <filesystem>
 #include <fstream>
 #include <map>
+#include <string_view>
+#include <unordered_set>
 
 // Windowsマクロ対策
 #undef min
@@ -41,6 +45,8 @@ using namespace game::components;
 
 namespace {
 constexpr float kFieldScale = 4.0f;
+/// 生成中の地形に1フレームで使ってよい時間
+constexpr double kTerrainBudgetMs = 4.0;
 } // namespace
 
 WikiGolfScene::~WikiGolfScene() = default;
@@ -1102,7 +1108,27 @@ bool WikiGolfScene::CheckCameraCollision(core::GameContext &ctx,
     outPos = targetPos;
   }
 
-  // 2. 地形による高さ制限
+  // 2. 地形による遮蔽
+  // 注視点（ボールの少し上）からカメラへ球を飛ばし、丘に触れる手前で止める
+  if (m_terrainSystem) {
+    constexpr float kCameraRadius = 0.3f;
+    XMVECTOR focus = XMVectorAdd(lookAtPos, XMVectorSet(0, 0.5f, 0, 0));
+    XMVECTOR toCam = XMVectorSubtract(outPos, focus);
+    float camDist = XMVectorGetX(XMVector3Length(toCam));
+    XMFLOAT3 from, dir;
+    XMStoreFloat3(&from, focus);
+    XMStoreFloat3(&dir, toCam);
+    game::systems::TerrainRayHit hit;
+    if (camDist > 0.01f &&
+        m_terrainSystem->SphereCast(from, dir, kCameraRadius, camDist, hit) &&
+        hit.distance > 0.0f) {
+      outPos = XMVectorAdd(
+          focus, XMVectorScale(toCam, hit.distance / camDist));
+      collided = true;
+    }
+  }
+
+  // 3. 地形による高さ制限
   // 補正後の位置でチェック
   if (m_terrainSystem) {
     float camX = XMVectorGetX(outPos);
@@ -1601,6 +1627,24 @@ void WikiGolfScene::OnUpdate(core::GameContext &ctx) {
     UpdateCamera(ctx);
   }
 
+  // 生成中の地形を進め、本番に替わったらホールとボールを地面に合わせる
+  if (m_terrainSystem &&
+      m_terrainSystem->UpdateGeneration(ctx, kTerrainBudgetMs)) {
+    SnapToTerrain(ctx);
+  }
+
+  // 地形チャンクの LOD を現在のカメラに合わせる
+  if (m_terrainSystem) {
+    auto *camT = ctx.world.Get<Transform>(m_cameraEntity);
+    auto *cam = ctx.world.Get<Camera>(m_cameraEntity);
+    if (camT && cam) {
+      XMMATRIX viewProj =
+          cam->GetViewMatrix(*camT) * cam->GetProjectionMatrix();
+      m_terrainSystem->UpdateLod(ctx, camT->position, viewProj, cam->fov,
+                                 (float)ctx.graphics.GetHeight());
+    }
+  }
+
   // ミニマップ更新
   UpdateMinimap(ctx);
 
@@ -1804,20 +1848,6 @@ void WikiGolfScene::UpdateTrajectory(core::GameContext &ctx, float powerRatio) {
   auto terrainData =
       m_terrainSystem ? m_terrainSystem->GetTerrainData() : nullptr;
 
-  // マテリアル取得ヘルパー
-  auto GetMaterial = [&](float x, float z) -> uint8_t {
-    if (!terrainData || terrainData->materialMap.empty())
-      return 0; // Default Fairway
-    float u = x / terrainData->config.worldWidth + 0.5f;
-    float v = 0.5f - z / terrainData->config.worldDepth;
-    int ix = (int)(u * (terrainData->config.resolutionX - 1));
-    int iz = (int)(v * (terrainData->config.resolutionZ - 1));
-    if (ix < 0 || ix >= terrainData->config.resolutionX || iz < 0 ||
-        iz >= terrainData->config.resolutionZ)
-      return 0;
-    return terrainData->materialMap[iz * terrainData->config.resolutionX + ix];
-  };
-
   // 初期位置（ボール位置）
   XMVECTOR prevPos = pos;
   XMVECTOR angularVelocity = initialAngularVelocity;
@@ -1872,22 +1902,34 @@ void WikiGolfScene::UpdateTrajectory(core::GameContext &ctx, float powerRatio) {
     bool isGrounded = false;
     XMVECTOR groundNormal = XMVectorSet(0, 1, 0, 0);
 
+    uint8_t groundMaterial = 0;
+
     if (m_terrainSystem) {
-      XMVECTOR n;
-      float h; // dummy
-      float px = XMVectorGetX(currentPos);
-      float pz = XMVectorGetZ(currentPos);
-      // GetHeightは補間あり、GetNormalも必要だがここでは簡易的にY高さだけチェック
-      groundY = m_terrainSystem->GetHeight(px, pz);
-
-      // 法線取得（傾斜抵抗のため）
-      // 簡易差分法 (PhysicsSystemと同じロジックの一部)
-      float hX = m_terrainSystem->GetHeight(px + 0.1f, pz);
-      float hZ = m_terrainSystem->GetHeight(px, pz + 0.1f);
-      float gradX = (hX - groundY) / 0.1f;
-      float gradZ = (hZ - groundY) / 0.1f;
-      XMVECTOR slopeVec = XMVectorSet(-gradX, 1.0f, -gradZ, 0.0f);
-      groundNormal = XMVector3Normalize(slopeVec);
+      // 刻み幅が大きいので、移動区間をレイキャストして斜面の突き抜けを防ぐ
+      XMVECTOR stepVec = XMVectorSubtract(currentPos, prevPos);
+      float stepLen = XMVectorGetX(XMVector3Length(stepVec));
+      XMFLOAT3 from, dir;
+      XMStoreFloat3(&from, prevPos);
+      XMStoreFloat3(&dir, stepVec);
+      game::systems::TerrainRayHit hit;
+      bool hitGround = stepLen > 1e-4f &&
+                       m_terrainSystem->Raycast(from, dir, stepLen, hit);
+      if (hitGround) {
+        currentPos = XMVectorSet(hit.point.x, hit.point.y, hit.point.z, 0.0f);
+      }
+
+      // 高さ・法線・マテリアルは PhysicsSystem と同じサンプラーから取る
+      XMFLOAT3 normal;
+      m_terrainSystem->SamplePoint(XMVectorGetX(currentPos),
+                                   XMVectorGetZ(currentPos), groundY, normal,
+                                   groundMaterial);
+      groundNormal = XMLoadFloat3(&normal);
+
+      // レイが当たった場合は接触点と面の法線をそのまま使う
+      if (hitGround) {
+        groundY = hit.point.y;
+        groundNormal = XMLoadFloat3(&hit.normal);
+      }
     }
 
     if (XMVectorGetY(currentPos) <= groundY) {
@@ -1926,9 +1968,7 @@ void WikiGolfScene::UpdateTrajectory(core::GameContext &ctx, float powerRatio) {
       float terrainFriction = 1.0f;
 
       if (terrainData) {
-        uint8_t mat =
-            GetMaterial(XMVectorGetX(currentPos), XMVectorGetZ(currentPos));
-        switch (mat) {
+        switch (groundMaterial) {
         case 1:
           terrainFriction = 3.0f; // Rough
           break;
@@ -2373,17 +2413,28 @@ void WikiGolfScene::LoadPage(core::GameContext &ctx,
     return false;
   };
 
+  // 本文に含まれるかは、全リンク名をまとめて1回の走査で調べる
+  std::vector<std::string_view> linkTitles;
+  linkTitles.reserve(allLinks.size());
   for (const auto &link : allLinks) {
+    linkTitles.push_back(link.title);
+  }
+  core::PatternMatcher linkMatcher;
+  linkMatcher.Build(linkTitles);
+  std::vector<bool> inArticle;
+  linkMatcher.FindPresent(articleText, inArticle);
+
+  std::unordered_set<std::string> validTitles;
+  for (size_t i = 0; i < allLinks.size(); ++i) {
+    const auto &link = allLinks[i];
     if (isIgnored(link.title))
       continue;
 
     // 本文に含まれているかチェック
-    if (articleText.find(link.title) != std::string::npos) {
-      validLinks.push_back({link.title, core::ToWString(link.title)});
-    }
     // ターゲットページは必ず含める
-    else if (link.title == state->targetPage) {
+    if (inArticle[i] || link.title == state->targetPage) {
       validLinks.push_back({link.title, core::ToWString(link.title)});
+      validTitles.insert(link.title);
     }
 
     if (validLinks.size() >= 20)
@@ -2393,12 +2444,10 @@ void WikiGolfScene::LoadPage(core::GameContext &ctx,
   // リンク不足時の補充
   if (validLinks.size() < 3) {
     for (const auto &link : allLinks) {
-      bool exists = false;
-      for (const auto &v : validLinks)
-        if (v.first == link.title)
-          exists = true;
-      if (!exists && !isIgnored(link.title)) { // ここでもignoreチェック
+      if (!validTitles.count(link.title) &&
+          !isIgnored(link.title)) { // ここでもignoreチェック
         validLinks.push_back({link.title, core::ToWString(link.title)});
+        validTitles.insert(link.title);
         if (validLinks.size() >= 5)
           break;
       }
@@ -2454,10 +2503,37 @@ void WikiGolfScene::LoadPage(core::GameContext &ctx,
     linkPairs.push_back({link.second, link.first});
   }
 
-  // GenerateTexture呼び出し
-  auto texResult = m_textureGenerator->GenerateTexture(
-      core::ToWString(pageName), core::ToWString(articleText), linkPairs,
-      state->targetPage, texWidth, texHeight);
+  // 予算より大きい記事は低解像度版だけを描き、原寸は表示中のタイルだけを
+  // 地形の LOD 更新のたびに描く（長い記事でも常駐量が予算で頭打ちになる）
+  const auto texStart = std::chrono::steady_clock::now();
+  graphics::VirtualTextureConfig vtConfig;
+  graphics::WikiTextureResult texResult;
+  const uint64_t fullBytes =
+      static_cast<uint64_t>(texWidth) * texHeight * vtConfig.bytesPerPixel;
+  if (m_useSdfText) {
+    // 文字はアトラスを引く四角形で描く（記事の長さによらず常駐量が一定）
+    texResult = m_textureGenerator->GenerateSdfText(
+        core::ToWString(pageName), core::ToWString(articleText), linkPairs,
+        state->targetPage, texWidth, texHeight);
+  }
+  if (!texResult.sdfText && fullBytes > vtConfig.memoryBudget) {
+    texResult = m_textureGenerator->GenerateVirtualTexture(
+        core::ToWString(pageName), core::ToWString(articleText), linkPairs,
+        state->targetPage, texWidth, texHeight, vtConfig);
+  }
+  if (!texResult.sdfText && !texResult.srv) {
+    // 小さい記事、または仮想テクスチャを作れなければ1枚で描く
+    texResult = m_textureGenerator->GenerateTexture(
+        core::ToWString(pageName), core::ToWString(articleText), linkPairs,
+        state->targetPage, texWidth, texHeight);
+  }
+  LOG_INFO("WikiGolf", "Article texture ready in {:.1f} ms ({})",
+           std::chrono::duration<double, std::milli>(
+               std::chrono::steady_clock::now() - texStart)
+               .count(),
+           texResult.sdfText          ? "sdf"
+           : texResult.virtualTexture ? "virtual"
+                                      : "full");
 
   m_wikiTexture =
       std::make_unique<graphics::WikiTextureResult>(std::move(texResult));
@@ -2662,6 +2738,33 @@ void WikiGolfScene::CreateHole(core::GameContext &ctx, float x, float z,
             t.position.y, z, linkTarget, isTargetHole);
 }
 
+void WikiGolfScene::SnapToTerrain(core::GameContext &ctx) {
+  auto *state = ctx.world.GetGlobal<GolfGameState>();
+  if (state) {
+    for (auto holeEntity : state->holes) {
+      if (auto *t = ctx.world.Get<Transform>(holeEntity)) {
+        t->position.y =
+            m_terrainSystem->GetHeight(t->position.x, t->position.z) - 0.02f;
+      }
+    }
+  }
+
+  // 地面に埋まったボールだけ持ち上げる（空中のボールはそのまま）
+  auto *ballT = ctx.world.Get<Transform>(m_ballEntity);
+  auto *ballC = ctx.world.Get<Collider>(m_ballEntity);
+  if (ballT && ballC) {
+    const float ground =
+        m_terrainSystem->GetHeight(ballT->position.x, ballT->position.z) +
+        ballC->radius;
+    if (ballT->position.y < ground) {
+      ballT->position.y = ground;
+      if (auto *rb = ctx.world.Get<RigidBody>(m_ballEntity)) {
+        rb->velocity.y = std::max(rb->velocity.y, 0.0f);
+      }
+    }
+  }
+}
+
 void WikiGolfScene::CheckCupIn(core::GameContext &ctx) {
   auto *rb = ctx.world.Get<RigidBody>(m_ballEntity);
   auto *t = ctx.world.Get<Transform>(m_ballEntity);
@@ -52,6 +52,9 @@ private:
   void CreateHole(core::GameContext &ctx, float x, float z,
                   const std::string &linkTarget, bool isTargetHole);
 
+  /// @brief 地形が差し替わったあと、ホールとボールを地面の高さに合わせる
+  void SnapToTerrain(core::GameContext &ctx);
+
   /// @brief 記事テキスト背景UIセットアップ
   void SetupArticleBackground(core::GameContext &ctx);
 
@@ -145,6 +148,8 @@ private:
   // テクスチャ関連
   std::unique_ptr<graphics::WikiTextureGenerator> m_textureGenerator;
   std::unique_ptr<graphics::WikiTextureResult> m_wikiTexture;
+  /// 記事の文字を SDF グリフの四角形で床に描く（false ならテクスチャに焼く）
+  bool m_useSdfText = true;
 
   // 最短パス計算（SDOW）
   std::unique_ptr<game::systems::WikiShortestPath> m_shortestPath;
@@ -0,0 +1,252 @@
+/**
+ * @file ArticleTextRenderSystem.cpp
+ * @brief 記事の文字（SDF グリフ）描画システム実装
+ */
+
+#include "ArticleTextRenderSystem.h"
+#include "../../core/Logger.h"
+#include "../../ecs/World.h"
+#include "../../graphics/GraphicsDevice.h"
+#include "../../graphics/MeshPrimitives.h"
+#include "../../resources/ResourceManager.h"
+#include "../components/ArticleText.h"
+#include "../components/Camera.h"
+#include "../components/Transform.h"
+#include <DirectXMath.h>
+#include <d3d11.h>
+#include <wrl/client.h>
+
+using Microsoft::WRL::ComPtr;
+using namespace DirectX;
+
+namespace game::systems {
+
+namespace {
+
+/**
+ * @brief 文字描画用定数バッファ
+ */
+struct ArticleTextConstants {
+  XMMATRIX viewProjection;
+  XMFLOAT4 lightDir;
+  XMFLOAT4 cameraPos;
+  XMFLOAT4 field;      ///< x, y: ワールド幅・奥行き, z, w: 記事のピクセル寸法
+  XMFLOAT4 heightGrid; ///< x, y: 高さの解像度, z: 浮かせる量, w: 距離あたり
+};
+
+/**
+ * @brief 文字レンダリング用グローバルステート
+ */
+struct ArticleTextRenderState {
+  ComPtr<ID3D11Buffer> constantBuffer;
+  ComPtr<ID3D11Buffer> vertexBuffer;
+  ComPtr<ID3D11Buffer> indexBuffer;
+  ComPtr<ID3D11SamplerState> samplerState;
+  ComPtr<ID3D11BlendState> blendState;
+  ComPtr<ID3D11DepthStencilState> depthStencilState;
+  ComPtr<ID3D11RasterizerState> rasterizerState;
+  bool initialized = false;
+};
+
+/**
+ * @brief 1文字分の四角形（0..1）。位置はインスタンスから頂点シェーダーで作る
+ */
+bool InitializeQuad(ID3D11Device *device, ArticleTextRenderState &state) {
+  using graphics::Vertex;
+  Vertex vertices[] = {
+      {{0, 0, 0}, {0, 1, 0}, {0, 0}, {1, 1, 1, 1}, {1, 0, 0}, {0, 0, 1}},
+      {{1, 0, 0}, {0, 1, 0}, {1, 0}, {1, 1, 1, 1}, {1, 0, 0}, {0, 0, 1}},
+      {{0, 1, 0}, {0, 1, 0}, {0, 1}, {1, 1, 1, 1}, {1, 0, 0}, {0, 0, 1}},
+      {{1, 1, 0}, {0, 1, 0}, {1, 1}, {1, 1, 1, 1}, {1, 0, 0}, {0, 0, 1}},
+  };
+  uint16_t indices[] = {0, 1, 2, 2, 1, 3};
+
+  D3D11_BUFFER_DESC vbDesc = {};
+  vbDesc.ByteWidth = sizeof(vertices);
+  vbDesc.Usage = D3D11_USAGE_IMMUTABLE;
+  vbDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+  D3D11_SUBRESOURCE_DATA vbData = {};
+  vbData.pSysMem = vertices;
+  if (FAILED(device->CreateBuffer(&vbDesc, &vbData, &state.vertexBuffer))) {
+    return false;
+  }
+
+  D3D11_BUFFER_DESC ibDesc = {};
+  ibDesc.ByteWidth = sizeof(indices);
+  ibDesc.Usage = D3D11_USAGE_IMMUTABLE;
+  ibDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
+  D3D11_SUBRESOURCE_DATA ibData = {};
+  ibData.pSysMem = indices;
+  return SUCCEEDED(device->CreateBuffer(&ibDesc, &ibData, &state.indexBuffer));
+}
+
+/**
+ * @brief 文字用ステート初期化
+ */
+bool InitializeStates(ID3D11Device *device, ArticleTextRenderState &state) {
+  D3D11_BUFFER_DESC cbDesc = {};
+  cbDesc.ByteWidth = sizeof(ArticleTextConstants);
+  cbDesc.Usage = D3D11_USAGE_DYNAMIC;
+  cbDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+  cbDesc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+  if (FAILED(device->CreateBuffer(&cbDesc, nullptr, &state.constantBuffer))) {
+    return false;
+  }
+
+  // 距離場は線形補間で引く（縮小しても輪郭が崩れない）
+  D3D11_SAMPLER_DESC sampDesc = {};
+  sampDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+  sampDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+  sampDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+  sampDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+  sampDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
+  sampDesc.MaxLOD = D3D11_FLOAT32_MAX;
+  if (FAILED(device->CreateSamplerState(&sampDesc, &state.samplerState))) {
+    return false;
+  }
+
+  D3D11_BLEND_DESC blendDesc = {};
+  blendDesc.RenderTarget[0].BlendEnable = TRUE;
+  blendDesc.RenderTarget[0].SrcBlend = D3D11_BLEND_SRC_ALPHA;
+  blendDesc.RenderTarget[0].DestBlend = D3D11_BLEND_INV_SRC_ALPHA;
+  blendDesc.RenderTarget[0].BlendOp = D3D11_BLEND_OP_ADD;
+  blendDesc.RenderTarget[0].SrcBlendAlpha = D3D11_BLEND_ONE;
+  blendDesc.RenderTarget[0].DestBlendAlpha = D3D11_BLEND_INV_SRC_ALPHA;
+  blendDesc.RenderTarget[0].BlendOpAlpha = D3D11_BLEND_OP_ADD;
+  blendDesc.RenderTarget[0].RenderTargetWriteMask =
+      D3D11_COLOR_WRITE_ENABLE_ALL;
+  if (FAILED(device->CreateBlendState(&blendDesc, &state.blendState))) {
+    return false;
+  }
+
+  // 床より手前だけ描き、深度は書かない（ボールや旗が文字に隠れない）
+  D3D11_DEPTH_STENCIL_DESC dsDesc = {};
+  dsDesc.DepthEnable = TRUE;
+  dsDesc.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ZERO;
+  dsDesc.DepthFunc = D3D11_COMPARISON_LESS_EQUAL;
+  dsDesc.StencilEnable = FALSE;
+  if (FAILED(device->CreateDepthStencilState(&dsDesc,
+                                             &state.depthStencilState))) {
+    return false;
+  }
+
+  D3D11_RASTERIZER_DESC rsDesc = {};
+  rsDesc.FillMode = D3D11_FILL_SOLID;
+  rsDesc.CullMode = D3D11_CULL_NONE; // 四角形の向きを気にしない
+  rsDesc.DepthClipEnable = TRUE;
+  return SUCCEEDED(
+      device->CreateRasterizerState(&rsDesc, &state.rasterizerState));
+}
+
+} // namespace
+
+void ArticleTextRenderSystem(core::GameContext &ctx) {
+  auto *device = ctx.graphics.GetDevice();
+  auto *context = ctx.graphics.GetContext();
+  auto &world = ctx.world;
+
+  // グローバルステート取得または初期化
+  auto *state = world.GetGlobal<ArticleTextRenderState>();
+  if (!state) {
+    ArticleTextRenderState newState;
+    if (!InitializeQuad(device, newState) ||
+        !InitializeStates(device, newState)) {
+      return;
+    }
+    newState.initialized = true;
+    world.SetGlobal(std::move(newState));
+    state = world.GetGlobal<ArticleTextRenderState>();
+  }
+
+  if (!state || !state->initialized) {
+    return;
+  }
+
+  // カメラ情報取得
+  XMMATRIX viewProj = XMMatrixIdentity();
+  XMFLOAT4 cameraPos = {0, 0, 0, 1};
+  bool cameraFound = false;
+  world.Query<components::Transform, components::Camera>().Each(
+      [&](ecs::Entity, components::Transform &t, components::Camera &c) {
+        if (!cameraFound) {
+          viewProj = c.GetViewMatrix(t) * c.GetProjectionMatrix();
+          cameraPos = {t.position.x, t.position.y, t.position.z, 1.0f};
+          cameraFound = true;
+        }
+      });
+  if (!cameraFound) {
+    return;
+  }
+
+  auto shaderHandle = ctx.resource.LoadShader(
+      "Glyph", L"Assets/shaders/GlyphVS.hlsl", L"Assets/shaders/GlyphPS.hlsl");
+  auto shader = ctx.resource.GetShader(shaderHandle);
+  if (!shader) {
+    LOG_WARN("WikiGolf", "Glyph shader not loaded!");
+    return;
+  }
+
+  // 転置（HLSLは列優先）
+  viewProj = XMMatrixTranspose(viewProj);
+
+  world.Query<components::ArticleText>().Each([&](ecs::Entity,
+                                                  components::ArticleText &at) {
+    if (!at.isVisible || !at.text || at.text->instanceCount == 0 ||
+        !at.heightSRV) {
+      return;
+    }
+
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    if (SUCCEEDED(context->Map(state->constantBuffer.Get(), 0,
+                               D3D11_MAP_WRITE_DISCARD, 0, &mapped))) {
+      auto *constants = static_cast<ArticleTextConstants *>(mapped.pData);
+      constants->viewProjection = viewProj;
+      constants->lightDir = {0.5f, -1.0f, 0.5f, 0.0f}; // RenderSystem と同じ
+      constants->cameraPos = cameraPos;
+      constants->field = {at.fieldWidth, at.fieldDepth,
+                          static_cast<float>(at.text->width),
+                          static_cast<float>(at.text->height)};
+      // 床から少し浮かせ、遠いほど深度の精度が落ちる分を足す
+      constants->heightGrid = {static_cast<float>(at.heightResX),
+                               static_cast<float>(at.heightResZ), 0.01f,
+                               0.0005f};
+      context->Unmap(state->constantBuffer.Get(), 0);
+    }
+
+    shader->Bind(context);
+    context->VSSetConstantBuffers(0, 1, state->constantBuffer.GetAddressOf());
+    context->PSSetConstantBuffers(0, 1, state->constantBuffer.GetAddressOf());
+
+    ID3D11ShaderResourceView *vsResources[] = {at.text->instanceSRV.Get(),
+                                               at.heightSRV.Get()};
+    context->VSSetShaderResources(0, 2, vsResources);
+    context->VSSetSamplers(0, 1, state->samplerState.GetAddressOf());
+    context->PSSetShaderResources(0, 1, at.text->atlasSRV.GetAddressOf());
+    context->PSSetSamplers(0, 1, state->samplerState.GetAddressOf());
+
+    const float blendFactor[4] = {0, 0, 0, 0};
+    context->OMSetBlendState(state->blendState.Get(), blendFactor, 0xFFFFFFFF);
+    context->OMSetDepthStencilState(state->depthStencilState.Get(), 0);
+    context->RSSetState(state->rasterizerState.Get());
+
+    UINT stride = sizeof(graphics::Vertex);
+    UINT offset = 0;
+    context->IASetVertexBuffers(0, 1, state->vertexBuffer.GetAddressOf(),
+                                &stride, &offset);
+    context->IASetIndexBuffer(state->indexBuffer.Get(), DXGI_FORMAT_R16_UINT,
+                              0);
+    context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+
+    // 記事1ページ分を1回で描く
+    context->DrawIndexedInstanced(6, at.text->instanceCount, 0, 0, 0);
+
+    // ステートリセット（他の描画への影響を防ぐ）
+    ID3D11ShaderResourceView *nullResources[2] = {};
+    context->VSSetShaderResources(0, 2, nullResources);
+    context->OMSetBlendState(nullptr, nullptr, 0xFFFFFFFF);
+    context->OMSetDepthStencilState(nullptr, 0);
+    context->RSSetState(nullptr);
+  });
+}
+
+} // namespace game::systems
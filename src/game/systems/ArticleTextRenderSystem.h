@@ -0,0 +1,21 @@
+#pragma once
+/**
+ * @file ArticleTextRenderSystem.h
+ * @brief 記事の文字（SDF グリフ）描画システム
+ */
+
+#include "../../core/GameContext.h"
+
+namespace game::systems {
+
+/**
+ * @brief 記事の文字レンダリングシステム
+ *
+ * @details
+ * - RenderSystemの後に呼び出す（床の上にアルファブレンドで重ねる）
+ * - 1文字1インスタンスで、全体を1回の DrawIndexedInstanced で描く
+ * - 深度テストはLESS_EQUALで深度書き込みは無効
+ */
+void ArticleTextRenderSystem(core::GameContext &ctx);
+
+} // namespace game::systems
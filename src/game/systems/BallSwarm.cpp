@@ -0,0 +1,270 @@
+/**
+ * @file BallSwarm.cpp
+ * @brief ローディング演出用の大量ボール物理の実装
+ */
+
+#include "BallSwarm.h"
+#include "../../core/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+
+namespace game::systems {
+
+namespace {
+
+/// @brief 1チャンクあたりのボール数（小さすぎるとスケジューリングが支配的）
+constexpr size_t kGrainSize = 256;
+
+/// @brief プールがあれば並列、なければそのまま実行
+template <typename Fn>
+void RunRange(core::ThreadPool *pool, size_t count, Fn &&fn) {
+  if (pool && count > kGrainSize) {
+    pool->ParallelFor(count, kGrainSize, fn);
+  } else {
+    fn(0, count);
+  }
+}
+
+} // namespace
+
+BallSwarm::BallSwarm(const BallSwarmConfig &config) : m_config(config) {}
+
+size_t BallSwarm::AddBall(float px, float py, float pz, float vx, float vy,
+                          float vz) {
+  m_px.push_back(px);
+  m_py.push_back(py);
+  m_pz.push_back(pz);
+  m_vx.push_back(vx);
+  m_vy.push_back(vy);
+  m_vz.push_back(vz);
+  m_settled.push_back(0);
+  return m_px.size() - 1;
+}
+
+void BallSwarm::Clear() {
+  m_px.clear();
+  m_py.clear();
+  m_pz.clear();
+  m_vx.clear();
+  m_vy.clear();
+  m_vz.clear();
+  m_settled.clear();
+  m_stats = {};
+}
+
+void BallSwarm::Step(float dt, core::ThreadPool *pool) {
+  const size_t count = GetCount();
+  if (count == 0 || dt <= 0.0f) {
+    m_stats = {};
+    return;
+  }
+
+  m_dpx.resize(count);
+  m_dpy.resize(count);
+  m_dpz.resize(count);
+  m_dvx.resize(count);
+  m_dvy.resize(count);
+  m_dvz.resize(count);
+  m_wake.resize(count);
+  m_sorted.resize(count);
+
+  const int subSteps = std::max(m_config.subSteps, 1);
+  const float subDt = dt / static_cast<float>(subSteps);
+  const float cellSize = m_config.radius * 2.0f;
+
+  for (int step = 0; step < subSteps; ++step) {
+    RunRange(pool, count,
+             [&](size_t begin, size_t end) { Integrate(begin, end, subDt); });
+
+    m_grid.Build(m_px.data(), m_py.data(), m_pz.data(), count, cellSize);
+
+    RunRange(pool, count,
+             [&](size_t begin, size_t end) { GatherSorted(begin, end); });
+    RunRange(pool, count,
+             [&](size_t begin, size_t end) { SolveContacts(begin, end); });
+    RunRange(pool, count,
+             [&](size_t begin, size_t end) { ApplyContacts(begin, end); });
+  }
+
+  RunRange(pool, count,
+           [&](size_t begin, size_t end) { UpdateSettled(begin, end); });
+  CollectStats();
+}
+
+void BallSwarm::Integrate(size_t begin, size_t end, float subDt) {
+  const BallSwarmConfig &c = m_config;
+  const float subDrag = std::pow(c.airDrag, subDt * 60.0f);
+  const float subFriction = std::pow(c.floorFriction, subDt * 60.0f);
+
+  for (size_t i = begin; i < end; ++i) {
+    if (m_settled[i]) {
+      continue;
+    }
+
+    m_vy[i] += c.gravity * subDt;
+    m_vx[i] *= subDrag;
+    m_vz[i] *= subDrag;
+
+    m_px[i] += m_vx[i] * subDt;
+    m_py[i] += m_vy[i] * subDt;
+    m_pz[i] += m_vz[i] * subDt;
+
+    // 床
+    if (m_py[i] < c.floorY) {
+      m_py[i] = c.floorY;
+      m_vy[i] = (m_vy[i] < -0.5f) ? -m_vy[i] * c.restitution : 0.0f;
+      m_vx[i] *= subFriction;
+      m_vz[i] *= subFriction;
+    }
+
+    // 壁
+    if (m_px[i] < -c.wallX) {
+      m_px[i] = -c.wallX;
+      m_vx[i] = -m_vx[i] * c.restitution;
+    } else if (m_px[i] > c.wallX) {
+      m_px[i] = c.wallX;
+      m_vx[i] = -m_vx[i] * c.restitution;
+    }
+    if (m_pz[i] < -c.wallZ) {
+      m_pz[i] = -c.wallZ;
+      m_vz[i] = -m_vz[i] * c.restitution;
+    } else if (m_pz[i] > c.wallZ) {
+      m_pz[i] = c.wallZ;
+      m_vz[i] = -m_vz[i] * c.restitution;
+    }
+  }
+}
+
+void BallSwarm::GatherSorted(size_t begin, size_t end) {
+  for (size_t k = begin; k < end; ++k) {
+    const uint32_t i = m_grid.GetSortedIndex(k);
+    m_sorted[k] = {m_px[i], m_py[i], m_pz[i], m_vx[i],
+                   m_vy[i], m_vz[i], m_settled[i]};
+  }
+}
+
+void BallSwarm::SolveContacts(size_t begin, size_t end) {
+  const float minDist = m_config.radius * 2.0f;
+  const float minDistSq = minDist * minDist;
+  const float restitution = m_config.restitution;
+
+  // スロット順に走査し、近傍も連続した m_sorted から読む
+  for (size_t k = begin; k < end; ++k) {
+    const SortedBall &self = m_sorted[k];
+    float dpx = 0.0f, dpy = 0.0f, dpz = 0.0f;
+    float dvx = 0.0f, dvy = 0.0f, dvz = 0.0f;
+    uint8_t wake = 0;
+    const bool selfSettled = self.settled != 0;
+
+    m_grid.ForEachCandidateSlot(self.x, self.y, self.z, [&](uint32_t slot) {
+      const SortedBall &other = m_sorted[slot];
+      if (slot == k || (selfSettled && other.settled)) {
+        return;
+      }
+
+      // 法線は self -> other 向き
+      const float dx = other.x - self.x;
+      const float dy = other.y - self.y;
+      const float dz = other.z - self.z;
+      const float distSq = dx * dx + dy * dy + dz * dz;
+      if (distSq >= minDistSq || distSq <= 0.0001f) {
+        return;
+      }
+
+      const float dist = std::sqrt(distSq);
+      const float overlap = minDist - dist;
+      const float nx = dx / dist, ny = dy / dist, nz = dz / dist;
+
+      // 静止ボールは動かさず、相手が静止していれば全量を自分が受け持つ
+      const float share = selfSettled ? 0.0f : (other.settled ? 1.0f : 0.5f);
+      dpx -= nx * overlap * share;
+      dpy -= ny * overlap * share;
+      dpz -= nz * overlap * share;
+
+      const float rvx = other.vx - self.vx;
+      const float rvy = other.vy - self.vy;
+      const float rvz = other.vz - self.vz;
+      const float velAlongNormal = rvx * nx + rvy * ny + rvz * nz;
+      if (velAlongNormal < 0.0f) {
+        const float impulse = -(1.0f + restitution) * velAlongNormal * 0.5f;
+        if (!selfSettled) {
+          dvx -= nx * impulse;
+          dvy -= ny * impulse;
+          dvz -= nz * impulse;
+        }
+        if (impulse > 0.5f) {
+          wake = 1;
+        }
+      }
+    });
+
+    const uint32_t i = m_grid.GetSortedIndex(k);
+    m_dpx[i] = dpx;
+    m_dpy[i] = dpy;
+    m_dpz[i] = dpz;
+    m_dvx[i] = dvx;
+    m_dvy[i] = dvy;
+    m_dvz[i] = dvz;
+    m_wake[i] = wake;
+  }
+}
+
+void BallSwarm::ApplyContacts(size_t begin, size_t end) {
+  const BallSwarmConfig &c = m_config;
+  for (size_t i = begin; i < end; ++i) {
+    // 押し出しで床・壁を突き抜けないよう再クランプする
+    m_px[i] = std::clamp(m_px[i] + m_dpx[i], -c.wallX, c.wallX);
+    m_py[i] = std::max(m_py[i] + m_dpy[i], c.floorY);
+    m_pz[i] = std::clamp(m_pz[i] + m_dpz[i], -c.wallZ, c.wallZ);
+    m_vx[i] += m_dvx[i];
+    m_vy[i] += m_dvy[i];
+    m_vz[i] += m_dvz[i];
+    if (m_wake[i]) {
+      m_settled[i] = 0;
+    }
+  }
+}
+
+void BallSwarm::UpdateSettled(size_t begin, size_t end) {
+  const float threshold =
+      m_config.settleThreshold * m_config.settleThreshold * 0.5f;
+  const float floorLimit = m_config.floorY + 0.1f;
+
+  for (size_t i = begin; i < end; ++i) {
+    const float speedSq =
+        m_vx[i] * m_vx[i] + m_vy[i] * m_vy[i] + m_vz[i] * m_vz[i];
+    if (speedSq < threshold && m_py[i] <= floorLimit) {
+      m_settled[i] = 1;
+      m_vx[i] = m_vy[i] = m_vz[i] = 0.0f;
+    } else {
+      m_settled[i] = 0;
+    }
+  }
+}
+
+void BallSwarm::CollectStats() {
+  BallSwarmStats stats;
+  float speedAccum = 0.0f;
+  for (size_t i = 0; i < GetCount(); ++i) {
+    if (m_settled[i]) {
+      ++stats.settledCount;
+      continue;
+    }
+    ++stats.movingCount;
+    const float speed =
+        std::sqrt(m_vx[i] * m_vx[i] + m_vy[i] * m_vy[i] + m_vz[i] * m_vz[i]);
+    stats.maxSpeed = std::max(stats.maxSpeed, speed);
+    speedAccum += speed;
+    if (!stats.hasMovingSample) {
+      stats.samplePos[0] = m_px[i];
+      stats.samplePos[1] = m_py[i];
+      stats.samplePos[2] = m_pz[i];
+      stats.hasMovingSample = true;
+    }
+  }
+  stats.avgSpeed =
+      (stats.movingCount > 0) ? speedAccum / stats.movingCount : 0.0f;
+  m_stats = stats;
+}
+
+} // namespace game::systems
@@ -0,0 +1,107 @@
+#pragma once
+/**
+ * @file BallSwarm.h
+ * @brief ローディング演出用の大量ボール物理（空間ハッシュ＋並列ヤコビ解法）
+ */
+
+#include "SpatialHashGrid.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace game::systems {
+
+/// @brief 箱型アリーナと物理定数
+struct BallSwarmConfig {
+  float radius = 3.3f;           ///< ボール半径
+  float gravity = -180.0f;       ///< 重力加速度
+  float restitution = 0.3f;      ///< 反発係数
+  float floorFriction = 0.82f;   ///< 接地時の横速度減衰（60fps基準）
+  float airDrag = 0.98f;         ///< 空気抵抗（60fps基準）
+  float floorY = -4.4f;          ///< ボール中心の下限
+  float wallX = 36.7f;           ///< ボール中心のX方向限界
+  float wallZ = 16.7f;           ///< ボール中心のZ方向限界
+  float settleThreshold = 1.2f;  ///< 静止判定速度
+  int subSteps = 8;              ///< サブステップ数
+};
+
+/// @brief フレームごとの集計値（ログ・進捗表示用）
+struct BallSwarmStats {
+  int settledCount = 0;
+  int movingCount = 0;
+  float maxSpeed = 0.0f;
+  float avgSpeed = 0.0f;
+  bool hasMovingSample = false;
+  float samplePos[3] = {0.0f, 0.0f, 0.0f}; ///< 最初に見つかった移動中ボール
+};
+
+/// @brief SoA で保持したボール群を床・壁・相互衝突込みで積分する
+/// @details 接触は毎サブステップ SpatialHashGrid を作り直して候補を絞り、
+///          各ボールが自分への補正だけを書き込むヤコビ反復で解く。
+///          書き込み先が重ならないのでワーカープールでそのまま並列化でき、
+///          結果はスレッド数に依存しない。
+class BallSwarm {
+public:
+  explicit BallSwarm(const BallSwarmConfig &config = {});
+
+  /// @brief 設定を差し替える（既存のボールは保持）
+  void SetConfig(const BallSwarmConfig &config) { m_config = config; }
+  const BallSwarmConfig &GetConfig() const { return m_config; }
+
+  /// @brief ボールを追加し、そのインデックスを返す
+  size_t AddBall(float px, float py, float pz, float vx, float vy, float vz);
+
+  /// @brief 全ボールを破棄
+  void Clear();
+
+  /// @brief 1フレーム分進める
+  /// @param dt フレーム時間
+  /// @param pool 並列化に使うプール（nullptrなら単一スレッド）
+  void Step(float dt, core::ThreadPool *pool);
+
+  size_t GetCount() const { return m_px.size(); }
+  float GetX(size_t i) const { return m_px[i]; }
+  float GetY(size_t i) const { return m_py[i]; }
+  float GetZ(size_t i) const { return m_pz[i]; }
+  bool IsSettled(size_t i) const { return m_settled[i] != 0; }
+
+  /// @brief 直近の Step の集計値
+  const BallSwarmStats &GetStats() const { return m_stats; }
+
+private:
+  void Integrate(size_t begin, size_t end, float subDt);
+  void GatherSorted(size_t begin, size_t end);
+  void SolveContacts(size_t begin, size_t end);
+  void ApplyContacts(size_t begin, size_t end);
+  void UpdateSettled(size_t begin, size_t end);
+  void CollectStats();
+
+  BallSwarmConfig m_config;
+
+  // 位置・速度（SoA）
+  std::vector<float> m_px, m_py, m_pz;
+  std::vector<float> m_vx, m_vy, m_vz;
+  std::vector<uint8_t> m_settled;
+
+  /// @brief 接触判定用にグリッドのスロット順へ並べ替えたコピー
+  struct SortedBall {
+    float x, y, z;
+    float vx, vy, vz;
+    uint32_t settled;
+  };
+  std::vector<SortedBall> m_sorted;
+
+  // ヤコビ反復の補正バッファ
+  std::vector<float> m_dpx, m_dpy, m_dpz;
+  std::vector<float> m_dvx, m_dvy, m_dvz;
+  std::vector<uint8_t> m_wake;
+
+  SpatialHashGrid m_grid;
+  BallSwarmStats m_stats;
+};
+
+} // namespace game::systems
@@ -0,0 +1,292 @@
+/**
+ * @file HeightFieldFilter.cpp
+ * @brief ハイトマップ用スムージングフィルタの実装
+ */
+
+#include "HeightFieldFilter.h"
+#include "../../core/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define HEIGHTFIELD_FILTER_SSE2 1
+#endif
+
+namespace game::systems {
+
+namespace {
+
+/// @brief 1チャンクあたりのセル数の目安
+constexpr int kCellsPerChunk = 16384;
+
+/// @brief 縦方向の累積和を初期化し直す行数
+/// @details 累積和の丸め誤差が溜まりすぎないよう、また
+///          並列分割に関係なく同じ位置で初期化されるよう固定にしている。
+constexpr int kBlockRows = 32;
+
+/// @brief プールがあれば並列、なければそのまま実行
+template <typename Fn>
+void RunRange(core::ThreadPool *pool, int count, int grain, Fn &&fn) {
+  if (count <= 0) {
+    return;
+  }
+  if (pool && count > grain) {
+    pool->ParallelFor(static_cast<size_t>(count), static_cast<size_t>(grain),
+                      [&](size_t begin, size_t end) {
+                        fn(static_cast<int>(begin), static_cast<int>(end));
+                      });
+  } else {
+    fn(0, count);
+  }
+}
+
+// 行単位の演算。SSE2 版とスカラー版は各要素で同じ順序の演算を行うため、
+// どちらを通っても結果はビット単位で一致する。
+
+/// @brief acc = src
+void CopyRow(float *acc, const float *src, int n) {
+  std::copy(src, src + n, acc);
+}
+
+/// @brief acc += src
+void AddRow(float *acc, const float *src, int n) {
+  int x = 0;
+#ifdef HEIGHTFIELD_FILTER_SSE2
+  for (; x + 4 <= n; x += 4) {
+    __m128 a = _mm_loadu_ps(acc + x);
+    a = _mm_add_ps(a, _mm_loadu_ps(src + x));
+    _mm_storeu_ps(acc + x, a);
+  }
+#endif
+  for (; x < n; ++x) {
+    acc[x] += src[x];
+  }
+}
+
+/// @brief acc = (acc + add) - sub
+void SlideRow(float *acc, const float *add, const float *sub, int n) {
+  int x = 0;
+#ifdef HEIGHTFIELD_FILTER_SSE2
+  for (; x + 4 <= n; x += 4) {
+    __m128 a = _mm_loadu_ps(acc + x);
+    a = _mm_add_ps(a, _mm_loadu_ps(add + x));
+    a = _mm_sub_ps(a, _mm_loadu_ps(sub + x));
+    _mm_storeu_ps(acc + x, a);
+  }
+#endif
+  for (; x < n; ++x) {
+    acc[x] = (acc[x] + add[x]) - sub[x];
+  }
+}
+
+/// @brief dst[x] = acc[x] * scale  (x in [begin, end))
+void ScaleRow(float *dst, const float *acc, float scale, int begin, int end) {
+  int x = begin;
+#ifdef HEIGHTFIELD_FILTER_SSE2
+  const __m128 s = _mm_set1_ps(scale);
+  for (; x + 4 <= end; x += 4) {
+    _mm_storeu_ps(dst + x, _mm_mul_ps(_mm_loadu_ps(acc + x), s));
+  }
+#endif
+  for (; x < end; ++x) {
+    dst[x] = acc[x] * scale;
+  }
+}
+
+/// @brief 横方向の窓和（端は複製）を dst に書く
+/// @param padded 作業用（width + 2 * radius 要素以上）
+void HorizontalSumRow(const float *src, float *dst, int width, int radius,
+                      float *padded) {
+  // 端を複製したコピーを作り、窓の出入りを分岐なしで扱う
+  for (int i = 0; i < width + 2 * radius; ++i) {
+    padded[i] = src[std::clamp(i - radius, 0, width - 1)];
+  }
+
+  // 長い行でも誤差が溜まらないよう累積は倍精度で行う
+  double sum = 0.0;
+  for (int k = 0; k < 2 * radius + 1; ++k) {
+    sum += padded[k];
+  }
+  for (int x = 0; x < width; ++x) {
+    dst[x] = static_cast<float>(sum);
+    if (x + 1 < width) {
+      sum += static_cast<double>(padded[x + 2 * radius + 1]) -
+             static_cast<double>(padded[x]);
+    }
+  }
+}
+
+} // namespace
+
+void BoxBlurHeightField(std::vector<float> &heights, int width, int height,
+                        int radius, SmoothingEdge edge,
+                        std::vector<float> &scratch, core::ThreadPool *pool) {
+  if (radius <= 0 || width <= 0 || height <= 0) {
+    return;
+  }
+  const bool keep = (edge == SmoothingEdge::Keep);
+  if (keep && (width <= 2 * radius || height <= 2 * radius)) {
+    return; // 更新できる内側のセルがない
+  }
+
+  const size_t cellCount = static_cast<size_t>(width) * height;
+  if (scratch.size() < cellCount) {
+    scratch.resize(cellCount);
+  }
+  float *data = heights.data();
+  float *sums = scratch.data();
+
+  // 1) 横方向: 各行の窓和（スケールは縦方向でまとめて掛ける）
+  const int rowGrain = std::max(1, kCellsPerChunk / width);
+  RunRange(pool, height, rowGrain, [&](int zBegin, int zEnd) {
+    std::vector<float> padded(static_cast<size_t>(width) + 2 * radius);
+    for (int z = zBegin; z < zEnd; ++z) {
+      HorizontalSumRow(data + static_cast<size_t>(z) * width,
+                       sums + static_cast<size_t>(z) * width, width, radius,
+                       padded.data());
+    }
+  });
+
+  // 2) 縦方向: 行の累積和を SIMD で滑らせて data に書き戻す
+  const int outZBegin = keep ? radius : 0;
+  const int outZEnd = keep ? height - radius : height;
+  const int outXBegin = keep ? radius : 0;
+  const int outXEnd = keep ? width - radius : width;
+  const float scale = 1.0f / static_cast<float>((2 * radius + 1) *
+                                                (2 * radius + 1));
+  auto sumRow = [&](int z) {
+    return sums + static_cast<size_t>(std::clamp(z, 0, height - 1)) * width;
+  };
+
+  const int rows = outZEnd - outZBegin;
+  const int blockCount = (rows + kBlockRows - 1) / kBlockRows;
+  const int blockGrain = std::max(1, kCellsPerChunk / (width * kBlockRows));
+  RunRange(pool, blockCount, blockGrain, [&](int bBegin, int bEnd) {
+    std::vector<float> acc(width);
+    for (int b = bBegin; b < bEnd; ++b) {
+      const int z0 = outZBegin + b * kBlockRows;
+      const int z1 = std::min(z0 + kBlockRows, outZEnd);
+
+      CopyRow(acc.data(), sumRow(z0 - radius), width);
+      for (int k = -radius + 1; k <= radius; ++k) {
+        AddRow(acc.data(), sumRow(z0 + k), width);
+      }
+      for (int z = z0; z < z1; ++z) {
+        ScaleRow(data + static_cast<size_t>(z) * width, acc.data(), scale,
+                 outXBegin, outXEnd);
+        if (z + 1 < z1) {
+          SlideRow(acc.data(), sumRow(z + radius + 1), sumRow(z - radius),
+                   width);
+        }
+      }
+    }
+  });
+}
+
+std::vector<int> ComputeGaussianBoxRadii(float sigma, int passes) {
+  // 箱型フィルタを n 回重ねた分散が sigma^2 に最も近くなる幅の組を選ぶ
+  // （幅 wl と wl+2 の奇数幅を m : n-m で混ぜる）
+  std::vector<int> radii(std::max(passes, 0), 0);
+  if (passes <= 0 || sigma <= 0.0f) {
+    return radii;
+  }
+  const double n = passes;
+  const double var12 = 12.0 * sigma * sigma;
+  int wl = static_cast<int>(std::floor(std::sqrt(var12 / n + 1.0)));
+  if (wl % 2 == 0) {
+    --wl;
+  }
+  wl = std::max(wl, 1);
+  const int wu = wl + 2;
+  const double mIdeal =
+      (var12 - n * wl * wl - 4.0 * n * wl - 3.0 * n) / (-4.0 * wl - 4.0);
+  const int m = static_cast<int>(std::lround(mIdeal));
+  for (int i = 0; i < passes; ++i) {
+    radii[i] = ((i < m) ? wl : wu) / 2;
+  }
+  return radii;
+}
+
+namespace {
+
+/// @brief 1イテレーションで重ねる箱型フィルタの半径列
+std::vector<int> PassRadii(const SmoothingSettings &settings) {
+  if (settings.mode == SmoothingMode::Gaussian) {
+    return ComputeGaussianBoxRadii(settings.sigma, 3);
+  }
+  return {settings.radius};
+}
+
+} // namespace
+
+int SmoothingHalo(const SmoothingSettings &settings) {
+  int perIteration = 0;
+  for (int radius : PassRadii(settings)) {
+    perIteration += std::max(radius, 0);
+  }
+  return perIteration * std::max(settings.iterations, 0);
+}
+
+void SmoothHeightFieldRegion(const std::vector<float> &source,
+                             std::vector<float> &heights, int width,
+                             int height, const SmoothingSettings &settings,
+                             int x0, int z0, int x1, int z1,
+                             core::ThreadPool *pool) {
+  const size_t cellCount = static_cast<size_t>(width) * height;
+  if (source.size() < cellCount || heights.size() < cellCount) {
+    return;
+  }
+  x0 = std::max(x0, 0);
+  z0 = std::max(z0, 0);
+  x1 = std::min(x1, width);
+  z1 = std::min(z1, height);
+  if (x0 >= x1 || z0 >= z1) {
+    return;
+  }
+
+  // 窓の端はフィールドの端と一致するか、矩形から halo 以上離れる
+  const int halo = SmoothingHalo(settings);
+  const int wx0 = std::max(0, x0 - halo);
+  const int wz0 = std::max(0, z0 - halo);
+  const int wx1 = std::min(width, x1 + halo);
+  const int wz1 = std::min(height, z1 + halo);
+  const int windowWidth = wx1 - wx0;
+  const int windowHeight = wz1 - wz0;
+
+  std::vector<float> window(static_cast<size_t>(windowWidth) * windowHeight);
+  for (int z = wz0; z < wz1; ++z) {
+    const float *src = source.data() + static_cast<size_t>(z) * width;
+    std::copy(src + wx0, src + wx1,
+              window.data() + static_cast<size_t>(z - wz0) * windowWidth);
+  }
+
+  SmoothHeightField(window, windowWidth, windowHeight, settings, pool);
+
+  for (int z = z0; z < z1; ++z) {
+    const float *src = window.data() +
+                       static_cast<size_t>(z - wz0) * windowWidth + (x0 - wx0);
+    std::copy(src, src + (x1 - x0),
+              heights.data() + static_cast<size_t>(z) * width + x0);
+  }
+}
+
+void SmoothHeightField(std::vector<float> &heights, int width, int height,
+                       const SmoothingSettings &settings,
+                       core::ThreadPool *pool) {
+  if (heights.size() < static_cast<size_t>(width) * height) {
+    return;
+  }
+
+  const std::vector<int> radii = PassRadii(settings);
+
+  std::vector<float> scratch;
+  for (int iter = 0; iter < settings.iterations; ++iter) {
+    for (int radius : radii) {
+      BoxBlurHeightField(heights, width, height, radius, settings.edge,
+                         scratch, pool);
+    }
+  }
+}
+
+} // namespace game::systems
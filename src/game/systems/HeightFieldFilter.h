@@ -0,0 +1,79 @@
+#pragma once
+/**
+ * @file HeightFieldFilter.h
+ * @brief ハイトマップ用の分離型スムージングフィルタ（累積和＋SIMD）
+ */
+
+#include <vector>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace game::systems {
+
+/// @brief スムージングのカーネル
+enum class SmoothingMode {
+  Box,      ///< (2r+1)^2 の箱型平均
+  Gaussian, ///< 箱型フィルタ3回重ねによるガウス近似
+};
+
+/// @brief 外周セルの扱い
+enum class SmoothingEdge {
+  Keep,  ///< 半径以内の外周セルは更新しない（従来の 3x3 平均と同じ）
+  Clamp, ///< 範囲外は端の値を繰り返して全セルを更新する
+};
+
+/// @brief スムージング設定
+struct SmoothingSettings {
+  SmoothingMode mode = SmoothingMode::Box;
+  SmoothingEdge edge = SmoothingEdge::Keep;
+  int radius = 1;     ///< Box の半径（1 で 3x3）
+  float sigma = 1.0f; ///< Gaussian の標準偏差（セル単位）
+  int iterations = 3; ///< フィルタを繰り返す回数
+};
+
+/// @brief ハイトマップをその場でスムージングする
+/// @details 横方向は行ごとの累積和、縦方向は行単位の SIMD 加減算で
+///          箱型平均を求めるため、コストは半径によらず 1 セルあたり定数。
+///          縦方向の累積和は固定の行ブロックごとに初期化し直すので、
+///          結果はスレッド数によらず一致する。
+///          radius=1 / Keep は従来の 3x3 平均と丸め誤差の範囲で一致する。
+/// @param heights 行優先 (z * width + x) の高さ
+/// @param width,height グリッドの大きさ
+/// @param settings フィルタ設定
+/// @param pool 並列化に使うプール（nullptrなら単一スレッド）
+void SmoothHeightField(std::vector<float> &heights, int width, int height,
+                       const SmoothingSettings &settings,
+                       core::ThreadPool *pool);
+
+/// @brief スムージングの影響が及ぶ距離（セル数）
+/// @details あるセルの変更は、平滑化後に最大この距離まで広がる。
+int SmoothingHalo(const SmoothingSettings &settings);
+
+/// @brief 矩形 [x0, x1) x [z0, z1) の平滑化結果だけを計算し直す
+/// @details source（平滑化前の全体）から矩形の周囲 SmoothingHalo だけ
+///          広げた窓を切り出して平滑化し、矩形内だけを heights に書き戻す。
+///          窓の切り口の影響は halo より内側へ届かないので、矩形内は
+///          全体を平滑化した場合と丸め誤差の範囲で一致する。
+/// @param source 平滑化前の高さ
+/// @param heights 平滑化後の高さ（矩形外は変更しない）
+void SmoothHeightFieldRegion(const std::vector<float> &source,
+                             std::vector<float> &heights, int width,
+                             int height, const SmoothingSettings &settings,
+                             int x0, int z0, int x1, int z1,
+                             core::ThreadPool *pool);
+
+/// @brief 1回分の箱型フィルタ（横→縦）を適用する
+/// @param scratch 作業用バッファ（必要に応じて拡張される）
+void BoxBlurHeightField(std::vector<float> &heights, int width, int height,
+                        int radius, SmoothingEdge edge,
+                        std::vector<float> &scratch, core::ThreadPool *pool);
+
+/// @brief ガウス分布を近似する箱型フィルタの半径列を求める
+/// @param sigma 標準偏差（セル単位）
+/// @param passes 重ねる回数
+/// @return 各パスの半径（passes 要素）
+std::vector<int> ComputeGaussianBoxRadii(float sigma, int passes);
+
+} // namespace game::systems
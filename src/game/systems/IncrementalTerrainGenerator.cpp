@@ -0,0 +1,257 @@
+/**
+ * @file IncrementalTerrainGenerator.cpp
+ * @brief 差分再生成に対応した地形生成器の実装
+ */
+
+#include "IncrementalTerrainGenerator.h"
+#include "../../core/Noise.h"
+#include "HeightFieldFilter.h"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace game::systems {
+
+const TerrainData &IncrementalTerrainGenerator::Generate(
+    const std::string &articleText,
+    const std::vector<DirectX::XMFLOAT2> &holes, const TerrainConfig &config,
+    core::ThreadPool *pool) {
+  m_seed = core::noise::SeedFromString(articleText);
+  m_holes = holes;
+  m_data.config = config;
+  Rebuild(pool);
+  return m_data;
+}
+
+void IncrementalTerrainGenerator::Rebuild(core::ThreadPool *pool) {
+  // TerrainGenerator::GenerateTerrain と同じ手順で、途中の結果を保存する
+  const TerrainConfig config = m_data.config;
+  const TerrainRect full =
+      TerrainRect::Full(config.resolutionX, config.resolutionZ);
+  const size_t cellCount = full.Area();
+
+  m_data = TerrainData{};
+  m_data.config = config;
+  m_data.heightMap.assign(cellCount, 0.0f);
+  m_data.materialMap.assign(cellCount, 0);
+
+  TerrainGenerator::GenerateBaseHeightMap(m_data, m_seed, full, pool);
+  m_baseHeights = m_data.heightMap;
+  m_baseMaterials = m_data.materialMap;
+
+  m_platforms = TerrainGenerator::ResolvePlatforms(config, m_baseHeights,
+                                                   m_baseMaterials, m_holes);
+  TerrainGenerator::ApplyPlatforms(m_data, m_platforms, full, pool);
+  m_rawHeights = m_data.heightMap;
+
+  TerrainGenerator::ApplySmoothing(m_data, pool);
+  TerrainGenerator::CalculateNormals(m_data, full, pool);
+  TerrainGenerator::GenerateMesh(m_data, m_holes, pool);
+
+  m_baseDirty = {};
+  m_markDirty = {};
+  m_holesChanged = false;
+  m_needsRebuild = false;
+}
+
+void IncrementalTerrainGenerator::SetHoles(
+    const std::vector<DirectX::XMFLOAT2> &holes) {
+  // 目印色はホール位置だけで決まるので、動いたホールの周りだけ塗り直す
+  const size_t count = std::max(holes.size(), m_holes.size());
+  for (size_t i = 0; i < count; ++i) {
+    const bool hasOld = i < m_holes.size();
+    const bool hasNew = i < holes.size();
+    if (hasOld && hasNew && m_holes[i].x == holes[i].x &&
+        m_holes[i].y == holes[i].y) {
+      continue;
+    }
+    if (hasOld) {
+      m_markDirty = m_markDirty.Union(HoleMarkRect(m_holes[i]));
+    }
+    if (hasNew) {
+      m_markDirty = m_markDirty.Union(HoleMarkRect(holes[i]));
+    }
+  }
+  m_holes = holes;
+  m_holesChanged = true;
+}
+
+void IncrementalTerrainGenerator::SetConfig(const TerrainConfig &config) {
+  const TerrainConfig &current = m_data.config;
+  const bool resized = config.resolutionX != current.resolutionX ||
+                       config.resolutionZ != current.resolutionZ ||
+                       config.worldWidth != current.worldWidth ||
+                       config.worldDepth != current.worldDepth;
+  m_data.config = config;
+  if (resized) {
+    m_needsRebuild = true;
+  } else {
+    MarkDirty(TerrainRect::Full(config.resolutionX, config.resolutionZ));
+  }
+}
+
+void IncrementalTerrainGenerator::MarkDirty(const TerrainRect &rect) {
+  m_baseDirty = m_baseDirty.Union(rect.Expanded(
+      0, m_data.config.resolutionX, m_data.config.resolutionZ));
+}
+
+bool IncrementalTerrainGenerator::HasPendingChanges() const {
+  return m_needsRebuild || m_holesChanged || !m_baseDirty.IsEmpty() ||
+         !m_markDirty.IsEmpty();
+}
+
+TerrainRect IncrementalTerrainGenerator::HoleMarkRect(
+    const DirectX::XMFLOAT2 &pos) const {
+  const TerrainConfig &config = m_data.config;
+  const int resX = config.resolutionX;
+  const int resZ = config.resolutionZ;
+  const float gx = (pos.x / config.worldWidth + 0.5f) * (resX - 1);
+  const float gz = (0.5f - pos.y / config.worldDepth) * (resZ - 1);
+  const float rx =
+      TerrainGenerator::kHoleMarkRadius * (resX - 1) / config.worldWidth;
+  const float rz =
+      TerrainGenerator::kHoleMarkRadius * (resZ - 1) / config.worldDepth;
+
+  // 頂点座標の丸めを見込んで1セル余分に取る
+  TerrainRect rect{static_cast<int>(std::floor(gx - rx)) - 1,
+                   static_cast<int>(std::floor(gz - rz)) - 1,
+                   static_cast<int>(std::ceil(gx + rx)) + 2,
+                   static_cast<int>(std::ceil(gz + rz)) + 2};
+  return rect.Expanded(0, resX, resZ);
+}
+
+TerrainRect IncrementalTerrainGenerator::DiffPlatforms(
+    const std::vector<TerrainPlatform> &next, size_t &changedCount) const {
+  const std::vector<TerrainPlatform> &prev = m_platforms;
+  const int resX = m_data.config.resolutionX;
+  const int resZ = m_data.config.resolutionZ;
+
+  // 同じパラメータのホール同士を対応付ける（追加・削除で番号がずれても
+  // 残ったホールの結果は変わらない）
+  std::vector<int> prevForNext(next.size(), -1);
+  std::vector<bool> prevMatched(prev.size(), false);
+  for (size_t j = 0; j < next.size(); ++j) {
+    for (size_t i = 0; i < prev.size(); ++i) {
+      if (!prevMatched[i] && prev[i] == next[j]) {
+        prevMatched[i] = true;
+        prevForNext[j] = static_cast<int>(i);
+        break;
+      }
+    }
+  }
+
+  TerrainRect rect;
+  changedCount = 0;
+  for (size_t i = 0; i < prev.size(); ++i) {
+    if (!prevMatched[i]) {
+      rect = rect.Union(prev[i].AffectedRect(resX, resZ));
+      ++changedCount;
+    }
+  }
+  for (size_t j = 0; j < next.size(); ++j) {
+    if (prevForNext[j] < 0) {
+      rect = rect.Union(next[j].AffectedRect(resX, resZ));
+      ++changedCount;
+    }
+  }
+
+  // 残ったホールの並び順が入れ替わると、重なるセルの適用順が変わる。
+  // まれなケースなので対応付いたホール全体を作り直す
+  int lastPrev = -1;
+  bool reordered = false;
+  for (int i : prevForNext) {
+    if (i >= 0) {
+      reordered = reordered || i < lastPrev;
+      lastPrev = std::max(lastPrev, i);
+    }
+  }
+  if (reordered) {
+    for (const TerrainPlatform &p : next) {
+      rect = rect.Union(p.AffectedRect(resX, resZ));
+    }
+  }
+  return rect;
+}
+
+TerrainUpdateStats IncrementalTerrainGenerator::Update(core::ThreadPool *pool) {
+  TerrainUpdateStats stats;
+  const int resX = m_data.config.resolutionX;
+  const int resZ = m_data.config.resolutionZ;
+
+  if (m_needsRebuild) {
+    Rebuild(pool);
+    const TerrainRect full = TerrainRect::Full(resX, resZ);
+    stats.heightRect = full;
+    stats.smoothRect = full;
+    stats.vertexRect = full;
+    stats.changedPlatforms = m_platforms.size();
+    stats.fullRebuild = true;
+    return stats;
+  }
+
+  // 1) 基本形状（ノイズ・外周の壁）を dirty 範囲だけ作り直す
+  if (!m_baseDirty.IsEmpty()) {
+    std::swap(m_data.heightMap, m_baseHeights);
+    std::swap(m_data.materialMap, m_baseMaterials);
+    TerrainGenerator::GenerateBaseHeightMap(m_data, m_seed, m_baseDirty,
+                                            pool);
+    std::swap(m_data.heightMap, m_baseHeights);
+    std::swap(m_data.materialMap, m_baseMaterials);
+  }
+
+  // 2) ホールのパラメータを解き直し、変わったホールの範囲を加える
+  TerrainRect heightRect = m_baseDirty;
+  if (m_holesChanged || !m_baseDirty.IsEmpty()) {
+    std::vector<TerrainPlatform> next = TerrainGenerator::ResolvePlatforms(
+        m_data.config, m_baseHeights, m_baseMaterials, m_holes);
+    heightRect = heightRect.Union(DiffPlatforms(next, stats.changedPlatforms));
+    m_platforms = std::move(next);
+  }
+  stats.heightRect = heightRect;
+
+  TerrainRect normalRect;
+  if (!heightRect.IsEmpty()) {
+    // 3) 平滑化前の高さ: 基本形状にプラットフォームを適用し直す
+    std::swap(m_data.heightMap, m_rawHeights);
+    for (int z = heightRect.z0; z < heightRect.z1; ++z) {
+      const size_t row = static_cast<size_t>(z) * resX;
+      std::copy(m_baseHeights.begin() + row + heightRect.x0,
+                m_baseHeights.begin() + row + heightRect.x1,
+                m_data.heightMap.begin() + row + heightRect.x0);
+      std::copy(m_baseMaterials.begin() + row + heightRect.x0,
+                m_baseMaterials.begin() + row + heightRect.x1,
+                m_data.materialMap.begin() + row + heightRect.x0);
+    }
+    TerrainGenerator::ApplyPlatforms(m_data, m_platforms, heightRect, pool);
+    std::swap(m_data.heightMap, m_rawHeights);
+
+    // 4) 平滑化は halo 分だけ外側まで値が変わる
+    const SmoothingSettings &smoothing = m_data.config.smoothing;
+    stats.smoothRect =
+        heightRect.Expanded(SmoothingHalo(smoothing), resX, resZ);
+    SmoothHeightFieldRegion(m_rawHeights, m_data.heightMap, resX, resZ,
+                            smoothing, stats.smoothRect.x0,
+                            stats.smoothRect.z0, stats.smoothRect.x1,
+                            stats.smoothRect.z1, pool);
+
+    // 5) 法線は上下左右の高さを読む
+    normalRect = stats.smoothRect.Expanded(1, resX, resZ);
+    TerrainGenerator::CalculateNormals(m_data, normalRect, pool);
+  }
+
+  // 6) 頂点を書き戻し、接線は隣接三角形の分だけ広げて集め直す
+  const TerrainRect vertexRect = normalRect.Union(m_markDirty);
+  if (!vertexRect.IsEmpty()) {
+    TerrainGenerator::WriteVertices(m_data, m_holes, vertexRect, pool);
+    stats.vertexRect = vertexRect.Expanded(1, resX, resZ);
+    TerrainGenerator::ComputeGridTangents(m_data.vertices, resX, resZ,
+                                          stats.vertexRect, pool);
+  }
+
+  m_baseDirty = {};
+  m_markDirty = {};
+  m_holesChanged = false;
+  return stats;
+}
+
+} // namespace game::systems
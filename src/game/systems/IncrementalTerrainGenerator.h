@@ -0,0 +1,88 @@
+#pragma once
+/**
+ * @file IncrementalTerrainGenerator.h
+ * @brief 変更箇所（dirty 矩形）だけを再計算する地形生成器
+ */
+
+#include "TerrainGenerator.h"
+#include <DirectXMath.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace game::systems {
+
+/// @brief 差分再生成で書き換えた範囲
+struct TerrainUpdateStats {
+  TerrainRect heightRect; ///< 平滑化前の高さ・マテリアルを計算し直した範囲
+  TerrainRect smoothRect; ///< 平滑化後の高さを書き換えた範囲
+  TerrainRect vertexRect; ///< 頂点（法線・接線込み）を書き換えた範囲
+  size_t changedPlatforms = 0; ///< パラメータが変わったホール数
+  bool fullRebuild = false;    ///< 解像度変更などで全体を作り直した
+};
+
+/// @brief 差分再生成に対応した地形生成器
+/// @details TerrainGenerator と同じ各ステージを矩形単位で呼び出す。
+///          基本形状とプラットフォーム適用後（平滑化前）の高さを保持し、
+///          編集で dirty になった矩形について
+///          平滑化前の高さ → 平滑化（halo 分広げる）→ 法線（+1）
+///          → 頂点 → 接線（+1）の順に範囲を広げながら計算し直して、
+///          既存の TerrainData のバッファへ書き戻す。
+///          平滑化以外は全体生成とビット単位で一致し、平滑化後の高さも
+///          丸め誤差の範囲で一致する（誤差は編集を重ねても蓄積しない）。
+class IncrementalTerrainGenerator {
+public:
+  /// @brief 全体を生成し、差分更新用の中間バッファを保持する
+  /// @param pool 並列化に使うプール（nullptrなら単一スレッド）
+  const TerrainData &Generate(const std::string &articleText,
+                              const std::vector<DirectX::XMFLOAT2> &holes,
+                              const TerrainConfig &config,
+                              core::ThreadPool *pool);
+
+  /// @brief ホール配置を差し替える
+  /// @details 実際に再計算する範囲は Update 時にホールのパラメータを
+  ///          解き直して決める（先行ホールの影響でグリーン高さが変わる
+  ///          後続ホールも含める）。
+  void SetHoles(const std::vector<DirectX::XMFLOAT2> &holes);
+
+  /// @brief フィールドパラメータを差し替える
+  /// @details 解像度・ワールドサイズが変わる場合は全体を作り直し、
+  ///          それ以外は全体を dirty にする。
+  void SetConfig(const TerrainConfig &config);
+
+  /// @brief 基本形状から計算し直す矩形を追加する
+  void MarkDirty(const TerrainRect &rect);
+
+  /// @brief 未反映の変更があるか
+  bool HasPendingChanges() const;
+
+  /// @brief dirty 範囲だけを計算し直して TerrainData に書き戻す
+  TerrainUpdateStats Update(core::ThreadPool *pool);
+
+  const TerrainData &GetData() const { return m_data; }
+
+private:
+  void Rebuild(core::ThreadPool *pool);
+  TerrainRect HoleMarkRect(const DirectX::XMFLOAT2 &pos) const;
+  TerrainRect DiffPlatforms(const std::vector<TerrainPlatform> &next,
+                            size_t &changedCount) const;
+
+  TerrainData m_data;
+  std::vector<float> m_baseHeights;    ///< 基本形状（プラットフォーム前）
+  std::vector<uint8_t> m_baseMaterials;
+  std::vector<float> m_rawHeights;     ///< プラットフォーム適用後・平滑化前
+  std::vector<TerrainPlatform> m_platforms;
+  std::vector<DirectX::XMFLOAT2> m_holes;
+  uint32_t m_seed = 0;
+
+  TerrainRect m_baseDirty; ///< 基本形状から作り直す範囲
+  TerrainRect m_markDirty; ///< ホールの目印色だけ塗り直す範囲
+  bool m_holesChanged = false;
+  bool m_needsRebuild = false;
+};
+
+} // namespace game::systems
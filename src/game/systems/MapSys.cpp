@@ -123,7 +123,7 @@ void MapSys::RenderMinimap(core::GameContext &ctx) {
 
   ctx.world.Query<components::Transform, components::MeshRenderer>().Each(
       [&](ecs::Entity e, components::Transform &t, components::MeshRenderer &r) {
-        if (!r.isVisible)
+        if (!r.isVisible && !r.showOnMinimap)
           return;
         // スカイボックスはミニマップ描画対象外
         if (ctx.world.Has<components::Skybox>(e))
@@ -133,7 +133,7 @@ void MapSys::RenderMinimap(core::GameContext &ctx) {
             ctx.resource.LoadShader("Basic", L"Assets/shaders/BasicVS.hlsl",
                                     L"Assets/shaders/BasicPS.hlsl");
         auto *shaderPtr = ctx.resource.GetShader(shader);
-        if (!mesh || !shaderPtr)
+        if (!mesh || !shaderPtr || !mesh->IsValid() || !shaderPtr->IsValid())
           return;
 
         shaderPtr->Bind(context);
@@ -154,7 +154,10 @@ void MapSys::RenderMinimap(core::GameContext &ctx) {
           context->Unmap(m_cb.Get(), 0);
         }
 
-        if (r.hasTexture && r.textureSRV) {
+        if (r.minimapSRV) {
+          context->PSSetShaderResources(0, 1, r.minimapSRV.GetAddressOf());
+          context->PSSetSamplers(0, 1, m_samp.GetAddressOf());
+        } else if (r.hasTexture && r.textureSRV) {
           context->PSSetShaderResources(0, 1, r.textureSRV.GetAddressOf());
           context->PSSetSamplers(0, 1, m_samp.GetAddressOf());
         } else {
@@ -15,6 +15,8 @@
 #include "../components/Transform.h"
 #include "../components/WikiComponents.h"
 #include "PhysicsFriction.h"
+#include "SphereContactSolver.h"
+#include "TerrainSampler.h"
 #include <algorithm>
 #include <cmath>
 #include <vector>
@@ -188,90 +190,38 @@ static bool CheckSphereOBB(const XMFLOAT3 &spherePos, float radius,
   return true;
 }
 
+namespace {
+
 /**
- * @brief 地形の高さと法線を取得
+ * @brief 地形標本化の出力バッファ（ボディごとの SoA）
  */
-static bool GetTerrainHeightAndNormal(const TerrainData &terrain, float x,
-                                      float z, float &outHeight,
-                                      XMVECTOR &outNormal) {
-  float width = terrain.config.worldWidth;
-  float depth = terrain.config.worldDepth;
-  int resX = terrain.config.resolutionX;
-  int resZ = terrain.config.resolutionZ;
-
-  // UV座標 (0.0~1.0)
-  float u = (x / width) + 0.5f;
-  float v = 0.5f - (z / depth);
-
-  // 範囲外チェック
-  if (u < 0.0f || u >= 1.0f || v < 0.0f || v >= 1.0f) {
-    outHeight = 0.0f;
-    outNormal = XMVectorSet(0, 1, 0, 0);
-    return false;
+struct TerrainSampleBuffer {
+  std::vector<float> xs, zs;
+  std::vector<float> height, normalX, normalY, normalZ;
+  std::vector<uint8_t> material;
+
+  void Resize(size_t count) {
+    xs.resize(count);
+    zs.resize(count);
+    height.resize(count);
+    normalX.resize(count);
+    normalY.resize(count);
+    normalZ.resize(count);
+    material.resize(count);
   }
 
-  float fx = u * (resX - 1);
-  float fz = v * (resZ - 1);
-
-  int ix = static_cast<int>(fx);
-  int iz = static_cast<int>(fz);
-
-  // 境界クランプ
-  ix = std::clamp(ix, 0, resX - 2);
-  iz = std::clamp(iz, 0, resZ - 2);
-
-  float dx = fx - ix;
-  float dz = fz - iz;
-
-  // 安全なインデックスアクセス
-  auto GetHeightSafe = [&](int gx, int gz) -> float {
-    int idx = gz * resX + gx;
-    if (idx >= 0 && idx < static_cast<int>(terrain.heightMap.size())) {
-      return terrain.heightMap[idx];
-    }
-    return 0.0f;
-  };
-
-  auto GetNormalSafe = [&](int gx, int gz) -> XMVECTOR {
-    int idx = gz * resX + gx;
-    if (idx >= 0 && idx < static_cast<int>(terrain.normals.size())) {
-      XMVECTOR n = XMLoadFloat3(&terrain.normals[idx]);
-      // 法線が不正な場合はデフォルト値
-      if (IsVectorNaN(n)) {
-        return XMVectorSet(0, 1, 0, 0);
-      }
-      return n;
-    }
-    return XMVectorSet(0, 1, 0, 0);
-  };
-
-  float h00 = GetHeightSafe(ix, iz);
-  float h10 = GetHeightSafe(ix + 1, iz);
-  float h01 = GetHeightSafe(ix, iz + 1);
-  float h11 = GetHeightSafe(ix + 1, iz + 1);
-
-  XMVECTOR n00 = GetNormalSafe(ix, iz);
-  XMVECTOR n10 = GetNormalSafe(ix + 1, iz);
-  XMVECTOR n01 = GetNormalSafe(ix, iz + 1);
-  XMVECTOR n11 = GetNormalSafe(ix + 1, iz + 1);
-
-  // バイリニア補間
-  float h0 = h00 * (1.0f - dx) + h10 * dx;
-  float h1 = h01 * (1.0f - dx) + h11 * dx;
-  outHeight = h0 * (1.0f - dz) + h1 * dz;
-
-  // 法線の補間
-  XMVECTOR n0 = XMVectorLerp(n00, n10, dx);
-  XMVECTOR n1 = XMVectorLerp(n01, n11, dx);
-  outNormal = SafeNormalize(XMVectorLerp(n0, n1, dz));
-
-  // NaNチェック
-  if (IsNaN(outHeight)) {
-    outHeight = 0.0f;
+  TerrainSamples View() {
+    TerrainSamples out;
+    out.height = height.data();
+    out.normalX = normalX.data();
+    out.normalY = normalY.data();
+    out.normalZ = normalZ.data();
+    out.material = material.data();
+    return out;
   }
+};
 
-  return true;
-}
+} // namespace
 
 // ========================================
 // メイン物理システム
@@ -297,14 +247,26 @@ void PhysicsSystem(core::GameContext &ctx, float dt) {
   }
   events->events.clear();
 
+  // 球同士の接触ソルバー（ウォームスタート用のキャッシュをフレーム間で保持）
+  auto *sphereSolver = ctx.world.GetGlobal<SphereContactSolver>();
+  if (!sphereSolver) {
+    ctx.world.SetGlobal(SphereContactSolver{});
+    sphereSolver = ctx.world.GetGlobal<SphereContactSolver>();
+  }
+  std::vector<SphereBody> sphereBodies;
+  std::vector<RigidBody *> sphereOwners;
+
   // 地形データ取得
   TerrainData *terrainData = nullptr;
+  const TerrainSampler *terrainSampler = nullptr;
   ctx.world.Query<TerrainCollider>().Each(
       [&](ecs::Entity, TerrainCollider &tc) {
         if (tc.data) {
           terrainData = tc.data.get();
+          terrainSampler = tc.sampler.get();
         }
       });
+  TerrainSampleBuffer terrainSamples;
 
   // ホール情報収集
   struct HoleInfo {
@@ -374,8 +336,23 @@ void PhysicsSystem(core::GameContext &ctx, float dt) {
           staticBodies.push_back(info);
         });
 
+    // 地形の高さ・法線・マテリアルはサブステップ開始時の位置で
+    // 全ボディ分まとめて求める
+    if (terrainSampler) {
+      terrainSamples.Resize(dynamicBodies.size());
+      for (size_t i = 0; i < dynamicBodies.size(); ++i) {
+        terrainSamples.xs[i] = dynamicBodies[i].t->position.x;
+        terrainSamples.zs[i] = dynamicBodies[i].t->position.z;
+      }
+      terrainSampler->Sample(terrainSamples.xs.data(),
+                             terrainSamples.zs.data(), dynamicBodies.size(),
+                             terrainSamples.View());
+    }
+
     // 動的オブジェクトの更新
-    for (auto &body : dynamicBodies) {
+    for (size_t bodyIndex = 0; bodyIndex < dynamicBodies.size();
+         ++bodyIndex) {
+      auto &body = dynamicBodies[bodyIndex];
       Transform &t = *body.t;
       RigidBody &rb = *body.rb;
       Collider &col = *body.c;
@@ -412,16 +389,17 @@ void PhysicsSystem(core::GameContext &ctx, float dt) {
       bool isGrounded = false;
       XMVECTOR groundNormal = XMVectorSet(0, 1, 0, 0);
 
-      if (terrainData && col.type == ColliderType::Sphere) {
-        float terrainH = 0.0f;
-        XMVECTOR terrainN;
-
+      if (terrainSampler && col.type == ColliderType::Sphere) {
         float posX = XMVectorGetX(pos);
         float posY = XMVectorGetY(pos);
         float posZ = XMVectorGetZ(pos);
 
-        if (GetTerrainHeightAndNormal(*terrainData, posX, posZ, terrainH,
-                                      terrainN)) {
+        if (terrainSampler->Contains(posX, posZ)) {
+          float terrainH = terrainSamples.height[bodyIndex];
+          XMVECTOR terrainN =
+              XMVectorSet(terrainSamples.normalX[bodyIndex],
+                          terrainSamples.normalY[bodyIndex],
+                          terrainSamples.normalZ[bodyIndex], 0.0f);
           float ballBottom = posY - col.radius;
           float penetration = terrainH - ballBottom;
 
@@ -547,17 +525,8 @@ void PhysicsSystem(core::GameContext &ctx, float dt) {
 
         if (terrainData) {
           friction *= terrainData->config.friction;
-          if (!terrainData->materialMap.empty()) {
-            float u = XMVectorGetX(pos) / terrainData->config.worldWidth + 0.5f;
-            float v = 0.5f - XMVectorGetZ(pos) / terrainData->config.worldDepth;
-            int ix = (int)(u * (terrainData->config.resolutionX - 1));
-            int iz = (int)(v * (terrainData->config.resolutionZ - 1));
-            if (ix >= 0 && ix < terrainData->config.resolutionX && iz >= 0 &&
-                iz < terrainData->config.resolutionZ) {
-              mat =
-                  terrainData
-                      ->materialMap[iz * terrainData->config.resolutionX + ix];
-            }
+          if (terrainSampler) {
+            mat = terrainSamples.material[bodyIndex];
           }
           switch (mat) {
           case 1:
@@ -711,12 +680,65 @@ void PhysicsSystem(core::GameContext &ctx, float dt) {
         }
       }
     }
+
+    // 球同士の衝突（動的-動的、動的-静的球）
+    sphereBodies.clear();
+    sphereOwners.clear();
+    size_t dynamicSphereCount = 0;
+    for (auto &body : staticBodies) {
+      if (body.c->type != ColliderType::Sphere)
+        continue;
+
+      SphereBody sb;
+      sb.id = static_cast<uint32_t>(body.entity);
+      sb.position[0] = body.t->position.x;
+      sb.position[1] = body.t->position.y;
+      sb.position[2] = body.t->position.z;
+      sb.velocity[0] = body.rb->velocity.x;
+      sb.velocity[1] = body.rb->velocity.y;
+      sb.velocity[2] = body.rb->velocity.z;
+      sb.radius = body.c->radius;
+      sb.invMass = (body.rb->isStatic || body.rb->mass <= 0.0f)
+                       ? 0.0f
+                       : 1.0f / body.rb->mass;
+      sb.restitution = body.rb->restitution;
+      if (sb.invMass > 0.0f)
+        ++dynamicSphereCount;
+
+      sphereBodies.push_back(sb);
+      sphereOwners.push_back(body.rb);
+    }
+
+    if (dynamicSphereCount > 0 && sphereBodies.size() >= 2) {
+      sphereSolver->Solve(sphereBodies, subDt);
+
+      for (size_t i = 0; i < sphereBodies.size(); ++i) {
+        if (sphereBodies[i].invMass <= 0.0f)
+          continue;
+        sphereOwners[i]->velocity = {sphereBodies[i].velocity[0],
+                                     sphereBodies[i].velocity[1],
+                                     sphereBodies[i].velocity[2]};
+      }
+      for (const auto &contact : sphereSolver->GetContacts()) {
+        events->events.push_back(
+            {sphereBodies[contact.a].id, sphereBodies[contact.b].id});
+      }
+    } else {
+      sphereSolver->Reset();
+    }
   }
 
   // デバッグログ出力
   if (debugTimer > 0.25f) {
     debugTimer = 0.0f;
 
+    const auto &solverStats = sphereSolver->GetStats();
+    if (solverStats.contactCount > 0) {
+      LOG_DEBUG("Physics", "sphere contacts={} warm={} iterations={}",
+                solverStats.contactCount, solverStats.warmStartedCount,
+                solverStats.iterations);
+    }
+
     ctx.world.Query<Transform, RigidBody, Collider>().Each(
         [&](ecs::Entity e, Transform &t, RigidBody &rb, Collider &) {
           if (golfState && e == golfState->ballEntity) {
@@ -12,6 +12,8 @@ namespace game::systems {
  * @brief 物理演算の更新処理を行います
  *
  * オイラー法による移動積分と、簡易的な球体・矩形の衝突解決を行います。
+ * 球同士の接触は SphereContactSolver（空間ハッシュ＋ウォームスタート付き
+ * 逐次インパルス）で解きます。
  *
  * @param ctx ゲームコンテキスト (World, Input等へのアクセス)
  * @param dt デルタタイム (秒)
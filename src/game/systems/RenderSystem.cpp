@@ -1,11 +1,14 @@
 #include "RenderSystem.h"
 #include "../../ecs/World.h"
 #include "../../graphics/GraphicsDevice.h"
+#include "../../graphics/MeshSimplifier.h"
 #include "../../resources/ResourceManager.h"
 #include "../components/Camera.h"
 #include "../components/MeshRenderer.h"
 #include "../components/Transform.h"
 #include <DirectXMath.h>
+#include <algorithm>
+#include <cmath>
 #include <d3d11.h>
 #include <wrl/client.h>
 
@@ -23,6 +26,7 @@ struct VSConstants {
       materialFlags; // x: hasTexture, y: hasNormalMap, z: padding, w: padding
   XMFLOAT4 lightDir;
   XMFLOAT4 cameraPos;
+  XMFLOAT4 virtualTexture; // x, y: 大きさ（タイル単位）, z: 有効
 };
 
 struct RenderState {
@@ -100,6 +104,10 @@ void RenderSystem(core::GameContext &ctx) {
     proj = XMMatrixPerspectiveFovLH(XM_PIDIV4, 16.0f / 9.0f, 0.01f, 100.0f);
   }
 
+  // LOD 選択用（_22 = 1 / tan(fovY / 2)）
+  const float projectionScaleY = XMVectorGetY(proj.r[1]);
+  const float viewportHeight = static_cast<float>(ctx.graphics.GetHeight());
+
   // 転置（HLSLは列優先）
   view = XMMatrixTranspose(view);
   proj = XMMatrixTranspose(proj);
@@ -118,7 +126,8 @@ void RenderSystem(core::GameContext &ctx) {
         auto *mesh = ctx.resource.GetMesh(r.mesh);
         auto *shader = ctx.resource.GetShader(r.shader);
 
-        if (mesh && shader) {
+        // 非同期ロード中の空のメッシュ・シェーダーは描かない
+        if (mesh && shader && mesh->IsValid() && shader->IsValid()) {
           shader->Bind(context);
 
           // 定数バッファ更新
@@ -126,7 +135,10 @@ void RenderSystem(core::GameContext &ctx) {
           if (SUCCEEDED(context->Map(state->cBuffer.Get(), 0,
                                      D3D11_MAP_WRITE_DISCARD, 0, &mapped))) {
             VSConstants *constants = static_cast<VSConstants *>(mapped.pData);
-            constants->world = XMMatrixTranspose(t.GetWorldMatrix());
+            // 量子化した頂点のメッシュは位置の戻しを先に掛ける
+            constants->world = XMMatrixTranspose(
+                XMLoadFloat4x4(&mesh->GetPositionTransform()) *
+                t.GetWorldMatrix());
             constants->view = view;
             constants->projection = proj;
             constants->materialColor = r.color;
@@ -138,6 +150,10 @@ void RenderSystem(core::GameContext &ctx) {
             // 簡易ライティング用 (左上奥からの光)
             constants->lightDir = {0.5f, -1.0f, 0.5f, 0.0f};
             constants->cameraPos = camPos;
+            const bool hasVirtual = r.virtualTexture.z > 0.0f &&
+                                    r.virtualAtlasSRV && r.pageTableSRV;
+            constants->virtualTexture =
+                hasVirtual ? r.virtualTexture : XMFLOAT4{0, 0, 0, 0};
             context->Unmap(state->cBuffer.Get(), 0);
           }
 
@@ -155,11 +171,27 @@ void RenderSystem(core::GameContext &ctx) {
             context->PSSetShaderResources(1, 1, &nullSRV);
           }
 
+          // 仮想テクスチャのアトラスとページテーブル
+          ID3D11ShaderResourceView *virtualSRVs[2] = {
+              r.virtualAtlasSRV.Get(), r.pageTableSRV.Get()};
+          context->PSSetShaderResources(2, 2, virtualSRVs);
+
           context->PSSetSamplers(0, 1, state->sampler.GetAddressOf());
           context->PSSetSamplers(1, 1, state->sampler.GetAddressOf());
 
+          // 画面上の大きさで LOD を選ぶ（遠く・小さいものは粗い段で描く）
+          const float scale = std::max({std::fabs(t.scale.x),
+                                        std::fabs(t.scale.y),
+                                        std::fabs(t.scale.z)});
+          const float distance = XMVectorGetX(XMVector3Length(
+              XMVectorSubtract(XMLoadFloat3(&t.position),
+                               XMLoadFloat4(&camPos))));
+          const float screenSize = graphics::ProjectedSizePixels(
+              mesh->GetExtent() * scale, distance, projectionScaleY,
+              viewportHeight);
+
           mesh->Bind(context);
-          mesh->Draw(context);
+          mesh->Draw(context, mesh->SelectLod(screenSize));
         }
       });
 }
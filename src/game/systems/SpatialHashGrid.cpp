@@ -0,0 +1,71 @@
+/**
+ * @file SpatialHashGrid.cpp
+ * @brief 一様グリッド空間ハッシュの実装
+ */
+
+#include "SpatialHashGrid.h"
+#include <algorithm>
+
+namespace game::systems {
+
+void SpatialHashGrid::Build(const float *xs, const float *ys, const float *zs,
+                            size_t count, float cellSize) {
+  m_count = static_cast<uint32_t>(count);
+  m_invCellSize = (cellSize > 0.0f) ? 1.0f / cellSize : 1.0f;
+
+  // 要素の AABB をセル単位で求める（近傍探索がはみ出す分 ±1 の余白を取る）
+  int minCell[3] = {0, 0, 0};
+  int maxCell[3] = {0, 0, 0};
+  if (count > 0) {
+    const float *axes[3] = {xs, ys, zs};
+    for (int a = 0; a < 3; ++a) {
+      const auto [lo, hi] = std::minmax_element(axes[a], axes[a] + count);
+      minCell[a] = CellCoord(*lo) - 1;
+      maxCell[a] = CellCoord(*hi) + 1;
+    }
+  }
+  for (int a = 0; a < 3; ++a) {
+    m_minCell[a] = minCell[a];
+  }
+  m_dimX = static_cast<uint32_t>(maxCell[0] - minCell[0] + 1);
+  m_dimY = static_cast<uint32_t>(maxCell[1] - minCell[1] + 1);
+  const uint64_t dimZ = static_cast<uint64_t>(maxCell[2] - minCell[2] + 1);
+  const uint64_t cellCount = static_cast<uint64_t>(m_dimX) * m_dimY * dimZ;
+
+  // 全セルが収まるなら衝突なし、広すぎるときは要素数の8倍で折り返す
+  const uint64_t wanted =
+      std::min<uint64_t>(cellCount, std::max<uint64_t>(count * 8, 64));
+  uint32_t tableSize = 64;
+  while (tableSize < wanted) {
+    tableSize <<= 1;
+  }
+  m_tableMask = tableSize - 1;
+
+  m_itemBucket.resize(count);
+  m_slotCell.resize(count);
+  m_cellStart.assign(static_cast<size_t>(tableSize) + 1, 0);
+  m_sortedIndices.resize(count);
+
+  // 1) 各要素のバケットを求めてヒストグラムを作る
+  for (uint32_t i = 0; i < m_count; ++i) {
+    const CellKey key{CellCoord(xs[i]), CellCoord(ys[i]), CellCoord(zs[i])};
+    const uint32_t bucket = HashCell(key.x, key.y, key.z);
+    m_itemBucket[i] = bucket;
+    ++m_cellStart[bucket + 1];
+  }
+
+  // 2) 排他的プレフィックスサム
+  for (uint32_t b = 0; b < tableSize; ++b) {
+    m_cellStart[b + 1] += m_cellStart[b];
+  }
+
+  // 3) 散布（インデックス昇順を保つ安定ソート）
+  std::vector<uint32_t> cursor(m_cellStart.begin(), m_cellStart.end() - 1);
+  for (uint32_t i = 0; i < m_count; ++i) {
+    const uint32_t slot = cursor[m_itemBucket[i]]++;
+    m_sortedIndices[slot] = i;
+    m_slotCell[slot] = {CellCoord(xs[i]), CellCoord(ys[i]), CellCoord(zs[i])};
+  }
+}
+
+} // namespace game::systems
@@ -0,0 +1,122 @@
+#pragma once
+/**
+ * @file SpatialHashGrid.h
+ * @brief 球同士のブロードフェーズ用 一様グリッド空間ハッシュ
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace game::systems {
+
+/// @brief 一様グリッドを空間ハッシュに写像した近傍探索構造
+/// @details Build のたびにカウンティングソートでバケットを作り直すため、
+///          毎サブステップ全体を再構築しても O(N) で済む。
+///          セルサイズを最大直径以上にしておけば、接触候補は
+///          周囲 3x3x3 セルに必ず含まれる。
+///
+///          ハッシュは「要素の AABB 内での線形セル番号をテーブルサイズで
+///          折り返したもの」にしている。X 方向に隣り合うセルが隣のバケットに
+///          並ぶため、スロット順に走査すると近傍アクセスがほぼ連続になる。
+///          AABB が広すぎて折り返しが起きても、セル座標を比較して除外する。
+class SpatialHashGrid {
+public:
+  /// @brief SoA 座標からグリッドを構築する
+  /// @param xs,ys,zs 各要素の中心座標
+  /// @param count 要素数
+  /// @param cellSize セルの一辺（最大直径以上にすること）
+  void Build(const float *xs, const float *ys, const float *zs, size_t count,
+             float cellSize);
+
+  /// @brief 点の周囲27セルに入っている要素を列挙する
+  /// @details 同じ要素が重複して渡されることはない（距離判定は呼び出し側で行う）。
+  template <typename Fn>
+  void ForEachCandidate(float x, float y, float z, Fn &&fn) const {
+    ForEachCandidateSlot(x, y, z,
+                         [&](uint32_t slot) { fn(m_sortedIndices[slot]); });
+  }
+
+  /// @brief ForEachCandidate のソート済みスロット版
+  /// @details スロット k はバケット順に並べた k 番目の要素を指す。
+  ///          呼び出し側がデータをスロット順に並べ替えておけば、
+  ///          近傍アクセスが連続メモリになりキャッシュミスが減る。
+  template <typename Fn>
+  void ForEachCandidateSlot(float x, float y, float z, Fn &&fn) const {
+    const int cx = CellCoord(x);
+    const int cy = CellCoord(y);
+    const int cz = CellCoord(z);
+    for (int dz = -1; dz <= 1; ++dz) {
+      for (int dy = -1; dy <= 1; ++dy) {
+        for (int dx = -1; dx <= 1; ++dx) {
+          const CellKey key{cx + dx, cy + dy, cz + dz};
+          const uint32_t bucket = HashCell(key.x, key.y, key.z);
+          const uint32_t end = m_cellStart[bucket + 1];
+          for (uint32_t k = m_cellStart[bucket]; k < end; ++k) {
+            // 同じバケットに衝突した別セルの要素は除外する。
+            // これにより同一要素を2度訪れることもない。
+            if (m_slotCell[k] == key) {
+              fn(k);
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /// @brief i < j となる候補ペアを列挙する
+  template <typename Fn>
+  void ForEachPair(const float *xs, const float *ys, const float *zs,
+                   Fn &&fn) const {
+    for (uint32_t i = 0; i < m_count; ++i) {
+      ForEachCandidate(xs[i], ys[i], zs[i], [&](uint32_t j) {
+        if (j > i) {
+          fn(i, j);
+        }
+      });
+    }
+  }
+
+  /// @brief スロット k に入っている要素のインデックス
+  uint32_t GetSortedIndex(size_t k) const { return m_sortedIndices[k]; }
+
+  /// @brief 登録されている要素数
+  size_t GetCount() const { return m_count; }
+
+  /// @brief ハッシュテーブルのバケット数
+  size_t GetBucketCount() const { return m_tableMask + 1; }
+
+private:
+  struct CellKey {
+    int x, y, z;
+    bool operator==(const CellKey &o) const {
+      return x == o.x && y == o.y && z == o.z;
+    }
+  };
+
+  int CellCoord(float v) const {
+    return static_cast<int>(std::floor(v * m_invCellSize));
+  }
+
+  uint32_t HashCell(int cx, int cy, int cz) const {
+    const uint32_t lx = static_cast<uint32_t>(cx - m_minCell[0]);
+    const uint32_t ly = static_cast<uint32_t>(cy - m_minCell[1]);
+    const uint32_t lz = static_cast<uint32_t>(cz - m_minCell[2]);
+    return ((lz * m_dimY + ly) * m_dimX + lx) & m_tableMask;
+  }
+
+  float m_invCellSize = 1.0f;
+  uint32_t m_tableMask = 0;
+  int m_minCell[3] = {0, 0, 0}; ///< AABB 最小セル
+  uint32_t m_dimX = 1;          ///< AABB の X セル数（近傍分の余白込み）
+  uint32_t m_dimY = 1;          ///< AABB の Y セル数（近傍分の余白込み）
+  uint32_t m_count = 0;
+  std::vector<uint32_t> m_itemBucket;    ///< 要素 -> バケット
+  std::vector<uint32_t> m_cellStart;     ///< バケット先頭（要素数+1）
+  std::vector<uint32_t> m_sortedIndices; ///< バケット順に並べた要素
+  std::vector<CellKey> m_slotCell;       ///< スロットごとのセル座標
+};
+
+} // namespace game::systems
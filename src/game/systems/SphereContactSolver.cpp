@@ -0,0 +1,166 @@
+/**
+ * @file SphereContactSolver.cpp
+ * @brief 球同士の逐次インパルスソルバーの実装
+ */
+
+#include "SphereContactSolver.h"
+#include <algorithm>
+#include <cmath>
+
+namespace game::systems {
+
+const SphereSolverStats &
+SphereContactSolver::Solve(std::vector<SphereBody> &bodies, float dt) {
+  m_stats = {};
+  m_contacts.clear();
+  if (bodies.size() < 2 || dt <= 0.0f) {
+    m_impulseCache.clear();
+    return m_stats;
+  }
+
+  FindContacts(bodies, dt);
+  m_stats.contactCount = m_contacts.size();
+  if (m_contacts.empty()) {
+    m_impulseCache.clear();
+    return m_stats;
+  }
+
+  if (m_settings.warmStart) {
+    WarmStart(bodies);
+  }
+
+  // Gauss-Seidel 反復（累積インパルスを非負にクランプ）
+  const int maxIterations = std::max(m_settings.maxIterations, 1);
+  for (int iter = 0; iter < maxIterations; ++iter) {
+    float maxDelta = 0.0f;
+    for (auto &c : m_contacts) {
+      SphereBody &a = bodies[c.a];
+      SphereBody &b = bodies[c.b];
+
+      const float vn = (b.velocity[0] - a.velocity[0]) * c.normal[0] +
+                       (b.velocity[1] - a.velocity[1]) * c.normal[1] +
+                       (b.velocity[2] - a.velocity[2]) * c.normal[2];
+
+      const float lambda = (c.targetVelocity - vn) * c.normalMass;
+      const float newImpulse = std::max(c.impulse + lambda, 0.0f);
+      const float delta = newImpulse - c.impulse;
+      c.impulse = newImpulse;
+
+      for (int k = 0; k < 3; ++k) {
+        a.velocity[k] -= c.normal[k] * delta * a.invMass;
+        b.velocity[k] += c.normal[k] * delta * b.invMass;
+      }
+      // 質量に依らない収束判定のため、相対速度の変化量で見る
+      maxDelta = std::max(maxDelta, std::fabs(delta) / c.normalMass);
+    }
+
+    m_stats.iterations = iter + 1;
+    if (maxDelta < m_settings.convergenceVelocity) {
+      break;
+    }
+  }
+
+  StoreImpulses(bodies);
+  return m_stats;
+}
+
+void SphereContactSolver::FindContacts(const std::vector<SphereBody> &bodies,
+                                       float dt) {
+  const size_t count = bodies.size();
+  m_xs.resize(count);
+  m_ys.resize(count);
+  m_zs.resize(count);
+
+  float maxRadius = 0.0f;
+  for (size_t i = 0; i < count; ++i) {
+    m_xs[i] = bodies[i].position[0];
+    m_ys[i] = bodies[i].position[1];
+    m_zs[i] = bodies[i].position[2];
+    maxRadius = std::max(maxRadius, bodies[i].radius);
+  }
+  if (maxRadius <= 0.0f) {
+    return;
+  }
+
+  m_grid.Build(m_xs.data(), m_ys.data(), m_zs.data(), count,
+               maxRadius * 2.0f);
+
+  const float invDt = 1.0f / dt;
+  m_grid.ForEachPair(
+      m_xs.data(), m_ys.data(), m_zs.data(), [&](uint32_t i, uint32_t j) {
+        const SphereBody &a = bodies[i];
+        const SphereBody &b = bodies[j];
+        const float invMassSum = a.invMass + b.invMass;
+        if (invMassSum <= 0.0f) {
+          return; // 静的同士
+        }
+
+        const float dx = b.position[0] - a.position[0];
+        const float dy = b.position[1] - a.position[1];
+        const float dz = b.position[2] - a.position[2];
+        const float distSq = dx * dx + dy * dy + dz * dz;
+        const float minDist = a.radius + b.radius;
+        if (distSq >= minDist * minDist) {
+          return;
+        }
+
+        SphereContact c;
+        c.a = i;
+        c.b = j;
+        const float dist = std::sqrt(distSq);
+        if (dist > 1e-6f) {
+          c.normal[0] = dx / dist;
+          c.normal[1] = dy / dist;
+          c.normal[2] = dz / dist;
+        } // 完全に重なった場合は既定の上向き法線で押し離す
+        c.penetration = minDist - dist;
+        c.normalMass = 1.0f / invMassSum;
+
+        // 目標分離速度: 反発（十分速い衝突のみ）とめり込み補正の大きい方
+        const float vn =
+            (b.velocity[0] - a.velocity[0]) * c.normal[0] +
+            (b.velocity[1] - a.velocity[1]) * c.normal[1] +
+            (b.velocity[2] - a.velocity[2]) * c.normal[2];
+        const float restitution = std::max(a.restitution, b.restitution);
+        const float bounce = (-vn > m_settings.restitutionThreshold)
+                                 ? -vn * restitution
+                                 : 0.0f;
+        const float bias = m_settings.baumgarte * invDt *
+                           std::max(c.penetration - m_settings.penetrationSlop,
+                                    0.0f);
+        c.targetVelocity = std::max(bounce, bias);
+
+        m_contacts.push_back(c);
+      });
+}
+
+void SphereContactSolver::WarmStart(std::vector<SphereBody> &bodies) {
+  for (auto &c : m_contacts) {
+    auto it = m_impulseCache.find(PairKey(bodies[c.a].id, bodies[c.b].id));
+    if (it == m_impulseCache.end()) {
+      continue;
+    }
+    c.impulse = it->second;
+    SphereBody &a = bodies[c.a];
+    SphereBody &b = bodies[c.b];
+    for (int k = 0; k < 3; ++k) {
+      a.velocity[k] -= c.normal[k] * c.impulse * a.invMass;
+      b.velocity[k] += c.normal[k] * c.impulse * b.invMass;
+    }
+    ++m_stats.warmStartedCount;
+  }
+}
+
+void SphereContactSolver::StoreImpulses(
+    const std::vector<SphereBody> &bodies) {
+  // 今回存在しなかった接触は捨てる
+  m_impulseCache.clear();
+  m_impulseCache.reserve(m_contacts.size());
+  for (const auto &c : m_contacts) {
+    if (c.impulse > 0.0f) {
+      m_impulseCache[PairKey(bodies[c.a].id, bodies[c.b].id)] = c.impulse;
+    }
+  }
+}
+
+} // namespace game::systems
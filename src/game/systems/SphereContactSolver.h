@@ -0,0 +1,100 @@
+#pragma once
+/**
+ * @file SphereContactSolver.h
+ * @brief 球同士の接触を逐次インパルス法で解くソルバー（ウォームスタート付き）
+ */
+
+#include "SpatialHashGrid.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace game::systems {
+
+/// @brief ソルバーに渡す球体
+struct SphereBody {
+  uint32_t id = 0; ///< ウォームスタートの照合キー（Entity ID など）
+  float position[3] = {0.0f, 0.0f, 0.0f};
+  float velocity[3] = {0.0f, 0.0f, 0.0f};
+  float radius = 0.5f;
+  float invMass = 1.0f; ///< 0 なら静的（動かない）
+  float restitution = 0.5f;
+};
+
+/// @brief 1組の接触
+struct SphereContact {
+  uint32_t a = 0; ///< bodies 内のインデックス
+  uint32_t b = 0;
+  float normal[3] = {0.0f, 1.0f, 0.0f}; ///< a -> b
+  float penetration = 0.0f;
+  float normalMass = 0.0f;     ///< 1 / (invMassA + invMassB)
+  float targetVelocity = 0.0f; ///< 反発・めり込み補正込みの目標分離速度
+  float impulse = 0.0f;        ///< 累積法線インパルス
+};
+
+/// @brief ソルバー設定
+struct SphereSolverSettings {
+  int maxIterations = 10;           ///< 反復回数の上限
+  float convergenceVelocity = 1e-3f; ///< 1反復の最大速度補正がこれ未満なら打ち切り
+  float baumgarte = 0.2f;           ///< めり込み補正の強さ
+  float penetrationSlop = 0.005f;   ///< 補正しない許容めり込み量
+  float restitutionThreshold = 1.0f; ///< これ未満の接近速度では反発させない
+  bool warmStart = true;            ///< 前ステップの累積インパルスを初期値に使う
+};
+
+/// @brief 直近の Solve の統計
+struct SphereSolverStats {
+  size_t contactCount = 0;
+  size_t warmStartedCount = 0; ///< キャッシュから初期値を得た接触数
+  int iterations = 0;          ///< 実際に回した反復回数
+};
+
+/// @brief 動的球同士（および静的球）の接触ソルバー
+/// @details 空間ハッシュで候補ペアを絞り、接触ごとに累積インパルスを
+///          非負にクランプしながら Gauss-Seidel 反復する。
+///          前ステップの累積インパルスを ID ペアで引き継ぐため、
+///          積み重なった状態では数回の反復で収束する。
+///          速度のみを更新するので、位置の積分は呼び出し側で行う。
+class SphereContactSolver {
+public:
+  void SetSettings(const SphereSolverSettings &settings) {
+    m_settings = settings;
+  }
+  const SphereSolverSettings &GetSettings() const { return m_settings; }
+
+  /// @brief 接触を検出して速度を解く
+  /// @param bodies 球の配列（velocity が更新される）
+  /// @param dt ステップ時間
+  const SphereSolverStats &Solve(std::vector<SphereBody> &bodies, float dt);
+
+  /// @brief 直近の Solve で見つかった接触
+  const std::vector<SphereContact> &GetContacts() const { return m_contacts; }
+
+  const SphereSolverStats &GetStats() const { return m_stats; }
+
+  /// @brief ウォームスタート用キャッシュを破棄
+  void Reset() { m_impulseCache.clear(); }
+
+private:
+  void FindContacts(const std::vector<SphereBody> &bodies, float dt);
+  void WarmStart(std::vector<SphereBody> &bodies);
+  void StoreImpulses(const std::vector<SphereBody> &bodies);
+
+  static uint64_t PairKey(uint32_t idA, uint32_t idB) {
+    if (idA > idB) {
+      std::swap(idA, idB);
+    }
+    return (static_cast<uint64_t>(idA) << 32) | idB;
+  }
+
+  SphereSolverSettings m_settings;
+  SphereSolverStats m_stats;
+  SpatialHashGrid m_grid;
+  std::vector<float> m_xs, m_ys, m_zs;
+  std::vector<SphereContact> m_contacts;
+  std::unordered_map<uint64_t, float> m_impulseCache;
+};
+
+} // namespace game::systems
@@ -0,0 +1,51 @@
+/**
+ * @file TerrainBiome.cpp
+ * @brief バイオームのキーワード表と採点
+ */
+
+#include "TerrainBiome.h"
+#include "../../core/KeywordClassifier.h"
+
+namespace game::systems {
+
+namespace {
+
+/// @brief バイオーム番号の順にラベルを登録した分類器
+core::KeywordClassifier BuildBiomeClassifier() {
+  core::KeywordClassifier classifier;
+  const uint32_t desert = classifier.AddLabel("Desert");
+  classifier.AddKeywords(desert, {"歴史", "戦争", "事件", "政治", "古代"});
+  const uint32_t iceField = classifier.AddLabel("IceField");
+  classifier.AddKeywords(iceField, {"科学", "技術", "数学", "物理",
+                                    "コンピュータ", "宇宙"});
+  const uint32_t rocky = classifier.AddLabel("Rocky");
+  classifier.AddKeywords(rocky, {"地理", "地形", "生物", "植物", "動物", "山"});
+  // カテゴリ名は短いので、1つのカテゴリで同じ語は1度だけ数える
+  classifier.SetMaxHitsPerKeyword(1);
+  classifier.Compile();
+  return classifier;
+}
+
+} // namespace
+
+int ClassifyTerrainBiome(const std::vector<std::string> &categories,
+                         float *confidence) {
+  static const core::KeywordClassifier classifier = BuildBiomeClassifier();
+
+  std::vector<core::KeywordSource> sources;
+  sources.reserve(categories.size());
+  for (const std::string &category : categories) {
+    sources.push_back({category, 1.0f});
+  }
+  std::vector<core::KeywordScore> ranked;
+  classifier.Classify(sources, ranked);
+  if (ranked.empty()) {
+    return -1;
+  }
+  if (confidence) {
+    *confidence = ranked.front().confidence;
+  }
+  return static_cast<int>(ranked.front().label) + 1;
+}
+
+} // namespace game::systems
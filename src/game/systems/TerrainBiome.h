@@ -0,0 +1,23 @@
+#pragma once
+/**
+ * @file TerrainBiome.h
+ * @brief 記事のカテゴリから地形のバイオームを選ぶ
+ */
+
+#include <string>
+#include <vector>
+
+namespace game::systems {
+
+/**
+ * @brief 全カテゴリを1回ずつ走査して、最も点の高いバイオームを返す
+ * @details 1: 砂漠（歴史・政治）、2: 氷原（科学・技術）、3: 岩場（地理・生物）。
+ *          キーワード表は初回の呼び出しで1度だけオートマトンにする。
+ *          同点は 1, 2, 3 の順で決める。
+ * @param confidence nullptr でなければ選んだバイオームの点の割合（0〜1）
+ * @return どのカテゴリも当たらなければ -1（呼び出し側で既定を選ぶ）
+ */
+int ClassifyTerrainBiome(const std::vector<std::string> &categories,
+                         float *confidence = nullptr);
+
+} // namespace game::systems
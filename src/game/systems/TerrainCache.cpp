@@ -0,0 +1,614 @@
+/**
+ * @file TerrainCache.cpp
+ * @brief 生成済み地形のディスクキャッシュの実装
+ */
+
+#include "TerrainCache.h"
+#include "../../core/Hash.h"
+#include "../../core/Logger.h"
+#include "../../core/MappedFile.h"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace game::systems {
+
+namespace {
+
+constexpr char kMagic[4] = {'W', 'G', 'T', 'C'};
+constexpr const char *kExtension = ".wgterrain";
+
+/// @brief 要素間の差分の取り方
+enum class Delta : uint32_t {
+  None = 0, ///< バイト列をそのままランレングス（マテリアル）
+  Xor = 1,  ///< 32bit 語ごとに直前の要素と XOR（浮動小数点）
+  Sub = 2,  ///< 32bit 語ごとに直前の要素との差（インデックス）
+};
+
+/// @brief 保存する配列の並び
+enum Section : uint32_t {
+  kHeights,
+  kMaterials,
+  kNormals,
+  kVertices,
+  kIndices,
+  kSectionCount,
+};
+
+struct SectionHeader {
+  uint64_t offset = 0;      ///< ファイル先頭からの位置
+  uint64_t packedBytes = 0; ///< 圧縮後の大きさ
+  uint64_t rawBytes = 0;    ///< 展開後の大きさ
+  uint32_t delta = 0;       ///< Delta
+  uint32_t lanes = 0;       ///< 1要素あたりの 32bit 語数
+};
+
+struct FileHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t headerBytes;
+  uint32_t sectionCount;
+  uint64_t keyHi;
+  uint64_t keyLo;
+  int32_t resolutionX;
+  int32_t resolutionZ;
+  uint64_t vertexCount;
+  uint64_t indexCount;
+  uint64_t payloadBytes;
+  uint64_t payloadChecksum;
+  SectionHeader sections[kSectionCount];
+  uint64_t headerChecksum; ///< この手前までのチェックサム
+};
+
+static_assert(std::is_trivially_copyable_v<FileHeader>);
+static_assert(sizeof(graphics::Vertex) % sizeof(uint32_t) == 0);
+
+using core::HashBytes;
+
+constexpr uint64_t kKeySeedHi = 0xcbf29ce484222325ull;
+constexpr uint64_t kKeySeedLo = 0x84222325cbf29ce4ull;
+constexpr uint64_t kChecksumSeed = 0x5754474300000001ull;
+
+template <typename T> void AppendPod(std::vector<uint8_t> &out, const T &v) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  const auto *p = reinterpret_cast<const uint8_t *>(&v);
+  out.insert(out.end(), p, p + sizeof(T));
+}
+
+// === ランレングス ===
+// 制御バイト c < 0x80 : 続く c+1 バイトをそのまま
+//            c >= 0x80: 続く1バイトを (c - 0x80) + 3 回繰り返す
+
+constexpr size_t kMinRun = 3;
+constexpr size_t kMaxRun = 0x7f + kMinRun;
+constexpr size_t kMaxLiteral = 0x80;
+
+void EncodeRle(const uint8_t *src, size_t size, std::vector<uint8_t> &out) {
+  size_t i = 0;
+  size_t literalStart = 0;
+  auto flushLiteral = [&](size_t end) {
+    while (literalStart < end) {
+      const size_t n = std::min(end - literalStart, kMaxLiteral);
+      out.push_back(static_cast<uint8_t>(n - 1));
+      out.insert(out.end(), src + literalStart, src + literalStart + n);
+      literalStart += n;
+    }
+  };
+  while (i < size) {
+    size_t run = 1;
+    while (i + run < size && run < kMaxRun && src[i + run] == src[i]) {
+      ++run;
+    }
+    if (run >= kMinRun) {
+      flushLiteral(i);
+      out.push_back(static_cast<uint8_t>(0x80 + run - kMinRun));
+      out.push_back(src[i]);
+      i += run;
+      literalStart = i;
+    } else {
+      i += run;
+    }
+  }
+  flushLiteral(size);
+}
+
+bool DecodeRle(const uint8_t *src, size_t size, uint8_t *dst,
+               size_t dstSize) {
+  size_t i = 0;
+  size_t o = 0;
+  while (i < size) {
+    const uint8_t c = src[i++];
+    if (c < 0x80) {
+      const size_t n = static_cast<size_t>(c) + 1;
+      if (n > size - i || n > dstSize - o) {
+        return false;
+      }
+      std::memcpy(dst + o, src + i, n);
+      i += n;
+      o += n;
+    } else {
+      const size_t n = static_cast<size_t>(c - 0x80) + kMinRun;
+      if (i >= size || n > dstSize - o) {
+        return false;
+      }
+      std::memset(dst + o, src[i++], n);
+      o += n;
+    }
+  }
+  return o == dstSize;
+}
+
+// === 語単位の差分＋バイト面分割 ===
+// 隣り合う要素の同じ成分は値が近いので、差分の上位バイトはほぼ 0 になる。
+// 語の各バイトを面ごとにまとめてからランレングスにかける。
+
+void EncodeSection(const void *data, size_t rawBytes, Delta delta,
+                   uint32_t lanes, std::vector<uint8_t> &out) {
+  const auto *bytes = static_cast<const uint8_t *>(data);
+  if (delta == Delta::None) {
+    EncodeRle(bytes, rawBytes, out);
+    return;
+  }
+  const size_t words = rawBytes / sizeof(uint32_t);
+  std::vector<uint8_t> planes(rawBytes);
+  uint32_t prevWord = 0;
+  for (size_t k = 0; k < words; ++k) {
+    uint32_t word;
+    std::memcpy(&word, bytes + k * 4, 4);
+    if (k >= lanes) {
+      std::memcpy(&prevWord, bytes + (k - lanes) * 4, 4);
+    } else {
+      prevWord = 0;
+    }
+    const uint32_t d =
+        (delta == Delta::Xor) ? (word ^ prevWord) : (word - prevWord);
+    for (size_t p = 0; p < 4; ++p) {
+      planes[p * words + k] = static_cast<uint8_t>(d >> (p * 8));
+    }
+  }
+  EncodeRle(planes.data(), planes.size(), out);
+}
+
+bool DecodeSection(const uint8_t *src, const SectionHeader &section,
+                   void *dst) {
+  auto *out = static_cast<uint8_t *>(dst);
+  const Delta delta = static_cast<Delta>(section.delta);
+  if (delta == Delta::None) {
+    return DecodeRle(src, section.packedBytes, out, section.rawBytes);
+  }
+  const size_t words = section.rawBytes / sizeof(uint32_t);
+  const size_t lanes = section.lanes;
+  std::vector<uint8_t> planes(section.rawBytes);
+  if (!DecodeRle(src, section.packedBytes, planes.data(), planes.size())) {
+    return false;
+  }
+  for (size_t k = 0; k < words; ++k) {
+    const uint32_t d = static_cast<uint32_t>(planes[k]) |
+                       (static_cast<uint32_t>(planes[words + k]) << 8) |
+                       (static_cast<uint32_t>(planes[2 * words + k]) << 16) |
+                       (static_cast<uint32_t>(planes[3 * words + k]) << 24);
+    uint32_t prevWord = 0;
+    if (k >= lanes) {
+      std::memcpy(&prevWord, out + (k - lanes) * 4, 4);
+    }
+    const uint32_t word =
+        (delta == Delta::Xor) ? (d ^ prevWord) : (d + prevWord);
+    std::memcpy(out + k * 4, &word, 4);
+  }
+  return true;
+}
+
+/// @brief 頂点を他のセクションとグリッド座標から予測し、予測値と XOR する
+/// @details 位置の y と法線はハイトマップ・法線配列の複製、x/z と UV は
+///          格子の座標なので、予測が当たった語は 0 になる。XOR なので
+///          同じ関数をもう一度かけると元に戻り、予測が外れても可逆。
+void XorVertexPrediction(graphics::Vertex *vertices, const float *heights,
+                         const DirectX::XMFLOAT3 *normals,
+                         const TerrainConfig &config) {
+  auto xorFloat = [](float &dst, float predicted) {
+    uint32_t a, b;
+    std::memcpy(&a, &dst, 4);
+    std::memcpy(&b, &predicted, 4);
+    a ^= b;
+    std::memcpy(&dst, &a, 4);
+  };
+  const int resX = config.resolutionX;
+  const int resZ = config.resolutionZ;
+  for (int z = 0; z < resZ; ++z) {
+    const float v = (float)z / (resZ - 1);
+    const float pz = (0.5f - v) * config.worldDepth;
+    for (int x = 0; x < resX; ++x) {
+      const size_t i = static_cast<size_t>(z) * resX + x;
+      const float u = (float)x / (resX - 1);
+      graphics::Vertex &vert = vertices[i];
+      xorFloat(vert.position.x, (u - 0.5f) * config.worldWidth);
+      xorFloat(vert.position.y, heights[i]);
+      xorFloat(vert.position.z, pz);
+      xorFloat(vert.normal.x, normals[i].x);
+      xorFloat(vert.normal.y, normals[i].y);
+      xorFloat(vert.normal.z, normals[i].z);
+      xorFloat(vert.texCoord.x, u);
+      xorFloat(vert.texCoord.y, v);
+    }
+  }
+}
+
+/// @brief 各セクションの保存元と期待する大きさ
+struct SectionSource {
+  const void *data;
+  size_t rawBytes;
+  Delta delta;
+  uint32_t lanes;
+};
+
+uint64_t ExpectedRawBytes(Section s, const FileHeader &h) {
+  const uint64_t cells = static_cast<uint64_t>(h.resolutionX) *
+                         static_cast<uint64_t>(h.resolutionZ);
+  switch (s) {
+  case kHeights:
+    return cells * sizeof(float);
+  case kMaterials:
+    return cells * sizeof(uint8_t);
+  case kNormals:
+    return cells * sizeof(DirectX::XMFLOAT3);
+  case kVertices:
+    return h.vertexCount * sizeof(graphics::Vertex);
+  case kIndices:
+    return h.indexCount * sizeof(uint32_t);
+  default:
+    return 0;
+  }
+}
+
+int64_t NowTicks() {
+  return static_cast<int64_t>(
+      std::filesystem::file_time_type::clock::now().time_since_epoch().count());
+}
+
+} // namespace
+
+std::string TerrainCacheKey::ToString() const {
+  static constexpr char kHex[] = "0123456789abcdef";
+  std::string s(32, '0');
+  for (int i = 0; i < 16; ++i) {
+    s[15 - i] = kHex[(hi >> (i * 4)) & 0xf];
+    s[31 - i] = kHex[(lo >> (i * 4)) & 0xf];
+  }
+  return s;
+}
+
+TerrainCache::TerrainCache(std::filesystem::path directory, uint64_t maxBytes)
+    : m_directory(std::move(directory)), m_maxBytes(maxBytes) {
+  std::error_code ec;
+  std::filesystem::create_directories(m_directory, ec);
+  ScanDirectory();
+}
+
+TerrainCacheKey
+TerrainCache::MakeKey(const std::string &articleText,
+                      const std::vector<DirectX::XMFLOAT2> &holePositions,
+                      const TerrainConfig &config) {
+  // 構造体をそのままハッシュするとパディングが混ざるので、1項目ずつ並べる
+  std::vector<uint8_t> bytes;
+  bytes.reserve(128 + articleText.size() + holePositions.size() * 8);
+  AppendPod(bytes, kFormatVersion);
+  AppendPod(bytes, static_cast<uint64_t>(articleText.size()));
+  bytes.insert(bytes.end(), articleText.begin(), articleText.end());
+  AppendPod(bytes, config.resolutionX);
+  AppendPod(bytes, config.resolutionZ);
+  AppendPod(bytes, config.worldWidth);
+  AppendPod(bytes, config.worldDepth);
+  AppendPod(bytes, config.baseHeight);
+  AppendPod(bytes, config.heightScale);
+  AppendPod(bytes, config.friction);
+  AppendPod(bytes, config.restitution);
+  AppendPod(bytes, static_cast<int32_t>(config.smoothing.mode));
+  AppendPod(bytes, static_cast<int32_t>(config.smoothing.edge));
+  AppendPod(bytes, config.smoothing.radius);
+  AppendPod(bytes, config.smoothing.sigma);
+  AppendPod(bytes, config.smoothing.iterations);
+  AppendPod(bytes, config.noiseAmplitude);
+  AppendPod(bytes, config.noiseFrequency);
+  AppendPod(bytes, config.noiseOctaves);
+  AppendPod(bytes, static_cast<uint64_t>(holePositions.size()));
+  for (const auto &hole : holePositions) {
+    AppendPod(bytes, hole.x);
+    AppendPod(bytes, hole.y);
+  }
+
+  TerrainCacheKey key;
+  key.hi = HashBytes(bytes.data(), bytes.size(), kKeySeedHi);
+  key.lo = HashBytes(bytes.data(), bytes.size(), kKeySeedLo);
+  return key;
+}
+
+std::filesystem::path TerrainCache::PathFor(const TerrainCacheKey &key) const {
+  return m_directory / (key.ToString() + kExtension);
+}
+
+void TerrainCache::ScanDirectory() {
+  m_entries.clear();
+  m_totalBytes = 0;
+  std::error_code ec;
+  for (std::filesystem::directory_iterator it(m_directory, ec), end;
+       !ec && it != end; it.increment(ec)) {
+    if (!it->is_regular_file(ec) || it->path().extension() != kExtension) {
+      continue;
+    }
+    Entry entry;
+    entry.bytes = it->file_size(ec);
+    const auto time = it->last_write_time(ec);
+    entry.lastUse = static_cast<int64_t>(time.time_since_epoch().count());
+    m_useCounter = std::max(m_useCounter, entry.lastUse);
+    m_totalBytes += entry.bytes;
+    m_entries[it->path().filename().string()] = entry;
+  }
+}
+
+void TerrainCache::Touch(const std::string &name, Entry &entry) {
+  // 時計の分解能で同時刻になっても順序が決まるように単調増加させる
+  m_useCounter = std::max(NowTicks(), m_useCounter + 1);
+  entry.lastUse = m_useCounter;
+  std::error_code ec;
+  std::filesystem::last_write_time(
+      m_directory / name,
+      std::filesystem::file_time_type(
+          std::filesystem::file_time_type::duration(
+              static_cast<std::filesystem::file_time_type::rep>(
+                  entry.lastUse))),
+      ec);
+}
+
+void TerrainCache::Remove(const std::string &name) {
+  auto it = m_entries.find(name);
+  if (it != m_entries.end()) {
+    m_totalBytes -= it->second.bytes;
+    m_entries.erase(it);
+  }
+  std::error_code ec;
+  std::filesystem::remove(m_directory / name, ec);
+}
+
+void TerrainCache::EvictToFit() {
+  if (m_totalBytes <= m_maxBytes) {
+    return;
+  }
+  std::vector<std::pair<int64_t, std::string>> order;
+  order.reserve(m_entries.size());
+  for (const auto &[name, entry] : m_entries) {
+    order.emplace_back(entry.lastUse, name);
+  }
+  std::sort(order.begin(), order.end());
+  for (const auto &[lastUse, name] : order) {
+    if (m_totalBytes <= m_maxBytes) {
+      break;
+    }
+    LOG_DEBUG("TerrainCache", "Evicting {}", name);
+    Remove(name);
+  }
+}
+
+bool TerrainCache::Load(const TerrainCacheKey &key, const TerrainConfig &config,
+                        TerrainData &out) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const std::string name = key.ToString() + kExtension;
+  auto entryIt = m_entries.find(name);
+  if (entryIt == m_entries.end()) {
+    return false;
+  }
+
+  TerrainData data;
+  bool valid = false;
+  {
+    core::MappedFile file;
+    if (file.Open(m_directory / name) && file.Size() >= sizeof(FileHeader)) {
+      FileHeader h;
+      std::memcpy(&h, file.Data(), sizeof(h));
+      const uint64_t headerSum =
+          HashBytes(file.Data(), offsetof(FileHeader, headerChecksum),
+                    kChecksumSeed);
+      valid = std::memcmp(h.magic, kMagic, sizeof(kMagic)) == 0 &&
+              h.version == kFormatVersion &&
+              h.headerBytes == sizeof(FileHeader) &&
+              h.sectionCount == kSectionCount &&
+              h.headerChecksum == headerSum &&
+              h.keyHi == key.hi && h.keyLo == key.lo &&
+              h.resolutionX == config.resolutionX &&
+              h.resolutionZ == config.resolutionZ &&
+              h.payloadBytes == file.Size() - sizeof(FileHeader);
+      for (uint32_t s = 0; valid && s < kSectionCount; ++s) {
+        const SectionHeader &sec = h.sections[s];
+        valid = sec.offset >= sizeof(FileHeader) &&
+                sec.offset <= file.Size() &&
+                sec.packedBytes <= file.Size() - sec.offset &&
+                sec.rawBytes == ExpectedRawBytes(static_cast<Section>(s), h) &&
+                sec.rawBytes <= sec.packedBytes * kMaxRun &&
+                sec.delta <= static_cast<uint32_t>(Delta::Sub) &&
+                (sec.delta == 0 ||
+                 (sec.lanes > 0 && sec.rawBytes % sizeof(uint32_t) == 0));
+      }
+      valid = valid && HashBytes(file.Data() + sizeof(FileHeader),
+                                 h.payloadBytes,
+                                 kChecksumSeed) == h.payloadChecksum;
+
+      if (valid) {
+        const size_t cells = static_cast<size_t>(h.resolutionX) *
+                             static_cast<size_t>(h.resolutionZ);
+        data.heightMap.resize(cells);
+        data.materialMap.resize(cells);
+        data.normals.resize(cells);
+        data.vertices.resize(h.vertexCount);
+        data.indices.resize(h.indexCount);
+        void *targets[kSectionCount] = {
+            data.heightMap.data(), data.materialMap.data(),
+            data.normals.data(), data.vertices.data(), data.indices.data()};
+        for (uint32_t s = 0; valid && s < kSectionCount; ++s) {
+          const SectionHeader &sec = h.sections[s];
+          valid = DecodeSection(file.Data() + sec.offset, sec, targets[s]);
+        }
+        if (valid && h.vertexCount == cells) {
+          XorVertexPrediction(data.vertices.data(), data.heightMap.data(),
+                              data.normals.data(), config);
+        }
+      }
+    }
+  }
+
+  if (!valid) {
+    LOG_WARN("TerrainCache", "Discarding invalid cache file {}", name);
+    Remove(name);
+    return false;
+  }
+
+  data.config = config;
+  out = std::move(data);
+  Touch(name, entryIt->second);
+  return true;
+}
+
+bool TerrainCache::Store(const TerrainCacheKey &key, const TerrainData &data) {
+  const TerrainConfig &config = data.config;
+  const size_t cells = static_cast<size_t>(config.resolutionX) *
+                       static_cast<size_t>(config.resolutionZ);
+  if (data.heightMap.size() != cells || data.materialMap.size() != cells ||
+      data.normals.size() != cells) {
+    return false;
+  }
+
+  // 格子状の頂点は予測との差だけを保存する
+  std::vector<graphics::Vertex> residual = data.vertices;
+  if (residual.size() == cells) {
+    XorVertexPrediction(residual.data(), data.heightMap.data(),
+                        data.normals.data(), config);
+  }
+
+  const SectionSource sources[kSectionCount] = {
+      {data.heightMap.data(), cells * sizeof(float), Delta::Xor, 1},
+      {data.materialMap.data(), cells, Delta::None, 0},
+      {data.normals.data(), cells * sizeof(DirectX::XMFLOAT3), Delta::Xor, 3},
+      {residual.data(), residual.size() * sizeof(graphics::Vertex),
+       Delta::Xor,
+       static_cast<uint32_t>(sizeof(graphics::Vertex) / sizeof(uint32_t))},
+      // グリッドのインデックスは1セル（2三角形 = 6個）ごとにほぼ +1 ずつ進む
+      {data.indices.data(), data.indices.size() * sizeof(uint32_t), Delta::Sub,
+       6},
+  };
+
+  FileHeader h{};
+  std::memcpy(h.magic, kMagic, sizeof(kMagic));
+  h.version = kFormatVersion;
+  h.headerBytes = sizeof(FileHeader);
+  h.sectionCount = kSectionCount;
+  h.keyHi = key.hi;
+  h.keyLo = key.lo;
+  h.resolutionX = config.resolutionX;
+  h.resolutionZ = config.resolutionZ;
+  h.vertexCount = data.vertices.size();
+  h.indexCount = data.indices.size();
+
+  // ヘッダーの場所を空けて後ろに詰め、最後にヘッダーを書き込む
+  std::vector<uint8_t> bytes(sizeof(FileHeader));
+  for (uint32_t s = 0; s < kSectionCount; ++s) {
+    const SectionSource &src = sources[s];
+    SectionHeader &sec = h.sections[s];
+    sec.offset = bytes.size();
+    sec.rawBytes = src.rawBytes;
+    sec.delta = static_cast<uint32_t>(src.delta);
+    sec.lanes = src.lanes;
+    EncodeSection(src.data, src.rawBytes, src.delta, src.lanes, bytes);
+    sec.packedBytes = bytes.size() - sec.offset;
+  }
+  h.payloadBytes = bytes.size() - sizeof(FileHeader);
+  h.payloadChecksum = HashBytes(bytes.data() + sizeof(FileHeader),
+                                h.payloadBytes, kChecksumSeed);
+  h.headerChecksum = HashBytes(reinterpret_cast<const uint8_t *>(&h),
+                               offsetof(FileHeader, headerChecksum),
+                               kChecksumSeed);
+  std::memcpy(bytes.data(), &h, sizeof(h));
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const std::string name = key.ToString() + kExtension;
+  if (!core::WriteFileAtomically(m_directory / name, bytes.data(),
+                                 bytes.size())) {
+    return false;
+  }
+
+  auto it = m_entries.find(name);
+  if (it != m_entries.end()) {
+    m_totalBytes -= it->second.bytes;
+  }
+  Entry &entry = m_entries[name];
+  entry.bytes = bytes.size();
+  m_totalBytes += entry.bytes;
+  Touch(name, entry);
+  EvictToFit();
+  return true;
+}
+
+TerrainData
+TerrainCache::GetOrGenerate(const std::string &articleText,
+                            const std::vector<DirectX::XMFLOAT2> &holePositions,
+                            const TerrainConfig &config, core::ThreadPool *pool,
+                            TerrainCacheStats *stats) {
+  const auto start = std::chrono::steady_clock::now();
+  const TerrainCacheKey key = MakeKey(articleText, holePositions, config);
+
+  TerrainData data;
+  const bool hit = Load(key, config, data);
+  if (!hit) {
+    data = TerrainGenerator::GenerateTerrain(articleText, holePositions, config,
+                                             pool);
+    Store(key, data);
+  }
+
+  if (stats) {
+    stats->hit = hit;
+    stats->elapsedMs = std::chrono::duration<double, std::milli>(
+                           std::chrono::steady_clock::now() - start)
+                           .count();
+    FillStats(key, data, *stats);
+  }
+  return data;
+}
+
+void TerrainCache::FillStats(const TerrainCacheKey &key,
+                             const TerrainData &data,
+                             TerrainCacheStats &stats) const {
+  std::error_code ec;
+  stats.fileBytes =
+      static_cast<size_t>(std::filesystem::file_size(PathFor(key), ec));
+  if (ec) {
+    stats.fileBytes = 0;
+  }
+  stats.rawBytes = data.heightMap.size() * sizeof(float) +
+                   data.materialMap.size() +
+                   data.normals.size() * sizeof(DirectX::XMFLOAT3) +
+                   data.vertices.size() * sizeof(graphics::Vertex) +
+                   data.indices.size() * sizeof(uint32_t);
+}
+
+void TerrainCache::Clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::vector<std::string> names;
+  names.reserve(m_entries.size());
+  for (const auto &[name, entry] : m_entries) {
+    names.push_back(name);
+  }
+  for (const auto &name : names) {
+    Remove(name);
+  }
+}
+
+uint64_t TerrainCache::GetTotalBytes() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_totalBytes;
+}
+
+size_t TerrainCache::GetEntryCount() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+} // namespace game::systems
@@ -0,0 +1,123 @@
+#pragma once
+/**
+ * @file TerrainCache.h
+ * @brief 生成済み地形のディスクキャッシュ（入力のハッシュで引く）
+ */
+
+#include "TerrainGenerator.h"
+#include <DirectXMath.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace game::systems {
+
+/// @brief 地形生成の入力（シード文字列・設定・ホール）から作るキー
+struct TerrainCacheKey {
+  uint64_t hi = 0;
+  uint64_t lo = 0;
+
+  bool operator==(const TerrainCacheKey &) const = default;
+
+  /// @brief ファイル名に使う32桁の16進文字列
+  std::string ToString() const;
+};
+
+/// @brief GetOrGenerate の結果
+struct TerrainCacheStats {
+  bool hit = false;
+  double elapsedMs = 0.0; ///< 読み込み、または生成＋保存にかかった時間
+  size_t fileBytes = 0;   ///< キャッシュファイルの大きさ
+  size_t rawBytes = 0;    ///< 圧縮前の大きさ
+};
+
+/// @brief 生成済み TerrainData を保存・再利用するディスクキャッシュ
+/// @details 地形は（シード文字列, TerrainConfig, ホール配置）から
+///          決定的に決まるので、その入力をハッシュしたキーをファイル名にする。
+///          ハイトマップ・マテリアル・法線・頂点・インデックスを
+///          要素ごとの差分＋バイト面分割＋ランレングスで可逆圧縮して保存し、
+///          読み込みはファイルをメモリマップして直接展開する。
+///          ヘッダ（マジック・版・キー・解像度・各セクションの範囲）と
+///          本体のチェックサムを検証し、壊れたファイルは削除して生成し直す。
+///          合計サイズが上限を超えたら最後に使った時刻が古い順に消す
+///          （使った時刻はファイルの更新時刻に記録するので再起動後も残る）。
+///          生成処理を変えたときは kFormatVersion を上げて古い結果を捨てる。
+class TerrainCache {
+public:
+  static constexpr uint32_t kFormatVersion = 1;
+  static constexpr uint64_t kDefaultMaxBytes = 256ull * 1024 * 1024;
+
+  /// @param directory キャッシュファイルを置くディレクトリ（なければ作る）
+  /// @param maxBytes 合計サイズの上限
+  explicit TerrainCache(std::filesystem::path directory,
+                        uint64_t maxBytes = kDefaultMaxBytes);
+
+  /// @brief 生成の入力からキーを作る
+  static TerrainCacheKey
+  MakeKey(const std::string &articleText,
+          const std::vector<DirectX::XMFLOAT2> &holePositions,
+          const TerrainConfig &config);
+
+  /// @brief キャッシュから読み込む
+  /// @return 見つからない・検証に失敗した場合は false（out は変更しない）
+  bool Load(const TerrainCacheKey &key, const TerrainConfig &config,
+            TerrainData &out);
+
+  /// @brief 地形を保存し、上限を超えた分を古い順に消す
+  bool Store(const TerrainCacheKey &key, const TerrainData &data);
+
+  /// @brief キャッシュにあれば読み込み、なければ生成して保存する
+  /// @param pool 生成に使うプール（nullptrなら単一スレッド）
+  TerrainData GetOrGenerate(const std::string &articleText,
+                            const std::vector<DirectX::XMFLOAT2> &holePositions,
+                            const TerrainConfig &config,
+                            core::ThreadPool *pool,
+                            TerrainCacheStats *stats = nullptr);
+
+  /// @brief キーのファイルの大きさと data の圧縮前の大きさを stats に入れる
+  void FillStats(const TerrainCacheKey &key, const TerrainData &data,
+                 TerrainCacheStats &stats) const;
+
+  /// @brief すべてのキャッシュファイルを消す
+  void Clear();
+
+  /// @brief 現在の合計サイズ
+  uint64_t GetTotalBytes() const;
+
+  /// @brief 保持しているファイル数
+  size_t GetEntryCount() const;
+
+  uint64_t GetMaxBytes() const { return m_maxBytes; }
+  const std::filesystem::path &GetDirectory() const { return m_directory; }
+
+  /// @brief キーに対応するファイルのパス
+  std::filesystem::path PathFor(const TerrainCacheKey &key) const;
+
+private:
+  struct Entry {
+    uint64_t bytes = 0;
+    int64_t lastUse = 0; ///< 大きいほど最近使った（ファイル時刻の刻み）
+  };
+
+  void ScanDirectory();
+  void Touch(const std::string &name, Entry &entry);
+  void Remove(const std::string &name);
+  void EvictToFit();
+
+  std::filesystem::path m_directory;
+  uint64_t m_maxBytes;
+  uint64_t m_totalBytes = 0;
+  int64_t m_useCounter = 0;
+  std::unordered_map<std::string, Entry> m_entries;
+  mutable std::mutex m_mutex;
+};
+
+} // namespace game::systems
@@ -0,0 +1,357 @@
+/**
+ * @file TerrainChunks.cpp
+ * @brief 四分木 LOD 地形の構築と選択
+ */
+
+#include "TerrainChunks.h"
+#include "../../core/ThreadPool.h"
+#include "TerrainGenerator.h"
+#include <algorithm>
+#include <cmath>
+
+namespace game::systems {
+
+namespace {
+
+/// @brief 1タスクで処理するチャンク数
+constexpr int kChunksPerTask = 4;
+
+/// @brief プールがあれば並列、なければそのまま実行
+template <typename Fn>
+void RunRange(core::ThreadPool *pool, int count, int grain, Fn &&fn) {
+  if (count <= 0) {
+    return;
+  }
+  if (pool && count > grain) {
+    pool->ParallelFor(static_cast<size_t>(count), static_cast<size_t>(grain),
+                      [&](size_t begin, size_t end) {
+                        fn(static_cast<int>(begin), static_cast<int>(end));
+                      });
+  } else {
+    fn(0, count);
+  }
+}
+
+/// @brief [first, last] を stride おきに取った頂点番号（last は必ず含む）
+std::vector<int> SampleLine(int first, int last, int stride) {
+  std::vector<int> samples;
+  samples.reserve(static_cast<size_t>((last - first) / stride + 2));
+  for (int i = first; i < last; i += stride) {
+    samples.push_back(i);
+  }
+  samples.push_back(last);
+  return samples;
+}
+
+/// @brief 地表のグリッドを作り、誤差と境界を求める
+void BuildSurface(TerrainChunk &chunk, const TerrainData &data) {
+  const int resX = data.config.resolutionX;
+  const std::vector<int> xs =
+      SampleLine(chunk.cellX0, chunk.cellX1, chunk.stride);
+  const std::vector<int> zs =
+      SampleLine(chunk.cellZ0, chunk.cellZ1, chunk.stride);
+  const int nx = static_cast<int>(xs.size());
+  const int nz = static_cast<int>(zs.size());
+  auto fullVertex = [&](int x, int z) -> const graphics::Vertex & {
+    return data.vertices[static_cast<size_t>(z) * resX + x];
+  };
+
+  // 頂点（スカートの分も確保しておく）
+  const size_t ringCount = 2 * static_cast<size_t>(nx - 1 + nz - 1);
+  chunk.vertices.clear();
+  chunk.vertices.reserve(static_cast<size_t>(nx) * nz + ringCount);
+  for (int z : zs) {
+    for (int x : xs) {
+      chunk.vertices.push_back(fullVertex(x, z));
+    }
+  }
+
+  // インデックス（TerrainGenerator::GenerateMesh と同じ分割・巻き順）
+  chunk.indices.clear();
+  chunk.indices.reserve(static_cast<size_t>(nx - 1) * (nz - 1) * 6 +
+                        ringCount * 6);
+  for (int r = 0; r + 1 < nz; ++r) {
+    for (int c = 0; c + 1 < nx; ++c) {
+      uint32_t i0 = r * nx + c;
+      uint32_t i1 = r * nx + (c + 1);
+      uint32_t i2 = (r + 1) * nx + c;
+      uint32_t i3 = (r + 1) * nx + (c + 1);
+      chunk.indices.insert(chunk.indices.end(), {i0, i1, i2, i2, i1, i3});
+    }
+  }
+  chunk.surfaceIndexCount = static_cast<uint32_t>(chunk.indices.size());
+
+  // 元の解像度の各頂点について、間引いたメッシュ上の高さとの差を測る
+  float minY = fullVertex(xs[0], zs[0]).position.y;
+  float maxY = minY;
+  float error = 0.0f;
+  for (int r = 0; r + 1 < nz; ++r) {
+    const int za = zs[r];
+    const int zb = zs[r + 1];
+    for (int c = 0; c + 1 < nx; ++c) {
+      const int xa = xs[c];
+      const int xb = xs[c + 1];
+      const float h0 = fullVertex(xa, za).position.y;
+      const float h1 = fullVertex(xb, za).position.y;
+      const float h2 = fullVertex(xa, zb).position.y;
+      const float h3 = fullVertex(xb, zb).position.y;
+      for (int z = za; z <= zb; ++z) {
+        const float fz = static_cast<float>(z - za) / (zb - za);
+        for (int x = xa; x <= xb; ++x) {
+          const float fx = static_cast<float>(x - xa) / (xb - xa);
+          const float h = fullVertex(x, z).position.y;
+          minY = std::min(minY, h);
+          maxY = std::max(maxY, h);
+          // 三角形 0-1-2 と 2-1-3 の平面で補間
+          const float approx =
+              (fx + fz <= 1.0f)
+                  ? h0 + (h1 - h0) * fx + (h2 - h0) * fz
+                  : h3 + (h2 - h3) * (1.0f - fx) + (h1 - h3) * (1.0f - fz);
+          if (chunk.stride > 1) { // 葉は元の格子そのもの（丸め誤差は無視）
+            error = std::max(error, std::abs(approx - h));
+          }
+        }
+      }
+    }
+  }
+  chunk.geometricError = error;
+
+  const auto &p0 = fullVertex(xs.front(), zs.front()).position;
+  const auto &p1 = fullVertex(xs.back(), zs.back()).position;
+  chunk.bounds.min[0] = std::min(p0.x, p1.x);
+  chunk.bounds.max[0] = std::max(p0.x, p1.x);
+  chunk.bounds.min[1] = minY;
+  chunk.bounds.max[1] = maxY;
+  chunk.bounds.min[2] = std::min(p0.z, p1.z);
+  chunk.bounds.max[2] = std::max(p0.z, p1.z);
+}
+
+/// @brief 外周を一周する頂点列に沿ってスカートを足す
+void AddSkirt(TerrainChunk &chunk, float depth) {
+  const int nx = static_cast<int>(
+      SampleLine(chunk.cellX0, chunk.cellX1, chunk.stride).size());
+  const int nz = static_cast<int>(
+      SampleLine(chunk.cellZ0, chunk.cellZ1, chunk.stride).size());
+
+  // 上辺 → 右辺 → 下辺 → 左辺の順に一周
+  std::vector<uint32_t> ring;
+  ring.reserve(2 * static_cast<size_t>(nx - 1 + nz - 1));
+  for (int c = 0; c < nx - 1; ++c) {
+    ring.push_back(c);
+  }
+  for (int r = 0; r < nz - 1; ++r) {
+    ring.push_back(r * nx + (nx - 1));
+  }
+  for (int c = nx - 1; c > 0; --c) {
+    ring.push_back((nz - 1) * nx + c);
+  }
+  for (int r = nz - 1; r > 0; --r) {
+    ring.push_back(r * nx);
+  }
+
+  const uint32_t base = static_cast<uint32_t>(chunk.vertices.size());
+  for (uint32_t i : ring) {
+    graphics::Vertex v = chunk.vertices[i];
+    v.position.y -= depth;
+    chunk.vertices.push_back(v);
+  }
+
+  const uint32_t n = static_cast<uint32_t>(ring.size());
+  for (uint32_t k = 0; k < n; ++k) {
+    const uint32_t next = (k + 1) % n;
+    const uint32_t a = ring[k];
+    const uint32_t b = ring[next];
+    const uint32_t a2 = base + k;
+    const uint32_t b2 = base + next;
+    chunk.indices.insert(chunk.indices.end(), {a, b, a2, a2, b, b2});
+  }
+  chunk.bounds.min[1] -= depth;
+}
+
+/// @brief カメラから境界ボックスまでの距離（内側なら 0）
+float DistanceToBounds(const float point[3], const TerrainChunkBounds &b) {
+  float sq = 0.0f;
+  for (int axis = 0; axis < 3; ++axis) {
+    float d = 0.0f;
+    if (point[axis] < b.min[axis]) {
+      d = b.min[axis] - point[axis];
+    } else if (point[axis] > b.max[axis]) {
+      d = point[axis] - b.max[axis];
+    }
+    sq += d * d;
+  }
+  return std::sqrt(sq);
+}
+
+/// @brief 境界ボックスが視錐台と交差しうるか
+bool BoundsInFrustum(const TerrainChunkBounds &b, const float planes[6][4]) {
+  for (int i = 0; i < 6; ++i) {
+    const float *p = planes[i];
+    // 平面の法線方向に最も進んだ頂点が外側なら、箱全体が外側
+    const float x = (p[0] >= 0.0f) ? b.max[0] : b.min[0];
+    const float y = (p[1] >= 0.0f) ? b.max[1] : b.min[1];
+    const float z = (p[2] >= 0.0f) ? b.max[2] : b.min[2];
+    if (p[0] * x + p[1] * y + p[2] * z + p[3] < 0.0f) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace
+
+void TerrainChunkTree::Clear() {
+  m_chunks.clear();
+  m_levelCount = 0;
+  m_skirtDepth = 0.0f;
+}
+
+void TerrainChunkTree::Build(const TerrainData &data,
+                             const TerrainChunkSettings &settings,
+                             core::ThreadPool *pool) {
+  Clear();
+  const int resX = data.config.resolutionX;
+  const int resZ = data.config.resolutionZ;
+  if (resX < 2 || resZ < 2 ||
+      data.vertices.size() < static_cast<size_t>(resX) * resZ) {
+    return;
+  }
+
+  const int cellsX = resX - 1;
+  const int cellsZ = resZ - 1;
+  const int chunkCells = std::max(1, settings.chunkCells);
+
+  // 根が全セルを覆うまでレベルを積む
+  int rootLevel = 0;
+  for (int span = chunkCells; span < std::max(cellsX, cellsZ); span *= 2) {
+    ++rootLevel;
+  }
+  m_levelCount = rootLevel + 1;
+
+  auto makeNode = [&](int level, int x0, int z0) {
+    TerrainChunk chunk;
+    chunk.level = level;
+    chunk.stride = 1 << level;
+    chunk.cellX0 = x0;
+    chunk.cellZ0 = z0;
+    chunk.cellX1 = std::min(x0 + (chunkCells << level), cellsX);
+    chunk.cellZ1 = std::min(z0 + (chunkCells << level), cellsZ);
+    return chunk;
+  };
+
+  // 幅優先でノードを作る（子は必ず親より後ろに並ぶ）
+  m_chunks.push_back(makeNode(rootLevel, 0, 0));
+  for (size_t i = 0; i < m_chunks.size(); ++i) {
+    const int level = m_chunks[i].level;
+    if (level == 0) {
+      continue;
+    }
+    const int half = chunkCells << (level - 1);
+    const int x0 = m_chunks[i].cellX0;
+    const int z0 = m_chunks[i].cellZ0;
+    for (int q = 0; q < 4; ++q) {
+      const int cx = x0 + (q & 1) * half;
+      const int cz = z0 + (q >> 1) * half;
+      if (cx >= cellsX || cz >= cellsZ) {
+        continue;
+      }
+      m_chunks[i].children[q] = static_cast<int32_t>(m_chunks.size());
+      m_chunks.push_back(makeNode(level - 1, cx, cz));
+    }
+  }
+
+  const int count = static_cast<int>(m_chunks.size());
+  RunRange(pool, count, kChunksPerTask, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      BuildSurface(m_chunks[i], data);
+    }
+  });
+
+  // 親の誤差は子孫の誤差以上にする（親を選ばず子へ降りる判定が単調になる）
+  for (int i = count - 1; i >= 0; --i) {
+    TerrainChunk &chunk = m_chunks[i];
+    for (int32_t child : chunk.children) {
+      if (child >= 0) {
+        chunk.geometricError =
+            std::max(chunk.geometricError, m_chunks[child].geometricError);
+      }
+    }
+  }
+
+  // 隣接チャンクの縁の高さの差は、双方の誤差の和（<= 根の誤差の2倍）以下
+  m_skirtDepth = (settings.skirtDepth > 0.0f)
+                     ? settings.skirtDepth
+                     : m_chunks[0].geometricError * 2.0f +
+                           settings.minSkirtDepth;
+
+  RunRange(pool, count, kChunksPerTask, [&](int begin, int end) {
+    for (int i = begin; i < end; ++i) {
+      AddSkirt(m_chunks[i], m_skirtDepth);
+    }
+  });
+}
+
+size_t TerrainChunkTree::GetTotalTriangleCount() const {
+  size_t total = 0;
+  for (const auto &chunk : m_chunks) {
+    total += chunk.TriangleCount();
+  }
+  return total;
+}
+
+TerrainLodStats
+TerrainChunkTree::SelectLod(const TerrainLodQuery &query,
+                            std::vector<uint32_t> &out,
+                            std::vector<uint32_t> *culled) const {
+  out.clear();
+  if (culled) {
+    culled->clear();
+  }
+  TerrainLodStats stats;
+  if (!m_chunks.empty()) {
+    SelectNode(0, query, out, culled, stats);
+  }
+  return stats;
+}
+
+void TerrainChunkTree::SelectNode(uint32_t index, const TerrainLodQuery &query,
+                                  std::vector<uint32_t> &out,
+                                  std::vector<uint32_t> *culled,
+                                  TerrainLodStats &stats) const {
+  const TerrainChunk &chunk = m_chunks[index];
+  if (query.cullFrustum &&
+      !BoundsInFrustum(chunk.bounds, query.frustumPlanes)) {
+    ++stats.culledCount;
+    stats.culledTriangleCount += chunk.TriangleCount();
+    if (culled) {
+      culled->push_back(index);
+    }
+    return;
+  }
+
+  if (!chunk.IsLeaf()) {
+    const float dist =
+        std::max(DistanceToBounds(query.cameraPosition, chunk.bounds), 1e-4f);
+    const float screenError =
+        chunk.geometricError * query.projectionScale / dist;
+    if (screenError > query.maxScreenError) {
+      for (int32_t child : chunk.children) {
+        if (child >= 0) {
+          SelectNode(static_cast<uint32_t>(child), query, out, culled, stats);
+        }
+      }
+      return;
+    }
+  }
+
+  out.push_back(index);
+  ++stats.chunkCount;
+  stats.triangleCount += chunk.TriangleCount();
+}
+
+float TerrainChunkTree::ComputeProjectionScale(float fovY,
+                                               float viewportHeight) {
+  return viewportHeight / (2.0f * std::tan(fovY * 0.5f));
+}
+
+} // namespace game::systems
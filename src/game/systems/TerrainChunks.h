@@ -0,0 +1,131 @@
+#pragma once
+/**
+ * @file TerrainChunks.h
+ * @brief ハイトマップを固定サイズのチャンクに分けた四分木 LOD 地形
+ */
+
+#include "../../graphics/Mesh.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace game::systems {
+
+struct TerrainData;
+
+/// @brief チャンク分割の設定
+struct TerrainChunkSettings {
+  int chunkCells = 32;         ///< 1チャンクの一辺のセル数（全レベル共通）
+  float skirtDepth = 0.0f;     ///< スカートの垂れ下がり量（0 なら自動）
+  float minSkirtDepth = 0.05f; ///< 自動設定時に誤差へ足す余裕
+};
+
+/// @brief ワールド空間の軸平行境界ボックス
+struct TerrainChunkBounds {
+  float min[3] = {0.0f, 0.0f, 0.0f};
+  float max[3] = {0.0f, 0.0f, 0.0f};
+};
+
+/// @brief 四分木の1ノード（= 1チャンク）
+/// @details レベル L のノードは 2^L セルおきに頂点を間引いた
+///          chunkCells x chunkCells 程度のグリッドを持つ。
+///          レベル 0 が元の解像度の葉。
+struct TerrainChunk {
+  int level = 0;
+  int stride = 1;               ///< 頂点の間引き間隔（1 << level）
+  int cellX0 = 0, cellZ0 = 0;   ///< 覆うセル範囲の始点
+  int cellX1 = 0, cellZ1 = 0;   ///< 覆うセル範囲の終点（= 端の頂点番号）
+  float geometricError = 0.0f;  ///< 元の解像度との高さの最大差（子孫を含む）
+  TerrainChunkBounds bounds;    ///< スカートを含む境界
+  int32_t children[4] = {-1, -1, -1, -1};
+  uint32_t surfaceIndexCount = 0; ///< indices のうちスカートを除く数
+
+  std::vector<graphics::Vertex> vertices; ///< 地表 + スカート
+  std::vector<uint32_t> indices;
+
+  bool IsLeaf() const {
+    return children[0] < 0 && children[1] < 0 && children[2] < 0 &&
+           children[3] < 0;
+  }
+  size_t TriangleCount() const { return indices.size() / 3; }
+};
+
+/// @brief LOD 選択の入力
+struct TerrainLodQuery {
+  float cameraPosition[3] = {0.0f, 0.0f, 0.0f};
+  /// @brief 距離 1 の位置で 1 ワールド単位が何ピクセルになるか
+  /// @see TerrainChunkTree::ComputeProjectionScale
+  float projectionScale = 1.0f;
+  float maxScreenError = 2.0f; ///< 許容する画面上の誤差（ピクセル）
+  /// @brief 視錐台の平面 (a, b, c, d)。a*x + b*y + c*z + d >= 0 が内側
+  float frustumPlanes[6][4] = {};
+  bool cullFrustum = false;
+};
+
+/// @brief LOD 選択の結果
+struct TerrainLodStats {
+  size_t chunkCount = 0;    ///< 選ばれたチャンク数（= メインの描画呼び出し数）
+  size_t triangleCount = 0; ///< 選ばれたチャンクの三角形数（スカート込み）
+  size_t culledCount = 0;   ///< 視錐台外で捨てたノード数
+  size_t culledTriangleCount = 0; ///< 捨てたノードの三角形数（描かずに済んだ分）
+};
+
+/// @brief チャンク化した四分木 LOD 地形（CPU 側）
+/// @details 各チャンクは固定の頂点数で作るため、遠くほど粗いノードが
+///          選ばれて描画する三角形数はフィールドの大きさにほぼよらない。
+///          隣接チャンクの LOD 差で生じる隙間は、外周から下へ垂らした
+///          スカートで隠す。スカートの深さは選ばれうるノードの誤差の
+///          最大値以上にとるので、LOD 差がいくつあっても穴は見えない。
+///          GPU には依存しないので、構築と選択はヘッドレスで検証できる。
+class TerrainChunkTree {
+public:
+  /// @brief TerrainData の頂点からチャンクを構築する
+  /// @details data.vertices（TerrainGenerator の出力）を間引いて使うため、
+  ///          色・法線・UV は単一メッシュ版と同じになる。
+  /// @param pool 並列化に使うプール（nullptrなら単一スレッド）
+  void Build(const TerrainData &data, const TerrainChunkSettings &settings,
+             core::ThreadPool *pool);
+
+  void Clear();
+
+  /// @brief 全ノード（幅優先順。0 が根）
+  const std::vector<TerrainChunk> &GetChunks() const { return m_chunks; }
+
+  bool IsEmpty() const { return m_chunks.empty(); }
+
+  /// @brief レベル数（根のレベル + 1）
+  int GetLevelCount() const { return m_levelCount; }
+
+  /// @brief 実際に使ったスカートの深さ
+  float GetSkirtDepth() const { return m_skirtDepth; }
+
+  /// @brief 全ノードの三角形数の合計（スカート込み）
+  size_t GetTotalTriangleCount() const;
+
+  /// @brief 画面上の誤差が許容値以下になるチャンクを選ぶ
+  /// @param out 選ばれたノード番号（上書き）。範囲は重ならず、
+  ///            視錐台内の地形をちょうど覆う。
+  /// @param culled 視錐台外で打ち切ったノード番号（任意）。out と合わせると
+  ///               フィールド全体をちょうど覆う（ミニマップ等の別視点用）。
+  TerrainLodStats SelectLod(const TerrainLodQuery &query,
+                            std::vector<uint32_t> &out,
+                            std::vector<uint32_t> *culled = nullptr) const;
+
+  /// @brief 垂直画角とビューポートの高さから projectionScale を求める
+  static float ComputeProjectionScale(float fovY, float viewportHeight);
+
+private:
+  void SelectNode(uint32_t index, const TerrainLodQuery &query,
+                  std::vector<uint32_t> &out, std::vector<uint32_t> *culled,
+                  TerrainLodStats &stats) const;
+
+  std::vector<TerrainChunk> m_chunks;
+  int m_levelCount = 0;
+  float m_skirtDepth = 0.0f;
+};
+
+} // namespace game::systems
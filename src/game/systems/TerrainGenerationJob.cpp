@@ -0,0 +1,149 @@
+/**
+ * @file TerrainGenerationJob.cpp
+ * @brief 地形生成ジョブの実装
+ */
+
+#include "TerrainGenerationJob.h"
+#include "../../core/Noise.h"
+#include "../../core/ThreadPool.h"
+#include <algorithm>
+
+namespace game::systems {
+
+namespace {
+
+/// @brief 1 Step で処理するセル数の目安（1スレッドあたり）
+constexpr int kCellsPerStep = 4096;
+
+} // namespace
+
+TerrainGenerationJob::TerrainGenerationJob(
+    std::string articleText, std::vector<DirectX::XMFLOAT2> holes,
+    const TerrainConfig &config, int previewDivisor, core::ThreadPool *pool)
+    : m_articleText(std::move(articleText)), m_holes(std::move(holes)),
+      m_config(config), m_previewDivisor(previewDivisor), m_pool(pool) {
+  const int concurrency =
+      m_pool ? static_cast<int>(m_pool->GetConcurrency()) : 1;
+  m_rowsPerStep = std::max(
+      1, kCellsPerStep * concurrency / std::max(m_config.resolutionX, 1));
+  if (m_previewDivisor <= 1) {
+    m_stage = Stage::BaseHeights;
+  }
+
+  // 進捗の分母: プレビュー + 行バンド6ステージ + 平滑化
+  const int bands = (std::max(m_config.resolutionZ, 0) + m_rowsPerStep - 1) /
+                    m_rowsPerStep;
+  m_stepsTotal = (m_previewDivisor > 1 ? 1 : 0) + bands * 6 + 1;
+}
+
+float TerrainGenerationJob::GetProgress() const {
+  if (m_stage == Stage::Done || m_stepsTotal == 0) {
+    return 1.0f;
+  }
+  return std::min(1.0f, static_cast<float>(m_stepsDone) / m_stepsTotal);
+}
+
+int TerrainGenerationJob::GetQuality() const {
+  if (m_stage == Stage::Done) {
+    return 2;
+  }
+  return m_preview.heightMap.empty() ? 0 : 1;
+}
+
+const TerrainData *TerrainGenerationJob::GetData() const {
+  switch (GetQuality()) {
+  case 2:
+    return &m_data;
+  case 1:
+    return &m_preview;
+  default:
+    return nullptr;
+  }
+}
+
+bool TerrainGenerationJob::Step() {
+  const int resX = m_config.resolutionX;
+  const int resZ = m_config.resolutionZ;
+  switch (m_stage) {
+  case Stage::Preview: {
+    TerrainConfig preview = m_config;
+    preview.resolutionX = std::max(2, resX / m_previewDivisor);
+    preview.resolutionZ = std::max(2, resZ / m_previewDivisor);
+    m_preview = TerrainGenerator::GenerateTerrain(m_articleText, m_holes,
+                                                  preview, nullptr);
+    m_stage = Stage::BaseHeights;
+    break;
+  }
+  case Stage::BaseHeights:
+    if (m_nextRow == 0) {
+      const size_t cells = static_cast<size_t>(resX) * resZ;
+      m_data.config = m_config;
+      m_data.heightMap.assign(cells, 0.0f);
+      m_data.materialMap.assign(cells, 0); // 0: Fairway
+    }
+    TerrainGenerator::GenerateBaseHeightMap(
+        m_data, core::noise::SeedFromString(m_articleText), Band(resZ),
+        m_pool);
+    AdvanceRows(resZ, Stage::Platforms);
+    break;
+  case Stage::Platforms:
+    // ホールのパラメータは全行の基本形状が揃ってから決める
+    if (m_nextRow == 0) {
+      m_platforms = TerrainGenerator::ResolvePlatforms(
+          m_config, m_data.heightMap, m_data.materialMap, m_holes);
+    }
+    TerrainGenerator::ApplyPlatforms(m_data, m_platforms, Band(resZ), m_pool);
+    AdvanceRows(resZ, Stage::Smoothing);
+    break;
+  case Stage::Smoothing:
+    TerrainGenerator::ApplySmoothing(m_data, m_pool);
+    m_stage = Stage::Normals;
+    break;
+  case Stage::Normals:
+    TerrainGenerator::CalculateNormals(m_data, Band(resZ), m_pool);
+    AdvanceRows(resZ, Stage::Vertices);
+    break;
+  case Stage::Vertices:
+    if (m_nextRow == 0) {
+      m_data.vertices.assign(static_cast<size_t>(resX) * resZ,
+                             graphics::Vertex{});
+    }
+    TerrainGenerator::WriteVertices(m_data, m_holes, Band(resZ), m_pool);
+    AdvanceRows(resZ, Stage::Indices);
+    break;
+  case Stage::Indices:
+    if (m_nextRow == 0) {
+      m_data.indices.assign(static_cast<size_t>(resX - 1) * (resZ - 1) * 6,
+                            0);
+    }
+    TerrainGenerator::WriteIndices(m_data, m_nextRow, Band(resZ - 1).z1,
+                                   m_pool);
+    AdvanceRows(resZ - 1, Stage::Tangents);
+    break;
+  case Stage::Tangents:
+    // 接線は隣の行の頂点を読むので、全頂点が揃ってから
+    TerrainGenerator::ComputeGridTangents(m_data.vertices, resX, resZ,
+                                          Band(resZ), m_pool);
+    AdvanceRows(resZ, Stage::Done);
+    break;
+  case Stage::Done:
+    break;
+  }
+  ++m_stepsDone;
+  return m_stage != Stage::Done;
+}
+
+TerrainRect TerrainGenerationJob::Band(int rows) const {
+  return {0, m_nextRow, m_config.resolutionX,
+          std::min(m_nextRow + m_rowsPerStep, rows)};
+}
+
+void TerrainGenerationJob::AdvanceRows(int rows, Stage next) {
+  m_nextRow += m_rowsPerStep;
+  if (m_nextRow >= rows) {
+    m_nextRow = 0;
+    m_stage = next;
+  }
+}
+
+} // namespace game::systems
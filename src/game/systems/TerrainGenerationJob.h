@@ -0,0 +1,83 @@
+#pragma once
+/**
+ * @file TerrainGenerationJob.h
+ * @brief 地形をフレームをまたいで少しずつ生成するジョブ
+ */
+
+#include "../../core/IncrementalJob.h"
+#include "TerrainGenerator.h"
+#include <DirectXMath.h>
+#include <string>
+#include <vector>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace game::systems {
+
+/**
+ * @brief 低解像度のプレビュー → 本番の地形の順に生成するジョブ
+ * @details TerrainGenerator の各ステージを行バンド単位の Step に分ける。
+ *          平滑化だけは全体を見るので1 Step で行う。品質 1 で解像度を 1/previewDivisor にした
+ *          地形が、品質 2 で本番の地形が揃う。最終結果は
+ *          TerrainGenerator::GenerateTerrain とビット単位で同じ。
+ */
+class TerrainGenerationJob : public core::IncrementalJob {
+public:
+  /// @param previewDivisor プレビューの解像度の割り数（1 以下ならなし）
+  /// @param pool 1 Step の中の行を並列化するプール（nullptr なら単一）
+  TerrainGenerationJob(std::string articleText,
+                       std::vector<DirectX::XMFLOAT2> holes,
+                       const TerrainConfig &config, int previewDivisor = 4,
+                       core::ThreadPool *pool = nullptr);
+
+  float GetProgress() const override;
+  int GetQuality() const override;
+  int GetMaxQuality() const override { return 2; }
+
+  /// @brief 今使える最良の地形（品質 0 なら nullptr）
+  const TerrainData *GetData() const;
+
+  /// @brief 完成した地形を取り出す（品質 2 になってから呼ぶ）
+  TerrainData TakeData() { return std::move(m_data); }
+
+protected:
+  bool Step() override;
+
+private:
+  enum class Stage {
+    Preview,
+    BaseHeights,
+    Platforms,
+    Smoothing,
+    Normals,
+    Vertices,
+    Indices,
+    Tangents,
+    Done,
+  };
+
+  /// @brief 今の行バンド（行数 rows のステージ）
+  TerrainRect Band(int rows) const;
+
+  /// @brief 行バンドのステージを1バンド進め、全行終われば次へ
+  void AdvanceRows(int rows, Stage next);
+
+  std::string m_articleText;
+  std::vector<DirectX::XMFLOAT2> m_holes;
+  TerrainConfig m_config;
+  int m_previewDivisor;
+  core::ThreadPool *m_pool;
+
+  Stage m_stage = Stage::Preview;
+  int m_nextRow = 0;
+  int m_rowsPerStep = 1;
+  TerrainData m_preview;
+  TerrainData m_data;
+  std::vector<TerrainPlatform> m_platforms;
+  int m_stepsDone = 0;
+  int m_stepsTotal = 0;
+};
+
+} // namespace game::systems
@@ -1,5 +1,7 @@
 #include "TerrainGenerator.h"
 #include "../../core/Logger.h"
+#include "../../core/Noise.h"
+#include "../../core/ThreadPool.h"
 #include "../../graphics/TangentGenerator.h"
 #include <algorithm>
 #include <cmath>
@@ -18,10 +20,127 @@ static float SmoothStep(float edge0, float edge1, float x) {
   return x * x * (3 - 2 * x);
 }
 
+namespace {
+
+/// @brief 1バンドあたりのセル数の目安（小さすぎるとスケジューリングが支配的）
+constexpr int kCellsPerBand = 16384;
+
+/// @brief [rowBegin, rowEnd) を行バンドに分けて処理する
+/// @details pool が nullptr なら呼び出しスレッドで全行を一度に処理する。
+template <typename Fn>
+void ForEachRowBand(core::ThreadPool *pool, int rowBegin, int rowEnd,
+                    int rowWidth, Fn &&fn) {
+  const int rows = rowEnd - rowBegin;
+  if (rows <= 0) {
+    return;
+  }
+  const int grain = std::max(1, kCellsPerBand / std::max(rowWidth, 1));
+  if (pool && rows > grain) {
+    pool->ParallelFor(static_cast<size_t>(rows), static_cast<size_t>(grain),
+                      [&](size_t begin, size_t end) {
+                        fn(rowBegin + static_cast<int>(begin),
+                           rowBegin + static_cast<int>(end));
+                      });
+  } else {
+    fn(rowBegin, rowEnd);
+  }
+}
+
+/// @brief 1セルにプラットフォームを適用する
+/// @details セル自身の高さとマテリアルだけを読み書きするので、
+///          ホールを同じ順序で適用する限りセルごとに独立して計算できる。
+void ApplyPlatformToCell(const TerrainPlatform &p, int x, int z, float &height,
+                         uint8_t &material) {
+  float dx = (float)(x - p.cx);
+  float dz = (float)(z - p.cz);
+  float dist = std::sqrt(dx * dx + dz * dz);
+  int radius = p.radius;
+
+  // Green area
+  if (dist < radius) {
+    material = 3; // Green
+
+    float cupRadius = 1.5f;
+    if (dist < cupRadius) {
+      float t = dist / cupRadius;
+      float shape = std::cos(t * 3.14159f * 0.5f);
+      height = p.targetHeight - shape * p.bowlDepth;
+    } else {
+      height = p.targetHeight;
+    }
+  } else if (dist < radius * 1.5f) {
+    // Apron
+    material = 0;
+
+    // Connect to rough
+    float t = SmoothStep(radius, radius * 1.5f, dist);
+    height = Lerp(p.targetHeight, height, t);
+  } else {
+    // Generate bunkers
+    float angle = std::atan2(dz, dx);
+    float angleDiff = angle - p.bunkerAngle;
+    while (angleDiff > 3.14159f)
+      angleDiff -= 6.28318f;
+    while (angleDiff < -3.14159f)
+      angleDiff += 6.28318f;
+
+    if (std::abs(angleDiff) < 0.6f) {
+      float distFromBunkerCenter =
+          std::sqrt(std::pow(dist - p.bunkerDist, 2.0f));
+      float bunkerRadius = radius * 0.5f;
+      if (distFromBunkerCenter < bunkerRadius) {
+        material = 2; // Bunker
+        // 窪ませる
+        height -=
+            0.25f * std::cos(distFromBunkerCenter / bunkerRadius * 1.57f);
+      }
+    }
+  }
+}
+
+} // namespace
+
+TerrainRect TerrainRect::Union(const TerrainRect &other) const {
+  if (other.IsEmpty()) {
+    return *this;
+  }
+  if (IsEmpty()) {
+    return other;
+  }
+  return {std::min(x0, other.x0), std::min(z0, other.z0),
+          std::max(x1, other.x1), std::max(z1, other.z1)};
+}
+
+TerrainRect TerrainRect::Expanded(int margin, int width, int height) const {
+  if (IsEmpty()) {
+    return *this;
+  }
+  return {std::max(0, x0 - margin), std::max(0, z0 - margin),
+          std::min(width, x1 + margin), std::min(height, z1 + margin)};
+}
+
+TerrainRect TerrainPlatform::AffectedRect(int resX, int resZ) const {
+  // グリーン (< r)、エプロン (< 1.5r)、バンカー (|d - bunkerDist| < 0.5r)
+  // の外側のセルは ApplyPlatformToCell で変化しない
+  const float reach = std::max(radius * 1.5f, bunkerDist + radius * 0.5f);
+  const int extent =
+      std::min(radius * 3, static_cast<int>(std::ceil(reach)) + 1);
+  TerrainRect rect{cx - extent, cz - extent, cx + extent + 1, cz + extent + 1};
+  return rect.Expanded(0, resX, resZ);
+}
+
 TerrainData TerrainGenerator::GenerateTerrain(
     const std::string &articleText,
     const std::vector<DirectX::XMFLOAT2> &holePositions,
     const TerrainConfig &config) {
+  return GenerateTerrain(articleText, holePositions, config,
+                         &core::ThreadPool::Shared());
+}
+
+TerrainData TerrainGenerator::GenerateTerrain(
+    const std::string &articleText,
+    const std::vector<DirectX::XMFLOAT2> &holePositions,
+    const TerrainConfig &config, core::ThreadPool *pool) {
   TerrainData data;
   data.config = config;
 
@@ -30,92 +149,114 @@ TerrainData TerrainGenerator::GenerateTerrain(
   data.heightMap.resize(totalVerts, 0.0f);
   data.materialMap.resize(totalVerts, 0); // 0: Fairway
 
+  const TerrainRect full =
+      TerrainRect::Full(config.resolutionX, config.resolutionZ);
+
   // 1. 基本形状生成 (ノイズ + プラットフォーム)
-  GenerateBaseHeightMap(data, articleText);
+  // 乱数は描画順ではなく「記事シード＋座標」から決める
+  GenerateBaseHeightMap(data, core::noise::SeedFromString(articleText), full,
+                        pool);
 
   // 2. リンク位置に基づくプラットフォーム生成
-  CreatePlatforms(data, holePositions);
+  const std::vector<TerrainPlatform> platforms = ResolvePlatforms(
+      config, data.heightMap, data.materialMap, holePositions);
+  ApplyPlatforms(data, platforms, full, pool);
 
   // 3. スムージング処理
-  ApplySmoothing(data, 3); // 3回スムージング
+  ApplySmoothing(data, pool);
 
   // 4. メッシュ生成
-  CalculateNormals(data);
-  GenerateMesh(data, holePositions); // ホール位置を渡す
+  CalculateNormals(data, full, pool);
+  GenerateMesh(data, holePositions, pool); // ホール位置を渡す
 
   return data;
 }
 
-void TerrainGenerator::GenerateBaseHeightMap(TerrainData &data,
-                                             const std::string &text) {
-  // 擬似乱数生成器 (記事テキストをシードにする)
-  std::seed_seq seed(text.begin(), text.end());
-  std::mt19937 rng(seed);
-  std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-
+void TerrainGenerator::GenerateBaseHeightMap(TerrainData &data, uint32_t seed,
+                                             const TerrainRect &rect,
+                                             core::ThreadPool *pool) {
   int resX = data.config.resolutionX;
   int resZ = data.config.resolutionZ;
+  const int width = rect.x1 - rect.x0;
+
+  core::noise::FractalSettings fbm;
+  fbm.basis = core::noise::Basis::Simplex;
+  fbm.octaves = data.config.noiseOctaves;
+  fbm.frequency = data.config.noiseFrequency;
+  const bool useNoise = data.config.noiseAmplitude > 0.0f;
+  const float noiseStep = 1.0f / resX;
 
   // 簡易パーリンノイズ風 (周波数を変えて重ね合わせ)
-  for (int z = 0; z < resZ; ++z) {
-    for (int x = 0; x < resX; ++x) {
-      float nx = (float)x / resX;
-      float nz = (float)z / resZ;
-
-      // 低周波 (大きな起伏)
-      float h1 = std::sin(nx * 3.14f * 2.0f) * std::cos(nz * 3.14f * 2.0f);
-
-      // 高周波 (細かな凹凸) -> 文字が読みにくくなるので大幅に減らす
-      float h2 = std::sin(nx * 10.0f + nz * 5.0f) * 0.05f;
-
-      // 外周を高くする (壁)
-      float wallFactor = 0.0f;
-      float dx = nx - 0.5f;
-      float dz = nz - 0.5f;
-      float distFromCenter =
-          std::sqrt(dx * dx + dz * dz) * 2.0f; // 0.0 center -> 1.0 edge
-
-      if (distFromCenter > 0.8f) {
-        wallFactor = SmoothStep(0.8f, 1.0f, distFromCenter) * 3.0f;
+  // 各セルは座標だけから決まるので、行バンドごとに独立して計算できる
+  ForEachRowBand(pool, rect.z0, rect.z1, width, [&](int zBegin, int zEnd) {
+    // 記事ごとの起伏は1行まとめてバッチ評価する。座標は x * step とし、
+    // 矩形の切り出し方によらず同じ値になるようにする
+    std::vector<float> noiseXs(useNoise ? width : 0);
+    std::vector<float> noiseYs(noiseXs.size());
+    std::vector<float> noiseZs(noiseXs.size(), 0.0f);
+    std::vector<float> noiseRow(noiseXs.size());
+    for (int x = rect.x0; x < rect.x1 && useNoise; ++x) {
+      noiseXs[x - rect.x0] = static_cast<float>(x) * noiseStep;
+    }
+    for (int z = zBegin; z < zEnd; ++z) {
+      if (useNoise) {
+        std::fill(noiseYs.begin(), noiseYs.end(), (float)z / resZ);
+        core::noise::Fbm3Batch(noiseXs.data(), noiseYs.data(), noiseZs.data(),
+                               noiseRow.data(), noiseRow.size(), fbm, seed);
       }
+      for (int x = rect.x0; x < rect.x1; ++x) {
+        float nx = (float)x / resX;
+        float nz = (float)z / resZ;
 
-      float h = (h1 * 0.5f + h2 * 0.1f) * data.config.heightScale + wallFactor;
+        // 低周波 (大きな起伏)
+        float h1 = std::sin(nx * 3.14f * 2.0f) * std::cos(nz * 3.14f * 2.0f);
+
+        // 高周波 (細かな凹凸) -> 文字が読みにくくなるので大幅に減らす
+        float h2 = std::sin(nx * 10.0f + nz * 5.0f) * 0.05f;
+
+        // 外周を高くする (壁)
+        float wallFactor = 0.0f;
+        float dx = nx - 0.5f;
+        float dz = nz - 0.5f;
+        float distFromCenter =
+            std::sqrt(dx * dx + dz * dz) * 2.0f; // 0.0 center -> 1.0 edge
+
+        if (distFromCenter > 0.8f) {
+          wallFactor = SmoothStep(0.8f, 1.0f, distFromCenter) * 3.0f;
+        }
+
+        float h =
+            (h1 * 0.5f + h2 * 0.1f) * data.config.heightScale + wallFactor;
+        if (useNoise) {
+          h += noiseRow[x - rect.x0] * data.config.noiseAmplitude;
+        }
 
-      // ベース高さ調整
-      SetHeight(data, x, z, h + data.config.baseHeight);
+        // ベース高さ調整
+        SetHeight(data, x, z, h + data.config.baseHeight);
 
-      // マテリアル設定: 外周(壁)はラフ、またはノイズが高い場所
-      int idx = z * resX + x;
-      if (wallFactor > 0.5f) {
-        data.materialMap[idx] = 1; // Rough
-      } else if (h2 > 0.03f) {     // 起伏が激しい場所もラフ
-        data.materialMap[idx] = 1;
+        // マテリアル設定: 外周(壁)はラフ、またはノイズが高い場所
+        // 起伏が激しい場所もラフ。それ以外はフェアウェイ
+        int idx = z * resX + x;
+        data.materialMap[idx] = (wallFactor > 0.5f || h2 > 0.03f) ? 1 : 0;
       }
     }
-  }
+  });
 }
 
-void TerrainGenerator::CreatePlatforms(
-    TerrainData &data, const std::vector<DirectX::XMFLOAT2> &holePositions) {
-  int resX = data.config.resolutionX;
-  int resZ = data.config.resolutionZ;
-  float worldW = data.config.worldWidth;
-  float worldD = data.config.worldDepth;
-
-  // 頂点カラー初期化（全体を白に）
-  // 頂点生成前だが、ここでフラグなどを持てないので、一旦GenerateMesh内でやるか、
-  // あるいはここでハイトマップ以外の情報も操作するか。
-  // 今回はGenerateMeshで色を決めるために、TerrainDataに「地形属性マップ」を追加するのが正しいが、
-  // 簡易的に「GenerateMeshで色を塗る際のロジック」を修正する方針にする。
-  // しかしGenerateMeshは座標を知らない。
-  // なので、GenerateMeshを修正し、holePositionsを参照できるようにするか、
-  // データに色情報を埋め込むか。
-  // verticesはこの後生成されるので、Vertex.colorをいじるなら生成時。
-  // ひとまずここは形状のみに注力し、色は別途考える（あるいはGenerateMeshにholePositionsを渡す？）。
-  // いや、頂点ごとに属性を持つ配列を追加しよう。
-  // TerrainDataにはまだないので、GenerateMesh内で色を決定するロジックをハードコードする。
-
-  // リンク位置に基づいてプラットフォームを作る
+std::vector<TerrainPlatform> TerrainGenerator::ResolvePlatforms(
+    const TerrainConfig &config, const std::vector<float> &baseHeights,
+    const std::vector<uint8_t> &baseMaterials,
+    const std::vector<DirectX::XMFLOAT2> &holePositions) {
+  int resX = config.resolutionX;
+  int resZ = config.resolutionZ;
+  float worldW = config.worldWidth;
+  float worldD = config.worldDepth;
+
+  // ホールごとのパラメータを順番に確定する。
+  // グリーン高さは「それまでのホールを適用した後の中心セルの高さ」なので、
+  // 中心セル1つについてだけ先行ホールを再生しておく（ホール数^2 の軽い処理）。
+  std::vector<TerrainPlatform> platforms;
+  platforms.reserve(holePositions.size());
   for (const auto &pos : holePositions) {
     // ワールド座標 -> グリッドUV -> インデックス
     // px = (u - 0.5) * W  => u = px/W + 0.5
@@ -125,114 +266,77 @@ void TerrainGenerator::CreatePlatforms(
     float v = 0.5f - pos.y / worldD; // pos.y is Z in world coords here (vector2
                                      // x, z passed as x, y)
 
-    int cx = (int)(u * (resX - 1));
-    int cz = (int)(v * (resZ - 1));
+    TerrainPlatform p;
+    p.cx = (int)(u * (resX - 1));
+    p.cz = (int)(v * (resZ - 1));
 
     // プラットフォーム半径 (グリーン)
-    int radius = resX / 10; // ほどよい大きさでテキストを邪魔しない
-
-    // プラットフォームの高さ
-    float currentCenterH = GetHeight(data, cx, cz);
-    float targetHeight = currentCenterH + 0.05f; // わずかに持ち上げて埋没を防ぐ
-
-    // Cup bowl depth
-    float bowlDepth = 0.15f;
-
-    // Bunker generation
-    std::mt19937 tempRng(cx + cz * resX);
-    std::uniform_real_distribution<float> dist01(0.0f, 1.0f);
-    float bunkerAngle = dist01(tempRng) * 6.28f;
-    float bunkerDist = radius * 1.8f;
-
-    for (int z = cz - radius * 3; z <= cz + radius * 3; ++z) {
-      for (int x = cx - radius * 3; x <= cx + radius * 3; ++x) {
-        if (x < 0 || x >= resX || z < 0 || z >= resZ)
-          continue;
-
-        float dx = (float)(x - cx);
-        float dz = (float)(z - cz);
-        float dist = std::sqrt(dx * dx + dz * dz);
-        int idx = z * resX + x;
-
-        // Green area
-        if (dist < radius) {
-          data.materialMap[idx] = 3; // Green
-
-          float cupRadius = 1.5f;
-          if (dist < cupRadius) {
-            float t = dist / cupRadius;
-            float shape = std::cos(t * 3.14159f * 0.5f);
-            float h = targetHeight - shape * bowlDepth;
-            SetHeight(data, x, z, h);
-          } else {
-            SetHeight(data, x, z, targetHeight);
-          }
-        } else if (dist < radius * 1.5f) {
-          // Apron
-          data.materialMap[idx] = 0;
-
-          // Connect to rough
-          float t = SmoothStep(radius, radius * 1.5f, dist);
-          float currentH = GetHeight(data, x, z);
-          SetHeight(data, x, z, Lerp(targetHeight, currentH, t));
-        } else {
-          // Generate bunkers
-          float angle = std::atan2(dz, dx);
-          float angleDiff = angle - bunkerAngle;
-          while (angleDiff > 3.14159f)
-            angleDiff -= 6.28318f;
-          while (angleDiff < -3.14159f)
-            angleDiff += 6.28318f;
-
-          if (std::abs(angleDiff) < 0.6f) {
-            float distFromBunkerCenter =
-                std::sqrt(std::pow(dist - bunkerDist, 2.0f));
-            float bunkerRadius = radius * 0.5f;
-            if (distFromBunkerCenter < bunkerRadius) {
-              data.materialMap[idx] = 2; // Bunker
-              // 窪ませる
-              float currentH = GetHeight(data, x, z);
-              SetHeight(data, x, z,
-                        currentH - 0.25f * std::cos(distFromBunkerCenter /
-                                                    bunkerRadius * 1.57f));
-            }
-          }
+    p.radius = resX / 10; // ほどよい大きさでテキストを邪魔しない
+
+    // プラットフォームの高さ（範囲外の中心は高さ 0 とみなす）
+    float currentCenterH = 0.0f;
+    if (p.cx >= 0 && p.cx < resX && p.cz >= 0 && p.cz < resZ) {
+      currentCenterH = baseHeights[p.cz * resX + p.cx];
+      uint8_t centerMat = baseMaterials[p.cz * resX + p.cx];
+      for (const auto &prev : platforms) {
+        if (prev.Covers(p.cx, p.cz)) {
+          ApplyPlatformToCell(prev, p.cx, p.cz, currentCenterH, centerMat);
         }
       }
     }
+    p.targetHeight = currentCenterH + 0.05f; // わずかに持ち上げて埋没を防ぐ
+
+    // Bunker generation（描画順ではなくホール座標から種を作る）
+    std::mt19937 tempRng(p.cx + p.cz * resX);
+    std::uniform_real_distribution<float> dist01(0.0f, 1.0f);
+    p.bunkerAngle = dist01(tempRng) * 6.28f;
+    p.bunkerDist = p.radius * 1.8f;
+
+    platforms.push_back(p);
   }
+  return platforms;
 }
 
-void TerrainGenerator::ApplySmoothing(TerrainData &data, int iterations) {
+void TerrainGenerator::ApplyPlatforms(
+    TerrainData &data, const std::vector<TerrainPlatform> &platforms,
+    const TerrainRect &rect, core::ThreadPool *pool) {
+  if (platforms.empty()) {
+    return;
+  }
   int resX = data.config.resolutionX;
-  int resZ = data.config.resolutionZ;
-  std::vector<float> tempMap = data.heightMap;
-
-  for (int iter = 0; iter < iterations; ++iter) {
-    for (int z = 1; z < resZ - 1; ++z) {
-      for (int x = 1; x < resX - 1; ++x) {
-        // 3x3 平均
-        float sum = 0.0f;
-        sum += GetHeight(data, x - 1, z - 1);
-        sum += GetHeight(data, x, z - 1);
-        sum += GetHeight(data, x + 1, z - 1);
-
-        sum += GetHeight(data, x - 1, z);
-        sum += GetHeight(data, x, z);
-        sum += GetHeight(data, x + 1, z);
-
-        sum += GetHeight(data, x - 1, z + 1);
-        sum += GetHeight(data, x, z + 1);
-        sum += GetHeight(data, x + 1, z + 1);
-
-        tempMap[z * resX + x] = sum / 9.0f;
+  const int width = rect.x1 - rect.x0;
+
+  // 各行で全ホールを元の順序のまま適用する。
+  // セルの結果は自分自身の値とホールの並びだけで決まるので、
+  // 行バンドを並列に処理しても逐次実行と同じ値になる。
+  ForEachRowBand(pool, rect.z0, rect.z1, width, [&](int zBegin, int zEnd) {
+    for (int z = zBegin; z < zEnd; ++z) {
+      for (const auto &p : platforms) {
+        if (std::abs(z - p.cz) > p.radius * 3) {
+          continue;
+        }
+        int xBegin = std::max(rect.x0, p.cx - p.radius * 3);
+        int xEnd = std::min(rect.x1 - 1, p.cx + p.radius * 3);
+        for (int x = xBegin; x <= xEnd; ++x) {
+          int idx = z * resX + x;
+          ApplyPlatformToCell(p, x, z, data.heightMap[idx],
+                              data.materialMap[idx]);
+        }
       }
     }
-    data.heightMap = tempMap;
-  }
+  });
 }
 
-void TerrainGenerator::CalculateNormals(TerrainData &data) {
+void TerrainGenerator::ApplySmoothing(TerrainData &data,
+                                      core::ThreadPool *pool) {
+  // 分離型の累積和フィルタ（外周は従来どおり固定）
+  SmoothHeightField(data.heightMap, data.config.resolutionX,
+                    data.config.resolutionZ, data.config.smoothing, pool);
+}
+
+void TerrainGenerator::CalculateNormals(TerrainData &data,
+                                        const TerrainRect &rect,
+                                        core::ThreadPool *pool) {
   int resX = data.config.resolutionX;
   int resZ = data.config.resolutionZ;
   float cellW = data.config.worldWidth / (resX - 1);
@@ -240,138 +344,235 @@ void TerrainGenerator::CalculateNormals(TerrainData &data) {
 
   data.normals.resize(data.heightMap.size());
 
-  for (int z = 0; z < resZ; ++z) {
-    for (int x = 0; x < resX; ++x) {
-      // 隣接点を使って勾配を計算
-      // L R
-      // T B (Top/Bottom is Z axis)
-
-      float hL = (x > 0) ? GetHeight(data, x - 1, z) : GetHeight(data, x, z);
-      float hR =
-          (x < resX - 1) ? GetHeight(data, x + 1, z) : GetHeight(data, x, z);
-      float hD = (z > 0) ? GetHeight(data, x, z - 1)
-                         : GetHeight(data, x, z); // Down (-Z)
-      float hU = (z < resZ - 1) ? GetHeight(data, x, z + 1)
-                                : GetHeight(data, x, z); // Up (+Z)
-
-      // 接線ベクトル
-      XMVECTOR tangentX = XMVectorSet(2.0f * cellW, hR - hL, 0.0f, 0.0f);
-      XMVECTOR tangentZ = XMVectorSet(0.0f, hU - hD, -2.0f * cellD, 0.0f);
-
-      // 法線 = Cross(X, Z)  (左手座標系 Y-up)。順序を誤ると下向きになる。
-      XMVECTOR normal = XMVector3Cross(tangentX, tangentZ);
-      normal = XMVector3Normalize(normal);
-
-      XMStoreFloat3(&data.normals[z * resX + x], normal);
+  const int width = rect.x1 - rect.x0;
+  ForEachRowBand(pool, rect.z0, rect.z1, width, [&](int zBegin, int zEnd) {
+    for (int z = zBegin; z < zEnd; ++z) {
+      for (int x = rect.x0; x < rect.x1; ++x) {
+        // 隣接点を使って勾配を計算
+        // L R
+        // T B (Top/Bottom is Z axis)
+
+        float hL =
+            (x > 0) ? GetHeight(data, x - 1, z) : GetHeight(data, x, z);
+        float hR = (x < resX - 1) ? GetHeight(data, x + 1, z)
+                                  : GetHeight(data, x, z);
+        float hD = (z > 0) ? GetHeight(data, x, z - 1)
+                           : GetHeight(data, x, z); // Down (-Z)
+        float hU = (z < resZ - 1) ? GetHeight(data, x, z + 1)
+                                  : GetHeight(data, x, z); // Up (+Z)
+
+        // 接線ベクトル
+        XMVECTOR tangentX = XMVectorSet(2.0f * cellW, hR - hL, 0.0f, 0.0f);
+        XMVECTOR tangentZ = XMVectorSet(0.0f, hU - hD, -2.0f * cellD, 0.0f);
+
+        // 法線 = Cross(X, Z)  (左手座標系 Y-up)。順序を誤ると下向きになる。
+        XMVECTOR normal = XMVector3Cross(tangentX, tangentZ);
+        normal = XMVector3Normalize(normal);
+
+        XMStoreFloat3(&data.normals[z * resX + x], normal);
+      }
     }
-  }
+  });
 }
 
 void TerrainGenerator::GenerateMesh(
-    TerrainData &data, const std::vector<DirectX::XMFLOAT2> &holePositions) {
+    TerrainData &data, const std::vector<DirectX::XMFLOAT2> &holePositions,
+    core::ThreadPool *pool) {
   int resX = data.config.resolutionX;
   int resZ = data.config.resolutionZ;
-  float width = data.config.worldWidth;
-  float depth = data.config.worldDepth;
+  const TerrainRect full = TerrainRect::Full(resX, resZ);
 
-  std::vector<graphics::Vertex> vertices;
-  std::vector<uint32_t> indices;
-
-  vertices.reserve(resX * resZ);
-  indices.reserve((resX - 1) * (resZ - 1) * 6);
-
-  // 頂点生成
-  for (int z = 0; z < resZ; ++z) {
-    for (int x = 0; x < resX; ++x) {
-      float u = (float)x / (resX - 1);
-      float v = (float)z / (resZ - 1); // 1.0 - ... にするかはUV座標系による
-
-      float px = (u - 0.5f) * width;
-      float pz =
-          (0.5f - v) * depth; // Z軸反転注意。ここでは手前が-ZとするならこれでOK
-      float py = GetHeight(data, x, z);
-
-      graphics::Vertex vert;
-      vert.position = {px, py, pz};
-      vert.normal = data.normals[z * resX + x];
-      vert.texCoord = {u, v};
-
-      // デフォルト色 (マテリアルマップに基づく)
-      int idx = z * resX + x;
-      uint8_t mat = data.materialMap[idx];
-
-      switch (mat) {
-      case 0: // Fairway
-        vert.color = {0.2f, 0.6f, 0.2f, 1.0f};
-        break;
-      case 1: // Rough
-        vert.color = {0.1f, 0.35f, 0.1f, 1.0f};
-        break;
-      case 2: // Bunker
-        vert.color = {0.85f, 0.75f, 0.55f, 1.0f};
-        break;
-      case 3: // Green
-        vert.color = {0.3f, 0.8f, 0.3f, 1.0f};
-        break;
-      default:
-        vert.color = {1.0f, 1.0f, 1.0f, 1.0f};
-        break;
+  data.vertices.assign(static_cast<size_t>(resX) * resZ, graphics::Vertex{});
+  data.indices.assign(static_cast<size_t>(resX - 1) * (resZ - 1) * 6, 0);
+
+  WriteVertices(data, holePositions, full, pool);
+  WriteIndices(data, 0, resZ - 1, pool);
+  ComputeGridTangents(data.vertices, resX, resZ, full, pool);
+}
+
+void TerrainGenerator::WriteIndices(TerrainData &data, int zBegin, int zEnd,
+                                    core::ThreadPool *pool) {
+  const int resX = data.config.resolutionX;
+  std::vector<uint32_t> &indices = data.indices;
+
+  // インデックス生成 (Triangle List)
+  ForEachRowBand(pool, zBegin, zEnd, resX, [&](int bandBegin, int bandEnd) {
+    for (int z = bandBegin; z < bandEnd; ++z) {
+      for (int x = 0; x < resX - 1; ++x) {
+        // 0 --- 1
+        // |  /  |
+        // 2 --- 3
+        //
+        // Tri 1: 0-1-2
+        // Tri 2: 2-1-3
+
+        uint32_t i0 = z * resX + x;
+        uint32_t i1 = z * resX + (x + 1);
+        uint32_t i2 = (z + 1) * resX + x;
+        uint32_t i3 = (z + 1) * resX + (x + 1);
+
+        // 時計回りか反時計回りかはカリング設定による
+        // 通常DirectXは時計回りが表面だが、CullNoneならどちらでも見える
+        // ここでは標準的な時計回りで定義
+        uint32_t *quad =
+            &indices[(static_cast<size_t>(z) * (resX - 1) + x) * 6];
+
+        // Tri 1
+        quad[0] = i0;
+        quad[1] = i1;
+        quad[2] = i2;
+
+        // Tri 2
+        quad[3] = i2;
+        quad[4] = i1;
+        quad[5] = i3;
       }
+    }
+  });
+}
 
-      // ホール可視化（黒く塗る）
-      // 座標系: px, pz (World)
-      for (const auto &hole : holePositions) {
-        float dx = px - hole.x;
-        float dz = pz - hole.y; // hole.y is Z
-        float distSq = dx * dx + dz * dz;
+void TerrainGenerator::WriteVertices(
+    TerrainData &data, const std::vector<DirectX::XMFLOAT2> &holePositions,
+    const TerrainRect &rect, core::ThreadPool *pool) {
+  int resX = data.config.resolutionX;
+  int resZ = data.config.resolutionZ;
+  float width = data.config.worldWidth;
+  float depth = data.config.worldDepth;
+  std::vector<graphics::Vertex> &vertices = data.vertices;
+  const int rectWidth = rect.x1 - rect.x0;
+
+  // 頂点生成（頂点 (x, z) は常に z * resX + x に書く）
+  ForEachRowBand(pool, rect.z0, rect.z1, rectWidth, [&](int zBegin, int zEnd) {
+    for (int z = zBegin; z < zEnd; ++z) {
+      for (int x = rect.x0; x < rect.x1; ++x) {
+        float u = (float)x / (resX - 1);
+        float v = (float)z / (resZ - 1); // 1.0 - ... にするかはUV座標系による
+
+        float px = (u - 0.5f) * width;
+        float pz = (0.5f - v) *
+                   depth; // Z軸反転注意。ここでは手前が-ZとするならこれでOK
+        float py = GetHeight(data, x, z);
+
+        graphics::Vertex vert;
+        vert.position = {px, py, pz};
+        vert.normal = data.normals[z * resX + x];
+        vert.texCoord = {u, v};
+
+        // デフォルト色 (マテリアルマップに基づく)
+        int idx = z * resX + x;
+        uint8_t mat = data.materialMap[idx];
 
-        // 塗りつぶしは極小範囲に限定し、色も明るめにして黒ずみを避ける
-        if (distSq < 0.25f * 0.25f) {
-          vert.color = {0.9f, 0.95f, 0.9f, 1.0f};
+        switch (mat) {
+        case 0: // Fairway
+          vert.color = {0.2f, 0.6f, 0.2f, 1.0f};
+          break;
+        case 1: // Rough
+          vert.color = {0.1f, 0.35f, 0.1f, 1.0f};
+          break;
+        case 2: // Bunker
+          vert.color = {0.85f, 0.75f, 0.55f, 1.0f};
+          break;
+        case 3: // Green
+          vert.color = {0.3f, 0.8f, 0.3f, 1.0f};
+          break;
+        default:
+          vert.color = {1.0f, 1.0f, 1.0f, 1.0f};
           break;
         }
-      }
 
-      vertices.push_back(vert);
-    }
-  }
+        // ホール可視化（黒く塗る）
+        // 座標系: px, pz (World)
+        for (const auto &hole : holePositions) {
+          float dx = px - hole.x;
+          float dz = pz - hole.y; // hole.y is Z
+          float distSq = dx * dx + dz * dz;
+
+          // 塗りつぶしは極小範囲に限定し、色も明るめにして黒ずみを避ける
+          if (distSq < kHoleMarkRadius * kHoleMarkRadius) {
+            vert.color = {0.9f, 0.95f, 0.9f, 1.0f};
+            break;
+          }
+        }
 
-  // インデックス生成 (Triangle List)
-  for (int z = 0; z < resZ - 1; ++z) {
-    for (int x = 0; x < resX - 1; ++x) {
-      // 0 --- 1
-      // |  /  |
-      // 2 --- 3
-      //
-      // Tri 1: 0-1-2
-      // Tri 2: 2-1-3
-
-      uint32_t i0 = z * resX + x;
-      uint32_t i1 = z * resX + (x + 1);
-      uint32_t i2 = (z + 1) * resX + x;
-      uint32_t i3 = (z + 1) * resX + (x + 1);
-
-      // 時計回りか反時計回りかはカリング設定による
-      // 通常DirectXは時計回りが表面だが、CullNoneならどちらでも見える
-      // ここでは標準的な時計回りで定義
-
-      // Tri 1
-      indices.push_back(i0);
-      indices.push_back(i1);
-      indices.push_back(i2);
-
-      // Tri 2
-      indices.push_back(i2);
-      indices.push_back(i1);
-      indices.push_back(i3);
+        vertices[idx] = vert;
+      }
     }
+  });
+}
+
+void TerrainGenerator::ComputeGridTangents(
+    std::vector<graphics::Vertex> &vertices, int resX, int resZ,
+    const TerrainRect &rect, core::ThreadPool *pool) {
+  if (resX < 2 || resZ < 2) {
+    return;
   }
 
-  graphics::ComputeTangents(vertices, indices);
+  // graphics::ComputeTangents は三角形順に各頂点へ加算する（散布）。
+  // 格子では頂点に接する三角形が決まっているので、頂点側から
+  // 同じ三角形順で集める（収集）ことで、加算順ごと一致させつつ並列化する。
+  //
+  // 四角形 q = qz * (resX - 1) + qx の三角形は 2q (0-1-2), 2q+1 (2-1-3)。
+  // 頂点 (x, z) を含む三角形を三角形番号の昇順に並べると次の通り。
+  struct AdjacentTri {
+    int dx, dz, tri;
+  };
+  static constexpr AdjacentTri kAdjacent[] = {
+      {-1, -1, 1}, // 左上の四角形の頂点3
+      {0, -1, 0},  // 上の四角形の頂点2
+      {0, -1, 1},
+      {-1, 0, 0}, // 左の四角形の頂点1
+      {-1, 0, 1},
+      {0, 0, 0}, // 自身の四角形の頂点0
+  };
+
+  const int width = rect.x1 - rect.x0;
+  ForEachRowBand(pool, rect.z0, rect.z1, width, [&](int zBegin, int zEnd) {
+    for (int z = zBegin; z < zEnd; ++z) {
+      for (int x = rect.x0; x < rect.x1; ++x) {
+        graphics::Vertex &v = vertices[z * resX + x];
+        XMFLOAT3 tangentSum{0.0f, 0.0f, 0.0f};
+        XMFLOAT3 bitangentSum{0.0f, 0.0f, 0.0f};
+
+        for (const auto &adj : kAdjacent) {
+          int qx = x + adj.dx;
+          int qz = z + adj.dz;
+          if (qx < 0 || qx >= resX - 1 || qz < 0 || qz >= resZ - 1) {
+            continue;
+          }
+          uint32_t i0 = qz * resX + qx;
+          uint32_t i1 = i0 + 1;
+          uint32_t i2 = i0 + resX;
+          uint32_t i3 = i2 + 1;
+
+          XMFLOAT3 tangent;
+          XMFLOAT3 bitangent;
+          bool valid =
+              (adj.tri == 0)
+                  ? graphics::ComputeTriangleTangent(
+                        vertices[i0], vertices[i1], vertices[i2], tangent,
+                        bitangent)
+                  : graphics::ComputeTriangleTangent(
+                        vertices[i2], vertices[i1], vertices[i3], tangent,
+                        bitangent);
+          if (!valid) {
+            continue;
+          }
+          tangentSum.x += tangent.x;
+          tangentSum.y += tangent.y;
+          tangentSum.z += tangent.z;
+          bitangentSum.x += bitangent.x;
+          bitangentSum.y += bitangent.y;
+          bitangentSum.z += bitangent.z;
+        }
 
-  // データ格納
-  data.vertices = std::move(vertices);
-  data.indices = std::move(indices);
+        // 他スレッドが読むのは position/texCoord だけなので、
+        // 接線の書き込みは隣接頂点の計算と競合しない
+        v.tangent = tangentSum;
+        v.bitangent = bitangentSum;
+        graphics::OrthonormalizeTangentFrame(v);
+      }
+    }
+  });
 }
 
 float TerrainGenerator::GetHeight(const TerrainData &data, int x, int z) {
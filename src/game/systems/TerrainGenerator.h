@@ -1,10 +1,16 @@
 #pragma once
 
 #include "../../graphics/Mesh.h"
+#include "HeightFieldFilter.h"
 #include <DirectXMath.h>
+#include <cstdlib>
 #include <string>
 #include <vector>
 
+namespace core {
+class ThreadPool;
+}
+
 namespace game::systems {
 
 struct TerrainConfig {
@@ -16,6 +22,12 @@ struct TerrainConfig {
   float heightScale = 5.0f; // 高低差の最大値
   float friction = 0.5f;    // 地形の基本摩擦
   float restitution = 0.2f; // 地形の基本反発
+  // 起伏のならし（既定は従来どおり 3x3 平均を3回）
+  SmoothingSettings smoothing;
+  // 記事タイトルをシードにした FBM 起伏の高さ（0 なら加えない）
+  float noiseAmplitude = 0.0f;
+  float noiseFrequency = 3.0f; // フィールド全体に対する周波数
+  int noiseOctaves = 4;
 };
 
 struct TerrainData {
@@ -32,25 +44,106 @@ struct TerrainData {
   TerrainConfig config;
 };
 
+/// @brief セル座標の矩形 [x0, x1) x [z0, z1)
+struct TerrainRect {
+  int x0 = 0;
+  int z0 = 0;
+  int x1 = 0;
+  int z1 = 0;
+
+  bool IsEmpty() const { return x0 >= x1 || z0 >= z1; }
+  size_t Area() const {
+    return IsEmpty() ? 0 : static_cast<size_t>(x1 - x0) * (z1 - z0);
+  }
+
+  /// @brief 両方を含む最小の矩形（空の矩形は無視）
+  TerrainRect Union(const TerrainRect &other) const;
+
+  /// @brief 各辺を margin だけ広げ、[0, width) x [0, height) に収める
+  TerrainRect Expanded(int margin, int width, int height) const;
+
+  /// @brief グリッド全体
+  static TerrainRect Full(int width, int height) {
+    return {0, 0, width, height};
+  }
+};
+
+/// @brief ホール1つ分のグリーン・エプロン・バンカーのパラメータ
+struct TerrainPlatform {
+  int cx = 0;
+  int cz = 0;
+  int radius = 0;
+  float targetHeight = 0.0f;
+  float bowlDepth = 0.15f;
+  float bunkerAngle = 0.0f;
+  float bunkerDist = 0.0f;
+
+  /// @brief 適用対象（中心から ±radius*3 の正方形）に入っているか
+  bool Covers(int x, int z) const {
+    return std::abs(x - cx) <= radius * 3 && std::abs(z - cz) <= radius * 3;
+  }
+
+  /// @brief 実際に高さ・マテリアルが変わりうる範囲（バンカー外縁まで）
+  TerrainRect AffectedRect(int resX, int resZ) const;
+
+  bool operator==(const TerrainPlatform &) const = default;
+};
+
+/// @brief ハイトマップ・法線・メッシュを生成する
+/// @details 各ステージは行バンド単位でワーカープールに分配する。
+///          乱数は描画順ではなく座標（ホール中心）から種を作り、
+///          各セルの書き込み先も行ごとに決まっているため、
+///          出力はスレッド数によらず単一スレッド実行とビット単位で一致する。
 class TerrainGenerator {
 public:
-  // 記事データに基づいて地形データを生成
+  // 記事データに基づいて地形データを生成（共有プールで並列実行）
   static TerrainData
   GenerateTerrain(const std::string &articleText,
                   const std::vector<DirectX::XMFLOAT2> &holePositions,
                   const TerrainConfig &config);
 
+  /// @brief 使用するプールを指定して地形データを生成
+  /// @param pool 並列化に使うプール（nullptrなら単一スレッド）
+  static TerrainData
+  GenerateTerrain(const std::string &articleText,
+                  const std::vector<DirectX::XMFLOAT2> &holePositions,
+                  const TerrainConfig &config, core::ThreadPool *pool);
+
 private:
-  // ハイトマップ生成の各ステップ
-  static void GenerateBaseHeightMap(TerrainData &data, const std::string &text);
-  static void
-  CreatePlatforms(TerrainData &data,
-                  const std::vector<DirectX::XMFLOAT2> &holePositions);
-  static void ApplySmoothing(TerrainData &data, int iterations);
-  static void
-  GenerateMesh(TerrainData &data,
-               const std::vector<DirectX::XMFLOAT2> &holePositions = {});
-  static void CalculateNormals(TerrainData &data);
+  friend class IncrementalTerrainGenerator;
+  friend class TerrainGenerationJob;
+
+  // ハイトマップ生成の各ステップ。rect を取るものはその範囲だけを
+  // 計算し直す（差分再生成でも同じ関数を使う）。
+  static void GenerateBaseHeightMap(TerrainData &data, uint32_t seed,
+                                    const TerrainRect &rect,
+                                    core::ThreadPool *pool);
+  static std::vector<TerrainPlatform>
+  ResolvePlatforms(const TerrainConfig &config,
+                   const std::vector<float> &baseHeights,
+                   const std::vector<uint8_t> &baseMaterials,
+                   const std::vector<DirectX::XMFLOAT2> &holePositions);
+  static void ApplyPlatforms(TerrainData &data,
+                             const std::vector<TerrainPlatform> &platforms,
+                             const TerrainRect &rect, core::ThreadPool *pool);
+  static void ApplySmoothing(TerrainData &data, core::ThreadPool *pool);
+  static void GenerateMesh(TerrainData &data,
+                           const std::vector<DirectX::XMFLOAT2> &holePositions,
+                           core::ThreadPool *pool);
+  static void WriteVertices(TerrainData &data,
+                            const std::vector<DirectX::XMFLOAT2> &holePositions,
+                            const TerrainRect &rect, core::ThreadPool *pool);
+  /// @brief 四角形の行 [zBegin, zEnd) のインデックスを書く（領域は確保済み）
+  static void WriteIndices(TerrainData &data, int zBegin, int zEnd,
+                           core::ThreadPool *pool);
+  static void CalculateNormals(TerrainData &data, const TerrainRect &rect,
+                               core::ThreadPool *pool);
+  static void ComputeGridTangents(std::vector<graphics::Vertex> &vertices,
+                                  int resX, int resZ, const TerrainRect &rect,
+                                  core::ThreadPool *pool);
+
+  /// @brief ホール位置の頂点を塗る範囲（ワールド座標の半径）
+  static constexpr float kHoleMarkRadius = 0.25f;
 
   // ユーティリティ
   static float GetHeight(const TerrainData &data, int x, int z);
@@ -0,0 +1,427 @@
+/**
+ * @file TerrainHeightPyramid.cpp
+ * @brief ハイトマップ min/max ピラミッドとキャストの実装
+ */
+
+#include "TerrainHeightPyramid.h"
+#include "../../core/ThreadPool.h"
+#include "TerrainGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace game::systems {
+
+namespace {
+
+struct Vec3 {
+  float x, y, z;
+};
+
+inline Vec3 operator+(Vec3 a, Vec3 b) {
+  return {a.x + b.x, a.y + b.y, a.z + b.z};
+}
+inline Vec3 operator-(Vec3 a, Vec3 b) {
+  return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+inline Vec3 operator*(Vec3 a, float s) { return {a.x * s, a.y * s, a.z * s}; }
+inline float Dot(Vec3 a, Vec3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+inline Vec3 Cross(Vec3 a, Vec3 b) {
+  return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+          a.x * b.y - a.y * b.x};
+}
+inline Vec3 Normalize(Vec3 v) {
+  const float len = std::sqrt(Dot(v, v));
+  return (len > 0.0f) ? v * (1.0f / len) : Vec3{0.0f, 1.0f, 0.0f};
+}
+inline Vec3 ToVec3(const DirectX::XMFLOAT3 &v) { return {v.x, v.y, v.z}; }
+inline DirectX::XMFLOAT3 ToFloat3(Vec3 v) { return {v.x, v.y, v.z}; }
+
+/// @brief 行範囲を分割して処理する（pool が nullptr なら単一スレッド）
+template <typename Fn>
+void RunRange(core::ThreadPool *pool, int count, int cost, Fn &&fn) {
+  // 1チャンクあたり 16K 要素程度になるように行をまとめる
+  const size_t grain =
+      static_cast<size_t>(std::max(1, 16384 / std::max(1, cost)));
+  if (!pool || count <= static_cast<int>(grain)) {
+    fn(0, count);
+    return;
+  }
+  pool->ParallelFor(static_cast<size_t>(count), grain,
+                    [&](size_t begin, size_t end) {
+                      fn(static_cast<int>(begin), static_cast<int>(end));
+                    });
+}
+
+/// @brief 最小の非負解 t（at^2 + 2bt + c = 0）を [0, tMax] で探す
+bool SmallestRoot(float a, float b, float c, float tMax, float &t) {
+  const float disc = b * b - a * c;
+  if (a <= 0.0f || disc < 0.0f) {
+    return false;
+  }
+  const float root = (-b - std::sqrt(disc)) / a;
+  if (root < 0.0f || root > tMax) {
+    return false;
+  }
+  t = root;
+  return true;
+}
+
+} // namespace
+
+/// @brief 正規化したキャストのパラメータ
+struct TerrainHeightPyramid::Cast {
+  Vec3 origin;
+  Vec3 dir;
+  float invDir[3];
+  bool zeroDir[3];
+  float radius;
+};
+
+void TerrainHeightPyramid::Clear() {
+  m_heights.clear();
+  m_levels.clear();
+  m_resX = m_resZ = 0;
+}
+
+void TerrainHeightPyramid::Build(const TerrainData &data,
+                                 core::ThreadPool *pool) {
+  Clear();
+  const int resX = data.config.resolutionX;
+  const int resZ = data.config.resolutionZ;
+  if (resX < 2 || resZ < 2 ||
+      data.heightMap.size() != static_cast<size_t>(resX) * resZ) {
+    return;
+  }
+  m_heights = data.heightMap;
+  m_resX = resX;
+  m_resZ = resZ;
+  m_worldWidth = data.config.worldWidth;
+  m_worldDepth = data.config.worldDepth;
+
+  // レベル 0: セルの4頂点の最小・最大
+  Level base;
+  base.width = resX - 1;
+  base.depth = resZ - 1;
+  base.nodes.resize(static_cast<size_t>(base.width) * base.depth);
+  RunRange(pool, base.depth, base.width, [&](int zBegin, int zEnd) {
+    for (int z = zBegin; z < zEnd; ++z) {
+      const float *row0 = &m_heights[static_cast<size_t>(z) * resX];
+      const float *row1 = row0 + resX;
+      MinMax *out = &base.nodes[static_cast<size_t>(z) * base.width];
+      for (int x = 0; x < base.width; ++x) {
+        const float a = row0[x], b = row0[x + 1];
+        const float c = row1[x], d = row1[x + 1];
+        out[x] = {std::min(std::min(a, b), std::min(c, d)),
+                  std::max(std::max(a, b), std::max(c, d))};
+      }
+    }
+  });
+  m_levels.push_back(std::move(base));
+
+  // 上位レベル: 2x2 ノードをまとめる（端は1列・1行だけのこともある）
+  while (m_levels.back().width > 1 || m_levels.back().depth > 1) {
+    const Level &child = m_levels.back();
+    Level parent;
+    parent.width = (child.width + 1) / 2;
+    parent.depth = (child.depth + 1) / 2;
+    parent.nodes.resize(static_cast<size_t>(parent.width) * parent.depth);
+    RunRange(pool, parent.depth, parent.width * 4, [&](int zBegin, int zEnd) {
+      for (int z = zBegin; z < zEnd; ++z) {
+        for (int x = 0; x < parent.width; ++x) {
+          MinMax m{std::numeric_limits<float>::max(),
+                   std::numeric_limits<float>::lowest()};
+          for (int j = 0; j < 2; ++j) {
+            const int cz = z * 2 + j;
+            for (int i = 0; i < 2 && cz < child.depth; ++i) {
+              const int cx = x * 2 + i;
+              if (cx < child.width) {
+                const MinMax &c =
+                    child.nodes[static_cast<size_t>(cz) * child.width + cx];
+                m.min = std::min(m.min, c.min);
+                m.max = std::max(m.max, c.max);
+              }
+            }
+          }
+          parent.nodes[static_cast<size_t>(z) * parent.width + x] = m;
+        }
+      }
+    });
+    m_levels.push_back(std::move(parent));
+  }
+}
+
+void TerrainHeightPyramid::GetNodeRange(int level, int x, int z,
+                                        float &outMin, float &outMax) const {
+  const Level &l = m_levels[level];
+  const MinMax &m = l.nodes[static_cast<size_t>(z) * l.width + x];
+  outMin = m.min;
+  outMax = m.max;
+}
+
+DirectX::XMFLOAT3 TerrainHeightPyramid::VertexPosition(int x, int z) const {
+  // TerrainGenerator::WriteVertices と同じ式で求める
+  const float u = (float)x / (m_resX - 1);
+  const float v = (float)z / (m_resZ - 1);
+  return {(u - 0.5f) * m_worldWidth, GetVertexHeight(x, z),
+          (0.5f - v) * m_worldDepth};
+}
+
+bool TerrainHeightPyramid::Raycast(const DirectX::XMFLOAT3 &origin,
+                                   const DirectX::XMFLOAT3 &direction,
+                                   float maxDistance,
+                                   TerrainRayHit &hit) const {
+  return SphereCast(origin, direction, 0.0f, maxDistance, hit);
+}
+
+bool TerrainHeightPyramid::SphereCast(const DirectX::XMFLOAT3 &origin,
+                                      const DirectX::XMFLOAT3 &direction,
+                                      float radius, float maxDistance,
+                                      TerrainRayHit &hit) const {
+  const Vec3 d = ToVec3(direction);
+  const float len = std::sqrt(Dot(d, d));
+  if (IsEmpty() || len <= 0.0f || !(maxDistance >= 0.0f) || radius < 0.0f) {
+    return false;
+  }
+
+  Cast cast;
+  cast.origin = ToVec3(origin);
+  cast.dir = d * (1.0f / len);
+  cast.radius = radius;
+  const float dirs[3] = {cast.dir.x, cast.dir.y, cast.dir.z};
+  for (int a = 0; a < 3; ++a) {
+    cast.zeroDir[a] = dirs[a] == 0.0f;
+    cast.invDir[a] = cast.zeroDir[a] ? 0.0f : 1.0f / dirs[a];
+  }
+
+  TerrainRayHit best;
+  best.distance = maxDistance;
+  bool found = false;
+  Visit(cast, GetLevelCount() - 1, 0, 0, best, found);
+  if (found) {
+    hit = best;
+  }
+  return found;
+}
+
+namespace {
+
+/// @brief 軸平行箱に入る・出る距離（始点より前は 0 に切り詰める）
+bool SlabRange(const float origin[3], const float invDir[3],
+               const bool zeroDir[3], const float bmin[3],
+               const float bmax[3], float &tEnter, float &tExit) {
+  tEnter = 0.0f;
+  tExit = std::numeric_limits<float>::max();
+  for (int a = 0; a < 3; ++a) {
+    if (zeroDir[a]) {
+      if (origin[a] < bmin[a] || origin[a] > bmax[a]) {
+        return false;
+      }
+      continue;
+    }
+    float t0 = (bmin[a] - origin[a]) * invDir[a];
+    float t1 = (bmax[a] - origin[a]) * invDir[a];
+    if (t0 > t1) {
+      std::swap(t0, t1);
+    }
+    tEnter = std::max(tEnter, t0);
+    tExit = std::min(tExit, t1);
+    if (tEnter > tExit) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @brief 動く球（半径 0 ならレイ）と三角形の最初の接触
+/// @param n 三角形の上向き単位法線
+/// @details 面・3辺・3頂点それぞれとの接触時刻のうち最小のものを返す。
+///          裏側（地中側）からの接触と、遠ざかる向きの接触は無視する。
+bool SweepTriangle(Vec3 o, Vec3 d, float r, Vec3 a, Vec3 b, Vec3 c, Vec3 n,
+                   float tMax, float &outT, Vec3 &outPoint, Vec3 &outNormal) {
+  bool found = false;
+  const float nd = Dot(n, d);
+  const float s0 = Dot(n, o - a);
+
+  // 面: 中心と平面の距離が r になる時刻。接点が三角形内なら確定
+  if (s0 >= 0.0f && (nd < 0.0f || s0 < r)) {
+    const float t = (s0 <= r) ? 0.0f : (r - s0) / nd;
+    if (t <= tMax) {
+      const Vec3 p = o + d * t - n * r;
+      // 巻き順によらないよう、3辺について同じ側にあるかで判定する
+      const float e0 = Dot(Cross(b - a, p - a), n);
+      const float e1 = Dot(Cross(c - b, p - b), n);
+      const float e2 = Dot(Cross(a - c, p - c), n);
+      if ((e0 >= 0.0f && e1 >= 0.0f && e2 >= 0.0f) ||
+          (e0 <= 0.0f && e1 <= 0.0f && e2 <= 0.0f)) {
+        outT = t;
+        outPoint = p;
+        outNormal = n;
+        return true;
+      }
+    }
+  }
+  if (r <= 0.0f) {
+    return false;
+  }
+
+  // 頂点: |o + t d - v| = r
+  const Vec3 verts[3] = {a, b, c};
+  for (const Vec3 &v : verts) {
+    const Vec3 m = o - v;
+    const float cc = Dot(m, m) - r * r;
+    float t;
+    if (cc <= 0.0f) {
+      t = 0.0f;
+    } else if (!SmallestRoot(1.0f, Dot(d, m), cc, tMax, t)) {
+      continue;
+    }
+    const Vec3 centre = o + d * t;
+    const Vec3 normal = Normalize(centre - v);
+    if (t > 0.0f && Dot(normal, d) >= 0.0f) {
+      continue;
+    }
+    tMax = t;
+    outT = t;
+    outPoint = v;
+    outNormal = normal;
+    found = true;
+  }
+
+  // 辺: 中心と直線の距離が r になり、足が辺の内側にある時刻
+  const Vec3 edges[3][2] = {{a, b}, {b, c}, {c, a}};
+  for (const auto &edge : edges) {
+    const Vec3 e = edge[1] - edge[0];
+    const Vec3 m = o - edge[0];
+    const float ee = Dot(e, e);
+    const float de = Dot(d, e);
+    const float me = Dot(m, e);
+    const float qa = ee - de * de;
+    const float qb = ee * Dot(d, m) - de * me;
+    const float qc = ee * (Dot(m, m) - r * r) - me * me;
+    float t;
+    if (qc <= 0.0f) {
+      t = 0.0f;
+    } else if (!SmallestRoot(qa, qb, qc, tMax, t)) {
+      continue;
+    }
+    const float f = (me + t * de) / ee;
+    if (f < 0.0f || f > 1.0f) {
+      continue;
+    }
+    const Vec3 foot = edge[0] + e * f;
+    const Vec3 centre = o + d * t;
+    const Vec3 normal = Normalize(centre - foot);
+    if (t > 0.0f && Dot(normal, d) >= 0.0f) {
+      continue;
+    }
+    tMax = t;
+    outT = t;
+    outPoint = foot;
+    outNormal = normal;
+    found = true;
+  }
+  return found;
+}
+
+} // namespace
+
+bool TerrainHeightPyramid::IntersectCell(const Cast &cast, int cx, int cz,
+                                         TerrainRayHit &best) const {
+  // 0 --- 1
+  // |  /  |   Tri 1: 0-1-2 / Tri 2: 2-1-3（GenerateMesh と同じ分割）
+  // 2 --- 3
+  const Vec3 p0 = ToVec3(VertexPosition(cx, cz));
+  const Vec3 p1 = ToVec3(VertexPosition(cx + 1, cz));
+  const Vec3 p2 = ToVec3(VertexPosition(cx, cz + 1));
+  const Vec3 p3 = ToVec3(VertexPosition(cx + 1, cz + 1));
+  const Vec3 tris[2][3] = {{p0, p1, p2}, {p2, p1, p3}};
+
+  bool found = false;
+  for (const auto &tri : tris) {
+    Vec3 n = Normalize(Cross(tri[1] - tri[0], tri[2] - tri[0]));
+    if (n.y < 0.0f) {
+      n = n * -1.0f;
+    }
+    float t;
+    Vec3 point, normal;
+    if (SweepTriangle(cast.origin, cast.dir, cast.radius, tri[0], tri[1],
+                      tri[2], n, best.distance, t, point, normal)) {
+      best.distance = t;
+      best.point = ToFloat3(point);
+      best.normal = ToFloat3(normal);
+      best.cellX = cx;
+      best.cellZ = cz;
+      found = true;
+    }
+  }
+  return found;
+}
+
+void TerrainHeightPyramid::Visit(const Cast &cast, int level, int nx, int nz,
+                                 TerrainRayHit &best, bool &found) const {
+  const int cellsX = m_levels[0].width;
+  const int cellsZ = m_levels[0].depth;
+  const float origin[3] = {cast.origin.x, cast.origin.y, cast.origin.z};
+  const float r = cast.radius;
+
+  // ノードを包む箱（球の半径だけ広げる）に入る距離
+  auto entry = [&](int l, int x, int z, float &tEnter) {
+    const Level &node = m_levels[l];
+    const MinMax &m = node.nodes[static_cast<size_t>(z) * node.width + x];
+    const int x0 = x << l, z0 = z << l;
+    const int x1 = std::min((x + 1) << l, cellsX);
+    const int z1 = std::min((z + 1) << l, cellsZ);
+    const DirectX::XMFLOAT3 lo = VertexPosition(x0, z1);
+    const DirectX::XMFLOAT3 hi = VertexPosition(x1, z0);
+    const float bmin[3] = {lo.x - r, m.min - r, lo.z - r};
+    const float bmax[3] = {hi.x + r, m.max + r, hi.z + r};
+    float tExit;
+    return SlabRange(origin, cast.invDir, cast.zeroDir, bmin, bmax, tEnter,
+                     tExit) &&
+           tEnter <= best.distance;
+  };
+
+  float rootEnter;
+  if (level == GetLevelCount() - 1 && !entry(level, nx, nz, rootEnter)) {
+    return;
+  }
+  if (level == 0) {
+    found = IntersectCell(cast, nx, nz, best) || found;
+    return;
+  }
+
+  // 子を入る距離の近い順にたどる
+  struct Child {
+    float tEnter;
+    int x, z;
+  };
+  Child children[4];
+  int count = 0;
+  const Level &childLevel = m_levels[level - 1];
+  for (int j = 0; j < 2; ++j) {
+    for (int i = 0; i < 2; ++i) {
+      const int cx = nx * 2 + i;
+      const int cz = nz * 2 + j;
+      float tEnter;
+      if (cx < childLevel.width && cz < childLevel.depth &&
+          entry(level - 1, cx, cz, tEnter)) {
+        children[count++] = {tEnter, cx, cz};
+      }
+    }
+  }
+  for (int i = 1; i < count; ++i) {
+    for (int j = i; j > 0 && children[j].tEnter < children[j - 1].tEnter; --j) {
+      std::swap(children[j], children[j - 1]);
+    }
+  }
+  for (int i = 0; i < count; ++i) {
+    // 先に見つかった接触より遠いノードには、より近い接触はない
+    if (found && children[i].tEnter > best.distance) {
+      break;
+    }
+    Visit(cast, level - 1, children[i].x, children[i].z, best, found);
+  }
+}
+
+} // namespace game::systems
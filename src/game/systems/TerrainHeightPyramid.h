@@ -0,0 +1,103 @@
+#pragma once
+/**
+ * @file TerrainHeightPyramid.h
+ * @brief ハイトマップの min/max ピラミッドと、それを使うレイ・球キャスト
+ */
+
+#include <DirectXMath.h>
+#include <cstddef>
+#include <vector>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace game::systems {
+
+struct TerrainData;
+
+/// @brief キャストの結果
+struct TerrainRayHit {
+  float distance = 0.0f;             ///< 始点から接触までの距離
+  DirectX::XMFLOAT3 point{};         ///< 地表上の接触点
+  DirectX::XMFLOAT3 normal{0, 1, 0}; ///< 接触点での法線（単位ベクトル）
+  int cellX = 0;                     ///< 接触したセル
+  int cellZ = 0;
+};
+
+/// @brief 地形メッシュに対するレイキャスト・球キャスト
+/// @details レベル 0 は1セル（4頂点）の高さの最小・最大、レベル L は
+///          2^L x 2^L セルの最小・最大を持つ。キャストは根から
+///          「光線が入る距離」の近い順に子をたどり、すでに見つかった
+///          接触より遠いノードや高さの範囲を外れるノードを打ち切る。
+///          葉では TerrainGenerator::GenerateMesh と同じ分割の三角形
+///          （0-1-2 / 2-1-3）と厳密に交差判定するので、距離と法線は
+///          描画しているメッシュそのものに対する値になる。
+///          上向きの面にだけ当たり、地中から上へ抜けるレイは無視する。
+class TerrainHeightPyramid {
+public:
+  /// @brief TerrainData のハイトマップからピラミッドを作る
+  /// @param pool 並列化に使うプール（nullptrなら単一スレッド）
+  void Build(const TerrainData &data, core::ThreadPool *pool);
+
+  void Clear();
+
+  bool IsEmpty() const { return m_levels.empty(); }
+
+  /// @brief レベル数（根が1ノードになるまで）
+  int GetLevelCount() const { return static_cast<int>(m_levels.size()); }
+
+  /// @brief レイキャスト
+  /// @param origin 始点（ワールド）
+  /// @param direction 向き（正規化していなくてよい）
+  /// @param maxDistance 調べる最大距離
+  /// @return maxDistance 以内で地表に当たったら true
+  bool Raycast(const DirectX::XMFLOAT3 &origin,
+               const DirectX::XMFLOAT3 &direction, float maxDistance,
+               TerrainRayHit &hit) const;
+
+  /// @brief 球を動かして最初に地表へ触れる位置を求める
+  /// @details hit.distance は球の中心の移動距離。始点ですでに地表に
+  ///          めり込んでいる場合は distance = 0 を返す。
+  bool SphereCast(const DirectX::XMFLOAT3 &origin,
+                  const DirectX::XMFLOAT3 &direction, float radius,
+                  float maxDistance, TerrainRayHit &hit) const;
+
+  /// @brief 頂点 (x, z) の高さ
+  float GetVertexHeight(int x, int z) const {
+    return m_heights[static_cast<size_t>(z) * m_resX + x];
+  }
+
+  /// @brief レベル level のノード (x, z) が覆う高さの範囲
+  void GetNodeRange(int level, int x, int z, float &outMin,
+                    float &outMax) const;
+
+private:
+  struct MinMax {
+    float min;
+    float max;
+  };
+
+  struct Level {
+    int width = 0; ///< ノード数（x 方向）
+    int depth = 0; ///< ノード数（z 方向）
+    std::vector<MinMax> nodes;
+  };
+
+  struct Cast;
+
+  void Visit(const Cast &cast, int level, int nx, int nz,
+             TerrainRayHit &best, bool &found) const;
+  bool IntersectCell(const Cast &cast, int cx, int cz,
+                     TerrainRayHit &best) const;
+  DirectX::XMFLOAT3 VertexPosition(int x, int z) const;
+
+  std::vector<float> m_heights;
+  std::vector<Level> m_levels; ///< [0] がセル単位
+  int m_resX = 0;
+  int m_resZ = 0;
+  float m_worldWidth = 0.0f;
+  float m_worldDepth = 0.0f;
+};
+
+} // namespace game::systems
@@ -0,0 +1,270 @@
+/**
+ * @file TerrainSampler.cpp
+ * @brief 地形のバッチ標本化の実装
+ */
+
+#include "TerrainSampler.h"
+#include "TerrainGenerator.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#include <emmintrin.h>
+#include <xmmintrin.h>
+#define TERRAIN_SAMPLER_SSE2 1
+#endif
+
+namespace game::systems {
+
+void TerrainSampler::Build(const TerrainData &data) {
+  Clear();
+  const int resX = data.config.resolutionX;
+  const int resZ = data.config.resolutionZ;
+  if (resX < 2 || resZ < 2 ||
+      data.heightMap.size() != static_cast<size_t>(resX) * resZ) {
+    return;
+  }
+
+  m_resX = resX;
+  m_resZ = resZ;
+  m_scaleX = (resX - 1) / data.config.worldWidth;
+  m_scaleZ = (resZ - 1) / data.config.worldDepth;
+  m_offsetX = 0.5f * (resX - 1);
+  m_offsetZ = 0.5f * (resZ - 1);
+
+  const float *h = data.heightMap.data();
+  m_cells.resize(static_cast<size_t>(resX - 1) * (resZ - 1));
+  for (int z = 0; z < resZ - 1; ++z) {
+    const float *row0 = h + static_cast<size_t>(z) * resX;
+    const float *row1 = row0 + resX;
+    CellCorners *dst = &m_cells[static_cast<size_t>(z) * (resX - 1)];
+    for (int x = 0; x < resX - 1; ++x) {
+      dst[x] = {row0[x], row0[x + 1], row1[x], row1[x + 1]};
+    }
+  }
+
+  if (data.materialMap.size() == data.heightMap.size()) {
+    m_materials = data.materialMap;
+  }
+}
+
+void TerrainSampler::Clear() {
+  m_cells.clear();
+  m_materials.clear();
+  m_resX = 0;
+  m_resZ = 0;
+}
+
+bool TerrainSampler::Contains(float x, float z) const {
+  if (m_cells.empty()) {
+    return false;
+  }
+  const float fx = x * m_scaleX + m_offsetX;
+  const float fz = m_offsetZ - z * m_scaleZ;
+  return fx >= 0.0f && fx < static_cast<float>(m_resX - 1) && fz >= 0.0f &&
+         fz < static_cast<float>(m_resZ - 1);
+}
+
+void TerrainSampler::Sample(const float *xs, const float *zs, size_t count,
+                            const TerrainSamples &out) const {
+  // 範囲外（または地形なし）の点の値
+  auto writeFlat = [&](size_t i) {
+    if (out.height)
+      out.height[i] = 0.0f;
+    if (out.normalX)
+      out.normalX[i] = 0.0f;
+    if (out.normalY)
+      out.normalY[i] = 1.0f;
+    if (out.normalZ)
+      out.normalZ[i] = 0.0f;
+    if (out.material)
+      out.material[i] = 0;
+  };
+
+  if (m_cells.empty()) {
+    for (size_t i = 0; i < count; ++i) {
+      writeFlat(i);
+    }
+    return;
+  }
+
+  const float maxX = static_cast<float>(m_resX - 1);
+  const float maxZ = static_cast<float>(m_resZ - 1);
+  const int cellsX = m_resX - 1;
+
+  // 最も近い頂点のマテリアル
+  auto material = [&](float fx, float fz) -> uint8_t {
+    if (m_materials.empty()) {
+      return 0;
+    }
+    const int mx = std::min(static_cast<int>(fx + 0.5f), m_resX - 1);
+    const int mz = std::min(static_cast<int>(fz + 0.5f), m_resZ - 1);
+    return m_materials[static_cast<size_t>(mz) * m_resX + mx];
+  };
+
+  size_t i = 0;
+#ifdef TERRAIN_SAMPLER_SSE2
+  const __m128 scaleX = _mm_set1_ps(m_scaleX);
+  const __m128 scaleZ = _mm_set1_ps(m_scaleZ);
+  const __m128 offsetX = _mm_set1_ps(m_offsetX);
+  const __m128 offsetZ = _mm_set1_ps(m_offsetZ);
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 one = _mm_set1_ps(1.0f);
+  const __m128 limitX = _mm_set1_ps(maxX);
+  const __m128 limitZ = _mm_set1_ps(maxZ);
+
+  for (; i + 4 <= count; i += 4) {
+    const __m128 fx = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(xs + i), scaleX),
+                                 offsetX);
+    const __m128 fz = _mm_sub_ps(offsetZ,
+                                 _mm_mul_ps(_mm_loadu_ps(zs + i), scaleZ));
+    const __m128 insideX =
+        _mm_and_ps(_mm_cmpge_ps(fx, zero), _mm_cmplt_ps(fx, limitX));
+    const __m128 insideZ =
+        _mm_and_ps(_mm_cmpge_ps(fz, zero), _mm_cmplt_ps(fz, limitZ));
+    const __m128 inside = _mm_and_ps(insideX, insideZ);
+    const int insideBits = _mm_movemask_ps(inside);
+
+    alignas(16) float fxs[4];
+    alignas(16) float fzs[4];
+    alignas(16) int32_t ix[4];
+    alignas(16) int32_t iz[4];
+    _mm_store_ps(fxs, fx);
+    _mm_store_ps(fzs, fz);
+
+    // 範囲外のレーンはセル 0 を読み、結果はあとで平らな値に差し替える
+    __m128 c[4];
+    for (int k = 0; k < 4; ++k) {
+      if (insideBits & (1 << k)) {
+        ix[k] = std::min(static_cast<int32_t>(fxs[k]), m_resX - 2);
+        iz[k] = std::min(static_cast<int32_t>(fzs[k]), m_resZ - 2);
+      } else {
+        ix[k] = 0;
+        iz[k] = 0;
+      }
+      c[k] = _mm_load_ps(
+          &m_cells[static_cast<size_t>(iz[k]) * cellsX + ix[k]].h00);
+    }
+    // 4点 x 4隅 → 隅ごとの4点
+    _MM_TRANSPOSE4_PS(c[0], c[1], c[2], c[3]);
+    const __m128 h00 = c[0];
+    const __m128 h10 = c[1];
+    const __m128 h01 = c[2];
+    const __m128 h11 = c[3];
+
+    const __m128 dx = _mm_sub_ps(
+        fx, _mm_cvtepi32_ps(_mm_load_si128(reinterpret_cast<__m128i *>(ix))));
+    const __m128 dz = _mm_sub_ps(
+        fz, _mm_cvtepi32_ps(_mm_load_si128(reinterpret_cast<__m128i *>(iz))));
+
+    const __m128 e0 = _mm_sub_ps(h10, h00);
+    const __m128 e1 = _mm_sub_ps(h11, h01);
+    const __m128 f0 = _mm_sub_ps(h01, h00);
+    const __m128 f1 = _mm_sub_ps(h11, h10);
+
+    if (out.height) {
+      const __m128 h0 = _mm_add_ps(h00, _mm_mul_ps(e0, dx));
+      const __m128 h1 = _mm_add_ps(h01, _mm_mul_ps(e1, dx));
+      const __m128 height =
+          _mm_add_ps(h0, _mm_mul_ps(_mm_sub_ps(h1, h0), dz));
+      _mm_storeu_ps(out.height + i, _mm_and_ps(inside, height));
+    }
+
+    if (out.normalX || out.normalY || out.normalZ) {
+      const __m128 gx = _mm_add_ps(e0, _mm_mul_ps(_mm_sub_ps(e1, e0), dz));
+      const __m128 gz = _mm_add_ps(f0, _mm_mul_ps(_mm_sub_ps(f1, f0), dx));
+      const __m128 nx = _mm_sub_ps(zero, _mm_mul_ps(gx, scaleX));
+      const __m128 nz = _mm_mul_ps(gz, scaleZ);
+      const __m128 lenSq =
+          _mm_add_ps(_mm_add_ps(_mm_mul_ps(nx, nx), _mm_mul_ps(nz, nz)), one);
+      const __m128 inv = _mm_div_ps(one, _mm_sqrt_ps(lenSq));
+      if (out.normalX) {
+        _mm_storeu_ps(out.normalX + i, _mm_and_ps(inside, _mm_mul_ps(nx, inv)));
+      }
+      if (out.normalY) {
+        _mm_storeu_ps(out.normalY + i,
+                      _mm_or_ps(_mm_and_ps(inside, inv),
+                                _mm_andnot_ps(inside, one)));
+      }
+      if (out.normalZ) {
+        _mm_storeu_ps(out.normalZ + i, _mm_and_ps(inside, _mm_mul_ps(nz, inv)));
+      }
+    }
+
+    if (out.material) {
+      for (int k = 0; k < 4; ++k) {
+        out.material[i + k] =
+            (insideBits & (1 << k)) ? material(fxs[k], fzs[k]) : 0;
+      }
+    }
+  }
+#endif
+
+  // 残り（SSE2 がなければ全部）を1点ずつ。演算の順序は上と同じ
+  for (; i < count; ++i) {
+    const float fx = xs[i] * m_scaleX + m_offsetX;
+    const float fz = m_offsetZ - zs[i] * m_scaleZ;
+    if (!(fx >= 0.0f && fx < maxX && fz >= 0.0f && fz < maxZ)) {
+      writeFlat(i);
+      continue;
+    }
+    const int ix = std::min(static_cast<int>(fx), m_resX - 2);
+    const int iz = std::min(static_cast<int>(fz), m_resZ - 2);
+    const CellCorners &c = m_cells[static_cast<size_t>(iz) * cellsX + ix];
+    const float dx = fx - static_cast<float>(ix);
+    const float dz = fz - static_cast<float>(iz);
+
+    const float e0 = c.h10 - c.h00;
+    const float e1 = c.h11 - c.h01;
+    const float f0 = c.h01 - c.h00;
+    const float f1 = c.h11 - c.h10;
+
+    if (out.height) {
+      const float h0 = c.h00 + e0 * dx;
+      const float h1 = c.h01 + e1 * dx;
+      out.height[i] = h0 + (h1 - h0) * dz;
+    }
+
+    if (out.normalX || out.normalY || out.normalZ) {
+      // 補間面の勾配 (dh/dx, dh/dz) から n = (-dh/dx, 1, -dh/dz)。
+      // 格子 Z はワールド Z と逆向きなので nz の符号が反転する
+      const float gx = e0 + (e1 - e0) * dz;
+      const float gz = f0 + (f1 - f0) * dx;
+      const float nx = 0.0f - gx * m_scaleX;
+      const float nz = gz * m_scaleZ;
+      const float inv = 1.0f / std::sqrt((nx * nx + nz * nz) + 1.0f);
+      if (out.normalX)
+        out.normalX[i] = nx * inv;
+      if (out.normalY)
+        out.normalY[i] = inv;
+      if (out.normalZ)
+        out.normalZ[i] = nz * inv;
+    }
+
+    if (out.material) {
+      out.material[i] = material(fx, fz);
+    }
+  }
+}
+
+float TerrainSampler::SampleHeight(float x, float z) const {
+  float height = 0.0f;
+  TerrainSamples out;
+  out.height = &height;
+  Sample(&x, &z, 1, out);
+  return height;
+}
+
+void TerrainSampler::SamplePoint(float x, float z, float &outHeight,
+                                 DirectX::XMFLOAT3 &outNormal,
+                                 uint8_t &outMaterial) const {
+  TerrainSamples out;
+  out.height = &outHeight;
+  out.normalX = &outNormal.x;
+  out.normalY = &outNormal.y;
+  out.normalZ = &outNormal.z;
+  out.material = &outMaterial;
+  Sample(&x, &z, 1, out);
+}
+
+} // namespace game::systems
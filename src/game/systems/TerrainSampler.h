@@ -0,0 +1,79 @@
+#pragma once
+/**
+ * @file TerrainSampler.h
+ * @brief 地形の高さ・法線・マテリアルをまとめて求めるバッチ標本化
+ */
+
+#include <DirectXMath.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace game::systems {
+
+struct TerrainData;
+
+/// @brief Sample の出力先（SoA）。要らない列は nullptr のままでよい
+struct TerrainSamples {
+  float *height = nullptr;
+  float *normalX = nullptr;
+  float *normalY = nullptr;
+  float *normalZ = nullptr;
+  uint8_t *material = nullptr;
+};
+
+/// @brief 地形のバッチ標本化
+/// @details 高さはセル4隅の双線形補間、法線はその補間面の勾配から
+///          解析的に求める（物理・カメラ・軌道予測で同じ面を使う）。
+///          マテリアルは最も近い頂点の値。
+///          セルごとに4隅の高さ (h00, h10, h01, h11) を16バイトに
+///          並べ直して持つので、1点あたり1回のアラインされたロードで
+///          4隅がそろい、4点分を転置すれば SSE2 で4点同時に計算できる。
+///          スカラーと SSE2 は同じ演算を同じ順で行うため、点が
+///          バッチのどこにあっても結果はビット単位で一致する。
+///          地形の外は高さ 0・上向き法線・マテリアル 0 を返す。
+class TerrainSampler {
+public:
+  /// @brief TerrainData のハイトマップとマテリアルから作る
+  void Build(const TerrainData &data);
+
+  void Clear();
+
+  bool IsEmpty() const { return m_cells.empty(); }
+
+  /// @brief ワールド座標 (x, z) が地形の範囲内か
+  bool Contains(float x, float z) const;
+
+  /// @brief count 点をまとめて標本化する
+  /// @param xs ワールド X（count 要素）
+  /// @param zs ワールド Z（count 要素）
+  void Sample(const float *xs, const float *zs, size_t count,
+              const TerrainSamples &out) const;
+
+  /// @brief 1点の高さ（Sample と同じ値）
+  float SampleHeight(float x, float z) const;
+
+  /// @brief 1点の高さ・法線・マテリアル（Sample と同じ値）
+  void SamplePoint(float x, float z, float &outHeight,
+                   DirectX::XMFLOAT3 &outNormal, uint8_t &outMaterial) const;
+
+private:
+  /// @brief 1セルの4隅の高さ
+  struct alignas(16) CellCorners {
+    float h00; ///< (x, z)
+    float h10; ///< (x + 1, z)
+    float h01; ///< (x, z + 1)
+    float h11; ///< (x + 1, z + 1)
+  };
+
+  std::vector<CellCorners> m_cells; ///< (resX - 1) x (resZ - 1)
+  std::vector<uint8_t> m_materials; ///< 頂点ごと（空なら 0）
+  int m_resX = 0;
+  int m_resZ = 0;
+  float m_scaleX = 0.0f;  ///< ワールド X → 格子 X
+  float m_scaleZ = 0.0f;  ///< ワールド Z → 格子 Z（符号反転前）
+  float m_offsetX = 0.0f; ///< ワールド原点の格子 X
+  float m_offsetZ = 0.0f; ///< ワールド原点の格子 Z
+};
+
+} // namespace game::systems
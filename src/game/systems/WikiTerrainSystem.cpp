@@ -7,19 +7,39 @@
 #include "../../core/GameContext.h"
 #include "../../core/Logger.h"
 #include "../../core/StringUtils.h"
+#include "../../core/ThreadPool.h"
 #include "../../ecs/World.h"
+#include "../../graphics/GraphicsDevice.h"
+#include "../components/ArticleText.h"
 #include "../components/MeshRenderer.h"
 #include "../components/PhysicsComponents.h"
 #include "../components/Transform.h"
 #include "../components/WikiComponents.h"
+#include "TerrainBiome.h"
 #include "TerrainGenerator.h"
 #include "WikiClient.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
 
 namespace game::systems {
 
 using namespace DirectX;
 using namespace game::components;
 
+namespace {
+
+/// プレビューの解像度の割り数（128 → 32）
+constexpr int kPreviewDivisor = 4;
+
+double ElapsedMs(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+} // namespace
+
 void WikiTerrainSystem::Clear(core::GameContext &ctx) {
   for (auto e : m_entities) {
     if (ctx.world.IsAlive(e)) {
@@ -28,6 +48,23 @@ void WikiTerrainSystem::Clear(core::GameContext &ctx) {
   }
   m_entities.clear();
   m_floorEntity = 0xFFFFFFFF;
+  if (ctx.world.IsAlive(m_articleTextEntity)) {
+    ctx.world.DestroyEntity(m_articleTextEntity);
+  }
+  m_articleTextEntity = 0xFFFFFFFF;
+  if (m_terrainJob) {
+    m_terrainJob->Cancel();
+    m_terrainJob.reset();
+  }
+  m_jobs = {};
+  m_heightPyramid.Clear();
+  m_sampler = std::make_shared<TerrainSampler>();
+  DestroyChunks(ctx);
+  m_lodStats = {};
+  m_surface = {};
+  m_articleText.reset();
+  m_virtualTexture.reset();
+  m_textureMips.reset();
 }
 
 void WikiTerrainSystem::BuildField(core::GameContext &ctx,
@@ -61,45 +98,15 @@ void WikiTerrainSystem::CreateFloor(core::GameContext &ctx,
   WikiClient client;
   auto categories = client.FetchPageCategories(pageTitle);
 
-  int biome = 0; // Default: 0
-  bool found = false;
-
-  for (const auto &cat : categories) {
-    if (cat.find("歴史") != std::string::npos ||
-        cat.find("戦争") != std::string::npos ||
-        cat.find("事件") != std::string::npos ||
-        cat.find("政治") != std::string::npos ||
-        cat.find("古代") != std::string::npos) {
-      biome = 1;
-      found = true;
-      break;
-    }
-    if (cat.find("科学") != std::string::npos ||
-        cat.find("技術") != std::string::npos ||
-        cat.find("数学") != std::string::npos ||
-        cat.find("物理") != std::string::npos ||
-        cat.find("コンピュータ") != std::string::npos ||
-        cat.find("宇宙") != std::string::npos) {
-      biome = 2;
-      found = true;
-      break;
-    }
-    if (cat.find("地理") != std::string::npos ||
-        cat.find("地形") != std::string::npos ||
-        cat.find("生物") != std::string::npos ||
-        cat.find("植物") != std::string::npos ||
-        cat.find("動物") != std::string::npos ||
-        cat.find("山") != std::string::npos) {
-      biome = 3;
-      found = true;
-      break;
-    }
-  }
-
-  if (!found) {
+  float confidence = 0.0f;
+  int biome = ClassifyTerrainBiome(categories, &confidence);
+  if (biome < 0) {
     std::hash<std::string> hasher;
     size_t h = hasher(pageTitle);
     biome = h % 4;
+  } else {
+    LOG_INFO("WikiTerrain", "Biome {} from {} categories ({:.0f}%)", biome,
+             categories.size(), confidence * 100.0f);
   }
 
   XMFLOAT4 terrainColor = {1.0f, 1.0f, 1.0f, 1.0f};
@@ -145,44 +152,337 @@ void WikiTerrainSystem::CreateFloor(core::GameContext &ctx,
     holePositions.push_back({worldX, worldZ});
   }
 
-  // 地形データ生成
-  m_terrainData = std::make_shared<TerrainData>(
-      TerrainGenerator::GenerateTerrain(seedText, holePositions, config));
+  // 描画はチャンク単位（四分木 LOD）。地形を差し替えても同じ見た目を貼る
+  m_surface.color = terrainColor;
+  if (result.sdfText) {
+    // 文字は四角形で描くので地形は背景だけ、ミニマップは文字入り
+    m_surface.textureSRV = result.backgroundSRV;
+    m_surface.minimapSRV = result.srv;
+  } else {
+    m_surface.textureSRV = result.srv;
+  }
+  m_virtualTexture = result.virtualTexture;
+  m_textureMips = result.mips;
+  m_articleText = result.sdfText;
+  m_fieldWidth = width;
+  m_fieldDepth = depth;
+
+  // 再訪した記事はキャッシュから読む。なければ低解像度のプレビューで
+  // 先にフィールドを作り、本番の地形は UpdateGeneration で少しずつ作る
+  const auto start = std::chrono::steady_clock::now();
+  m_terrainKey = TerrainCache::MakeKey(seedText, holePositions, config);
+  TerrainData data;
+  if (m_terrainCache.Load(m_terrainKey, config, data)) {
+    m_cacheStats = {};
+    m_cacheStats.hit = true;
+    m_cacheStats.elapsedMs = ElapsedMs(start);
+    m_terrainCache.FillStats(m_terrainKey, data, m_cacheStats);
+    LOG_INFO("WikiTerrain", "Terrain loaded from cache in {:.2f} ms ({} KB)",
+             m_cacheStats.elapsedMs, m_cacheStats.fileBytes / 1024);
+  } else {
+    m_terrainJob = std::make_shared<TerrainGenerationJob>(
+        seedText, holePositions, config, kPreviewDivisor,
+        &core::ThreadPool::Shared());
+    m_terrainJob->RunFor(0.0); // 最初の Step がプレビュー
+    data = *m_terrainJob->GetData();
+    m_generationMs = ElapsedMs(start);
+    m_jobs.Add(m_terrainJob);
+    LOG_INFO("WikiTerrain", "Terrain preview {}x{} in {:.2f} ms",
+             data.config.resolutionX, data.config.resolutionZ,
+             m_generationMs);
+  }
+
+  ApplyTerrain(ctx, std::move(data));
+}
+
+bool WikiTerrainSystem::UpdateGeneration(core::GameContext &ctx,
+                                         double budgetMs) {
+  if (!m_terrainJob) {
+    return false;
+  }
+  m_generationMs += m_jobs.Tick(budgetMs);
+  if (!m_terrainJob->IsFinished()) {
+    return false;
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  TerrainData data = m_terrainJob->TakeData();
+  m_terrainJob.reset();
+  m_terrainCache.Store(m_terrainKey, data);
+
+  m_cacheStats = {};
+  m_cacheStats.elapsedMs = m_generationMs + ElapsedMs(start);
+  m_terrainCache.FillStats(m_terrainKey, data, m_cacheStats);
+  LOG_INFO("WikiTerrain",
+           "Terrain generated over {} frames ({:.2f} ms on the main thread, "
+           "worst {:.2f} ms, {} KB)",
+           m_jobs.GetStats().frames, m_cacheStats.elapsedMs,
+           m_jobs.GetStats().worstMs, m_cacheStats.fileBytes / 1024);
+  m_jobs.ResetStats();
+
+  ApplyTerrain(ctx, std::move(data));
+  return true;
+}
+
+void WikiTerrainSystem::ApplyTerrain(core::GameContext &ctx,
+                                     TerrainData &&data) {
+  m_terrainData = std::make_shared<TerrainData>(std::move(data));
+  m_heightPyramid.Build(*m_terrainData, &core::ThreadPool::Shared());
+
+  // 物理が前の地形のサンプラーを持っている間は書き換えず、作り直す
+  auto sampler = std::make_shared<TerrainSampler>();
+  sampler->Build(*m_terrainData);
+  m_sampler = sampler;
 
-  // 単一メッシュを生成
-  auto meshHandle = ctx.resource.CreateDynamicMesh(
-      "TerrainFull", m_terrainData->vertices, m_terrainData->indices);
+  DestroyChunks(ctx);
+  CreateTerrainChunks(ctx);
+
+  // 床エンティティは物理専用。差し替えのときはコライダーだけ替える
+  TerrainCollider *tc = nullptr;
+  if (ctx.world.IsAlive(m_floorEntity)) {
+    tc = ctx.world.Get<TerrainCollider>(m_floorEntity);
+  }
+  if (tc) {
+    tc->data = m_terrainData;
+    tc->sampler = m_sampler;
+  } else {
+    auto e = ctx.world.CreateEntity();
+    auto &t = ctx.world.Add<Transform>(e);
+    t.position = {0.0f, 0.0f, 0.0f};
+    t.scale = {1.0f, 1.0f, 1.0f};
+
+    auto &rb = ctx.world.Add<RigidBody>(e);
+    rb.isStatic = true;
+    rb.restitution = 0.2f;
+    rb.rollingFriction = 0.5f;
+
+    auto &collider = ctx.world.Add<TerrainCollider>(e);
+    collider.data = m_terrainData;
+    collider.sampler = m_sampler;
+    m_floorEntity = e;
+
+    m_entities.push_back(e);
+  }
+
+  // 文字の高さテクスチャは地形の解像度で作るので作り直す
+  if (ctx.world.IsAlive(m_articleTextEntity)) {
+    ctx.world.DestroyEntity(m_articleTextEntity);
+  }
+  m_articleTextEntity = 0xFFFFFFFF;
+  CreateArticleText(ctx);
+
+  LOG_INFO("WikiTerrain",
+           "Generated terrain: {} vertices, {} chunks in {} levels",
+           m_terrainData->vertices.size(), m_chunkTree.GetChunks().size(),
+           m_chunkTree.GetLevelCount());
+}
+
+void WikiTerrainSystem::CreateArticleText(core::GameContext &ctx) {
+  if (!m_articleText || !m_terrainData) {
+    return;
+  }
+
+  // 頂点の高さをそのまま1テクセルずつ置く（文字の四隅で引く）
+  const TerrainConfig &config = m_terrainData->config;
+  D3D11_TEXTURE2D_DESC texDesc = {};
+  texDesc.Width = static_cast<UINT>(config.resolutionX);
+  texDesc.Height = static_cast<UINT>(config.resolutionZ);
+  texDesc.MipLevels = 1;
+  texDesc.ArraySize = 1;
+  texDesc.Format = DXGI_FORMAT_R32_FLOAT;
+  texDesc.SampleDesc.Count = 1;
+  texDesc.Usage = D3D11_USAGE_IMMUTABLE;
+  texDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+  D3D11_SUBRESOURCE_DATA data = {};
+  data.pSysMem = m_terrainData->heightMap.data();
+  data.SysMemPitch = texDesc.Width * sizeof(float);
+
+  auto *device = ctx.graphics.GetDevice();
+  Microsoft::WRL::ComPtr<ID3D11Texture2D> heightTexture;
+  Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> heightSRV;
+  if (FAILED(device->CreateTexture2D(&texDesc, &data, &heightTexture)) ||
+      FAILED(device->CreateShaderResourceView(heightTexture.Get(), nullptr,
+                                              &heightSRV))) {
+    LOG_ERROR("WikiTerrain", "Failed to create terrain height texture");
+    return;
+  }
 
-  // エンティティ作成
   auto e = ctx.world.CreateEntity();
   auto &t = ctx.world.Add<Transform>(e);
   t.position = {0.0f, 0.0f, 0.0f};
   t.scale = {1.0f, 1.0f, 1.0f};
 
-  auto &mr = ctx.world.Add<MeshRenderer>(e);
-  mr.mesh = meshHandle;
-  mr.shader =
+  auto &text = ctx.world.Add<ArticleText>(e);
+  text.text = m_articleText;
+  text.heightSRV = heightSRV;
+  text.heightResX = config.resolutionX;
+  text.heightResZ = config.resolutionZ;
+  text.fieldWidth = m_fieldWidth;
+  text.fieldDepth = m_fieldDepth;
+
+  m_articleTextEntity = e;
+}
+
+void WikiTerrainSystem::CreateTerrainChunks(core::GameContext &ctx) {
+  TerrainChunkSettings settings;
+  m_chunkTree.Build(*m_terrainData, settings, &core::ThreadPool::Shared());
+
+  auto shader =
       ctx.resource.LoadShader("Terrain", L"Assets/shaders/TerrainVS.hlsl",
                               L"Assets/shaders/TerrainPS.hlsl");
-  mr.color = terrainColor;
-  if (result.srv) {
-    mr.textureSRV = result.srv;
-    mr.hasTexture = true;
+  const auto &chunks = m_chunkTree.GetChunks();
+  m_chunkEntities.reserve(chunks.size());
+  m_chunkMeshes.reserve(chunks.size());
+  for (size_t i = 0; i < chunks.size(); ++i) {
+    auto meshHandle = ctx.resource.CreateDynamicMesh(
+        "TerrainChunk_" + std::to_string(i), chunks[i].vertices,
+        chunks[i].indices);
+    m_chunkMeshes.push_back(meshHandle);
+
+    auto e = ctx.world.CreateEntity();
+    auto &t = ctx.world.Add<Transform>(e);
+    t.position = {0.0f, 0.0f, 0.0f};
+    t.scale = {1.0f, 1.0f, 1.0f};
+
+    auto &mr = ctx.world.Add<MeshRenderer>(e);
+    mr.mesh = meshHandle;
+    mr.shader = shader;
+    mr.color = m_surface.color;
+    mr.isVisible = (i == 0); // 最初の UpdateLod までは根だけ表示
+    mr.textureSRV = m_surface.textureSRV;
+    mr.hasTexture = m_surface.textureSRV != nullptr;
+    mr.minimapSRV = m_surface.minimapSRV;
+    if (m_virtualTexture) {
+      mr.virtualAtlasSRV = m_virtualTexture->GetAtlasSRV();
+      mr.pageTableSRV = m_virtualTexture->GetPageTableSRV();
+      mr.virtualTexture = m_virtualTexture->GetShaderParams();
+    }
+
+    m_chunkEntities.push_back(e);
+  }
+}
+
+void WikiTerrainSystem::DestroyChunks(core::GameContext &ctx) {
+  for (auto e : m_chunkEntities) {
+    if (ctx.world.IsAlive(e)) {
+      ctx.world.DestroyEntity(e);
+    }
+  }
+  m_chunkEntities.clear();
+  for (auto mesh : m_chunkMeshes) {
+    ctx.resource.ReleaseMesh(mesh);
+  }
+  m_chunkMeshes.clear();
+  m_chunkTree.Clear();
+  m_selectedChunks.clear();
+  m_culledChunks.clear();
+}
+
+void WikiTerrainSystem::UpdateLod(core::GameContext &ctx,
+                                  const XMFLOAT3 &cameraPos,
+                                  const XMMATRIX &viewProj, float fovY,
+                                  float viewportHeight) {
+  if (m_chunkTree.IsEmpty()) {
+    return;
+  }
+
+  TerrainLodQuery query;
+  query.cameraPosition[0] = cameraPos.x;
+  query.cameraPosition[1] = cameraPos.y;
+  query.cameraPosition[2] = cameraPos.z;
+  query.projectionScale =
+      TerrainChunkTree::ComputeProjectionScale(fovY, viewportHeight);
+
+  // 行ベクトル規約 (v * M) の行列から視錐台の6平面を取り出す
+  XMFLOAT4X4 m;
+  XMStoreFloat4x4(&m, viewProj);
+  auto setPlane = [&](int index, int axis, float sign) {
+    for (int row = 0; row < 4; ++row) {
+      query.frustumPlanes[index][row] = m.m[row][3] + sign * m.m[row][axis];
+    }
+  };
+  setPlane(0, 0, 1.0f);  // 左
+  setPlane(1, 0, -1.0f); // 右
+  setPlane(2, 1, 1.0f);  // 下
+  setPlane(3, 1, -1.0f); // 上
+  setPlane(5, 2, -1.0f); // 遠
+  for (int row = 0; row < 4; ++row) {
+    query.frustumPlanes[4][row] = m.m[row][2]; // 近 (z >= 0)
+  }
+  query.cullFrustum = true;
+
+  const TerrainLodStats previous = m_lodStats;
+  m_lodStats =
+      m_chunkTree.SelectLod(query, m_selectedChunks, &m_culledChunks);
+  if (m_lodStats.chunkCount != previous.chunkCount ||
+      m_lodStats.culledCount != previous.culledCount) {
+    LOG_DEBUG("WikiTerrain",
+              "Terrain LOD: {} chunks drawn ({} tris), {} culled ({} tris)",
+              m_lodStats.chunkCount, m_lodStats.triangleCount,
+              m_lodStats.culledCount, m_lodStats.culledTriangleCount);
   }
 
-  auto &rb = ctx.world.Add<RigidBody>(e);
-  rb.isStatic = true;
-  rb.restitution = 0.2f;
-  rb.rollingFriction = 0.5f;
+  // メインカメラは選んだノードだけ描く。視錐台外の粗いノードは
+  // 真上から描くミニマップだけに残す
+  for (auto e : m_chunkEntities) {
+    if (auto *mr = ctx.world.Get<MeshRenderer>(e)) {
+      mr->isVisible = false;
+      mr->showOnMinimap = false;
+    }
+  }
+  for (uint32_t index : m_selectedChunks) {
+    if (auto *mr = ctx.world.Get<MeshRenderer>(m_chunkEntities[index])) {
+      mr->isVisible = true;
+    }
+  }
+  for (uint32_t index : m_culledChunks) {
+    if (auto *mr = ctx.world.Get<MeshRenderer>(m_chunkEntities[index])) {
+      mr->showOnMinimap = true;
+    }
+  }
 
-  auto &tc = ctx.world.Add<TerrainCollider>(e);
-  tc.data = m_terrainData;
-  m_floorEntity = e;
+  if (m_virtualTexture) {
+    RequestVirtualTiles(ctx, cameraPos);
+  }
 
-  m_entities.push_back(e);
+  // ミップが出来たら差し替える（それまではレベル 0 だけで描く）
+  if (m_textureMips && m_textureMips->Poll()) {
+    m_surface.textureSRV = m_textureMips->GetSRV();
+    for (auto e : m_chunkEntities) {
+      if (auto *mr = ctx.world.Get<MeshRenderer>(e)) {
+        mr->textureSRV = m_textureMips->GetSRV();
+      }
+    }
+    m_textureMips.reset();
+  }
+}
 
-  LOG_INFO("WikiTerrain", "Generated terrain mesh with {} vertices",
-           m_terrainData->vertices.size());
+void WikiTerrainSystem::RequestVirtualTiles(core::GameContext &ctx,
+                                            const XMFLOAT3 &cameraPos) {
+  // 地形の UV はセル番号 / (解像度 - 1) なので、チャンクのセル範囲が
+  // そのまま記事上の範囲になる（視錐台外の粗いノードは低解像度版で足りる）
+  const auto &chunks = m_chunkTree.GetChunks();
+  const float invX = 1.0f / (m_terrainData->config.resolutionX - 1);
+  const float invZ = 1.0f / (m_terrainData->config.resolutionZ - 1);
+  const float camera[3] = {cameraPos.x, cameraPos.y, cameraPos.z};
+
+  m_virtualTexture->BeginFrame();
+  for (uint32_t index : m_selectedChunks) {
+    const TerrainChunk &chunk = chunks[index];
+    // 境界箱までの距離を優先度にする
+    float distSq = 0.0f;
+    for (int axis = 0; axis < 3; ++axis) {
+      const float d =
+          std::max({chunk.bounds.min[axis] - camera[axis], 0.0f,
+                    camera[axis] - chunk.bounds.max[axis]});
+      distSq += d * d;
+    }
+    m_virtualTexture->RequestRegion(chunk.cellX0 * invX, chunk.cellZ0 * invZ,
+                                    chunk.cellX1 * invX, chunk.cellZ1 * invZ,
+                                    std::sqrt(distSq));
+  }
+  m_virtualTexture->Update(ctx.graphics.GetContext());
 }
 
 void WikiTerrainSystem::CreateWalls(core::GameContext &ctx, float width,
@@ -341,33 +641,7 @@ void WikiTerrainSystem::CreateHeadingSteps(
     float fieldWidth, float fieldDepth) {}
 
 float WikiTerrainSystem::GetHeight(float x, float z) const {
-  if (!m_terrainData)
-    return 0.0f;
-
-  float worldW = m_terrainData->config.worldWidth;
-  float worldD = m_terrainData->config.worldDepth;
-  int resX = m_terrainData->config.resolutionX;
-  int resZ = m_terrainData->config.resolutionZ;
-
-  float u = x / worldW + 0.5f;
-  float v = 0.5f - z / worldD;
-
-  if (u < 0.0f || u >= 1.0f || v < 0.0f || v >= 1.0f)
-    return 0.0f;
-
-  int ix = (int)(u * (resX - 1));
-  int iz = (int)(v * (resZ - 1));
-
-  if (ix < 0)
-    ix = 0;
-  if (ix >= resX)
-    ix = resX - 1;
-  if (iz < 0)
-    iz = 0;
-  if (iz >= resZ)
-    iz = resZ - 1;
-
-  return m_terrainData->heightMap[iz * resX + ix];
+  return m_sampler->SampleHeight(x, z);
 }
 
 } // namespace game::systems
@@ -4,8 +4,16 @@
  * @brief Wikipedia記事情報に基づいた地形（フィールド）生成システム
  */
 
+#include "../../core/IncrementalJob.h"
 #include "../../graphics/WikiTextureGenerator.h"
+#include "../../resources/ResourceManager.h"
 #include "../systems/TerrainGenerator.h" // TerrainDataのために追加
+#include "TerrainCache.h"
+#include "TerrainChunks.h"
+#include "TerrainGenerationJob.h"
+#include "TerrainHeightPyramid.h"
+#include "TerrainSampler.h"
+#include <DirectXMath.h>
 #include <memory>
 #include <vector>
 
@@ -31,6 +39,8 @@ public:
   ~WikiTerrainSystem() = default;
 
   /// @brief フィールドを再構築する
+  /// @details キャッシュにない地形は低解像度のプレビューで先に作り、
+  ///          本番の地形は UpdateGeneration で少しずつ生成する。
   /// @param ctx ゲームコンテキスト
   /// @param pageTitle 記事タイトル（シードとして使用）
   /// @param textureResult テクスチャ生成結果（画像・見出し座標入り）
@@ -52,14 +62,127 @@ public:
   /// @brief 地形データを取得（物理パラメータ参照用）
   std::shared_ptr<TerrainData> GetTerrainData() const { return m_terrainData; }
 
-  /// @brief 指定座標の地形高さを取得
+  /// @brief 指定座標の地形高さを取得（双線形補間）
   float GetHeight(float x, float z) const;
 
+  /// @brief 指定座標の地形高さ・法線・マテリアルを取得
+  void SamplePoint(float x, float z, float &outHeight,
+                   DirectX::XMFLOAT3 &outNormal, uint8_t &outMaterial) const {
+    m_sampler->SamplePoint(x, z, outHeight, outNormal, outMaterial);
+  }
+
+  /// @brief 複数点の地形高さ・法線・マテリアルをまとめて取得
+  /// @see TerrainSampler::Sample
+  void Sample(const float *xs, const float *zs, size_t count,
+              const TerrainSamples &out) const {
+    m_sampler->Sample(xs, zs, count, out);
+  }
+
+  /// @brief 地形メッシュへのレイキャスト
+  /// @see TerrainHeightPyramid::Raycast
+  bool Raycast(const DirectX::XMFLOAT3 &origin,
+               const DirectX::XMFLOAT3 &direction, float maxDistance,
+               TerrainRayHit &hit) const {
+    return m_heightPyramid.Raycast(origin, direction, maxDistance, hit);
+  }
+
+  /// @brief 地形メッシュへの球キャスト
+  /// @see TerrainHeightPyramid::SphereCast
+  bool SphereCast(const DirectX::XMFLOAT3 &origin,
+                  const DirectX::XMFLOAT3 &direction, float radius,
+                  float maxDistance, TerrainRayHit &hit) const {
+    return m_heightPyramid.SphereCast(origin, direction, radius, maxDistance,
+                                      hit);
+  }
+
+  /// @brief カメラに応じて表示する地形チャンクを選び直す
+  /// @details 記事が仮想テクスチャなら、選んだチャンクが覆うタイルを
+  ///          カメラに近い順に要求してラスタライズする。
+  /// @param cameraPos カメラのワールド座標
+  /// @param viewProj ビュー × プロジェクション（視錐台カリング用）
+  /// @param fovY 垂直画角（ラジアン）
+  /// @param viewportHeight ビューポートの高さ（ピクセル）
+  void UpdateLod(core::GameContext &ctx, const DirectX::XMFLOAT3 &cameraPos,
+                 const DirectX::XMMATRIX &viewProj, float fovY,
+                 float viewportHeight);
+
+  /// @brief 生成中の本番の地形をフレーム予算の範囲で進める（毎フレーム）
+  /// @details 完成したら描画・物理・文字の地形を差し替えてキャッシュに保存する。
+  /// @param budgetMs このフレームで使ってよい時間
+  /// @return この呼び出しで地形が差し替わったら true（高さが変わる）
+  bool UpdateGeneration(core::GameContext &ctx, double budgetMs);
+
+  /// @brief 本番の地形を生成中なら true
+  bool IsGenerating() const { return m_terrainJob != nullptr; }
+
+  /// @brief 直近の LOD 選択の統計
+  const TerrainLodStats &GetLodStats() const { return m_lodStats; }
+
+  /// @brief 直近の地形読み込み（キャッシュ命中／生成）の統計
+  const TerrainCacheStats &GetTerrainCacheStats() const {
+    return m_cacheStats;
+  }
+
 private:
   std::vector<ecs::Entity> m_entities;
   ecs::Entity m_floorEntity = 0xFFFFFFFF;     // 無効値
   std::shared_ptr<TerrainData> m_terrainData; // 地形データ保持用
 
+  // 同じ記事・ホール配置の地形は生成せずディスクから読む
+  TerrainCache m_terrainCache{"Assets/cache/terrain"};
+  TerrainCacheStats m_cacheStats;
+
+  /// キャッシュになかった地形の生成（プレビューの後、毎フレーム進める）
+  core::FrameBudgetRunner m_jobs;
+  std::shared_ptr<TerrainGenerationJob> m_terrainJob;
+  TerrainCacheKey m_terrainKey;
+  double m_generationMs = 0.0; ///< 生成にメインスレッドで使った時間
+
+  /// @brief 地形チャンクの見た目（地形を差し替えても同じものを貼る）
+  struct ChunkSurface {
+    Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> textureSRV;
+    Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> minimapSRV;
+    DirectX::XMFLOAT4 color = {1.0f, 1.0f, 1.0f, 1.0f};
+  };
+  ChunkSurface m_surface;
+  std::shared_ptr<graphics::SdfArticleText> m_articleText;
+  ecs::Entity m_articleTextEntity = 0xFFFFFFFF;
+  float m_fieldWidth = 0.0f;
+  float m_fieldDepth = 0.0f;
+
+  TerrainHeightPyramid m_heightPyramid; ///< キャスト用の min/max ピラミッド
+  /// 高さ・法線の標本化（物理の TerrainCollider と共有）
+  std::shared_ptr<TerrainSampler> m_sampler =
+      std::make_shared<TerrainSampler>();
+  TerrainChunkTree m_chunkTree;
+  std::vector<ecs::Entity> m_chunkEntities; // m_chunkTree のノード順
+  /// チャンクのメッシュ（ページを作り直すときに解放する）
+  std::vector<resources::MeshHandle> m_chunkMeshes;
+  std::vector<uint32_t> m_selectedChunks;
+  std::vector<uint32_t> m_culledChunks;
+  TerrainLodStats m_lodStats;
+  /// 記事の仮想テクスチャ（全体を1枚で持つときは空）
+  std::shared_ptr<graphics::VirtualArticleTexture> m_virtualTexture;
+  /// 記事テクスチャのミップ（出来たらチャンクの SRV を差し替える）
+  std::shared_ptr<graphics::AsyncMipTexture> m_textureMips;
+
+  /// @brief 地形データを使い始める（キャスト・標本化・チャンク・床・文字）
+  /// @details 生成中のプレビューから本番に替えるときも呼ぶ。
+  void ApplyTerrain(core::GameContext &ctx, TerrainData &&data);
+
+  /// @brief 地形チャンクごとの描画エンティティを作る
+  void CreateTerrainChunks(core::GameContext &ctx);
+
+  /// @brief 地形チャンクのエンティティとメッシュを消す
+  void DestroyChunks(core::GameContext &ctx);
+
+  /// @brief 表示中のチャンクが覆う記事のタイルを要求して描く
+  void RequestVirtualTiles(core::GameContext &ctx,
+                           const DirectX::XMFLOAT3 &cameraPos);
+
+  /// @brief SDF の文字を床の高さに沿わせて描くエンティティを作る
+  void CreateArticleText(core::GameContext &ctx);
+
   /// @brief 床作成
   void CreateFloor(core::GameContext &ctx,
                    const graphics::WikiTextureResult &result, float width,
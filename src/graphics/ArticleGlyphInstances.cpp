@@ -0,0 +1,95 @@
+/**
+ * @file ArticleGlyphInstances.cpp
+ * @brief 記事のレイアウトから SDF グリフの四角形を作る実装
+ */
+
+#include "ArticleGlyphInstances.h"
+#include <algorithm>
+
+namespace graphics {
+
+namespace {
+
+/// @brief 塗りつぶし矩形の最大の幅。床は四角形の四隅の高さで張るので、
+///        長い罫線は起伏に沿うように分けて置く
+constexpr float kMaxRectSegment = 256.0f;
+
+uint32_t RunColor(ArticleRunStyle style, const GlyphInstanceColors &colors) {
+  switch (style) {
+  case ArticleRunStyle::Link:
+    return colors.link;
+  case ArticleRunStyle::TargetLink:
+    return colors.target;
+  case ArticleRunStyle::Button:
+    return colors.white;
+  default:
+    return colors.text;
+  }
+}
+
+} // namespace
+
+void BuildGlyphInstances(const ArticleLayout &layout, SdfGlyphAtlas &atlas,
+                         const GlyphOutlineProvider &outlines,
+                         std::vector<GlyphInstance> &instances,
+                         GlyphInstanceStats *stats,
+                         const GlyphInstanceColors &colors) {
+  instances.clear();
+  GlyphInstanceStats local;
+
+  const float inv = 1.0f / static_cast<float>(atlas.GetSize());
+  const float solidU = atlas.GetSolidX() * inv;
+  const float solidV = atlas.GetSolidY() * inv;
+  auto addRect = [&](float x, float y, float w, float h, uint32_t color) {
+    instances.push_back({x, y, w, h, solidU, solidV, solidU, solidV, color,
+                         kGlyphInstanceSolid, {0.0f, 0.0f}});
+    ++local.rects;
+  };
+
+  // ヘッダーライン（WikiTextureGenerator の DrawLine と同じ位置）
+  const float ruleEnd = static_cast<float>(layout.width) - 20.0f;
+  for (float x = 20.0f; x < ruleEnd; x += kMaxRectSegment) {
+    addRect(x, 119.5f, std::min(kMaxRectSegment, ruleEnd - x), 1.0f,
+            colors.border);
+  }
+  for (const ArticleLinkButton &button : layout.buttons) {
+    addRect(button.x, button.y, button.width, button.height,
+            button.isTarget ? colors.target : colors.link);
+  }
+
+  for (const ArticleGlyphRun &run : layout.runs) {
+    const uint32_t color = RunColor(run.style, colors);
+    float penX = run.x;
+    for (uint32_t k = 0; k < run.length; ++k) {
+      const uint32_t index = run.start + k;
+      const float advance = layout.advances[index];
+      const SdfGlyph *glyph =
+          atlas.GetOrAdd(run.font, layout.text[index], outlines);
+      if (!glyph) {
+        ++local.missing;
+      } else if (!glyph->IsEmpty()) {
+        GlyphInstance instance;
+        instance.x = penX + glyph->left * run.fontSize;
+        instance.y = run.baseline + glyph->top * run.fontSize;
+        instance.width = glyph->emWidth * run.fontSize;
+        instance.height = glyph->emHeight * run.fontSize;
+        instance.u0 = glyph->x * inv;
+        instance.v0 = glyph->y * inv;
+        instance.u1 = (glyph->x + glyph->width) * inv;
+        instance.v1 = (glyph->y + glyph->height) * inv;
+        instance.color = color;
+        instance.flags = 0;
+        instance.pad[0] = instance.pad[1] = 0.0f;
+        instances.push_back(instance);
+        ++local.glyphs;
+      }
+      penX += advance;
+    }
+  }
+
+  if (stats) {
+    *stats = local;
+  }
+}
+
+} // namespace graphics
@@ -0,0 +1,56 @@
+#pragma once
+/**
+ * @file ArticleGlyphInstances.h
+ * @brief 記事のレイアウトから SDF グリフの四角形（インスタンス）を作る
+ */
+
+#include "ArticleLayout.h"
+#include "SdfGlyphAtlas.h"
+#include <cstdint>
+#include <vector>
+
+namespace graphics {
+
+/// @brief 1文字（または塗りつぶし矩形）の四角形。GPU の構造化バッファと同じ並び
+struct GlyphInstance {
+  float x, y;          ///< 記事テクスチャ上の左上（ピクセル）
+  float width, height; ///< 大きさ（ピクセル）
+  float u0, v0, u1, v1; ///< アトラス上の範囲（UV）
+  uint32_t color;       ///< RGBA8（R が最下位バイト）
+  uint32_t flags;       ///< kGlyphInstanceSolid など
+  float pad[2];
+};
+static_assert(sizeof(GlyphInstance) == 48, "GPU layout");
+
+/// @brief 距離場ではなく塗りつぶしで描く（ボタン・罫線）
+constexpr uint32_t kGlyphInstanceSolid = 1u;
+
+/// @brief 描き方ごとの色（RGBA8）。WikiTextureGenerator のブラシと同じ
+struct GlyphInstanceColors {
+  uint32_t text = 0xFF222120u;   ///< (0.125, 0.129, 0.133)
+  uint32_t link = 0xFFCC6633u;   ///< (0.2, 0.4, 0.8)
+  uint32_t target = 0xFF1A1ACCu; ///< (0.8, 0.1, 0.1)
+  uint32_t border = 0xFFB1A9A2u; ///< (0.635, 0.663, 0.694)
+  uint32_t white = 0xFFFFFFFFu;
+};
+
+/// @brief BuildGlyphInstances の統計
+struct GlyphInstanceStats {
+  size_t glyphs = 0;  ///< 作った文字の四角形
+  size_t rects = 0;   ///< 作った塗りつぶし矩形
+  size_t missing = 0; ///< アトラスに置けず描けなかった文字
+};
+
+/// @brief 記事1ページ分の四角形を作る
+/// @details 罫線 → ボタン → 文字の順に並べる（後ろほど上に描く）。罫線は
+///          床の起伏に沿うよう 256px ごとに分ける。
+///          足りないグリフはその場でアトラスに置く。アトラスが満杯で
+///          置けなかった文字は stats.missing に数えて飛ばす。
+/// @param instances 作り直す（容量は使い回す）
+void BuildGlyphInstances(const ArticleLayout &layout, SdfGlyphAtlas &atlas,
+                         const GlyphOutlineProvider &outlines,
+                         std::vector<GlyphInstance> &instances,
+                         GlyphInstanceStats *stats = nullptr,
+                         const GlyphInstanceColors &colors = {});
+
+} // namespace graphics
@@ -0,0 +1,661 @@
+/**
+ * @file ArticleLayout.cpp
+ * @brief 記事のレイアウトエンジンの実装
+ */
+
+#include "ArticleLayout.h"
+#include "../core/PatternMatcher.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace graphics {
+
+namespace {
+
+/// @brief UTF-8 を1文字読んで i を進める（不正なバイト列は U+FFFD）
+char32_t DecodeUtf8(std::string_view s, size_t &i) {
+  const auto lead = static_cast<unsigned char>(s[i]);
+  size_t length = 1;
+  char32_t c = lead;
+  if (lead >= 0xF0 && lead < 0xF8) {
+    length = 4;
+    c = lead & 0x07;
+  } else if (lead >= 0xE0) {
+    length = 3;
+    c = lead & 0x0F;
+  } else if (lead >= 0xC0) {
+    length = 2;
+    c = lead & 0x1F;
+  } else if (lead >= 0x80) {
+    ++i;
+    return 0xFFFD;
+  }
+  if (i + length > s.size()) {
+    ++i;
+    return 0xFFFD;
+  }
+  for (size_t k = 1; k < length; ++k) {
+    const auto next = static_cast<unsigned char>(s[i + k]);
+    if ((next & 0xC0) != 0x80) {
+      ++i;
+      return 0xFFFD;
+    }
+    c = (c << 6) | (next & 0x3F);
+  }
+  i += length;
+  return c;
+}
+
+bool IsSpace(char32_t c) { return c == U' ' || c == U'\t'; }
+
+/// @brief 前で改行しない文字（行頭禁則）
+bool NoBreakBefore(char32_t c) {
+  switch (c) {
+  case U')': case U']': case U'}': case U',': case U'.': case U':':
+  case U';': case U'!': case U'?': case U'%':
+  case U'、': case U'。': case U'，': case U'．': case U'・': case U'：':
+  case U'；': case U'？': case U'！': case U'ー': case U'〜': case U'…':
+  case U'」': case U'』': case U'）': case U'］': case U'｝': case U'〕':
+  case U'〉': case U'》': case U'】': case U'〙': case U'〗': case U'〟':
+  case U'’': case U'”': case U'ゝ': case U'ゞ': case U'ヽ': case U'ヾ':
+  case U'々': case U'〻': case U'ぁ': case U'ぃ': case U'ぅ': case U'ぇ':
+  case U'ぉ': case U'っ': case U'ゃ': case U'ゅ': case U'ょ': case U'ゎ':
+  case U'ゕ': case U'ゖ': case U'ァ': case U'ィ': case U'ゥ': case U'ェ':
+  case U'ォ': case U'ッ': case U'ャ': case U'ュ': case U'ョ': case U'ヮ':
+  case U'ヵ': case U'ヶ':
+    return true;
+  default:
+    return c >= 0x31F0 && c <= 0x31FF; // 小書きカタカナ拡張
+  }
+}
+
+/// @brief 後ろで改行しない文字（行末禁則）
+bool NoBreakAfter(char32_t c) {
+  switch (c) {
+  case U'(': case U'[': case U'{': case U'「': case U'『': case U'（':
+  case U'［': case U'｛': case U'〔': case U'〈': case U'《': case U'【':
+  case U'〘': case U'〖': case U'〝': case U'‘': case U'“':
+    return true;
+  default:
+    return false;
+  }
+}
+
+/// @brief prev と cur の間で改行できるか
+bool CanBreakBetween(char32_t prev, char32_t cur) {
+  if (IsSpace(cur)) {
+    return false; // 空白は行末にぶら下げる
+  }
+  if (IsSpace(prev)) {
+    return true;
+  }
+  if (NoBreakBefore(cur) || NoBreakAfter(prev)) {
+    return false;
+  }
+  if (IsWideCharacter(prev) || IsWideCharacter(cur)) {
+    return true;
+  }
+  return prev == U'-' && cur != U'-';
+}
+
+/// @brief 1行（text 上の [begin, end)。行末の空白は除く）
+struct LineBox {
+  uint32_t begin;
+  uint32_t end;
+  float width;
+};
+
+/// @brief 1段落 [begin, end) を maxWidth で行に分ける
+void BreakLines(const std::u32string &text, const std::vector<float> &adv,
+                uint32_t begin, uint32_t end, float maxWidth,
+                std::vector<LineBox> &lines) {
+  lines.clear();
+  if (begin == end) {
+    lines.push_back({begin, begin, 0.0f});
+    return;
+  }
+  uint32_t lineStart = begin;
+  while (lineStart < end) {
+    float width = 0.0f;
+    uint32_t lastBreak = lineStart;
+    uint32_t i = lineStart;
+    for (; i < end; ++i) {
+      if (i > lineStart && CanBreakBetween(text[i - 1], text[i])) {
+        lastBreak = i;
+      }
+      // 1文字は必ず置く。空白ははみ出しても行末に残す
+      if (i > lineStart && !IsSpace(text[i]) && width + adv[i] > maxWidth) {
+        break;
+      }
+      width += adv[i];
+    }
+    uint32_t lineEnd = i;
+    if (i < end && lastBreak > lineStart) {
+      lineEnd = lastBreak;
+    }
+    uint32_t visibleEnd = lineEnd;
+    while (visibleEnd > lineStart && IsSpace(text[visibleEnd - 1])) {
+      --visibleEnd;
+    }
+    float visibleWidth = 0.0f;
+    for (uint32_t k = lineStart; k < visibleEnd; ++k) {
+      visibleWidth += adv[k];
+    }
+    lines.push_back({lineStart, visibleEnd, visibleWidth});
+
+    lineStart = lineEnd;
+    while (lineStart < end && IsSpace(text[lineStart])) {
+      ++lineStart;
+    }
+  }
+}
+
+/// @brief 本文の1段落（改行で区切った1行）
+struct Paragraph {
+  uint32_t begin;
+  uint32_t end;
+  int headingLevel; ///< 0 なら見出しではない
+};
+
+/// @brief "== 見出し ==" なら内側の範囲とレベルを返す
+int ParseHeading(std::string_view line, size_t &innerBegin,
+                 size_t &innerEnd) {
+  size_t b = 0;
+  size_t e = line.size();
+  while (b < e && (line[b] == ' ' || line[b] == '\t' || line[b] == '\r')) {
+    ++b;
+  }
+  while (e > b &&
+         (line[e - 1] == ' ' || line[e - 1] == '\t' || line[e - 1] == '\r')) {
+    --e;
+  }
+  size_t lead = 0;
+  while (b + lead < e && line[b + lead] == '=') {
+    ++lead;
+  }
+  size_t trail = 0;
+  while (e - trail > b + lead && line[e - trail - 1] == '=') {
+    ++trail;
+  }
+  if (lead < 2 || lead != trail || e - b <= lead + trail) {
+    return 0;
+  }
+  innerBegin = b + lead;
+  innerEnd = e - trail;
+  while (innerBegin < innerEnd && line[innerBegin] == ' ') {
+    ++innerBegin;
+  }
+  while (innerEnd > innerBegin && line[innerEnd - 1] == ' ') {
+    --innerEnd;
+  }
+  return innerBegin < innerEnd ? static_cast<int>(lead) : 0;
+}
+
+/// @brief レイアウト1回分の作業領域
+class Builder {
+public:
+  Builder(const GlyphMetricsProvider &metrics, ArticleLayout &out)
+      : m_metrics(metrics), m_out(out) {}
+
+  /// @brief UTF-8 を text に追加し、バイト位置 → 文字番号を記録する
+  void AppendUtf8(std::string_view s, size_t byteOffset,
+                  std::vector<int32_t> *byteToChar) {
+    size_t i = 0;
+    while (i < s.size()) {
+      const size_t start = i;
+      const char32_t c = DecodeUtf8(s, i);
+      if (byteToChar) {
+        const auto index = static_cast<int32_t>(m_out.text.size());
+        std::fill(byteToChar->begin() + byteOffset + start,
+                  byteToChar->begin() + byteOffset + i, index);
+      }
+      m_out.text.push_back(c);
+    }
+  }
+
+  /// @brief [begin, end) の送り幅と描き方を決める
+  void Measure(uint32_t begin, uint32_t end, ArticleFont font, float size,
+               ArticleRunStyle style) {
+    m_out.advances.resize(m_out.text.size());
+    m_styles.resize(m_out.text.size(), style);
+    m_charX.resize(m_out.text.size(), 0.0f);
+    m_charLine.resize(m_out.text.size(), kNoLine);
+    m_metrics.GetAdvances(font, m_out.text.data() + begin, end - begin, size,
+                          m_out.advances.data() + begin);
+    std::fill(m_styles.begin() + begin, m_styles.begin() + end, style);
+  }
+
+  void SetStyle(uint32_t begin, uint32_t end, ArticleRunStyle style) {
+    std::fill(m_styles.begin() + begin, m_styles.begin() + end, style);
+  }
+
+  /// @brief 段落を行に分けて top から並べる
+  /// @return 並べた高さ。maxLineWidth には最も長い行の幅
+  float PlaceParagraph(uint32_t begin, uint32_t end, ArticleFont font,
+                       float size, float left, float top, float maxWidth,
+                       float *maxLineWidth = nullptr) {
+    const FontVerticalMetrics vm = m_metrics.GetVerticalMetrics(font);
+    const float lineHeight = vm.LineHeight() * size;
+    BreakLines(m_out.text, m_out.advances, begin, end, maxWidth, m_lines);
+
+    float y = top;
+    float widest = 0.0f;
+    for (const LineBox &line : m_lines) {
+      const auto lineIndex = static_cast<uint32_t>(m_lineTops.size());
+      m_lineTops.push_back(y);
+      m_lineHeights.push_back(lineHeight);
+
+      const float baseline = y + vm.ascent * size;
+      float x = left;
+      uint32_t runStart = line.begin;
+      for (uint32_t k = line.begin; k < line.end; ++k) {
+        if (m_styles[k] != m_styles[runStart]) {
+          EmitRun(runStart, k, font, size, baseline);
+          runStart = k;
+        }
+        m_charX[k] = x;
+        m_charLine[k] = lineIndex;
+        x += m_out.advances[k];
+      }
+      if (runStart < line.end) {
+        EmitRun(runStart, line.end, font, size, baseline);
+      }
+      widest = std::max(widest, line.width);
+      y += lineHeight;
+      ++m_out.lineCount;
+    }
+    if (maxLineWidth) {
+      *maxLineWidth = widest;
+    }
+    return y - top;
+  }
+
+  /// @brief 文字 [begin, end) を囲む矩形を行ごとに求める
+  template <typename Fn> void ForEachLineRect(uint32_t begin, uint32_t end,
+                                              Fn &&fn) const {
+    uint32_t k = begin;
+    while (k < end) {
+      const uint32_t line = m_charLine[k];
+      if (line == kNoLine) {
+        ++k; // 行末で捨てた空白
+        continue;
+      }
+      const uint32_t first = k;
+      while (k + 1 < end && m_charLine[k + 1] == line) {
+        ++k;
+      }
+      const float x0 = m_charX[first];
+      const float x1 = m_charX[k] + m_out.advances[k];
+      fn(x0, m_lineTops[line], x1 - x0, m_lineHeights[line]);
+      ++k;
+    }
+  }
+
+private:
+  static constexpr uint32_t kNoLine = 0xFFFFFFFFu;
+
+  void EmitRun(uint32_t begin, uint32_t end, ArticleFont font, float size,
+               float baseline) {
+    ArticleGlyphRun run;
+    run.start = begin;
+    run.length = end - begin;
+    run.x = m_charX[begin];
+    run.baseline = baseline;
+    run.fontSize = size;
+    run.font = font;
+    run.style = m_styles[begin];
+    m_out.runs.push_back(run);
+  }
+
+  const GlyphMetricsProvider &m_metrics;
+  ArticleLayout &m_out;
+
+  std::vector<ArticleRunStyle> m_styles; ///< text と同じ長さ
+  std::vector<float> m_charX;
+  std::vector<uint32_t> m_charLine;
+  std::vector<float> m_lineTops;
+  std::vector<float> m_lineHeights;
+  std::vector<LineBox> m_lines;
+};
+
+/// @brief リンクとして受け付けた出現（文字番号の範囲）
+struct LinkSpan {
+  uint32_t begin;
+  uint32_t end;
+  uint32_t link;
+};
+
+// === キャッシュキー（TerrainCache と同じ 64bit ハッシュ 2 本） ===
+
+uint64_t HashBytes(const uint8_t *data, size_t size, uint64_t seed) {
+  constexpr uint64_t kPrime = 0x100000001b3ull;
+  uint64_t h = seed ^ (size * 0x9e3779b97f4a7c15ull);
+  size_t i = 0;
+  for (; i + 8 <= size; i += 8) {
+    uint64_t word;
+    std::memcpy(&word, data + i, sizeof(word));
+    h = (h ^ word) * kPrime;
+    h ^= h >> 29;
+  }
+  for (; i < size; ++i) {
+    h = (h ^ data[i]) * kPrime;
+  }
+  h ^= h >> 32;
+  h *= 0xd6e8feb86659fd93ull;
+  h ^= h >> 32;
+  return h;
+}
+
+constexpr uint64_t kKeySeedHi = 0xcbf29ce484222325ull;
+constexpr uint64_t kKeySeedLo = 0x84222325cbf29ce4ull;
+
+template <typename T> void AppendPod(std::vector<uint8_t> &out, const T &v) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  const auto *p = reinterpret_cast<const uint8_t *>(&v);
+  out.insert(out.end(), p, p + sizeof(T));
+}
+
+/// @brief 長さ付きで文字列を足す（区切りが曖昧にならないように）
+void AppendString(std::vector<uint8_t> &out, std::string_view s) {
+  AppendPod(out, static_cast<uint64_t>(s.size()));
+  out.insert(out.end(), s.begin(), s.end());
+}
+
+} // namespace
+
+ArticleLayoutEngine::ArticleLayoutEngine(const GlyphMetricsProvider &metrics,
+                                         const ArticleLayoutStyle &style)
+    : m_metrics(metrics), m_style(style) {}
+
+ArticleLayout ArticleLayoutEngine::Layout(const ArticleLayoutInput &input,
+                                          uint32_t width,
+                                          uint32_t height) const {
+  ArticleLayout out;
+  out.width = width;
+  out.height = height;
+  out.text.reserve(input.title.size() + input.text.size());
+  Builder builder(m_metrics, out);
+  const float w = static_cast<float>(width);
+
+  // 1) タイトル
+  builder.AppendUtf8(input.title, 0, nullptr);
+  const auto titleEnd = static_cast<uint32_t>(out.text.size());
+  builder.Measure(0, titleEnd, ArticleFont::Title, m_style.titleSize,
+                  ArticleRunStyle::Title);
+
+  // 2) 本文を段落（行）に分け、見出しの = を外して文字にする
+  std::vector<int32_t> byteToChar(input.text.size() + 1, -1);
+  std::vector<Paragraph> paragraphs;
+  {
+    const std::string_view text = input.text;
+    size_t lineBegin = 0;
+    while (lineBegin <= text.size()) {
+      size_t lineEnd = text.find('\n', lineBegin);
+      if (lineEnd == std::string_view::npos) {
+        lineEnd = text.size();
+      }
+      const std::string_view line = text.substr(lineBegin, lineEnd - lineBegin);
+      size_t innerBegin = 0;
+      size_t innerEnd = line.size();
+      const int level = ParseHeading(line, innerBegin, innerEnd);
+      if (level == 0 && !line.empty() && line.back() == '\r') {
+        innerEnd = line.size() - 1;
+      }
+      const auto begin = static_cast<uint32_t>(out.text.size());
+      builder.AppendUtf8(line.substr(innerBegin, innerEnd - innerBegin),
+                         lineBegin + innerBegin, &byteToChar);
+      const auto end = static_cast<uint32_t>(out.text.size());
+      paragraphs.push_back({begin, end, level});
+      if (level > 0) {
+        const float scale = m_style.headingScale[std::min(level - 2, 2)];
+        builder.Measure(begin, end, ArticleFont::Body,
+                        m_style.bodySize * scale, ArticleRunStyle::Heading);
+      } else {
+        builder.Measure(begin, end, ArticleFont::Body, m_style.bodySize,
+                        ArticleRunStyle::Body);
+      }
+      lineBegin = lineEnd + 1;
+    }
+  }
+
+  // 3) リンクの全出現を1回の走査で探す。従来どおりリンク順・出現順に
+  //    色を塗るので、範囲が重なったときは後のリンクが勝つ
+  std::vector<LinkSpan> spans;
+  std::vector<bool> linkMatched(input.links.size(), false);
+  {
+    std::vector<std::string_view> patterns;
+    patterns.reserve(input.links.size());
+    for (const auto &link : input.links) {
+      patterns.push_back(link.first);
+    }
+    core::PatternMatcher matcher;
+    matcher.Build(patterns);
+    std::vector<core::PatternMatch> matches;
+    matcher.FindAll(input.text, matches);
+    std::sort(matches.begin(), matches.end(),
+              [](const core::PatternMatch &a, const core::PatternMatch &b) {
+                return std::tie(a.pattern, a.position) <
+                       std::tie(b.pattern, b.position);
+              });
+    for (const auto &match : matches) {
+      // 見出しの = や改行を含む出現は表示上つながっていないので捨てる
+      const size_t last = match.position + match.length - 1;
+      bool visible = true;
+      for (size_t b = match.position; b <= last && visible; ++b) {
+        visible = byteToChar[b] >= 0 &&
+                  (b == match.position ||
+                   byteToChar[b] - byteToChar[b - 1] <= 1);
+      }
+      if (!visible) {
+        continue;
+      }
+      const auto begin = static_cast<uint32_t>(byteToChar[match.position]);
+      const auto end = static_cast<uint32_t>(byteToChar[last]) + 1;
+      const auto &link = input.links[match.pattern];
+      builder.SetStyle(begin, end, link.second == input.targetPage
+                                       ? ArticleRunStyle::TargetLink
+                                       : ArticleRunStyle::Link);
+      spans.push_back({begin, end, match.pattern});
+      linkMatched[match.pattern] = true;
+    }
+  }
+
+  // 4) 行に並べる
+  builder.PlaceParagraph(0, titleEnd, ArticleFont::Title, m_style.titleSize,
+                         m_style.titleLeft, m_style.titleTop,
+                         w - 2.0f * m_style.titleLeft);
+
+  const float bodyWidth = w - 2.0f * m_style.bodyLeft;
+  float y = m_style.bodyTop;
+  size_t nonEmpty = 0;
+  size_t nextImage = 0;
+  std::vector<ArticleImage> images = input.images;
+  std::stable_sort(images.begin(), images.end(),
+                   [](const ArticleImage &a, const ArticleImage &b) {
+                     return a.afterParagraph < b.afterParagraph;
+                   });
+  auto placeImages = [&](size_t upTo) {
+    for (; nextImage < images.size() &&
+           images[nextImage].afterParagraph < upTo;
+         ++nextImage) {
+      const ArticleImage &image = images[nextImage];
+      if (image.width <= 0.0f || image.height <= 0.0f) {
+        continue;
+      }
+      const float scale = std::min(1.0f, bodyWidth / image.width);
+      ImageRegion region;
+      region.width = image.width * scale;
+      region.height = image.height * scale;
+      region.x = (w - region.width) * 0.5f;
+      region.y = y + m_style.imageMargin;
+      out.images.push_back(region);
+      y = region.y + region.height + m_style.imageMargin;
+    }
+  };
+
+  for (const Paragraph &p : paragraphs) {
+    if (p.headingLevel > 0) {
+      const float scale = m_style.headingScale[std::min(p.headingLevel - 2, 2)];
+      float lineWidth = 0.0f;
+      const float h = builder.PlaceParagraph(
+          p.begin, p.end, ArticleFont::Body, m_style.bodySize * scale,
+          m_style.bodyLeft, y, bodyWidth, &lineWidth);
+      out.headings.push_back(
+          {m_style.bodyLeft, y, lineWidth, h, p.headingLevel});
+      y += h;
+      continue;
+    }
+    y += builder.PlaceParagraph(p.begin, p.end, ArticleFont::Body,
+                                m_style.bodySize, m_style.bodyLeft, y,
+                                bodyWidth);
+    if (p.begin < p.end) {
+      placeImages(++nonEmpty);
+    }
+  }
+  placeImages(images.empty() ? 0 : images.back().afterParagraph + 1);
+  out.bodyBottom = y;
+
+  for (const LinkSpan &span : spans) {
+    const auto &link = input.links[span.link];
+    const bool isTarget = link.second == input.targetPage;
+    builder.ForEachLineRect(span.begin, span.end,
+                            [&](float x, float top, float rw, float rh) {
+                              out.links.push_back(
+                                  {link.second, x, top, rw, rh, isTarget});
+                            });
+  }
+
+  // 5) 本文に現れなかったリンクを下部に「関連項目」として並べる
+  const float h = static_cast<float>(height);
+  const float seeAlsoY = y + m_style.seeAlsoGap;
+  if (seeAlsoY < h - 50.0f) {
+    int count = 0;
+    for (size_t i = 0; i < input.links.size(); ++i) {
+      if (linkMatched[i]) {
+        continue;
+      }
+      const auto &link = input.links[i];
+      const bool isTarget = link.second == input.targetPage;
+      const int columns = std::max(m_style.buttonColumns, 1);
+      const float lx =
+          m_style.bodyLeft + (count % columns) * m_style.buttonColumnStep;
+      const float ly = seeAlsoY + (count / columns) * m_style.buttonRowStep;
+      if (ly > h - 40.0f) {
+        break;
+      }
+
+      out.buttons.push_back(
+          {lx, ly, m_style.buttonWidth, m_style.buttonHeight, isTarget});
+      const auto begin = static_cast<uint32_t>(out.text.size());
+      builder.AppendUtf8(link.first, 0, nullptr);
+      const auto end = static_cast<uint32_t>(out.text.size());
+      builder.Measure(begin, end, ArticleFont::Body, m_style.bodySize,
+                      ArticleRunStyle::Button);
+      builder.PlaceParagraph(begin, end, ArticleFont::Body, m_style.bodySize,
+                             lx, ly, m_style.buttonWidth);
+      out.links.push_back({link.second, lx, ly, m_style.buttonWidth,
+                           m_style.buttonHeight, isTarget});
+      ++count;
+    }
+  }
+
+  return out;
+}
+
+ArticleLayoutCache::ArticleLayoutCache(size_t capacity)
+    : m_capacity(std::max<size_t>(capacity, 1)) {}
+
+ArticleLayoutCache::Key
+ArticleLayoutCache::MakeKey(const ArticleLayoutEngine &engine,
+                            const ArticleLayoutInput &input, uint32_t width,
+                            uint32_t height) {
+  std::vector<uint8_t> bytes;
+  bytes.reserve(input.title.size() + input.text.size() + 256);
+  AppendPod(bytes, engine.GetMetrics().GetFingerprint());
+  AppendPod(bytes, engine.GetStyle());
+  AppendPod(bytes, width);
+  AppendPod(bytes, height);
+  AppendString(bytes, input.title);
+  AppendString(bytes, input.text);
+  AppendString(bytes, input.targetPage);
+  AppendPod(bytes, static_cast<uint64_t>(input.links.size()));
+  for (const auto &link : input.links) {
+    AppendString(bytes, link.first);
+    AppendString(bytes, link.second);
+  }
+  for (const auto &image : input.images) {
+    AppendPod(bytes, static_cast<uint64_t>(image.afterParagraph));
+    AppendPod(bytes, image.width);
+    AppendPod(bytes, image.height);
+  }
+
+  Key key;
+  key.hi = HashBytes(bytes.data(), bytes.size(), kKeySeedHi);
+  key.lo = HashBytes(bytes.data(), bytes.size(), kKeySeedLo);
+  return key;
+}
+
+std::shared_ptr<const ArticleLayout>
+ArticleLayoutCache::GetOrLayout(const ArticleLayoutEngine &engine,
+                                const ArticleLayoutInput &input,
+                                uint32_t width, uint32_t height,
+                                ArticleLayoutCacheStats *stats) {
+  const auto start = std::chrono::steady_clock::now();
+  auto finish = [&](bool hit) {
+    if (stats) {
+      stats->hit = hit;
+      stats->elapsedMs = std::chrono::duration<double, std::milli>(
+                             std::chrono::steady_clock::now() - start)
+                             .count();
+    }
+  };
+
+  const Key key = MakeKey(engine, input, width, height);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end()) {
+      m_lru.splice(m_lru.begin(), m_lru, it->second.lruPos);
+      auto layout = it->second.layout;
+      finish(true);
+      return layout;
+    }
+  }
+
+  // レイアウト中はロックを持たない（同じ記事を並行に作ったら後勝ち）
+  auto layout = std::make_shared<const ArticleLayout>(
+      engine.Layout(input, width, height));
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_entries.find(key);
+  if (it != m_entries.end()) {
+    m_lru.splice(m_lru.begin(), m_lru, it->second.lruPos);
+    it->second.layout = layout;
+  } else {
+    m_lru.push_front(key);
+    m_entries[key] = {layout, m_lru.begin()};
+    while (m_entries.size() > m_capacity) {
+      m_entries.erase(m_lru.back());
+      m_lru.pop_back();
+    }
+  }
+  finish(false);
+  return layout;
+}
+
+void ArticleLayoutCache::Clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_entries.clear();
+  m_lru.clear();
+}
+
+size_t ArticleLayoutCache::GetSize() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+} // namespace graphics
@@ -0,0 +1,213 @@
+#pragma once
+/**
+ * @file ArticleLayout.h
+ * @brief 記事のレイアウトエンジン（プラットフォーム非依存）
+ *
+ * 行分割・見出し・段落・リンクの矩形をグリフ寸法だけから求める。
+ * 描画（DirectWrite / D2D）は結果の GlyphRun をなぞるだけにする。
+ */
+
+#include "GlyphMetrics.h"
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace graphics {
+
+/**
+ * @brief リンク領域情報
+ */
+struct LinkRegion {
+  std::string targetPage; ///< 遷移先ページ名
+  float x, y;             ///< テクスチャ上の位置（ピクセル）
+  float width, height;    ///< サイズ（ピクセル）
+  bool isTarget;          ///< 目標リンクか
+};
+
+/**
+ * @brief 画像配置領域（障害物用）
+ */
+struct ImageRegion {
+  float x, y;          ///< ピクセル座標
+  float width, height; ///< サイズ
+};
+
+/**
+ * @brief 見出し配置領域（段差用）
+ */
+struct HeadingRegion {
+  float x, y;          ///< ピクセル座標
+  float width, height; ///< サイズ
+  int level;           ///< 見出しレベル (1=H1, 2=H2...)
+};
+
+/// @brief 文字列の描き方
+enum class ArticleRunStyle : uint8_t {
+  Title,
+  Body,
+  Heading,
+  Link,
+  TargetLink,
+  Button, ///< 関連項目ボタンのラベル（白抜き）
+};
+
+/// @brief 同じ書体・大きさ・描き方で1行に並ぶ文字の並び
+struct ArticleGlyphRun {
+  uint32_t start = 0;  ///< ArticleLayout::text 上の範囲
+  uint32_t length = 0;
+  float x = 0.0f;        ///< 先頭の文字の左端
+  float baseline = 0.0f; ///< ベースラインの y
+  float fontSize = 0.0f;
+  ArticleFont font = ArticleFont::Body;
+  ArticleRunStyle style = ArticleRunStyle::Body;
+};
+
+/// @brief 本文に現れなかったリンクの「関連項目」ボタン
+struct ArticleLinkButton {
+  float x, y;
+  float width, height;
+  bool isTarget;
+};
+
+/// @brief 画像の差し込み（本文の段落の後ろに中央寄せで置く）
+struct ArticleImage {
+  size_t afterParagraph = 0; ///< 空でない段落を 0 から数えた番号
+  float width = 0.0f;        ///< 本文幅を超える場合は縮める
+  float height = 0.0f;
+};
+
+/// @brief レイアウトの入力（文字列はすべて UTF-8）
+struct ArticleLayoutInput {
+  std::string title;
+  /// 本文。"== 見出し ==" だけの行は見出し（= の数がレベル）
+  std::string text;
+  /// リンク（本文中の表示文字列, 遷移先）
+  std::vector<std::pair<std::string, std::string>> links;
+  std::string targetPage;
+  std::vector<ArticleImage> images;
+};
+
+/// @brief レイアウトの寸法（ピクセル）
+struct ArticleLayoutStyle {
+  float titleSize = 128.0f;
+  float bodySize = 64.0f;
+  /// 見出しの大きさ（本文比）。[0] が H2、[1] が H3、それ以降は [2]
+  float headingScale[3] = {1.5f, 1.25f, 1.1f};
+
+  float titleLeft = 20.0f; ///< タイトルは左右この余白の内側
+  float titleTop = 15.0f;
+  float bodyLeft = 40.0f; ///< 本文は左右この余白の内側
+  float bodyTop = 140.0f;
+  float imageMargin = 20.0f; ///< 画像の上下の余白
+
+  // 関連項目ボタン（本文の下に columns 列で並べる）
+  float seeAlsoGap = 60.0f;
+  float buttonWidth = 200.0f;
+  float buttonHeight = 50.0f;
+  float buttonColumnStep = 220.0f;
+  float buttonRowStep = 60.0f;
+  int buttonColumns = 3;
+};
+
+/// @brief レイアウト結果
+struct ArticleLayout {
+  uint32_t width = 0;
+  uint32_t height = 0;
+
+  /// 描く文字（タイトル・本文・ボタンのラベル。見出しの = は含まない）
+  std::u32string text;
+  std::vector<float> advances; ///< text と同じ長さ
+  std::vector<ArticleGlyphRun> runs;
+  std::vector<ArticleLinkButton> buttons;
+
+  std::vector<LinkRegion> links; ///< 本文中の出現 → ボタンの順
+  std::vector<ImageRegion> images;
+  std::vector<HeadingRegion> headings;
+
+  float bodyBottom = 0.0f; ///< 本文（画像を含む）の下端
+  size_t lineCount = 0;
+};
+
+/// @brief 記事のレイアウトエンジン
+/// @details 行分割は貪欲法で、次の位置で改行できる。
+///          - 空白の後ろ（行末の空白は幅に数えない）
+///          - CJK の文字の前後（禁則: 閉じ括弧・句読点・小書きかな・
+///            長音符の前と、開き括弧の後ろでは改行しない）
+///          - ハイフンの後ろ
+///          どこでも改行できない長い語は文字の途中で折る。
+///          リンクは本文の全出現を1回の走査で探し、行をまたぐ出現は
+///          行ごとに矩形を作る（DirectWrite の HitTestTextRange と同じ）。
+///          入力以外の状態を持たないので、どのスレッドから呼んでもよい。
+class ArticleLayoutEngine {
+public:
+  /// @param metrics エンジンより長く生きること
+  explicit ArticleLayoutEngine(const GlyphMetricsProvider &metrics,
+                               const ArticleLayoutStyle &style = {});
+
+  const GlyphMetricsProvider &GetMetrics() const { return m_metrics; }
+  const ArticleLayoutStyle &GetStyle() const { return m_style; }
+
+  /// @brief width x height のテクスチャに記事をレイアウトする
+  ArticleLayout Layout(const ArticleLayoutInput &input, uint32_t width,
+                       uint32_t height) const;
+
+private:
+  const GlyphMetricsProvider &m_metrics;
+  ArticleLayoutStyle m_style;
+};
+
+/// @brief ArticleLayoutCache::GetOrLayout の結果
+struct ArticleLayoutCacheStats {
+  bool hit = false;
+  double elapsedMs = 0.0; ///< 検索、またはレイアウトにかかった時間
+};
+
+/// @brief 記事・大きさごとのレイアウト結果のキャッシュ
+/// @details 入力・大きさ・寸法の指紋・スタイルをハッシュしたキーで引き、
+///          最後に使った順に capacity 件まで持つ。スレッドセーフ。
+class ArticleLayoutCache {
+public:
+  explicit ArticleLayoutCache(size_t capacity = 8);
+
+  /// @brief キャッシュにあれば返し、なければレイアウトして入れる
+  std::shared_ptr<const ArticleLayout>
+  GetOrLayout(const ArticleLayoutEngine &engine,
+              const ArticleLayoutInput &input, uint32_t width,
+              uint32_t height, ArticleLayoutCacheStats *stats = nullptr);
+
+  void Clear();
+  size_t GetSize() const;
+
+private:
+  struct Key {
+    uint64_t hi = 0;
+    uint64_t lo = 0;
+    bool operator==(const Key &) const = default;
+  };
+  struct KeyHash {
+    size_t operator()(const Key &k) const {
+      return static_cast<size_t>(k.hi ^ (k.lo * 0x9e3779b97f4a7c15ull));
+    }
+  };
+  struct Entry {
+    std::shared_ptr<const ArticleLayout> layout;
+    std::list<Key>::iterator lruPos;
+  };
+
+  static Key MakeKey(const ArticleLayoutEngine &engine,
+                     const ArticleLayoutInput &input, uint32_t width,
+                     uint32_t height);
+
+  size_t m_capacity;
+  std::list<Key> m_lru; ///< 先頭ほど最近使った
+  std::unordered_map<Key, Entry, KeyHash> m_entries;
+  mutable std::mutex m_mutex;
+};
+
+} // namespace graphics
@@ -0,0 +1,130 @@
+/**
+ * @file AsyncMipTexture.cpp
+ * @brief 非同期ミップ生成テクスチャの実装
+ */
+
+#include "AsyncMipTexture.h"
+#include "../core/Logger.h"
+#include "../core/ThreadPool.h"
+#include <chrono>
+#include <cstring>
+
+namespace graphics {
+
+using Microsoft::WRL::ComPtr;
+
+bool AsyncMipTexture::Start(ID3D11Device *device, ID3D11DeviceContext *context,
+                            ID3D11Texture2D *source,
+                            const MipChainSettings &settings,
+                            core::ThreadPool &pool) {
+  if (!device || !context || !source) {
+    return false;
+  }
+
+  D3D11_TEXTURE2D_DESC desc;
+  source->GetDesc(&desc);
+  if (desc.Format != DXGI_FORMAT_R8G8B8A8_UNORM &&
+      desc.Format != DXGI_FORMAT_B8G8R8A8_UNORM) {
+    LOG_WARN("MipTex", "Unsupported format {} for mip generation",
+             static_cast<uint32_t>(desc.Format));
+    return false;
+  }
+
+  // 1. 読み戻し用のステージングテクスチャへ写す
+  D3D11_TEXTURE2D_DESC stagingDesc = desc;
+  stagingDesc.MipLevels = 1;
+  stagingDesc.Usage = D3D11_USAGE_STAGING;
+  stagingDesc.BindFlags = 0;
+  stagingDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+  stagingDesc.MiscFlags = 0;
+  ComPtr<ID3D11Texture2D> staging;
+  if (FAILED(device->CreateTexture2D(&stagingDesc, nullptr, &staging))) {
+    LOG_ERROR("MipTex", "Failed to create staging texture {}x{}", desc.Width,
+              desc.Height);
+    return false;
+  }
+  context->CopySubresourceRegion(staging.Get(), 0, 0, 0, 0, source, 0,
+                                 nullptr);
+
+  D3D11_MAPPED_SUBRESOURCE mapped;
+  if (FAILED(context->Map(staging.Get(), 0, D3D11_MAP_READ, 0, &mapped))) {
+    LOG_ERROR("MipTex", "Failed to map staging texture");
+    return false;
+  }
+  const size_t rowBytes = static_cast<size_t>(desc.Width) * 4;
+  auto level0 = std::make_shared<std::vector<uint8_t>>(rowBytes * desc.Height);
+  for (uint32_t y = 0; y < desc.Height; ++y) {
+    std::memcpy(level0->data() + y * rowBytes,
+                static_cast<const uint8_t *>(mapped.pData) +
+                    static_cast<size_t>(y) * mapped.RowPitch,
+                rowBytes);
+  }
+  context->Unmap(staging.Get(), 0);
+
+  m_device = device;
+  m_format = desc.Format;
+  m_width = desc.Width;
+  m_height = desc.Height;
+  m_level0 = level0;
+  m_texture.Reset();
+  m_srv.Reset();
+
+  // 2. 縮小はワーカーで（1段ずつ行を分けて並列にする）
+  const uint32_t width = desc.Width;
+  const uint32_t height = desc.Height;
+  core::ThreadPool *poolPtr = &pool;
+  m_future = pool.Submit([level0, width, height, settings, poolPtr]() {
+    const auto start = std::chrono::steady_clock::now();
+    std::vector<MipLevel> levels;
+    GenerateMipChain(level0->data(), width, height,
+                     static_cast<size_t>(width) * 4, settings, levels,
+                     poolPtr);
+    const double ms = std::chrono::duration<double, std::milli>(
+                          std::chrono::steady_clock::now() - start)
+                          .count();
+    LOG_INFO("MipTex", "Generated {} mip levels for {}x{} in {:.1f} ms",
+             levels.size(), width, height, ms);
+    return levels;
+  });
+  return true;
+}
+
+bool AsyncMipTexture::Poll() {
+  if (!m_future.valid() || m_future.wait_for(std::chrono::seconds(0)) !=
+                               std::future_status::ready) {
+    return false;
+  }
+  const std::vector<MipLevel> levels = m_future.get();
+  const std::shared_ptr<std::vector<uint8_t>> level0 = std::move(m_level0);
+
+  // 3. 全段を初期データにしてテクスチャを作る
+  D3D11_TEXTURE2D_DESC desc = {};
+  desc.Width = m_width;
+  desc.Height = m_height;
+  desc.MipLevels = static_cast<UINT>(levels.size() + 1);
+  desc.ArraySize = 1;
+  desc.Format = m_format;
+  desc.SampleDesc.Count = 1;
+  desc.Usage = D3D11_USAGE_IMMUTABLE;
+  desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+  std::vector<D3D11_SUBRESOURCE_DATA> data(levels.size() + 1);
+  data[0].pSysMem = level0->data();
+  data[0].SysMemPitch = m_width * 4;
+  for (size_t i = 0; i < levels.size(); ++i) {
+    data[i + 1].pSysMem = levels[i].pixels.data();
+    data[i + 1].SysMemPitch = levels[i].width * 4;
+  }
+  if (FAILED(m_device->CreateTexture2D(&desc, data.data(), &m_texture)) ||
+      FAILED(m_device->CreateShaderResourceView(m_texture.Get(), nullptr,
+                                                &m_srv))) {
+    LOG_ERROR("MipTex", "Failed to create mipmapped texture {}x{}", m_width,
+              m_height);
+    m_texture.Reset();
+    m_srv.Reset();
+    return false;
+  }
+  return true;
+}
+
+} // namespace graphics
@@ -0,0 +1,65 @@
+#pragma once
+/**
+ * @file AsyncMipTexture.h
+ * @brief ミップチェーンをワーカーで作り、出来たら差し替えるテクスチャ
+ */
+
+#include "MipChain.h"
+#include <d3d11.h>
+#include <future>
+#include <memory>
+#include <vector>
+#include <wrl/client.h>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace graphics {
+
+/**
+ * @brief レベル 0 だけのテクスチャから、ミップ付きの複製を非同期に作る
+ * @details Start でレベル 0 を読み戻し（GPU で描いたテクスチャでもよい）、
+ *          縮小はスレッドプールで行う。Poll が出来上がりを見つけたら
+ *          全段を持つテクスチャと SRV を作る。それまでは元のテクスチャを
+ *          そのまま使えばよい（描画側は SRV を差し替えるだけ）。
+ */
+class AsyncMipTexture {
+public:
+  AsyncMipTexture() = default;
+
+  // コピー禁止
+  AsyncMipTexture(const AsyncMipTexture &) = delete;
+  AsyncMipTexture &operator=(const AsyncMipTexture &) = delete;
+
+  /// @brief 読み戻して縮小を始める
+  /// @param source 1段の RGBA8 / BGRA8 テクスチャ
+  /// @return 読み戻せなければ false（ミップなしのまま使う）
+  bool Start(ID3D11Device *device, ID3D11DeviceContext *context,
+             ID3D11Texture2D *source, const MipChainSettings &settings,
+             core::ThreadPool &pool);
+
+  /// @brief 縮小が終わっていればテクスチャを作る（描画スレッドで毎フレーム）
+  /// @return SRV がこの呼び出しで使えるようになったら true
+  bool Poll();
+
+  /// @brief ミップ付きの SRV（出来るまでは nullptr）
+  ID3D11ShaderResourceView *GetSRV() const { return m_srv.Get(); }
+
+  /// @brief 縮小を待っている間 true
+  bool IsPending() const { return m_future.valid(); }
+
+private:
+  Microsoft::WRL::ComPtr<ID3D11Device> m_device;
+  DXGI_FORMAT m_format = DXGI_FORMAT_UNKNOWN;
+  uint32_t m_width = 0;
+  uint32_t m_height = 0;
+  /// レベル 0（ワーカーと共有し、アップロードが済んだら手放す）
+  std::shared_ptr<std::vector<uint8_t>> m_level0;
+  std::future<std::vector<MipLevel>> m_future;
+
+  Microsoft::WRL::ComPtr<ID3D11Texture2D> m_texture;
+  Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> m_srv;
+};
+
+} // namespace graphics
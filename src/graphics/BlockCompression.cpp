@@ -0,0 +1,557 @@
+/**
+ * @file BlockCompression.cpp
+ * @brief BC1 / BC7 ブロック圧縮の実装
+ */
+
+#include "BlockCompression.h"
+#include "../core/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+namespace graphics {
+
+namespace {
+
+/// @brief 1チャンクあたりのブロック数の目安
+constexpr size_t kBlocksPerChunk = 1024;
+
+/// @brief BC7 の 4bit 補間の重み（/64）
+constexpr int kWeights4[16] = {0,  4,  9,  13, 17, 21, 26, 30,
+                               34, 38, 43, 47, 51, 55, 60, 64};
+
+/// @brief プールがあれば並列、なければそのまま実行
+template <typename Fn>
+void RunRange(core::ThreadPool *pool, size_t count, size_t grain, Fn &&fn) {
+  if (count == 0) {
+    return;
+  }
+  if (pool && count > grain) {
+    pool->ParallelFor(count, grain, fn);
+  } else {
+    fn(0, count);
+  }
+}
+
+/// @brief 下位ビットから順に詰めるビット書き込み
+class BitWriter {
+public:
+  explicit BitWriter(uint8_t *out, size_t bytes) : m_out(out) {
+    std::memset(out, 0, bytes);
+  }
+  void Put(uint32_t value, int bits) {
+    for (int i = 0; i < bits; ++i, ++m_pos) {
+      if ((value >> i) & 1u) {
+        m_out[m_pos >> 3] |= static_cast<uint8_t>(1u << (m_pos & 7));
+      }
+    }
+  }
+
+private:
+  uint8_t *m_out;
+  size_t m_pos = 0;
+};
+
+/// @brief 下位ビットから順に読むビット読み出し
+class BitReader {
+public:
+  explicit BitReader(const uint8_t *in) : m_in(in) {}
+  uint32_t Get(int bits) {
+    uint32_t value = 0;
+    for (int i = 0; i < bits; ++i, ++m_pos) {
+      value |= static_cast<uint32_t>((m_in[m_pos >> 3] >> (m_pos & 7)) & 1u)
+               << i;
+    }
+    return value;
+  }
+
+private:
+  const uint8_t *m_in;
+  size_t m_pos = 0;
+};
+
+/**
+ * @brief 16 点の主軸（共分散行列の最大固有ベクトル）をべき乗法で求める
+ * @param channels 3（RGB）または 4（RGBA）
+ */
+void PrincipalAxis(const float points[16][4], int channels, float mean[4],
+                   float axis[4]) {
+  for (int c = 0; c < 4; ++c) {
+    mean[c] = 0.0f;
+    for (int i = 0; i < 16; ++i) {
+      mean[c] += points[i][c];
+    }
+    mean[c] /= 16.0f;
+  }
+  float cov[4][4] = {};
+  for (int i = 0; i < 16; ++i) {
+    float d[4];
+    for (int c = 0; c < channels; ++c) {
+      d[c] = points[i][c] - mean[c];
+    }
+    for (int a = 0; a < channels; ++a) {
+      for (int b = 0; b < channels; ++b) {
+        cov[a][b] += d[a] * d[b];
+      }
+    }
+  }
+  // 分散が最大のチャンネルから始めると数回で収束する
+  int start = 0;
+  for (int c = 1; c < channels; ++c) {
+    if (cov[c][c] > cov[start][start]) {
+      start = c;
+    }
+  }
+  float v[4] = {};
+  v[start] = 1.0f;
+  for (int iter = 0; iter < 8; ++iter) {
+    float next[4] = {};
+    float length = 0.0f;
+    for (int a = 0; a < channels; ++a) {
+      for (int b = 0; b < channels; ++b) {
+        next[a] += cov[a][b] * v[b];
+      }
+      length += next[a] * next[a];
+    }
+    if (length <= 1e-12f) {
+      break;
+    }
+    length = std::sqrt(length);
+    for (int a = 0; a < channels; ++a) {
+      v[a] = next[a] / length;
+    }
+  }
+  for (int c = 0; c < 4; ++c) {
+    axis[c] = c < channels ? v[c] : 0.0f;
+  }
+}
+
+/// @brief 主軸へ投影した範囲の両端を端点にする
+void AxisEndpoints(const float points[16][4], int channels, float inset,
+                   float lo[4], float hi[4]) {
+  float mean[4], axis[4];
+  PrincipalAxis(points, channels, mean, axis);
+  float tMin = 0.0f, tMax = 0.0f;
+  for (int i = 0; i < 16; ++i) {
+    float t = 0.0f;
+    for (int c = 0; c < channels; ++c) {
+      t += (points[i][c] - mean[c]) * axis[c];
+    }
+    tMin = std::min(tMin, t);
+    tMax = std::max(tMax, t);
+  }
+  const float shrink = (tMax - tMin) * inset;
+  tMin += shrink;
+  tMax -= shrink;
+  for (int c = 0; c < 4; ++c) {
+    lo[c] = std::clamp(mean[c] + axis[c] * tMin, 0.0f, 255.0f);
+    hi[c] = std::clamp(mean[c] + axis[c] * tMax, 0.0f, 255.0f);
+  }
+}
+
+/**
+ * @brief 補間の重みが決まっているときの最小二乗の端点
+ * @param weights 各画素の color1 側の重み [0, 1]
+ * @return 重みが偏っていて解けなければ false
+ */
+bool LeastSquaresEndpoints(const float points[16][4], const float weights[16],
+                           int channels, float lo[4], float hi[4]) {
+  float aa = 0.0f, bb = 0.0f, ab = 0.0f;
+  float x[4] = {}, y[4] = {};
+  for (int i = 0; i < 16; ++i) {
+    const float b = weights[i];
+    const float a = 1.0f - b;
+    aa += a * a;
+    bb += b * b;
+    ab += a * b;
+    for (int c = 0; c < channels; ++c) {
+      x[c] += a * points[i][c];
+      y[c] += b * points[i][c];
+    }
+  }
+  const float det = aa * bb - ab * ab;
+  if (std::fabs(det) < 1e-6f) {
+    return false;
+  }
+  for (int c = 0; c < channels; ++c) {
+    lo[c] = std::clamp((x[c] * bb - y[c] * ab) / det, 0.0f, 255.0f);
+    hi[c] = std::clamp((y[c] * aa - x[c] * ab) / det, 0.0f, 255.0f);
+  }
+  return true;
+}
+
+void LoadPoints(const uint8_t rgba[64], float points[16][4]) {
+  for (int i = 0; i < 16; ++i) {
+    for (int c = 0; c < 4; ++c) {
+      points[i][c] = static_cast<float>(rgba[i * 4 + c]);
+    }
+  }
+}
+
+// === BC1 ===
+
+uint16_t To565(const float color[4]) {
+  const int r = static_cast<int>(std::lround(color[0] * 31.0f / 255.0f));
+  const int g = static_cast<int>(std::lround(color[1] * 63.0f / 255.0f));
+  const int b = static_cast<int>(std::lround(color[2] * 31.0f / 255.0f));
+  return static_cast<uint16_t>((r << 11) | (g << 5) | b);
+}
+
+void Expand565(uint16_t c, int out[3]) {
+  const int r = (c >> 11) & 31;
+  const int g = (c >> 5) & 63;
+  const int b = c & 31;
+  out[0] = (r << 3) | (r >> 2);
+  out[1] = (g << 2) | (g >> 4);
+  out[2] = (b << 3) | (b >> 2);
+}
+
+/// @brief BC1 の4色（color0 > color1 なら補間2色、そうでなければ中間 + 透明）
+void Bc1Palette(uint16_t c0, uint16_t c1, int palette[4][4]) {
+  Expand565(c0, palette[0]);
+  Expand565(c1, palette[1]);
+  palette[0][3] = palette[1][3] = 255;
+  for (int c = 0; c < 3; ++c) {
+    const int a = palette[0][c], b = palette[1][c];
+    if (c0 > c1) {
+      palette[2][c] = (2 * a + b + 1) / 3;
+      palette[3][c] = (a + 2 * b + 1) / 3;
+    } else {
+      palette[2][c] = (a + b + 1) / 2;
+      palette[3][c] = 0;
+    }
+  }
+  palette[2][3] = 255;
+  palette[3][3] = c0 > c1 ? 255 : 0;
+}
+
+/// @brief BC1 の補間位置（インデックス → color1 側の重み）
+constexpr float kBc1Weights[4] = {0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f};
+
+/// @brief 端点から4色モードのインデックスを選び、RGB の二乗誤差を返す
+/// @details c0 < c1 なら入れ替える（4色モードの条件）。同じなら全画素 0。
+int Bc1Fit(const uint8_t rgba[64], uint16_t &c0, uint16_t &c1,
+           uint8_t indices[16]) {
+  if (c0 < c1) {
+    std::swap(c0, c1);
+  }
+  int palette[4][4];
+  Bc1Palette(c0, c1, palette);
+  const int colors = c0 > c1 ? 4 : 1;
+  int error = 0;
+  for (int i = 0; i < 16; ++i) {
+    int best = 0, bestError = 1 << 30;
+    for (int k = 0; k < colors; ++k) {
+      int e = 0;
+      for (int c = 0; c < 3; ++c) {
+        const int d = rgba[i * 4 + c] - palette[k][c];
+        e += d * d;
+      }
+      if (e < bestError) {
+        bestError = e;
+        best = k;
+      }
+    }
+    indices[i] = static_cast<uint8_t>(best);
+    error += bestError;
+  }
+  return error;
+}
+
+// === BC7 モード 6 ===
+
+struct Mode6Endpoints {
+  int color[2][4]; ///< 8bit に戻した値（(c7 << 1) | pbit）
+  int pbit[2];
+};
+
+/// @brief float の端点を 7bit + pbit に量子化する
+Mode6Endpoints QuantizeMode6(const float lo[4], const float hi[4], int p0,
+                             int p1) {
+  Mode6Endpoints e;
+  e.pbit[0] = p0;
+  e.pbit[1] = p1;
+  const float *src[2] = {lo, hi};
+  for (int k = 0; k < 2; ++k) {
+    for (int c = 0; c < 4; ++c) {
+      const int c7 = std::clamp(
+          static_cast<int>(std::lround((src[k][c] - e.pbit[k]) * 0.5f)), 0,
+          127);
+      e.color[k][c] = (c7 << 1) | e.pbit[k];
+    }
+  }
+  return e;
+}
+
+/// @brief 主軸への投影から近い3つの重みを調べてインデックスを選ぶ
+int Mode6Fit(const uint8_t rgba[64], const Mode6Endpoints &e,
+             uint8_t indices[16]) {
+  int palette[16][4];
+  for (int k = 0; k < 16; ++k) {
+    for (int c = 0; c < 4; ++c) {
+      palette[k][c] = ((64 - kWeights4[k]) * e.color[0][c] +
+                       kWeights4[k] * e.color[1][c] + 32) >>
+                      6;
+    }
+  }
+  int dir[4], dd = 0;
+  for (int c = 0; c < 4; ++c) {
+    dir[c] = e.color[1][c] - e.color[0][c];
+    dd += dir[c] * dir[c];
+  }
+  int error = 0;
+  for (int i = 0; i < 16; ++i) {
+    int guess = 0;
+    if (dd > 0) {
+      int dot = 0;
+      for (int c = 0; c < 4; ++c) {
+        dot += (rgba[i * 4 + c] - e.color[0][c]) * dir[c];
+      }
+      guess = std::clamp(static_cast<int>(std::lround(
+                             static_cast<float>(dot) * 15.0f / dd)),
+                         0, 15);
+    }
+    int best = guess, bestError = 1 << 30;
+    for (int k = std::max(guess - 1, 0); k <= std::min(guess + 1, 15); ++k) {
+      int err = 0;
+      for (int c = 0; c < 4; ++c) {
+        const int d = rgba[i * 4 + c] - palette[k][c];
+        err += d * d;
+      }
+      if (err < bestError) {
+        bestError = err;
+        best = k;
+      }
+    }
+    indices[i] = static_cast<uint8_t>(best);
+    error += bestError;
+  }
+  return error;
+}
+
+/// @brief pbit の4通りを試して最も誤差の小さい量子化を選ぶ
+int BestMode6(const uint8_t rgba[64], const float lo[4], const float hi[4],
+              Mode6Endpoints &best, uint8_t indices[16]) {
+  int bestError = 1 << 30;
+  for (int p = 0; p < 4; ++p) {
+    const Mode6Endpoints e = QuantizeMode6(lo, hi, p & 1, p >> 1);
+    uint8_t trial[16];
+    const int error = Mode6Fit(rgba, e, trial);
+    if (error < bestError) {
+      bestError = error;
+      best = e;
+      std::memcpy(indices, trial, 16);
+    }
+  }
+  return bestError;
+}
+
+} // namespace
+
+size_t BlockBytes(BlockFormat format) {
+  return format == BlockFormat::BC1 ? 8 : 16;
+}
+
+size_t CompressedSize(BlockFormat format, uint32_t width, uint32_t height) {
+  const size_t blocksX = (static_cast<size_t>(width) + 3) / 4;
+  const size_t blocksY = (static_cast<size_t>(height) + 3) / 4;
+  return blocksX * blocksY * BlockBytes(format);
+}
+
+void EncodeBC1Block(const uint8_t rgba[64], uint8_t out[8]) {
+  float points[16][4];
+  LoadPoints(rgba, points);
+
+  // 1. 主軸の両端（量子化で外へはみ出さないよう 1/16 内側へ寄せる）
+  float lo[4], hi[4];
+  AxisEndpoints(points, 3, 1.0f / 16.0f, lo, hi);
+  uint16_t c0 = To565(hi), c1 = To565(lo);
+  uint8_t indices[16];
+  int error = Bc1Fit(rgba, c0, c1, indices);
+
+  // 2. 選んだインデックスの重みで端点を取り直す（良くなったときだけ採用）
+  if (error > 0 && c0 != c1) {
+    float weights[16];
+    for (int i = 0; i < 16; ++i) {
+      weights[i] = kBc1Weights[indices[i]];
+    }
+    if (LeastSquaresEndpoints(points, weights, 3, lo, hi)) {
+      uint16_t r0 = To565(lo), r1 = To565(hi);
+      uint8_t refined[16];
+      const int refinedError = Bc1Fit(rgba, r0, r1, refined);
+      if (refinedError < error) {
+        c0 = r0;
+        c1 = r1;
+        std::memcpy(indices, refined, 16);
+      }
+    }
+  }
+
+  uint32_t bits = 0;
+  for (int i = 0; i < 16; ++i) {
+    bits |= static_cast<uint32_t>(indices[i]) << (i * 2);
+  }
+  out[0] = static_cast<uint8_t>(c0);
+  out[1] = static_cast<uint8_t>(c0 >> 8);
+  out[2] = static_cast<uint8_t>(c1);
+  out[3] = static_cast<uint8_t>(c1 >> 8);
+  for (int i = 0; i < 4; ++i) {
+    out[4 + i] = static_cast<uint8_t>(bits >> (i * 8));
+  }
+}
+
+void DecodeBC1Block(const uint8_t block[8], uint8_t rgba[64]) {
+  const uint16_t c0 = static_cast<uint16_t>(block[0] | (block[1] << 8));
+  const uint16_t c1 = static_cast<uint16_t>(block[2] | (block[3] << 8));
+  const uint32_t bits = static_cast<uint32_t>(block[4]) |
+                        (static_cast<uint32_t>(block[5]) << 8) |
+                        (static_cast<uint32_t>(block[6]) << 16) |
+                        (static_cast<uint32_t>(block[7]) << 24);
+  int palette[4][4];
+  Bc1Palette(c0, c1, palette);
+  for (int i = 0; i < 16; ++i) {
+    const int k = (bits >> (i * 2)) & 3;
+    for (int c = 0; c < 4; ++c) {
+      rgba[i * 4 + c] = static_cast<uint8_t>(palette[k][c]);
+    }
+  }
+}
+
+void EncodeBC7Block(const uint8_t rgba[64], uint8_t out[16]) {
+  float points[16][4];
+  LoadPoints(rgba, points);
+
+  // 1. RGBA の主軸の両端から始める
+  float lo[4], hi[4];
+  AxisEndpoints(points, 4, 0.0f, lo, hi);
+  Mode6Endpoints best;
+  uint8_t indices[16];
+  int error = BestMode6(rgba, lo, hi, best, indices);
+
+  // 2. 最小二乗で端点を取り直す（良くなったときだけ採用）
+  if (error > 0) {
+    float weights[16];
+    for (int i = 0; i < 16; ++i) {
+      weights[i] = static_cast<float>(kWeights4[indices[i]]) / 64.0f;
+    }
+    if (LeastSquaresEndpoints(points, weights, 4, lo, hi)) {
+      Mode6Endpoints refined;
+      uint8_t refinedIndices[16];
+      const int refinedError = BestMode6(rgba, lo, hi, refined, refinedIndices);
+      if (refinedError < error) {
+        best = refined;
+        std::memcpy(indices, refinedIndices, 16);
+      }
+    }
+  }
+
+  // 3. 先頭画素のインデックスは最上位ビットが 0（3bit で書く）でなければ
+  //    ならないので、必要なら端点を入れ替えて反転する
+  if (indices[0] & 8) {
+    std::swap(best.color[0], best.color[1]);
+    std::swap(best.pbit[0], best.pbit[1]);
+    for (uint8_t &index : indices) {
+      index = static_cast<uint8_t>(15 - index);
+    }
+  }
+
+  BitWriter writer(out, 16);
+  writer.Put(1u << 6, 7); // モード 6
+  for (int c = 0; c < 4; ++c) {
+    writer.Put(static_cast<uint32_t>(best.color[0][c] >> 1), 7);
+    writer.Put(static_cast<uint32_t>(best.color[1][c] >> 1), 7);
+  }
+  writer.Put(static_cast<uint32_t>(best.pbit[0]), 1);
+  writer.Put(static_cast<uint32_t>(best.pbit[1]), 1);
+  writer.Put(indices[0], 3);
+  for (int i = 1; i < 16; ++i) {
+    writer.Put(indices[i], 4);
+  }
+}
+
+bool DecodeBC7Block(const uint8_t block[16], uint8_t rgba[64]) {
+  BitReader reader(block);
+  if (reader.Get(7) != (1u << 6)) {
+    return false;
+  }
+  int color[2][4];
+  for (int c = 0; c < 4; ++c) {
+    color[0][c] = static_cast<int>(reader.Get(7)) << 1;
+    color[1][c] = static_cast<int>(reader.Get(7)) << 1;
+  }
+  const int p0 = static_cast<int>(reader.Get(1));
+  const int p1 = static_cast<int>(reader.Get(1));
+  for (int c = 0; c < 4; ++c) {
+    color[0][c] |= p0;
+    color[1][c] |= p1;
+  }
+  for (int i = 0; i < 16; ++i) {
+    const int w = kWeights4[reader.Get(i == 0 ? 3 : 4)];
+    for (int c = 0; c < 4; ++c) {
+      rgba[i * 4 + c] = static_cast<uint8_t>(
+          ((64 - w) * color[0][c] + w * color[1][c] + 32) >> 6);
+    }
+  }
+  return true;
+}
+
+void CompressImage(const uint8_t *rgba, uint32_t width, uint32_t height,
+                   size_t stride, BlockFormat format, uint8_t *out,
+                   core::ThreadPool *pool) {
+  if (width == 0 || height == 0) {
+    return;
+  }
+  const size_t blocksX = (static_cast<size_t>(width) + 3) / 4;
+  const size_t blocksY = (static_cast<size_t>(height) + 3) / 4;
+  const size_t blockBytes = BlockBytes(format);
+  const size_t grain = std::max<size_t>(1, kBlocksPerChunk / blocksX);
+
+  RunRange(pool, blocksY, grain, [&](size_t begin, size_t end) {
+    uint8_t block[64];
+    for (size_t by = begin; by < end; ++by) {
+      for (size_t bx = 0; bx < blocksX; ++bx) {
+        for (uint32_t y = 0; y < 4; ++y) {
+          const size_t sy = std::min<size_t>(by * 4 + y, height - 1);
+          for (uint32_t x = 0; x < 4; ++x) {
+            const size_t sx = std::min<size_t>(bx * 4 + x, width - 1);
+            std::memcpy(block + (y * 4 + x) * 4, rgba + sy * stride + sx * 4,
+                        4);
+          }
+        }
+        uint8_t *dst = out + (by * blocksX + bx) * blockBytes;
+        if (format == BlockFormat::BC1) {
+          EncodeBC1Block(block, dst);
+        } else {
+          EncodeBC7Block(block, dst);
+        }
+      }
+    }
+  });
+}
+
+bool DecompressImage(const uint8_t *blocks, uint32_t width, uint32_t height,
+                     BlockFormat format, uint8_t *rgba) {
+  const size_t blocksX = (static_cast<size_t>(width) + 3) / 4;
+  const size_t blocksY = (static_cast<size_t>(height) + 3) / 4;
+  const size_t blockBytes = BlockBytes(format);
+  uint8_t block[64];
+  for (size_t by = 0; by < blocksY; ++by) {
+    for (size_t bx = 0; bx < blocksX; ++bx) {
+      const uint8_t *src = blocks + (by * blocksX + bx) * blockBytes;
+      if (format == BlockFormat::BC1) {
+        DecodeBC1Block(src, block);
+      } else if (!DecodeBC7Block(src, block)) {
+        return false;
+      }
+      for (size_t y = 0; y < 4 && by * 4 + y < height; ++y) {
+        for (size_t x = 0; x < 4 && bx * 4 + x < width; ++x) {
+          std::memcpy(rgba + ((by * 4 + y) * width + bx * 4 + x) * 4,
+                      block + (y * 4 + x) * 4, 4);
+        }
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace graphics
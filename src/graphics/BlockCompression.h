@@ -0,0 +1,61 @@
+#pragma once
+/**
+ * @file BlockCompression.h
+ * @brief BC1 / BC7 のブロック圧縮（CPU のみで符号化・復号。GPU 非依存）
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace graphics {
+
+/// @brief ブロック圧縮の形式（4x4 画素を1ブロックにする）
+enum class BlockFormat : uint32_t {
+  BC1 = 1, ///< RGB 565 の2色 + 2bit 補間（8 バイト、アルファなし）
+  BC7 = 7, ///< RGBA。モード 6（7bit + pbit の2色 + 4bit 補間、16 バイト）
+};
+
+/// @brief 1ブロックのバイト数
+size_t BlockBytes(BlockFormat format);
+
+/// @brief width x height の画像を圧縮したバイト数（端数はブロックに切り上げ）
+size_t CompressedSize(BlockFormat format, uint32_t width, uint32_t height);
+
+/// @brief 4x4 の RGBA8（行順に 64 バイト）を1ブロックに符号化する
+/// @details BC1 は不透明として扱い、常に 4 色モード（color0 > color1）で書く。
+void EncodeBC1Block(const uint8_t rgba[64], uint8_t out[8]);
+
+/// @brief BC1 ブロックを 4x4 の RGBA8 に戻す（3 色 + 透明モードも読める）
+void DecodeBC1Block(const uint8_t block[8], uint8_t rgba[64]);
+
+/// @brief 4x4 の RGBA8 を BC7 モード 6 で符号化する
+/// @details 主軸上の端点から始め、pbit の4通りと最小二乗での端点の
+///          取り直しを試して誤差が最小のものを書く。
+void EncodeBC7Block(const uint8_t rgba[64], uint8_t out[16]);
+
+/// @brief BC7 ブロックを戻す
+/// @return このエンコーダが書くモード 6 以外なら false（rgba は触らない）
+bool DecodeBC7Block(const uint8_t block[16], uint8_t rgba[64]);
+
+/**
+ * @brief RGBA8 画像全体を圧縮する
+ * @details ブロックは行順に並べる（D3D のブロック圧縮テクスチャと同じ）。
+ *          右端・下端で 4 に満たない部分は端の画素を繰り返して埋める。
+ * @param stride 行の間隔（バイト）
+ * @param out CompressedSize バイト以上の書き込み先
+ * @param pool ブロックの行を分けて並列に処理する（nullptr なら単一スレッド）
+ */
+void CompressImage(const uint8_t *rgba, uint32_t width, uint32_t height,
+                   size_t stride, BlockFormat format, uint8_t *out,
+                   core::ThreadPool *pool = nullptr);
+
+/// @brief 圧縮された画像を RGBA8（行を詰めて並べる）に戻す
+/// @return 読めないブロックがあれば false
+bool DecompressImage(const uint8_t *blocks, uint32_t width, uint32_t height,
+                     BlockFormat format, uint8_t *rgba);
+
+} // namespace graphics
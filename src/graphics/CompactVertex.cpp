@@ -0,0 +1,296 @@
+/**
+ * @file CompactVertex.cpp
+ * @brief 量子化した頂点形式の実装
+ */
+
+#include "CompactVertex.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+
+namespace graphics {
+
+namespace {
+
+constexpr float kSnorm16Max = 32767.0f;
+
+int16_t ToSnorm16(float value) {
+  const float clamped = std::clamp(value, -1.0f, 1.0f);
+  return static_cast<int16_t>(std::lround(clamped * kSnorm16Max));
+}
+
+/// @brief D3D の SNORM と同じく -32768 は -1 にそろえる
+float FromSnorm16(int16_t value) {
+  return std::max(static_cast<float>(value) / kSnorm16Max, -1.0f);
+}
+
+uint8_t ToUnorm8(float value) {
+  return static_cast<uint8_t>(std::lround(std::clamp(value, 0.0f, 1.0f) *
+                                          255.0f));
+}
+
+uint16_t EncodeComponent(float value, PositionEncoding encoding) {
+  if (encoding == PositionEncoding::kHalf) {
+    return FloatToHalf(value);
+  }
+  return static_cast<uint16_t>(ToSnorm16(value));
+}
+
+float DecodeComponent(uint16_t value, PositionEncoding encoding) {
+  if (encoding == PositionEncoding::kHalf) {
+    return HalfToFloat(value);
+  }
+  return FromSnorm16(static_cast<int16_t>(value));
+}
+
+DirectX::XMFLOAT3 Cross(const DirectX::XMFLOAT3 &a,
+                        const DirectX::XMFLOAT3 &b) {
+  return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+          a.x * b.y - a.y * b.x};
+}
+
+float Dot(const DirectX::XMFLOAT3 &a, const DirectX::XMFLOAT3 &b) {
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+/// @return 長さ（0 なら v はそのまま）
+float Normalize(DirectX::XMFLOAT3 &v) {
+  const float length = std::sqrt(Dot(v, v));
+  if (length > 0.0f) {
+    v = {v.x / length, v.y / length, v.z / length};
+  }
+  return length;
+}
+
+/// @brief 2つの方向の角度（度）。どちらかが長さ 0 なら 0
+float AngleDegrees(DirectX::XMFLOAT3 a, DirectX::XMFLOAT3 b) {
+  if (Normalize(a) == 0.0f || Normalize(b) == 0.0f) {
+    return 0.0f;
+  }
+  // acos は 1 の近くで float の分解能が足りない（1 ulp で約 0.02 度）
+  const DirectX::XMFLOAT3 c = Cross(a, b);
+  return std::atan2(std::sqrt(Dot(c, c)), Dot(a, b)) *
+         (180.0f / 3.14159265358979f);
+}
+
+} // namespace
+
+DirectX::XMFLOAT4X4 PositionQuantization::ToMatrix() const {
+  return {scale, 0.0f,     0.0f,     0.0f, //
+          0.0f,  scale,    0.0f,     0.0f, //
+          0.0f,  0.0f,     scale,    0.0f, //
+          center.x, center.y, center.z, 1.0f};
+}
+
+uint16_t FloatToHalf(float value) {
+  uint32_t f = 0;
+  std::memcpy(&f, &value, sizeof(f));
+  const uint16_t sign = static_cast<uint16_t>((f >> 16) & 0x8000u);
+  f &= 0x7fffffffu;
+  if (f >= 0x7f800000u) {
+    // 無限大と NaN（NaN は仮数の上位ビットを立てて残す）
+    return sign | 0x7c00u | (f > 0x7f800000u ? 0x0200u : 0u);
+  }
+  if (f >= 0x477ff000u) {
+    return sign | 0x7c00u; // 65520 以上は half では無限大
+  }
+  if (f < 0x38800000u) {
+    // half の非正規化数（2^-24 単位）。丸めで最小の正規化数になってもよい
+    float magnitude = 0.0f;
+    std::memcpy(&magnitude, &f, sizeof(f));
+    return sign |
+           static_cast<uint16_t>(std::nearbyint(magnitude * 16777216.0f));
+  }
+  uint32_t half = ((f >> 23) - 112u) << 10 | (f & 0x7fffffu) >> 13;
+  const uint32_t rest = f & 0x1fffu;
+  if (rest > 0x1000u || (rest == 0x1000u && (half & 1u))) {
+    ++half; // 仮数からあふれたら指数に繰り上がる
+  }
+  return sign | static_cast<uint16_t>(half);
+}
+
+float HalfToFloat(uint16_t half) {
+  const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+  const uint32_t exponent = (half >> 10) & 0x1fu;
+  const uint32_t mantissa = half & 0x3ffu;
+  uint32_t f = 0;
+  if (exponent == 0) {
+    const float magnitude = static_cast<float>(mantissa) / 16777216.0f;
+    std::memcpy(&f, &magnitude, sizeof(f));
+    f |= sign;
+  } else if (exponent == 31) {
+    f = sign | 0x7f800000u | mantissa << 13;
+  } else {
+    f = sign | (exponent + 112u) << 23 | mantissa << 13;
+  }
+  float value = 0.0f;
+  std::memcpy(&value, &f, sizeof(value));
+  return value;
+}
+
+void EncodeOctahedral(const DirectX::XMFLOAT3 &direction, int16_t out[2]) {
+  const float sum =
+      std::fabs(direction.x) + std::fabs(direction.y) + std::fabs(direction.z);
+  if (sum == 0.0f) {
+    out[0] = out[1] = 0; // 戻すと +Z
+    return;
+  }
+  float x = direction.x / sum;
+  float y = direction.y / sum;
+  if (direction.z < 0.0f) {
+    // 下半分は四隅へ折り返す
+    const float fx = (1.0f - std::fabs(y)) * (x >= 0.0f ? 1.0f : -1.0f);
+    const float fy = (1.0f - std::fabs(x)) * (y >= 0.0f ? 1.0f : -1.0f);
+    x = fx;
+    y = fy;
+  }
+  out[0] = ToSnorm16(x);
+  out[1] = ToSnorm16(y);
+}
+
+DirectX::XMFLOAT3 DecodeOctahedral(const int16_t encoded[2]) {
+  DirectX::XMFLOAT3 n{FromSnorm16(encoded[0]), FromSnorm16(encoded[1]), 0.0f};
+  n.z = 1.0f - std::fabs(n.x) - std::fabs(n.y);
+  const float t = std::max(-n.z, 0.0f);
+  n.x += n.x >= 0.0f ? -t : t;
+  n.y += n.y >= 0.0f ? -t : t;
+  Normalize(n);
+  return n;
+}
+
+PositionQuantization ComputePositionQuantization(const Vertex *vertices,
+                                                 size_t vertexCount) {
+  PositionQuantization quantization;
+  if (!vertices || vertexCount == 0) {
+    return quantization;
+  }
+  DirectX::XMFLOAT3 lo = vertices[0].position;
+  DirectX::XMFLOAT3 hi = vertices[0].position;
+  for (size_t i = 1; i < vertexCount; ++i) {
+    const DirectX::XMFLOAT3 &p = vertices[i].position;
+    lo = {std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z)};
+    hi = {std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z)};
+  }
+  quantization.center = {(lo.x + hi.x) * 0.5f, (lo.y + hi.y) * 0.5f,
+                         (lo.z + hi.z) * 0.5f};
+  const float halfExtent =
+      std::max({hi.x - lo.x, hi.y - lo.y, hi.z - lo.z}) * 0.5f;
+  quantization.scale = halfExtent > 0.0f ? halfExtent : 1.0f;
+  return quantization;
+}
+
+void EncodeCompactVertices(const Vertex *vertices, size_t vertexCount,
+                           PositionEncoding encoding,
+                           std::vector<CompactVertex> &out,
+                           PositionQuantization &quantization) {
+  quantization = ComputePositionQuantization(vertices, vertexCount);
+  out.resize(vertexCount);
+  const float inverseScale = 1.0f / quantization.scale;
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const Vertex &v = vertices[i];
+    CompactVertex &c = out[i];
+    const float p[3] = {(v.position.x - quantization.center.x) * inverseScale,
+                        (v.position.y - quantization.center.y) * inverseScale,
+                        (v.position.z - quantization.center.z) * inverseScale};
+    for (int axis = 0; axis < 3; ++axis) {
+      c.position[axis] = EncodeComponent(p[axis], encoding);
+    }
+
+    DirectX::XMFLOAT3 normal = v.normal;
+    if (Normalize(normal) == 0.0f) {
+      normal = {0.0f, 0.0f, 1.0f};
+    }
+    DirectX::XMFLOAT3 tangent = v.tangent;
+    if (Normalize(tangent) == 0.0f) {
+      tangent = {1.0f, 0.0f, 0.0f};
+    }
+    // 従法線は cross(法線, 接線) と同じ向きか逆向きかだけを残す
+    const float handedness =
+        Dot(Cross(normal, tangent), v.bitangent) < 0.0f ? -1.0f : 1.0f;
+    c.position[3] = EncodeComponent(handedness, encoding);
+    EncodeOctahedral(normal, c.normal);
+    EncodeOctahedral(tangent, c.tangent);
+
+    c.texCoord[0] = FloatToHalf(v.texCoord.x);
+    c.texCoord[1] = FloatToHalf(v.texCoord.y);
+    c.color[0] = ToUnorm8(v.color.x);
+    c.color[1] = ToUnorm8(v.color.y);
+    c.color[2] = ToUnorm8(v.color.z);
+    c.color[3] = ToUnorm8(v.color.w);
+  }
+}
+
+Vertex DecodeCompactVertex(const CompactVertex &vertex,
+                           PositionEncoding encoding,
+                           const PositionQuantization &quantization) {
+  Vertex v{};
+  const float s = quantization.scale;
+  v.position = {
+      quantization.center.x + DecodeComponent(vertex.position[0], encoding) * s,
+      quantization.center.y + DecodeComponent(vertex.position[1], encoding) * s,
+      quantization.center.z +
+          DecodeComponent(vertex.position[2], encoding) * s};
+  v.normal = DecodeOctahedral(vertex.normal);
+  v.tangent = DecodeOctahedral(vertex.tangent);
+  const float handedness =
+      DecodeComponent(vertex.position[3], encoding) < 0.0f ? -1.0f : 1.0f;
+  v.bitangent = Cross(v.normal, v.tangent);
+  Normalize(v.bitangent);
+  v.bitangent = {v.bitangent.x * handedness, v.bitangent.y * handedness,
+                 v.bitangent.z * handedness};
+  v.texCoord = {HalfToFloat(vertex.texCoord[0]),
+                HalfToFloat(vertex.texCoord[1])};
+  v.color = {vertex.color[0] / 255.0f, vertex.color[1] / 255.0f,
+             vertex.color[2] / 255.0f, vertex.color[3] / 255.0f};
+  return v;
+}
+
+CompactVertexError MeasureCompactVertexError(
+    const Vertex *vertices, const CompactVertex *compact, size_t vertexCount,
+    PositionEncoding encoding, const PositionQuantization &quantization) {
+  CompactVertexError error;
+  for (size_t i = 0; i < vertexCount; ++i) {
+    const Vertex &a = vertices[i];
+    const Vertex b = DecodeCompactVertex(compact[i], encoding, quantization);
+    const DirectX::XMFLOAT3 d{a.position.x - b.position.x,
+                              a.position.y - b.position.y,
+                              a.position.z - b.position.z};
+    error.position = std::max(error.position, std::sqrt(Dot(d, d)));
+    error.normalDegrees =
+        std::max(error.normalDegrees, AngleDegrees(a.normal, b.normal));
+    error.tangentDegrees =
+        std::max(error.tangentDegrees, AngleDegrees(a.tangent, b.tangent));
+    error.bitangentDegrees = std::max(error.bitangentDegrees,
+                                      AngleDegrees(a.bitangent, b.bitangent));
+    error.texCoord = std::max({error.texCoord,
+                               std::fabs(a.texCoord.x - b.texCoord.x),
+                               std::fabs(a.texCoord.y - b.texCoord.y)});
+    error.color = std::max({error.color, std::fabs(a.color.x - b.color.x),
+                            std::fabs(a.color.y - b.color.y),
+                            std::fabs(a.color.z - b.color.z),
+                            std::fabs(a.color.w - b.color.w)});
+  }
+  return error;
+}
+
+std::vector<D3D11_INPUT_ELEMENT_DESC>
+GetCompactInputLayout(PositionEncoding encoding) {
+  const DXGI_FORMAT position = encoding == PositionEncoding::kHalf
+                                   ? DXGI_FORMAT_R16G16B16A16_FLOAT
+                                   : DXGI_FORMAT_R16G16B16A16_SNORM;
+  return {
+      {"POSITION", 0, position, 0, offsetof(CompactVertex, position),
+       D3D11_INPUT_PER_VERTEX_DATA, 0},
+      {"NORMAL", 0, DXGI_FORMAT_R16G16_SNORM, 0,
+       offsetof(CompactVertex, normal), D3D11_INPUT_PER_VERTEX_DATA, 0},
+      {"TANGENT", 0, DXGI_FORMAT_R16G16_SNORM, 0,
+       offsetof(CompactVertex, tangent), D3D11_INPUT_PER_VERTEX_DATA, 0},
+      {"TEXCOORD", 0, DXGI_FORMAT_R16G16_FLOAT, 0,
+       offsetof(CompactVertex, texCoord), D3D11_INPUT_PER_VERTEX_DATA, 0},
+      {"COLOR", 0, DXGI_FORMAT_R8G8B8A8_UNORM, 0,
+       offsetof(CompactVertex, color), D3D11_INPUT_PER_VERTEX_DATA, 0},
+  };
+}
+
+} // namespace graphics
@@ -0,0 +1,92 @@
+#pragma once
+/**
+ * @file CompactVertex.h
+ * @brief 量子化した 24 バイトの頂点形式（Vertex は 72 バイト）と変換
+ * @details 位置はメッシュの境界で正規化した snorm16 か half、法線と接線は
+ *          八面体写像の snorm16、UV は half、色は unorm8 で持つ。従法線は
+ *          持たず、cross(法線, 接線) と位置の w に入れた向き（±1）から戻す。
+ *          シェーダー側の戻し方は shaders/CompactVS.hlsl。
+ */
+
+#include "Mesh.h"
+#include <DirectXMath.h>
+#include <cstddef>
+#include <cstdint>
+#include <d3d11.h>
+#include <vector>
+
+namespace graphics {
+
+/// @brief 位置の量子化の形式（どちらも 16 ビット x 4）
+enum class PositionEncoding : uint8_t {
+  kSnorm16, ///< 境界の中の誤差が一様（最も長い辺の 1/65534）
+  kHalf,    ///< 中心に近いほど細かく、端では snorm16 より粗い
+};
+
+/// @brief 24 バイトの頂点
+struct CompactVertex {
+  uint16_t position[4]; ///< xyz: 正規化した位置、w: 接線の向き（±1）
+  int16_t normal[2];    ///< 八面体写像した法線（snorm16）
+  int16_t tangent[2];   ///< 八面体写像した接線（snorm16）
+  uint16_t texCoord[2]; ///< half
+  uint8_t color[4];     ///< RGBA unorm8
+};
+
+static_assert(sizeof(CompactVertex) == 24);
+
+/**
+ * @brief 正規化した位置を元の座標へ戻す変換（position = center + p * scale）
+ * @details 全軸で同じ scale を使うので、ワールド行列に掛けても法線は
+ *          歪まない。
+ */
+struct PositionQuantization {
+  DirectX::XMFLOAT3 center{0.0f, 0.0f, 0.0f};
+  float scale = 1.0f; ///< 境界ボックスの最も長い辺の半分
+
+  /// @brief 行ベクトル用の行列（ワールド行列の左から掛ける）
+  DirectX::XMFLOAT4X4 ToMatrix() const;
+};
+
+/// @brief 量子化で生じた誤差（戻した値と元の値の差の最大）
+struct CompactVertexError {
+  float position = 0.0f;     ///< 元の座標での距離
+  float normalDegrees = 0.0f;
+  float tangentDegrees = 0.0f;
+  float bitangentDegrees = 0.0f; ///< 向きの符号が合わない頂点も含む
+  float texCoord = 0.0f;
+  float color = 0.0f;
+};
+
+/// @brief 頂点の境界から位置の量子化を決める
+PositionQuantization ComputePositionQuantization(const Vertex *vertices,
+                                                 size_t vertexCount);
+
+/// @brief Vertex を CompactVertex に詰める（量子化は vertices の境界から）
+void EncodeCompactVertices(const Vertex *vertices, size_t vertexCount,
+                           PositionEncoding encoding,
+                           std::vector<CompactVertex> &out,
+                           PositionQuantization &quantization);
+
+/// @brief CompactVertex を Vertex に戻す（シェーダーと同じ計算）
+Vertex DecodeCompactVertex(const CompactVertex &vertex,
+                           PositionEncoding encoding,
+                           const PositionQuantization &quantization);
+
+/// @brief 詰めて戻したときの誤差を測る
+CompactVertexError MeasureCompactVertexError(
+    const Vertex *vertices, const CompactVertex *compact, size_t vertexCount,
+    PositionEncoding encoding, const PositionQuantization &quantization);
+
+/// @brief CompactVertex 用の入力レイアウト（CompactVS.hlsl と対応）
+std::vector<D3D11_INPUT_ELEMENT_DESC>
+GetCompactInputLayout(PositionEncoding encoding);
+
+/// @brief float と half（IEEE 754 binary16）の変換。最近接偶数に丸める
+uint16_t FloatToHalf(float value);
+float HalfToFloat(uint16_t half);
+
+/// @brief 単位ベクトルの八面体写像（snorm16 x 2）と、その逆
+void EncodeOctahedral(const DirectX::XMFLOAT3 &direction, int16_t out[2]);
+DirectX::XMFLOAT3 DecodeOctahedral(const int16_t encoded[2]);
+
+} // namespace graphics
@@ -0,0 +1,119 @@
+/**
+ * @file DWriteGlyphMetrics.cpp
+ * @brief DirectWrite のフォントから求めるグリフ寸法の実装
+ */
+
+#include "DWriteGlyphMetrics.h"
+#include "../core/Logger.h"
+#include <cwchar>
+#include <vector>
+
+namespace graphics {
+
+namespace {
+
+/// @brief 書体名から IDWriteFontFace を作る
+bool LoadFace(IDWriteFontCollection *collection, const wchar_t *family,
+              ComPtr<IDWriteFontFace> &face, DWRITE_FONT_METRICS &metrics) {
+  UINT32 index = 0;
+  BOOL exists = FALSE;
+  if (FAILED(collection->FindFamilyName(family, &index, &exists)) ||
+      !exists) {
+    return false;
+  }
+  ComPtr<IDWriteFontFamily> fontFamily;
+  ComPtr<IDWriteFont> font;
+  if (FAILED(collection->GetFontFamily(index, &fontFamily)) ||
+      FAILED(fontFamily->GetFirstMatchingFont(
+          DWRITE_FONT_WEIGHT_NORMAL, DWRITE_FONT_STRETCH_NORMAL,
+          DWRITE_FONT_STYLE_NORMAL, &font)) ||
+      FAILED(font->CreateFontFace(&face))) {
+    return false;
+  }
+  face->GetMetrics(&metrics);
+  return metrics.designUnitsPerEm > 0;
+}
+
+/// @brief 書体名を指紋に混ぜる（FNV-1a）
+uint64_t HashName(uint64_t h, const wchar_t *name) {
+  for (size_t i = 0, n = std::wcslen(name); i < n; ++i) {
+    h = (h ^ static_cast<uint64_t>(name[i])) * 0x100000001b3ull;
+  }
+  return (h ^ 0xFFu) * 0x100000001b3ull; // 名前の区切り
+}
+
+} // namespace
+
+bool DWriteGlyphMetrics::Initialize(IDWriteFactory *factory,
+                                    const wchar_t *titleFamily,
+                                    const wchar_t *bodyFamily) {
+  ComPtr<IDWriteFontCollection> collection;
+  if (!factory || FAILED(factory->GetSystemFontCollection(&collection))) {
+    LOG_ERROR("GlyphMetrics", "Failed to get system font collection");
+    return false;
+  }
+  if (!LoadFace(collection.Get(), titleFamily, m_faces[0].face,
+                m_faces[0].metrics) ||
+      !LoadFace(collection.Get(), bodyFamily, m_faces[1].face,
+                m_faces[1].metrics)) {
+    LOG_ERROR("GlyphMetrics", "Font family not found");
+    return false;
+  }
+  m_fingerprint = HashName(HashName(0x445752495445ull, titleFamily),
+                           bodyFamily); // "DWRITE"
+  return true;
+}
+
+void DWriteGlyphMetrics::GetAdvances(ArticleFont font, const char32_t *chars,
+                                     size_t count, float fontSize,
+                                     float *advances) const {
+  if (count == 0) {
+    return;
+  }
+  std::vector<UINT32> codePoints(chars, chars + count);
+  std::vector<UINT16> glyphs(count);
+  std::vector<DWRITE_GLYPH_METRICS> glyphMetrics(count);
+
+  // 改行・ゼロ幅文字・タブは寸法表で決め、残りは負の値で「未計測」にする
+  for (size_t i = 0; i < count; ++i) {
+    const float table = TableGlyphMetrics::AdvanceEm(chars[i]);
+    advances[i] = (table == 0.0f || chars[i] == U'\t') ? table * fontSize
+                                                       : -1.0f;
+  }
+
+  // 書体にない文字（グリフ 0）は本文の書体、それでもなければ寸法表で測る
+  auto measure = [&](const Face &face) {
+    face.face->GetGlyphIndices(codePoints.data(), static_cast<UINT32>(count),
+                               glyphs.data());
+    face.face->GetDesignGlyphMetrics(glyphs.data(), static_cast<UINT32>(count),
+                                     glyphMetrics.data(), FALSE);
+    const float scale = fontSize / face.metrics.designUnitsPerEm;
+    for (size_t i = 0; i < count; ++i) {
+      if (advances[i] < 0.0f && glyphs[i] != 0) {
+        advances[i] = glyphMetrics[i].advanceWidth * scale;
+      }
+    }
+  };
+  measure(GetFace(font));
+  if (font != ArticleFont::Body) {
+    measure(GetFace(ArticleFont::Body));
+  }
+  for (size_t i = 0; i < count; ++i) {
+    if (advances[i] < 0.0f) {
+      advances[i] = TableGlyphMetrics::AdvanceEm(chars[i]) * fontSize;
+    }
+  }
+}
+
+FontVerticalMetrics DWriteGlyphMetrics::GetVerticalMetrics(
+    ArticleFont font) const {
+  const Face &face = GetFace(font);
+  const float em = static_cast<float>(face.metrics.designUnitsPerEm);
+  FontVerticalMetrics m;
+  m.ascent = face.metrics.ascent / em;
+  m.descent = face.metrics.descent / em;
+  m.lineGap = face.metrics.lineGap / em;
+  return m;
+}
+
+} // namespace graphics
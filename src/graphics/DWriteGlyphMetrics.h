@@ -0,0 +1,53 @@
+#pragma once
+/**
+ * @file DWriteGlyphMetrics.h
+ * @brief DirectWrite のフォントから求めるグリフ寸法
+ */
+
+#include "GlyphMetrics.h"
+#include <dwrite.h>
+#include <wrl/client.h>
+
+namespace graphics {
+
+using Microsoft::WRL::ComPtr;
+
+/// @brief システムフォントのデザイン寸法によるグリフ寸法
+/// @details 書体ごとに IDWriteFontFace を1つ持ち、GetGlyphIndices と
+///          GetDesignGlyphMetrics で送り幅を求める。書体にない文字は本文の
+///          書体で、それにもなければ同梱の寸法表で測る。
+///          IDWriteFontFace は共有ファクトリのものなので、どのスレッドから
+///          呼んでもよい。
+class DWriteGlyphMetrics final : public GlyphMetricsProvider {
+public:
+  /// @param titleFamily タイトルの書体名（例: L"Georgia"）
+  /// @param bodyFamily 本文の書体名（例: L"Meiryo"）
+  /// @return どちらかの書体が見つからなければ false
+  bool Initialize(IDWriteFactory *factory, const wchar_t *titleFamily,
+                  const wchar_t *bodyFamily);
+
+  void GetAdvances(ArticleFont font, const char32_t *chars, size_t count,
+                   float fontSize, float *advances) const override;
+  FontVerticalMetrics GetVerticalMetrics(ArticleFont font) const override;
+  uint64_t GetFingerprint() const override { return m_fingerprint; }
+
+  /// @brief 書体のフォントフェイス（アウトラインの取得にも使う）
+  IDWriteFontFace *GetFontFace(ArticleFont font) const {
+    return GetFace(font).face.Get();
+  }
+
+private:
+  struct Face {
+    ComPtr<IDWriteFontFace> face;
+    DWRITE_FONT_METRICS metrics = {};
+  };
+
+  const Face &GetFace(ArticleFont font) const {
+    return m_faces[font == ArticleFont::Title ? 0 : 1];
+  }
+
+  Face m_faces[2]; ///< [0] タイトル、[1] 本文
+  uint64_t m_fingerprint = 0;
+};
+
+} // namespace graphics
@@ -0,0 +1,108 @@
+/**
+ * @file DWriteGlyphOutlines.cpp
+ * @brief DirectWrite のフォントから取るグリフのアウトラインの実装
+ */
+
+#include "DWriteGlyphOutlines.h"
+#include <d2d1.h>
+
+namespace graphics {
+
+namespace {
+
+/// @brief 曲線1本あたりの分割数（em 1 で 32px 程度なら十分滑らか）
+constexpr int kBezierSteps = 8;
+
+/// @brief アウトラインを折れ線で受け取るシンク（スタック上でだけ使う）
+class FlatteningSink final : public IDWriteGeometrySink {
+public:
+  explicit FlatteningSink(GlyphOutline &outline) : m_outline(outline) {}
+
+  // IUnknown（寿命は呼び出し側が持つので参照カウントはしない）
+  HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid,
+                                           void **object) override {
+    if (riid == __uuidof(IUnknown) ||
+        riid == __uuidof(ID2D1SimplifiedGeometrySink)) {
+      *object = static_cast<IDWriteGeometrySink *>(this);
+      return S_OK;
+    }
+    *object = nullptr;
+    return E_NOINTERFACE;
+  }
+  ULONG STDMETHODCALLTYPE AddRef() override { return 1; }
+  ULONG STDMETHODCALLTYPE Release() override { return 1; }
+
+  void STDMETHODCALLTYPE SetFillMode(D2D1_FILL_MODE) override {}
+  void STDMETHODCALLTYPE SetSegmentFlags(D2D1_PATH_SEGMENT) override {}
+
+  void STDMETHODCALLTYPE BeginFigure(D2D1_POINT_2F start,
+                                     D2D1_FIGURE_BEGIN) override {
+    m_outline.contours.emplace_back();
+    Add(start);
+  }
+
+  void STDMETHODCALLTYPE AddLines(const D2D1_POINT_2F *points,
+                                  UINT32 count) override {
+    for (UINT32 i = 0; i < count; ++i) {
+      Add(points[i]);
+    }
+  }
+
+  void STDMETHODCALLTYPE AddBeziers(const D2D1_BEZIER_SEGMENT *beziers,
+                                    UINT32 count) override {
+    for (UINT32 i = 0; i < count; ++i) {
+      const D2D1_BEZIER_SEGMENT &b = beziers[i];
+      const D2D1_POINT_2F p0 = m_last;
+      for (int step = 1; step <= kBezierSteps; ++step) {
+        const float t = static_cast<float>(step) / kBezierSteps;
+        const float s = 1.0f - t;
+        const float w0 = s * s * s, w1 = 3.0f * s * s * t;
+        const float w2 = 3.0f * s * t * t, w3 = t * t * t;
+        Add({w0 * p0.x + w1 * b.point1.x + w2 * b.point2.x + w3 * b.point3.x,
+             w0 * p0.y + w1 * b.point1.y + w2 * b.point2.y + w3 * b.point3.y});
+      }
+    }
+  }
+
+  void STDMETHODCALLTYPE EndFigure(D2D1_FIGURE_END) override {}
+  HRESULT STDMETHODCALLTYPE Close() override { return S_OK; }
+
+private:
+  /// @brief DirectWrite は y が下向きなので反転して足す
+  void Add(D2D1_POINT_2F p) {
+    m_last = p;
+    m_outline.contours.back().push_back({p.x, -p.y});
+  }
+
+  GlyphOutline &m_outline;
+  D2D1_POINT_2F m_last = {};
+};
+
+} // namespace
+
+bool DWriteGlyphOutlines::GetOutline(ArticleFont font, char32_t c,
+                                     GlyphOutline &outline) const {
+  outline.contours.clear();
+  const UINT32 codePoint = c;
+  IDWriteFontFace *face = m_metrics.GetFontFace(font);
+  UINT16 glyph = 0;
+  if (face) {
+    face->GetGlyphIndices(&codePoint, 1, &glyph);
+  }
+  if (glyph == 0 && font != ArticleFont::Body) {
+    face = m_metrics.GetFontFace(ArticleFont::Body);
+    if (face) {
+      face->GetGlyphIndices(&codePoint, 1, &glyph);
+    }
+  }
+  if (!face || glyph == 0) {
+    return false;
+  }
+
+  // emSize = 1 で取ると座標がそのまま em 単位になる
+  FlatteningSink sink(outline);
+  return SUCCEEDED(face->GetGlyphRunOutline(1.0f, &glyph, nullptr, nullptr, 1,
+                                            FALSE, FALSE, &sink));
+}
+
+} // namespace graphics
@@ -0,0 +1,28 @@
+#pragma once
+/**
+ * @file DWriteGlyphOutlines.h
+ * @brief DirectWrite のフォントから取るグリフのアウトライン
+ */
+
+#include "DWriteGlyphMetrics.h"
+#include "SdfGlyphAtlas.h"
+
+namespace graphics {
+
+/// @brief IDWriteFontFace::GetGlyphRunOutline によるアウトライン
+/// @details ベジェ曲線は一定の分割数で折れ線にする。書体にない文字は
+///          本文の書体から取る（DWriteGlyphMetrics と同じ代替）。
+class DWriteGlyphOutlines final : public GlyphOutlineProvider {
+public:
+  /// @param metrics 書体を共有する。これより長く生きること
+  explicit DWriteGlyphOutlines(const DWriteGlyphMetrics &metrics)
+      : m_metrics(metrics) {}
+
+  bool GetOutline(ArticleFont font, char32_t c,
+                  GlyphOutline &outline) const override;
+
+private:
+  const DWriteGlyphMetrics &m_metrics;
+};
+
+} // namespace graphics
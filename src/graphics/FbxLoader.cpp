@@ -73,24 +73,39 @@ static void ProcessMesh(const aiMesh *mesh, std::vector<Vertex> &outVertices,
 /// @param scene シーン全体
 /// @param outVertices 頂点出力先
 /// @param outIndices インデックス出力先
+/// @param outSubmeshes メッシュごとの範囲の出力先（nullptr 可）
 static void ProcessNode(const aiNode *node, const aiScene *scene,
                         std::vector<Vertex> &outVertices,
-                        std::vector<uint32_t> &outIndices) {
+                        std::vector<uint32_t> &outIndices,
+                        std::vector<Submesh> *outSubmeshes) {
   // このノードが持つメッシュを処理
   for (unsigned int i = 0; i < node->mNumMeshes; i++) {
     const aiMesh *mesh = scene->mMeshes[node->mMeshes[i]];
     uint32_t baseIndex = static_cast<uint32_t>(outVertices.size());
+    const uint32_t indexOffset = static_cast<uint32_t>(outIndices.size());
     ProcessMesh(mesh, outVertices, outIndices, baseIndex);
+    if (outSubmeshes) {
+      Submesh submesh;
+      submesh.indexOffset = indexOffset;
+      submesh.indexCount =
+          static_cast<uint32_t>(outIndices.size()) - indexOffset;
+      submesh.vertexOffset = baseIndex;
+      submesh.vertexCount =
+          static_cast<uint32_t>(outVertices.size()) - baseIndex;
+      outSubmeshes->push_back(submesh);
+    }
   }
 
   // 子ノードを再帰処理
   for (unsigned int i = 0; i < node->mNumChildren; i++) {
-    ProcessNode(node->mChildren[i], scene, outVertices, outIndices);
+    ProcessNode(node->mChildren[i], scene, outVertices, outIndices,
+                outSubmeshes);
   }
 }
 
 bool FbxLoader::Load(const std::string &path, std::vector<Vertex> &outVertices,
-                     std::vector<uint32_t> &outIndices) {
+                     std::vector<uint32_t> &outIndices,
+                     std::vector<Submesh> *outSubmeshes) {
   Assimp::Importer importer;
 
   // インポート設定
@@ -112,9 +127,12 @@ bool FbxLoader::Load(const std::string &path, std::vector<Vertex> &outVertices,
 
   outVertices.clear();
   outIndices.clear();
+  if (outSubmeshes) {
+    outSubmeshes->clear();
+  }
 
   // ルートノードから再帰的に処理
-  ProcessNode(scene->mRootNode, scene, outVertices, outIndices);
+  ProcessNode(scene->mRootNode, scene, outVertices, outIndices, outSubmeshes);
 
   ComputeTangents(outVertices, outIndices);
 
@@ -18,9 +18,11 @@ public:
   /// @param path ファイルパス
   /// @param outVertices 頂点データの出力先
   /// @param outIndices インデックスデータの出力先
+  /// @param outSubmeshes Assimp のメッシュごとの範囲（不要なら nullptr）
   /// @return 成功時 true
   static bool Load(const std::string &path, std::vector<Vertex> &outVertices,
-                   std::vector<uint32_t> &outIndices);
+                   std::vector<uint32_t> &outIndices,
+                   std::vector<Submesh> *outSubmeshes = nullptr);
 };
 
 } // namespace graphics
@@ -0,0 +1,85 @@
+/**
+ * @file GlyphMetrics.cpp
+ * @brief 同梱のグリフ寸法表
+ */
+
+#include "GlyphMetrics.h"
+
+namespace graphics {
+
+namespace {
+
+/// @brief U+0020〜U+007E の送り幅（1/1000 em、Helvetica 系の値）
+constexpr uint16_t kAsciiAdvance[95] = {
+    278, 278, 355, 556, 556, 889, 667, 191, 333, 333, 389, 584, 278, 333,
+    278, 278, 556, 556, 556, 556, 556, 556, 556, 556, 556, 556, 278, 278,
+    584, 584, 584, 556, 1015, 667, 667, 722, 722, 667, 611, 778, 722, 278,
+    500, 667, 556, 833, 722, 778, 667, 778, 722, 667, 611, 722, 667, 944,
+    667, 667, 611, 278, 278, 278, 469, 556, 333, 556, 556, 500, 556, 556,
+    278, 556, 556, 222, 222, 500, 222, 833, 556, 556, 556, 556, 333, 500,
+    278, 556, 500, 722, 500, 500, 500, 334, 260, 334, 584,
+};
+
+/// @brief 幅を持たない文字（結合文字・ゼロ幅の制御文字・改行）
+bool IsZeroWidth(char32_t c) {
+  return c == U'\n' || c == U'\r' || (c >= 0x0300 && c <= 0x036F) ||
+         (c >= 0x200B && c <= 0x200F) || (c >= 0xFE00 && c <= 0xFE0F) ||
+         c == 0xFEFF || (c >= 0x3099 && c <= 0x309A);
+}
+
+} // namespace
+
+bool IsWideCharacter(char32_t c) {
+  return (c >= 0x1100 && c <= 0x115F) || (c >= 0x2E80 && c <= 0x303E) ||
+         (c >= 0x3041 && c <= 0x33FF) || (c >= 0x3400 && c <= 0x4DBF) ||
+         (c >= 0x4E00 && c <= 0x9FFF) || (c >= 0xA000 && c <= 0xA4CF) ||
+         (c >= 0xAC00 && c <= 0xD7A3) || (c >= 0xF900 && c <= 0xFAFF) ||
+         (c >= 0xFE30 && c <= 0xFE4F) || (c >= 0xFF00 && c <= 0xFF60) ||
+         (c >= 0xFFE0 && c <= 0xFFE6) || (c >= 0x20000 && c <= 0x3FFFD);
+}
+
+float TableGlyphMetrics::AdvanceEm(char32_t c) {
+  if (c >= 0x20 && c <= 0x7E) {
+    return kAsciiAdvance[c - 0x20] * 0.001f;
+  }
+  if (c == U'\t') {
+    return 4.0f * kAsciiAdvance[0] * 0.001f;
+  }
+  if (IsZeroWidth(c)) {
+    return 0.0f;
+  }
+  if (IsWideCharacter(c)) {
+    return 1.0f;
+  }
+  if (c >= 0xFF61 && c <= 0xFF9F) {
+    return 0.5f; // 半角カナ
+  }
+  return 0.6f;
+}
+
+void TableGlyphMetrics::GetAdvances(ArticleFont, const char32_t *chars,
+                                    size_t count, float fontSize,
+                                    float *advances) const {
+  for (size_t i = 0; i < count; ++i) {
+    advances[i] = AdvanceEm(chars[i]) * fontSize;
+  }
+}
+
+FontVerticalMetrics TableGlyphMetrics::GetVerticalMetrics(
+    ArticleFont font) const {
+  FontVerticalMetrics m;
+  if (font == ArticleFont::Title) {
+    m.ascent = 0.917f; // Georgia
+    m.descent = 0.219f;
+  } else {
+    m.ascent = 1.055f; // メイリオ
+    m.descent = 0.445f;
+  }
+  return m;
+}
+
+uint64_t TableGlyphMetrics::GetFingerprint() const {
+  return 0x5441424C45000001ull; // "TABLE" + 版
+}
+
+} // namespace graphics
@@ -0,0 +1,69 @@
+#pragma once
+/**
+ * @file GlyphMetrics.h
+ * @brief レイアウト用のグリフ寸法（フォント実装から独立）
+ */
+
+#include <cstddef>
+#include <cstdint>
+
+namespace graphics {
+
+/// @brief 記事で使う書体の役割
+enum class ArticleFont : uint8_t {
+  Title, ///< 記事タイトル（セリフ体）
+  Body,  ///< 本文・見出し・リンク
+};
+
+/// @brief 全角幅で表示する文字（CJK・かな・ハングル・全角記号）か
+bool IsWideCharacter(char32_t c);
+
+/// @brief 縦方向の寸法（1em あたり）
+struct FontVerticalMetrics {
+  float ascent = 0.8f;
+  float descent = 0.2f;
+  float lineGap = 0.0f;
+
+  /// @brief 行の高さ（1em あたり）
+  float LineHeight() const { return ascent + descent + lineGap; }
+};
+
+/// @brief グリフの寸法を返すインターフェース
+/// @details ArticleLayoutEngine はこれだけを通して文字幅を知る。
+///          DirectWrite 版はゲーム内で、同梱の寸法表版はヘッドレスの
+///          テストとベンチマークで使う。レイアウトを描画スレッド以外から
+///          呼べるよう、実装は const メソッドを並行に呼ばれても安全にする。
+class GlyphMetricsProvider {
+public:
+  virtual ~GlyphMetricsProvider() = default;
+
+  /// @brief 文字ごとの送り幅（ピクセル）をまとめて求める
+  /// @param advances count 要素に書き込む
+  virtual void GetAdvances(ArticleFont font, const char32_t *chars,
+                           size_t count, float fontSize,
+                           float *advances) const = 0;
+
+  virtual FontVerticalMetrics GetVerticalMetrics(ArticleFont font) const = 0;
+
+  /// @brief レイアウトキャッシュのキーに混ぜる値（寸法が変われば変える）
+  virtual uint64_t GetFingerprint() const = 0;
+};
+
+/// @brief 同梱の寸法表によるグリフ寸法
+/// @details ASCII はプロポーショナルなサンセリフ体の送り幅の表、
+///          CJK・全角は 1em、半角カナは 0.5em、結合文字やゼロ幅の制御文字は 0、
+///          それ以外は 0.6em とする。縦方向は本文（メイリオ相当）と
+///          タイトル（Georgia 相当）の値を持つ。実フォントに依存しないので
+///          どの環境でも同じレイアウトになる。
+class TableGlyphMetrics final : public GlyphMetricsProvider {
+public:
+  void GetAdvances(ArticleFont font, const char32_t *chars, size_t count,
+                   float fontSize, float *advances) const override;
+  FontVerticalMetrics GetVerticalMetrics(ArticleFont font) const override;
+  uint64_t GetFingerprint() const override;
+
+  /// @brief 1文字の送り幅（1em あたり）
+  static float AdvanceEm(char32_t c);
+};
+
+} // namespace graphics
@@ -4,19 +4,52 @@
  */
 
 #include "Mesh.h"
+#include "CompactVertex.h"
+#include "MeshSimplifier.h"
+#include <algorithm>
 
 namespace graphics {
 
 bool Mesh::Create(ID3D11Device *device, const std::vector<Vertex> &vertices,
                   const std::vector<uint32_t> &indices) {
+  return Create(device, vertices.data(), vertices.size(), indices.data(),
+                indices.size());
+}
+
+bool Mesh::Create(ID3D11Device *device, const Vertex *vertices,
+                  size_t vertexCount, const uint32_t *indices,
+                  size_t indexCount) {
+  if (!CreateBuffers(device, vertices, sizeof(Vertex), vertexCount, indices,
+                     indexCount))
+    return false;
+  m_extent = ComputeMeshExtent(vertices, vertexCount);
+  m_positionTransform = PositionQuantization{}.ToMatrix();
+  return true;
+}
+
+bool Mesh::Create(ID3D11Device *device, const CompactVertex *vertices,
+                  size_t vertexCount, const PositionQuantization &quantization,
+                  const uint32_t *indices, size_t indexCount) {
+  if (!CreateBuffers(device, vertices, sizeof(CompactVertex), vertexCount,
+                     indices, indexCount))
+    return false;
+  // 正規化した位置は [-1, 1] に収まるので、最も長い辺は 2 * scale 以下
+  m_extent = 2.0f * quantization.scale;
+  m_positionTransform = quantization.ToMatrix();
+  return true;
+}
+
+bool Mesh::CreateBuffers(ID3D11Device *device, const void *vertices,
+                         uint32_t stride, size_t vertexCount,
+                         const uint32_t *indices, size_t indexCount) {
   // 頂点バッファ作成
   D3D11_BUFFER_DESC vbDesc = {};
   vbDesc.Usage = D3D11_USAGE_DEFAULT;
-  vbDesc.ByteWidth = static_cast<UINT>(sizeof(Vertex) * vertices.size());
+  vbDesc.ByteWidth = static_cast<UINT>(stride * vertexCount);
   vbDesc.BindFlags = D3D11_BIND_VERTEX_BUFFER;
 
   D3D11_SUBRESOURCE_DATA vbData = {};
-  vbData.pSysMem = vertices.data();
+  vbData.pSysMem = vertices;
 
   HRESULT hr = device->CreateBuffer(&vbDesc, &vbData, &m_vertexBuffer);
   if (FAILED(hr))
@@ -25,17 +58,19 @@ bool Mesh::Create(ID3D11Device *device, const std::vector<Vertex> &vertices,
   // インデックスバッファ作成
   D3D11_BUFFER_DESC ibDesc = {};
   ibDesc.Usage = D3D11_USAGE_DEFAULT;
-  ibDesc.ByteWidth = static_cast<UINT>(sizeof(uint32_t) * indices.size());
+  ibDesc.ByteWidth = static_cast<UINT>(sizeof(uint32_t) * indexCount);
   ibDesc.BindFlags = D3D11_BIND_INDEX_BUFFER;
 
   D3D11_SUBRESOURCE_DATA ibData = {};
-  ibData.pSysMem = indices.data();
+  ibData.pSysMem = indices;
 
   hr = device->CreateBuffer(&ibDesc, &ibData, &m_indexBuffer);
   if (FAILED(hr))
     return false;
 
-  m_indexCount = static_cast<uint32_t>(indices.size());
+  m_stride = stride;
+  m_indexCount = static_cast<uint32_t>(indexCount);
+  m_lods.assign(1, MeshLod{0, m_indexCount, 0.0f});
   return true;
 }
 
@@ -46,8 +81,31 @@ void Mesh::Bind(ID3D11DeviceContext *context) const {
   context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
 }
 
-void Mesh::Draw(ID3D11DeviceContext *context) const {
-  context->DrawIndexed(m_indexCount, 0, 0);
+void Mesh::Draw(ID3D11DeviceContext *context) const { Draw(context, 0); }
+
+void Mesh::Draw(ID3D11DeviceContext *context, uint32_t lod) const {
+  if (m_lods.empty()) {
+    return;
+  }
+  const MeshLod &range = m_lods[std::min<size_t>(lod, m_lods.size() - 1)];
+  context->DrawIndexed(range.indexCount, range.indexOffset, 0);
+}
+
+bool Mesh::SetLods(const std::vector<MeshLod> &lods) {
+  if (lods.empty()) {
+    return false;
+  }
+  for (const MeshLod &lod : lods) {
+    if (uint64_t{lod.indexOffset} + lod.indexCount > m_indexCount) {
+      return false;
+    }
+  }
+  m_lods = lods;
+  return true;
+}
+
+uint32_t Mesh::SelectLod(float screenSize) const {
+  return SelectMeshLod(m_lods.data(), m_lods.size(), screenSize);
 }
 
 // Primitives moved to MeshPrimitives.cpp
@@ -14,6 +14,9 @@ namespace graphics {
 
 using Microsoft::WRL::ComPtr;
 
+struct CompactVertex;
+struct PositionQuantization;
+
 /// @brief 頂点構造体
 struct Vertex {
   DirectX::XMFLOAT3 position;
@@ -24,6 +27,21 @@ struct Vertex {
   DirectX::XMFLOAT3 bitangent{0.0f, 1.0f, 0.0f};
 };
 
+/// @brief 1つのメッシュの中の描画単位（FBX のメッシュノード1つ分など）
+struct Submesh {
+  uint32_t indexOffset = 0;
+  uint32_t indexCount = 0;
+  uint32_t vertexOffset = 0; ///< インデックスはメッシュ全体の頂点番号
+  uint32_t vertexCount = 0;
+};
+
+/// @brief 簡略化した LOD 1段分（同じインデックスバッファの中の範囲）
+struct MeshLod {
+  uint32_t indexOffset = 0;
+  uint32_t indexCount = 0;
+  float error = 0.0f; ///< 元の形からのずれ（メッシュの大きさに対する割合）
+};
+
 /// @brief メッシュクラス
 class Mesh {
 public:
@@ -34,22 +52,74 @@ public:
   bool Create(ID3D11Device *device, const std::vector<Vertex> &vertices,
               const std::vector<uint32_t> &indices);
 
+  /// @brief メッシュを作成（マップしたキャッシュなど、配列以外から）
+  bool Create(ID3D11Device *device, const Vertex *vertices,
+              size_t vertexCount, const uint32_t *indices, size_t indexCount);
+
+  /**
+   * @brief 量子化した頂点（CompactVertex.h）でメッシュを作成
+   * @details 入力レイアウトは GetCompactInputLayout、頂点シェーダーは
+   *          CompactVS.hlsl を使う。位置は GetPositionTransform で戻す。
+   */
+  bool Create(ID3D11Device *device, const CompactVertex *vertices,
+              size_t vertexCount, const PositionQuantization &quantization,
+              const uint32_t *indices, size_t indexCount);
+
   /// @brief 描画用にバインド
   void Bind(ID3D11DeviceContext *context) const;
 
-  /// @brief 描画
+  /// @brief 描画（LOD0）
   void Draw(ID3D11DeviceContext *context) const;
 
+  /// @brief 指定した LOD で描画
+  void Draw(ID3D11DeviceContext *context, uint32_t lod) const;
+
+  /**
+   * @brief LOD の範囲を設定（BuildMeshLods の結果など）
+   * @details 範囲は Create で渡したインデックスの中。Create 直後は全体が
+   *          LOD0 の1段だけ。
+   * @return 範囲外を含むなら false（変更しない）
+   */
+  bool SetLods(const std::vector<MeshLod> &lods);
+
+  /// @brief 画面上の大きさ（ピクセル、GetExtent の投影）から LOD を選ぶ
+  uint32_t SelectLod(float screenSize) const;
+
+  /// @brief LOD の段数
+  uint32_t GetLodCount() const { return static_cast<uint32_t>(m_lods.size()); }
+
+  /// @brief 境界ボックスの最も長い辺（LOD の誤差の単位）
+  float GetExtent() const { return m_extent; }
+
+  /// @brief 頂点の位置を元の座標へ戻す行列（ワールド行列の左から掛ける）。
+  ///        Vertex で作ったメッシュは単位行列
+  const DirectX::XMFLOAT4X4 &GetPositionTransform() const {
+    return m_positionTransform;
+  }
+
+  /// @brief 頂点1つのバイト数（Vertex なら 72、CompactVertex なら 24）
+  uint32_t GetStride() const { return m_stride; }
+
   /// @brief 有効かどうか
   bool IsValid() const { return m_vertexBuffer && m_indexBuffer; }
 
-  /// @brief インデックス数
+  /// @brief インデックス数（LOD を足したときはその分も含む）
   uint32_t GetIndexCount() const { return m_indexCount; }
 
 private:
+  bool CreateBuffers(ID3D11Device *device, const void *vertices,
+                     uint32_t stride, size_t vertexCount,
+                     const uint32_t *indices, size_t indexCount);
+
   ComPtr<ID3D11Buffer> m_vertexBuffer;
   ComPtr<ID3D11Buffer> m_indexBuffer;
   uint32_t m_indexCount = 0;
+  std::vector<MeshLod> m_lods;
+  float m_extent = 0.0f;
+  DirectX::XMFLOAT4X4 m_positionTransform{1.0f, 0.0f, 0.0f, 0.0f, //
+                                          0.0f, 1.0f, 0.0f, 0.0f, //
+                                          0.0f, 0.0f, 1.0f, 0.0f, //
+                                          0.0f, 0.0f, 0.0f, 1.0f};
   uint32_t m_stride = sizeof(Vertex);
   uint32_t m_offset = 0;
 };
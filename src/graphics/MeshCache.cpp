@@ -0,0 +1,315 @@
+/**
+ * @file MeshCache.cpp
+ * @brief 前処理済みメッシュファイルの実装
+ */
+
+#include "MeshCache.h"
+#include "MeshSimplifier.h"
+#include "../core/Hash.h"
+#include "../core/MappedFile.h"
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <system_error>
+#include <type_traits>
+
+namespace graphics {
+
+namespace {
+
+constexpr char kMagic[4] = {'W', 'G', 'M', 'S'};
+constexpr uint32_t kFormatVersion = 2;
+constexpr uint64_t kChecksumSeed = 0x5754474300000003ull;
+/// @brief 読み込み側（ObjLoader・FbxLoader・OptimizeMesh）の出力が
+///        変わったら上げる
+constexpr uint64_t kSourceHashSeed = 0x574d534800000002ull;
+
+/// @brief ファイル先頭。続けてサブメッシュ、LOD、頂点（16 バイト境界）、
+///        インデックス（全 LOD 分）の順に並ぶ
+struct FileHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t headerBytes;
+  uint32_t vertexStride; ///< sizeof(Vertex)。頂点の形が変わったら読まない
+  uint32_t vertexCount;
+  uint32_t indexCount;
+  uint32_t submeshCount;
+  uint32_t lodCount;
+  float boundsMin[3];
+  float boundsMax[3];
+  uint64_t sourceHash;
+  uint64_t payloadBytes;
+  uint64_t payloadChecksum;
+  uint64_t reserved2;
+  uint64_t headerChecksum; ///< この手前までのチェックサム
+};
+
+static_assert(std::is_trivially_copyable_v<FileHeader>);
+static_assert(sizeof(FileHeader) % 16 == 0);
+static_assert(std::is_trivially_copyable_v<Vertex>);
+static_assert(std::is_trivially_copyable_v<Submesh>);
+static_assert(std::is_trivially_copyable_v<MeshLod>);
+
+/// @brief ペイロード内の各配列の位置
+struct Layout {
+  size_t submeshOffset = 0;
+  size_t lodOffset = 0;
+  size_t vertexOffset = 0;
+  size_t indexOffset = 0;
+  size_t payloadBytes = 0;
+};
+
+Layout LayoutFor(uint64_t vertexCount, uint64_t indexCount,
+                 uint64_t submeshCount, uint64_t lodCount) {
+  Layout layout;
+  layout.lodOffset = submeshCount * sizeof(Submesh);
+  const size_t tableBytes = layout.lodOffset + lodCount * sizeof(MeshLod);
+  layout.vertexOffset = (tableBytes + 15) & ~size_t{15};
+  layout.indexOffset = layout.vertexOffset + vertexCount * sizeof(Vertex);
+  layout.payloadBytes = layout.indexOffset + indexCount * sizeof(uint32_t);
+  return layout;
+}
+
+bool SubmeshInRange(const Submesh &s, uint64_t vertexCount,
+                    uint64_t indexCount) {
+  return uint64_t{s.indexOffset} + s.indexCount <= indexCount &&
+         uint64_t{s.vertexOffset} + s.vertexCount <= vertexCount;
+}
+
+bool LodInRange(const MeshLod &lod, uint64_t indexCount) {
+  return uint64_t{lod.indexOffset} + lod.indexCount <= indexCount &&
+         lod.indexCount % 3 == 0;
+}
+
+} // namespace
+
+std::filesystem::path MeshCachePathFor(const std::string &source) {
+  return std::filesystem::path(source + kMeshCacheExtension);
+}
+
+bool HashMeshSource(const std::filesystem::path &source, uint64_t &hash) {
+  core::MappedFile file;
+  if (!file.Open(source)) {
+    return false;
+  }
+  hash = core::HashBytes(file.Data(), file.Size(),
+                         kSourceHashSeed ^ kFormatVersion);
+  return true;
+}
+
+bool EncodeMeshCache(const std::vector<Vertex> &vertices,
+                     const std::vector<uint32_t> &indices,
+                     const std::vector<Submesh> &submeshes,
+                     const std::vector<MeshLod> &lods, uint64_t sourceHash,
+                     std::vector<uint8_t> &out) {
+  constexpr size_t kMaxCount = std::numeric_limits<uint32_t>::max();
+  if (vertices.size() > kMaxCount || indices.size() > kMaxCount ||
+      submeshes.size() > kMaxCount || lods.size() > kMaxCount) {
+    return false;
+  }
+  const uint32_t vertexCount = static_cast<uint32_t>(vertices.size());
+  const uint32_t indexCount = static_cast<uint32_t>(indices.size());
+  for (uint32_t index : indices) {
+    if (index >= vertexCount) {
+      return false;
+    }
+  }
+  std::vector<MeshLod> levels = lods;
+  if (levels.empty()) {
+    levels.push_back({0, indexCount, 0.0f});
+  }
+  for (const MeshLod &lod : levels) {
+    if (!LodInRange(lod, indexCount)) {
+      return false;
+    }
+  }
+  std::vector<Submesh> parts = submeshes;
+  if (parts.empty()) {
+    parts.push_back({0, levels.front().indexCount, 0, vertexCount});
+  }
+  for (const Submesh &s : parts) {
+    if (!SubmeshInRange(s, vertexCount, indexCount)) {
+      return false;
+    }
+  }
+
+  FileHeader h{};
+  if (!vertices.empty()) {
+    const DirectX::XMFLOAT3 &first = vertices.front().position;
+    float lo[3] = {first.x, first.y, first.z};
+    float hi[3] = {first.x, first.y, first.z};
+    for (const Vertex &v : vertices) {
+      const float p[3] = {v.position.x, v.position.y, v.position.z};
+      for (int axis = 0; axis < 3; ++axis) {
+        lo[axis] = std::min(lo[axis], p[axis]);
+        hi[axis] = std::max(hi[axis], p[axis]);
+      }
+    }
+    std::memcpy(h.boundsMin, lo, sizeof(lo));
+    std::memcpy(h.boundsMax, hi, sizeof(hi));
+  }
+
+  const Layout layout =
+      LayoutFor(vertexCount, indexCount, parts.size(), levels.size());
+  out.assign(sizeof(FileHeader) + layout.payloadBytes, 0);
+  uint8_t *payload = out.data() + sizeof(FileHeader);
+  std::memcpy(payload + layout.submeshOffset, parts.data(),
+              parts.size() * sizeof(Submesh));
+  std::memcpy(payload + layout.lodOffset, levels.data(),
+              levels.size() * sizeof(MeshLod));
+  if (!vertices.empty()) {
+    std::memcpy(payload + layout.vertexOffset, vertices.data(),
+                vertices.size() * sizeof(Vertex));
+  }
+  if (!indices.empty()) {
+    std::memcpy(payload + layout.indexOffset, indices.data(),
+                indices.size() * sizeof(uint32_t));
+  }
+
+  std::memcpy(h.magic, kMagic, sizeof(kMagic));
+  h.version = kFormatVersion;
+  h.headerBytes = sizeof(FileHeader);
+  h.vertexStride = sizeof(Vertex);
+  h.vertexCount = vertexCount;
+  h.indexCount = indexCount;
+  h.submeshCount = static_cast<uint32_t>(parts.size());
+  h.lodCount = static_cast<uint32_t>(levels.size());
+  h.sourceHash = sourceHash;
+  h.payloadBytes = layout.payloadBytes;
+  h.payloadChecksum =
+      core::HashBytes(payload, layout.payloadBytes, kChecksumSeed);
+  h.headerChecksum =
+      core::HashBytes(reinterpret_cast<const uint8_t *>(&h),
+                      offsetof(FileHeader, headerChecksum), kChecksumSeed);
+  std::memcpy(out.data(), &h, sizeof(h));
+  return true;
+}
+
+bool WriteMeshCache(const std::filesystem::path &path,
+                    const std::vector<uint8_t> &bytes) {
+  return core::WriteFileAtomically(path, bytes.data(), bytes.size());
+}
+
+bool MeshCacheView::Parse(const uint8_t *data, size_t size) {
+  *this = MeshCacheView();
+  // 頂点・インデックスをそのまま指すので、先頭が揃っていること
+  // （マップした領域・new の領域なら満たす）
+  if (!data || size < sizeof(FileHeader) ||
+      reinterpret_cast<uintptr_t>(data) % alignof(Vertex) != 0) {
+    return false;
+  }
+  FileHeader h;
+  std::memcpy(&h, data, sizeof(h));
+  const uint64_t headerSum = core::HashBytes(
+      data, offsetof(FileHeader, headerChecksum), kChecksumSeed);
+  if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0 ||
+      h.version != kFormatVersion || h.headerBytes != sizeof(FileHeader) ||
+      h.headerChecksum != headerSum || h.vertexStride != sizeof(Vertex) ||
+      h.submeshCount == 0 || h.lodCount == 0) {
+    return false;
+  }
+  const Layout layout =
+      LayoutFor(h.vertexCount, h.indexCount, h.submeshCount, h.lodCount);
+  const uint8_t *payload = data + sizeof(FileHeader);
+  if (h.payloadBytes != size - sizeof(FileHeader) ||
+      h.payloadBytes != layout.payloadBytes ||
+      core::HashBytes(payload, h.payloadBytes, kChecksumSeed) !=
+          h.payloadChecksum) {
+    return false;
+  }
+  const Submesh *submeshes =
+      reinterpret_cast<const Submesh *>(payload + layout.submeshOffset);
+  for (uint32_t i = 0; i < h.submeshCount; ++i) {
+    if (!SubmeshInRange(submeshes[i], h.vertexCount, h.indexCount)) {
+      return false;
+    }
+  }
+  const MeshLod *lods =
+      reinterpret_cast<const MeshLod *>(payload + layout.lodOffset);
+  for (uint32_t i = 0; i < h.lodCount; ++i) {
+    if (!LodInRange(lods[i], h.indexCount)) {
+      return false;
+    }
+  }
+
+  m_submeshes = submeshes;
+  m_lods = lods;
+  m_vertices = reinterpret_cast<const Vertex *>(payload + layout.vertexOffset);
+  m_indices =
+      reinterpret_cast<const uint32_t *>(payload + layout.indexOffset);
+  m_vertexCount = h.vertexCount;
+  m_indexCount = h.indexCount;
+  m_submeshCount = h.submeshCount;
+  m_lodCount = h.lodCount;
+  m_boundsMin = {h.boundsMin[0], h.boundsMin[1], h.boundsMin[2]};
+  m_boundsMax = {h.boundsMax[0], h.boundsMax[1], h.boundsMax[2]};
+  m_sourceHash = h.sourceHash;
+  return true;
+}
+
+bool OpenMeshCache(const std::string &source, core::MappedFile &file,
+                   MeshCacheView &view) {
+  file.Close();
+  view = MeshCacheView();
+  if (!file.Open(MeshCachePathFor(source)) ||
+      !view.Parse(file.Data(), file.Size())) {
+    file.Close();
+    return false;
+  }
+  std::error_code ec;
+  if (std::filesystem::exists(source, ec)) {
+    uint64_t hash = 0;
+    if (!HashMeshSource(source, hash) || hash != view.GetSourceHash()) {
+      // 書き直せるように先に閉じる（Windows はマップ中のファイルを置換できない）
+      view = MeshCacheView();
+      file.Close();
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ConvertMeshToCache(const std::string &source,
+                        const MeshSourceLoader &loader,
+                        std::vector<Vertex> &vertices,
+                        std::vector<uint32_t> &indices,
+                        std::vector<Submesh> &submeshes, bool *cacheWritten,
+                        const MeshOptimizeSettings *optimize,
+                        std::vector<MeshLod> *lods) {
+  if (cacheWritten) {
+    *cacheWritten = false;
+  }
+  vertices.clear();
+  indices.clear();
+  submeshes.clear();
+  if (lods) {
+    lods->clear();
+  }
+  if (!loader || !loader(source, vertices, indices, submeshes)) {
+    return false;
+  }
+  if (optimize) {
+    OptimizeMesh(vertices, indices, &submeshes, *optimize);
+  }
+  if (lods) {
+    // 頂点の並びを決めた後に作る（LOD は同じ頂点を指すので）
+    if (submeshes.empty()) {
+      submeshes.push_back({0, static_cast<uint32_t>(indices.size()), 0,
+                           static_cast<uint32_t>(vertices.size())});
+    }
+    *lods = BuildMeshLods(vertices, indices);
+  }
+  uint64_t hash = 0;
+  std::vector<uint8_t> bytes;
+  const bool written =
+      HashMeshSource(source, hash) &&
+      EncodeMeshCache(vertices, indices, submeshes,
+                      lods ? *lods : std::vector<MeshLod>(), hash, bytes) &&
+      WriteMeshCache(MeshCachePathFor(source), bytes);
+  if (cacheWritten) {
+    *cacheWritten = written;
+  }
+  return true;
+}
+
+} // namespace graphics
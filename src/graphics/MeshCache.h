@@ -0,0 +1,121 @@
+#pragma once
+/**
+ * @file MeshCache.h
+ * @brief 転送できる形の頂点・インデックスを収めた前処理済みメッシュファイル
+ */
+
+#include "Mesh.h"
+#include "MeshOptimizer.h"
+#include <DirectXMath.h>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace core {
+class MappedFile;
+}
+
+namespace graphics {
+
+/// @brief キャッシュファイルの拡張子（ソースのパスの後ろに付ける）
+inline constexpr const char *kMeshCacheExtension = ".wgmesh";
+
+/// @brief ソースのモデルを読む関数（ObjLoader・FbxLoader などを包む）
+/// @details submeshes を空のまま返したら全体で1つとみなす。
+using MeshSourceLoader = std::function<bool(
+    const std::string &path, std::vector<Vertex> &vertices,
+    std::vector<uint32_t> &indices, std::vector<Submesh> &submeshes)>;
+
+/// @brief ソースのパスに対応するキャッシュのパス（golfball.fbx.wgmesh）
+std::filesystem::path MeshCachePathFor(const std::string &source);
+
+/// @brief ソースファイルの中身のハッシュ（変換の版も混ぜる）
+bool HashMeshSource(const std::filesystem::path &source, uint64_t &hash);
+
+/**
+ * @brief 頂点・インデックスからキャッシュファイルの中身を作る
+ * @details 頂点は Vertex のまま（16 バイト境界）、インデックスは uint32 で
+ *          並べるので、読み込みはマップした領域をそのまま CreateBuffer の
+ *          初期データにできる。境界ボックスもここで求める。
+ * @param submeshes 空なら LOD0 全体で1つ
+ * @param lods indices の中の LOD の範囲（BuildMeshLods）。空なら全体で1つ
+ * @param sourceHash HashMeshSource の値
+ * @return インデックス・サブメッシュ・LOD が範囲外なら false
+ */
+bool EncodeMeshCache(const std::vector<Vertex> &vertices,
+                     const std::vector<uint32_t> &indices,
+                     const std::vector<Submesh> &submeshes,
+                     const std::vector<MeshLod> &lods, uint64_t sourceHash,
+                     std::vector<uint8_t> &out);
+
+/// @brief 一時ファイルへ書いてから置き換える
+bool WriteMeshCache(const std::filesystem::path &path,
+                    const std::vector<uint8_t> &bytes);
+
+/**
+ * @brief マップしたキャッシュファイルを読むビュー（コピーしない）
+ * @details Parse はヘッダとチェックサムを確かめるだけで、頂点・インデックスは
+ *          渡されたメモリを直接指す。メモリはビューより長く生かすこと。
+ */
+class MeshCacheView {
+public:
+  bool Parse(const uint8_t *data, size_t size);
+
+  uint32_t GetVertexCount() const { return m_vertexCount; }
+  uint32_t GetIndexCount() const { return m_indexCount; }
+  uint32_t GetSubmeshCount() const { return m_submeshCount; }
+  uint32_t GetLodCount() const { return m_lodCount; }
+  const Vertex *Vertices() const { return m_vertices; }
+  const uint32_t *Indices() const { return m_indices; }
+  const Submesh *Submeshes() const { return m_submeshes; }
+  const MeshLod *Lods() const { return m_lods; }
+
+  const DirectX::XMFLOAT3 &GetBoundsMin() const { return m_boundsMin; }
+  const DirectX::XMFLOAT3 &GetBoundsMax() const { return m_boundsMax; }
+  uint64_t GetSourceHash() const { return m_sourceHash; }
+
+private:
+  const Vertex *m_vertices = nullptr;
+  const uint32_t *m_indices = nullptr;
+  const Submesh *m_submeshes = nullptr;
+  const MeshLod *m_lods = nullptr;
+  uint32_t m_vertexCount = 0;
+  uint32_t m_indexCount = 0;
+  uint32_t m_submeshCount = 0;
+  uint32_t m_lodCount = 0;
+  DirectX::XMFLOAT3 m_boundsMin{};
+  DirectX::XMFLOAT3 m_boundsMax{};
+  uint64_t m_sourceHash = 0;
+};
+
+/**
+ * @brief ソースのキャッシュをマップして開く
+ * @details ソースがあればその中身のハッシュと比べ、変わっていたら false
+ *          （呼び出し側はソースから読み直す）。ソースがなければキャッシュを
+ *          そのまま使う（キャッシュだけを配布する場合）。
+ */
+bool OpenMeshCache(const std::string &source, core::MappedFile &file,
+                   MeshCacheView &view);
+
+/**
+ * @brief ソースを loader で読み、キャッシュを書き出す（初回読み込み・変換用）
+ * @details 読んだ結果は書き込みに失敗しても返す。
+ * @param cacheWritten キャッシュを書けたか（nullptr 可）
+ * @param optimize 指定すると書き出す前に OptimizeMesh で並べ替える
+ * @param lods 指定すると BuildMeshLods で作った LOD を indices の後ろへ
+ *             足してキャッシュにも入れ、その範囲を返す
+ * @return loader が失敗したら false
+ */
+bool ConvertMeshToCache(const std::string &source,
+                        const MeshSourceLoader &loader,
+                        std::vector<Vertex> &vertices,
+                        std::vector<uint32_t> &indices,
+                        std::vector<Submesh> &submeshes,
+                        bool *cacheWritten = nullptr,
+                        const MeshOptimizeSettings *optimize = nullptr,
+                        std::vector<MeshLod> *lods = nullptr);
+
+} // namespace graphics
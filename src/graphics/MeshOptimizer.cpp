@@ -0,0 +1,459 @@
+/**
+ * @file MeshOptimizer.cpp
+ * @brief メッシュ並べ替えの実装
+ */
+
+#include "MeshOptimizer.h"
+#include "../core/Hash.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+
+namespace graphics {
+
+namespace {
+
+constexpr uint32_t kNone = 0xffffffffu;
+constexpr uint64_t kVertexHashSeed = 0x574d4f5000000001ull;
+
+bool IndicesInRange(const std::vector<uint32_t> &indices, size_t count) {
+  return std::all_of(indices.begin(), indices.end(),
+                     [count](uint32_t index) { return index < count; });
+}
+
+/// @brief FIFO の頂点キャッシュ（入れた時刻で判定し、配列の初期化だけで済ます）
+class FifoCache {
+public:
+  FifoCache(size_t vertexCount, uint32_t cacheSize)
+      : m_insertedAt(vertexCount, 0), m_cacheSize(cacheSize),
+        m_time(cacheSize + 1) {}
+
+  /// @return キャッシュになかった（変換が必要だった）
+  bool Touch(uint32_t vertex) {
+    if (m_time - m_insertedAt[vertex] > m_cacheSize) {
+      m_insertedAt[vertex] = m_time++;
+      return true;
+    }
+    return false;
+  }
+
+  /// @brief 空にする（以降の頂点はすべてミスになる）
+  void Reset() { m_time += m_cacheSize + 1; }
+
+private:
+  std::vector<uint32_t> m_insertedAt;
+  uint32_t m_cacheSize;
+  uint32_t m_time;
+};
+
+/// @brief 三角形の（正規化前の）法線。長さは面積の 2 倍
+DirectX::XMFLOAT3 TriangleNormal(const DirectX::XMFLOAT3 &p0,
+                                 const DirectX::XMFLOAT3 &p1,
+                                 const DirectX::XMFLOAT3 &p2) {
+  const float ax = p1.x - p0.x, ay = p1.y - p0.y, az = p1.z - p0.z;
+  const float bx = p2.x - p0.x, by = p2.y - p0.y, bz = p2.z - p0.z;
+  return {ay * bz - az * by, az * bx - ax * bz, ax * by - ay * bx};
+}
+
+} // namespace
+
+VertexCacheStats AnalyzeVertexCache(const std::vector<uint32_t> &indices,
+                                    size_t vertexCount, uint32_t cacheSize) {
+  VertexCacheStats stats;
+  FifoCache cache(vertexCount, cacheSize);
+  std::vector<uint8_t> used(vertexCount, 0);
+  for (uint32_t index : indices) {
+    if (index >= vertexCount) {
+      continue;
+    }
+    stats.transforms += cache.Touch(index) ? 1 : 0;
+    stats.vertices += used[index] ? 0 : 1;
+    used[index] = 1;
+  }
+  stats.triangles = static_cast<uint32_t>(indices.size() / 3);
+  if (stats.triangles > 0) {
+    stats.acmr = static_cast<float>(stats.transforms) / stats.triangles;
+  }
+  if (stats.vertices > 0) {
+    stats.atvr = static_cast<float>(stats.transforms) / stats.vertices;
+  }
+  return stats;
+}
+
+VertexFetchStats AnalyzeVertexFetch(const std::vector<uint32_t> &indices,
+                                    size_t vertexCount, size_t vertexStride) {
+  constexpr size_t kLineBytes = 64;
+  constexpr size_t kLineCount = 16384 / kLineBytes;
+  VertexFetchStats stats;
+  std::vector<size_t> tags(kLineCount, ~size_t{0});
+  std::vector<uint8_t> used(vertexCount, 0);
+  size_t vertices = 0;
+  for (uint32_t index : indices) {
+    if (index >= vertexCount) {
+      continue;
+    }
+    vertices += used[index] ? 0 : 1;
+    used[index] = 1;
+    const size_t first = index * vertexStride / kLineBytes;
+    const size_t last = ((index + 1) * vertexStride - 1) / kLineBytes;
+    for (size_t line = first; line <= last; ++line) {
+      size_t &tag = tags[line % kLineCount];
+      if (tag != line) {
+        tag = line;
+        stats.bytesFetched += kLineBytes;
+      }
+    }
+  }
+  if (vertices > 0) {
+    stats.overfetch = static_cast<float>(
+        static_cast<double>(stats.bytesFetched) / (vertices * vertexStride));
+  }
+  return stats;
+}
+
+void OptimizeVertexCache(std::vector<uint32_t> &indices, size_t vertexCount,
+                         uint32_t cacheSize, std::vector<uint32_t> *clusters) {
+  if (clusters) {
+    clusters->clear();
+  }
+  const size_t triangleCount = indices.size() / 3;
+  if (triangleCount == 0 || indices.size() % 3 != 0 ||
+      !IndicesInRange(indices, vertexCount)) {
+    return;
+  }
+
+  // 頂点 -> その頂点を使う三角形の一覧
+  std::vector<uint32_t> live(vertexCount, 0);
+  for (uint32_t index : indices) {
+    ++live[index];
+  }
+  std::vector<uint32_t> offsets(vertexCount + 1, 0);
+  for (size_t v = 0; v < vertexCount; ++v) {
+    offsets[v + 1] = offsets[v] + live[v];
+  }
+  std::vector<uint32_t> adjacency(indices.size());
+  {
+    std::vector<uint32_t> cursor(offsets.begin(), offsets.end() - 1);
+    for (size_t i = 0; i < indices.size(); ++i) {
+      adjacency[cursor[indices[i]]++] = static_cast<uint32_t>(i / 3);
+    }
+  }
+
+  std::vector<uint32_t> cacheTime(vertexCount, 0);
+  std::vector<uint8_t> emitted(triangleCount, 0);
+  std::vector<uint32_t> deadEnd;
+  std::vector<uint32_t> candidates;
+  std::vector<uint32_t> out;
+  deadEnd.reserve(indices.size());
+  out.reserve(indices.size());
+  uint32_t time = cacheSize + 1;
+  size_t scan = 0;
+
+  // 行き詰まったら最近使った頂点、それもなければ先頭から探す
+  auto skipDeadEnd = [&]() -> uint32_t {
+    while (!deadEnd.empty()) {
+      const uint32_t v = deadEnd.back();
+      deadEnd.pop_back();
+      if (live[v] > 0) {
+        return v;
+      }
+    }
+    while (scan < vertexCount) {
+      if (live[scan] > 0) {
+        return static_cast<uint32_t>(scan);
+      }
+      ++scan;
+    }
+    return kNone;
+  };
+
+  uint32_t fan = skipDeadEnd();
+  if (clusters) {
+    clusters->push_back(0);
+  }
+  while (fan != kNone) {
+    candidates.clear();
+    for (uint32_t k = offsets[fan]; k < offsets[fan + 1]; ++k) {
+      const uint32_t t = adjacency[k];
+      if (emitted[t]) {
+        continue;
+      }
+      emitted[t] = 1;
+      for (int c = 0; c < 3; ++c) {
+        const uint32_t v = indices[t * 3 + c];
+        out.push_back(v);
+        deadEnd.push_back(v);
+        candidates.push_back(v);
+        --live[v];
+        if (time - cacheTime[v] > cacheSize) {
+          cacheTime[v] = time++;
+        }
+      }
+    }
+
+    // 残りの三角形を出し終えてもキャッシュに残る頂点のうち、最も古いもの
+    uint32_t next = kNone;
+    int64_t bestPriority = -1;
+    for (uint32_t v : candidates) {
+      if (live[v] == 0) {
+        continue;
+      }
+      int64_t priority = 0;
+      const int64_t age = time - cacheTime[v];
+      if (age + 2 * static_cast<int64_t>(live[v]) <= cacheSize) {
+        priority = age;
+      }
+      if (priority > bestPriority) {
+        bestPriority = priority;
+        next = v;
+      }
+    }
+    if (next == kNone) {
+      next = skipDeadEnd();
+      if (next != kNone && clusters) {
+        clusters->push_back(static_cast<uint32_t>(out.size() / 3));
+      }
+    }
+    fan = next;
+  }
+  indices.swap(out);
+}
+
+void OptimizeOverdraw(std::vector<uint32_t> &indices,
+                      const std::vector<Vertex> &vertices,
+                      const std::vector<uint32_t> &clusters, float threshold,
+                      uint32_t cacheSize) {
+  const size_t triangleCount = indices.size() / 3;
+  if (threshold < 1.0f || triangleCount == 0 || indices.size() % 3 != 0 ||
+      !IndicesInRange(indices, vertices.size())) {
+    return;
+  }
+
+  // 境界の整理（先頭 0、昇順、範囲内）
+  std::vector<uint32_t> hard = {0};
+  for (uint32_t start : clusters) {
+    if (start > hard.back() && start < triangleCount) {
+      hard.push_back(start);
+    }
+  }
+  hard.push_back(static_cast<uint32_t>(triangleCount));
+
+  // ACMR が元の threshold 倍に収まる所で細かく分ける。分けた所ではキャッシュが
+  // 空になる前提で数える
+  FifoCache cache(vertices.size(), cacheSize);
+  auto triangleMisses = [&](size_t t) {
+    uint32_t misses = 0;
+    for (int c = 0; c < 3; ++c) {
+      misses += cache.Touch(indices[t * 3 + c]) ? 1 : 0;
+    }
+    return misses;
+  };
+  std::vector<uint32_t> soft;
+  for (size_t h = 0; h + 1 < hard.size(); ++h) {
+    const size_t begin = hard[h];
+    const size_t end = hard[h + 1];
+    cache.Reset();
+    uint32_t misses = 0;
+    for (size_t t = begin; t < end; ++t) {
+      misses += triangleMisses(t);
+    }
+    const float limit = threshold * static_cast<float>(misses) /
+                        static_cast<float>(end - begin);
+
+    cache.Reset();
+    soft.push_back(static_cast<uint32_t>(begin));
+    size_t start = begin;
+    uint32_t clusterMisses = 0;
+    for (size_t t = begin; t < end; ++t) {
+      clusterMisses += triangleMisses(t);
+      if (t + 1 < end && static_cast<float>(clusterMisses) <=
+                             limit * static_cast<float>(t - start + 1)) {
+        soft.push_back(static_cast<uint32_t>(t + 1));
+        start = t + 1;
+        clusterMisses = 0;
+        cache.Reset();
+      }
+    }
+  }
+  soft.push_back(static_cast<uint32_t>(triangleCount));
+  const size_t clusterCount = soft.size() - 1;
+
+  // クラスタごとの面積重み付きの中心と法線
+  struct ClusterShape {
+    double center[3] = {0.0, 0.0, 0.0};
+    double normal[3] = {0.0, 0.0, 0.0};
+    double area = 0.0;
+  };
+  std::vector<ClusterShape> shapes(clusterCount);
+  double meshCenter[3] = {0.0, 0.0, 0.0};
+  double meshArea = 0.0;
+  for (size_t c = 0; c < clusterCount; ++c) {
+    ClusterShape &shape = shapes[c];
+    for (size_t t = soft[c]; t < soft[c + 1]; ++t) {
+      const DirectX::XMFLOAT3 &p0 = vertices[indices[t * 3 + 0]].position;
+      const DirectX::XMFLOAT3 &p1 = vertices[indices[t * 3 + 1]].position;
+      const DirectX::XMFLOAT3 &p2 = vertices[indices[t * 3 + 2]].position;
+      const DirectX::XMFLOAT3 n = TriangleNormal(p0, p1, p2);
+      const double area = std::sqrt(static_cast<double>(n.x) * n.x +
+                                    static_cast<double>(n.y) * n.y +
+                                    static_cast<double>(n.z) * n.z);
+      shape.center[0] += area * (p0.x + p1.x + p2.x) / 3.0;
+      shape.center[1] += area * (p0.y + p1.y + p2.y) / 3.0;
+      shape.center[2] += area * (p0.z + p1.z + p2.z) / 3.0;
+      shape.normal[0] += n.x;
+      shape.normal[1] += n.y;
+      shape.normal[2] += n.z;
+      shape.area += area;
+    }
+    for (int axis = 0; axis < 3; ++axis) {
+      meshCenter[axis] += shape.center[axis];
+    }
+    meshArea += shape.area;
+  }
+  if (meshArea <= 0.0) {
+    return;
+  }
+  for (double &axis : meshCenter) {
+    axis /= meshArea;
+  }
+
+  // 外側を向いたクラスタほど先に描く（手前を先に描いて隠れた面を省く）
+  std::vector<double> keys(clusterCount, 0.0);
+  for (size_t c = 0; c < clusterCount; ++c) {
+    const ClusterShape &shape = shapes[c];
+    const double length = std::sqrt(shape.normal[0] * shape.normal[0] +
+                                    shape.normal[1] * shape.normal[1] +
+                                    shape.normal[2] * shape.normal[2]);
+    if (shape.area <= 0.0 || length <= 0.0) {
+      continue;
+    }
+    double key = 0.0;
+    for (int axis = 0; axis < 3; ++axis) {
+      key += (shape.center[axis] / shape.area - meshCenter[axis]) *
+             shape.normal[axis];
+    }
+    keys[c] = key / length;
+  }
+  std::vector<uint32_t> order(clusterCount);
+  std::iota(order.begin(), order.end(), 0u);
+  std::stable_sort(order.begin(), order.end(),
+                   [&](uint32_t a, uint32_t b) { return keys[a] > keys[b]; });
+
+  std::vector<uint32_t> out;
+  out.reserve(indices.size());
+  for (uint32_t c : order) {
+    out.insert(out.end(), indices.begin() + soft[c] * 3,
+               indices.begin() + soft[c + 1] * 3);
+  }
+  indices.swap(out);
+}
+
+size_t RemoveDuplicateVertices(std::vector<Vertex> &vertices,
+                               std::vector<uint32_t> &indices) {
+  if (vertices.empty() || !IndicesInRange(indices, vertices.size())) {
+    return 0;
+  }
+  size_t capacity = 16;
+  while (capacity < vertices.size() * 2) {
+    capacity *= 2;
+  }
+  const size_t mask = capacity - 1;
+  std::vector<uint32_t> table(capacity, kNone);
+  std::vector<uint32_t> remap(vertices.size());
+  std::vector<Vertex> unique;
+  unique.reserve(vertices.size());
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    const Vertex &v = vertices[i];
+    size_t slot = core::HashBytes(reinterpret_cast<const uint8_t *>(&v),
+                                  sizeof(Vertex), kVertexHashSeed) &
+                  mask;
+    for (;;) {
+      const uint32_t id = table[slot];
+      if (id == kNone) {
+        table[slot] = static_cast<uint32_t>(unique.size());
+        remap[i] = table[slot];
+        unique.push_back(v);
+        break;
+      }
+      if (std::memcmp(&unique[id], &v, sizeof(Vertex)) == 0) {
+        remap[i] = id;
+        break;
+      }
+      slot = (slot + 1) & mask;
+    }
+  }
+  for (uint32_t &index : indices) {
+    index = remap[index];
+  }
+  const size_t removed = vertices.size() - unique.size();
+  vertices.swap(unique);
+  return removed;
+}
+
+void OptimizeVertexFetch(std::vector<Vertex> &vertices,
+                         std::vector<uint32_t> &indices) {
+  if (!IndicesInRange(indices, vertices.size())) {
+    return;
+  }
+  std::vector<uint32_t> remap(vertices.size(), kNone);
+  std::vector<Vertex> ordered;
+  ordered.reserve(vertices.size());
+  for (uint32_t &index : indices) {
+    if (remap[index] == kNone) {
+      remap[index] = static_cast<uint32_t>(ordered.size());
+      ordered.push_back(vertices[index]);
+    }
+    index = remap[index];
+  }
+  vertices.swap(ordered);
+}
+
+void OptimizeMesh(std::vector<Vertex> &vertices,
+                  std::vector<uint32_t> &indices,
+                  std::vector<Submesh> *submeshes,
+                  const MeshOptimizeSettings &settings) {
+  if (vertices.empty() || indices.empty() ||
+      !IndicesInRange(indices, vertices.size())) {
+    return;
+  }
+  if (settings.removeDuplicates) {
+    RemoveDuplicateVertices(vertices, indices);
+  }
+
+  std::vector<Submesh> whole = {
+      {0, static_cast<uint32_t>(indices.size()), 0,
+       static_cast<uint32_t>(vertices.size())}};
+  std::vector<Submesh> &parts =
+      submeshes && !submeshes->empty() ? *submeshes : whole;
+  std::vector<uint32_t> range;
+  std::vector<uint32_t> clusters;
+  for (const Submesh &part : parts) {
+    if (uint64_t{part.indexOffset} + part.indexCount > indices.size()) {
+      continue;
+    }
+    const auto first = indices.begin() + part.indexOffset;
+    range.assign(first, first + part.indexCount);
+    OptimizeVertexCache(range, vertices.size(), settings.cacheSize,
+                        &clusters);
+    OptimizeOverdraw(range, vertices, clusters, settings.overdrawThreshold,
+                     settings.cacheSize);
+    std::copy(range.begin(), range.end(), first);
+  }
+
+  OptimizeVertexFetch(vertices, indices);
+
+  // 頂点が並び替わったのでサブメッシュの頂点範囲を付け直す
+  for (Submesh &part : parts) {
+    if (part.indexCount == 0 ||
+        uint64_t{part.indexOffset} + part.indexCount > indices.size()) {
+      continue;
+    }
+    const auto first = indices.begin() + part.indexOffset;
+    const auto [lo, hi] = std::minmax_element(first, first + part.indexCount);
+    part.vertexOffset = *lo;
+    part.vertexCount = *hi - *lo + 1;
+  }
+}
+
+} // namespace graphics
@@ -0,0 +1,93 @@
+#pragma once
+/**
+ * @file MeshOptimizer.h
+ * @brief 頂点キャッシュ・オーバードロー・頂点フェッチのためのメッシュ並べ替え
+ * @details 読み込み時（キャッシュ変換時）に一度だけ走らせる CPU 処理。
+ *          描画結果は変えず、三角形と頂点の順序だけを入れ替える。
+ */
+
+#include "Mesh.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace graphics {
+
+/// @brief 並べ替え・解析で想定する頂点キャッシュ（変換後頂点）の大きさ
+inline constexpr uint32_t kVertexCacheSize = 16;
+
+/// @brief 頂点キャッシュの効率（FIFO キャッシュで数える）
+struct VertexCacheStats {
+  uint32_t transforms = 0; ///< 頂点シェーダーの実行回数（キャッシュミス）
+  uint32_t triangles = 0;
+  uint32_t vertices = 0; ///< インデックスから参照される頂点の数
+  float acmr = 0.0f;     ///< transforms / triangles（0.5 に近いほど良い）
+  float atvr = 0.0f;     ///< transforms / vertices（1.0 が下限）
+};
+
+/// @brief 頂点フェッチの効率（64 バイト行・16KB の直接マップで数える）
+struct VertexFetchStats {
+  uint64_t bytesFetched = 0;
+  float overfetch = 0.0f; ///< bytesFetched / 参照される頂点のバイト数
+};
+
+/// @brief メッシュ最適化の設定
+struct MeshOptimizeSettings {
+  uint32_t cacheSize = kVertexCacheSize;
+  /// オーバードロー用にクラスタを細かく分けるとき許す ACMR の悪化率。
+  /// 1 未満ならオーバードローの並べ替えをしない
+  float overdrawThreshold = 1.05f;
+  bool removeDuplicates = true; ///< 全バイトが同じ頂点を1つにまとめる
+};
+
+/// @brief インデックス列の頂点キャッシュ効率を数える
+VertexCacheStats AnalyzeVertexCache(const std::vector<uint32_t> &indices,
+                                    size_t vertexCount,
+                                    uint32_t cacheSize = kVertexCacheSize);
+
+/// @brief インデックス順に頂点を読んだときの頂点バッファの読み込み量を数える
+VertexFetchStats AnalyzeVertexFetch(const std::vector<uint32_t> &indices,
+                                    size_t vertexCount, size_t vertexStride);
+
+/**
+ * @brief 三角形を頂点キャッシュに沿って並べ替える（Tipsify）
+ * @details 直前に使った頂点を中心に扇状に三角形を出し、次の中心はキャッシュに
+ *          残っていそうな頂点から選ぶ。行き詰まった位置をクラスタの境界として
+ *          clusters（三角形番号）に返す。
+ */
+void OptimizeVertexCache(std::vector<uint32_t> &indices, size_t vertexCount,
+                         uint32_t cacheSize = kVertexCacheSize,
+                         std::vector<uint32_t> *clusters = nullptr);
+
+/**
+ * @brief クラスタを外向きのものから描く順に並べ替え、オーバードローを減らす
+ * @details OptimizeVertexCache の clusters を ACMR が threshold 倍を超えない
+ *          範囲で細かく分け、各クラスタの中心と法線から「メッシュの外側を
+ *          向いている」順に並べる（Sander et al. 2007）。
+ */
+void OptimizeOverdraw(std::vector<uint32_t> &indices,
+                      const std::vector<Vertex> &vertices,
+                      const std::vector<uint32_t> &clusters,
+                      float threshold = 1.05f,
+                      uint32_t cacheSize = kVertexCacheSize);
+
+/// @brief 全バイトが同じ頂点をまとめる（最初に現れたものを残す）
+/// @return 取り除いた頂点の数
+size_t RemoveDuplicateVertices(std::vector<Vertex> &vertices,
+                               std::vector<uint32_t> &indices);
+
+/// @brief 頂点をインデックスで初めて使われる順に並べ、使われない頂点を捨てる
+void OptimizeVertexFetch(std::vector<Vertex> &vertices,
+                         std::vector<uint32_t> &indices);
+
+/**
+ * @brief 重複除去 → 頂点キャッシュ → オーバードロー → 頂点フェッチの順に行う
+ * @param submeshes 指定すると三角形はサブメッシュの中だけで並べ替え、
+ *                  頂点の範囲を付け直す（nullptr・空なら全体で1つ）
+ */
+void OptimizeMesh(std::vector<Vertex> &vertices,
+                  std::vector<uint32_t> &indices,
+                  std::vector<Submesh> *submeshes = nullptr,
+                  const MeshOptimizeSettings &settings = {});
+
+} // namespace graphics
@@ -1,4 +1,6 @@
 #include "MeshPrimitives.h"
+#include "MeshOptimizer.h"
+#include "MeshSimplifier.h"
 #include "TangentGenerator.h"
 #include <cmath>
 #include <vector>
@@ -126,9 +128,15 @@ Mesh MeshPrimitives::CreateSphere(ID3D11Device *device, int segments) {
   }
 
   ComputeTangents(vertices, indices);
+  // 行ごとの帯の順のままだと分割数が多いとき頂点キャッシュから溢れる
+  OptimizeMesh(vertices, indices);
+  // 群れ・パーティクルで小さく映るときのための LOD を後ろに足す
+  const std::vector<MeshLod> lods = BuildMeshLods(vertices, indices);
 
   Mesh mesh;
-  mesh.Create(device, vertices, indices);
+  if (mesh.Create(device, vertices, indices)) {
+    mesh.SetLods(lods);
+  }
   return mesh;
 }
 
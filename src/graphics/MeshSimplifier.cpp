@@ -0,0 +1,624 @@
+/**
+ * @file MeshSimplifier.cpp
+ * @brief 辺の縮約による簡略化と LOD 選択の実装
+ */
+
+#include "MeshSimplifier.h"
+#include "MeshOptimizer.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace graphics {
+
+namespace {
+
+constexpr uint32_t kNone = 0xffffffffu;
+
+/// @brief 縁・継ぎ目の形を保つための重み（面の二次誤差に対して）
+constexpr double kBorderWeight = 10.0;
+constexpr double kSeamWeight = 1.0;
+
+/// @brief 位置ごとの頂点の分類
+enum VertexKind : uint8_t {
+  kManifold, ///< 周りが閉じていて、属性の継ぎ目もない
+  kBorder,   ///< 開いた縁の上（縁に沿ってだけ動ける）
+  kSeam,     ///< 属性の継ぎ目の上で、2つの頂点が対になっている
+  kLocked,   ///< 角・極・縁と継ぎ目の交点など。動かさない
+};
+
+/// @brief [動かす頂点][寄せる先] で縮約してよいか
+constexpr bool kCanCollapse[4][4] = {
+    {true, true, true, true},
+    {false, true, false, true},
+    {false, false, true, true},
+    {false, false, false, false},
+};
+
+/// @brief 辺の反対側にも三角形があるか（同じ辺を二度拾わないため）
+constexpr bool kHasOpposite[4][4] = {
+    {true, true, true, true},
+    {true, false, true, false},
+    {true, true, true, true},
+    {true, false, true, false},
+};
+
+struct Vec3 {
+  double x = 0.0, y = 0.0, z = 0.0;
+};
+
+Vec3 Sub(const Vec3 &a, const Vec3 &b) {
+  return {a.x - b.x, a.y - b.y, a.z - b.z};
+}
+
+Vec3 Cross(const Vec3 &a, const Vec3 &b) {
+  return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+          a.x * b.y - a.y * b.x};
+}
+
+double Dot(const Vec3 &a, const Vec3 &b) {
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+double Normalize(Vec3 &v) {
+  const double length = std::sqrt(Dot(v, v));
+  if (length > 0.0) {
+    v = {v.x / length, v.y / length, v.z / length};
+  }
+  return length;
+}
+
+/// @brief 平面からの距離の二乗の和（重み付き）。w で割って平均にする
+struct Quadric {
+  double a00 = 0, a11 = 0, a22 = 0, a10 = 0, a20 = 0, a21 = 0;
+  double b0 = 0, b1 = 0, b2 = 0, c = 0, w = 0;
+
+  void AddPlane(const Vec3 &n, double d, double weight) {
+    a00 += weight * n.x * n.x;
+    a11 += weight * n.y * n.y;
+    a22 += weight * n.z * n.z;
+    a10 += weight * n.y * n.x;
+    a20 += weight * n.z * n.x;
+    a21 += weight * n.z * n.y;
+    b0 += weight * n.x * d;
+    b1 += weight * n.y * d;
+    b2 += weight * n.z * d;
+    c += weight * d * d;
+    w += weight;
+  }
+
+  void Add(const Quadric &q) {
+    a00 += q.a00, a11 += q.a11, a22 += q.a22;
+    a10 += q.a10, a20 += q.a20, a21 += q.a21;
+    b0 += q.b0, b1 += q.b1, b2 += q.b2;
+    c += q.c, w += q.w;
+  }
+
+  double Error(const Vec3 &p) const {
+    const double rx = a00 * p.x + a10 * p.y + a20 * p.z;
+    const double ry = a10 * p.x + a11 * p.y + a21 * p.z;
+    const double rz = a20 * p.x + a21 * p.y + a22 * p.z;
+    const double r = rx * p.x + ry * p.y + rz * p.z +
+                     2.0 * (b0 * p.x + b1 * p.y + b2 * p.z) + c;
+    return w > 0.0 ? std::fabs(r) / w : 0.0;
+  }
+};
+
+/// @brief 縮約の候補（from を to の位置へ寄せる）
+struct Collapse {
+  uint32_t from = 0;
+  uint32_t to = 0;
+  double error = 0.0; ///< 正規化した座標での距離の二乗
+};
+
+/// @brief 頂点ごとに、その頂点を含む三角形の残り2頂点を並べた表
+class Adjacency {
+public:
+  /// @param keyOf 頂点番号から表の行（位置の代表など）への対応
+  void Build(const std::vector<uint32_t> &indices, size_t rowCount,
+             const std::vector<uint32_t> *keyOf) {
+    m_offsets.assign(rowCount + 1, 0);
+    auto row = [keyOf](uint32_t v) { return keyOf ? (*keyOf)[v] : v; };
+    for (uint32_t index : indices) {
+      ++m_offsets[row(index) + 1];
+    }
+    for (size_t i = 0; i < rowCount; ++i) {
+      m_offsets[i + 1] += m_offsets[i];
+    }
+    m_corner.resize(indices.size());
+    m_next.resize(indices.size());
+    m_prev.resize(indices.size());
+    std::vector<uint32_t> cursor(m_offsets.begin(), m_offsets.end() - 1);
+    for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+      for (int k = 0; k < 3; ++k) {
+        const uint32_t slot = cursor[row(indices[t + k])]++;
+        m_corner[slot] = indices[t + k];
+        m_next[slot] = indices[t + (k + 1) % 3];
+        m_prev[slot] = indices[t + (k + 2) % 3];
+      }
+    }
+  }
+
+  uint32_t Begin(uint32_t row) const { return m_offsets[row]; }
+  uint32_t End(uint32_t row) const { return m_offsets[row + 1]; }
+  uint32_t Corner(uint32_t slot) const { return m_corner[slot]; }
+  uint32_t Next(uint32_t slot) const { return m_next[slot]; }
+  uint32_t Prev(uint32_t slot) const { return m_prev[slot]; }
+
+  bool HasEdge(uint32_t from, uint32_t to) const {
+    for (uint32_t slot = Begin(from); slot < End(from); ++slot) {
+      if (m_next[slot] == to) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  std::vector<uint32_t> m_offsets;
+  std::vector<uint32_t> m_corner; ///< 行に入れた頂点そのもの
+  std::vector<uint32_t> m_next;
+  std::vector<uint32_t> m_prev;
+};
+
+/// @brief 簡略化の途中の状態
+class Simplifier {
+public:
+  Simplifier(const std::vector<Vertex> &vertices,
+             const std::vector<uint32_t> &indices)
+      : m_vertexCount(vertices.size()) {
+    NormalizePositions(vertices);
+    BuildPositionRemap();
+    m_indices.reserve(indices.size());
+    AppendNonDegenerate(indices, m_indices);
+    ClassifyVertices();
+    FillQuadrics();
+  }
+
+  /// @return 縮約の誤差の最大（正規化した座標での距離の二乗）
+  double Run(size_t targetTriangles, double errorLimit) {
+    double resultError = 0.0;
+    while (m_indices.size() / 3 > targetTriangles) {
+      m_adjacency.Build(m_indices, m_vertexCount, &m_remap);
+      std::vector<Collapse> collapses = GatherCollapses();
+      if (collapses.empty()) {
+        break;
+      }
+      std::sort(collapses.begin(), collapses.end(),
+                [](const Collapse &a, const Collapse &b) {
+                  return a.error < b.error;
+                });
+      // 1回に縮める数の目安。頂点の取り合いで半分ほどは見送られるので、
+      // 誤差の上限もその位置の 1.5 倍まで緩める。目標の近くで1つずつしか
+      // 縮まなくならないよう、候補の 1/16 までは常に見る
+      const size_t goal = m_indices.size() / 3 - targetTriangles;
+      const size_t edgeGoal = std::max(goal / 2, collapses.size() / 16);
+      const double passLimit =
+          edgeGoal < collapses.size()
+              ? std::min(errorLimit, collapses[edgeGoal].error * 1.5)
+              : errorLimit;
+      const size_t performed =
+          PerformCollapses(collapses, goal, passLimit, resultError);
+      if (performed == 0) {
+        break;
+      }
+      RemapIndices();
+    }
+    return resultError;
+  }
+
+  const std::vector<uint32_t> &Indices() const { return m_indices; }
+
+private:
+  /// @brief 境界ボックスで [0, 1] に収め、誤差をメッシュの大きさの割合にする
+  void NormalizePositions(const std::vector<Vertex> &vertices) {
+    const float extent = ComputeMeshExtent(vertices.data(), vertices.size());
+    const double scale = extent > 0.0f ? 1.0 / extent : 1.0;
+    Vec3 lo{std::numeric_limits<double>::max(),
+            std::numeric_limits<double>::max(),
+            std::numeric_limits<double>::max()};
+    for (const Vertex &v : vertices) {
+      lo.x = std::min<double>(lo.x, v.position.x);
+      lo.y = std::min<double>(lo.y, v.position.y);
+      lo.z = std::min<double>(lo.z, v.position.z);
+    }
+    m_positions.resize(vertices.size());
+    m_sourcePositions.resize(vertices.size());
+    m_texCoords.resize(vertices.size());
+    for (size_t i = 0; i < vertices.size(); ++i) {
+      const DirectX::XMFLOAT3 &p = vertices[i].position;
+      m_sourcePositions[i] = p;
+      m_texCoords[i] = vertices[i].texCoord;
+      m_positions[i] = {(p.x - lo.x) * scale, (p.y - lo.y) * scale,
+                        (p.z - lo.z) * scale};
+    }
+  }
+
+  /// @brief 同じ位置の頂点を1つの代表（番号の最も小さいもの）にまとめ、
+  ///        同じ位置の頂点どうしを輪（m_wedge）でつなぐ
+  void BuildPositionRemap() {
+    auto key = [this](uint32_t v) {
+      std::array<uint32_t, 3> bits{};
+      const float p[3] = {m_sourcePositions[v].x + 0.0f,
+                          m_sourcePositions[v].y + 0.0f,
+                          m_sourcePositions[v].z + 0.0f};
+      std::memcpy(bits.data(), p, sizeof(p));
+      return bits;
+    };
+    std::vector<uint32_t> order(m_vertexCount);
+    for (uint32_t i = 0; i < order.size(); ++i) {
+      order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+      const auto ka = key(a), kb = key(b);
+      return ka != kb ? ka < kb : a < b;
+    });
+    m_remap.resize(m_vertexCount);
+    m_wedge.resize(m_vertexCount);
+    for (size_t begin = 0; begin < order.size();) {
+      size_t end = begin + 1;
+      while (end < order.size() && key(order[end]) == key(order[begin])) {
+        ++end;
+      }
+      for (size_t i = begin; i < end; ++i) {
+        m_remap[order[i]] = order[begin];
+        m_wedge[order[i]] = order[i + 1 < end ? i + 1 : begin];
+      }
+      begin = end;
+    }
+  }
+
+  /// @brief 2頂点が同じ位置にある三角形（面積なし）を除いて足す
+  void AppendNonDegenerate(const std::vector<uint32_t> &indices,
+                           std::vector<uint32_t> &out) const {
+    for (size_t t = 0; t + 2 < indices.size(); t += 3) {
+      const uint32_t a = m_remap[indices[t]];
+      const uint32_t b = m_remap[indices[t + 1]];
+      const uint32_t c = m_remap[indices[t + 2]];
+      if (a != b && b != c && c != a) {
+        out.insert(out.end(), indices.begin() + t, indices.begin() + t + 3);
+      }
+    }
+  }
+
+  /// @brief 開いた辺（頂点番号で反対向きの辺がない）をたどって分類する
+  void ClassifyVertices() {
+    Adjacency vertexEdges;
+    vertexEdges.Build(m_indices, m_vertexCount, nullptr);
+    m_loop.assign(m_vertexCount, kNone);
+    m_loopBack.assign(m_vertexCount, kNone);
+    for (size_t t = 0; t + 2 < m_indices.size(); t += 3) {
+      for (int k = 0; k < 3; ++k) {
+        const uint32_t a = m_indices[t + k];
+        const uint32_t b = m_indices[t + (k + 1) % 3];
+        if (vertexEdges.HasEdge(b, a)) {
+          continue;
+        }
+        // 開いた辺が2本以上出入りする頂点は自分を指して「複雑」と印す
+        m_loop[a] = m_loop[a] == kNone ? b : a;
+        m_loopBack[b] = m_loopBack[b] == kNone ? a : b;
+      }
+    }
+
+    m_kind.assign(m_vertexCount, kLocked);
+    for (uint32_t v = 0; v < m_vertexCount; ++v) {
+      if (m_remap[v] != v) {
+        continue;
+      }
+      const uint32_t w = m_wedge[v];
+      if (w == v) {
+        const uint32_t in = m_loopBack[v], out = m_loop[v];
+        if (in == kNone && out == kNone) {
+          m_kind[v] = kManifold;
+        } else if (in != kNone && out != kNone && in != v && out != v) {
+          m_kind[v] = kBorder;
+        }
+      } else if (m_wedge[w] == v) {
+        // 継ぎ目の両側で開いた辺が1本ずつあり、反対向きにつながること
+        const uint32_t inV = m_loopBack[v], outV = m_loop[v];
+        const uint32_t inW = m_loopBack[w], outW = m_loop[w];
+        const bool open = inV != kNone && outV != kNone && inW != kNone &&
+                          outW != kNone && inV != v && outV != v &&
+                          inW != w && outW != w;
+        if (open && m_remap[inV] == m_remap[outW] &&
+            m_remap[outV] == m_remap[inW] &&
+            m_remap[inV] != m_remap[outV]) {
+          m_kind[v] = kSeam;
+        }
+      }
+    }
+    for (uint32_t v = 0; v < m_vertexCount; ++v) {
+      m_kind[v] = m_kind[m_remap[v]];
+    }
+  }
+
+  /// @brief 面の平面（面積で重み付け）と、縁・継ぎ目に立てた垂直な平面
+  void FillQuadrics() {
+    m_quadrics.assign(m_vertexCount, Quadric());
+    for (size_t t = 0; t + 2 < m_indices.size(); t += 3) {
+      const uint32_t v[3] = {m_indices[t], m_indices[t + 1],
+                             m_indices[t + 2]};
+      const Vec3 &p0 = m_positions[v[0]];
+      Vec3 normal = Cross(Sub(m_positions[v[1]], p0),
+                          Sub(m_positions[v[2]], p0));
+      const double area = Normalize(normal) * 0.5;
+      if (area <= 0.0) {
+        continue;
+      }
+      Quadric face;
+      face.AddPlane(normal, -Dot(normal, p0), area);
+      for (uint32_t vertex : v) {
+        m_quadrics[m_remap[vertex]].Add(face);
+      }
+
+      for (int k = 0; k < 3; ++k) {
+        const uint32_t a = v[k], b = v[(k + 1) % 3];
+        const VertexKind kind = static_cast<VertexKind>(m_kind[a]);
+        if ((kind != kBorder && kind != kSeam) || m_loop[a] != b) {
+          continue;
+        }
+        const Vec3 edge = Sub(m_positions[b], m_positions[a]);
+        Vec3 side = Cross(edge, normal);
+        if (Normalize(side) <= 0.0) {
+          continue;
+        }
+        const double weight =
+            Dot(edge, edge) * (kind == kBorder ? kBorderWeight : kSeamWeight);
+        Quadric constraint;
+        constraint.AddPlane(side, -Dot(side, m_positions[a]), weight);
+        m_quadrics[m_remap[a]].Add(constraint);
+        m_quadrics[m_remap[b]].Add(constraint);
+      }
+    }
+  }
+
+  /// @brief from を to へ寄せられるか（縁・継ぎ目の頂点はその線に沿ってだけ）
+  bool CanCollapse(uint32_t from, uint32_t to) const {
+    const uint8_t kind = m_kind[from];
+    if (!kCanCollapse[kind][m_kind[to]]) {
+      return false;
+    }
+    return kind == kManifold || m_loop[from] == to || m_loopBack[from] == to;
+  }
+
+  std::vector<Collapse> GatherCollapses() const {
+    std::vector<Collapse> collapses;
+    for (size_t t = 0; t + 2 < m_indices.size(); t += 3) {
+      for (int k = 0; k < 3; ++k) {
+        const uint32_t i0 = m_indices[t + k];
+        const uint32_t i1 = m_indices[t + (k + 1) % 3];
+        const uint32_t r0 = m_remap[i0], r1 = m_remap[i1];
+        if (kHasOpposite[m_kind[i0]][m_kind[i1]] && r1 > r0) {
+          continue;
+        }
+        const bool forward = CanCollapse(i0, i1);
+        const bool backward = CanCollapse(i1, i0);
+        if (!forward && !backward) {
+          continue;
+        }
+        const double forwardError =
+            forward ? m_quadrics[r0].Error(m_positions[i1])
+                    : std::numeric_limits<double>::max();
+        const double backwardError =
+            backward ? m_quadrics[r1].Error(m_positions[i0])
+                     : std::numeric_limits<double>::max();
+        if (forwardError <= backwardError) {
+          collapses.push_back({i0, i1, forwardError});
+        } else {
+          collapses.push_back({i1, i0, backwardError});
+        }
+      }
+    }
+    return collapses;
+  }
+
+  /// @brief i0（継ぎ目なら対の s0 も）を寄せると、位置か UV で裏返る
+  ///        三角形があるか
+  bool HasTriangleFlips(uint32_t i0, uint32_t i1, uint32_t s0,
+                        uint32_t s1) const {
+    const uint32_t r0 = m_remap[i0], r1 = m_remap[i1];
+    const Vec3 &from = m_positions[r0];
+    const Vec3 &target = m_positions[r1];
+    for (uint32_t slot = m_adjacency.Begin(r0); slot < m_adjacency.End(r0);
+         ++slot) {
+      // この回で先に動いた頂点は動いた先で調べる
+      const uint32_t b = m_collapseRemap[m_adjacency.Next(slot)];
+      const uint32_t c = m_collapseRemap[m_adjacency.Prev(slot)];
+      if (m_remap[b] == r1 || m_remap[c] == r1) {
+        continue; // この縮約で消える三角形
+      }
+      const Vec3 &pb = m_positions[m_remap[b]];
+      const Vec3 &pc = m_positions[m_remap[c]];
+      const Vec3 before = Cross(Sub(pb, from), Sub(pc, from));
+      const Vec3 after = Cross(Sub(pb, target), Sub(pc, target));
+      if (Dot(before, after) <= 0.0) {
+        return true;
+      }
+      // 寄せた頂点は寄せ先の UV を使う。UV のない（面積 0 の）面は見ない
+      const uint32_t corner = m_adjacency.Corner(slot);
+      const uint32_t moved = corner == s0 ? s1 : i1;
+      const double uvBefore = UvArea(corner, b, c);
+      if (uvBefore != 0.0 && uvBefore * UvArea(moved, b, c) <= 0.0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  double UvArea(uint32_t a, uint32_t b, uint32_t c) const {
+    const DirectX::XMFLOAT2 &ta = m_texCoords[a];
+    const DirectX::XMFLOAT2 &tb = m_texCoords[b];
+    const DirectX::XMFLOAT2 &tc = m_texCoords[c];
+    return (double{tb.x} - ta.x) * (double{tc.y} - ta.y) -
+           (double{tb.y} - ta.y) * (double{tc.x} - ta.x);
+  }
+
+  size_t PerformCollapses(const std::vector<Collapse> &collapses,
+                          size_t triangleGoal, double errorLimit,
+                          double &resultError) {
+    m_collapseRemap.resize(m_vertexCount);
+    for (uint32_t i = 0; i < m_vertexCount; ++i) {
+      m_collapseRemap[i] = i;
+    }
+    std::vector<uint8_t> locked(m_vertexCount, 0);
+    size_t performed = 0;
+    size_t triangles = 0;
+    for (const Collapse &collapse : collapses) {
+      if (collapse.error > errorLimit || triangles >= triangleGoal) {
+        break;
+      }
+      const uint32_t i0 = collapse.from, i1 = collapse.to;
+      const uint32_t r0 = m_remap[i0], r1 = m_remap[i1];
+      if (locked[r0] || locked[r1]) {
+        continue;
+      }
+      const uint8_t kind = m_kind[i0];
+      uint32_t s0 = kNone, s1 = kNone;
+      if (kind == kSeam) {
+        // 継ぎ目の反対側の頂点も、同じ辺の反対側の端へ寄せる
+        s0 = m_wedge[i0];
+        s1 = m_loop[i0] == i1 ? m_loopBack[s0] : m_loop[s0];
+        if (s1 == kNone || m_remap[s1] != r1) {
+          continue;
+        }
+      }
+      if (HasTriangleFlips(i0, i1, s0, s1)) {
+        locked[r0] = 1;
+        continue;
+      }
+      if (kind == kSeam) {
+        m_collapseRemap[s0] = s1;
+      }
+      m_collapseRemap[i0] = i1;
+      m_quadrics[r1].Add(m_quadrics[r0]);
+      locked[r0] = 1;
+      locked[r1] = 1;
+      // 縁の辺は1つ、それ以外は両側の2つの三角形が消える
+      triangles += kind == kBorder ? 1 : 2;
+      resultError = std::max(resultError, collapse.error);
+      ++performed;
+    }
+    return performed;
+  }
+
+  void RemapIndices() {
+    std::vector<uint32_t> remapped = m_indices;
+    for (uint32_t &index : remapped) {
+      index = m_collapseRemap[index];
+    }
+    m_indices.clear();
+    AppendNonDegenerate(remapped, m_indices);
+  }
+
+  size_t m_vertexCount = 0;
+  std::vector<DirectX::XMFLOAT3> m_sourcePositions;
+  std::vector<Vec3> m_positions;
+  std::vector<DirectX::XMFLOAT2> m_texCoords;
+  std::vector<uint32_t> m_remap; ///< 同じ位置の代表の頂点
+  std::vector<uint32_t> m_wedge; ///< 同じ位置の次の頂点（輪）
+  std::vector<uint32_t> m_loop;  ///< 開いた辺で出ていく先（なければ kNone）
+  std::vector<uint32_t> m_loopBack; ///< 開いた辺で入ってくる元
+  std::vector<uint8_t> m_kind;
+  std::vector<Quadric> m_quadrics; ///< 代表の頂点ごと
+  std::vector<uint32_t> m_indices;
+  std::vector<uint32_t> m_collapseRemap;
+  Adjacency m_adjacency; ///< 位置の代表ごと
+};
+
+} // namespace
+
+float ComputeMeshExtent(const Vertex *vertices, size_t vertexCount) {
+  if (!vertices || vertexCount == 0) {
+    return 0.0f;
+  }
+  DirectX::XMFLOAT3 lo = vertices[0].position;
+  DirectX::XMFLOAT3 hi = vertices[0].position;
+  for (size_t i = 1; i < vertexCount; ++i) {
+    const DirectX::XMFLOAT3 &p = vertices[i].position;
+    lo = {std::min(lo.x, p.x), std::min(lo.y, p.y), std::min(lo.z, p.z)};
+    hi = {std::max(hi.x, p.x), std::max(hi.y, p.y), std::max(hi.z, p.z)};
+  }
+  return std::max({hi.x - lo.x, hi.y - lo.y, hi.z - lo.z});
+}
+
+size_t SimplifyMesh(const std::vector<Vertex> &vertices,
+                    const std::vector<uint32_t> &indices,
+                    size_t targetIndexCount, float targetError,
+                    std::vector<uint32_t> &out, float *resultError) {
+  if (resultError) {
+    *resultError = 0.0f;
+  }
+  const bool inRange = std::all_of(
+      indices.begin(), indices.end(),
+      [&vertices](uint32_t index) { return index < vertices.size(); });
+  if (!inRange || indices.size() % 3 != 0) {
+    out = indices;
+    return out.size();
+  }
+  Simplifier simplifier(vertices, indices);
+  const double limit = static_cast<double>(targetError) * targetError;
+  const double error = simplifier.Run(targetIndexCount / 3, limit);
+  out = simplifier.Indices();
+  if (resultError) {
+    *resultError = static_cast<float>(std::sqrt(error));
+  }
+  return out.size();
+}
+
+std::vector<MeshLod> BuildMeshLods(const std::vector<Vertex> &vertices,
+                                   std::vector<uint32_t> &indices,
+                                   const MeshLodSettings &settings) {
+  std::vector<MeshLod> lods;
+  lods.push_back({0, static_cast<uint32_t>(indices.size()), 0.0f});
+  std::vector<uint32_t> source = indices;
+  float error = 0.0f;
+  while (lods.size() < settings.maxLods && error < settings.maxError) {
+    const size_t triangles = source.size() / 3;
+    const size_t target = std::max<size_t>(
+        settings.minTriangles,
+        static_cast<size_t>(static_cast<float>(triangles) * settings.ratio));
+    if (target >= triangles) {
+      break;
+    }
+    std::vector<uint32_t> lod;
+    float lodError = 0.0f;
+    SimplifyMesh(vertices, source, target * 3, settings.maxError - error, lod,
+                 &lodError);
+    // 継ぎ目・縁ばかりで減らせないときは同じような段を増やさない
+    if (lod.empty() || lod.size() > source.size() * 9 / 10) {
+      break;
+    }
+    // 前の段からのずれを足していく（元の形からのずれの上限）
+    error += lodError;
+    OptimizeVertexCache(lod, vertices.size());
+    lods.push_back({static_cast<uint32_t>(indices.size()),
+                    static_cast<uint32_t>(lod.size()), error});
+    indices.insert(indices.end(), lod.begin(), lod.end());
+    source.swap(lod);
+  }
+  return lods;
+}
+
+float ProjectedSizePixels(float worldSize, float distance,
+                          float projectionScaleY, float viewportHeight) {
+  if (distance <= 0.0f) {
+    return std::numeric_limits<float>::max(); // カメラの位置・後ろは最も細かく
+  }
+  return worldSize * projectionScaleY / distance * viewportHeight * 0.5f;
+}
+
+uint32_t SelectMeshLod(const MeshLod *lods, size_t lodCount, float screenSize,
+                       float pixelError) {
+  uint32_t selected = 0;
+  for (size_t i = 1; i < lodCount; ++i) {
+    if (lods[i].error * screenSize > pixelError) {
+      break;
+    }
+    selected = static_cast<uint32_t>(i);
+  }
+  return selected;
+}
+
+} // namespace graphics
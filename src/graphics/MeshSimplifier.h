@@ -0,0 +1,69 @@
+#pragma once
+/**
+ * @file MeshSimplifier.h
+ * @brief 二次誤差（QEM）による辺の縮約と、画面上の大きさで選ぶ LOD
+ * @details 頂点は動かさず、辺の一方の端点へ寄せる縮約だけを行う。
+ *          どの LOD も元の頂点バッファをそのまま使い、インデックスだけが違う。
+ *          UV・法線の継ぎ目（同じ位置で属性が違う頂点）と開いた縁の頂点は、
+ *          継ぎ目・縁に沿ってしか動かさないので、テクスチャの境目は割れない。
+ */
+
+#include "Mesh.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace graphics {
+
+/// @brief LOD を切り替える画面上の誤差（ピクセル）
+inline constexpr float kLodPixelError = 1.0f;
+
+/// @brief LOD の列を作るときの設定
+struct MeshLodSettings {
+  uint32_t maxLods = 4;      ///< LOD0（元のメッシュ）を含む段数の上限
+  float ratio = 0.5f;        ///< 段ごとに残す三角形の割合
+  float maxError = 0.05f;    ///< 許す誤差の合計（メッシュの大きさに対する割合）
+  uint32_t minTriangles = 8; ///< これより少なくはしない
+};
+
+/**
+ * @brief 三角形が targetIndexCount / 3 個になるまで辺を縮める
+ * @details 誤差が targetError（メッシュの大きさに対する割合）を超える縮約は
+ *          しないので、目標より多く残ることがある。面積のない三角形は除く。
+ *          インデックスが頂点の範囲外なら入力をそのまま返す。
+ * @param resultError 実際の誤差（nullptr 可）
+ * @return out のインデックス数
+ */
+size_t SimplifyMesh(const std::vector<Vertex> &vertices,
+                    const std::vector<uint32_t> &indices,
+                    size_t targetIndexCount, float targetError,
+                    std::vector<uint32_t> &out, float *resultError = nullptr);
+
+/// @brief メッシュの大きさ（境界ボックスの最も長い辺）。LOD の誤差の単位
+float ComputeMeshExtent(const Vertex *vertices, size_t vertexCount);
+
+/**
+ * @brief 段ごとに前の段を簡略化して LOD の列を作り、indices の後ろへ足す
+ * @details 各段は頂点キャッシュ順に並べ替えておく。サブメッシュは LOD0 の
+ *          範囲のままで、LOD はメッシュ全体を1回で描く前提で作る。
+ * @return 先頭が LOD0（元の indices 全体）。簡略化できなければ LOD0 だけ
+ */
+std::vector<MeshLod> BuildMeshLods(const std::vector<Vertex> &vertices,
+                                   std::vector<uint32_t> &indices,
+                                   const MeshLodSettings &settings = {});
+
+/**
+ * @brief 透視投影で大きさ worldSize のものが画面上で何ピクセルになるか
+ * @param projectionScaleY 射影行列の _22（1 / tan(fovY / 2)）
+ */
+float ProjectedSizePixels(float worldSize, float distance,
+                          float projectionScaleY, float viewportHeight);
+
+/**
+ * @brief 誤差が画面上で pixelError 以下に収まる最も粗い LOD を選ぶ
+ * @param screenSize メッシュの大きさ（ComputeMeshExtent）の画面上のピクセル数
+ */
+uint32_t SelectMeshLod(const MeshLod *lods, size_t lodCount, float screenSize,
+                       float pixelError = kLodPixelError);
+
+} // namespace graphics
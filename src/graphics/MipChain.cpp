@@ -0,0 +1,383 @@
+/**
+ * @file MipChain.cpp
+ * @brief ミップチェーン生成の実装
+ */
+
+#include "MipChain.h"
+#include "../core/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define MIP_CHAIN_SSE2 1
+#endif
+
+namespace graphics {
+
+namespace {
+
+/// @brief 1チャンクあたりの出力画素数の目安
+constexpr size_t kPixelsPerChunk = 16384;
+
+/// @brief 横方向に縮小した行を覚えておく数（縦のタップ数 6 より多く）
+constexpr int kRowRing = 8;
+
+/// @brief 縦横それぞれのタップ数の上限
+constexpr int kMaxTaps = 6;
+
+/// @brief プールがあれば並列、なければそのまま実行
+template <typename Fn>
+void RunRange(core::ThreadPool *pool, size_t count, size_t grain, Fn &&fn) {
+  if (count == 0) {
+    return;
+  }
+  if (pool && count > grain) {
+    pool->ParallelFor(count, grain, fn);
+  } else {
+    fn(0, count);
+  }
+}
+
+/// @brief 出力の画素 x は入力の 2x + first から count 個を重み付きで足す
+struct Taps {
+  int first = 0;
+  int count = 0;
+  float weights[kMaxTaps] = {};
+};
+
+/// @brief 0 次の第1種変形ベッセル関数（級数展開）
+double BesselI0(double x) {
+  double sum = 1.0;
+  double term = 1.0;
+  const double q = x * x * 0.25;
+  for (int k = 1; k < 32; ++k) {
+    term *= q / (static_cast<double>(k) * k);
+    sum += term;
+    if (term < sum * 1e-12) {
+      break;
+    }
+  }
+  return sum;
+}
+
+Taps MakeTaps(const MipChainSettings &settings) {
+  Taps taps;
+  if (settings.filter == MipFilter::Box) {
+    taps.first = 0;
+    taps.count = 2;
+    taps.weights[0] = taps.weights[1] = 0.5f;
+    return taps;
+  }
+
+  // 入力の画素中心は出力の画素中心から ±0.5, ±1.5, ±2.5 にある。
+  // 出力の間隔で sinc を取り、半径 3 の Kaiser 窓をかける
+  constexpr double kPi = 3.14159265358979323846;
+  constexpr double kRadius = 3.0;
+  const double alpha = settings.kaiserAlpha;
+  taps.first = -2;
+  taps.count = 6;
+  double weights[6];
+  double sum = 0.0;
+  for (int i = 0; i < 6; ++i) {
+    const double d = (i - 2) - 0.5;
+    const double t = d * 0.5;
+    const double sinc = std::sin(kPi * t) / (kPi * t);
+    const double r = d / kRadius;
+    const double window =
+        BesselI0(alpha * std::sqrt(std::max(0.0, 1.0 - r * r))) /
+        BesselI0(alpha);
+    weights[i] = sinc * window;
+    sum += weights[i];
+  }
+  for (int i = 0; i < 6; ++i) {
+    taps.weights[i] = static_cast<float>(weights[i] / sum);
+  }
+  return taps;
+}
+
+/// @brief 8bit ↔ float の変換表
+struct ColorTables {
+  float srgbToLinear[256];
+  float unormToFloat[256];
+  /// 0..1 を 65535 段に分けた値から 8bit へ（線形 → sRGB と線形のまま）
+  std::vector<uint8_t> linearToSrgb;
+  std::vector<uint8_t> floatToUnorm;
+
+  ColorTables() : linearToSrgb(65536), floatToUnorm(65536) {
+    for (int i = 0; i < 256; ++i) {
+      const double c = i / 255.0;
+      srgbToLinear[i] = static_cast<float>(
+          c <= 0.04045 ? c / 12.92 : std::pow((c + 0.055) / 1.055, 2.4));
+      unormToFloat[i] = static_cast<float>(c);
+    }
+    for (int i = 0; i < 65536; ++i) {
+      const double v = i / 65535.0;
+      const double s =
+          v <= 0.0031308 ? v * 12.92 : 1.055 * std::pow(v, 1.0 / 2.4) - 0.055;
+      linearToSrgb[i] = static_cast<uint8_t>(std::lround(s * 255.0));
+      floatToUnorm[i] = static_cast<uint8_t>(std::lround(v * 255.0));
+    }
+  }
+
+  static const ColorTables &Get() {
+    static const ColorTables tables;
+    return tables;
+  }
+};
+
+/// @brief float の画素（4 チャンネル）。SSE2 版とスカラー版で同じ演算を行う
+struct Pixel4 {
+#ifdef MIP_CHAIN_SSE2
+  __m128 v;
+#else
+  float v[4];
+#endif
+};
+
+inline Pixel4 Zero4() {
+#ifdef MIP_CHAIN_SSE2
+  return {_mm_setzero_ps()};
+#else
+  return {{0.0f, 0.0f, 0.0f, 0.0f}};
+#endif
+}
+
+inline Pixel4 Load4(const float *p) {
+#ifdef MIP_CHAIN_SSE2
+  return {_mm_loadu_ps(p)};
+#else
+  return {{p[0], p[1], p[2], p[3]}};
+#endif
+}
+
+inline void Store4(float *p, const Pixel4 &a) {
+#ifdef MIP_CHAIN_SSE2
+  _mm_storeu_ps(p, a.v);
+#else
+  std::copy(a.v, a.v + 4, p);
+#endif
+}
+
+/// @brief acc + w * x
+inline Pixel4 MulAdd4(const Pixel4 &acc, float w, const Pixel4 &x) {
+#ifdef MIP_CHAIN_SSE2
+  return {_mm_add_ps(acc.v, _mm_mul_ps(_mm_set1_ps(w), x.v))};
+#else
+  Pixel4 r;
+  for (int c = 0; c < 4; ++c) {
+    r.v[c] = acc.v[c] + w * x.v[c];
+  }
+  return r;
+#endif
+}
+
+/// @brief 8bit の画素を float へ（色は表 rgb、アルファは線形）
+inline Pixel4 Decode(const uint8_t *p, const float *rgb,
+                     const ColorTables &tables) {
+#ifdef MIP_CHAIN_SSE2
+  return {_mm_setr_ps(rgb[p[0]], rgb[p[1]], rgb[p[2]],
+                      tables.unormToFloat[p[3]])};
+#else
+  return {{rgb[p[0]], rgb[p[1]], rgb[p[2]], tables.unormToFloat[p[3]]}};
+#endif
+}
+
+/// @brief float の画素を 8bit へ（範囲外は切り詰める）
+inline void Encode(const Pixel4 &a, const uint8_t *rgb,
+                   const ColorTables &tables, uint8_t *out) {
+  int32_t index[4];
+#ifdef MIP_CHAIN_SSE2
+  __m128 v = _mm_min_ps(_mm_max_ps(a.v, _mm_setzero_ps()), _mm_set1_ps(1.0f));
+  v = _mm_add_ps(_mm_mul_ps(v, _mm_set1_ps(65535.0f)), _mm_set1_ps(0.5f));
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(index), _mm_cvttps_epi32(v));
+#else
+  for (int c = 0; c < 4; ++c) {
+    const float v = std::min(std::max(a.v[c], 0.0f), 1.0f);
+    index[c] = static_cast<int32_t>(v * 65535.0f + 0.5f);
+  }
+#endif
+  out[0] = rgb[index[0]];
+  out[1] = rgb[index[1]];
+  out[2] = rgb[index[2]];
+  out[3] = tables.floatToUnorm[index[3]];
+}
+
+/// @brief Box（sRGB でない）: 整数で (a + b + c + d + 2) / 4
+void BoxRowsInteger(const uint8_t *src, uint32_t srcWidth, uint32_t srcHeight,
+                    size_t srcStride, MipLevel &dst, size_t y0, size_t y1) {
+  const uint32_t dw = dst.width;
+  for (size_t y = y0; y < y1; ++y) {
+    const uint8_t *r0 = src + 2 * y * srcStride;
+    const uint8_t *r1 = 2 * y + 1 < srcHeight ? r0 + srcStride : r0;
+    uint8_t *out = dst.pixels.data() + y * dw * 4;
+    uint32_t x = 0;
+    if (srcWidth >= 2) {
+#ifdef MIP_CHAIN_SSE2
+      // 入力 4 画素（16 バイト）× 2 行 → 出力 2 画素
+      const __m128i zero = _mm_setzero_si128();
+      const __m128i two = _mm_set1_epi16(2);
+      for (; x + 2 <= dw; x += 2) {
+        const __m128i a = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(r0 + 8 * x));
+        const __m128i b = _mm_loadu_si128(
+            reinterpret_cast<const __m128i *>(r1 + 8 * x));
+        const __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(a, zero),
+                                         _mm_unpacklo_epi8(b, zero));
+        const __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(a, zero),
+                                         _mm_unpackhi_epi8(b, zero));
+        // 隣り合う画素の和（下位 64bit に入る）
+        const __m128i s0 = _mm_add_epi16(lo, _mm_srli_si128(lo, 8));
+        const __m128i s1 = _mm_add_epi16(hi, _mm_srli_si128(hi, 8));
+        __m128i sum = _mm_unpacklo_epi64(s0, s1);
+        sum = _mm_srli_epi16(_mm_add_epi16(sum, two), 2);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(out + 4 * x),
+                         _mm_packus_epi16(sum, zero));
+      }
+#endif
+      for (; x < dw; ++x) {
+        for (int c = 0; c < 4; ++c) {
+          const uint32_t sum = r0[8 * x + c] + r0[8 * x + 4 + c] +
+                               r1[8 * x + c] + r1[8 * x + 4 + c];
+          out[4 * x + c] = static_cast<uint8_t>((sum + 2) >> 2);
+        }
+      }
+    } else {
+      // 幅 1 は右隣を複製
+      for (int c = 0; c < 4; ++c) {
+        out[c] = static_cast<uint8_t>((2u * r0[c] + 2u * r1[c] + 2) >> 2);
+      }
+    }
+  }
+}
+
+/// @brief 分離フィルタ（横 → 縦）で行 [y0, y1) を作る
+void FilterRows(const uint8_t *src, uint32_t srcWidth, uint32_t srcHeight,
+                size_t srcStride, MipLevel &dst, const Taps &taps, bool srgb,
+                size_t y0, size_t y1) {
+  const ColorTables &tables = ColorTables::Get();
+  const float *decodeRgb = srgb ? tables.srgbToLinear : tables.unormToFloat;
+  const uint8_t *encodeRgb =
+      srgb ? tables.linearToSrgb.data() : tables.floatToUnorm.data();
+  const uint32_t dw = dst.width;
+
+  // 横方向に縮小した入力の行（float、出力の幅）を輪状に覚えておく
+  std::vector<float> ring(static_cast<size_t>(kRowRing) * dw * 4);
+  int ringRow[kRowRing];
+  std::fill(ringRow, ringRow + kRowRing, -1);
+
+  // 横方向の入力の列番号（端は複製）
+  std::vector<int> columns(static_cast<size_t>(dw) * taps.count);
+  for (uint32_t x = 0; x < dw; ++x) {
+    for (int k = 0; k < taps.count; ++k) {
+      columns[x * taps.count + k] = std::clamp(
+          static_cast<int>(2 * x) + taps.first + k, 0,
+          static_cast<int>(srcWidth) - 1);
+    }
+  }
+
+  // 入力の1行を float にした作業領域（1行につき1回だけ変換する）
+  std::vector<float> decoded(static_cast<size_t>(srcWidth) * 4);
+
+  auto horizontalRow = [&](int sy) -> const float * {
+    const int slot = sy % kRowRing;
+    float *row = ring.data() + static_cast<size_t>(slot) * dw * 4;
+    if (ringRow[slot] == sy) {
+      return row;
+    }
+    const uint8_t *in = src + static_cast<size_t>(sy) * srcStride;
+    for (uint32_t x = 0; x < srcWidth; ++x) {
+      Store4(decoded.data() + 4 * x, Decode(in + 4 * x, decodeRgb, tables));
+    }
+    for (uint32_t x = 0; x < dw; ++x) {
+      const int *cols = columns.data() + x * taps.count;
+      Pixel4 acc = Zero4();
+      for (int k = 0; k < taps.count; ++k) {
+        acc = MulAdd4(acc, taps.weights[k],
+                      Load4(decoded.data() + 4 * cols[k]));
+      }
+      Store4(row + 4 * x, acc);
+    }
+    ringRow[slot] = sy;
+    return row;
+  };
+
+  const float *rows[kMaxTaps];
+  for (size_t y = y0; y < y1; ++y) {
+    for (int k = 0; k < taps.count; ++k) {
+      rows[k] = horizontalRow(std::clamp(static_cast<int>(2 * y) +
+                                             taps.first + k,
+                                         0, static_cast<int>(srcHeight) - 1));
+    }
+    uint8_t *out = dst.pixels.data() + y * dw * 4;
+    for (uint32_t x = 0; x < dw; ++x) {
+      Pixel4 acc = Zero4();
+      for (int k = 0; k < taps.count; ++k) {
+        acc = MulAdd4(acc, taps.weights[k], Load4(rows[k] + 4 * x));
+      }
+      Encode(acc, encodeRgb, tables, out + 4 * x);
+    }
+  }
+}
+
+} // namespace
+
+uint32_t CountMipLevels(uint32_t width, uint32_t height) {
+  uint32_t levels = 1;
+  uint32_t size = std::max(width, height);
+  while (size > 1) {
+    size >>= 1;
+    ++levels;
+  }
+  return levels;
+}
+
+void DownsampleMip(const uint8_t *src, uint32_t srcWidth, uint32_t srcHeight,
+                   size_t srcStride, MipLevel &dst,
+                   const MipChainSettings &settings, core::ThreadPool *pool) {
+  dst.width = std::max(srcWidth / 2, 1u);
+  dst.height = std::max(srcHeight / 2, 1u);
+  dst.pixels.resize(static_cast<size_t>(dst.width) * dst.height * 4);
+  if (!src || srcWidth == 0 || srcHeight == 0) {
+    std::fill(dst.pixels.begin(), dst.pixels.end(), uint8_t{0});
+    return;
+  }
+
+  const size_t grain = std::max<size_t>(1, kPixelsPerChunk / dst.width);
+  if (settings.filter == MipFilter::Box && !settings.srgb) {
+    RunRange(pool, dst.height, grain, [&](size_t begin, size_t end) {
+      BoxRowsInteger(src, srcWidth, srcHeight, srcStride, dst, begin, end);
+    });
+    return;
+  }
+
+  const Taps taps = MakeTaps(settings);
+  RunRange(pool, dst.height, grain, [&](size_t begin, size_t end) {
+    FilterRows(src, srcWidth, srcHeight, srcStride, dst, taps, settings.srgb,
+               begin, end);
+  });
+}
+
+void GenerateMipChain(const uint8_t *pixels, uint32_t width, uint32_t height,
+                      size_t stride, const MipChainSettings &settings,
+                      std::vector<MipLevel> &levels, core::ThreadPool *pool) {
+  uint32_t count = CountMipLevels(width, height);
+  if (settings.maxLevels > 0) {
+    count = std::min(count, settings.maxLevels);
+  }
+  levels.resize(count - 1);
+
+  const uint8_t *src = pixels;
+  uint32_t w = width;
+  uint32_t h = height;
+  size_t srcStride = stride;
+  for (MipLevel &level : levels) {
+    DownsampleMip(src, w, h, srcStride, level, settings, pool);
+    src = level.pixels.data();
+    w = level.width;
+    h = level.height;
+    srcStride = static_cast<size_t>(w) * 4;
+  }
+}
+
+} // namespace graphics
@@ -0,0 +1,65 @@
+#pragma once
+/**
+ * @file MipChain.h
+ * @brief RGBA8 画像のミップチェーンを CPU で作る（GPU 非依存、SSE2）
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace graphics {
+
+/// @brief 1段縮小するときのフィルタ
+enum class MipFilter {
+  Box,    ///< 2x2 の平均（最速）
+  Kaiser, ///< Kaiser 窓付き sinc（6x6 タップ。細い文字がにじみにくい）
+};
+
+/// @brief ミップチェーンの設定
+struct MipChainSettings {
+  MipFilter filter = MipFilter::Box;
+  /// 色を sRGB とみなし、線形に戻してから平均する（アルファは線形のまま）
+  bool srgb = false;
+  float kaiserAlpha = 4.0f; ///< Kaiser 窓の形（大きいほど裾が狭い）
+  uint32_t maxLevels = 0; ///< レベル 0 を含む段数の上限（0 なら 1x1 まで）
+};
+
+/// @brief ミップ1段分（RGBA8、行を詰めて並べる）
+struct MipLevel {
+  uint32_t width = 0;
+  uint32_t height = 0;
+  std::vector<uint8_t> pixels;
+};
+
+/// @brief 1x1 までの段数（レベル 0 を含む）
+uint32_t CountMipLevels(uint32_t width, uint32_t height);
+
+/// @brief 1段縮小する（幅・高さはそれぞれ半分を切り捨て、最小 1）
+/// @details チャンネルの並び（RGBA / BGRA）は問わない。4 番目をアルファと
+///          して扱う。画像の外は端の画素を繰り返す。
+///          Box かつ sRGB でなければ整数のまま、それ以外は float の
+///          分離フィルタで求める。どちらも SSE2 版とスカラー版は同じ順序で
+///          演算するので、結果は環境やスレッド数によらず一致する。
+/// @param srcStride 行の間隔（バイト）。画像の一部（タイル）も渡せる
+/// @param pool 行を分けて並列に処理する（nullptr なら単一スレッド）
+void DownsampleMip(const uint8_t *src, uint32_t srcWidth, uint32_t srcHeight,
+                   size_t srcStride, MipLevel &dst,
+                   const MipChainSettings &settings,
+                   core::ThreadPool *pool = nullptr);
+
+/// @brief レベル 1 以降を作る（各段は1つ上の段から縮小する）
+/// @details タイルだけを渡してもよい。Box なら偶数境界に揃ったタイルの
+///          ミップは、全体のミップの対応する範囲と一致する。Kaiser は
+///          レベル n でタイルの周り 3 << n 画素の余白が要る。
+/// @param levels レベル 1 から順に作り直す（容量は使い回す）
+void GenerateMipChain(const uint8_t *pixels, uint32_t width, uint32_t height,
+                      size_t stride, const MipChainSettings &settings,
+                      std::vector<MipLevel> &levels,
+                      core::ThreadPool *pool = nullptr);
+
+} // namespace graphics
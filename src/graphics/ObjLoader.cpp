@@ -1,12 +1,13 @@
 #include "ObjLoader.h"
 #include "../core/Logger.h"
+#include "../core/ThreadPool.h"
 #include "TangentGenerator.h"
 #include <algorithm>
 #include <charconv>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <string_view>
-#include <unordered_map>
 #include <vector>
 
 namespace graphics {
@@ -29,39 +30,135 @@ struct ObjVertexIndex {
   }
 };
 
-struct ObjVertexIndexHash {
-  size_t operator()(const ObjVertexIndex &k) const {
-    size_t h1 = std::hash<int>()(k.v);
-    size_t h2 = std::hash<int>()(k.vt);
-    size_t h3 = std::hash<int>()(k.vn);
-    return h1 ^ (h2 << 1) ^ (h3 << 2);
+/// @brief 64bit の混ぜ合わせ（MurmurHash3 の fmix64）
+uint64_t Mix64(uint64_t h) {
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdull;
+  h ^= h >> 33;
+  h *= 0xc4ceb9fe1a85ec53ull;
+  h ^= h >> 33;
+  return h;
+}
+
+uint64_t HashVertexIndex(const ObjVertexIndex &k) {
+  const uint64_t a = static_cast<uint32_t>(k.v) |
+                     (static_cast<uint64_t>(static_cast<uint32_t>(k.vt)) << 32);
+  return Mix64(a ^ Mix64(static_cast<uint32_t>(k.vn) + 0x9e3779b97f4a7c15ull));
+}
+
+/// @brief 重複頂点をまとめる開番地法（線形探索）のハッシュ表
+/// @details 値は登録順の通し番号。キーとハッシュの下位ビットを同じ配列に
+///          持ち、探索で別の配列を見に行かない。
+class VertexIndexTable {
+public:
+  explicit VertexIndexTable(size_t expected = 0) { Rehash(expected * 2); }
+
+  /// @brief key の番号を返す。初めてのキーなら nextId を割り当てる
+  /// @param inserted 新しく登録したか
+  uint32_t FindOrInsert(const ObjVertexIndex &key, uint32_t nextId,
+                        bool &inserted) {
+    if ((m_count + 1) * 2 > m_slots.size()) {
+      Rehash(m_slots.size() * 2);
+    }
+    size_t i = HashVertexIndex(key) & m_mask;
+    for (;;) {
+      Slot &slot = m_slots[i];
+      if (slot.id == kEmpty) {
+        slot.key = key;
+        slot.id = nextId;
+        ++m_count;
+        inserted = true;
+        return nextId;
+      }
+      if (slot.key == key) {
+        inserted = false;
+        return slot.id;
+      }
+      i = (i + 1) & m_mask;
+    }
   }
+
+private:
+  static constexpr uint32_t kEmpty = 0xffffffffu;
+
+  struct Slot {
+    ObjVertexIndex key;
+    uint32_t id = kEmpty;
+  };
+
+  void Rehash(size_t minSlots) {
+    size_t capacity = 16;
+    while (capacity < minSlots) {
+      capacity *= 2;
+    }
+    std::vector<Slot> old = std::move(m_slots);
+    m_slots.assign(capacity, Slot{});
+    m_mask = capacity - 1;
+    for (const Slot &slot : old) {
+      if (slot.id != kEmpty) {
+        size_t i = HashVertexIndex(slot.key) & m_mask;
+        while (m_slots[i].id != kEmpty) {
+          i = (i + 1) & m_mask;
+        }
+        m_slots[i] = slot;
+      }
+    }
+  }
+
+  std::vector<Slot> m_slots;
+  size_t m_mask = 0;
+  size_t m_count = 0;
+};
+
+/// @brief 1面分の参照（角は ObjChunk::corners の [firstCorner, +cornerCount)）
+struct ObjFace {
+  uint32_t firstCorner = 0;
+  uint32_t cornerCount = 0;
+  /// 面を読んだ時点でチャンク内にある v / vt / vn の数（負のインデックス用）
+  uint32_t positionCount = 0;
+  uint32_t texCoordCount = 0;
+  uint32_t normalCount = 0;
+};
+
+/// @brief 初めて使われた頂点。各要素がその時点で読み込み済みだったか
+struct ObjUniqueVertex {
+  ObjVertexIndex key;
+  uint32_t validMask = 0; ///< bit0: v, bit1: vt, bit2: vn
+};
+
+/// @brief バッファの一部（行の先頭から始まる）を解析した結果
+struct ObjChunk {
+  std::vector<XMFLOAT3> positions;
+  std::vector<XMFLOAT2> texCoords;
+  std::vector<XMFLOAT3> normals;
+  std::vector<ObjVertexIndex> corners; ///< ファイルに書かれたままの番号
+  std::vector<ObjFace> faces;
+  /// 数値の読み取りが改行をまたいだ（壊れた行。分割すると結果が変わる）
+  bool crossedLine = false;
+
+  // 以下は結合時に埋める
+  size_t positionBase = 0;
+  size_t texCoordBase = 0;
+  size_t normalBase = 0;
+  size_t indexBase = 0;
+  size_t indexCount = 0;
+  std::vector<ObjUniqueVertex> uniques; ///< チャンク内で初めて使われた順
+  std::vector<uint32_t> remap;          ///< チャンク内の番号 -> 全体の番号
 };
 
 //==============================================================================
 // Modern Fast Obj Parser (C++17/20)
 //==============================================================================
 
-class FastObjParser {
+/// @brief 行の先頭から始まる範囲を解析する（ファイル全体でもその一部でもよい）
+class ObjChunkParser {
 public:
-  FastObjParser(const std::string &path) : m_path(path) {}
-
-  bool Parse(std::vector<Vertex> &outVertices,
-             std::vector<uint32_t> &outIndices) {
-    if (!ReadFile())
-      return false;
+  explicit ObjChunkParser(ObjChunk &chunk) : m_chunk(chunk) {}
 
-    std::string_view sv(m_buffer);
+  void Parse(std::string_view sv) {
     m_cursor = 0;
     m_line = 1;
 
-    // 予約 (ヒューリスティック)
-    m_positions.reserve(4096);
-    m_texCoords.reserve(4096);
-    m_normals.reserve(4096);
-    outVertices.reserve(4096);
-    outIndices.reserve(8192);
-
     while (m_cursor < sv.size()) {
       SkipWhitespace(sv);
       if (m_cursor >= sv.size())
@@ -81,46 +178,19 @@ public:
       } else if (token == "vn") {
         ParseNormal(sv);
       } else if (token == "f") {
-        ParseFace(sv, outVertices, outIndices);
+        ParseFace(sv);
       } else {
         // 不明な・あるいは対応不要な行 (g, o, s, mtllib, usemtl etc)
         SkipLine(sv);
       }
     }
-
-    return true;
   }
 
 private:
-  std::string m_path;
-  std::string m_buffer; // string_viewのオーナー
+  ObjChunk &m_chunk;
   size_t m_cursor = 0;
   int m_line = 1;
 
-  std::vector<XMFLOAT3> m_positions;
-  std::vector<XMFLOAT2> m_texCoords;
-  std::vector<XMFLOAT3> m_normals;
-
-  std::unordered_map<ObjVertexIndex, uint32_t, ObjVertexIndexHash> m_indexMap;
-
-  bool ReadFile() {
-    // バイナリモードで開き、サイズを取得して一括読み込み
-    std::ifstream file(m_path, std::ios::binary | std::ios::ate);
-    if (!file.is_open()) {
-      LOG_ERROR("ObjLoader", "ファイルオープン失敗: {}", m_path);
-      return false;
-    }
-
-    auto size = file.tellg();
-    if (size <= 0)
-      return true; // 空ファイルは成功扱い（何もしない）
-
-    m_buffer.resize(static_cast<size_t>(size));
-    file.seekg(0);
-    file.read(m_buffer.data(), size);
-    return true;
-  }
-
   char Peek(std::string_view sv) const {
     if (m_cursor < sv.size())
       return sv[m_cursor];
@@ -166,7 +236,10 @@ private:
   }
 
   float ParseFloat(std::string_view sv) {
+    const int line = m_line;
     SkipWhitespace(sv);
+    if (m_line != line)
+      m_chunk.crossedLine = true;
     if (m_cursor >= sv.size())
       return 0.0f;
 
@@ -210,14 +283,14 @@ private:
     float y = ParseFloat(sv);
     float z = ParseFloat(sv);
     // Z反転 (RH -> LH)
-    m_positions.push_back({x, y, -z});
+    m_chunk.positions.push_back({x, y, -z});
   }
 
   void ParseTexCoord(std::string_view sv) {
     float u = ParseFloat(sv);
     float v = ParseFloat(sv);
     // V反転 (OpenGL -> DirectX)
-    m_texCoords.push_back({u, 1.0f - v});
+    m_chunk.texCoords.push_back({u, 1.0f - v});
   }
 
   void ParseNormal(std::string_view sv) {
@@ -225,13 +298,15 @@ private:
     float y = ParseFloat(sv);
     float z = ParseFloat(sv);
     // Z反転 (RH -> LH)
-    m_normals.push_back({x, y, -z});
+    m_chunk.normals.push_back({x, y, -z});
   }
 
-  void ParseFace(std::string_view sv, std::vector<Vertex> &outVertices,
-                 std::vector<uint32_t> &outIndices) {
-    std::vector<ObjVertexIndex> faceIndices;
-    faceIndices.reserve(4);
+  void ParseFace(std::string_view sv) {
+    ObjFace face;
+    face.firstCorner = static_cast<uint32_t>(m_chunk.corners.size());
+    face.positionCount = static_cast<uint32_t>(m_chunk.positions.size());
+    face.texCoordCount = static_cast<uint32_t>(m_chunk.texCoords.size());
+    face.normalCount = static_cast<uint32_t>(m_chunk.normals.size());
 
     while (m_cursor < sv.size()) {
       // 行末チェック
@@ -246,6 +321,7 @@ private:
       }
 
       // 数値読み取り開始
+      const size_t cornerStart = m_cursor;
       ObjVertexIndex idx;
       idx.v = ParseInt(sv);
 
@@ -267,58 +343,281 @@ private:
         }
       }
 
-      // インデックス補正 (1-based -> 0-based, 負数は末尾からのオフセット)
-      idx.v = FixIndex(idx.v, m_positions.size());
-      idx.vt = FixIndex(idx.vt, m_texCoords.size());
-      idx.vn = FixIndex(idx.vn, m_normals.size());
+      // 数値でない語は読み飛ばす（進まないと同じ位置を読み続ける）
+      if (m_cursor == cornerStart) {
+        ReadToken(sv);
+        continue;
+      }
+
+      // 番号の補正（1 始まり・負数）は結合時にまとめて行う
+      m_chunk.corners.push_back(idx);
+    }
+
+    face.cornerCount =
+        static_cast<uint32_t>(m_chunk.corners.size()) - face.firstCorner;
+    m_chunk.faces.push_back(face);
+  }
+};
+
+//==============================================================================
+// チャンクの結合
+//==============================================================================
+
+/// @brief 行の先頭で始まるチャンクの開始位置を決める
+/// @details chunkCount 等分した位置から次の改行の直後へずらす。
+std::vector<size_t> SplitAtLines(std::string_view sv, size_t chunkCount) {
+  std::vector<size_t> starts = {0};
+  for (size_t k = 1; k < chunkCount; ++k) {
+    size_t pos = std::max(sv.size() * k / chunkCount, starts.back());
+    const size_t newline = sv.find('\n', pos);
+    if (newline == std::string_view::npos) {
+      break;
+    }
+    pos = newline + 1;
+    if (pos < sv.size() && pos > starts.back()) {
+      starts.push_back(pos);
+    }
+  }
+  return starts;
+}
+
+/// @brief 1 始まり・負数（末尾から）の番号を 0 始まりへ（なければ -1）
+int FixIndex(int idx, size_t size) {
+  if (idx > 0)
+    return idx - 1;
+  if (idx < 0)
+    return static_cast<int>(size) + idx;
+  return -1;
+}
 
-      faceIndices.push_back(idx);
+uint32_t TriangulatedIndexCount(const ObjChunk &chunk) {
+  uint32_t count = 0;
+  for (const ObjFace &face : chunk.faces) {
+    if (face.cornerCount >= 3) {
+      count += (face.cornerCount - 2) * 3;
     }
+  }
+  return count;
+}
+
+/// @brief 面を三角形へ分割（Fan）し、チャンク内で重複頂点をまとめる
+/// @details indices にはチャンク内の番号を書く。全体の番号への付け替えは
+///          全チャンクの結果がそろってから行う。
+void DedupChunk(ObjChunk &chunk, uint32_t *indices) {
+  VertexIndexTable table(chunk.corners.size() / 2);
+  size_t written = 0;
+  auto addCorner = [&](const ObjFace &face, uint32_t corner) {
+    const ObjVertexIndex &raw = chunk.corners[face.firstCorner + corner];
+    // 面を読んだ時点でファイル全体に読み込み済みだった数
+    const size_t positions = chunk.positionBase + face.positionCount;
+    const size_t texCoords = chunk.texCoordBase + face.texCoordCount;
+    const size_t normals = chunk.normalBase + face.normalCount;
+    ObjVertexIndex key;
+    key.v = FixIndex(raw.v, positions);
+    key.vt = FixIndex(raw.vt, texCoords);
+    key.vn = FixIndex(raw.vn, normals);
+
+    const uint32_t nextId = static_cast<uint32_t>(chunk.uniques.size());
+    bool inserted = false;
+    indices[written++] = table.FindOrInsert(key, nextId, inserted);
+    if (inserted) {
+      uint32_t validMask = 0;
+      validMask |= (key.v >= 0 && key.v < (int)positions) ? 1u : 0u;
+      validMask |= (key.vt >= 0 && key.vt < (int)texCoords) ? 2u : 0u;
+      validMask |= (key.vn >= 0 && key.vn < (int)normals) ? 4u : 0u;
+      chunk.uniques.push_back({key, validMask});
+    }
+  };
+  for (const ObjFace &face : chunk.faces) {
+    for (uint32_t i = 1; i + 1 < face.cornerCount; ++i) {
+      addCorner(face, 0);
+      addCorner(face, i + 1);
+      addCorner(face, i);
+    }
+  }
+}
 
-    // 三角形分割 (Fan)
-    if (faceIndices.size() >= 3) {
-      for (size_t i = 1; i < faceIndices.size() - 1; ++i) {
-        AddVertex(faceIndices[0], outVertices, outIndices);
-        AddVertex(faceIndices[i + 1], outVertices, outIndices);
-        AddVertex(faceIndices[i], outVertices, outIndices);
+template <typename T>
+void Concatenate(std::vector<T> ObjChunk::*member, size_t ObjChunk::*base,
+                 const std::vector<ObjChunk> &chunks, std::vector<T> &out,
+                 size_t chunk) {
+  const std::vector<T> &src = chunks[chunk].*member;
+  if (!src.empty()) {
+    std::memcpy(out.data() + chunks[chunk].*base, src.data(),
+                src.size() * sizeof(T));
+  }
+}
+
+template <typename Fn>
+void RunChunks(core::ThreadPool *pool, size_t count, Fn &&fn) {
+  if (pool && count > 1) {
+    pool->ParallelFor(count, 1, [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        fn(i);
       }
+    });
+  } else {
+    for (size_t i = 0; i < count; ++i) {
+      fn(i);
     }
   }
+}
+
+/// @brief 1 チャンクあたりの最小バイト数（小さなファイルは分けない）
+constexpr size_t kMinChunkBytes = 1u << 20;
+
+class FastObjParser {
+public:
+  FastObjParser(const std::string &path) : m_path(path) {}
+
+  bool Parse(std::vector<Vertex> &outVertices,
+             std::vector<uint32_t> &outIndices, core::ThreadPool *pool) {
+    outVertices.clear();
+    outIndices.clear();
+    if (!ReadFile())
+      return false;
 
-  int FixIndex(int idx, size_t size) {
-    if (idx > 0)
-      return idx - 1;
-    if (idx < 0)
-      return static_cast<int>(size) + idx;
-    return -1;
+    const std::string_view sv(m_buffer);
+    size_t chunkCount = 1;
+    if (pool) {
+      chunkCount = std::clamp<size_t>(sv.size() / kMinChunkBytes, 1,
+                                      pool->GetConcurrency() * 4);
+    }
+    const std::vector<size_t> starts = SplitAtLines(sv, chunkCount);
+    std::vector<ObjChunk> chunks(starts.size());
+    RunChunks(pool, chunks.size(), [&](size_t k) {
+      const size_t end = k + 1 < starts.size() ? starts[k + 1] : sv.size();
+      ObjChunkParser(chunks[k]).Parse(sv.substr(starts[k], end - starts[k]));
+    });
+
+    // 壊れた行が境界をまたぐと 1 本で読んだ結果と変わるので読み直す
+    if (chunks.size() > 1 &&
+        std::any_of(chunks.begin(), chunks.end(),
+                    [](const ObjChunk &c) { return c.crossedLine; })) {
+      chunks.assign(1, ObjChunk{});
+      ObjChunkParser(chunks[0]).Parse(sv);
+    }
+    Merge(chunks, outVertices, outIndices, pool);
+    return true;
   }
 
-  void AddVertex(const ObjVertexIndex &idx, std::vector<Vertex> &outVertices,
-                 std::vector<uint32_t> &outIndices) {
-    if (m_indexMap.find(idx) == m_indexMap.end()) {
-      Vertex v = {};
-      if (idx.v >= 0 && idx.v < (int)m_positions.size())
-        v.position = m_positions[idx.v];
-      if (idx.vt >= 0 && idx.vt < (int)m_texCoords.size())
-        v.texCoord = m_texCoords[idx.vt];
-      if (idx.vn >= 0 && idx.vn < (int)m_normals.size())
-        v.normal = m_normals[idx.vn];
-      v.color = {1.0f, 1.0f, 1.0f, 1.0f};
-
-      uint32_t newIndex = static_cast<uint32_t>(outVertices.size());
-      m_indexMap[idx] = newIndex;
-      outVertices.push_back(v);
+private:
+  std::string m_path;
+  std::string m_buffer; // string_viewのオーナー
+
+  bool ReadFile() {
+    // バイナリモードで開き、サイズを取得して一括読み込み
+    std::ifstream file(m_path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+      LOG_ERROR("ObjLoader", "ファイルオープン失敗: {}", m_path);
+      return false;
+    }
+
+    auto size = file.tellg();
+    if (size <= 0)
+      return true; // 空ファイルは成功扱い（何もしない）
+
+    m_buffer.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    file.read(m_buffer.data(), size);
+    return true;
+  }
+
+  /// @brief 各チャンクの結果を先頭からの累積で並べ、1 本で読んだときと
+  ///        同じ頂点順（初めて使われた順）・インデックスにする
+  void Merge(std::vector<ObjChunk> &chunks, std::vector<Vertex> &outVertices,
+             std::vector<uint32_t> &outIndices, core::ThreadPool *pool) {
+    size_t positions = 0, texCoords = 0, normals = 0, indices = 0;
+    for (ObjChunk &chunk : chunks) {
+      chunk.positionBase = positions;
+      chunk.texCoordBase = texCoords;
+      chunk.normalBase = normals;
+      chunk.indexBase = indices;
+      chunk.indexCount = TriangulatedIndexCount(chunk);
+      positions += chunk.positions.size();
+      texCoords += chunk.texCoords.size();
+      normals += chunk.normals.size();
+      indices += chunk.indexCount;
+    }
+
+    std::vector<XMFLOAT3> allPositions(positions);
+    std::vector<XMFLOAT2> allTexCoords(texCoords);
+    std::vector<XMFLOAT3> allNormals(normals);
+    outIndices.resize(indices);
+    RunChunks(pool, chunks.size(), [&](size_t k) {
+      Concatenate(&ObjChunk::positions, &ObjChunk::positionBase, chunks,
+                  allPositions, k);
+      Concatenate(&ObjChunk::texCoords, &ObjChunk::texCoordBase, chunks,
+                  allTexCoords, k);
+      Concatenate(&ObjChunk::normals, &ObjChunk::normalBase, chunks,
+                  allNormals, k);
+      DedupChunk(chunks[k], outIndices.data() + chunks[k].indexBase);
+    });
+
+    // チャンク内で初めて使われた頂点を先頭から順に全体の表へ入れる。
+    // 全体で初めて使われるチャンクが最初に登録するので、順序は 1 本で
+    // 読んだときと一致する
+    std::vector<ObjUniqueVertex> uniques;
+    if (chunks.size() == 1) {
+      uniques = std::move(chunks[0].uniques);
+    } else {
+      size_t localTotal = 0;
+      for (const ObjChunk &chunk : chunks) {
+        localTotal += chunk.uniques.size();
+      }
+      VertexIndexTable table(localTotal);
+      uniques.reserve(localTotal);
+      for (ObjChunk &chunk : chunks) {
+        chunk.remap.resize(chunk.uniques.size());
+        for (size_t i = 0; i < chunk.uniques.size(); ++i) {
+          const uint32_t nextId = static_cast<uint32_t>(uniques.size());
+          bool inserted = false;
+          chunk.remap[i] =
+              table.FindOrInsert(chunk.uniques[i].key, nextId, inserted);
+          if (inserted) {
+            uniques.push_back(chunk.uniques[i]);
+          }
+        }
+      }
+      RunChunks(pool, chunks.size(), [&](size_t k) {
+        const ObjChunk &chunk = chunks[k];
+        uint32_t *dst = outIndices.data() + chunk.indexBase;
+        for (size_t i = 0; i < chunk.indexCount; ++i) {
+          dst[i] = chunk.remap[dst[i]];
+        }
+      });
+    }
+
+    outVertices.resize(uniques.size());
+    auto build = [&](size_t begin, size_t end) {
+      for (size_t i = begin; i < end; ++i) {
+        const ObjUniqueVertex &u = uniques[i];
+        Vertex v = {};
+        if (u.validMask & 1u)
+          v.position = allPositions[u.key.v];
+        if (u.validMask & 2u)
+          v.texCoord = allTexCoords[u.key.vt];
+        if (u.validMask & 4u)
+          v.normal = allNormals[u.key.vn];
+        v.color = {1.0f, 1.0f, 1.0f, 1.0f};
+        outVertices[i] = v;
+      }
+    };
+    if (pool && chunks.size() > 1) {
+      pool->ParallelFor(uniques.size(), 0, build);
+    } else {
+      build(0, uniques.size());
     }
-    outIndices.push_back(m_indexMap[idx]);
   }
 };
 
 } // namespace
 
 bool ObjLoader::Load(const std::string &path, std::vector<Vertex> &outVertices,
-                     std::vector<uint32_t> &outIndices) {
+                     std::vector<uint32_t> &outIndices,
+                     core::ThreadPool *pool) {
   FastObjParser parser(path);
-  if (!parser.Parse(outVertices, outIndices)) {
+  if (!parser.Parse(outVertices, outIndices, pool)) {
     return false;
   }
 
@@ -3,6 +3,9 @@
 #include <string>
 #include <vector>
 
+namespace core {
+class ThreadPool;
+}
 
 namespace graphics {
 
@@ -13,9 +16,12 @@ public:
   /// @param path ファイルパス
   /// @param outVertices 頂点データの出力先
   /// @param outIndices インデックスデータの出力先
+  /// @param pool 指定すると大きなファイルを行単位に分けて並列に解析する
+  ///             （結果は 1 スレッドで読んだときと同じ）
   /// @return 成功時 true
   static bool Load(const std::string &path, std::vector<Vertex> &outVertices,
-                   std::vector<uint32_t> &outIndices);
+                   std::vector<uint32_t> &outIndices,
+                   core::ThreadPool *pool = nullptr);
 };
 
 } // namespace graphics
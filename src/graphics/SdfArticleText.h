@@ -0,0 +1,26 @@
+#pragma once
+/**
+ * @file SdfArticleText.h
+ * @brief SDF グリフで描く記事の文字（GPU 側のリソース）
+ */
+
+#include <cstdint>
+#include <d3d11.h>
+#include <wrl/client.h>
+
+namespace graphics {
+
+/// @brief 記事1ページ分のグリフの四角形と、それが引くアトラス
+/// @details アトラスは WikiTextureGenerator がページをまたいで使い回す
+///          （メモリは記事の長さによらない）。四角形は GlyphInstance の
+///          構造化バッファで、頂点シェーダーが SV_InstanceID で引く。
+struct SdfArticleText {
+  Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> atlasSRV; ///< R8
+  Microsoft::WRL::ComPtr<ID3D11Buffer> instanceBuffer;
+  Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> instanceSRV;
+  uint32_t instanceCount = 0;
+  uint32_t width = 0;  ///< 記事のピクセル幅（四角形の座標系）
+  uint32_t height = 0; ///< 記事のピクセル高さ
+};
+
+} // namespace graphics
@@ -0,0 +1,269 @@
+/**
+ * @file SdfGlyphAtlas.cpp
+ * @brief 符号付き距離場のグリフアトラスの実装
+ */
+
+#include "SdfGlyphAtlas.h"
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace graphics {
+
+namespace {
+
+/// @brief ビットマップのピクセル座標（y は下）の線分
+struct Segment {
+  float ax, ay, bx, by;
+};
+
+/// @brief 点 (px, py) から線分までの距離の2乗
+float DistanceSquared(const Segment &s, float px, float py) {
+  const float dx = s.bx - s.ax;
+  const float dy = s.by - s.ay;
+  const float lengthSq = dx * dx + dy * dy;
+  float t = 0.0f;
+  if (lengthSq > 0.0f) {
+    t = std::clamp(((px - s.ax) * dx + (py - s.ay) * dy) / lengthSq, 0.0f,
+                   1.0f);
+  }
+  const float ex = s.ax + t * dx - px;
+  const float ey = s.ay + t * dy - py;
+  return ex * ex + ey * ey;
+}
+
+uint64_t MakeKey(ArticleFont font, char32_t c) {
+  return (static_cast<uint64_t>(font) << 32) | c;
+}
+
+} // namespace
+
+SdfGlyphAtlas::SdfGlyphAtlas(const SdfAtlasConfig &config) : m_config(config) {
+  m_config.size = std::clamp<uint32_t>(m_config.size, kSolidSize * 2, 65535);
+  m_config.pixelsPerEm = std::max(m_config.pixelsPerEm, 1.0f);
+  m_config.spread = std::max(m_config.spread, 0.5f);
+  m_pixels.assign(static_cast<size_t>(m_config.size) * m_config.size, 0);
+  ResetSolid();
+}
+
+void SdfGlyphAtlas::ResetSolid() {
+  // 左上の塗りつぶし領域（矩形は全面この1点を引く）
+  for (uint32_t y = 0; y < kSolidSize; ++y) {
+    std::fill_n(m_pixels.begin() + static_cast<size_t>(y) * m_config.size,
+                kSolidSize, uint8_t{255});
+  }
+  m_shelfX = kSolidSize + m_config.padding;
+  m_shelfY = 0;
+  m_shelfHeight = kSolidSize + m_config.padding;
+  MarkDirty(0, 0, kSolidSize, kSolidSize);
+}
+
+void SdfGlyphAtlas::Clear() {
+  std::fill(m_pixels.begin(), m_pixels.end(), uint8_t{0});
+  m_glyphs.clear();
+  m_missing.clear();
+  m_stats.glyphs = 0;
+  m_stats.usedHeight = 0;
+  ResetSolid();
+  MarkDirty(0, 0, m_config.size, m_config.size);
+}
+
+bool SdfGlyphAtlas::Allocate(uint32_t width, uint32_t height, uint32_t &x,
+                             uint32_t &y) {
+  const uint32_t size = m_config.size;
+  if (width > size || height > size) {
+    return false;
+  }
+  if (m_shelfX + width > size) {
+    // 次の棚へ
+    m_shelfY += m_shelfHeight;
+    m_shelfX = 0;
+    m_shelfHeight = 0;
+  }
+  if (m_shelfY + height > size) {
+    return false;
+  }
+  x = m_shelfX;
+  y = m_shelfY;
+  m_shelfX += width;
+  m_shelfHeight = std::max(m_shelfHeight, height);
+  m_stats.usedHeight = m_shelfY + m_shelfHeight;
+  return true;
+}
+
+void SdfGlyphAtlas::MarkDirty(uint32_t x, uint32_t y, uint32_t width,
+                              uint32_t height) {
+  if (!m_dirty) {
+    m_dirty = true;
+    m_dirtyX0 = x;
+    m_dirtyY0 = y;
+    m_dirtyX1 = x + width;
+    m_dirtyY1 = y + height;
+    return;
+  }
+  m_dirtyX0 = std::min(m_dirtyX0, x);
+  m_dirtyY0 = std::min(m_dirtyY0, y);
+  m_dirtyX1 = std::max(m_dirtyX1, x + width);
+  m_dirtyY1 = std::max(m_dirtyY1, y + height);
+}
+
+bool SdfGlyphAtlas::TakeDirtyRect(uint32_t &x0, uint32_t &y0, uint32_t &x1,
+                                  uint32_t &y1) {
+  if (!m_dirty) {
+    return false;
+  }
+  x0 = m_dirtyX0;
+  y0 = m_dirtyY0;
+  x1 = m_dirtyX1;
+  y1 = m_dirtyY1;
+  m_dirty = false;
+  return true;
+}
+
+const SdfGlyph *SdfGlyphAtlas::GetOrAdd(ArticleFont font, char32_t c,
+                                        const GlyphOutlineProvider &provider) {
+  const uint64_t key = MakeKey(font, c);
+  auto it = m_glyphs.find(key);
+  if (it != m_glyphs.end()) {
+    return &it->second;
+  }
+  if (m_missing.count(key)) {
+    return nullptr;
+  }
+
+  GlyphOutline outline;
+  if (!provider.GetOutline(font, c, outline)) {
+    m_missing.insert(key);
+    ++m_stats.failed;
+    return nullptr;
+  }
+
+  float minX = std::numeric_limits<float>::max();
+  float minY = minX;
+  float maxX = std::numeric_limits<float>::lowest();
+  float maxY = maxX;
+  for (const auto &contour : outline.contours) {
+    for (const GlyphPoint &p : contour) {
+      minX = std::min(minX, p.x);
+      maxX = std::max(maxX, p.x);
+      minY = std::min(minY, p.y);
+      maxY = std::max(maxY, p.y);
+    }
+  }
+  SdfGlyph glyph;
+  if (minX > maxX) {
+    // 空白: 描くものはないが、次から引けるように置いておく
+    return &m_glyphs.emplace(key, glyph).first->second;
+  }
+
+  // 輪郭の外側 spread までを含む矩形（ピクセル、y は下向き）
+  const float ppem = m_config.pixelsPerEm;
+  const float spread = m_config.spread;
+  const int px0 = static_cast<int>(std::floor(minX * ppem - spread));
+  const int px1 = static_cast<int>(std::ceil(maxX * ppem + spread));
+  const int py0 = static_cast<int>(std::floor(-maxY * ppem - spread));
+  const int py1 = static_cast<int>(std::ceil(-minY * ppem + spread));
+  const auto width = static_cast<uint32_t>(px1 - px0);
+  const auto height = static_cast<uint32_t>(py1 - py0);
+
+  uint32_t x = 0;
+  uint32_t y = 0;
+  if (!Allocate(width + m_config.padding, height + m_config.padding, x, y)) {
+    m_missing.insert(key);
+    ++m_stats.failed;
+    return nullptr;
+  }
+
+  Rasterize(outline, ppem, spread, static_cast<float>(-px0),
+            static_cast<float>(-py0), width, height,
+            m_pixels.data() + static_cast<size_t>(y) * m_config.size + x,
+            m_config.size);
+  MarkDirty(x, y, width, height);
+
+  glyph.x = static_cast<uint16_t>(x);
+  glyph.y = static_cast<uint16_t>(y);
+  glyph.width = static_cast<uint16_t>(width);
+  glyph.height = static_cast<uint16_t>(height);
+  glyph.left = px0 / ppem;
+  glyph.top = py0 / ppem;
+  glyph.emWidth = width / ppem;
+  glyph.emHeight = height / ppem;
+  ++m_stats.glyphs;
+  ++m_stats.rasterized;
+  return &m_glyphs.emplace(key, glyph).first->second;
+}
+
+void SdfGlyphAtlas::Rasterize(const GlyphOutline &outline, float pixelsPerEm,
+                              float spread, float originX, float originY,
+                              uint32_t width, uint32_t height,
+                              uint8_t *pixels, size_t stride) {
+  std::vector<Segment> segments;
+  for (const auto &contour : outline.contours) {
+    const size_t n = contour.size();
+    for (size_t i = 0; i < n; ++i) {
+      const GlyphPoint &a = contour[i];
+      const GlyphPoint &b = contour[(i + 1) % n];
+      segments.push_back({originX + a.x * pixelsPerEm,
+                          originY - a.y * pixelsPerEm,
+                          originX + b.x * pixelsPerEm,
+                          originY - b.y * pixelsPerEm});
+    }
+  }
+
+  struct Crossing {
+    float x;
+    int winding;
+  };
+  std::vector<Crossing> crossings;
+  std::vector<const Segment *> nearby;
+  const float spreadSq = spread * spread;
+  const float scale = 0.5f / spread;
+
+  for (uint32_t row = 0; row < height; ++row) {
+    const float cy = row + 0.5f;
+
+    // この行を横切る辺（内外判定）と、spread 以内に来うる辺（距離）
+    crossings.clear();
+    nearby.clear();
+    for (const Segment &s : segments) {
+      if ((s.ay <= cy && cy < s.by) || (s.by <= cy && cy < s.ay)) {
+        const float t = (cy - s.ay) / (s.by - s.ay);
+        crossings.push_back({s.ax + t * (s.bx - s.ax), s.ay < s.by ? 1 : -1});
+      }
+      if (std::min(s.ay, s.by) - spread <= cy &&
+          cy <= std::max(s.ay, s.by) + spread) {
+        nearby.push_back(&s);
+      }
+    }
+    std::sort(crossings.begin(), crossings.end(),
+              [](const Crossing &a, const Crossing &b) { return a.x < b.x; });
+
+    uint8_t *out = pixels + row * stride;
+    size_t next = 0;
+    int winding = 0;
+    for (uint32_t col = 0; col < width; ++col) {
+      const float cx = col + 0.5f;
+      while (next < crossings.size() && crossings[next].x < cx) {
+        winding += crossings[next].winding;
+        ++next;
+      }
+
+      float best = spreadSq;
+      for (const Segment *s : nearby) {
+        const float gapX =
+            std::max({std::min(s->ax, s->bx) - cx, cx - std::max(s->ax, s->bx),
+                      0.0f});
+        if (gapX * gapX >= best) {
+          continue;
+        }
+        best = std::min(best, DistanceSquared(*s, cx, cy));
+      }
+      const float distance = std::sqrt(best);
+      const float signedDistance = winding != 0 ? distance : -distance;
+      const float value = std::clamp(0.5f + signedDistance * scale, 0.0f, 1.0f);
+      out[col] = static_cast<uint8_t>(value * 255.0f + 0.5f);
+    }
+  }
+}
+
+} // namespace graphics
@@ -0,0 +1,135 @@
+#pragma once
+/**
+ * @file SdfGlyphAtlas.h
+ * @brief グリフのアウトラインから CPU で作る符号付き距離場アトラス
+ *
+ * 記事の文字を1枚の巨大なビットマップに描く代わりに、使う文字だけを
+ * 固定サイズのアトラスに距離場として置き、地形の上に四角形で描く。
+ * どの大きさで描いても輪郭がぼけず、メモリは記事の長さによらない。
+ */
+
+#include "GlyphMetrics.h"
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace graphics {
+
+/// @brief アウトラインの点（em 単位、原点はベースライン上のペン位置、y は上）
+struct GlyphPoint {
+  float x = 0.0f;
+  float y = 0.0f;
+};
+
+/// @brief グリフのアウトライン（曲線は折れ線にしておく）
+struct GlyphOutline {
+  /// 閉じた輪郭（最後の点と最初の点をつなぐ）。向きは非ゼロ規則で解釈する
+  std::vector<std::vector<GlyphPoint>> contours;
+};
+
+/// @brief グリフのアウトラインを返すインターフェース
+/// @details DirectWrite 版はゲーム内で、ヘッドレスのテストと
+///          ベンチマークは合成したアウトラインを使う。
+class GlyphOutlineProvider {
+public:
+  virtual ~GlyphOutlineProvider() = default;
+
+  /// @brief アウトラインを取得する
+  /// @return 文字を描けなければ false（空白は true で輪郭なし）
+  virtual bool GetOutline(ArticleFont font, char32_t c,
+                          GlyphOutline &outline) const = 0;
+};
+
+/// @brief アトラスの設定
+struct SdfAtlasConfig {
+  uint32_t size = 2048;       ///< アトラスの一辺（R8、4MB）
+  float pixelsPerEm = 32.0f;  ///< 距離場を作る解像度
+  float spread = 4.0f;        ///< 距離を記録する幅（ピクセル、片側）
+  uint32_t padding = 1;       ///< グリフ間の隙間（ピクセル）
+};
+
+/// @brief アトラス上の1グリフ
+struct SdfGlyph {
+  uint16_t x = 0, y = 0;          ///< アトラス上の左上（ピクセル）
+  uint16_t width = 0, height = 0; ///< 0 なら描くものがない（空白）
+  /// 四角形の左上（em 単位、ペン位置から。y は下向き）と大きさ
+  float left = 0.0f, top = 0.0f;
+  float emWidth = 0.0f, emHeight = 0.0f;
+
+  bool IsEmpty() const { return width == 0; }
+};
+
+/// @brief アトラスの統計
+struct SdfAtlasStats {
+  size_t glyphs = 0;     ///< 置いたグリフ数
+  size_t rasterized = 0; ///< 距離場を作った回数（Clear しても数え続ける）
+  size_t failed = 0;     ///< 満杯・アウトラインなしで置けなかった回数
+  uint32_t usedHeight = 0; ///< 棚が使っている高さ（ピクセル）
+};
+
+/// @brief 符号付き距離場のグリフアトラス
+/// @details 棚詰め（行ごとに左から詰める）で置き、満杯になったら
+///          それ以上は置かない（呼び出し側が Clear して置き直す）。
+///          画素は 0.5 が輪郭、内側ほど大きい（8bit）。左上の
+///          小さな塗りつぶし領域は矩形（ボタン・罫線）の描画に使う。
+///          スレッドセーフではない。
+class SdfGlyphAtlas {
+public:
+  explicit SdfGlyphAtlas(const SdfAtlasConfig &config = {});
+
+  /// @brief グリフを取得し、なければ距離場を作って置く
+  /// @return 置けなければ nullptr
+  const SdfGlyph *GetOrAdd(ArticleFont font, char32_t c,
+                           const GlyphOutlineProvider &provider);
+
+  /// @brief 置いたグリフを捨てる（画素もゼロにする）
+  void Clear();
+
+  const SdfAtlasConfig &GetConfig() const { return m_config; }
+  uint32_t GetSize() const { return m_config.size; }
+  const std::vector<uint8_t> &GetPixels() const { return m_pixels; }
+  const SdfAtlasStats &GetStats() const { return m_stats; }
+
+  /// @brief 塗りつぶし領域の中心（アトラス上のピクセル）
+  float GetSolidX() const { return kSolidSize * 0.5f; }
+  float GetSolidY() const { return kSolidSize * 0.5f; }
+
+  /// @brief 前回から変わった画素の範囲 [x0, x1) x [y0, y1) を取り出す
+  /// @return 変化がなければ false
+  bool TakeDirtyRect(uint32_t &x0, uint32_t &y0, uint32_t &x1,
+                     uint32_t &y1);
+
+  /// @brief アウトラインから距離場を作る（アトラスとは独立に使える）
+  /// @param originX, originY em の原点の位置（ビットマップのピクセル、y は下）
+  /// @param pixels width x height を stride バイトおきに書き込む
+  static void Rasterize(const GlyphOutline &outline, float pixelsPerEm,
+                        float spread, float originX, float originY,
+                        uint32_t width, uint32_t height, uint8_t *pixels,
+                        size_t stride);
+
+private:
+  static constexpr uint32_t kSolidSize = 4;
+
+  /// @brief 棚に width x height の場所を取る
+  bool Allocate(uint32_t width, uint32_t height, uint32_t &x, uint32_t &y);
+  void MarkDirty(uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+  void ResetSolid();
+
+  SdfAtlasConfig m_config;
+  std::vector<uint8_t> m_pixels;
+  std::unordered_map<uint64_t, SdfGlyph> m_glyphs;
+  /// 置けなかった文字（Clear するまで再試行しない）
+  std::unordered_set<uint64_t> m_missing;
+
+  uint32_t m_shelfX = 0;
+  uint32_t m_shelfY = 0;
+  uint32_t m_shelfHeight = 0;
+
+  bool m_dirty = false;
+  uint32_t m_dirtyX0 = 0, m_dirtyY0 = 0, m_dirtyX1 = 0, m_dirtyY1 = 0;
+  SdfAtlasStats m_stats;
+};
+
+} // namespace graphics
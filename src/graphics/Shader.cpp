@@ -13,17 +13,28 @@ bool Shader::LoadFromFile(
     const std::string &vsEntry, const std::wstring &psPath,
     const std::string &psEntry,
     const std::vector<D3D11_INPUT_ELEMENT_DESC> &inputLayout) {
+  ShaderBytecode bytecode;
+  if (!CompileFromFile(vsPath, vsEntry, psPath, psEntry, bytecode)) {
+    return false;
+  }
+  return Create(device, bytecode, inputLayout);
+}
+
+bool Shader::CompileFromFile(const std::wstring &vsPath,
+                             const std::string &vsEntry,
+                             const std::wstring &psPath,
+                             const std::string &psEntry,
+                             ShaderBytecode &out) {
   UINT compileFlags = 0;
 #ifdef _DEBUG
   compileFlags = D3DCOMPILE_DEBUG | D3DCOMPILE_SKIP_OPTIMIZATION;
 #endif
 
   // 頂点シェーダーコンパイル
-  ComPtr<ID3DBlob> vsBlob;
   ComPtr<ID3DBlob> errorBlob;
   HRESULT hr = D3DCompileFromFile(
       vsPath.c_str(), nullptr, D3D_COMPILE_STANDARD_FILE_INCLUDE,
-      vsEntry.c_str(), "vs_5_0", compileFlags, 0, &vsBlob, &errorBlob);
+      vsEntry.c_str(), "vs_5_0", compileFlags, 0, &out.vs, &errorBlob);
   if (FAILED(hr)) {
     if (errorBlob) {
       LOG_ERROR("Shader", "VS Compile Error: {}",
@@ -32,17 +43,10 @@ bool Shader::LoadFromFile(
     return false;
   }
 
-  hr = device->CreateVertexShader(vsBlob->GetBufferPointer(),
-                                  vsBlob->GetBufferSize(), nullptr,
-                                  &m_vertexShader);
-  if (FAILED(hr))
-    return false;
-
   // ピクセルシェーダーコンパイル
-  ComPtr<ID3DBlob> psBlob;
   hr = D3DCompileFromFile(psPath.c_str(), nullptr,
                           D3D_COMPILE_STANDARD_FILE_INCLUDE, psEntry.c_str(),
-                          "ps_5_0", compileFlags, 0, &psBlob, &errorBlob);
+                          "ps_5_0", compileFlags, 0, &out.ps, &errorBlob);
   if (FAILED(hr)) {
     if (errorBlob) {
       LOG_ERROR("Shader", "PS Compile Error: {}",
@@ -50,9 +54,23 @@ bool Shader::LoadFromFile(
     }
     return false;
   }
+  return true;
+}
+
+bool Shader::Create(ID3D11Device *device, const ShaderBytecode &bytecode,
+                    const std::vector<D3D11_INPUT_ELEMENT_DESC> &inputLayout) {
+  if (!bytecode.vs || !bytecode.ps) {
+    return false;
+  }
+
+  HRESULT hr = device->CreateVertexShader(bytecode.vs->GetBufferPointer(),
+                                          bytecode.vs->GetBufferSize(),
+                                          nullptr, &m_vertexShader);
+  if (FAILED(hr))
+    return false;
 
-  hr = device->CreatePixelShader(psBlob->GetBufferPointer(),
-                                 psBlob->GetBufferSize(), nullptr,
+  hr = device->CreatePixelShader(bytecode.ps->GetBufferPointer(),
+                                 bytecode.ps->GetBufferSize(), nullptr,
                                  &m_pixelShader);
   if (FAILED(hr))
     return false;
@@ -60,7 +78,8 @@ bool Shader::LoadFromFile(
   // 入力レイアウト作成
   hr = device->CreateInputLayout(
       inputLayout.data(), static_cast<UINT>(inputLayout.size()),
-      vsBlob->GetBufferPointer(), vsBlob->GetBufferSize(), &m_inputLayout);
+      bytecode.vs->GetBufferPointer(), bytecode.vs->GetBufferSize(),
+      &m_inputLayout);
 
   return SUCCEEDED(hr);
 }
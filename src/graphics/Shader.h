@@ -17,6 +17,12 @@ namespace graphics {
 
 using Microsoft::WRL::ComPtr;
 
+/// @brief コンパイル済みのバイトコード（デバイスを使わないのでワーカーで作れる）
+struct ShaderBytecode {
+  ComPtr<ID3DBlob> vs;
+  ComPtr<ID3DBlob> ps;
+};
+
 /// @brief シェーダープログラム
 class Shader {
 public:
@@ -29,6 +35,17 @@ public:
                     const std::string &psEntry,
                     const std::vector<D3D11_INPUT_ELEMENT_DESC> &inputLayout);
 
+  /// @brief HLSLファイルをコンパイルだけする（D3DCompileFromFile は
+  ///        スレッドセーフなので、ワーカーから呼んでよい）
+  static bool CompileFromFile(const std::wstring &vsPath,
+                              const std::string &vsEntry,
+                              const std::wstring &psPath,
+                              const std::string &psEntry, ShaderBytecode &out);
+
+  /// @brief バイトコードからシェーダーと入力レイアウトを作る
+  bool Create(ID3D11Device *device, const ShaderBytecode &bytecode,
+              const std::vector<D3D11_INPUT_ELEMENT_DESC> &inputLayout);
+
   /// @brief シェーダーをバインド
   void Bind(ID3D11DeviceContext *context) const;
 
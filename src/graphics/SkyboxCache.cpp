@@ -0,0 +1,181 @@
+/**
+ * @file SkyboxCache.cpp
+ * @brief ブロック圧縮キューブマップキャッシュの実装
+ */
+
+#include "SkyboxCache.h"
+#include "../core/Hash.h"
+#include "../core/MappedFile.h"
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+namespace graphics {
+
+namespace {
+
+constexpr char kMagic[4] = {'W', 'G', 'S', 'K'};
+constexpr uint32_t kFormatVersion = 1;
+constexpr uint32_t kFaceCount = 6;
+constexpr uint32_t kMaxFaceSize = 16384; ///< D3D11 のキューブマップの上限
+constexpr uint64_t kChecksumSeed = 0x5754474300000002ull;
+
+/// @brief ファイル先頭。続けて圧縮データ（16 バイト境界から始まる）
+struct FileHeader {
+  char magic[4];
+  uint32_t version;
+  uint32_t headerBytes;
+  uint32_t format; ///< BlockFormat
+  uint32_t faceSize;
+  uint32_t mipLevels;
+  uint32_t faceCount;
+  uint32_t reserved;
+  uint64_t payloadBytes;
+  uint64_t payloadChecksum;
+  uint64_t reserved2;
+  uint64_t headerChecksum; ///< この手前までのチェックサム
+};
+
+static_assert(std::is_trivially_copyable_v<FileHeader>);
+static_assert(sizeof(FileHeader) % 16 == 0);
+
+uint32_t LevelSizeOf(uint32_t faceSize, uint32_t mip) {
+  return std::max(faceSize >> mip, 1u);
+}
+
+/// @brief 1面の全段の合計バイト数
+size_t FaceBytes(BlockFormat format, uint32_t faceSize, uint32_t mipLevels) {
+  size_t bytes = 0;
+  for (uint32_t mip = 0; mip < mipLevels; ++mip) {
+    const uint32_t size = LevelSizeOf(faceSize, mip);
+    bytes += CompressedSize(format, size, size);
+  }
+  return bytes;
+}
+
+} // namespace
+
+bool EncodeSkyboxCache(const std::vector<std::vector<uint8_t>> &faces,
+                       uint32_t faceSize, BlockFormat format,
+                       const MipChainSettings &mipSettings,
+                       std::vector<uint8_t> &out, core::ThreadPool *pool) {
+  const size_t faceRgbaBytes = static_cast<size_t>(faceSize) * faceSize * 4;
+  if (faces.size() != kFaceCount || faceSize == 0 ||
+      faceSize > kMaxFaceSize) {
+    return false;
+  }
+  for (const std::vector<uint8_t> &face : faces) {
+    if (face.size() != faceRgbaBytes) {
+      return false;
+    }
+  }
+
+  uint32_t mipLevels = CountMipLevels(faceSize, faceSize);
+  if (mipSettings.maxLevels > 0) {
+    mipLevels = std::min(mipLevels, mipSettings.maxLevels);
+  }
+  const size_t faceBytes = FaceBytes(format, faceSize, mipLevels);
+  out.assign(sizeof(FileHeader) + faceBytes * kFaceCount, 0);
+
+  std::vector<MipLevel> levels;
+  for (uint32_t face = 0; face < kFaceCount; ++face) {
+    const uint8_t *pixels = faces[face].data();
+    GenerateMipChain(pixels, faceSize, faceSize,
+                     static_cast<size_t>(faceSize) * 4, mipSettings, levels,
+                     pool);
+    uint8_t *dst = out.data() + sizeof(FileHeader) + face * faceBytes;
+    for (uint32_t mip = 0; mip < mipLevels; ++mip) {
+      const uint32_t size = LevelSizeOf(faceSize, mip);
+      const uint8_t *src = mip == 0 ? pixels : levels[mip - 1].pixels.data();
+      CompressImage(src, size, size, static_cast<size_t>(size) * 4, format,
+                    dst, pool);
+      dst += CompressedSize(format, size, size);
+    }
+  }
+
+  FileHeader h{};
+  std::memcpy(h.magic, kMagic, sizeof(kMagic));
+  h.version = kFormatVersion;
+  h.headerBytes = sizeof(FileHeader);
+  h.format = static_cast<uint32_t>(format);
+  h.faceSize = faceSize;
+  h.mipLevels = mipLevels;
+  h.faceCount = kFaceCount;
+  h.payloadBytes = faceBytes * kFaceCount;
+  h.payloadChecksum = core::HashBytes(out.data() + sizeof(FileHeader),
+                                      h.payloadBytes, kChecksumSeed);
+  h.headerChecksum =
+      core::HashBytes(reinterpret_cast<const uint8_t *>(&h),
+                      offsetof(FileHeader, headerChecksum), kChecksumSeed);
+  std::memcpy(out.data(), &h, sizeof(h));
+  return true;
+}
+
+bool WriteSkyboxCache(const std::filesystem::path &path,
+                      const std::vector<uint8_t> &bytes) {
+  return core::WriteFileAtomically(path, bytes.data(), bytes.size());
+}
+
+bool SkyboxCacheView::Parse(const uint8_t *data, size_t size) {
+  *this = SkyboxCacheView();
+  if (!data || size < sizeof(FileHeader)) {
+    return false;
+  }
+  FileHeader h;
+  std::memcpy(&h, data, sizeof(h));
+  const uint64_t headerSum = core::HashBytes(
+      data, offsetof(FileHeader, headerChecksum), kChecksumSeed);
+  if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0 ||
+      h.version != kFormatVersion || h.headerBytes != sizeof(FileHeader) ||
+      h.headerChecksum != headerSum || h.faceCount != kFaceCount ||
+      h.faceSize == 0 || h.faceSize > kMaxFaceSize || h.mipLevels == 0 ||
+      h.mipLevels > CountMipLevels(h.faceSize, h.faceSize) ||
+      (h.format != static_cast<uint32_t>(BlockFormat::BC1) &&
+       h.format != static_cast<uint32_t>(BlockFormat::BC7))) {
+    return false;
+  }
+  const BlockFormat format = static_cast<BlockFormat>(h.format);
+  const size_t faceBytes = FaceBytes(format, h.faceSize, h.mipLevels);
+  if (h.payloadBytes != size - sizeof(FileHeader) ||
+      h.payloadBytes != faceBytes * kFaceCount ||
+      core::HashBytes(data + sizeof(FileHeader), h.payloadBytes,
+                      kChecksumSeed) != h.payloadChecksum) {
+    return false;
+  }
+
+  m_payload = data + sizeof(FileHeader);
+  m_payloadBytes = h.payloadBytes;
+  m_format = format;
+  m_faceSize = h.faceSize;
+  m_mipLevels = h.mipLevels;
+  m_faceBytes = faceBytes;
+  return true;
+}
+
+uint32_t SkyboxCacheView::LevelSize(uint32_t mip) const {
+  return LevelSizeOf(m_faceSize, mip);
+}
+
+size_t SkyboxCacheView::LevelBytes(uint32_t mip) const {
+  const uint32_t size = LevelSize(mip);
+  return CompressedSize(m_format, size, size);
+}
+
+size_t SkyboxCacheView::LevelRowPitch(uint32_t mip) const {
+  return ((static_cast<size_t>(LevelSize(mip)) + 3) / 4) *
+         BlockBytes(m_format);
+}
+
+const uint8_t *SkyboxCacheView::Level(uint32_t face, uint32_t mip) const {
+  if (!m_payload || face >= kFaceCount || mip >= m_mipLevels) {
+    return nullptr;
+  }
+  size_t offset = face * m_faceBytes;
+  for (uint32_t m = 0; m < mip; ++m) {
+    offset += LevelBytes(m);
+  }
+  return m_payload + offset;
+}
+
+} // namespace graphics
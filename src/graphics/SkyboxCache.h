@@ -0,0 +1,78 @@
+#pragma once
+/**
+ * @file SkyboxCache.h
+ * @brief ブロック圧縮したキューブマップ（全ミップ）を1ファイルに収めるキャッシュ
+ */
+
+#include "BlockCompression.h"
+#include "MipChain.h"
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <vector>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace graphics {
+
+/// @brief キャッシュファイルの拡張子
+inline constexpr const char *kSkyboxCacheExtension = ".wgsky";
+
+/**
+ * @brief 6面の RGBA8 からキャッシュファイルの中身を作る
+ * @details 各面のミップを CPU で作り（Kaiser・sRGB）、全段をブロック圧縮して
+ *          D3D のサブリソース順（面ごとに段 0 から）に並べる。
+ *          読み込みはそのまま CreateTexture2D の初期データにできる。
+ * @param faces +X -X +Y -Y +Z -Z の順の RGBA8（faceSize² × 4 バイト）
+ * @param mipSettings ミップの作り方（maxLevels も効く）
+ * @param out ファイル全体（ヘッダ込み）
+ * @return 面の数や大きさが合わなければ false
+ */
+bool EncodeSkyboxCache(const std::vector<std::vector<uint8_t>> &faces,
+                       uint32_t faceSize, BlockFormat format,
+                       const MipChainSettings &mipSettings,
+                       std::vector<uint8_t> &out,
+                       core::ThreadPool *pool = nullptr);
+
+/// @brief 一時ファイルへ書いてから置き換える（読み込み中の壊れたファイルを防ぐ）
+bool WriteSkyboxCache(const std::filesystem::path &path,
+                      const std::vector<uint8_t> &bytes);
+
+/**
+ * @brief マップしたキャッシュファイルを読むビュー（コピーしない）
+ * @details Parse はヘッダとチェックサムを確かめるだけで、各段のデータは
+ *          渡されたメモリを直接指す。メモリはビューより長く生かすこと。
+ */
+class SkyboxCacheView {
+public:
+  /// @brief ヘッダと全体のチェックサムを確かめる
+  bool Parse(const uint8_t *data, size_t size);
+
+  BlockFormat GetFormat() const { return m_format; }
+  uint32_t GetFaceSize() const { return m_faceSize; }
+  uint32_t GetMipLevels() const { return m_mipLevels; }
+
+  /// @brief 段 mip の一辺（画素）
+  uint32_t LevelSize(uint32_t mip) const;
+  /// @brief 1面・段 mip の圧縮データのバイト数
+  size_t LevelBytes(uint32_t mip) const;
+  /// @brief 段 mip のブロック1行のバイト数（D3D の SysMemPitch）
+  size_t LevelRowPitch(uint32_t mip) const;
+  /// @brief 面 face・段 mip の圧縮データ
+  const uint8_t *Level(uint32_t face, uint32_t mip) const;
+
+  /// @brief 全段・全面の圧縮データの合計（= GPU に置くテクスチャの大きさ）
+  size_t PayloadBytes() const { return m_payloadBytes; }
+
+private:
+  const uint8_t *m_payload = nullptr;
+  size_t m_payloadBytes = 0;
+  BlockFormat m_format = BlockFormat::BC7;
+  uint32_t m_faceSize = 0;
+  uint32_t m_mipLevels = 0;
+  size_t m_faceBytes = 0; ///< 1面の全段の合計
+};
+
+} // namespace graphics
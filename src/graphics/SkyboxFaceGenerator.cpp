@@ -0,0 +1,910 @@
+/**
+ * @file SkyboxFaceGenerator.cpp
+ * @brief スカイボックス6面の画素生成の実装
+ */
+
+#include "SkyboxFaceGenerator.h"
+#include "../core/Noise.h"
+#include "../core/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_AMD64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define SKYBOX_FACE_SSE2 1
+#endif
+
+using namespace DirectX;
+
+namespace graphics {
+
+namespace {
+
+/// @brief 1チャンクあたりの行数（1行で6面ぶんを処理する）
+constexpr size_t kRowsPerChunk = 4;
+
+/// @brief 太陽の見かけの大きさ（SkyboxThemeParams::sunSize の基準値）
+constexpr float kSunSize = 0.015f;
+
+/// @brief プールがあれば並列、なければそのまま実行
+template <typename Fn>
+void RunRange(core::ThreadPool *pool, size_t count, size_t grain, Fn &&fn) {
+  if (count == 0) {
+    return;
+  }
+  if (pool && count > grain) {
+    pool->ParallelFor(count, grain, fn);
+  } else {
+    fn(0, count);
+  }
+}
+
+/// @brief 格子値ノイズを重ねる FBM 設定（周波数2倍・振幅半分）
+core::noise::FractalSettings ValueFbmSettings(int octaves) {
+  core::noise::FractalSettings settings;
+  settings.basis = core::noise::Basis::Value;
+  settings.octaves = octaves;
+  return settings;
+}
+
+/// @brief ディザ用ハッシュの行ごとの項（y と面で決まる）
+int32_t HashRowTerm(int y, int face) {
+  return static_cast<int32_t>(static_cast<uint32_t>(y) * 668265263u +
+                              static_cast<uint32_t>(face) * 69069u);
+}
+
+/// @brief 画素位置のハッシュ [0, 1]（ディザ用）
+/// @details 符号付きオーバーフローを避けるため乗算と加算は符号なしで行う
+float HashNoise(int x, int32_t rowTerm) {
+  int32_t n = static_cast<int32_t>(static_cast<uint32_t>(x) * 374761393u +
+                                   static_cast<uint32_t>(rowTerm));
+  n = static_cast<int32_t>(static_cast<uint32_t>(n ^ (n >> 13)) *
+                           1274126177u);
+  return static_cast<float>((n ^ (n >> 16)) & 0x7FFFFFFF) / 2147483647.0f;
+}
+
+// 画素の色付けは「レーン型」L を引数に取るテンプレートで1度だけ書き、
+// スカラー（1画素）と SSE2（4画素）に展開する。分岐は両方の値を求めて
+// 選ぶ形にし、四則・比較・sqrt は各レーンで同じ IEEE 演算を同じ順序で行う。
+// pow / sin / cos は SIMD の近似を使うと結果が変わるため、各レーンで
+// 標準ライブラリを呼ぶ。
+
+/// @brief スカラーレーン
+struct ScalarLanes {
+  static constexpr int kWidth = 1;
+  using F = float;
+  using M = bool;
+
+  static F Set(float v) { return v; }
+  static F Load(const float *p) { return *p; }
+
+  static M Less(F a, F b) { return a < b; }
+  static M Greater(F a, F b) { return a > b; }
+  static M And(M a, M b) { return a && b; }
+  static F Select(M m, F a, F b) { return m ? a : b; }
+
+  /// @brief std::min(b, a) と同じく「a < b なら a、そうでなければ b」
+  static F Min(F a, F b) { return (a < b) ? a : b; }
+  /// @brief std::max(b, a) と同じく「a > b なら a、そうでなければ b」
+  static F Max(F a, F b) { return (a > b) ? a : b; }
+  static F Abs(F a) { return std::abs(a); }
+
+  static F Pow(F a, float e) { return std::pow(a, e); }
+  static F Sin(F a) { return std::sin(a); }
+  static F Cos(F a) { return std::cos(a); }
+
+  static F Hash(int x, int32_t rowTerm) { return HashNoise(x, rowTerm); }
+
+  /// @brief 0..1 の色を 0..255 に切り捨てて RGBA で書く
+  static void StoreRgba(uint8_t *out, F r, F g, F b) {
+    out[0] = static_cast<uint8_t>(r * 255.0f);
+    out[1] = static_cast<uint8_t>(g * 255.0f);
+    out[2] = static_cast<uint8_t>(b * 255.0f);
+    out[3] = 255;
+  }
+};
+
+#ifdef SKYBOX_FACE_SSE2
+
+/// @brief 4要素の float（演算子でカーネルをスカラーと共通に書くための薄い包み）
+struct F4 {
+  __m128 v;
+};
+inline F4 Splat(float a) { return {_mm_set1_ps(a)}; }
+inline F4 operator+(F4 a, F4 b) { return {_mm_add_ps(a.v, b.v)}; }
+inline F4 operator-(F4 a, F4 b) { return {_mm_sub_ps(a.v, b.v)}; }
+inline F4 operator*(F4 a, F4 b) { return {_mm_mul_ps(a.v, b.v)}; }
+inline F4 operator/(F4 a, F4 b) { return {_mm_div_ps(a.v, b.v)}; }
+inline F4 operator+(F4 a, float b) { return a + Splat(b); }
+inline F4 operator-(F4 a, float b) { return a - Splat(b); }
+inline F4 operator*(F4 a, float b) { return a * Splat(b); }
+inline F4 operator/(F4 a, float b) { return a / Splat(b); }
+inline F4 operator+(float a, F4 b) { return Splat(a) + b; }
+inline F4 operator-(float a, F4 b) { return Splat(a) - b; }
+inline F4 operator*(float a, F4 b) { return Splat(a) * b; }
+/// @brief 符号ビットの反転（スカラーの単項マイナスと同じ）
+inline F4 operator-(F4 a) { return {_mm_xor_ps(a.v, _mm_set1_ps(-0.0f))}; }
+
+/// @brief 32bit 整数の下位乗算（SSE2 には mullo_epi32 がない）
+inline __m128i MulLo(__m128i a, __m128i b) {
+  __m128i even = _mm_mul_epu32(a, b);
+  __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+  return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                            _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+/// @brief SSE2 レーン（4画素）
+struct Sse2Lanes {
+  static constexpr int kWidth = 4;
+  using F = F4;
+  using M = __m128;
+
+  static F Set(float v) { return Splat(v); }
+  static F Load(const float *p) { return {_mm_loadu_ps(p)}; }
+
+  static M Less(F a, F b) { return _mm_cmplt_ps(a.v, b.v); }
+  static M Greater(F a, F b) { return _mm_cmpgt_ps(a.v, b.v); }
+  static M And(M a, M b) { return _mm_and_ps(a, b); }
+  static F Select(M m, F a, F b) {
+    return {_mm_or_ps(_mm_and_ps(m, a.v), _mm_andnot_ps(m, b.v))};
+  }
+
+  static F Min(F a, F b) { return {_mm_min_ps(a.v, b.v)}; }
+  static F Max(F a, F b) { return {_mm_max_ps(a.v, b.v)}; }
+  static F Abs(F a) { return {_mm_andnot_ps(_mm_set1_ps(-0.0f), a.v)}; }
+
+  template <typename Fn> static F PerLane(F a, Fn &&fn) {
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, a.v);
+    for (float &lane : lanes) {
+      lane = fn(lane);
+    }
+    return {_mm_load_ps(lanes)};
+  }
+  static F Pow(F a, float e) {
+    return PerLane(a, [e](float x) { return std::pow(x, e); });
+  }
+  static F Sin(F a) {
+    return PerLane(a, [](float x) { return std::sin(x); });
+  }
+  static F Cos(F a) {
+    return PerLane(a, [](float x) { return std::cos(x); });
+  }
+
+  static F Hash(int x, int32_t rowTerm) {
+    const __m128i xs =
+        _mm_add_epi32(_mm_set1_epi32(x), _mm_setr_epi32(0, 1, 2, 3));
+    __m128i n = _mm_add_epi32(MulLo(xs, _mm_set1_epi32(374761393)),
+                              _mm_set1_epi32(rowTerm));
+    n = MulLo(_mm_xor_si128(n, _mm_srai_epi32(n, 13)),
+              _mm_set1_epi32(1274126177));
+    n = _mm_and_si128(_mm_xor_si128(n, _mm_srai_epi32(n, 16)),
+                      _mm_set1_epi32(0x7FFFFFFF));
+    return {_mm_div_ps(_mm_cvtepi32_ps(n), _mm_set1_ps(2147483647.0f))};
+  }
+
+  static void StoreRgba(uint8_t *out, F r, F g, F b) {
+    const __m128 scale = _mm_set1_ps(255.0f);
+    const __m128i ri = _mm_cvttps_epi32(_mm_mul_ps(r.v, scale));
+    const __m128i gi = _mm_cvttps_epi32(_mm_mul_ps(g.v, scale));
+    const __m128i bi = _mm_cvttps_epi32(_mm_mul_ps(b.v, scale));
+    __m128i rgba = _mm_or_si128(ri, _mm_slli_epi32(gi, 8));
+    rgba = _mm_or_si128(rgba, _mm_slli_epi32(bi, 16));
+    rgba = _mm_or_si128(rgba, _mm_set1_epi32(static_cast<int>(0xFF000000u)));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(out), rgba);
+  }
+};
+
+#endif
+
+/// @brief 全画素で共通の値
+struct ShadeContext {
+  SkyboxThemeParams params;
+  XMFLOAT3 horizon;
+  XMFLOAT3 topDelta;    ///< 天頂色 - 地平線色
+  XMFLOAT3 bottomDelta; ///< 天底色 - 地平線色
+  float sunScale;       ///< params.sunSize / 0.015
+  float noiseInfluence; ///< 0.05 * params.noiseMult
+  bool galaxy;          ///< 銀河を描くテーマか（starMult > 1.5）
+};
+
+/// @brief 1行ぶんの作業領域（SoA）。チャンクごとに1つ持つ
+struct RowBuffers {
+  std::vector<float> dirX, dirY, dirZ;
+  std::vector<float> sampleX, sampleY, sampleZ;
+  std::vector<float> noise, stars, fbm, worley, detail, galaxy, nebula;
+  std::vector<float> vignette;
+
+  explicit RowBuffers(size_t n)
+      : dirX(n), dirY(n), dirZ(n), sampleX(n), sampleY(n), sampleZ(n),
+        noise(n), stars(n), fbm(n), worley(n), detail(n), galaxy(n),
+        nebula(n), vignette(n) {}
+
+  /// @brief 方向ベクトルを軸ごとに倍率をかけて sample に展開する
+  void Scale(float sx, float sy, float sz) {
+    for (size_t x = 0; x < dirX.size(); ++x) {
+      sampleX[x] = dirX[x] * sx;
+      sampleY[x] = dirY[x] * sy;
+      sampleZ[x] = dirZ[x] * sz;
+    }
+  }
+};
+
+/**
+ * @brief 画素 x から L::kWidth 個を色付けして out に書く
+ * @details 分岐の条件と演算順は従来の1画素ずつの実装と同じ
+ */
+template <typename L>
+void ShadePixels(const ShadeContext &ctx, const RowBuffers &row, int x,
+                 int32_t hashRow, uint8_t *out) {
+  using F = typename L::F;
+  using M = typename L::M;
+  const SkyboxThemeParams &p = ctx.params;
+  const F zero = L::Set(0.0f);
+  const F one = L::Set(1.0f);
+
+  const F dx = L::Load(&row.dirX[x]);
+  const F dy = L::Load(&row.dirY[x]);
+  const F dz = L::Load(&row.dirZ[x]);
+
+  // 地平線から天頂／天底へのグラデーション
+  const M up = L::Greater(dy, zero);
+  const F t = L::Pow(L::Select(up, dy, -dy), p.gradientExponent);
+  F r = ctx.horizon.x +
+        L::Select(up, L::Set(ctx.topDelta.x), L::Set(ctx.bottomDelta.x)) * t;
+  F g = ctx.horizon.y +
+        L::Select(up, L::Set(ctx.topDelta.y), L::Set(ctx.bottomDelta.y)) * t;
+  F b = ctx.horizon.z +
+        L::Select(up, L::Set(ctx.topDelta.z), L::Set(ctx.bottomDelta.z)) * t;
+
+  // === プロシージャル要素 ===
+
+  const F noise = L::Load(&row.noise[x]) * p.noiseMult;
+  const F star =
+      L::Select(L::Greater(L::Load(&row.stars[x]), L::Set(0.995f)), one,
+                zero) *
+      p.starMult;
+
+  // 太陽（sunDir = (0.7, 0.5, 0.3)、中心ほど明るく周辺はグロー）
+  const F dot = (dx * 0.7f + dy * 0.5f) + dz * 0.3f;
+  const F dist = one - dot;
+  const F sunCore = one - dist / kSunSize;
+  const F glow = one - dist / (kSunSize * 4.0f);
+  const F sun =
+      L::Select(L::Less(dist, L::Set(kSunSize)), sunCore * sunCore * 2.0f,
+                L::Select(L::Less(dist, L::Set(kSunSize * 4.0f)),
+                          glow * glow * 0.5f, zero)) *
+      ctx.sunScale;
+
+  const F worleyCloud = one - L::Min(L::Load(&row.worley[x]), one);
+  F cloud = (L::Load(&row.fbm[x]) * 0.6f + worleyCloud * 0.4f) * p.cloudMult;
+  cloud = cloud + L::Load(&row.detail[x]) * 0.1f;
+  cloud = L::Max(L::Min(cloud, one), zero);
+
+  // === エフェクト適用 ===
+
+  const F grain = (noise - 0.5f) * ctx.noiseInfluence;
+  r = r + grain;
+  g = g + grain;
+  b = b + grain;
+
+  if (p.cloudMult > 0.0f) {
+    const M lit = L::Greater(sun, zero);
+    r = L::Select(lit, r + sun * 0.9f, r);
+    g = L::Select(lit, g + sun * 0.8f, g);
+    b = L::Select(lit, b + sun * 0.5f, b);
+
+    const M band = L::And(L::Greater(dy, L::Set(-0.2f)),
+                          L::Less(dy, L::Set(0.8f)));
+    const F cloudBase = cloud * 0.2f * p.cloudMult;
+    const F lighting = L::Max(-dx * 0.5f + 0.5f, zero);
+    const F highlight = cloud * cloud * 0.3f * lighting * p.cloudMult;
+    const F add = cloudBase + highlight;
+    r = L::Select(band, r + add, r);
+    g = L::Select(band, g + add, g);
+    b = L::Select(band, b + add, b);
+  }
+
+  const F brightness = (r + g + b) / 3.0f;
+  if (p.starMult > 0.0f) {
+    const M twinkle = L::And(L::Less(brightness, L::Set(0.3f)),
+                             L::Greater(star, L::Set(0.9f)));
+    const F boost = (star - 0.9f) * 10.0f * p.starMult;
+    r = L::Select(twinkle, r + boost * (0.8f + noise * 0.2f), r);
+    g = L::Select(twinkle, g + boost * (0.8f + noise * 0.15f), g);
+    b = L::Select(twinkle, b + boost * (1.0f + noise * 0.1f), b);
+  }
+
+  // 銀河/天の川（y = 0.2 付近の帯）
+  if (ctx.galaxy) {
+    const F bandDist = L::Abs(dy - 0.2f);
+    const F galaxy =
+        L::Select(L::Greater(bandDist, L::Set(0.3f)), zero,
+                  (one - bandDist / 0.3f) * L::Load(&row.galaxy[x]) * 0.3f) *
+        p.galaxyMult;
+    const M show =
+        L::And(L::Less(brightness, L::Set(0.4f)), L::Greater(galaxy, zero));
+    r = L::Select(show, r + galaxy * 0.5f * p.galaxyMult, r);
+    g = L::Select(show, g + galaxy * 0.4f * p.galaxyMult, g);
+    b = L::Select(show, b + galaxy * 0.6f * p.galaxyMult, b);
+  }
+
+  if (p.accentStrength > 0.0f) {
+    const F accentBase =
+        0.5f * (L::Sin((dx + dz) * p.accentFrequency +
+                       dy * p.accentFrequency * 0.5f) +
+                1.0f);
+    const F accent = L::Pow(accentBase, 4.0f) * p.accentStrength;
+    r = r + accent * p.accentColor.x;
+    g = g + accent * p.accentColor.y;
+    b = b + accent * p.accentColor.z;
+  }
+
+  // ネビュラ（拡散した帯状の光）
+  if (p.nebulaStrength > 0.0f) {
+    const F nebula = L::Pow(L::Load(&row.nebula[x]), 3.0f) * p.nebulaStrength;
+    r = r + nebula * p.nebulaColor.x;
+    g = g + nebula * p.nebulaColor.y;
+    b = b + nebula * p.nebulaColor.z;
+  }
+
+  // リボン状の光（オーロラ/ネオン帯）
+  if (p.ribbonStrength > 0.0f) {
+    const F wave = L::Sin(dx * p.ribbonFrequency) *
+                   L::Cos(dz * p.ribbonFrequency * 0.7f);
+    F ribbon = L::Pow(L::Abs(wave), p.ribbonSharpness) * p.ribbonStrength;
+    // 偏りをy方向で強調
+    ribbon = ribbon * (0.5f + 0.5f * (one - L::Abs(dy)));
+    r = r + ribbon * p.ribbonColor.x;
+    g = g + ribbon * p.ribbonColor.y;
+    b = b + ribbon * p.ribbonColor.z;
+  }
+
+  const F fog = L::Pow(one - L::Abs(dy), p.fogExponent) * p.fogStrength;
+  const F clear = one - fog;
+  r = r * clear + fog * ctx.horizon.x;
+  g = g * clear + fog * ctx.horizon.y;
+  b = b * clear + fog * ctx.horizon.z;
+
+  const F lum = r * 0.299f + g * 0.587f + b * 0.114f;
+  r = lum + (r - lum) * p.saturation;
+  g = lum + (g - lum) * p.saturation;
+  b = lum + (b - lum) * p.saturation;
+
+  r = (r - 0.5f) * p.contrast + 0.5f;
+  g = (g - 0.5f) * p.contrast + 0.5f;
+  b = (b - 0.5f) * p.contrast + 0.5f;
+
+  r = r * p.tint.x;
+  g = g * p.tint.y;
+  b = b * p.tint.z;
+
+  const F shade = one - L::Load(&row.vignette[x]);
+  r = r * shade;
+  g = g * shade;
+  b = b * shade;
+
+  const F dither = (L::Hash(x, hashRow) - 0.5f) * 0.003f;
+  r = L::Max(L::Min(r + dither, one), zero);
+  g = L::Max(L::Min(g + dither, one), zero);
+  b = L::Max(L::Min(b + dither, one), zero);
+
+  L::StoreRgba(out + static_cast<size_t>(x) * 4, r, g, b);
+}
+
+/**
+ * @brief 1面の1行を生成する
+ * @param u 列ごとの u 座標（全行・全面で共通）
+ * @param v この行の v 座標
+ */
+void GenerateFaceRow(const ShadeContext &ctx, const float *u, float v,
+                     int face, int y, int faceSize, RowBuffers &row,
+                     uint8_t *out) {
+  // キューブマップの3D方向（XMVector3Normalize と同じく
+  // (x² + y²) + z² の平方根で割る）
+  for (int x = 0; x < faceSize; ++x) {
+    XMFLOAT3 dir;
+    switch (face) {
+    case 0: // +X
+      dir = {1.0f, -v, -u[x]};
+      break;
+    case 1: // -X
+      dir = {-1.0f, -v, u[x]};
+      break;
+    case 2: // +Y（天頂）
+      dir = {u[x], 1.0f, v};
+      break;
+    case 3: // -Y（天底）
+      dir = {u[x], -1.0f, -v};
+      break;
+    case 4: // +Z
+      dir = {u[x], -v, 1.0f};
+      break;
+    default: // -Z
+      dir = {-u[x], -v, -1.0f};
+      break;
+    }
+    const float length =
+        std::sqrt(dir.x * dir.x + dir.y * dir.y + dir.z * dir.z);
+    row.dirX[x] = dir.x / length;
+    row.dirY[x] = dir.y / length;
+    row.dirZ[x] = dir.z / length;
+  }
+
+  // ノイズは行単位でバッチ評価（SIMD）する
+  const size_t n = static_cast<size_t>(faceSize);
+  row.Scale(5.0f, 5.0f, 5.0f);
+  core::noise::Value3Batch(row.sampleX.data(), row.sampleY.data(),
+                           row.sampleZ.data(), row.noise.data(), n);
+  row.Scale(100.0f, 100.0f, 100.0f);
+  core::noise::Value3Batch(row.sampleX.data(), row.sampleY.data(),
+                           row.sampleZ.data(), row.stars.data(), n);
+  row.Scale(2.0f, 2.0f, 2.0f);
+  core::noise::Fbm3Batch(row.sampleX.data(), row.sampleY.data(),
+                         row.sampleZ.data(), row.fbm.data(), n,
+                         ValueFbmSettings(5));
+  row.Scale(3.0f, 3.0f, 3.0f);
+  core::noise::Worley3Batch(row.sampleX.data(), row.sampleY.data(),
+                            row.sampleZ.data(), row.worley.data(), n);
+  if (ctx.galaxy) {
+    core::noise::Fbm3Batch(row.sampleX.data(), row.sampleY.data(),
+                           row.sampleZ.data(), row.galaxy.data(), n,
+                           ValueFbmSettings(4));
+  }
+  row.Scale(10.0f, 10.0f, 10.0f);
+  core::noise::Value3Batch(row.sampleX.data(), row.sampleY.data(),
+                           row.sampleZ.data(), row.detail.data(), n);
+  if (ctx.params.nebulaStrength > 0.0f) {
+    row.Scale(4.0f, 2.0f, 4.0f);
+    core::noise::Fbm3Batch(row.sampleX.data(), row.sampleY.data(),
+                           row.sampleZ.data(), row.nebula.data(), n,
+                           ValueFbmSettings(6));
+  }
+
+  const int32_t hashRow = HashRowTerm(y, face);
+  int x = 0;
+#ifdef SKYBOX_FACE_SSE2
+  for (; x + Sse2Lanes::kWidth <= faceSize; x += Sse2Lanes::kWidth) {
+    ShadePixels<Sse2Lanes>(ctx, row, x, hashRow, out);
+  }
+#endif
+  for (; x < faceSize; ++x) {
+    ShadePixels<ScalarLanes>(ctx, row, x, hashRow, out);
+  }
+}
+
+} // namespace
+
+SkyboxThemeParams GetSkyboxThemeParams(SkyboxTheme theme) {
+  SkyboxThemeParams p;
+
+  switch (theme) {
+  case SkyboxTheme::SpaceAstronomy:
+    p.starMult = 3.0f;
+    p.cloudMult = 0.2f;
+    p.noiseMult = 1.2f;
+    p.galaxyMult = 2.0f;
+    p.gradientExponent = 0.9f;
+    p.vignette = 0.12f;
+    p.tint = {0.9f, 0.95f, 1.1f};
+    p.accentStrength = 0.35f;
+    p.accentFrequency = 8.0f;
+    p.accentColor = {0.6f, 0.7f, 1.2f};
+    break;
+  case SkyboxTheme::Ocean:
+    p.cloudMult = 1.0f;
+    p.noiseMult = 1.5f;
+    p.gradientExponent = 1.2f;
+    p.fogStrength = 0.18f;
+    p.fogExponent = 1.1f;
+    p.tint = {0.9f, 1.0f, 1.1f};
+    p.saturation = 1.1f;
+    break;
+  case SkyboxTheme::Volcano:
+    p.starMult = 0.2f;
+    p.cloudMult = 1.5f;
+    p.noiseMult = 2.0f;
+    p.gradientExponent = 0.8f;
+    p.fogStrength = 0.25f;
+    p.tint = {1.1f, 0.9f, 0.8f};
+    p.accentStrength = 0.3f;
+    p.accentFrequency = 9.0f;
+    p.accentColor = {1.2f, 0.6f, 0.2f};
+    break;
+  case SkyboxTheme::Polar:
+    p.cloudMult = 1.2f;
+    p.starMult = 1.5f;
+    p.galaxyMult = 1.5f;
+    p.gradientExponent = 1.4f;
+    p.fogStrength = 0.2f;
+    p.tint = {0.9f, 1.05f, 1.1f};
+    p.accentStrength = 0.25f;
+    p.accentFrequency = 6.5f;
+    p.accentColor = {0.6f, 0.95f, 1.2f};
+    break;
+  case SkyboxTheme::Desert:
+    p.cloudMult = 1.4f;
+    p.noiseMult = 1.3f;
+    p.gradientExponent = 1.3f;
+    p.fogStrength = 0.22f;
+    p.tint = {1.05f, 1.0f, 0.9f};
+    p.saturation = 1.08f;
+    break;
+  case SkyboxTheme::Forest:
+    p.cloudMult = 0.8f;
+    p.noiseMult = 1.5f;
+    p.fogStrength = 0.18f;
+    p.fogExponent = 1.3f;
+    p.tint = {0.9f, 1.05f, 0.9f};
+    break;
+  case SkyboxTheme::Mountain:
+    p.cloudMult = 1.4f;
+    p.noiseMult = 1.2f;
+    p.gradientExponent = 1.4f;
+    p.tint = {0.95f, 1.0f, 1.05f};
+    break;
+  case SkyboxTheme::Horror:
+    p.starMult = 1.5f;
+    p.cloudMult = 0.6f;
+    p.noiseMult = 2.0f;
+    p.galaxyMult = 0.5f;
+    p.vignette = 0.2f;
+    p.contrast = 1.12f;
+    p.saturation = 0.85f;
+    p.tint = {0.9f, 0.8f, 1.0f};
+    p.accentStrength = 0.22f;
+    p.accentFrequency = 7.0f;
+    p.accentColor = {0.6f, 0.2f, 0.7f};
+    break;
+  case SkyboxTheme::Fantasy:
+    p.starMult = 1.5f;
+    p.cloudMult = 1.1f;
+    p.noiseMult = 1.4f;
+    p.tint = {1.05f, 1.0f, 1.05f};
+    p.saturation = 1.2f;
+    p.accentStrength = 0.3f;
+    p.accentColor = {0.9f, 0.6f, 1.2f};
+    break;
+  case SkyboxTheme::SciFi:
+    p.starMult = 1.0f;
+    p.cloudMult = 0.5f;
+    p.noiseMult = 1.8f;
+    p.galaxyMult = 0.8f;
+    p.contrast = 1.15f;
+    p.saturation = 1.2f;
+    p.vignette = 0.08f;
+    p.tint = {0.8f, 1.05f, 1.2f};
+    p.accentStrength = 0.35f;
+    p.accentFrequency = 12.0f;
+    p.accentColor = {0.2f, 1.0f, 1.5f};
+    break;
+  case SkyboxTheme::War:
+    p.starMult = 0.3f;
+    p.cloudMult = 2.0f;
+    p.noiseMult = 2.5f;
+    p.galaxyMult = 0.0f;
+    p.vignette = 0.15f;
+    p.contrast = 1.08f;
+    p.saturation = 0.9f;
+    p.fogStrength = 0.3f;
+    p.tint = {0.95f, 0.9f, 0.9f};
+    break;
+  case SkyboxTheme::Urban:
+    p.cloudMult = 1.2f;
+    p.noiseMult = 1.8f;
+    p.fogStrength = 0.25f;
+    p.fogExponent = 1.0f;
+    p.saturation = 0.95f;
+    p.tint = {0.95f, 1.0f, 1.05f};
+    break;
+  case SkyboxTheme::Sunset:
+    p.starMult = 0.6f;
+    p.cloudMult = 1.5f;
+    p.noiseMult = 1.5f;
+    p.gradientExponent = 0.8f;
+    p.fogStrength = 0.2f;
+    p.tint = {1.08f, 1.0f, 0.95f};
+    p.saturation = 1.15f;
+    p.accentStrength = 0.25f;
+    p.accentColor = {1.2f, 0.5f, 0.3f};
+    break;
+  case SkyboxTheme::Sports:
+    p.cloudMult = 1.6f;
+    p.noiseMult = 1.3f;
+    p.saturation = 1.1f;
+    p.tint = {1.05f, 1.05f, 1.05f};
+    break;
+  case SkyboxTheme::Art:
+    p.cloudMult = 1.1f;
+    p.noiseMult = 1.3f;
+    p.saturation = 1.2f;
+    p.tint = {1.05f, 1.0f, 1.05f};
+    p.accentStrength = 0.18f;
+    p.accentColor = {1.1f, 0.7f, 1.0f};
+    break;
+  case SkyboxTheme::Music:
+    p.starMult = 1.2f;
+    p.cloudMult = 0.9f;
+    p.noiseMult = 1.3f;
+    p.saturation = 1.1f;
+    p.vignette = 0.08f;
+    p.accentStrength = 0.2f;
+    p.accentFrequency = 10.0f;
+    p.accentColor = {0.8f, 0.9f, 1.2f};
+    break;
+  case SkyboxTheme::Literature:
+    p.cloudMult = 1.0f;
+    p.noiseMult = 1.2f;
+    p.saturation = 0.95f;
+    p.tint = {1.05f, 1.05f, 0.95f};
+    break;
+  case SkyboxTheme::Medical:
+    p.cloudMult = 0.9f;
+    p.noiseMult = 1.2f;
+    p.saturation = 0.95f;
+    p.tint = {0.95f, 1.05f, 1.05f};
+    p.vignette = 0.05f;
+    break;
+  case SkyboxTheme::Food:
+    p.cloudMult = 1.3f;
+    p.noiseMult = 1.4f;
+    p.saturation = 1.15f;
+    p.tint = {1.08f, 1.0f, 0.95f};
+    break;
+  case SkyboxTheme::Religion:
+    p.starMult = 1.4f;
+    p.cloudMult = 1.0f;
+    p.noiseMult = 1.2f;
+    p.galaxyMult = 1.2f;
+    p.tint = {1.05f, 1.0f, 1.05f};
+    p.accentStrength = 0.18f;
+    p.accentColor = {1.1f, 1.0f, 0.8f};
+    break;
+  case SkyboxTheme::Retro:
+    p.cloudMult = 0.9f;
+    p.noiseMult = 1.1f;
+    p.saturation = 0.9f;
+    p.vignette = 0.12f;
+    p.tint = {1.05f, 1.02f, 0.95f};
+    break;
+  default:
+    break;
+  }
+
+  return p;
+}
+
+void GetSkyboxThemeColors(SkyboxTheme theme, XMFLOAT3 &outTopColor,
+                          XMFLOAT3 &outHorizonColor,
+                          XMFLOAT3 &outBottomColor) {
+  // 床の文字を見やすくするため、全体的に彩度と明度を抑えめに設定
+  // RGB値を0-1の範囲で指定
+
+  switch (theme) {
+  case SkyboxTheme::Default: // 青空
+    outTopColor = {0.4f, 0.6f, 0.9f};
+    outHorizonColor = {0.7f, 0.8f, 0.95f};
+    outBottomColor = {0.6f, 0.7f, 0.85f};
+    break;
+
+  case SkyboxTheme::HistoryAncient: // セピア調
+    outTopColor = {0.55f, 0.45f, 0.35f};
+    outHorizonColor = {0.65f, 0.55f, 0.45f};
+    outBottomColor = {0.5f, 0.4f, 0.3f};
+    break;
+
+  case SkyboxTheme::Medieval: // 灰色・重厚
+    outTopColor = {0.5f, 0.5f, 0.55f};
+    outHorizonColor = {0.6f, 0.6f, 0.65f};
+    outBottomColor = {0.45f, 0.45f, 0.5f};
+    break;
+
+  case SkyboxTheme::ScienceTech: // サイバーブルー
+    outTopColor = {0.2f, 0.4f, 0.7f};
+    outHorizonColor = {0.3f, 0.5f, 0.8f};
+    outBottomColor = {0.15f, 0.35f, 0.65f};
+    break;
+
+  case SkyboxTheme::SpaceAstronomy: // 深い紫→黒
+    outTopColor = {0.1f, 0.05f, 0.2f};
+    outHorizonColor = {0.2f, 0.1f, 0.3f};
+    outBottomColor = {0.05f, 0.03f, 0.15f};
+    break;
+
+  case SkyboxTheme::Ocean: // 深海ブルー
+    outTopColor = {0.1f, 0.3f, 0.5f};
+    outHorizonColor = {0.2f, 0.5f, 0.7f};
+    outBottomColor = {0.05f, 0.2f, 0.4f};
+    break;
+
+  case SkyboxTheme::Mountain: // 高山の澄んだ空
+    outTopColor = {0.5f, 0.7f, 0.95f};
+    outHorizonColor = {0.75f, 0.85f, 0.98f};
+    outBottomColor = {0.65f, 0.75f, 0.9f};
+    break;
+
+  case SkyboxTheme::Forest: // 緑がかった霧
+    outTopColor = {0.4f, 0.5f, 0.45f};
+    outHorizonColor = {0.5f, 0.6f, 0.55f};
+    outBottomColor = {0.35f, 0.45f, 0.4f};
+    break;
+
+  case SkyboxTheme::Desert: // 砂色→オレンジ
+    outTopColor = {0.7f, 0.55f, 0.3f};
+    outHorizonColor = {0.8f, 0.65f, 0.4f};
+    outBottomColor = {0.65f, 0.5f, 0.25f};
+    break;
+
+  case SkyboxTheme::Polar: // 白→薄青
+    outTopColor = {0.8f, 0.85f, 0.95f};
+    outHorizonColor = {0.85f, 0.9f, 0.98f};
+    outBottomColor = {0.75f, 0.8f, 0.9f};
+    break;
+
+  case SkyboxTheme::Volcano: // 赤黒・溶岩
+    outTopColor = {0.3f, 0.15f, 0.1f};
+    outHorizonColor = {0.5f, 0.2f, 0.1f};
+    outBottomColor = {0.25f, 0.1f, 0.05f};
+    break;
+
+  case SkyboxTheme::Urban: // 都会の霞
+    outTopColor = {0.55f, 0.55f, 0.6f};
+    outHorizonColor = {0.65f, 0.65f, 0.7f};
+    outBottomColor = {0.5f, 0.5f, 0.55f};
+    break;
+
+  case SkyboxTheme::Sunset: // 夕焼け
+    outTopColor = {0.6f, 0.3f, 0.4f};
+    outHorizonColor = {0.8f, 0.5f, 0.3f};
+    outBottomColor = {0.5f, 0.25f, 0.35f};
+    break;
+
+  case SkyboxTheme::Sports: // 鮮やかな青空
+    outTopColor = {0.3f, 0.5f, 0.9f};
+    outHorizonColor = {0.6f, 0.75f, 0.95f};
+    outBottomColor = {0.5f, 0.65f, 0.85f};
+    break;
+
+  case SkyboxTheme::Art: // パステル調
+    outTopColor = {0.7f, 0.6f, 0.75f};
+    outHorizonColor = {0.8f, 0.75f, 0.85f};
+    outBottomColor = {0.65f, 0.55f, 0.7f};
+    break;
+
+  case SkyboxTheme::Music: // リズミカルな色
+    outTopColor = {0.5f, 0.4f, 0.7f};
+    outHorizonColor = {0.6f, 0.5f, 0.8f};
+    outBottomColor = {0.45f, 0.35f, 0.65f};
+    break;
+
+  case SkyboxTheme::Literature: // クリーム色
+    outTopColor = {0.75f, 0.7f, 0.6f};
+    outHorizonColor = {0.85f, 0.8f, 0.7f};
+    outBottomColor = {0.7f, 0.65f, 0.55f};
+    break;
+
+  case SkyboxTheme::Medical: // クリーンな白緑
+    outTopColor = {0.75f, 0.8f, 0.75f};
+    outHorizonColor = {0.85f, 0.9f, 0.85f};
+    outBottomColor = {0.7f, 0.75f, 0.7f};
+    break;
+
+  case SkyboxTheme::Food: // 暖色系
+    outTopColor = {0.8f, 0.6f, 0.4f};
+    outHorizonColor = {0.9f, 0.75f, 0.5f};
+    outBottomColor = {0.75f, 0.55f, 0.35f};
+    break;
+
+  case SkyboxTheme::Religion: // 神秘的な紫金
+    outTopColor = {0.5f, 0.4f, 0.6f};
+    outHorizonColor = {0.65f, 0.55f, 0.5f};
+    outBottomColor = {0.45f, 0.35f, 0.55f};
+    break;
+
+  case SkyboxTheme::War: // 暗いグレー・煙
+    outTopColor = {0.35f, 0.35f, 0.35f};
+    outHorizonColor = {0.45f, 0.45f, 0.45f};
+    outBottomColor = {0.3f, 0.3f, 0.3f};
+    break;
+
+  case SkyboxTheme::Fantasy: // 魔法的
+    outTopColor = {0.6f, 0.4f, 0.75f};
+    outHorizonColor = {0.7f, 0.6f, 0.85f};
+    outBottomColor = {0.55f, 0.35f, 0.7f};
+    break;
+
+  case SkyboxTheme::Horror: // 不気味な暗紫
+    outTopColor = {0.25f, 0.15f, 0.3f};
+    outHorizonColor = {0.35f, 0.2f, 0.35f};
+    outBottomColor = {0.2f, 0.1f, 0.25f};
+    break;
+
+  case SkyboxTheme::SciFi: // ネオンカラー
+    outTopColor = {0.2f, 0.5f, 0.7f};
+    outHorizonColor = {0.3f, 0.6f, 0.8f};
+    outBottomColor = {0.15f, 0.45f, 0.65f};
+    break;
+
+  case SkyboxTheme::Retro: // ヴィンテージ
+    outTopColor = {0.6f, 0.55f, 0.45f};
+    outHorizonColor = {0.7f, 0.65f, 0.55f};
+    outBottomColor = {0.55f, 0.5f, 0.4f};
+    break;
+
+  default:
+    outTopColor = {0.4f, 0.6f, 0.9f};
+    outHorizonColor = {0.7f, 0.8f, 0.95f};
+    outBottomColor = {0.6f, 0.7f, 0.85f};
+    break;
+  }
+}
+
+void GenerateSkyboxFaces(const XMFLOAT3 &topColor, const XMFLOAT3 &horizonColor,
+                         const XMFLOAT3 &bottomColor, int faceSize,
+                         SkyboxTheme theme,
+                         std::vector<std::vector<uint8_t>> &outFaces,
+                         core::ThreadPool *pool) {
+  GenerateSkyboxFaceRows(topColor, horizonColor, bottomColor, faceSize, theme,
+                         0, faceSize, 0, 6, outFaces, pool);
+}
+
+void GenerateSkyboxFaceRows(const XMFLOAT3 &topColor,
+                            const XMFLOAT3 &horizonColor,
+                            const XMFLOAT3 &bottomColor, int faceSize,
+                            SkyboxTheme theme, int rowBegin, int rowEnd,
+                            int faceBegin, int faceEnd,
+                            std::vector<std::vector<uint8_t>> &faces,
+                            core::ThreadPool *pool) {
+  faces.resize(6); // 6面
+  const size_t size = faceSize > 0 ? static_cast<size_t>(faceSize) : 0;
+  for (std::vector<uint8_t> &face : faces) {
+    face.resize(size * size * 4); // RGBA
+  }
+  rowBegin = std::clamp(rowBegin, 0, static_cast<int>(size));
+  rowEnd = std::clamp(rowEnd, rowBegin, static_cast<int>(size));
+  faceBegin = std::clamp(faceBegin, 0, 6);
+  faceEnd = std::clamp(faceEnd, faceBegin, 6);
+  if (rowBegin == rowEnd || faceBegin == faceEnd) {
+    return;
+  }
+
+  ShadeContext ctx;
+  ctx.params = GetSkyboxThemeParams(theme);
+  ctx.horizon = horizonColor;
+  ctx.topDelta = {topColor.x - horizonColor.x, topColor.y - horizonColor.y,
+                  topColor.z - horizonColor.z};
+  ctx.bottomDelta = {bottomColor.x - horizonColor.x,
+                     bottomColor.y - horizonColor.y,
+                     bottomColor.z - horizonColor.z};
+  ctx.sunScale = ctx.params.sunSize / kSunSize;
+  ctx.noiseInfluence = 0.05f * ctx.params.noiseMult;
+  // 銀河は starMult > 1.5 のときしか色に入らないので、それ以外は評価しない
+  ctx.galaxy = ctx.params.starMult > 1.5f;
+
+  // UV座標（-1 ~ 1）。u は全行で共通
+  std::vector<float> u(size);
+  for (int x = 0; x < faceSize; ++x) {
+    u[x] = (x / (float)(faceSize - 1)) * 2.0f - 1.0f;
+  }
+
+  // 行 y を面ぶんまとめて処理する（周辺減光は面によらないので1度だけ求める）
+  const size_t rows = static_cast<size_t>(rowEnd - rowBegin);
+  RunRange(pool, rows, kRowsPerChunk, [&](size_t begin, size_t end) {
+    RowBuffers row(size);
+    for (size_t yi = rowBegin + begin; yi < rowBegin + end; ++yi) {
+      const int y = static_cast<int>(yi);
+      const float v = (y / (float)(faceSize - 1)) * 2.0f - 1.0f;
+      for (int x = 0; x < faceSize; ++x) {
+        const float radius = std::sqrt(u[x] * u[x] + v * v);
+        row.vignette[x] =
+            std::pow(std::min(1.0f, radius), 2.2f) * ctx.params.vignette;
+      }
+      for (int face = faceBegin; face < faceEnd; ++face) {
+        GenerateFaceRow(ctx, u.data(), v, face, y, faceSize, row,
+                        faces[face].data() + yi * size * 4);
+      }
+    }
+  });
+}
+
+} // namespace graphics
@@ -0,0 +1,127 @@
+#pragma once
+/**
+ * @file SkyboxFaceGenerator.h
+ * @brief スカイボックス6面の画素生成（D3D に依存しない部分）
+ */
+
+#include <DirectXMath.h>
+#include <cstdint>
+#include <vector>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace graphics {
+
+/**
+ * @brief スカイボックステーマ定義
+ */
+enum class SkyboxTheme {
+  Default,        // デフォルト青空
+  HistoryAncient, // 歴史・古代
+  Medieval,       // 中世・城
+  ScienceTech,    // 科学・技術
+  SpaceAstronomy, // 宇宙・天文
+  Ocean,          // 海洋・水中
+  Mountain,       // 山岳・登山
+  Forest,         // 森林・ジャングル
+  Desert,         // 砂漠
+  Polar,          // 極地・雪
+  Volcano,        // 火山
+  Urban,          // 都市・建築
+  Sunset,         // 夜・夕暮れ
+  Sports,         // スポーツ
+  Art,            // 芸術・美術
+  Music,          // 音楽
+  Literature,     // 文学
+  Medical,        // 医療・生物
+  Food,           // 食品・料理
+  Religion,       // 宗教・神話
+  War,            // 戦争・軍事
+  Fantasy,        // ファンタジー
+  Horror,         // ホラー・オカルト
+  SciFi,          // 未来・SF
+  Retro           // レトロ
+};
+
+/// @brief テーマの数（列挙の最後 + 1）
+constexpr int kSkyboxThemeCount = static_cast<int>(SkyboxTheme::Retro) + 1;
+
+/**
+ * @brief テーマごとのエフェクト強度
+ */
+struct SkyboxThemeParams {
+  float starMult = 1.0f;
+  float cloudMult = 1.0f;
+  float noiseMult = 1.0f;
+  float galaxyMult = 1.0f;
+  float sunSize = 0.015f;
+  float fogStrength = 0.1f;
+  float fogExponent = 1.6f;
+  float gradientExponent = 1.0f;
+  float contrast = 1.05f;
+  float saturation = 1.05f;
+  float vignette = 0.06f;
+  float accentStrength = 0.0f;
+  float accentFrequency = 4.0f;
+  float nebulaStrength = 0.0f;
+  float ribbonStrength = 0.0f;
+  float ribbonFrequency = 3.0f;
+  float ribbonSharpness = 6.0f;
+  DirectX::XMFLOAT3 tint = {1.0f, 1.0f, 1.0f};
+  DirectX::XMFLOAT3 accentColor = {1.0f, 1.0f, 1.0f};
+  DirectX::XMFLOAT3 nebulaColor = {0.6f, 0.4f, 0.9f};
+  DirectX::XMFLOAT3 ribbonColor = {0.6f, 0.9f, 1.2f};
+};
+
+/// @brief テーマのエフェクト強度を取得
+SkyboxThemeParams GetSkyboxThemeParams(SkyboxTheme theme);
+
+/**
+ * @brief テーマから色グラデーションを取得
+ * @param theme テーマ
+ * @param outTopColor 天頂色（出力）
+ * @param outHorizonColor 地平線色（出力）
+ * @param outBottomColor 天底色（出力）
+ */
+void GetSkyboxThemeColors(SkyboxTheme theme, DirectX::XMFLOAT3 &outTopColor,
+                          DirectX::XMFLOAT3 &outHorizonColor,
+                          DirectX::XMFLOAT3 &outBottomColor);
+
+/**
+ * @brief 6面の RGBA8 画素を生成する
+ * @details 行単位でノイズをバッチ評価し、画素の色付けは SSE2 で 4 画素ずつ
+ *          行う（pow / sin などは各レーンで標準ライブラリを呼ぶ）。
+ *          pool を渡すと行の帯ごとに並列化する。どの経路・スレッド数でも
+ *          結果はビット単位で同じ。
+ * @param topColor 天頂色
+ * @param horizonColor 地平線色
+ * @param bottomColor 天底色
+ * @param faceSize 各面のサイズ（ピクセル、2 以上）
+ * @param theme スカイボックステーマ（エフェクト適用用）
+ * @param outFaces 生成されたテクスチャデータ（6面分、+X -X +Y -Y +Z -Z）
+ * @param pool ワーカープール（nullptr なら呼び出しスレッドのみ）
+ */
+void GenerateSkyboxFaces(const DirectX::XMFLOAT3 &topColor,
+                         const DirectX::XMFLOAT3 &horizonColor,
+                         const DirectX::XMFLOAT3 &bottomColor, int faceSize,
+                         SkyboxTheme theme,
+                         std::vector<std::vector<uint8_t>> &outFaces,
+                         core::ThreadPool *pool = nullptr);
+
+/**
+ * @brief 行 [rowBegin, rowEnd) の面 [faceBegin, faceEnd) だけを生成する
+ * @details 少しずつ生成するジョブ用。faces は 6 面・faceSize² × 4 バイトに
+ *          そろえ（既存の内容は残す）、指定範囲だけを書く。全範囲を
+ *          分けて呼んでも GenerateSkyboxFaces とビット単位で同じになる。
+ */
+void GenerateSkyboxFaceRows(const DirectX::XMFLOAT3 &topColor,
+                            const DirectX::XMFLOAT3 &horizonColor,
+                            const DirectX::XMFLOAT3 &bottomColor, int faceSize,
+                            SkyboxTheme theme, int rowBegin, int rowEnd,
+                            int faceBegin, int faceEnd,
+                            std::vector<std::vector<uint8_t>> &faces,
+                            core::ThreadPool *pool = nullptr);
+
+} // namespace graphics
@@ -0,0 +1,112 @@
+/**
+ * @file SkyboxGenerationJob.cpp
+ * @brief スカイボックス生成ジョブの実装
+ */
+
+#include "SkyboxGenerationJob.h"
+#include "../core/ThreadPool.h"
+#include <algorithm>
+
+namespace graphics {
+
+namespace {
+
+/// @brief 1 Step で塗る画素数の目安（1スレッドあたり）
+constexpr int64_t kPixelsPerStep = 1024;
+
+const std::vector<std::vector<uint8_t>> kNoFaces;
+
+} // namespace
+
+SkyboxGenerationJob::SkyboxGenerationJob(SkyboxTheme theme, int faceSize,
+                                         int previewSize,
+                                         core::ThreadPool *pool)
+    : m_theme(theme), m_pool(pool) {
+  GetSkyboxThemeColors(theme, m_top, m_horizon, m_bottom);
+  m_full.size = std::max(faceSize, 0);
+  if (previewSize >= 2 && previewSize < m_full.size) {
+    m_preview.size = previewSize;
+  }
+  for (const Pass *pass : {&m_preview, &m_full}) {
+    m_totalPixels += static_cast<int64_t>(pass->size) * pass->size * 6;
+  }
+}
+
+float SkyboxGenerationJob::GetProgress() const {
+  if (m_totalPixels == 0) {
+    return 1.0f;
+  }
+  return static_cast<float>(static_cast<double>(m_donePixels) /
+                            static_cast<double>(m_totalPixels));
+}
+
+int SkyboxGenerationJob::GetQuality() const {
+  if (m_full.Done()) {
+    return 2;
+  }
+  return (m_preview.size > 0 && m_preview.Done()) ? 1 : 0;
+}
+
+const std::vector<std::vector<uint8_t>> &
+SkyboxGenerationJob::GetFaces() const {
+  switch (GetQuality()) {
+  case 2:
+    return m_full.faces;
+  case 1:
+    return m_preview.faces;
+  default:
+    return kNoFaces;
+  }
+}
+
+int SkyboxGenerationJob::GetFaceSize() const {
+  switch (GetQuality()) {
+  case 2:
+    return m_full.size;
+  case 1:
+    return m_preview.size;
+  default:
+    return 0;
+  }
+}
+
+bool SkyboxGenerationJob::Step() {
+  if (m_full.Done()) {
+    return false;
+  }
+  const int64_t pixels =
+      kPixelsPerStep *
+      static_cast<int64_t>(m_pool ? m_pool->GetConcurrency() : 1);
+  Pass &pass = m_preview.Done() ? m_full : m_preview;
+  Advance(pass, pixels);
+  return !m_full.Done();
+}
+
+void SkyboxGenerationJob::Advance(Pass &pass, int64_t pixels) {
+  const int size = pass.size;
+  const int64_t rowPixels = static_cast<int64_t>(size) * 6;
+  do {
+    const int row = pass.nextUnit / 6;
+    const int face = pass.nextUnit % 6;
+    int rows = 1;
+    int faces = 1;
+    if (face == 0 && pixels >= rowPixels) {
+      // 行の頭から始まるなら、収まるだけの行を6面まとめて作る
+      rows = static_cast<int>(
+          std::min<int64_t>(pixels / rowPixels, size - row));
+      faces = 6;
+    } else {
+      faces = static_cast<int>(
+          std::clamp<int64_t>(pixels / std::max(size, 1), 1, 6 - face));
+    }
+    GenerateSkyboxFaceRows(m_top, m_horizon, m_bottom, size, m_theme, row,
+                           row + rows, face, face + faces, pass.faces, m_pool);
+    const int units = faces == 6 ? rows * 6 : faces;
+    const int64_t done = static_cast<int64_t>(units) * size;
+    pass.nextUnit += units;
+    m_donePixels += done;
+    pixels -= done;
+  } while (pixels > 0 && !pass.Done());
+}
+
+} // namespace graphics
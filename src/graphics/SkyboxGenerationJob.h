@@ -0,0 +1,67 @@
+#pragma once
+/**
+ * @file SkyboxGenerationJob.h
+ * @brief スカイボックス6面をフレームをまたいで少しずつ生成するジョブ
+ */
+
+#include "../core/IncrementalJob.h"
+#include "SkyboxFaceGenerator.h"
+#include <cstdint>
+#include <vector>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace graphics {
+
+/**
+ * @brief 粗いプレビュー → 本番解像度の順に6面を生成するジョブ
+ * @details 1 Step は「行 × 面」の単位を画素数がおよそ一定になるだけ進める。
+ *          品質 1 で previewSize の面が、品質 2 で faceSize の面が揃う。
+ *          最終結果は GenerateSkyboxFaces とビット単位で同じ。
+ */
+class SkyboxGenerationJob : public core::IncrementalJob {
+public:
+  /// @param previewSize 先に作る粗い面の一辺（2 未満ならプレビューなし）
+  /// @param pool 1 Step の中の行を並列化するプール（nullptr なら単一）
+  SkyboxGenerationJob(SkyboxTheme theme, int faceSize, int previewSize = 64,
+                      core::ThreadPool *pool = nullptr);
+
+  float GetProgress() const override;
+  int GetQuality() const override;
+  int GetMaxQuality() const override { return 2; }
+
+  /// @brief 今使える最良の6面（品質 0 なら空）
+  const std::vector<std::vector<uint8_t>> &GetFaces() const;
+  /// @brief GetFaces の一辺（品質 0 なら 0）
+  int GetFaceSize() const;
+
+protected:
+  bool Step() override;
+
+private:
+  /// @brief 1つの解像度での生成
+  struct Pass {
+    int size = 0;
+    std::vector<std::vector<uint8_t>> faces;
+    int nextUnit = 0; ///< 次に作る (行 * 6 + 面)
+    int Units() const { return size * 6; }
+    bool Done() const { return nextUnit >= Units(); }
+  };
+
+  /// @brief pass を画素数 pixels ぶん進める
+  void Advance(Pass &pass, int64_t pixels);
+
+  SkyboxTheme m_theme;
+  DirectX::XMFLOAT3 m_top;
+  DirectX::XMFLOAT3 m_horizon;
+  DirectX::XMFLOAT3 m_bottom;
+  core::ThreadPool *m_pool;
+  Pass m_preview;
+  Pass m_full;
+  int64_t m_totalPixels = 0;
+  int64_t m_donePixels = 0;
+};
+
+} // namespace graphics
@@ -4,6 +4,8 @@
  * @brief ページテーマに基づいたスカイボックステクスチャ生成
  */
 
+#include "BlockCompression.h"
+#include "SkyboxFaceGenerator.h"
 #include <DirectXMath.h>
 #include <cstdint>
 #include <d3d11.h>
@@ -15,37 +17,6 @@
 
 namespace graphics {
 
-/**
- * @brief スカイボックステーマ定義
- */
-enum class SkyboxTheme {
-  Default,        // デフォルト青空
-  HistoryAncient, // 歴史・古代
-  Medieval,       // 中世・城
-  ScienceTech,    // 科学・技術
-  SpaceAstronomy, // 宇宙・天文
-  Ocean,          // 海洋・水中
-  Mountain,       // 山岳・登山
-  Forest,         // 森林・ジャングル
-  Desert,         // 砂漠
-  Polar,          // 極地・雪
-  Volcano,        // 火山
-  Urban,          // 都市・建築
-  Sunset,         // 夜・夕暮れ
-  Sports,         // スポーツ
-  Art,            // 芸術・美術
-  Music,          // 音楽
-  Literature,     // 文学
-  Medical,        // 医療・生物
-  Food,           // 食品・料理
-  Religion,       // 宗教・神話
-  War,            // 戦争・軍事
-  Fantasy,        // ファンタジー
-  Horror,         // ホラー・オカルト
-  SciFi,          // 未来・SF
-  Retro           // レトロ
-};
-
 /**
  * @brief スカイボックステクスチャジェネレーター
  */
@@ -79,11 +50,12 @@ public:
       Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> &outSRV);
 
   /**
-   * @brief テクスチャを生成しPNGとして保存後、その画像からキューブマップを作成
+   * @brief テクスチャを生成しキャッシュとして保存後、それからキューブマップを作成
+   * @details 全ミップをブロック圧縮した .wgsky を1つ書く。
    * @param device DirectX11デバイス
    * @param pageTitle ページタイトル
    * @param pageExtract ページ抜粋
-   * @param baseFilePath 保存先のベースパス（_px.pngなどを付与して保存）
+   * @param baseFilePath 保存先のベースパス（.wgskyを付与して保存）
    * @param outSRV 生成されたキューブマップSRV
    * @return 成功ならtrue
    */
@@ -93,9 +65,10 @@ public:
       Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> &outSRV);
 
   /**
-   * @brief 既存のPNGファイル群からキューブマップを構築
+   * @brief 既存のファイルからキューブマップを構築
+   * @details baseFilePath.wgsky があればそれを使い、なければ PNG を読む。
    * @param device DirectX11デバイス
-   * @param baseFilePath ベースパス（_px.pngなどを付与して読み込む）
+   * @param baseFilePath ベースパス（.wgsky / _px.pngなどを付与して読み込む）
    * @param outSRV 生成されたキューブマップSRV
    * @return 成功ならtrue
    */
@@ -103,9 +76,25 @@ public:
       ID3D11Device *device, const std::wstring &baseFilePath,
       Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> &outSRV);
 
+  /**
+   * @brief 圧縮キャッシュ（.wgsky）をマップしてキューブマップを構築
+   * @details 全ミップを IMMUTABLE な BC1/BC7 テクスチャとして一度に作る。
+   *          読み込み時間と VRAM の大きさをログに出す。
+   * @param device DirectX11デバイス
+   * @param cachePath キャッシュファイルのパス
+   * @param outSRV 生成されたキューブマップSRV
+   * @return 読めない・壊れている場合はfalse
+   */
+  bool LoadCubemapFromCache(
+      ID3D11Device *device, const std::wstring &cachePath,
+      Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> &outSRV);
+
+  /// @brief GenerateCubemapToFiles が書くキャッシュの形式（既定は BC7）
+  void SetCacheFormat(BlockFormat format) { m_cacheFormat = format; }
+
 private:
   /**
-   * @brief ページ情報からテーマを判定
+   * @brief ページ情報からテーマを判定（全テーマを採点して最高点を選ぶ）
    * @param pageTitle ページタイトル
    * @param pageExtract ページ抜粋
    * @return 判定されたテーマ
@@ -114,18 +103,7 @@ private:
                              const std::string &pageExtract);
 
   /**
-   * @brief テーマから色グラデーションを取得
-   * @param theme テーマ
-   * @param outTopColor 天頂色（出力）
-   * @param outHorizonColor 地平線色（出力）
-   * @param outBottomColor 天底色（出力）
-   */
-  void GetThemeColors(SkyboxTheme theme, DirectX::XMFLOAT3 &outTopColor,
-                      DirectX::XMFLOAT3 &outHorizonColor,
-                      DirectX::XMFLOAT3 &outBottomColor);
-
-  /**
-   * @brief 6面のテクスチャデータを生成
+   * @brief 6面のテクスチャデータを生成（共有プールで並列）
    * @param topColor 天頂色
    * @param horizonColor 地平線色
    * @param bottomColor 天底色
@@ -150,6 +128,8 @@ private:
   bool CreateCubemapTexture(
       ID3D11Device *device, const std::vector<std::vector<uint8_t>> &faceData,
       int faceSize, Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> &outSRV);
+
+  BlockFormat m_cacheFormat = BlockFormat::BC7;
 };
 
 } // namespace graphics
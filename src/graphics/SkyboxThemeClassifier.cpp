@@ -0,0 +1,175 @@
+/**
+ * @file SkyboxThemeClassifier.cpp
+ * @brief スカイボックステーマのキーワード表と採点
+ */
+
+#include "SkyboxThemeClassifier.h"
+#include "../core/KeywordClassifier.h"
+#include <initializer_list>
+
+namespace graphics {
+
+namespace {
+
+constexpr float kTitleWeight = 3.0f;
+constexpr float kMinScore = 1.0f; ///< これ未満なら Default
+
+/// キーワードの重み。固有の語ほど重く、日付の「月」のように
+/// 別の意味でよく現れる語は軽くする
+constexpr float kStrong = 2.0f;
+constexpr float kNormal = 1.0f;
+constexpr float kWeak = 0.4f;
+constexpr float kDateLike = 0.25f;
+
+const char *const kThemeNames[kSkyboxThemeCount] = {
+    "Default",    "HistoryAncient", "Medieval", "ScienceTech",
+    "SpaceAstronomy", "Ocean",      "Mountain", "Forest",
+    "Desert",     "Polar",          "Volcano",  "Urban",
+    "Sunset",     "Sports",         "Art",      "Music",
+    "Literature", "Medical",        "Food",     "Religion",
+    "War",        "Fantasy",        "Horror",   "SciFi",
+    "Retro"};
+
+/// @brief 組み立て済みの分類器とラベル番号→テーマの対応
+struct ThemeTable {
+  core::KeywordClassifier classifier;
+  std::vector<SkyboxTheme> themes;
+
+  uint32_t Add(SkyboxTheme theme,
+               std::initializer_list<std::string_view> strong,
+               std::initializer_list<std::string_view> normal,
+               std::initializer_list<std::string_view> weak = {}) {
+    const uint32_t label = classifier.AddLabel(GetSkyboxThemeName(theme));
+    classifier.AddKeywords(label, strong, kStrong);
+    classifier.AddKeywords(label, normal, kNormal);
+    classifier.AddKeywords(label, weak, kWeak);
+    themes.push_back(theme);
+    return label;
+  }
+};
+
+/// @brief 従来の判定順（具体的なものから）でテーマを登録する
+ThemeTable BuildThemeTable() {
+  ThemeTable t;
+  const uint32_t space = t.Add(
+      SkyboxTheme::SpaceAstronomy,
+      {"宇宙", "天文", "惑星", "銀河", "太陽系", "ブラックホール", "彗星",
+       "astronomy", "planet", "galaxy"},
+      {"衛星", "恒星", "space"}, {"星"});
+  t.classifier.AddKeyword(space, "月", kDateLike); // 「1月」にも現れる
+  t.Add(SkyboxTheme::Ocean,
+        {"海洋", "水中", "深海", "サンゴ礁", "underwater", "ocean", "marine"},
+        {"海", "イルカ", "クジラ", "sea"}, {"魚"});
+  t.Add(SkyboxTheme::Volcano,
+        {"火山", "噴火", "溶岩", "マグマ", "volcano", "lava", "eruption"}, {});
+  t.Add(SkyboxTheme::Polar,
+        {"極地", "南極", "北極", "氷河", "オーロラ", "polar", "arctic",
+         "antarctica", "glacier"},
+        {"雪", "snow"});
+  t.Add(SkyboxTheme::Desert,
+        {"砂漠", "サハラ", "オアシス", "desert", "sahara", "dune"}, {"乾燥"});
+  t.Add(SkyboxTheme::Forest,
+        {"森林", "ジャングル", "熱帯雨林", "forest", "jungle", "rainforest"},
+        {"森", "woods"}, {"木"});
+  t.Add(SkyboxTheme::Mountain,
+        {"登山", "高山", "ヒマラヤ", "アルプス", "mountain", "climbing"},
+        {"山", "summit"}, {"peak"});
+  t.Add(SkyboxTheme::Horror,
+        {"ホラー", "幽霊", "お化け", "オカルト", "怪談", "horror", "ghost",
+         "haunted", "occult"},
+        {"呪い"});
+  t.Add(SkyboxTheme::Fantasy,
+        {"魔法", "魔術", "ドラゴン", "エルフ", "ファンタジー", "fantasy",
+         "wizard", "dragon"},
+        {"magic"});
+  t.Add(SkyboxTheme::SciFi,
+        {"サイエンスフィクション", "サイバー", "sci-fi", "science fiction",
+         "cyberpunk", "futuristic"},
+        {"SF", "未来", "ロボット"}, {"AI"});
+  t.Add(SkyboxTheme::War,
+        {"戦争", "軍事", "兵器", "軍隊", "military", "soldier"},
+        {"戦闘", "battle", "weapon"}, {"war"});
+  t.Add(SkyboxTheme::Medieval,
+        {"中世", "騎士", "medieval", "castle", "knight"},
+        {"城", "王国", "貴族", "kingdom"});
+  t.Add(SkyboxTheme::HistoryAncient,
+        {"古代", "遺跡", "考古学", "ancient", "civilization", "archaeology",
+         "ruins"},
+        {"歴史", "文明", "history"});
+  t.Add(SkyboxTheme::Religion,
+        {"宗教", "仏教", "キリスト教", "神話", "religion", "mythology"},
+        {"寺", "教会", "temple", "shrine"}, {"神", "god"});
+  t.Add(SkyboxTheme::Urban,
+        {"摩天楼", "都市", "skyscraper", "urban"},
+        {"建築", "ビル", "都会", "city", "architecture"}, {"building"});
+  t.Add(SkyboxTheme::Medical,
+        {"医療", "医学", "病院", "細胞", "medical", "medicine", "hospital"},
+        {"生物", "DNA", "biology"});
+  t.Add(SkyboxTheme::ScienceTech,
+        {"物理", "化学", "工学", "physics", "chemistry", "engineering"},
+        {"科学", "技術", "science", "technology"});
+  t.Add(SkyboxTheme::Music,
+        {"音楽", "楽器", "コンサート", "オーケストラ", "music", "concert",
+         "orchestra"},
+        {"演奏", "instrument"});
+  t.Add(SkyboxTheme::Art,
+        {"芸術", "美術", "絵画", "彫刻", "芸術家", "painting", "sculpture",
+         "artist"},
+        {"gallery"}, {"art"});
+  t.Add(SkyboxTheme::Literature,
+        {"文学", "小説", "文芸", "literature", "novel", "poetry"},
+        {"作家", "writer", "author"}, {"詩"});
+  t.Add(SkyboxTheme::Food,
+        {"料理", "食品", "レシピ", "グルメ", "food", "cooking", "cuisine",
+         "recipe"},
+        {"レストラン", "restaurant"});
+  t.Add(SkyboxTheme::Sports,
+        {"スポーツ", "競技", "オリンピック", "野球", "サッカー", "sports",
+         "athlete", "olympics"},
+        {"選手"}, {"game"});
+  t.Add(SkyboxTheme::Sunset,
+        {"夕暮れ", "夕焼け", "黄昏", "sunset", "dusk", "twilight"},
+        {"夜", "night"});
+  t.Add(SkyboxTheme::Retro,
+        {"レトロ", "昭和", "ヴィンテージ", "retro", "vintage"}, {"古い"},
+        {"classic", "old"});
+  t.classifier.Compile();
+  return t;
+}
+
+const ThemeTable &GetThemeTable() {
+  static const ThemeTable table = BuildThemeTable();
+  return table;
+}
+
+} // namespace
+
+const char *GetSkyboxThemeName(SkyboxTheme theme) {
+  const int index = static_cast<int>(theme);
+  if (index < 0 || index >= kSkyboxThemeCount) {
+    return "Unknown";
+  }
+  return kThemeNames[index];
+}
+
+SkyboxTheme ClassifySkyboxTheme(std::string_view title,
+                                std::string_view extract,
+                                std::vector<SkyboxThemeScore> *ranked) {
+  const ThemeTable &table = GetThemeTable();
+  std::vector<core::KeywordScore> scores;
+  table.classifier.Classify({{title, kTitleWeight}, {extract, 1.0f}}, scores);
+
+  if (ranked) {
+    ranked->clear();
+    for (const core::KeywordScore &entry : scores) {
+      ranked->push_back(
+          {table.themes[entry.label], entry.score, entry.confidence});
+    }
+  }
+  if (scores.empty() || scores.front().score < kMinScore) {
+    return SkyboxTheme::Default;
+  }
+  return table.themes[scores.front().label];
+}
+
+} // namespace graphics
@@ -0,0 +1,34 @@
+#pragma once
+/**
+ * @file SkyboxThemeClassifier.h
+ * @brief 記事のタイトルと抜粋からスカイボックステーマを選ぶ（D3D 非依存）
+ */
+
+#include "SkyboxFaceGenerator.h"
+#include <string_view>
+#include <vector>
+
+namespace graphics {
+
+/// @brief テーマ1つの採点結果
+struct SkyboxThemeScore {
+  SkyboxTheme theme;
+  float score;      ///< 一致したキーワードの重みの合計
+  float confidence; ///< 点のあるテーマ全体に対する割合（0〜1）
+};
+
+/// @brief テーマの英語名（ログ用）
+const char *GetSkyboxThemeName(SkyboxTheme theme);
+
+/**
+ * @brief 全テーマを1回の走査で採点し、最も点の高いテーマを返す
+ * @details キーワード表は初回の呼び出しで1度だけオートマトンにする。
+ *          タイトルの一致は抜粋の3倍に数える。どのテーマも最低点に
+ *          届かなければ Default（青空）。同点は従来の判定順で決める。
+ * @param ranked nullptr でなければ点のあるテーマを高い順に入れる
+ */
+SkyboxTheme
+ClassifySkyboxTheme(std::string_view title, std::string_view extract,
+                    std::vector<SkyboxThemeScore> *ranked = nullptr);
+
+} // namespace graphics
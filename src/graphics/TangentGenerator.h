@@ -13,4 +13,13 @@ namespace graphics {
 void ComputeTangents(std::vector<Vertex> &vertices,
                      const std::vector<uint32_t> &indices);
 
+/// @brief 1三角形の（正規化前の）接線・従法線を求める
+/// @return UV が縮退していて求まらない場合は false
+bool ComputeTriangleTangent(const Vertex &v0, const Vertex &v1,
+                            const Vertex &v2, DirectX::XMFLOAT3 &tangent,
+                            DirectX::XMFLOAT3 &bitangent);
+
+/// @brief 累積済みの接線・従法線を法線に対して直交化・正規化する
+void OrthonormalizeTangentFrame(Vertex &vertex);
+
 } // namespace graphics
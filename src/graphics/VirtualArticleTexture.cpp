@@ -0,0 +1,215 @@
+/**
+ * @file VirtualArticleTexture.cpp
+ * @brief 記事の仮想テクスチャの実装
+ */
+
+#include "VirtualArticleTexture.h"
+#include "../core/Logger.h"
+
+namespace graphics {
+
+using Microsoft::WRL::ComPtr;
+
+bool VirtualArticleTexture::Initialize(ID3D11Device *device,
+                                       ID2D1DeviceContext *d2dContext,
+                                       const VirtualTextureConfig &config,
+                                       Painter painter) {
+  if (!device || !d2dContext || !painter) {
+    LOG_ERROR("VirtualTex", "Invalid arguments");
+    return false;
+  }
+  m_device = device;
+  m_d2dContext = d2dContext;
+  m_painter = std::move(painter);
+  m_cache = VirtualTextureCache(config);
+  m_rasterizedPixels = 0;
+
+  if (m_cache.GetSlotCount() == 0) {
+    LOG_ERROR("VirtualTex", "Memory budget {} is too small for one tile",
+              config.memoryBudget);
+    return false;
+  }
+
+  // 1. 低解像度版（全体を縮小して1度だけ描く）
+  const uint32_t fw = m_cache.GetFallbackWidth();
+  const uint32_t fh = m_cache.GetFallbackHeight();
+  if (!CreateTarget(fw, fh, m_fallback, m_fallbackBitmap)) {
+    return false;
+  }
+  HRESULT hr = m_device->CreateShaderResourceView(m_fallback.Get(), nullptr,
+                                                  &m_fallbackSRV);
+  if (FAILED(hr)) {
+    LOG_ERROR("VirtualTex", "Failed to create fallback SRV");
+    return false;
+  }
+  const D2D1_MATRIX_3X2_F scale = D2D1::Matrix3x2F::Scale(
+      static_cast<float>(fw) / config.width,
+      static_cast<float>(fh) / config.height);
+  if (!Paint(m_fallbackBitmap.Get(), scale)) {
+    return false;
+  }
+  m_rasterizedPixels += static_cast<uint64_t>(fw) * fh;
+
+  // 2. アトラスとタイル1枚分の描画先
+  D3D11_TEXTURE2D_DESC atlasDesc = {};
+  atlasDesc.Width = m_cache.GetAtlasWidth();
+  atlasDesc.Height = m_cache.GetAtlasHeight();
+  atlasDesc.MipLevels = 1;
+  atlasDesc.ArraySize = 1;
+  atlasDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+  atlasDesc.SampleDesc.Count = 1;
+  atlasDesc.Usage = D3D11_USAGE_DEFAULT;
+  atlasDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+  hr = m_device->CreateTexture2D(&atlasDesc, nullptr, &m_atlas);
+  if (FAILED(hr)) {
+    LOG_ERROR("VirtualTex", "Failed to create atlas {}x{}", atlasDesc.Width,
+              atlasDesc.Height);
+    return false;
+  }
+  hr = m_device->CreateShaderResourceView(m_atlas.Get(), nullptr, &m_atlasSRV);
+  if (FAILED(hr)) {
+    LOG_ERROR("VirtualTex", "Failed to create atlas SRV");
+    return false;
+  }
+
+  const uint32_t slotSize = m_cache.GetSlotSize();
+  if (!CreateTarget(slotSize, slotSize, m_tile, m_tileBitmap)) {
+    return false;
+  }
+
+  // 3. ページテーブル（タイルごとに float4）
+  D3D11_TEXTURE2D_DESC tableDesc = {};
+  tableDesc.Width = m_cache.GetTilesX();
+  tableDesc.Height = m_cache.GetTilesY();
+  tableDesc.MipLevels = 1;
+  tableDesc.ArraySize = 1;
+  tableDesc.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+  tableDesc.SampleDesc.Count = 1;
+  tableDesc.Usage = D3D11_USAGE_DEFAULT;
+  tableDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+  m_pageTableData.assign(
+      static_cast<size_t>(tableDesc.Width) * tableDesc.Height * 4, 0.0f);
+  D3D11_SUBRESOURCE_DATA init = {};
+  init.pSysMem = m_pageTableData.data();
+  init.SysMemPitch = tableDesc.Width * 4 * sizeof(float);
+  hr = m_device->CreateTexture2D(&tableDesc, &init, &m_pageTable);
+  if (FAILED(hr)) {
+    LOG_ERROR("VirtualTex", "Failed to create page table");
+    return false;
+  }
+  hr = m_device->CreateShaderResourceView(m_pageTable.Get(), nullptr,
+                                          &m_pageTableSRV);
+  if (FAILED(hr)) {
+    LOG_ERROR("VirtualTex", "Failed to create page table SRV");
+    return false;
+  }
+  m_cache.ClearPageTableDirty();
+
+  const auto &stats = m_cache.GetStats();
+  LOG_INFO("VirtualTex",
+           "{}x{} as {}x{} tiles, {} slots: {} KB resident (full texture {} "
+           "KB)",
+           config.width, config.height, m_cache.GetTilesX(),
+           m_cache.GetTilesY(), m_cache.GetSlotCount(),
+           stats.TotalBytes() / 1024, m_cache.GetFullTextureBytes() / 1024);
+  return true;
+}
+
+bool VirtualArticleTexture::CreateTarget(uint32_t width, uint32_t height,
+                                         ComPtr<ID3D11Texture2D> &texture,
+                                         ComPtr<ID2D1Bitmap1> &bitmap) {
+  D3D11_TEXTURE2D_DESC texDesc = {};
+  texDesc.Width = width;
+  texDesc.Height = height;
+  texDesc.MipLevels = 1;
+  texDesc.ArraySize = 1;
+  texDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM; // D2D互換形式
+  texDesc.SampleDesc.Count = 1;
+  texDesc.Usage = D3D11_USAGE_DEFAULT;
+  texDesc.BindFlags = D3D11_BIND_RENDER_TARGET | D3D11_BIND_SHADER_RESOURCE;
+
+  HRESULT hr = m_device->CreateTexture2D(&texDesc, nullptr,
+                                         texture.ReleaseAndGetAddressOf());
+  if (FAILED(hr)) {
+    LOG_ERROR("VirtualTex", "Failed to create target {}x{}", width, height);
+    return false;
+  }
+
+  ComPtr<IDXGISurface> dxgiSurface;
+  hr = texture.As(&dxgiSurface);
+  if (FAILED(hr)) {
+    LOG_ERROR("VirtualTex", "Failed to get DXGI surface");
+    return false;
+  }
+
+  D2D1_BITMAP_PROPERTIES1 bitmapProps = D2D1::BitmapProperties1(
+      D2D1_BITMAP_OPTIONS_TARGET | D2D1_BITMAP_OPTIONS_CANNOT_DRAW,
+      D2D1::PixelFormat(DXGI_FORMAT_B8G8R8A8_UNORM,
+                        D2D1_ALPHA_MODE_PREMULTIPLIED));
+  hr = m_d2dContext->CreateBitmapFromDxgiSurface(
+      dxgiSurface.Get(), &bitmapProps, bitmap.ReleaseAndGetAddressOf());
+  if (FAILED(hr)) {
+    LOG_ERROR("VirtualTex", "Failed to create D2D bitmap from surface");
+    return false;
+  }
+  return true;
+}
+
+bool VirtualArticleTexture::Paint(ID2D1Bitmap1 *target,
+                                  const D2D1_MATRIX_3X2_F &transform) {
+  m_d2dContext->SetTarget(target);
+  m_d2dContext->BeginDraw();
+  m_d2dContext->SetTransform(transform);
+  m_painter(m_d2dContext.Get());
+  m_d2dContext->SetTransform(D2D1::Matrix3x2F::Identity());
+  const HRESULT hr = m_d2dContext->EndDraw();
+  m_d2dContext->SetTarget(nullptr);
+  if (FAILED(hr)) {
+    LOG_ERROR("VirtualTex", "D2D EndDraw failed (HRESULT: {:08X})",
+              static_cast<uint32_t>(hr));
+    return false;
+  }
+  return true;
+}
+
+void VirtualArticleTexture::Update(ID3D11DeviceContext *context) {
+  if (!m_atlas || !context) {
+    return;
+  }
+
+  const auto &uploads = m_cache.EndFrame();
+  const uint32_t slotSize = m_cache.GetSlotSize();
+  for (const VirtualTileUpload &upload : uploads) {
+    // タイルの左上（境界込み）が原点に来るようにずらして描く
+    const D2D1_MATRIX_3X2_F offset = D2D1::Matrix3x2F::Translation(
+        static_cast<float>(-upload.sourceX),
+        static_cast<float>(-upload.sourceY));
+    if (!Paint(m_tileBitmap.Get(), offset)) {
+      continue;
+    }
+    context->CopySubresourceRegion(m_atlas.Get(), 0, upload.atlasX,
+                                   upload.atlasY, 0, m_tile.Get(), 0, nullptr);
+    m_rasterizedPixels += static_cast<uint64_t>(slotSize) * slotSize;
+  }
+
+  if (m_cache.IsPageTableDirty()) {
+    m_cache.WritePageTable(m_pageTableData.data());
+    context->UpdateSubresource(m_pageTable.Get(), 0, nullptr,
+                               m_pageTableData.data(),
+                               m_cache.GetTilesX() * 4 * sizeof(float), 0);
+    m_cache.ClearPageTableDirty();
+  }
+}
+
+DirectX::XMFLOAT4 VirtualArticleTexture::GetShaderParams() const {
+  if (!m_atlas) {
+    return {0.0f, 0.0f, 0.0f, 0.0f};
+  }
+  // 端のタイルは欠けているので、タイル数ではなく実際の大きさを渡す
+  const VirtualTextureConfig &config = m_cache.GetConfig();
+  const float tileSize = static_cast<float>(config.tileSize);
+  return {config.width / tileSize, config.height / tileSize, 1.0f, 0.0f};
+}
+
+} // namespace graphics
@@ -0,0 +1,108 @@
+#pragma once
+/**
+ * @file VirtualArticleTexture.h
+ * @brief 記事テクスチャをタイル単位でオンデマンドにラスタライズする
+ */
+
+#include "VirtualTextureCache.h"
+#include <DirectXMath.h>
+#include <d2d1_1.h>
+#include <d3d11.h>
+#include <functional>
+#include <vector>
+#include <wrl/client.h>
+
+namespace graphics {
+
+/**
+ * @brief 仮想テクスチャ化した記事
+ * @details 記事全体を1枚のテクスチャにせず、
+ *          - 全体を縮小した低解像度版（初期化時に1度だけ描く）
+ *          - 表示中のタイルだけを置くアトラス
+ *          - タイル → アトラス上の位置のページテーブル
+ *          の3枚で持つ。タイルの選択と追い出しは VirtualTextureCache が行い、
+ *          Update で要求されたタイルを D2D で描いてアトラスへコピーする。
+ *          TerrainPS はページテーブルを引き、常駐していないタイルは
+ *          低解像度版で描く。
+ */
+class VirtualArticleTexture {
+public:
+  /// @brief 記事を描く関数（仮想テクスチャのピクセル座標で描く）
+  using Painter = std::function<void(ID2D1DeviceContext *)>;
+
+  VirtualArticleTexture() = default;
+
+  // コピー禁止
+  VirtualArticleTexture(const VirtualArticleTexture &) = delete;
+  VirtualArticleTexture &operator=(const VirtualArticleTexture &) = delete;
+
+  /// @brief テクスチャ群を作り、低解像度版を描く
+  /// @param painter 以後タイルを描くたびに呼ばれる
+  /// @return 成功ならtrue
+  bool Initialize(ID3D11Device *device, ID2D1DeviceContext *d2dContext,
+                  const VirtualTextureConfig &config, Painter painter);
+
+  /// @brief 要求の受付を始める
+  void BeginFrame() { m_cache.BeginFrame(); }
+
+  /// @brief 表示に必要な範囲を UV で要求する
+  /// @see VirtualTextureCache::RequestRegion
+  void RequestRegion(float u0, float v0, float u1, float v1, float priority) {
+    m_cache.RequestRegion(u0, v0, u1, v1, priority);
+  }
+
+  /// @brief 要求されたタイルを描いてアトラスとページテーブルを更新する
+  void Update(ID3D11DeviceContext *context);
+
+  /// @brief 低解像度版（t0。ミニマップなどはこれだけを使う）
+  ID3D11ShaderResourceView *GetFallbackSRV() const {
+    return m_fallbackSRV.Get();
+  }
+  ID3D11ShaderResourceView *GetAtlasSRV() const { return m_atlasSRV.Get(); }
+  ID3D11ShaderResourceView *GetPageTableSRV() const {
+    return m_pageTableSRV.Get();
+  }
+
+  /// @brief シェーダーに渡すパラメータ
+  /// @return x, y: 仮想テクスチャの大きさ（タイル単位）、z: 有効なら 1
+  DirectX::XMFLOAT4 GetShaderParams() const;
+
+  const VirtualTextureCache &GetCache() const { return m_cache; }
+
+  /// @brief 生成してからラスタライズした画素の合計
+  uint64_t GetRasterizedPixels() const { return m_rasterizedPixels; }
+
+private:
+  /// @brief D2D から描けるテクスチャを作る
+  bool CreateTarget(uint32_t width, uint32_t height,
+                    Microsoft::WRL::ComPtr<ID3D11Texture2D> &texture,
+                    Microsoft::WRL::ComPtr<ID2D1Bitmap1> &bitmap);
+
+  /// @brief target に変換をかけて記事を描く
+  bool Paint(ID2D1Bitmap1 *target, const D2D1_MATRIX_3X2_F &transform);
+
+  VirtualTextureCache m_cache{VirtualTextureConfig{}};
+  Painter m_painter;
+
+  Microsoft::WRL::ComPtr<ID3D11Device> m_device;
+  Microsoft::WRL::ComPtr<ID2D1DeviceContext> m_d2dContext;
+
+  Microsoft::WRL::ComPtr<ID3D11Texture2D> m_fallback;
+  Microsoft::WRL::ComPtr<ID2D1Bitmap1> m_fallbackBitmap;
+  Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> m_fallbackSRV;
+
+  Microsoft::WRL::ComPtr<ID3D11Texture2D> m_atlas;
+  Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> m_atlasSRV;
+
+  /// タイル1枚分の描画先（描いたらアトラスのスロットへコピーする）
+  Microsoft::WRL::ComPtr<ID3D11Texture2D> m_tile;
+  Microsoft::WRL::ComPtr<ID2D1Bitmap1> m_tileBitmap;
+
+  Microsoft::WRL::ComPtr<ID3D11Texture2D> m_pageTable;
+  Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> m_pageTableSRV;
+  std::vector<float> m_pageTableData;
+
+  uint64_t m_rasterizedPixels = 0;
+};
+
+} // namespace graphics
@@ -0,0 +1,252 @@
+/**
+ * @file VirtualTextureCache.cpp
+ * @brief 仮想テクスチャの常駐管理の実装
+ */
+
+#include "VirtualTextureCache.h"
+#include <algorithm>
+#include <cmath>
+
+namespace graphics {
+
+VirtualTextureCache::VirtualTextureCache(const VirtualTextureConfig &config)
+    : m_config(config) {
+  m_config.tileSize = std::max(m_config.tileSize, 1u);
+  const uint32_t ts = m_config.tileSize;
+  m_tilesX = std::max(1u, (m_config.width + ts - 1) / ts);
+  m_tilesY = std::max(1u, (m_config.height + ts - 1) / ts);
+  m_slotSize = ts + 2 * m_config.border;
+
+  const uint64_t bpp = m_config.bytesPerPixel;
+  m_fallbackWidth = std::max(
+      1u, static_cast<uint32_t>(std::ceil(m_config.width *
+                                          m_config.fallbackScale)));
+  m_fallbackHeight = std::max(
+      1u, static_cast<uint32_t>(std::ceil(m_config.height *
+                                          m_config.fallbackScale)));
+  m_stats.fallbackBytes =
+      static_cast<uint64_t>(m_fallbackWidth) * m_fallbackHeight * bpp;
+  m_stats.pageTableBytes =
+      static_cast<uint64_t>(m_tilesX) * m_tilesY * 4 * sizeof(float);
+
+  // 予算の残りをスロットに割り当てる（全タイル分とアトラスの上限まで）
+  const uint64_t fixedBytes = m_stats.fallbackBytes + m_stats.pageTableBytes;
+  const uint64_t slotBytes =
+      static_cast<uint64_t>(m_slotSize) * m_slotSize * bpp;
+  const uint64_t budgetSlots =
+      m_config.memoryBudget > fixedBytes
+          ? (m_config.memoryBudget - fixedBytes) / slotBytes
+          : 0;
+  const uint64_t perSide = m_config.maxAtlasSize / m_slotSize;
+  const uint64_t tileCount = static_cast<uint64_t>(m_tilesX) * m_tilesY;
+  const uint64_t maxSlots = std::min(budgetSlots, perSide * perSide);
+  const uint64_t target = std::min(maxSlots, tileCount);
+
+  // 正方形に近い格子に並べる。端数の行で予算を超えるなら1行減らす
+  if (target > 0) {
+    uint64_t perRow = static_cast<uint64_t>(
+        std::ceil(std::sqrt(static_cast<double>(target))));
+    uint64_t rows = (target + perRow - 1) / perRow;
+    if (perRow * rows > maxSlots) {
+      rows = maxSlots / perRow;
+    }
+    m_slotsPerRow = static_cast<uint32_t>(perRow);
+    m_slotCount = static_cast<uint32_t>(std::min(perRow * rows, tileCount));
+    m_atlasWidth = static_cast<uint32_t>(perRow) * m_slotSize;
+    m_atlasHeight = static_cast<uint32_t>(rows) * m_slotSize;
+  }
+  m_stats.atlasBytes =
+      static_cast<uint64_t>(m_atlasWidth) * m_atlasHeight * bpp;
+
+  m_tileSlot.assign(static_cast<size_t>(m_tilesX) * m_tilesY, -1);
+  m_requestSlot.assign(m_tileSlot.size(), -1);
+  m_slotTile.assign(m_slotCount, -1);
+  m_slotFrame.assign(m_slotCount, 0);
+  m_lruPos.resize(m_slotCount);
+  Reset();
+}
+
+uint64_t VirtualTextureCache::GetFullTextureBytes() const {
+  return static_cast<uint64_t>(m_config.width) * m_config.height *
+         m_config.bytesPerPixel;
+}
+
+void VirtualTextureCache::Reset() {
+  std::fill(m_tileSlot.begin(), m_tileSlot.end(), -1);
+  std::fill(m_slotTile.begin(), m_slotTile.end(), -1);
+  m_lru.clear();
+  m_freeSlots.clear();
+  // 小さい番号から使う
+  for (uint32_t s = m_slotCount; s-- > 0;) {
+    m_freeSlots.push_back(s);
+  }
+  m_stats.residentTiles = 0;
+  m_pageTableDirty = true;
+}
+
+void VirtualTextureCache::BeginFrame() {
+  for (const Request &r : m_requests) {
+    m_requestSlot[r.tile] = -1;
+  }
+  m_requests.clear();
+}
+
+void VirtualTextureCache::RequestTile(uint32_t tile, float priority,
+                                      bool margin) {
+  const int32_t index = m_requestSlot[tile];
+  if (index < 0) {
+    m_requestSlot[tile] = static_cast<int32_t>(m_requests.size());
+    m_requests.push_back({tile, priority, margin});
+    return;
+  }
+  // 複数の範囲から要求されたら、より優先されるほうを採る
+  Request &r = m_requests[index];
+  if (margin < r.margin || (margin == r.margin && priority < r.priority)) {
+    r.margin = margin;
+    r.priority = priority;
+  }
+}
+
+void VirtualTextureCache::RequestRegion(float u0, float v0, float u1, float v1,
+                                        float priority) {
+  // 逆向き・NaN・テクスチャと重ならない範囲は捨てる
+  if (!(u0 <= u1 && v0 <= v1) || u1 < 0.0f || v1 < 0.0f || u0 > 1.0f ||
+      v0 > 1.0f) {
+    return;
+  }
+  const float ts = static_cast<float>(m_config.tileSize);
+  auto toTile = [ts](float uv, uint32_t size, uint32_t count) {
+    const float t = std::floor(uv * static_cast<float>(size) / ts);
+    return static_cast<int64_t>(
+        std::clamp(t, -1.0f, static_cast<float>(count)));
+  };
+  const int64_t x0 = toTile(u0, m_config.width, m_tilesX);
+  const int64_t x1 = toTile(u1, m_config.width, m_tilesX);
+  const int64_t y0 = toTile(v0, m_config.height, m_tilesY);
+  const int64_t y1 = toTile(v1, m_config.height, m_tilesY);
+  const int64_t margin = m_config.marginTiles;
+
+  const int64_t mx0 = std::max<int64_t>(x0 - margin, 0);
+  const int64_t my0 = std::max<int64_t>(y0 - margin, 0);
+  const int64_t mx1 = std::min<int64_t>(x1 + margin, m_tilesX - 1);
+  const int64_t my1 = std::min<int64_t>(y1 + margin, m_tilesY - 1);
+  for (int64_t y = my0; y <= my1; ++y) {
+    for (int64_t x = mx0; x <= mx1; ++x) {
+      const bool inside = x >= x0 && x <= x1 && y >= y0 && y <= y1;
+      RequestTile(static_cast<uint32_t>(y * m_tilesX + x), priority, !inside);
+    }
+  }
+}
+
+void VirtualTextureCache::Touch(uint32_t slot) {
+  m_lru.splice(m_lru.begin(), m_lru, m_lruPos[slot]);
+  m_slotFrame[slot] = m_frame;
+}
+
+void VirtualTextureCache::SlotOrigin(uint32_t slot, uint32_t &x,
+                                     uint32_t &y) const {
+  x = (slot % m_slotsPerRow) * m_slotSize;
+  y = (slot / m_slotsPerRow) * m_slotSize;
+}
+
+const std::vector<VirtualTileUpload> &VirtualTextureCache::EndFrame() {
+  ++m_frame;
+  m_uploads.clear();
+
+  std::sort(m_requests.begin(), m_requests.end(),
+            [](const Request &a, const Request &b) {
+              if (a.margin != b.margin) {
+                return !a.margin;
+              }
+              if (a.priority != b.priority) {
+                return a.priority < b.priority;
+              }
+              return a.tile < b.tile;
+            });
+
+  // 予算に収まる分だけを対象にする
+  const size_t wanted = std::min<size_t>(m_requests.size(), m_slotCount);
+
+  // 1) 常駐済みのものを先に使用中にして、追い出し候補から外す
+  for (size_t i = 0; i < wanted; ++i) {
+    const int32_t slot = m_tileSlot[m_requests[i].tile];
+    if (slot >= 0) {
+      Touch(static_cast<uint32_t>(slot));
+    }
+  }
+
+  // 2) 足りないものを優先度順にラスタライズ（1フレームの上限まで）
+  size_t missing = m_requests.size() - wanted;
+  for (size_t i = 0; i < wanted; ++i) {
+    const uint32_t tile = m_requests[i].tile;
+    if (m_tileSlot[tile] >= 0) {
+      continue;
+    }
+    if (m_uploads.size() >= m_config.maxUploadsPerFrame) {
+      ++missing;
+      continue;
+    }
+
+    uint32_t slot;
+    if (!m_freeSlots.empty()) {
+      slot = m_freeSlots.back();
+      m_freeSlots.pop_back();
+      m_lru.push_front(slot);
+      m_lruPos[slot] = m_lru.begin();
+    } else {
+      // このフレームで使っていない最も古いタイルを追い出す
+      slot = m_lru.back();
+      if (m_slotFrame[slot] == m_frame) {
+        ++missing;
+        continue;
+      }
+      m_tileSlot[m_slotTile[slot]] = -1;
+      ++m_stats.evictions;
+      --m_stats.residentTiles;
+    }
+    Touch(slot);
+    m_slotTile[slot] = static_cast<int32_t>(tile);
+    m_tileSlot[tile] = static_cast<int32_t>(slot);
+    ++m_stats.residentTiles;
+
+    VirtualTileUpload upload;
+    upload.tileX = tile % m_tilesX;
+    upload.tileY = tile / m_tilesX;
+    upload.slot = slot;
+    upload.sourceX = static_cast<int32_t>(upload.tileX * m_config.tileSize) -
+                     static_cast<int32_t>(m_config.border);
+    upload.sourceY = static_cast<int32_t>(upload.tileY * m_config.tileSize) -
+                     static_cast<int32_t>(m_config.border);
+    SlotOrigin(slot, upload.atlasX, upload.atlasY);
+    upload.size = m_slotSize;
+    m_uploads.push_back(upload);
+    m_pageTableDirty = true;
+  }
+
+  m_stats.requestedTiles = m_requests.size();
+  m_stats.missingTiles = missing;
+  m_stats.uploads = m_uploads.size();
+  m_stats.totalUploads += m_uploads.size();
+  return m_uploads;
+}
+
+void VirtualTextureCache::WritePageTable(float *rgba) const {
+  const float invW = m_atlasWidth ? 1.0f / m_atlasWidth : 0.0f;
+  const float invH = m_atlasHeight ? 1.0f / m_atlasHeight : 0.0f;
+  for (size_t tile = 0; tile < m_tileSlot.size(); ++tile) {
+    float *entry = rgba + tile * 4;
+    const int32_t slot = m_tileSlot[tile];
+    if (slot < 0) {
+      entry[0] = entry[1] = entry[2] = entry[3] = 0.0f;
+      continue;
+    }
+    uint32_t x, y;
+    SlotOrigin(static_cast<uint32_t>(slot), x, y);
+    entry[0] = (x + m_config.border) * invW;
+    entry[1] = (y + m_config.border) * invH;
+    entry[2] = m_config.tileSize * invW;
+    entry[3] = m_config.tileSize * invH;
+  }
+}
+
+} // namespace graphics
@@ -0,0 +1,156 @@
+#pragma once
+/**
+ * @file VirtualTextureCache.h
+ * @brief タイル分割した仮想テクスチャの常駐管理（GPU 非依存）
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <vector>
+
+namespace graphics {
+
+/// @brief 仮想テクスチャの設定
+struct VirtualTextureConfig {
+  uint32_t width = 0;        ///< 仮想テクスチャ全体の幅（ピクセル）
+  uint32_t height = 0;       ///< 仮想テクスチャ全体の高さ（ピクセル）
+  uint32_t tileSize = 256;   ///< タイルの一辺（境界を除く）
+  uint32_t border = 1;       ///< バイリニア補間用にタイルの周りへ足す画素
+  uint32_t bytesPerPixel = 4;
+  /// アトラス・低解像度版・ページテーブルを合わせた上限（バイト）
+  uint64_t memoryBudget = 64ull * 1024 * 1024;
+  float fallbackScale = 0.125f; ///< 全体を1枚に収める低解像度版の縮尺
+  uint32_t marginTiles = 1;     ///< 要求範囲の外側に先読みするタイル数
+  uint32_t maxUploadsPerFrame = 4; ///< 1フレームにラスタライズする上限
+  uint32_t maxAtlasSize = 16384;   ///< アトラスの一辺の上限（ピクセル）
+};
+
+/// @brief このフレームにラスタライズしてアトラスへ置くタイル
+struct VirtualTileUpload {
+  uint32_t tileX = 0;
+  uint32_t tileY = 0;
+  uint32_t slot = 0;
+  int32_t sourceX = 0; ///< 仮想テクスチャ上の範囲の左上（境界込み）
+  int32_t sourceY = 0;
+  uint32_t atlasX = 0; ///< アトラス上のスロットの左上（境界込み）
+  uint32_t atlasY = 0;
+  uint32_t size = 0;   ///< 一辺（tileSize + 2 * border）
+};
+
+/// @brief 常駐状況の統計
+struct VirtualTextureStats {
+  size_t requestedTiles = 0; ///< 直近のフレームで要求されたタイル数
+  size_t missingTiles = 0;   ///< うち常駐しておらず低解像度版で描くもの
+  size_t residentTiles = 0;
+  size_t uploads = 0;        ///< 直近のフレームのラスタライズ数
+  size_t totalUploads = 0;
+  size_t evictions = 0;
+  uint64_t atlasBytes = 0;
+  uint64_t fallbackBytes = 0;
+  uint64_t pageTableBytes = 0;
+
+  uint64_t TotalBytes() const {
+    return atlasBytes + fallbackBytes + pageTableBytes;
+  }
+};
+
+/// @brief 仮想テクスチャのタイル常駐管理
+/// @details 仮想テクスチャ（記事全体）を tileSize 四方のタイルに分け、
+///          表示に必要なタイルだけをアトラス上のスロットに置く。
+///          スロット数はメモリ予算から低解像度版とページテーブルの分を
+///          引いて決まり、足りなくなったら最後に使ったフレームが
+///          古いタイルから追い出す（LRU）。
+///          毎フレーム BeginFrame → RequestRegion（表示範囲ごと）→
+///          EndFrame の順に呼ぶと、EndFrame がラスタライズすべきタイルを
+///          優先度順に返す。1フレームの上限を超えた分や、予算に
+///          収まらない分は常駐せず、シェーダーは低解像度版で描く。
+///          GPU には触れないので、判定はヘッドレスで検証できる。
+class VirtualTextureCache {
+public:
+  explicit VirtualTextureCache(const VirtualTextureConfig &config);
+
+  const VirtualTextureConfig &GetConfig() const { return m_config; }
+
+  uint32_t GetTilesX() const { return m_tilesX; }
+  uint32_t GetTilesY() const { return m_tilesY; }
+  uint32_t GetSlotCount() const { return m_slotCount; }
+  uint32_t GetSlotSize() const { return m_slotSize; }
+  uint32_t GetAtlasWidth() const { return m_atlasWidth; }
+  uint32_t GetAtlasHeight() const { return m_atlasHeight; }
+  uint32_t GetFallbackWidth() const { return m_fallbackWidth; }
+  uint32_t GetFallbackHeight() const { return m_fallbackHeight; }
+
+  /// @brief 同じ記事を1枚のテクスチャで持った場合のバイト数
+  uint64_t GetFullTextureBytes() const;
+
+  /// @brief 要求の受付を始める
+  void BeginFrame();
+
+  /// @brief 表示に必要な範囲を UV（0〜1）で要求する
+  /// @param priority 小さいほど先に常駐させる（カメラからの距離など）
+  /// @details 範囲の外側 marginTiles 枚も、表示範囲より低い優先度で要求する。
+  void RequestRegion(float u0, float v0, float u1, float v1, float priority);
+
+  /// @brief 要求を締め切って常駐を更新する
+  /// @return このフレームにラスタライズするタイル（優先度順）
+  const std::vector<VirtualTileUpload> &EndFrame();
+
+  /// @brief タイルの置かれたスロット（常駐していなければ -1）
+  int32_t GetSlot(uint32_t tileX, uint32_t tileY) const {
+    return m_tileSlot[static_cast<size_t>(tileY) * m_tilesX + tileX];
+  }
+
+  /// @brief ページテーブルを書き出す（タイルごとに float4）
+  /// @details (アトラス上の内容の左上 u, v, タイルの幅 u, 高さ v)。
+  ///          常駐していないタイルは 0 で、シェーダーは z > 0 で判定する。
+  void WritePageTable(float *rgba) const;
+
+  /// @brief 前回 ClearPageTableDirty してから常駐が変わったか
+  bool IsPageTableDirty() const { return m_pageTableDirty; }
+  void ClearPageTableDirty() { m_pageTableDirty = false; }
+
+  const VirtualTextureStats &GetStats() const { return m_stats; }
+
+  /// @brief すべてのタイルを追い出す
+  void Reset();
+
+private:
+  struct Request {
+    uint32_t tile;
+    float priority;
+    bool margin; ///< 先読み分（表示範囲の後に回す）
+  };
+
+  void RequestTile(uint32_t tile, float priority, bool margin);
+  void Touch(uint32_t slot);
+  void SlotOrigin(uint32_t slot, uint32_t &x, uint32_t &y) const;
+
+  VirtualTextureConfig m_config;
+  uint32_t m_tilesX = 0;
+  uint32_t m_tilesY = 0;
+  uint32_t m_slotSize = 0;
+  uint32_t m_slotCount = 0;
+  uint32_t m_slotsPerRow = 0;
+  uint32_t m_atlasWidth = 0;
+  uint32_t m_atlasHeight = 0;
+  uint32_t m_fallbackWidth = 0;
+  uint32_t m_fallbackHeight = 0;
+
+  std::vector<int32_t> m_tileSlot;    ///< タイル → スロット（-1 は非常駐）
+  std::vector<int32_t> m_requestSlot; ///< タイル → m_requests の位置
+  std::vector<Request> m_requests;
+
+  std::vector<int32_t> m_slotTile;   ///< スロット → タイル（-1 は空き）
+  std::vector<uint64_t> m_slotFrame; ///< スロットを最後に使ったフレーム
+  std::list<uint32_t> m_lru;         ///< スロット。先頭ほど最近使った
+  std::vector<std::list<uint32_t>::iterator> m_lruPos;
+  std::vector<uint32_t> m_freeSlots;
+
+  std::vector<VirtualTileUpload> m_uploads;
+  uint64_t m_frame = 0;
+  bool m_pageTableDirty = true;
+  VirtualTextureStats m_stats;
+};
+
+} // namespace graphics
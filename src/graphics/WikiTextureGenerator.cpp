@@ -5,7 +5,12 @@
 
 #include "WikiTextureGenerator.h"
 #include "../core/Logger.h"
+#include "../core/StringUtils.h"
+#include "../core/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
 #include <d2d1_1.h>
+#include <memory>
 
 #pragma comment(lib, "d2d1.lib")
 #pragma comment(lib, "dwrite.lib")
@@ -71,24 +76,14 @@ bool WikiTextureGenerator::Initialize(ID3D11Device *device) {
     return false;
   }
 
-  // 6. テキストフォーマット作成
-  // タイトル用（大きめ、セリフ体風） - 2倍サイズ
-  hr = m_dwriteFactory->CreateTextFormat(
-      L"Georgia", nullptr, DWRITE_FONT_WEIGHT_NORMAL, DWRITE_FONT_STYLE_NORMAL,
-      DWRITE_FONT_STRETCH_NORMAL, 128.0f, L"ja-JP", &m_titleFormat);
-  if (FAILED(hr)) {
-    LOG_ERROR("WikiTexGen", "Failed to create title TextFormat");
-    return false;
-  }
-
-  // 本文用 - 2倍サイズ
-  hr = m_dwriteFactory->CreateTextFormat(
-      L"Meiryo", nullptr, DWRITE_FONT_WEIGHT_NORMAL, DWRITE_FONT_STYLE_NORMAL,
-      DWRITE_FONT_STRETCH_NORMAL, 64.0f, L"ja-JP", &m_bodyFormat);
-  if (FAILED(hr)) {
-    LOG_ERROR("WikiTexGen", "Failed to create body TextFormat");
+  // 6. レイアウトエンジン作成（タイトルはセリフ体、本文はメイリオ）
+  if (!m_glyphMetrics.Initialize(m_dwriteFactory.Get(), L"Georgia",
+                                 L"Meiryo")) {
+    LOG_ERROR("WikiTexGen", "Failed to load glyph metrics");
     return false;
   }
+  m_layoutEngine = std::make_unique<ArticleLayoutEngine>(m_glyphMetrics);
+  m_sdfAtlas = std::make_unique<SdfGlyphAtlas>();
 
   LOG_INFO("WikiTexGen", "Initialized successfully");
   return true;
@@ -97,8 +92,13 @@ bool WikiTextureGenerator::Initialize(ID3D11Device *device) {
 void WikiTextureGenerator::Shutdown() {
   m_offscreenBitmap.Reset();
   m_offscreenTexture.Reset();
-  m_titleFormat.Reset();
-  m_bodyFormat.Reset();
+  m_runFormats.clear();
+  m_layoutCache.Clear();
+  m_layoutEngine.reset();
+  m_glyphInstances.clear();
+  m_sdfAtlasSRV.Reset();
+  m_sdfAtlasTexture.Reset();
+  m_sdfAtlas.reset();
   m_d2dContext.Reset();
   m_d2dDevice.Reset();
   m_dwriteFactory.Reset();
@@ -148,157 +148,185 @@ bool WikiTextureGenerator::CreateOffscreenTarget(uint32_t width,
   return true;
 }
 
-WikiTextureResult WikiTextureGenerator::GenerateTexture(
-    const std::wstring &title, const std::wstring &articleText,
-    const std::vector<std::pair<std::wstring, std::string>> &links,
-    const std::string &targetPage, uint32_t width, uint32_t height) {
+IDWriteTextFormat *WikiTextureGenerator::GetRunFormat(ArticleFont font,
+                                                     float size) {
+  auto &format = m_runFormats[{font, size}];
+  if (!format) {
+    HRESULT hr = m_dwriteFactory->CreateTextFormat(
+        font == ArticleFont::Title ? L"Georgia" : L"Meiryo", nullptr,
+        DWRITE_FONT_WEIGHT_NORMAL, DWRITE_FONT_STYLE_NORMAL,
+        DWRITE_FONT_STRETCH_NORMAL, size, L"ja-JP", &format);
+    if (FAILED(hr)) {
+      LOG_ERROR("WikiTexGen", "Failed to create TextFormat ({})", size);
+      return nullptr;
+    }
+    // 行分割はレイアウトエンジンで済んでいる
+    format->SetWordWrapping(DWRITE_WORD_WRAPPING_NO_WRAP);
+  }
+  return format.Get();
+}
 
-  WikiTextureResult result;
-  result.width = width;
-  result.height = height;
+namespace {
+
+/// @brief レイアウトの文字（UTF-32）を DrawText 用の UTF-16 にする
+std::wstring ToUtf16(const char32_t *chars, size_t count) {
+  std::wstring out;
+  out.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    char32_t c = chars[i];
+    if (c >= 0x10000) {
+      c -= 0x10000;
+      out.push_back(static_cast<wchar_t>(0xD800 + (c >> 10)));
+      out.push_back(static_cast<wchar_t>(0xDC00 + (c & 0x3FF)));
+    } else {
+      out.push_back(static_cast<wchar_t>(c));
+    }
+  }
+  return out;
+}
 
-  if (!CreateOffscreenTarget(width, height)) {
-    LOG_ERROR("WikiTexGen", "Failed to create offscreen target");
-    return result;
+} // namespace
+
+/// @brief レイアウト済みの記事1ページ
+/// @details 全体を1枚に描くときも、仮想テクスチャのタイルを描くときも
+///          同じ Draw を使う（タイルは変換でずらして描く）。
+struct ArticlePage {
+  /// @brief 描く1ラン（ArticleGlyphRun を D2D 用に変換したもの）
+  struct Run {
+    std::wstring text;
+    ComPtr<IDWriteTextFormat> format;
+    D2D1_RECT_F rect; ///< 行の箱（上端 = ベースライン - アセント）
+    ID2D1SolidColorBrush *brush; ///< 下のブラシのどれか
+  };
+
+  std::shared_ptr<const ArticleLayout> layout;
+  float width = 0.0f;
+  ComPtr<ID2D1SolidColorBrush> textBrush, linkBrush, targetBrush, borderBrush,
+      whiteBrush;
+  std::vector<Run> runs;
+
+  void Draw(ID2D1DeviceContext *context) const {
+    // 背景クリア（Wikipedia白）
+    context->Clear(D2D1::ColorF(0.98f, 0.98f, 0.98f, 1.0f));
+
+    // ヘッダーライン（フォント拡大に合わせて位置調整）
+    context->DrawLine(D2D1::Point2F(20.0f, 120.0f),
+                      D2D1::Point2F(width - 20.0f, 120.0f), borderBrush.Get(),
+                      1.0f);
+
+    // 関連項目ボタン（ラベルはランとして上に描く）
+    for (const auto &button : layout->buttons) {
+      context->FillRectangle(
+          D2D1::RectF(button.x, button.y, button.x + button.width,
+                      button.y + button.height),
+          button.isTarget ? targetBrush.Get() : linkBrush.Get());
+    }
+
+    for (const auto &run : runs) {
+      context->DrawTextW(run.text.c_str(), static_cast<UINT32>(run.text.size()),
+                         run.format.Get(), run.rect, run.brush);
+    }
   }
+};
 
-  m_d2dContext->SetTarget(m_offscreenBitmap.Get());
-  m_d2dContext->BeginDraw();
+std::shared_ptr<ArticlePage> WikiTextureGenerator::LayoutArticle(
+    const std::wstring &title, const std::wstring &articleText,
+    const std::vector<std::pair<std::wstring, std::string>> &links,
+    const std::string &targetPage, uint32_t width, uint32_t height,
+    WikiTextureResult &result) {
+  if (!m_layoutEngine) {
+    LOG_ERROR("WikiTexGen", "Layout engine is not initialized");
+    return nullptr;
+  }
 
-  // 背景クリア（Wikipedia白）
-  m_d2dContext->Clear(D2D1::ColorF(0.98f, 0.98f, 0.98f, 1.0f));
+  ArticleLayoutInput input;
+  input.title = core::ToString(title);
+  input.text = core::ToString(articleText);
+  input.links.reserve(links.size());
+  for (const auto &link : links) {
+    input.links.push_back({core::ToString(link.first), link.second});
+  }
+  input.targetPage = targetPage;
+
+  ArticleLayoutCacheStats stats;
+  auto page = std::make_shared<ArticlePage>();
+  page->layout =
+      m_layoutCache.GetOrLayout(*m_layoutEngine, input, width, height, &stats);
+  page->width = static_cast<float>(width);
+  const ArticleLayout &layout = *page->layout;
+  LOG_DEBUG("WikiTexGen", "Layout {} in {:.2f} ms ({} lines, {} runs)",
+            stats.hit ? "cached" : "built", stats.elapsedMs, layout.lineCount,
+            layout.runs.size());
 
   // ブラシ作成
-  ComPtr<ID2D1SolidColorBrush> textBrush, linkBrush, targetBrush, borderBrush;
   m_d2dContext->CreateSolidColorBrush(D2D1::ColorF(0.125f, 0.129f, 0.133f),
-                                      &textBrush);
+                                      &page->textBrush);
   m_d2dContext->CreateSolidColorBrush(D2D1::ColorF(0.2f, 0.4f, 0.8f),
-                                      &linkBrush);
+                                      &page->linkBrush);
   m_d2dContext->CreateSolidColorBrush(D2D1::ColorF(0.8f, 0.1f, 0.1f),
-                                      &targetBrush);
+                                      &page->targetBrush);
   m_d2dContext->CreateSolidColorBrush(D2D1::ColorF(0.635f, 0.663f, 0.694f),
-                                      &borderBrush);
-
-  // ヘッダーライン（フォント拡大に合わせて位置調整）
-  m_d2dContext->DrawLine(D2D1::Point2F(20.0f, 120.0f),
-                         D2D1::Point2F(width - 20.0f, 120.0f),
-                         borderBrush.Get(), 1.0f);
+                                      &page->borderBrush);
+  m_d2dContext->CreateSolidColorBrush(D2D1::ColorF(1.0f, 1.0f, 1.0f),
+                                      &page->whiteBrush);
+
+  page->runs.reserve(layout.runs.size());
+  for (const ArticleGlyphRun &run : layout.runs) {
+    IDWriteTextFormat *format = GetRunFormat(run.font, run.fontSize);
+    if (!format) {
+      return nullptr;
+    }
+    ID2D1SolidColorBrush *brush = page->textBrush.Get();
+    if (run.style == ArticleRunStyle::Link) {
+      brush = page->linkBrush.Get();
+    } else if (run.style == ArticleRunStyle::TargetLink) {
+      brush = page->targetBrush.Get();
+    } else if (run.style == ArticleRunStyle::Button) {
+      brush = page->whiteBrush.Get();
+    }
 
-  // タイトル描画
-  D2D1_RECT_F titleRect = D2D1::RectF(20.0f, 15.0f, width - 20.0f, 115.0f);
-  m_d2dContext->DrawTextW(title.c_str(), static_cast<UINT32>(title.length()),
-                          m_titleFormat.Get(), titleRect, textBrush.Get());
+    const FontVerticalMetrics vm = m_glyphMetrics.GetVerticalMetrics(run.font);
+    const float top = run.baseline - vm.ascent * run.fontSize;
+    float right = run.x;
+    for (uint32_t k = 0; k < run.length; ++k) {
+      right += layout.advances[run.start + k];
+    }
+    page->runs.push_back(
+        {ToUtf16(layout.text.data() + run.start, run.length), format,
+         D2D1::RectF(run.x, top, right, top + vm.LineHeight() * run.fontSize),
+         brush});
+  }
 
-  // 本文描画（リンクをハイライト）
-  float currentY = 140.0f;
-  float marginX = 40.0f;
+  result.links = layout.links;
+  result.images = layout.images;
+  result.headings = layout.headings;
+  return page;
+}
 
-  ComPtr<IDWriteTextLayout> textLayout;
-  float maxWidth = static_cast<float>(width) - marginX * 2;
-  float maxHeight = static_cast<float>(height) - currentY - 80.0f;
+WikiTextureResult WikiTextureGenerator::GenerateTexture(
+    const std::wstring &title, const std::wstring &articleText,
+    const std::vector<std::pair<std::wstring, std::string>> &links,
+    const std::string &targetPage, uint32_t width, uint32_t height) {
 
-  HRESULT hr = m_dwriteFactory->CreateTextLayout(
-      articleText.c_str(), static_cast<UINT32>(articleText.length()),
-      m_bodyFormat.Get(), maxWidth, maxHeight, &textLayout);
+  WikiTextureResult result;
+  result.width = width;
+  result.height = height;
 
-  if (FAILED(hr)) {
-    LOG_ERROR("WikiTexGen", "Failed to create TextLayout");
+  auto page = LayoutArticle(title, articleText, links, targetPage, width,
+                            height, result);
+  if (!page) {
     return result;
   }
 
-  // リンクの探索とハイライト
-  std::vector<bool> linkMatched(links.size(), false);
-
-  for (size_t i = 0; i < links.size(); ++i) {
-    const auto &linkPair = links[i];
-    const std::wstring &linkTitle = linkPair.first;
-
-    size_t pos = articleText.find(linkTitle);
-    while (pos != std::string::npos) {
-      DWRITE_TEXT_RANGE range = {static_cast<UINT32>(pos),
-                                 static_cast<UINT32>(linkTitle.length())};
-
-      bool isTarget = (linkPair.second == targetPage);
-      textLayout->SetDrawingEffect(
-          isTarget ? targetBrush.Get() : linkBrush.Get(), range);
-
-      UINT32 actualHitTestCount = 0;
-      textLayout->HitTestTextRange(range.startPosition, range.length, 0, 0,
-                                   nullptr, 0, &actualHitTestCount);
-      if (actualHitTestCount > 0) {
-        std::vector<DWRITE_HIT_TEST_METRICS> metrics(actualHitTestCount);
-        float hitX, hitY;
-        textLayout->HitTestTextRange(
-            range.startPosition, range.length, 0.0f, 0.0f, metrics.data(),
-            actualHitTestCount, &actualHitTestCount);
-
-        for (const auto &m : metrics) {
-          LinkRegion region;
-          region.targetPage = linkPair.second;
-          region.x = m.left + marginX;
-          region.y = m.top + currentY;
-          region.width = m.width;
-          region.height = m.height;
-          region.isTarget = isTarget;
-          result.links.push_back(region);
-        }
-      }
-
-      linkMatched[i] = true;
-      pos = articleText.find(linkTitle, pos + 1);
-    }
-  }
-
-  // 本文描画
-  m_d2dContext->DrawTextLayout(D2D1::Point2F(marginX, currentY),
-                               textLayout.Get(), textBrush.Get());
-
-  // マッチしなかったリンクを下部に「関連項目」として表示
-  DWRITE_TEXT_METRICS textMetrics;
-  textLayout->GetMetrics(&textMetrics);
-  float seeAlsoY = currentY + textMetrics.height + 60.0f;
-
-  if (seeAlsoY < height - 50.0f) {
-    float linkSpacing = 60.0f;
-    int unmatchedCount = 0;
-
-    for (size_t i = 0; i < links.size(); ++i) {
-      if (!linkMatched[i]) {
-        const auto &link = links[i];
-        bool isTarget = (link.second == targetPage);
-
-        float lx = marginX + (unmatchedCount % 3) * 220.0f;
-        float ly = seeAlsoY + (unmatchedCount / 3) * linkSpacing;
-
-        if (ly > height - 40.0f)
-          break;
-
-        D2D1_RECT_F linkRect = D2D1::RectF(lx, ly, lx + 200.0f, ly + 50.0f);
-        m_d2dContext->FillRectangle(linkRect, isTarget ? targetBrush.Get()
-                                                       : linkBrush.Get());
-
-        ComPtr<ID2D1SolidColorBrush> whiteBrush;
-        m_d2dContext->CreateSolidColorBrush(D2D1::ColorF(1.0f, 1.0f, 1.0f),
-                                            &whiteBrush);
-        m_d2dContext->DrawTextW(link.first.c_str(),
-                                static_cast<UINT32>(link.first.length()),
-                                m_bodyFormat.Get(), linkRect, whiteBrush.Get());
-
-        LinkRegion region;
-        region.targetPage = link.second;
-        region.x = lx;
-        region.y = ly;
-        region.width = 200.0f;
-        region.height = 50.0f;
-        region.isTarget = isTarget;
-        result.links.push_back(region);
-
-        unmatchedCount++;
-      }
-    }
+  if (!CreateOffscreenTarget(width, height)) {
+    LOG_ERROR("WikiTexGen", "Failed to create offscreen target");
+    return result;
   }
 
-  hr = m_d2dContext->EndDraw();
+  m_d2dContext->SetTarget(m_offscreenBitmap.Get());
+  m_d2dContext->BeginDraw();
+  page->Draw(m_d2dContext.Get());
+  HRESULT hr = m_d2dContext->EndDraw();
   if (FAILED(hr)) {
     LOG_ERROR("WikiTexGen", "D2D EndDraw failed");
     return result;
@@ -320,9 +348,217 @@ WikiTextureResult WikiTextureGenerator::GenerateTexture(
   result.texture = m_offscreenTexture;
   result.srv = srv;
 
+  // 遠くから見下ろすと強く縮小されるので、ミップをワーカーで作る。
+  // 細い文字がにじまないよう Kaiser で、色は線形に戻して平均する
+  MipChainSettings mipSettings;
+  mipSettings.filter = MipFilter::Kaiser;
+  mipSettings.srgb = true;
+  ComPtr<ID3D11DeviceContext> context;
+  m_d3dDevice->GetImmediateContext(&context);
+  auto mips = std::make_shared<AsyncMipTexture>();
+  if (mips->Start(m_d3dDevice.Get(), context.Get(), m_offscreenTexture.Get(),
+                  mipSettings, core::ThreadPool::Shared())) {
+    result.mips = std::move(mips);
+  }
+
   LOG_INFO("WikiTexGen", "Generated texture {}x{} with {} links", width, height,
            result.links.size());
   return result;
 }
 
+WikiTextureResult WikiTextureGenerator::GenerateVirtualTexture(
+    const std::wstring &title, const std::wstring &articleText,
+    const std::vector<std::pair<std::wstring, std::string>> &links,
+    const std::string &targetPage, uint32_t width, uint32_t height,
+    const VirtualTextureConfig &config) {
+
+  WikiTextureResult result;
+  result.width = width;
+  result.height = height;
+
+  auto page = LayoutArticle(title, articleText, links, targetPage, width,
+                            height, result);
+  if (!page) {
+    return result;
+  }
+
+  VirtualTextureConfig vtConfig = config;
+  vtConfig.width = width;
+  vtConfig.height = height;
+
+  // ページはタイルを描くたびに使うので、仮想テクスチャに持たせる
+  auto virtualTexture = std::make_shared<VirtualArticleTexture>();
+  if (!virtualTexture->Initialize(
+          m_d3dDevice.Get(), m_d2dContext.Get(), vtConfig,
+          [page](ID2D1DeviceContext *context) { page->Draw(context); })) {
+    LOG_ERROR("WikiTexGen", "Failed to create virtual texture");
+    return result;
+  }
+
+  // srv は低解像度版。ミニマップなど仮想テクスチャを知らない描画はこれを使う
+  result.srv = virtualTexture->GetFallbackSRV();
+  result.virtualTexture = std::move(virtualTexture);
+
+  LOG_INFO("WikiTexGen", "Generated virtual texture {}x{} with {} links",
+           width, height, result.links.size());
+  return result;
+}
+
+bool WikiTextureGenerator::UploadSdfAtlas() {
+  const uint32_t size = m_sdfAtlas->GetSize();
+  if (!m_sdfAtlasTexture) {
+    D3D11_TEXTURE2D_DESC texDesc = {};
+    texDesc.Width = size;
+    texDesc.Height = size;
+    texDesc.MipLevels = 1;
+    texDesc.ArraySize = 1;
+    texDesc.Format = DXGI_FORMAT_R8_UNORM;
+    texDesc.SampleDesc.Count = 1;
+    texDesc.Usage = D3D11_USAGE_DEFAULT;
+    texDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+    D3D11_SUBRESOURCE_DATA data = {};
+    data.pSysMem = m_sdfAtlas->GetPixels().data();
+    data.SysMemPitch = size;
+    if (FAILED(m_d3dDevice->CreateTexture2D(&texDesc, &data,
+                                            &m_sdfAtlasTexture)) ||
+        FAILED(m_d3dDevice->CreateShaderResourceView(
+            m_sdfAtlasTexture.Get(), nullptr, &m_sdfAtlasSRV))) {
+      LOG_ERROR("WikiTexGen", "Failed to create SDF atlas texture");
+      m_sdfAtlasTexture.Reset();
+      return false;
+    }
+    uint32_t x0, y0, x1, y1;
+    m_sdfAtlas->TakeDirtyRect(x0, y0, x1, y1); // 全体を送った
+    return true;
+  }
+
+  uint32_t x0, y0, x1, y1;
+  if (!m_sdfAtlas->TakeDirtyRect(x0, y0, x1, y1)) {
+    return true;
+  }
+  ComPtr<ID3D11DeviceContext> context;
+  m_d3dDevice->GetImmediateContext(&context);
+  const D3D11_BOX box = {x0, y0, 0, x1, y1, 1};
+  context->UpdateSubresource(
+      m_sdfAtlasTexture.Get(), 0, &box,
+      m_sdfAtlas->GetPixels().data() + static_cast<size_t>(y0) * size + x0,
+      size, 0);
+  return true;
+}
+
+WikiTextureResult WikiTextureGenerator::GenerateSdfText(
+    const std::wstring &title, const std::wstring &articleText,
+    const std::vector<std::pair<std::wstring, std::string>> &links,
+    const std::string &targetPage, uint32_t width, uint32_t height) {
+
+  WikiTextureResult result;
+  result.width = width;
+  result.height = height;
+
+  auto page = LayoutArticle(title, articleText, links, targetPage, width,
+                            height, result);
+  if (!page || !m_sdfAtlas) {
+    return result;
+  }
+
+  // 前のページのグリフで満杯なら、このページの分だけで作り直す
+  GlyphInstanceStats stats;
+  BuildGlyphInstances(*page->layout, *m_sdfAtlas, m_glyphOutlines,
+                      m_glyphInstances, &stats);
+  if (stats.missing > 0 && m_sdfAtlas->GetStats().glyphs > 0) {
+    m_sdfAtlas->Clear();
+    BuildGlyphInstances(*page->layout, *m_sdfAtlas, m_glyphOutlines,
+                        m_glyphInstances, &stats);
+  }
+  if (stats.missing > 0) {
+    LOG_WARN("WikiTexGen", "{} glyphs did not fit in the SDF atlas",
+             stats.missing);
+  }
+  if (!UploadSdfAtlas() || m_glyphInstances.empty()) {
+    return result;
+  }
+
+  auto text = std::make_shared<SdfArticleText>();
+  text->atlasSRV = m_sdfAtlasSRV;
+  text->instanceCount = static_cast<uint32_t>(m_glyphInstances.size());
+  text->width = width;
+  text->height = height;
+
+  D3D11_BUFFER_DESC bufferDesc = {};
+  bufferDesc.ByteWidth =
+      static_cast<UINT>(m_glyphInstances.size() * sizeof(GlyphInstance));
+  bufferDesc.Usage = D3D11_USAGE_IMMUTABLE;
+  bufferDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+  bufferDesc.MiscFlags = D3D11_RESOURCE_MISC_BUFFER_STRUCTURED;
+  bufferDesc.StructureByteStride = sizeof(GlyphInstance);
+  D3D11_SUBRESOURCE_DATA data = {};
+  data.pSysMem = m_glyphInstances.data();
+
+  D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
+  srvDesc.Format = DXGI_FORMAT_UNKNOWN;
+  srvDesc.ViewDimension = D3D11_SRV_DIMENSION_BUFFER;
+  srvDesc.Buffer.FirstElement = 0;
+  srvDesc.Buffer.NumElements = text->instanceCount;
+  if (FAILED(m_d3dDevice->CreateBuffer(&bufferDesc, &data,
+                                       &text->instanceBuffer)) ||
+      FAILED(m_d3dDevice->CreateShaderResourceView(
+          text->instanceBuffer.Get(), &srvDesc, &text->instanceSRV))) {
+    LOG_ERROR("WikiTexGen", "Failed to create glyph instance buffer");
+    return result;
+  }
+
+  // 地形のテクスチャは背景色だけ（文字はすべて四角形で描く）
+  constexpr uint32_t kBackgroundSize = 4;
+  if (!CreateOffscreenTarget(kBackgroundSize, kBackgroundSize)) {
+    return result;
+  }
+  m_d2dContext->SetTarget(m_offscreenBitmap.Get());
+  m_d2dContext->BeginDraw();
+  m_d2dContext->Clear(D2D1::ColorF(0.98f, 0.98f, 0.98f, 1.0f));
+  if (FAILED(m_d2dContext->EndDraw())) {
+    LOG_ERROR("WikiTexGen", "D2D EndDraw failed");
+    return result;
+  }
+  if (FAILED(m_d3dDevice->CreateShaderResourceView(
+          m_offscreenTexture.Get(), nullptr, &result.backgroundSRV))) {
+    LOG_ERROR("WikiTexGen", "Failed to create SRV");
+    return result;
+  }
+
+  // ミニマップ用の低解像度版（仮想テクスチャの低解像度版と同じ縮尺）
+  const float scale = VirtualTextureConfig{}.fallbackScale;
+  const uint32_t fw =
+      std::max(1u, static_cast<uint32_t>(std::ceil(width * scale)));
+  const uint32_t fh =
+      std::max(1u, static_cast<uint32_t>(std::ceil(height * scale)));
+  if (!CreateOffscreenTarget(fw, fh)) {
+    return result;
+  }
+  m_d2dContext->SetTarget(m_offscreenBitmap.Get());
+  m_d2dContext->BeginDraw();
+  m_d2dContext->SetTransform(D2D1::Matrix3x2F::Scale(
+      static_cast<float>(fw) / width, static_cast<float>(fh) / height));
+  page->Draw(m_d2dContext.Get());
+  m_d2dContext->SetTransform(D2D1::Matrix3x2F::Identity());
+  if (FAILED(m_d2dContext->EndDraw())) {
+    LOG_ERROR("WikiTexGen", "D2D EndDraw failed");
+    return result;
+  }
+  if (FAILED(m_d3dDevice->CreateShaderResourceView(m_offscreenTexture.Get(),
+                                                   nullptr, &result.srv))) {
+    LOG_ERROR("WikiTexGen", "Failed to create SRV");
+    return result;
+  }
+  result.texture = m_offscreenTexture;
+  result.sdfText = std::move(text);
+
+  LOG_INFO("WikiTexGen",
+           "Generated SDF text {}x{}: {} glyph quads, {} rects, {} atlas "
+           "glyphs, {} links",
+           width, height, stats.glyphs, stats.rects,
+           m_sdfAtlas->GetStats().glyphs, result.links.size());
+  return result;
+}
+
 } // namespace graphics
@@ -3,14 +3,24 @@
  * @file WikiTextureGenerator.h
  * @brief Wikipedia記事テキストからD3D11テクスチャを生成
  *
- * D2D1でオフスクリーンレンダリングし、結果をD3D11 Texture2Dとして返す。
+ * レイアウトは ArticleLayoutEngine（DirectWrite の寸法を使う）で求め、
+ * D2D1 はその GlyphRun をオフスクリーンに描くだけにする。
  * リンク位置も座標として記録する。
  */
 
+#include "ArticleGlyphInstances.h"
+#include "ArticleLayout.h"
+#include "AsyncMipTexture.h"
+#include "DWriteGlyphMetrics.h"
+#include "DWriteGlyphOutlines.h"
+#include "SdfArticleText.h"
+#include "VirtualArticleTexture.h"
 #include <d2d1_1.h>
 #include <d3d11.h>
 #include <dwrite.h>
 #include <dxgi.h>
+#include <map>
+#include <memory>
 #include <string>
 #include <vector>
 #include <wrl/client.h>
@@ -19,39 +29,20 @@ namespace graphics {
 
 using Microsoft::WRL::ComPtr;
 
-/**
- * @brief リンク領域情報
- */
-struct LinkRegion {
-  std::string targetPage; ///< 遷移先ページ名
-  float x, y;             ///< テクスチャ上の位置（ピクセル）
-  float width, height;    ///< サイズ（ピクセル）
-  bool isTarget;          ///< 目標リンクか
-};
-
-/**
- * @brief 画像配置領域（障害物用）
- */
-struct ImageRegion {
-  float x, y;          ///< ピクセル座標
-  float width, height; ///< サイズ
-};
-
-/**
- * @brief 見出し配置領域（段差用）
- */
-struct HeadingRegion {
-  float x, y;          ///< ピクセル座標
-  float width, height; ///< サイズ
-  int level;           ///< 見出しレベル (1=H1, 2=H2...)
-};
-
 /**
  * @brief Wikipedia風テクスチャ生成結果
  */
 struct WikiTextureResult {
   ComPtr<ID3D11Texture2D> texture;
-  ComPtr<ID3D11ShaderResourceView> srv;
+  ComPtr<ID3D11ShaderResourceView> srv; ///< 仮想テクスチャ・SDF では低解像度版
+  /// GenerateSdfText で作ったときだけ持つ。地形に貼る背景色だけのテクスチャ
+  ComPtr<ID3D11ShaderResourceView> backgroundSRV;
+  /// GenerateVirtualTexture で作ったときだけ持つ（texture は空）
+  std::shared_ptr<VirtualArticleTexture> virtualTexture;
+  /// GenerateSdfText で作ったときだけ持つ
+  std::shared_ptr<SdfArticleText> sdfText;
+  /// GenerateTexture で作ったときだけ持つ。出来たら srv と差し替える
+  std::shared_ptr<AsyncMipTexture> mips;
   uint32_t width = 0;
   uint32_t height = 0;
   std::vector<LinkRegion> links;
@@ -59,6 +50,8 @@ struct WikiTextureResult {
   std::vector<HeadingRegion> headings;
 };
 
+struct ArticlePage;
+
 /**
  * @brief Wikipedia記事テクスチャ生成器
  */
@@ -91,17 +84,68 @@ public:
       const std::vector<std::pair<std::wstring, std::string>> &links,
       const std::string &targetPage, uint32_t width, uint32_t height);
 
+  /// @brief Wikipedia記事から仮想テクスチャを生成
+  /// @details レイアウトとリンク位置は GenerateTexture と同じ。
+  ///          全体は縮小した低解像度版だけを描き、原寸のタイルは
+  ///          result.virtualTexture が表示時に描く。
+  /// @param config タイルの大きさ・メモリ予算（width, height は上書き）
+  WikiTextureResult GenerateVirtualTexture(
+      const std::wstring &title, const std::wstring &articleText,
+      const std::vector<std::pair<std::wstring, std::string>> &links,
+      const std::string &targetPage, uint32_t width, uint32_t height,
+      const VirtualTextureConfig &config);
+
+  /// @brief Wikipedia記事を SDF グリフで描く形で生成
+  /// @details レイアウトとリンク位置は GenerateTexture と同じ。文字・罫線・
+  ///          ボタンは result.sdfText の四角形として地形の上に描き、
+  ///          地形のテクスチャ（backgroundSRV）は背景色だけの小さなものに
+  ///          する。srv には仮想テクスチャと同じ縮尺の低解像度版を描く
+  ///          （ミニマップなど四角形を描かない描画用）。
+  ///          グリフのアトラスはページをまたいで使い回し、足りなくなったら
+  ///          作り直す。
+  WikiTextureResult GenerateSdfText(
+      const std::wstring &title, const std::wstring &articleText,
+      const std::vector<std::pair<std::wstring, std::string>> &links,
+      const std::string &targetPage, uint32_t width, uint32_t height);
+
 private:
+  /// @brief 記事をレイアウトし、リンク位置を result に入れる
+  /// @details 同じ記事・大きさのレイアウトはキャッシュから返す。
+  /// @return 描画内容（失敗なら nullptr）
+  std::shared_ptr<ArticlePage> LayoutArticle(
+      const std::wstring &title, const std::wstring &articleText,
+      const std::vector<std::pair<std::wstring, std::string>> &links,
+      const std::string &targetPage, uint32_t width, uint32_t height,
+      WikiTextureResult &result);
+
   /// @brief D2Dオフスクリーンターゲット作成
   bool CreateOffscreenTarget(uint32_t width, uint32_t height);
 
+  /// @brief ラン描画用の折り返さない TextFormat（書体・大きさごとに作る）
+  IDWriteTextFormat *GetRunFormat(ArticleFont font, float size);
+
+  /// @brief SDF アトラスの変わった範囲を GPU に送る
+  bool UploadSdfAtlas();
+
   // D2D/DWrite オブジェクト
   ComPtr<ID2D1Factory1> m_d2dFactory;
   ComPtr<ID2D1DeviceContext> m_d2dContext;
   ComPtr<ID2D1Device> m_d2dDevice;
   ComPtr<IDWriteFactory> m_dwriteFactory;
-  ComPtr<IDWriteTextFormat> m_titleFormat;
-  ComPtr<IDWriteTextFormat> m_bodyFormat;
+  std::map<std::pair<ArticleFont, float>, ComPtr<IDWriteTextFormat>>
+      m_runFormats;
+
+  // レイアウト（寸法 → エンジン → キャッシュの順に作る）
+  DWriteGlyphMetrics m_glyphMetrics;
+  std::unique_ptr<ArticleLayoutEngine> m_layoutEngine;
+  ArticleLayoutCache m_layoutCache;
+
+  // SDF グリフ（アトラスは全ページで1枚）
+  DWriteGlyphOutlines m_glyphOutlines{m_glyphMetrics};
+  std::unique_ptr<SdfGlyphAtlas> m_sdfAtlas;
+  ComPtr<ID3D11Texture2D> m_sdfAtlasTexture;
+  ComPtr<ID3D11ShaderResourceView> m_sdfAtlasSRV;
+  std::vector<GlyphInstance> m_glyphInstances;
 
   // D3D11 オブジェクト
   ComPtr<ID3D11Device> m_d3dDevice;
@@ -0,0 +1,231 @@
+/**
+ * @file AsyncLoadQueue.cpp
+ * @brief 非同期ロードキューの実装
+ */
+
+#include "AsyncLoadQueue.h"
+#include "../core/ThreadPool.h"
+#include <algorithm>
+#include <limits>
+
+namespace resources {
+
+namespace {
+
+double MsSince(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+} // namespace
+
+AsyncLoadQueue::AsyncLoadQueue(core::ThreadPool &pool) : m_pool(pool) {}
+
+AsyncLoadQueue::~AsyncLoadQueue() {
+  Clear();
+  // ワーカーが this に結果を書き終えるまで待つ
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_cv.wait(lock, [this]() { return m_inFlight == 0; });
+}
+
+LoadTicket AsyncLoadQueue::Enqueue(DecodeFn decode, UploadFn upload,
+                                   DoneFn done,
+                                   const std::vector<LoadTicket> &after) {
+  const LoadTicket ticket = m_nextTicket++;
+  Entry &entry = m_entries[ticket];
+  entry.decode = std::move(decode);
+  entry.upload = std::move(upload);
+  entry.done = std::move(done);
+  entry.enqueued = Clock::now();
+  ++m_pendingCount;
+
+  // 依存先が失敗していても、done は Update から呼ぶために一度待たせる
+  bool blocked = false;
+  for (LoadTicket dep : after) {
+    const LoadStatus status = GetStatus(dep);
+    if (status != LoadStatus::Done && status != LoadStatus::Unknown) {
+      entry.after.push_back(dep);
+      blocked = true;
+    }
+  }
+  if (blocked) {
+    m_waiting.push_back(ticket);
+  } else {
+    StartDecode(ticket, entry);
+  }
+  return ticket;
+}
+
+void AsyncLoadQueue::StartDecode(LoadTicket ticket, Entry &entry) {
+  entry.after.clear();
+  if (!entry.decode) {
+    entry.status = LoadStatus::Uploading;
+    m_uploads.push_back(ticket);
+    return;
+  }
+
+  entry.status = LoadStatus::Decoding;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    ++m_inFlight;
+  }
+  m_pool.Submit([this, ticket, decode = std::move(entry.decode)]() {
+    bool success = false;
+    try {
+      success = decode();
+    } catch (...) {
+      success = false;
+    }
+    // 通知までロックの中で行い、デストラクタとの競合を防ぐ
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_decoded.emplace_back(ticket, success);
+    --m_inFlight;
+    m_cv.notify_all();
+  });
+}
+
+void AsyncLoadQueue::Finish(LoadTicket ticket, bool success) {
+  auto it = m_entries.find(ticket);
+  if (it == m_entries.end()) {
+    return;
+  }
+  Entry &entry = it->second;
+  entry.status = success ? LoadStatus::Done : LoadStatus::Failed;
+  entry.decode = nullptr;
+  entry.upload = nullptr;
+  entry.after.clear();
+  DoneFn done = std::move(entry.done);
+  entry.done = nullptr;
+
+  m_stats.worstLatencyMs =
+      std::max(m_stats.worstLatencyMs, MsSince(entry.enqueued));
+  if (success) {
+    ++m_stats.completed;
+  } else {
+    ++m_stats.failed;
+  }
+  --m_pendingCount;
+
+  // done の中から Enqueue されてもよいように、entry には以後触れない
+  if (done) {
+    done(success);
+  }
+}
+
+void AsyncLoadQueue::CollectDecoded() {
+  std::vector<std::pair<LoadTicket, bool>> decoded;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    decoded.swap(m_decoded);
+  }
+  for (const auto &[ticket, success] : decoded) {
+    auto it = m_entries.find(ticket);
+    if (it == m_entries.end() || it->second.status != LoadStatus::Decoding) {
+      continue; // Clear 済み
+    }
+    if (!success) {
+      Finish(ticket, false);
+      continue;
+    }
+    it->second.status = LoadStatus::Uploading;
+    m_uploads.push_back(ticket);
+  }
+}
+
+void AsyncLoadQueue::ResolveWaiting() {
+  // 失敗は依存の連鎖をたどって伝わるので、変化がなくなるまで繰り返す
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (size_t i = 0; i < m_waiting.size();) {
+      const LoadTicket ticket = m_waiting[i];
+      auto it = m_entries.find(ticket);
+      if (it == m_entries.end() || it->second.status != LoadStatus::Waiting) {
+        m_waiting.erase(m_waiting.begin() + i);
+        continue;
+      }
+      bool blocked = false;
+      bool failed = false;
+      for (LoadTicket dep : it->second.after) {
+        const LoadStatus status = GetStatus(dep);
+        failed |= status == LoadStatus::Failed;
+        blocked |= status != LoadStatus::Done && status != LoadStatus::Unknown;
+      }
+      if (!failed && blocked) {
+        ++i;
+        continue;
+      }
+      m_waiting.erase(m_waiting.begin() + i);
+      if (failed) {
+        Finish(ticket, false);
+        changed = true;
+      } else {
+        StartDecode(ticket, it->second);
+      }
+    }
+  }
+}
+
+uint32_t AsyncLoadQueue::Update(double budgetMs) {
+  CollectDecoded();
+  ResolveWaiting();
+
+  const Clock::time_point start = Clock::now();
+  uint32_t uploaded = 0;
+  double elapsedMs = 0.0;
+  while (!m_uploads.empty() && (uploaded == 0 || elapsedMs < budgetMs)) {
+    const LoadTicket ticket = m_uploads.front();
+    m_uploads.pop_front();
+    auto it = m_entries.find(ticket);
+    if (it == m_entries.end()) {
+      continue;
+    }
+    UploadFn upload = std::move(it->second.upload);
+    const bool success = !upload || upload();
+    Finish(ticket, success);
+    ++uploaded;
+    elapsedMs = MsSince(start);
+  }
+
+  if (uploaded > 0) {
+    ++m_stats.frames;
+    m_stats.lastUploadMs = elapsedMs;
+    m_stats.worstUploadMs = std::max(m_stats.worstUploadMs, elapsedMs);
+    m_stats.totalUploadMs += elapsedMs;
+    // 転送で Done になった依存先を待っていたものを動かす
+    ResolveWaiting();
+  } else {
+    m_stats.lastUploadMs = 0.0;
+  }
+  return uploaded;
+}
+
+void AsyncLoadQueue::Flush() {
+  while (m_pendingCount > 0) {
+    Update(std::numeric_limits<double>::infinity());
+    if (m_pendingCount == 0) {
+      break;
+    }
+    // 残りはワーカーで展開中のものだけ
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_cv.wait(lock,
+              [this]() { return !m_decoded.empty() || m_inFlight == 0; });
+  }
+}
+
+void AsyncLoadQueue::Clear() {
+  m_entries.clear();
+  m_waiting.clear();
+  m_uploads.clear();
+  m_pendingCount = 0;
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_decoded.clear();
+}
+
+LoadStatus AsyncLoadQueue::GetStatus(LoadTicket ticket) const {
+  auto it = m_entries.find(ticket);
+  return it == m_entries.end() ? LoadStatus::Unknown : it->second.status;
+}
+
+} // namespace resources
@@ -0,0 +1,139 @@
+#pragma once
+/**
+ * @file AsyncLoadQueue.h
+ * @brief ワーカーで読み込み、メインスレッドで予算内に仕上げる非同期ロードキュー
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace core {
+class ThreadPool;
+}
+
+namespace resources {
+
+/// @brief 非同期ロード1件の番号（0 は「なし」）
+using LoadTicket = uint32_t;
+
+/// @brief ロードの進み具合
+enum class LoadStatus {
+  Unknown,   ///< 登録されていない（Clear 後も含む）
+  Waiting,   ///< 依存先の完了待ち
+  Decoding,  ///< ワーカーで読み込み・展開・コンパイル中
+  Uploading, ///< 展開済み。メインスレッドでの GPU 転送待ち
+  Done,
+  Failed,
+};
+
+/// @brief AsyncLoadQueue の集計
+struct AsyncLoadStats {
+  uint64_t completed = 0;
+  uint64_t failed = 0;
+  uint64_t frames = 0;        ///< 転送をした Update の回数
+  double lastUploadMs = 0.0;  ///< 直前の Update で転送に使った時間
+  double worstUploadMs = 0.0; ///< 1回の Update で転送に使った最大の時間
+  double totalUploadMs = 0.0;
+  double worstLatencyMs = 0.0; ///< 登録から完了までの最大
+};
+
+/**
+ * @brief 読み込みを「ワーカーでの展開」と「メインスレッドでの転送」に分けて
+ *        進めるキュー
+ * @details Enqueue は番号をすぐ返し、decode をスレッドプールへ投げる。
+ *          decode が終わったものは Update（メインスレッドから毎フレーム）が
+ *          予算の範囲で upload し、done を呼ぶ。予算を超えても1件は必ず
+ *          転送するので、大きな転送が来ても止まらない。
+ *          after に挙げた番号がすべて Done になるまで decode を始めない。
+ *          どれかが Failed なら自分も decode せずに Failed になる。
+ *          upload・done は必ずメインスレッドの Update（または Flush）から、
+ *          登録順ではなく decode の終わった順に呼ばれる。
+ */
+class AsyncLoadQueue {
+public:
+  /// @brief ワーカーで呼ぶ。false で失敗
+  using DecodeFn = std::function<bool()>;
+  /// @brief メインスレッドで呼ぶ（GPU リソースの作成など）。false で失敗
+  using UploadFn = std::function<bool()>;
+  /// @brief 完了・失敗時にメインスレッドで呼ぶ
+  using DoneFn = std::function<void(bool success)>;
+
+  explicit AsyncLoadQueue(core::ThreadPool &pool);
+  /// @brief 待ち中のものを捨て、実行中の decode の終わりを待つ
+  ~AsyncLoadQueue();
+
+  AsyncLoadQueue(const AsyncLoadQueue &) = delete;
+  AsyncLoadQueue &operator=(const AsyncLoadQueue &) = delete;
+
+  /**
+   * @brief ロードを登録する
+   * @param decode 空ならすぐ転送待ちになる
+   * @param upload 空なら decode の成否がそのまま結果になる
+   * @param after 先に Done になっていてほしい番号（0 や Done 済みは無視）
+   */
+  LoadTicket Enqueue(DecodeFn decode, UploadFn upload, DoneFn done = {},
+                     const std::vector<LoadTicket> &after = {});
+
+  /// @brief 予算 budgetMs の範囲で転送を進め、転送した件数を返す
+  uint32_t Update(double budgetMs);
+
+  /// @brief すべて終わるまで待ちながら転送する（ロード画面・終了時用）
+  void Flush();
+
+  /// @brief 待ち中のものを完了を知らせずに捨てる（シーン遷移用）
+  /// @details 実行中の decode は最後まで走るが、結果は捨てる。
+  void Clear();
+
+  LoadStatus GetStatus(LoadTicket ticket) const;
+
+  /// @brief まだ Done / Failed になっていない件数
+  size_t GetPendingCount() const { return m_pendingCount; }
+  bool IsIdle() const { return m_pendingCount == 0; }
+
+  const AsyncLoadStats &GetStats() const { return m_stats; }
+  void ResetStats() { m_stats = {}; }
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  struct Entry {
+    LoadStatus status = LoadStatus::Waiting;
+    DecodeFn decode;
+    UploadFn upload;
+    DoneFn done;
+    std::vector<LoadTicket> after;
+    Clock::time_point enqueued;
+  };
+
+  void StartDecode(LoadTicket ticket, Entry &entry);
+  void Finish(LoadTicket ticket, bool success);
+  /// @brief ワーカーから届いた結果を転送待ちへ移す
+  void CollectDecoded();
+  /// @brief 依存先が片付いた待ち中のものを動かす
+  void ResolveWaiting();
+
+  core::ThreadPool &m_pool;
+  LoadTicket m_nextTicket = 1;
+
+  // 以下はメインスレッドのみ
+  std::unordered_map<LoadTicket, Entry> m_entries;
+  std::vector<LoadTicket> m_waiting;
+  std::deque<LoadTicket> m_uploads;
+  size_t m_pendingCount = 0;
+  AsyncLoadStats m_stats;
+
+  // ワーカーとの受け渡し
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::vector<std::pair<LoadTicket, bool>> m_decoded;
+  size_t m_inFlight = 0;
+};
+
+} // namespace resources
@@ -1,13 +1,20 @@
 #include "ResourceManager.h"
 #include "../core/Logger.h"
+#include "../core/MappedFile.h"
+#include "../core/ThreadPool.h"
 #include "../graphics/FbxLoader.h"
 #include "../graphics/GraphicsDevice.h"
+#include "../graphics/MeshCache.h"
 #include "../graphics/MeshPrimitives.h"
+#include "../graphics/MipChain.h"
 #include "../graphics/ObjLoader.h"
 #include "../core/StringUtils.h"
 #include <filesystem>
 #include <wincodec.h>
 #include <algorithm>
+#include <chrono>
+#include <memory>
+#include <mutex>
 #include <vector>
 #include <mfapi.h>
 #include <mfidl.h>
@@ -21,48 +28,96 @@
 
 namespace resources {
 
-ResourceManager::ResourceManager(graphics::GraphicsDevice &device)
-    : m_device(device),
-      m_meshPool(graphics::Mesh{}) // Fallback dummy (Empty Mesh)
-      ,
-      m_shaderPool(graphics::Shader{}) // Fallback dummy (Empty Shader)
-      ,
-      m_audioPool(audio::AudioClip{}) // Fallback
-{}
-
-// ... Mesh/Shaderの実装 ...
+namespace {
 
-// ===========================================
-// Audio Implementation
-// ===========================================
+using Clock = std::chrono::steady_clock;
 
-#include <wrl/client.h>
-
-// ===========================================
-// Audio Implementation (Media Foundation)
-// ===========================================
+/// @brief キャッシュ外の同期ロード1件の時間を集計に足す
+class SyncLoadTimer {
+public:
+  SyncLoadTimer(uint32_t &count, double &totalMs)
+      : m_count(count), m_totalMs(totalMs), m_start(Clock::now()) {}
+  ~SyncLoadTimer() {
+    ++m_count;
+    m_totalMs +=
+        std::chrono::duration<double, std::milli>(Clock::now() - m_start)
+            .count();
+  }
 
-AudioHandle ResourceManager::LoadAudio(const std::string &path) {
-  if (auto it = m_audioCache.find(path); it != m_audioCache.end()) {
-    return it->second;
+private:
+  uint32_t &m_count;
+  double &m_totalMs;
+  Clock::time_point m_start;
+};
+
+/// @brief ワーカーで COM（WIC・Media Foundation）を使う間だけ初期化する
+class ComScope {
+public:
+  ComScope() : m_hr(CoInitializeEx(nullptr, COINIT_MULTITHREADED)) {}
+  ~ComScope() {
+    if (SUCCEEDED(m_hr)) {
+      CoUninitialize();
+    }
   }
 
-  // MF初期化 (スレッドセーフではないが、メインスレッドからの呼び出しを想定)
-  static bool mfInitialized = false;
-  if (!mfInitialized) {
+private:
+  HRESULT m_hr;
+};
+
+/// @brief MF初期化（初回のみ。関数内 static の初期化はスレッドセーフ）
+bool StartMediaFoundation() {
+  static const bool started = []() {
     if (FAILED(MFStartup(MF_VERSION))) {
       LOG_ERROR("Resource", "MFStartup failed");
-      return {};
+      return false;
+    }
+    return true;
+  }();
+  return started;
+}
+
+/// @brief WIC Factory (lazy init)。ファクトリはどのスレッドからも使える
+IWICImagingFactory *GetWicFactory() {
+  static std::mutex s_mutex;
+  static Microsoft::WRL::ComPtr<IWICImagingFactory> s_factory;
+  std::lock_guard<std::mutex> lock(s_mutex);
+  if (!s_factory) {
+    HRESULT hr = CoCreateInstance(CLSID_WICImagingFactory, nullptr,
+                                  CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&s_factory));
+    if (FAILED(hr)) {
+      LOG_ERROR("Resource", "Failed to create WICImagingFactory (hr=0x{:08X})",
+                static_cast<uint32_t>(hr));
+      return nullptr;
     }
-    mfInitialized = true;
   }
+  return s_factory.Get();
+}
 
+/// @brief 展開済みの画像（段 0 とミップ）。GPU へ送る前の状態
+struct DecodedImage {
+  UINT width = 0;
+  UINT height = 0;
+  std::vector<BYTE> pixels;
+  std::vector<graphics::MipLevel> mips;
+};
+
+/// @brief 読み込んだメッシュの頂点（GPU へ送る前の状態）
+/// @details キャッシュから読めたときは cache がマップした領域を指し、
+///          vertices / indices は空のまま。
+struct DecodedMesh {
+  std::vector<graphics::Vertex> vertices;
+  std::vector<uint32_t> indices; ///< LOD0 の後ろに粗い LOD が続く
+  std::vector<graphics::MeshLod> lods;
+  core::MappedFile cacheFile;
+  graphics::MeshCacheView cache;
+  bool fromCache = false;
+  bool loaded = false;
+};
+
+/// @brief Media Foundation で PCM に展開する（COM の初期化は呼び出し側）
+bool DecodeAudioFile(const std::string &path, audio::AudioClip &clip) {
   // パス変換 (UTF-8 -> Wide)
-  int size_needed =
-      MultiByteToWideChar(CP_UTF8, 0, &path[0], (int)path.size(), NULL, 0);
-  std::wstring wpath(size_needed, 0);
-  MultiByteToWideChar(CP_UTF8, 0, &path[0], (int)path.size(), &wpath[0],
-                      size_needed);
+  const std::wstring wpath = core::ToWString(path);
 
   // Source Reader作成
   Microsoft::WRL::ComPtr<IMFSourceReader> pReader;
@@ -71,7 +126,7 @@ AudioHandle ResourceManager::LoadAudio(const std::string &path) {
   if (FAILED(hr)) {
     LOG_ERROR("Resource", "Failed to create SourceReader for: {} (hr={:x})",
               path, (uint32_t)hr);
-    return {};
+    return false;
   }
 
   // PCMフォーマットを要求
@@ -84,7 +139,7 @@ AudioHandle ResourceManager::LoadAudio(const std::string &path) {
                                     pPartialType.Get());
   if (FAILED(hr)) {
     LOG_ERROR("Resource", "Failed to set media type to PCM for: {}", path);
-    return {};
+    return false;
   }
 
   // 変換後の完全なフォーマットを取得
@@ -93,7 +148,7 @@ AudioHandle ResourceManager::LoadAudio(const std::string &path) {
                                     &pUncompressedAudioType);
   if (FAILED(hr)) {
     LOG_ERROR("Resource", "Failed to get current media type");
-    return {};
+    return false;
   }
 
   // WAVEFORMATEXへ変換
@@ -103,10 +158,10 @@ AudioHandle ResourceManager::LoadAudio(const std::string &path) {
                                            &cbFormat);
   if (FAILED(hr)) {
     LOG_ERROR("Resource", "Failed to convert to WAVEFORMATEX");
-    return {};
+    return false;
   }
 
-  audio::AudioClip clip = {};
+  clip = {};
   clip.format.resize(cbFormat);
   memcpy(clip.format.data(), pWfx, cbFormat);
   CoTaskMemFree(pWfx);
@@ -143,72 +198,35 @@ AudioHandle ResourceManager::LoadAudio(const std::string &path) {
 
   LOG_INFO("Resource", "Loaded Audio (MF): {} ({} bytes)", path,
            clip.buffer.size());
-
-  auto handle = m_audioPool.Add(std::move(clip));
-  m_audioCache[path] = handle;
-  return handle;
-}
-
-graphics::Mesh *ResourceManager::GetMesh(MeshHandle handle) {
-  if (handle.index == 0 && handle.generation == 0)
-    return nullptr;
-  return m_meshPool.Get(handle);
-}
-
-graphics::Shader *ResourceManager::GetShader(ShaderHandle handle) {
-  if (handle.index == 0 && handle.generation == 0)
-    return nullptr;
-  return m_shaderPool.Get(handle);
-}
-
-audio::AudioClip *ResourceManager::GetAudio(AudioHandle handle) {
-  if (handle.index == 0 && handle.generation == 0)
-    return nullptr;
-  return m_audioPool.Get(handle);
+  return true;
 }
 
-Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>
-ResourceManager::LoadTextureSRV(const std::string &path) {
-  if (auto it = m_textureCache.find(path); it != m_textureCache.end()) {
-    return it->second;
+/// @brief WIC で RGBA8 に展開し、ミップチェーンまで作る
+bool DecodeImageFile(const std::string &path, DecodedImage &image) {
+  IWICImagingFactory *factory = GetWicFactory();
+  if (!factory) {
+    return false;
   }
 
-  // WIC Factory (lazy init)
-  static Microsoft::WRL::ComPtr<IWICImagingFactory> s_factory;
-  if (!s_factory) {
-    HRESULT hr = CoCreateInstance(CLSID_WICImagingFactory, nullptr,
-                                  CLSCTX_INPROC_SERVER, IID_PPV_ARGS(&s_factory));
-    if (FAILED(hr)) {
-      LOG_ERROR("Resource", "Failed to create WICImagingFactory (hr=0x{:08X})",
-                static_cast<uint32_t>(hr));
-      return {};
-    }
-  }
-
-  int size_needed =
-      MultiByteToWideChar(CP_UTF8, 0, &path[0], (int)path.size(), NULL, 0);
-  std::wstring wpath(size_needed, 0);
-  MultiByteToWideChar(CP_UTF8, 0, &path[0], (int)path.size(), &wpath[0],
-                      size_needed);
-
+  const std::wstring wpath = core::ToWString(path);
   Microsoft::WRL::ComPtr<IWICBitmapDecoder> decoder;
-  HRESULT hr = s_factory->CreateDecoderFromFilename(
+  HRESULT hr = factory->CreateDecoderFromFilename(
       wpath.c_str(), nullptr, GENERIC_READ, WICDecodeMetadataCacheOnLoad,
       &decoder);
   if (FAILED(hr)) {
     LOG_ERROR("Resource", "Failed to decode texture: {} (hr=0x{:08X})", path,
               static_cast<uint32_t>(hr));
-    return {};
+    return false;
   }
 
   Microsoft::WRL::ComPtr<IWICBitmapFrameDecode> frame;
   decoder->GetFrame(0, &frame);
 
   Microsoft::WRL::ComPtr<IWICFormatConverter> converter;
-  hr = s_factory->CreateFormatConverter(&converter);
+  hr = factory->CreateFormatConverter(&converter);
   if (FAILED(hr)) {
     LOG_ERROR("Resource", "CreateFormatConverter failed for {}", path);
-    return {};
+    return false;
   }
 
   hr = converter->Initialize(frame.Get(), GUID_WICPixelFormat32bppRGBA,
@@ -216,48 +234,62 @@ ResourceManager::LoadTextureSRV(const std::string &path) {
                              WICBitmapPaletteTypeMedianCut);
   if (FAILED(hr)) {
     LOG_ERROR("Resource", "Format conversion failed for {}", path);
-    return {};
+    return false;
   }
 
-  UINT width = 0;
-  UINT height = 0;
-  converter->GetSize(&width, &height);
-  if (width == 0 || height == 0) {
+  converter->GetSize(&image.width, &image.height);
+  if (image.width == 0 || image.height == 0) {
     LOG_ERROR("Resource", "Texture has invalid size: {}", path);
-    return {};
+    return false;
   }
 
-  const UINT stride = width * 4;
-  const UINT bufferSize = stride * height;
-  std::vector<BYTE> pixels(bufferSize);
-  hr = converter->CopyPixels(nullptr, stride, bufferSize, pixels.data());
+  const UINT stride = image.width * 4;
+  const UINT bufferSize = stride * image.height;
+  image.pixels.resize(bufferSize);
+  hr = converter->CopyPixels(nullptr, stride, bufferSize, image.pixels.data());
   if (FAILED(hr)) {
     LOG_ERROR("Resource", "CopyPixels failed for {}", path);
-    return {};
+    return false;
   }
 
+  // ミップチェーン（画像は小さいのでここで作る。行はプールで並列に縮小）
+  graphics::MipChainSettings mipSettings;
+  mipSettings.filter = graphics::MipFilter::Kaiser;
+  mipSettings.srgb = true;
+  graphics::GenerateMipChain(image.pixels.data(), image.width, image.height,
+                             stride, mipSettings, image.mips,
+                             &core::ThreadPool::Shared());
+  return true;
+}
+
+/// @brief 展開済みの画像から全段入りのテクスチャと SRV を作る
+Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>
+CreateTextureSRV(ID3D11Device *device, const DecodedImage &image,
+                 const std::string &path) {
   D3D11_TEXTURE2D_DESC desc = {};
-  desc.Width = width;
-  desc.Height = height;
-  desc.MipLevels = 1;
+  desc.Width = image.width;
+  desc.Height = image.height;
+  desc.MipLevels = static_cast<UINT>(image.mips.size() + 1);
   desc.ArraySize = 1;
   desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
   desc.SampleDesc.Count = 1;
   desc.Usage = D3D11_USAGE_DEFAULT;
   desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
 
-  D3D11_SUBRESOURCE_DATA initData = {};
-  initData.pSysMem = pixels.data();
-  initData.SysMemPitch = stride;
+  std::vector<D3D11_SUBRESOURCE_DATA> initData(image.mips.size() + 1);
+  initData[0].pSysMem = image.pixels.data();
+  initData[0].SysMemPitch = image.width * 4;
+  for (size_t i = 0; i < image.mips.size(); ++i) {
+    initData[i + 1].pSysMem = image.mips[i].pixels.data();
+    initData[i + 1].SysMemPitch = image.mips[i].width * 4;
+  }
 
   Microsoft::WRL::ComPtr<ID3D11Texture2D> texture;
-  hr = m_device.GetDevice()->CreateTexture2D(&desc, &initData, &texture);
+  HRESULT hr = device->CreateTexture2D(&desc, initData.data(), &texture);
   if (FAILED(hr)) {
     LOG_ERROR("Resource", "CreateTexture2D failed for {} (hr=0x{:08X})", path,
               static_cast<uint32_t>(hr));
-    HRESULT reason = m_device.GetDevice()
-                         ? m_device.GetDevice()->GetDeviceRemovedReason()
-                         : E_FAIL;
+    HRESULT reason = device ? device->GetDeviceRemovedReason() : E_FAIL;
     if (reason != S_OK) {
       LOG_ERROR("Resource", "Device removed reason: 0x{:08X}",
                 static_cast<uint32_t>(reason));
@@ -269,104 +301,252 @@ ResourceManager::LoadTextureSRV(const std::string &path) {
   srvDesc.Format = desc.Format;
   srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
   srvDesc.Texture2D.MostDetailedMip = 0;
-  srvDesc.Texture2D.MipLevels = 1;
+  srvDesc.Texture2D.MipLevels = desc.MipLevels;
 
   Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> srv;
-  hr = m_device.GetDevice()->CreateShaderResourceView(texture.Get(), &srvDesc,
-                                                      &srv);
+  hr = device->CreateShaderResourceView(texture.Get(), &srvDesc, &srv);
   if (FAILED(hr)) {
     LOG_ERROR("Resource", "CreateShaderResourceView failed for {} (hr=0x{:08X})",
               path, static_cast<uint32_t>(hr));
     return {};
   }
 
-  m_textureCache[path] = srv;
-  LOG_INFO("Resource", "Loaded Texture: {} ({}x{})", path, width, height);
+  LOG_INFO("Resource", "Loaded Texture: {} ({}x{}, {} mips)", path,
+           image.width, image.height, desc.MipLevels);
   return srv;
 }
 
-MeshHandle ResourceManager::LoadMesh(const std::string &path) {
-  // キャッシュヒット確認
-  if (auto it = m_meshCache.find(path); it != m_meshCache.end()) {
-    if (m_meshPool.Get(it->second)) { // ハンドル有効性確認
-      return it->second;
-    }
-  }
-
-  graphics::Mesh mesh;
-  bool success = false;
-
+/// @brief "builtin/cube" などの組み込みメッシュを作る
+/// @return path が組み込みでなければ false
+bool CreateBuiltinMesh(ID3D11Device *device, const std::string &path,
+                       graphics::Mesh &mesh) {
   // プリミティブ生成 (Registry-like approach hardcoded for now, simpler than
   // full registry)
   if (path == "builtin/cube" || path == "cube") {
-    mesh = graphics::MeshPrimitives::CreateCube(m_device.GetDevice());
-    success = true;
+    mesh = graphics::MeshPrimitives::CreateCube(device);
   } else if (path == "builtin/sphere" || path == "sphere") {
-    mesh = graphics::MeshPrimitives::CreateSphere(m_device.GetDevice());
-    success = true;
+    mesh = graphics::MeshPrimitives::CreateSphere(device);
   } else if (path == "builtin/triangle") {
-    mesh = graphics::MeshPrimitives::CreateTriangle(m_device.GetDevice());
-    success = true;
+    mesh = graphics::MeshPrimitives::CreateTriangle(device);
   } else if (path == "builtin/plane" || path == "plane") {
-    mesh =
-        graphics::MeshPrimitives::CreatePlane(m_device.GetDevice(), 1.0f, 1.0f);
-    success = true;
+    mesh = graphics::MeshPrimitives::CreatePlane(device, 1.0f, 1.0f);
   } else if (path == "builtin/cylinder" || path == "cylinder") {
     // TODO: CreateCylinder実装後に置換。現状はsphereで代用。
-    mesh = graphics::MeshPrimitives::CreateSphere(m_device.GetDevice());
-    success = true;
+    mesh = graphics::MeshPrimitives::CreateSphere(device);
   } else {
-    // ファイル拡張子を判定してローダーを選択
-    std::vector<graphics::Vertex> vertices;
-    std::vector<uint32_t> indices;
-
-    // 拡張子を小文字で取得
-    std::string extension;
-    size_t dotPos = path.find_last_of('.');
-    if (dotPos != std::string::npos) {
-      extension = path.substr(dotPos);
-      std::transform(extension.begin(), extension.end(), extension.begin(),
-                     ::tolower);
-    }
+    return false;
+  }
+  return true;
+}
 
-    bool loaded = false;
+/// @brief ファイル拡張子を判定してローダーを選択（GPU は使わない）
+bool LoadMeshSource(const std::string &path,
+                    std::vector<graphics::Vertex> &vertices,
+                    std::vector<uint32_t> &indices,
+                    std::vector<graphics::Submesh> &submeshes) {
+  // 拡張子を小文字で取得
+  std::string extension;
+  size_t dotPos = path.find_last_of('.');
+  if (dotPos != std::string::npos) {
+    extension = path.substr(dotPos);
+    std::transform(extension.begin(), extension.end(), extension.begin(),
+                   ::tolower);
+  }
+
+  bool loaded = false;
 
-    // FBX/glTF/3DS/DAE等はFbxLoader(Assimp)を使用
-    if (extension == ".fbx" || extension == ".gltf" || extension == ".glb" ||
-        extension == ".3ds" || extension == ".dae" || extension == ".blend") {
-      loaded = graphics::FbxLoader::Load(path, vertices, indices);
-      if (!loaded) {
-        LOG_ERROR("Resource", "FBX/Assimp Load failed: {}", path.c_str());
-      }
+  // FBX/glTF/3DS/DAE等はFbxLoader(Assimp)を使用
+  if (extension == ".fbx" || extension == ".gltf" || extension == ".glb" ||
+      extension == ".3ds" || extension == ".dae" || extension == ".blend") {
+    loaded = graphics::FbxLoader::Load(path, vertices, indices, &submeshes);
+    if (!loaded) {
+      LOG_ERROR("Resource", "FBX/Assimp Load failed: {}", path.c_str());
     }
-    // OBJファイルは専用ローダーを使用
-    else if (extension == ".obj" || extension.empty()) {
-      loaded = graphics::ObjLoader::Load(path, vertices, indices);
-      if (!loaded) {
-        LOG_ERROR("Resource", "OBJ Load failed: {}", path.c_str());
-      }
-    } else {
-      // 不明な拡張子は一応Assimpで試みる
-      loaded = graphics::FbxLoader::Load(path, vertices, indices);
-      if (!loaded) {
-        LOG_ERROR("Resource", "Unknown format load failed: {}", path.c_str());
-      }
+  }
+  // OBJファイルは専用ローダーを使用（大きなファイルは行単位で並列に解析）
+  else if (extension == ".obj" || extension.empty()) {
+    loaded = graphics::ObjLoader::Load(path, vertices, indices,
+                                       &core::ThreadPool::Shared());
+    if (!loaded) {
+      LOG_ERROR("Resource", "OBJ Load failed: {}", path.c_str());
     }
-
-    if (loaded) {
-      if (mesh.Create(m_device.GetDevice(), vertices, indices)) {
-        success = true;
-        LOG_INFO("Resource", "Loaded Mesh: {} ({} vertices)", path.c_str(),
-                 vertices.size());
-      }
+  } else {
+    // 不明な拡張子は一応Assimpで試みる
+    loaded = graphics::FbxLoader::Load(path, vertices, indices, &submeshes);
+    if (!loaded) {
+      LOG_ERROR("Resource", "Unknown format load failed: {}", path.c_str());
     }
   }
+  return loaded;
+}
 
-  if (!success) {
+/// @brief 前処理済みキャッシュをマップして読む。古い・ないときはソースを
+///        読んでキャッシュを書き出す（次回から Assimp・OBJ 解析を飛ばす）
+bool DecodeMeshFile(const std::string &path, DecodedMesh &data) {
+  if (graphics::OpenMeshCache(path, data.cacheFile, data.cache)) {
+    data.fromCache = true;
+    return true;
+  }
+  std::vector<graphics::Submesh> submeshes;
+  bool written = false;
+  // 変換時に一度だけ頂点キャッシュ・オーバードロー・フェッチ順に並べ替え、
+  // 遠くで使う簡略化した LOD も作っておく
+  const graphics::MeshOptimizeSettings optimize;
+  const bool loaded = graphics::ConvertMeshToCache(
+      path, LoadMeshSource, data.vertices, data.indices, submeshes, &written,
+      &optimize, &data.lods);
+  if (loaded && !written) {
+    LOG_WARN("Resource", "Mesh cache was not written: {}", path.c_str());
+  }
+  return loaded;
+}
+
+/// @brief 頂点を GPU へ送る。失敗時は Cube で代用する
+graphics::Mesh UploadMesh(ID3D11Device *device, const std::string &path,
+                          const DecodedMesh &data, bool &success) {
+  graphics::Mesh mesh;
+  size_t vertexCount = data.vertices.size();
+  if (data.fromCache) {
+    // マップした領域をそのまま初期データとして渡す
+    vertexCount = data.cache.GetVertexCount();
+    success = mesh.Create(device, data.cache.Vertices(), vertexCount,
+                          data.cache.Indices(), data.cache.GetIndexCount()) &&
+              mesh.SetLods(std::vector<graphics::MeshLod>(
+                  data.cache.Lods(),
+                  data.cache.Lods() + data.cache.GetLodCount()));
+  } else {
+    success = data.loaded &&
+              mesh.Create(device, data.vertices, data.indices) &&
+              (data.lods.empty() || mesh.SetLods(data.lods));
+  }
+  if (success) {
+    LOG_INFO("Resource", "Loaded Mesh: {} ({} vertices, {} LODs{})",
+             path.c_str(), vertexCount, mesh.GetLodCount(),
+             data.fromCache ? ", cached" : "");
+  } else {
     LOG_ERROR("Resource", "Mesh load failed or fallback triggered: {}",
               path.c_str());
     // 失敗時はCubeで代用
-    mesh = graphics::MeshPrimitives::CreateCube(m_device.GetDevice());
+    mesh = graphics::MeshPrimitives::CreateCube(device);
+  }
+  return mesh;
+}
+
+/// @brief VS/PS をコンパイル（存在しなければ Assets/ パスをフォールバック）
+bool CompileShaderFiles(const std::string &name, const std::wstring &vsPath,
+                        const std::wstring &psPath,
+                        graphics::ShaderBytecode &bytecode) {
+  std::wstring vsUsed = vsPath;
+  std::wstring psUsed = psPath;
+  bool success = graphics::Shader::CompileFromFile(vsPath, "main", psPath,
+                                                   "main", bytecode);
+
+  if (!success) {
+    std::filesystem::path vsAlt = std::filesystem::path(L"Assets") / vsPath;
+    std::filesystem::path psAlt = std::filesystem::path(L"Assets") / psPath;
+    if (std::filesystem::exists(vsAlt) && std::filesystem::exists(psAlt)) {
+      vsUsed = vsAlt.wstring();
+      psUsed = psAlt.wstring();
+      success = graphics::Shader::CompileFromFile(vsUsed, "main", psUsed,
+                                                  "main", bytecode);
+    }
+  }
+
+  if (!success) {
+    LOG_ERROR("Resource", "Failed to compile shader: {} (VS: {}, PS: {})", name,
+              core::ToString(vsUsed), core::ToString(psUsed));
+  }
+  return success;
+}
+
+} // namespace
+
+ResourceManager::ResourceManager(graphics::GraphicsDevice &device)
+    : m_device(device),
+      m_meshPool(graphics::Mesh{}) // Fallback dummy (Empty Mesh)
+      ,
+      m_shaderPool(graphics::Shader{}) // Fallback dummy (Empty Shader)
+      ,
+      m_audioPool(audio::AudioClip{}) // Fallback
+      ,
+      m_texturePool(Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>{}),
+      m_asyncLoads(core::ThreadPool::Shared()) {}
+
+// ===========================================
+// Audio Implementation (Media Foundation)
+// ===========================================
+
+AudioHandle ResourceManager::LoadAudio(const std::string &path) {
+  if (auto it = m_audioCache.find(path); it != m_audioCache.end()) {
+    return it->second;
+  }
+  SyncLoadTimer timer(m_syncLoads, m_syncLoadMs);
+
+  if (!StartMediaFoundation()) {
+    return {};
+  }
+
+  audio::AudioClip clip;
+  if (!DecodeAudioFile(path, clip)) {
+    return {};
+  }
+
+  auto handle = m_audioPool.Add(std::move(clip));
+  m_audioCache[path] = handle;
+  return handle;
+}
+
+graphics::Mesh *ResourceManager::GetMesh(MeshHandle handle) {
+  if (handle.index == 0 && handle.generation == 0)
+    return nullptr;
+  return m_meshPool.Get(handle);
+}
+
+graphics::Shader *ResourceManager::GetShader(ShaderHandle handle) {
+  if (handle.index == 0 && handle.generation == 0)
+    return nullptr;
+  return m_shaderPool.Get(handle);
+}
+
+audio::AudioClip *ResourceManager::GetAudio(AudioHandle handle) {
+  if (handle.index == 0 && handle.generation == 0)
+    return nullptr;
+  return m_audioPool.Get(handle);
+}
+
+Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>
+ResourceManager::LoadTextureSRV(const std::string &path) {
+  if (auto it = m_textureCache.find(path); it != m_textureCache.end()) {
+    return it->second;
+  }
+  SyncLoadTimer timer(m_syncLoads, m_syncLoadMs);
+
+  DecodedImage image;
+  if (!DecodeImageFile(path, image)) {
+    return {};
+  }
+  auto srv = CreateTextureSRV(m_device.GetDevice(), image, path);
+  if (srv) {
+    m_textureCache[path] = srv;
+  }
+  return srv;
+}
+
+MeshHandle ResourceManager::LoadMesh(const std::string &path) {
+  // キャッシュヒット確認
+  if (auto it = m_meshCache.find(path); it != m_meshCache.end()) {
+    if (m_meshPool.Get(it->second)) { // ハンドル有効性確認
+      return it->second;
+    }
+  }
+  SyncLoadTimer timer(m_syncLoads, m_syncLoadMs);
+
+  graphics::Mesh mesh;
+  if (!CreateBuiltinMesh(m_device.GetDevice(), path, mesh)) {
+    DecodedMesh data;
+    data.loaded = DecodeMeshFile(path, data);
+    bool success = false;
+    mesh = UploadMesh(m_device.GetDevice(), path, data, success);
   }
 
   auto handle = m_meshPool.Add(std::move(mesh));
@@ -390,60 +570,324 @@ MeshHandle ResourceManager::CreateDynamicMesh(
 
   // もし既存の同名キャッシュがあれば、古いリソースはプールに残るが、
   // キャッシュマップの指す先は新しいものになる。
-  // 本格的なエンジンの場合は参照カウント等で管理すべきだが、
-  // ここではシーン遷移時の全削除(Clear)に依存する。
+  // 作り直すものは呼び出し側が ReleaseMesh で古いハンドルを解放する。
 
   auto handle = m_meshPool.Add(std::move(mesh));
   m_meshCache[name] = handle;
-  
-  LOG_INFO("Resource", "Created dynamic mesh: {} ({} vertices)", name, vertices.size());
+
+  LOG_DEBUG("Resource", "Created dynamic mesh: {} ({} vertices)", name,
+            vertices.size());
   return handle;
 }
 
+void ResourceManager::ReleaseMesh(MeshHandle handle) {
+  if (!handle.IsValid()) {
+    return;
+  }
+  std::erase_if(m_meshCache,
+                [&](const auto &entry) { return entry.second == handle; });
+  m_meshPool.Remove(handle);
+}
+
 ShaderHandle ResourceManager::LoadShader(const std::string &name,
                                          const std::wstring &vsPath,
                                          const std::wstring &psPath) {
   if (auto it = m_shaderCache.find(name); it != m_shaderCache.end()) {
     return it->second;
   }
+  SyncLoadTimer timer(m_syncLoads, m_syncLoadMs);
+
+  graphics::ShaderBytecode bytecode;
+  if (!CompileShaderFiles(name, vsPath, psPath, bytecode)) {
+    return {};
+  }
 
   // 標準的な入力レイアウトを使用
   // 将来的には引数で指定可能にするか、シェーダーリフレクションを使用
-  auto inputLayout = graphics::Shader::GetDefaultInputLayout();
-
-  // コンパイル（存在しなければ Assets/ パスをフォールバック）
   graphics::Shader shader;
-  auto tryCompile = [&](const std::wstring &vs, const std::wstring &ps) {
-    return shader.LoadFromFile(m_device.GetDevice(), vs, "main", ps, "main",
-                               inputLayout);
-  };
+  if (!shader.Create(m_device.GetDevice(), bytecode,
+                     graphics::Shader::GetDefaultInputLayout())) {
+    LOG_ERROR("Resource", "Failed to create shader: {}", name);
+    return {};
+  }
 
-  std::wstring vsUsed = vsPath;
-  std::wstring psUsed = psPath;
-  bool success = tryCompile(vsPath, psPath);
+  auto handle = m_shaderPool.Add(std::move(shader));
+  m_shaderCache[name] = handle;
+  return handle;
+}
 
-  if (!success) {
-    std::filesystem::path vsAlt = std::filesystem::path(L"Assets") / vsPath;
-    std::filesystem::path psAlt = std::filesystem::path(L"Assets") / psPath;
-    if (std::filesystem::exists(vsAlt) && std::filesystem::exists(psAlt)) {
-      vsUsed = vsAlt.wstring();
-      psUsed = psAlt.wstring();
-      success = tryCompile(vsUsed, psUsed);
-    }
+// ===========================================
+// Async Loading
+// ===========================================
+
+LoadTicket ResourceManager::EnqueueLoad(const std::string &key,
+                                        AsyncLoadQueue::DecodeFn decode,
+                                        AsyncLoadQueue::UploadFn upload,
+                                        LoadCallback onLoaded,
+                                        const std::vector<LoadTicket> &after,
+                                        std::function<void()> evict) {
+  // 番号は完了後も残し、後から NotifyWhenLoaded した側にも成否を伝える
+  const LoadTicket ticket = m_asyncLoads.Enqueue(
+      std::move(decode), std::move(upload),
+      [this, key, evict = std::move(evict),
+       onLoaded = std::move(onLoaded)](bool success) {
+        if (!success && evict) {
+          evict();
+          m_loadTickets.erase(key);
+        }
+        if (onLoaded) {
+          onLoaded(success);
+        }
+      },
+      after);
+  m_loadTickets[key] = ticket;
+  return ticket;
+}
+
+void ResourceManager::NotifyWhenLoaded(const std::string &key,
+                                       LoadCallback onLoaded) {
+  if (!onLoaded) {
+    return;
+  }
+  // 何もしないロードを依存付きで積み、通知だけを Update に任せる
+  // （依存先が失敗済みなら false で呼ばれる）
+  LoadTicket ticket = 0;
+  if (auto it = m_loadTickets.find(key); it != m_loadTickets.end()) {
+    ticket = it->second;
   }
+  m_asyncLoads.Enqueue({}, {}, std::move(onLoaded), {ticket});
+}
 
-  if (!success) {
-    LOG_ERROR("Resource", "Failed to compile shader: {} (VS: {}, PS: {})", name,
-              core::ToString(vsUsed), core::ToString(psUsed));
-    return {};
+MeshHandle
+ResourceManager::LoadMeshAsync(const std::string &path, LoadCallback onLoaded,
+                               const std::vector<LoadTicket> &after) {
+  if (auto it = m_meshCache.find(path); it != m_meshCache.end()) {
+    NotifyWhenLoaded(path, std::move(onLoaded));
+    return it->second;
   }
 
-  auto handle = m_shaderPool.Add(std::move(shader));
+  graphics::Mesh builtin;
+  if (CreateBuiltinMesh(m_device.GetDevice(), path, builtin)) {
+    auto handle = m_meshPool.Add(std::move(builtin));
+    m_meshCache[path] = handle;
+    NotifyWhenLoaded(path, std::move(onLoaded));
+    return handle;
+  }
+
+  // 完了までは空のメッシュ（描画されない）を指す
+  const MeshHandle handle = m_meshPool.Add(graphics::Mesh{});
+  m_meshCache[path] = handle;
+
+  auto data = std::make_shared<DecodedMesh>();
+  EnqueueLoad(
+      path,
+      [path, data]() {
+        // 失敗しても転送側で Cube に差し替えるので true を返す
+        data->loaded = DecodeMeshFile(path, *data);
+        return true;
+      },
+      [this, path, handle, data]() {
+        bool success = false;
+        graphics::Mesh mesh =
+            UploadMesh(m_device.GetDevice(), path, *data, success);
+        m_meshPool.Replace(handle, std::move(mesh));
+        return success;
+      },
+      std::move(onLoaded), after);
+  return handle;
+}
+
+TextureHandle
+ResourceManager::LoadTextureAsync(const std::string &path,
+                                  LoadCallback onLoaded,
+                                  const std::vector<LoadTicket> &after) {
+  if (auto it = m_textureHandles.find(path); it != m_textureHandles.end()) {
+    NotifyWhenLoaded(path, std::move(onLoaded));
+    return it->second;
+  }
+
+  // 同期版で読み込み済みならその SRV を共有する
+  Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> cached;
+  if (auto it = m_textureCache.find(path); it != m_textureCache.end()) {
+    cached = it->second;
+  }
+  const bool loaded = cached.Get() != nullptr;
+  const TextureHandle handle = m_texturePool.Add(std::move(cached));
+  m_textureHandles[path] = handle;
+  if (loaded) {
+    NotifyWhenLoaded(path, std::move(onLoaded));
+    return handle;
+  }
+
+  auto image = std::make_shared<DecodedImage>();
+  EnqueueLoad(
+      path,
+      [path, image]() {
+        ComScope com;
+        return DecodeImageFile(path, *image);
+      },
+      [this, path, handle, image]() {
+        auto srv = CreateTextureSRV(m_device.GetDevice(), *image, path);
+        if (!srv) {
+          return false;
+        }
+        m_textureCache[path] = srv;
+        m_texturePool.Replace(handle, std::move(srv));
+        return true;
+      },
+      std::move(onLoaded), after,
+      // 配ったハンドルは白のまま残し、名前だけ外して次で読み直す
+      [this, path, handle]() {
+        if (auto it = m_textureHandles.find(path);
+            it != m_textureHandles.end() && it->second == handle) {
+          m_textureHandles.erase(it);
+        }
+      });
+  return handle;
+}
+
+ID3D11ShaderResourceView *ResourceManager::GetTexture(TextureHandle handle) {
+  if (handle.index == 0 && handle.generation == 0)
+    return GetPlaceholderTexture();
+  auto *srv = m_texturePool.Get(handle);
+  if (!srv || !srv->Get()) {
+    return GetPlaceholderTexture();
+  }
+  return srv->Get();
+}
+
+ID3D11ShaderResourceView *ResourceManager::GetPlaceholderTexture() {
+  if (m_placeholderTexture) {
+    return m_placeholderTexture.Get();
+  }
+
+  // 1x1 の白（色を掛けても変わらない）
+  const uint32_t white = 0xFFFFFFFFu;
+  D3D11_TEXTURE2D_DESC desc = {};
+  desc.Width = 1;
+  desc.Height = 1;
+  desc.MipLevels = 1;
+  desc.ArraySize = 1;
+  desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+  desc.SampleDesc.Count = 1;
+  desc.Usage = D3D11_USAGE_IMMUTABLE;
+  desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+  D3D11_SUBRESOURCE_DATA initData = {};
+  initData.pSysMem = &white;
+  initData.SysMemPitch = sizeof(white);
+
+  Microsoft::WRL::ComPtr<ID3D11Texture2D> texture;
+  if (FAILED(m_device.GetDevice()->CreateTexture2D(&desc, &initData,
+                                                   &texture)) ||
+      FAILED(m_device.GetDevice()->CreateShaderResourceView(
+          texture.Get(), nullptr, &m_placeholderTexture))) {
+    LOG_ERROR("Resource", "Failed to create placeholder texture");
+    return nullptr;
+  }
+  return m_placeholderTexture.Get();
+}
+
+AudioHandle
+ResourceManager::LoadAudioAsync(const std::string &path, LoadCallback onLoaded,
+                                const std::vector<LoadTicket> &after) {
+  if (auto it = m_audioCache.find(path); it != m_audioCache.end()) {
+    NotifyWhenLoaded(path, std::move(onLoaded));
+    return it->second;
+  }
+
+  // 完了までは空のクリップ（再生側は buffer が空なら鳴らさない）
+  const AudioHandle handle = m_audioPool.Add(audio::AudioClip{});
+  m_audioCache[path] = handle;
+
+  auto clip = std::make_shared<audio::AudioClip>();
+  EnqueueLoad(
+      path,
+      [path, clip]() {
+        ComScope com;
+        return StartMediaFoundation() && DecodeAudioFile(path, *clip);
+      },
+      [this, handle, clip]() {
+        // GPU は使わないので差し替えるだけ
+        return m_audioPool.Replace(handle, std::move(*clip));
+      },
+      std::move(onLoaded), after,
+      [this, path, handle]() {
+        if (auto it = m_audioCache.find(path);
+            it != m_audioCache.end() && it->second == handle) {
+          m_audioCache.erase(it);
+        }
+      });
+  return handle;
+}
+
+ShaderHandle ResourceManager::LoadShaderAsync(
+    const std::string &name, const std::wstring &vsPath,
+    const std::wstring &psPath, LoadCallback onLoaded,
+    const std::vector<LoadTicket> &after) {
+  if (auto it = m_shaderCache.find(name); it != m_shaderCache.end()) {
+    NotifyWhenLoaded(name, std::move(onLoaded));
+    return it->second;
+  }
+
+  // 完了までは空のシェーダー（IsValid が false なので描画されない）
+  const ShaderHandle handle = m_shaderPool.Add(graphics::Shader{});
   m_shaderCache[name] = handle;
+
+  auto bytecode = std::make_shared<graphics::ShaderBytecode>();
+  EnqueueLoad(
+      name,
+      [name, vsPath, psPath, bytecode]() {
+        return CompileShaderFiles(name, vsPath, psPath, *bytecode);
+      },
+      [this, name, handle, bytecode]() {
+        graphics::Shader shader;
+        if (!shader.Create(m_device.GetDevice(), *bytecode,
+                           graphics::Shader::GetDefaultInputLayout())) {
+          LOG_ERROR("Resource", "Failed to create shader: {}", name);
+          return false;
+        }
+        return m_shaderPool.Replace(handle, std::move(shader));
+      },
+      std::move(onLoaded), after,
+      // 空のシェーダーのハンドルは描画されないまま残し、名前だけ外す
+      [this, name, handle]() {
+        if (auto it = m_shaderCache.find(name);
+            it != m_shaderCache.end() && it->second == handle) {
+          m_shaderCache.erase(it);
+        }
+      });
   return handle;
 }
 
+LoadTicket ResourceManager::GetPendingLoad(const std::string &key) const {
+  auto it = m_loadTickets.find(key);
+  if (it == m_loadTickets.end()) {
+    return 0;
+  }
+  const LoadStatus status = m_asyncLoads.GetStatus(it->second);
+  return status == LoadStatus::Done || status == LoadStatus::Failed
+             ? 0
+             : it->second;
+}
+
+void ResourceManager::Update(double budgetMs) { m_asyncLoads.Update(budgetMs); }
+
+void ResourceManager::FlushAsyncLoads() { m_asyncLoads.Flush(); }
+
+ResourceLoadStats ResourceManager::GetLoadStats() const {
+  ResourceLoadStats stats;
+  stats.syncLoads = m_syncLoads;
+  stats.syncMs = m_syncLoadMs;
+  stats.asyncPending = m_asyncLoads.GetPendingCount();
+  stats.async = m_asyncLoads.GetStats();
+  return stats;
+}
+
 void ResourceManager::Clear() {
+  // ロード中のものが先に消えたプールへ書き込まないよう、キューから捨てる
+  m_asyncLoads.Clear();
+  m_loadTickets.clear();
   m_meshPool.Clear();
   m_meshCache.clear();
   m_shaderPool.Clear();
@@ -451,6 +895,8 @@ void ResourceManager::Clear() {
   m_audioPool.Clear();
   m_audioCache.clear();
   m_textureCache.clear();
+  m_texturePool.Clear();
+  m_textureHandles.clear();
 }
 
 void ResourceManager::DumpStatistics() const {
@@ -469,6 +915,15 @@ void ResourceManager::DumpStatistics() const {
   for (const auto &[name, handle] : m_audioCache) {
     LOG_INFO("ResourceStats", "  - {} (ID:{})", name.c_str(), handle.index);
   }
+
+  const ResourceLoadStats stats = GetLoadStats();
+  LOG_INFO("ResourceStats", "Textures: {} loaded", m_textureCache.size());
+  LOG_INFO("ResourceStats",
+           "Sync loads: {} ({:.1f} ms), async: {} done, {} failed, {} pending",
+           stats.syncLoads, stats.syncMs, stats.async.completed,
+           stats.async.failed, stats.asyncPending);
+  LOG_INFO("ResourceStats", "Async upload: worst {:.2f} ms/frame",
+           stats.async.worstUploadMs);
   LOG_INFO("ResourceStats", "===========================");
 }
 
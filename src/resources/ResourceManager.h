@@ -7,9 +7,12 @@
 #include "../audio/AudioClip.h"
 #include "../graphics/Mesh.h"
 #include "../graphics/Shader.h"
+#include "AsyncLoadQueue.h"
 #include "ResourcePool.h"
+#include <functional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 #include <wrl/client.h>
 
 
@@ -22,9 +25,22 @@ namespace resources {
 using MeshHandle = core::ResourceHandle<graphics::Mesh>;
 using ShaderHandle = core::ResourceHandle<graphics::Shader>;
 using AudioHandle = core::ResourceHandle<audio::AudioClip>;
+using TextureHandle =
+    core::ResourceHandle<Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>>;
+
+/// @brief 読み込みの集計（シーン開始時の停止時間の計測用）
+struct ResourceLoadStats {
+  uint32_t syncLoads = 0; ///< 呼び出し元で読み込んだ件数（キャッシュ外のみ）
+  double syncMs = 0.0;    ///< その合計時間
+  size_t asyncPending = 0;
+  AsyncLoadStats async;
+};
 
 class ResourceManager {
 public:
+  /// @brief 非同期ロードの完了通知（メインスレッドの Update から呼ばれる）
+  using LoadCallback = std::function<void(bool success)>;
+
   ResourceManager(graphics::GraphicsDevice &device);
   ~ResourceManager() = default;
 
@@ -37,6 +53,13 @@ public:
                                const std::vector<graphics::Vertex> &vertices,
                                const std::vector<uint32_t> &indices);
 
+  /**
+   * @brief メッシュを解放する（CreateDynamicMesh で作ったものの作り直し用）
+   * @details 同じメッシュを指す名前もキャッシュから外す。解放済みの
+   *          ハンドルは何もしない。
+   */
+  void ReleaseMesh(MeshHandle handle);
+
   /// @brief メッシュを取得（レンダリングループ用）
   graphics::Mesh *GetMesh(MeshHandle handle);
 
@@ -57,13 +80,72 @@ public:
   Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>
   LoadTextureSRV(const std::string &path);
 
-  /// @brief 全リソースを解放（シーン遷移用）
+  // --- 非同期ロード ---
+  // ハンドルはすぐ返り、完了までは代わりのリソースを指す（メッシュ・
+  // シェーダー・音声は空、テクスチャは 1x1 の白）。読み込み・展開・
+  // コンパイルはワーカーで行い、GPU リソースの作成は Update の中で
+  // 1フレームの予算の範囲で行う。after には GetPendingLoad の番号を渡すと、
+  // それが完了してから読み込みを始める（失敗したら自分も失敗する）。
+  // 同じパスの2回目以降は同じハンドルを返し、onLoaded は完了後に呼ぶ
+  // （既に失敗していれば false）。テクスチャ・シェーダー・音声は失敗すると
+  // 名前を忘れるので、次に同じパスを頼めば読み直す（メッシュは Cube のまま）。
+
+  /// @brief メッシュを非同期にロード（builtin/ はその場で作る）
+  MeshHandle LoadMeshAsync(const std::string &path, LoadCallback onLoaded = {},
+                           const std::vector<LoadTicket> &after = {});
+
+  /// @brief テクスチャを非同期にロード（WIC での展開とミップ作成はワーカー）
+  TextureHandle LoadTextureAsync(const std::string &path,
+                                 LoadCallback onLoaded = {},
+                                 const std::vector<LoadTicket> &after = {});
+
+  /// @brief テクスチャを取得。ロード中・失敗時は 1x1 の白
+  ID3D11ShaderResourceView *GetTexture(TextureHandle handle);
+
+  /// @brief 音声を非同期にロード（Media Foundation での展開はワーカー）
+  AudioHandle LoadAudioAsync(const std::string &path,
+                             LoadCallback onLoaded = {},
+                             const std::vector<LoadTicket> &after = {});
+
+  /// @brief シェーダーを非同期にロード（コンパイルはワーカー）
+  ShaderHandle LoadShaderAsync(const std::string &name,
+                               const std::wstring &vsPath,
+                               const std::wstring &psPath,
+                               LoadCallback onLoaded = {},
+                               const std::vector<LoadTicket> &after = {});
+
+  /// @brief パス（シェーダーは名前）がロード中ならその番号、でなければ 0
+  LoadTicket GetPendingLoad(const std::string &key) const;
+
+  /// @brief 非同期ロードの GPU 転送を予算 budgetMs の範囲で進める（毎フレーム）
+  void Update(double budgetMs);
+
+  /// @brief 非同期ロードがすべて終わるまで待つ
+  void FlushAsyncLoads();
+
+  /// @brief 読み込みの集計
+  ResourceLoadStats GetLoadStats() const;
+
+  /// @brief 全リソースを解放（シーン遷移用。ロード中のものは通知せず捨てる）
   void Clear();
 
   /// @brief リソース統計情報をログ出力
   void DumpStatistics() const;
 
 private:
+  /// @brief 登録済みのロードの完了後に onLoaded を呼ぶ
+  /// @details 終わったロードが失敗していれば false で呼ぶ。
+  void NotifyWhenLoaded(const std::string &key, LoadCallback onLoaded);
+  /// @brief 非同期ロードを登録し、番号を m_loadTickets に残す
+  /// @param evict 失敗時に名前のキャッシュから外す処理。外したものは
+  ///              番号も消すので、次のロードで読み直す
+  LoadTicket EnqueueLoad(const std::string &key,
+                         AsyncLoadQueue::DecodeFn decode,
+                         AsyncLoadQueue::UploadFn upload, LoadCallback onLoaded,
+                         const std::vector<LoadTicket> &after,
+                         std::function<void()> evict = {});
+  ID3D11ShaderResourceView *GetPlaceholderTexture();
+
   graphics::GraphicsDevice &m_device;
 
   ResourcePool<graphics::Mesh> m_meshPool;
@@ -78,6 +160,18 @@ private:
   std::unordered_map<std::string,
                      Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>>
       m_textureCache;
+
+  ResourcePool<Microsoft::WRL::ComPtr<ID3D11ShaderResourceView>>
+      m_texturePool;
+  std::unordered_map<std::string, TextureHandle> m_textureHandles;
+  Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> m_placeholderTexture;
+
+  uint32_t m_syncLoads = 0;
+  double m_syncLoadMs = 0.0;
+
+  /// 非同期ロードした名前ごとの最後の番号（終わった後も成否を引ける）
+  std::unordered_map<std::string, LoadTicket> m_loadTickets;
+  AsyncLoadQueue m_asyncLoads; ///< 最後に宣言し、最初に破棄する
 };
 
 } // namespace resources
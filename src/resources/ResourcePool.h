@@ -72,6 +72,20 @@ public:
     return &slot.resource;
   }
 
+  /// @brief 生きているハンドルの中身を差し替える（非同期ロードの完了時）
+  /// @return ハンドルが無効（解放済み・Clear 済み）なら何もせず false
+  bool Replace(Handle handle, T &&resource) {
+    if (handle.index >= m_slots.size()) {
+      return false;
+    }
+    Slot &slot = m_slots[handle.index];
+    if (!slot.isAlive || slot.generation != handle.generation) {
+      return false;
+    }
+    slot.resource = std::move(resource);
+    return true;
+  }
+
   /// @brief リソースを解放
   void Remove(Handle handle) {
     if (handle.index >= m_slots.size())
@@ -0,0 +1,307 @@
+#include "src/graphics/ArticleLayout.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using graphics::ArticleFont;
+using graphics::ArticleGlyphRun;
+using graphics::ArticleLayout;
+using graphics::ArticleLayoutCache;
+using graphics::ArticleLayoutCacheStats;
+using graphics::ArticleLayoutEngine;
+using graphics::ArticleLayoutInput;
+using graphics::ArticleRunStyle;
+using graphics::TableGlyphMetrics;
+
+namespace {
+
+/// @brief 1行分の文字列と右端
+struct Line {
+  std::u32string text;
+  float left = 1e30f;
+  float right = 0.0f;
+};
+
+/// @brief ラン（本文・見出し・リンク）を行（ベースライン）ごとにまとめる
+std::vector<Line> BodyLines(const ArticleLayout &layout) {
+  std::map<float, Line> lines;
+  for (const ArticleGlyphRun &run : layout.runs) {
+    if (run.style == ArticleRunStyle::Title ||
+        run.style == ArticleRunStyle::Button) {
+      continue;
+    }
+    Line &line = lines[run.baseline];
+    line.text += layout.text.substr(run.start, run.length);
+    float x = run.x;
+    for (uint32_t k = 0; k < run.length; ++k) {
+      x += layout.advances[run.start + k];
+    }
+    line.left = std::min(line.left, run.x);
+    line.right = std::max(line.right, x);
+  }
+  std::vector<Line> out;
+  for (auto &entry : lines) {
+    out.push_back(entry.second);
+  }
+  return out;
+}
+
+bool Near(float a, float b) { return std::abs(a - b) < 1e-3f; }
+
+/// @brief 寸法表での文字列の幅
+float TextWidth(const std::u32string &text, float fontSize) {
+  float width = 0.0f;
+  for (char32_t c : text) {
+    width += TableGlyphMetrics::AdvanceEm(c) * fontSize;
+  }
+  return width;
+}
+
+} // namespace
+
+int main() {
+  TableGlyphMetrics metrics;
+  ArticleLayoutEngine engine(metrics);
+  const auto &style = engine.GetStyle();
+
+  // 1) 英文は空白で折り、行頭に空白を置かず、本文幅に収める
+  {
+    ArticleLayoutInput input;
+    input.title = "Lorem";
+    input.text = "the quick brown fox jumps over the lazy dog and keeps "
+                 "running through the long grass until the sun goes down";
+    const ArticleLayout layout = engine.Layout(input, 1000, 2000);
+    const auto lines = BodyLines(layout);
+    const float maxRight = 1000.0f - style.bodyLeft;
+    bool fits = true;
+    bool trimmed = true;
+    bool wordsWhole = true;
+    for (const Line &line : lines) {
+      fits &= line.right <= maxRight + 1e-3f;
+      trimmed &= !line.text.empty() && line.text.front() != U' ' &&
+                 line.text.back() != U' ';
+    }
+    std::u32string joined;
+    for (size_t i = 0; i < lines.size(); ++i) {
+      joined += (i ? U" " : U"") + lines[i].text;
+    }
+    wordsWhole = joined.size() == input.text.size();
+    CHECK(lines.size() > 2, "Long English paragraph wraps onto several lines");
+    CHECK(fits, "Every line fits within the body width");
+    CHECK(trimmed, "Lines neither start nor end with a space");
+    CHECK(wordsWhole, "English text only breaks at spaces");
+  }
+
+  // 2) 日本語は文字の間で折るが、禁則文字は行頭・行末に置かない
+  {
+    ArticleLayoutInput input;
+    input.title = "東京";
+    std::string text;
+    for (int i = 0; i < 30; ++i) {
+      text += "東京都は「日本」の首都である。ショッピングも楽しい、";
+    }
+    input.text = text;
+    const ArticleLayout layout = engine.Layout(input, 1000, 8000);
+    const auto lines = BodyLines(layout);
+    const std::u32string noStart = U"、。」）ーョッ";
+    bool kinsoku = true;
+    bool fits = true;
+    for (const Line &line : lines) {
+      kinsoku &= noStart.find(line.text.front()) == std::u32string::npos;
+      kinsoku &= line.text.back() != U'「';
+      fits &= line.right <= 1000.0f - style.bodyLeft + 1e-3f;
+    }
+    CHECK(lines.size() > 20, "Japanese text wraps without spaces");
+    CHECK(kinsoku, "Closing punctuation never starts and opening brackets "
+                   "never end a line");
+    CHECK(fits, "Japanese lines fit within the body width");
+  }
+
+  // 3) 折れない長い語は文字の途中で折る
+  {
+    ArticleLayoutInput input;
+    input.text = std::string(200, 'W');
+    const ArticleLayout layout = engine.Layout(input, 800, 4000);
+    const auto lines = BodyLines(layout);
+    size_t total = 0;
+    bool fits = true;
+    for (const Line &line : lines) {
+      total += line.text.size();
+      fits &= line.right <= 800.0f - style.bodyLeft + 1e-3f;
+    }
+    CHECK(lines.size() > 1 && total == 200 && fits,
+          "Unbreakable words are split between characters");
+  }
+
+  // 4) 見出しは = を外して大きく描き、領域を返す
+  {
+    ArticleLayoutInput input;
+    input.title = "Title";
+    input.text = "intro\n== Overview ==\nbody\n=== Detail ===\nmore";
+    const ArticleLayout layout = engine.Layout(input, 2000, 2000);
+    CHECK(layout.headings.size() == 2, "Both heading lines are detected");
+    CHECK(layout.headings[0].level == 2 && layout.headings[1].level == 3,
+          "Heading level is the number of '='");
+    CHECK(layout.text.find(U'=') == std::u32string::npos,
+          "Heading markers are not drawn");
+
+    float headingSize = 0.0f;
+    for (const ArticleGlyphRun &run : layout.runs) {
+      if (run.style == ArticleRunStyle::Heading &&
+          layout.text.substr(run.start, run.length) == U"Overview") {
+        headingSize = run.fontSize;
+      }
+    }
+    CHECK(Near(headingSize, style.bodySize * style.headingScale[0]),
+          "H2 is drawn at the H2 scale");
+    CHECK(Near(layout.headings[0].width, TextWidth(U"Overview", headingSize)),
+          "Heading region is as wide as its text");
+
+    const auto lines = BodyLines(layout);
+    const float lineHeight =
+        metrics.GetVerticalMetrics(ArticleFont::Body).LineHeight() *
+        style.bodySize;
+    CHECK(lines.size() == 5 && Near(layout.headings[0].y,
+                                    style.bodyTop + lineHeight),
+          "Each source line is one paragraph stacked from the body top");
+  }
+
+  // 5) リンク: 全出現に矩形、行をまたぐ出現は行ごと、本文にないものはボタン
+  {
+    ArticleLayoutInput input;
+    input.title = "Links";
+    std::string text = "alpha beta ";
+    for (int i = 0; i < 40; ++i) {
+      text += "gamma delta ";
+    }
+    input.text = text + "alpha";
+    input.links = {{"alpha", "Alpha"},
+                   {"delta gamma", "DG"},
+                   {"missing", "Missing"},
+                   {"absent", "Goal"}};
+    input.targetPage = "Goal";
+    const ArticleLayout layout = engine.Layout(input, 1200, 6000);
+
+    size_t alphaRects = 0;
+    size_t dgRects = 0;
+    size_t buttons = 0;
+    bool goalIsTarget = false;
+    for (const auto &link : layout.links) {
+      alphaRects += link.targetPage == "Alpha";
+      dgRects += link.targetPage == "DG";
+      buttons += link.targetPage == "Missing" || link.targetPage == "Goal";
+      if (link.targetPage == "Goal") {
+        goalIsTarget = link.isTarget;
+      }
+    }
+    const auto lines = BodyLines(layout);
+    CHECK(alphaRects == 2, "Every occurrence of a link gets a region");
+    CHECK(dgRects > 39, "Occurrences that wrap get one region per line");
+    CHECK(buttons == 2 && layout.buttons.size() == 2,
+          "Links missing from the text become see-also buttons");
+    CHECK(goalIsTarget && layout.buttons[1].isTarget,
+          "The target page is flagged on its button");
+    CHECK(layout.buttons[0].y >= layout.bodyBottom + style.seeAlsoGap - 1e-3f,
+          "Buttons sit below the body");
+
+    // 最初の "alpha" の矩形は本文の左端から始まり、語の幅を持つ
+    const auto &first = layout.links.front();
+    const float alphaWidth = TextWidth(U"alpha", style.bodySize);
+    CHECK(first.targetPage == "Alpha" && Near(first.x, style.bodyLeft) &&
+              Near(first.y, style.bodyTop) && Near(first.width, alphaWidth),
+          "Link region covers the laid-out glyphs");
+    bool linkRuns = false;
+    for (const ArticleGlyphRun &run : layout.runs) {
+      linkRuns |= run.style == ArticleRunStyle::Link &&
+                  layout.text.substr(run.start, run.length) == U"alpha";
+    }
+    CHECK(linkRuns && lines.size() > 5, "Link text is drawn as link runs");
+  }
+
+  // 6) 画像は指定した段落の後ろに中央寄せで入り、後続を押し下げる
+  {
+    ArticleLayoutInput input;
+    input.text = "first\n\nsecond\nthird";
+    input.images = {{1, 400.0f, 300.0f}, {0, 4000.0f, 1000.0f}};
+    const ArticleLayout layout = engine.Layout(input, 1000, 4000);
+    const float lineHeight =
+        metrics.GetVerticalMetrics(ArticleFont::Body).LineHeight() *
+        style.bodySize;
+    CHECK(layout.images.size() == 2, "Both images are placed");
+    const auto &wide = layout.images[0];
+    const auto &small = layout.images[1];
+    CHECK(Near(wide.width, 1000.0f - 2.0f * style.bodyLeft) &&
+              Near(wide.y, style.bodyTop + lineHeight + style.imageMargin),
+          "Wide image is scaled to the body width after paragraph 0");
+    CHECK(Near(small.x, 300.0f) &&
+              Near(small.y, wide.y + wide.height + style.imageMargin +
+                                2.0f * lineHeight + style.imageMargin),
+          "Images count only non-empty paragraphs and are centred");
+  }
+
+  // 7) キャッシュ: 同じ入力は共有し、大きさ違いは別、容量を超えたら古い順
+  {
+    ArticleLayoutInput input;
+    input.title = "Cache";
+    input.text = "some text to lay out";
+    ArticleLayoutCache cache(2);
+    ArticleLayoutCacheStats stats;
+    auto a = cache.GetOrLayout(engine, input, 1000, 1000, &stats);
+    CHECK(!stats.hit, "First request lays out");
+    auto b = cache.GetOrLayout(engine, input, 1000, 1000, &stats);
+    CHECK(stats.hit && a == b, "Second request hits the cache");
+    cache.GetOrLayout(engine, input, 1200, 1000, &stats);
+    CHECK(!stats.hit && cache.GetSize() == 2, "Width is part of the key");
+
+    ArticleLayoutInput other = input;
+    other.links = {{"text", "Text"}};
+    cache.GetOrLayout(engine, other, 1000, 1000, &stats);
+    CHECK(!stats.hit && cache.GetSize() == 2, "Links are part of the key");
+    cache.GetOrLayout(engine, input, 1000, 1000, &stats);
+    CHECK(!stats.hit, "Least recently used layout is evicted");
+
+    ArticleLayoutEngine smaller(metrics, [] {
+      graphics::ArticleLayoutStyle s;
+      s.bodySize = 32.0f;
+      return s;
+    }());
+    cache.GetOrLayout(smaller, input, 1000, 1000, &stats);
+    CHECK(!stats.hit, "Style is part of the key");
+  }
+
+  // 8) 同じ入力からは同じレイアウトになる
+  {
+    ArticleLayoutInput input;
+    input.title = "日本";
+    input.text = "日本（にほん）は東アジアに位置する国家。\n== 歴史 ==\n"
+                 "旧石器時代から人が住む。";
+    input.links = {{"東アジア", "東アジア"}, {"国家", "国家"}};
+    const ArticleLayout a = engine.Layout(input, 900, 3000);
+    const ArticleLayout b = engine.Layout(input, 900, 3000);
+    bool same = a.text == b.text && a.runs.size() == b.runs.size() &&
+                a.links.size() == b.links.size();
+    for (size_t i = 0; same && i < a.runs.size(); ++i) {
+      same = a.runs[i].start == b.runs[i].start &&
+             a.runs[i].x == b.runs[i].x &&
+             a.runs[i].baseline == b.runs[i].baseline;
+    }
+    CHECK(same && a.links.size() == 2 && a.headings.size() == 1,
+          "Layout is deterministic");
+  }
+
+  std::cout << "All article layout tests passed!\n";
+  return 0;
+}
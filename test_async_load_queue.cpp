@@ -0,0 +1,219 @@
+#include "src/core/ThreadPool.h"
+#include "src/resources/AsyncLoadQueue.h"
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using resources::AsyncLoadQueue;
+using resources::LoadStatus;
+using resources::LoadTicket;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+void SpinMs(double ms) {
+  const Clock::time_point start = Clock::now();
+  while (std::chrono::duration<double, std::milli>(Clock::now() - start)
+             .count() < ms) {
+  }
+}
+
+} // namespace
+
+int main() {
+  core::ThreadPool pool(2);
+  const std::thread::id mainThread = std::this_thread::get_id();
+
+  // 1) decode はワーカー、upload と done はメインスレッド
+  {
+    AsyncLoadQueue queue(pool);
+    std::atomic<int> decodedOnWorker{0};
+    int uploadedOnMain = 0;
+    int doneOk = 0;
+    std::vector<LoadTicket> tickets;
+    for (int i = 0; i < 8; ++i) {
+      tickets.push_back(queue.Enqueue(
+          [&]() {
+            decodedOnWorker += std::this_thread::get_id() != mainThread;
+            return true;
+          },
+          [&]() {
+            uploadedOnMain += std::this_thread::get_id() == mainThread;
+            return true;
+          },
+          [&](bool success) {
+            doneOk += success && std::this_thread::get_id() == mainThread;
+          }));
+    }
+    CHECK(tickets.front() != 0 && queue.GetPendingCount() == 8 &&
+              queue.GetStatus(tickets.front()) != LoadStatus::Done,
+          "Enqueue returns a ticket before the load finishes");
+
+    queue.Flush();
+    CHECK(decodedOnWorker == 8 && uploadedOnMain == 8 && doneOk == 8,
+          "Decode runs on workers, upload and done on the main thread");
+    CHECK(queue.IsIdle() && queue.GetStatus(tickets.back()) ==
+                                LoadStatus::Done &&
+              queue.GetStats().completed == 8,
+          "All loads finish");
+    CHECK(queue.GetStatus(9999) == LoadStatus::Unknown,
+          "Unknown tickets report Unknown");
+  }
+
+  // 2) 失敗: decode の失敗は upload を呼ばない。upload の失敗も Failed
+  {
+    AsyncLoadQueue queue(pool);
+    bool uploadCalled = false;
+    int failures = 0;
+    const LoadTicket badDecode = queue.Enqueue(
+        []() { return false; },
+        [&]() {
+          uploadCalled = true;
+          return true;
+        },
+        [&](bool success) { failures += !success; });
+    const LoadTicket badUpload = queue.Enqueue(
+        []() { return true; }, []() { return false; },
+        [&](bool success) { failures += !success; });
+    const LoadTicket throws = queue.Enqueue(
+        []() -> bool { throw 1; }, {},
+        [&](bool success) { failures += !success; });
+    queue.Flush();
+    CHECK(!uploadCalled && failures == 3 &&
+              queue.GetStatus(badDecode) == LoadStatus::Failed &&
+              queue.GetStatus(badUpload) == LoadStatus::Failed &&
+              queue.GetStatus(throws) == LoadStatus::Failed &&
+              queue.GetStats().failed == 3,
+          "Decode, upload and exceptions all report failure");
+  }
+
+  // 3) 依存: 依存先の upload が終わるまで decode を始めない
+  {
+    AsyncLoadQueue queue(pool);
+    std::atomic<bool> baseUploaded{false};
+    std::atomic<bool> sawBase{false};
+    const LoadTicket base = queue.Enqueue(
+        []() {
+          SpinMs(15.0);
+          return true;
+        },
+        [&]() {
+          baseUploaded = true;
+          return true;
+        });
+    const LoadTicket child = queue.Enqueue(
+        [&]() {
+          sawBase = baseUploaded.load();
+          return true;
+        },
+        {}, {}, {base});
+    CHECK(queue.GetStatus(child) == LoadStatus::Waiting,
+          "A load waits for its dependencies");
+
+    bool failedDecoded = false;
+    int chainFailures = 0;
+    const LoadTicket broken = queue.Enqueue([]() { return false; }, {});
+    const LoadTicket afterBroken = queue.Enqueue(
+        [&]() {
+          failedDecoded = true;
+          return true;
+        },
+        {}, [&](bool success) { chainFailures += !success; }, {broken});
+    const LoadTicket afterAfter = queue.Enqueue(
+        [&]() {
+          failedDecoded = true;
+          return true;
+        },
+        {}, [&](bool success) { chainFailures += !success; },
+        {afterBroken, base});
+
+    queue.Flush();
+    CHECK(sawBase && queue.GetStatus(child) == LoadStatus::Done,
+          "Dependents decode after their dependency is uploaded");
+    CHECK(!failedDecoded && chainFailures == 2 &&
+              queue.GetStatus(afterAfter) == LoadStatus::Failed,
+          "Failures propagate along the dependency chain");
+
+    const LoadTicket late = queue.Enqueue({}, {}, {}, {base, 0});
+    CHECK(queue.GetStatus(late) == LoadStatus::Uploading,
+          "Finished dependencies and ticket 0 do not block");
+    queue.Update(0.0);
+  }
+
+  // 4) 予算: 転送は予算で打ち切るが、1件は必ず進める
+  {
+    AsyncLoadQueue queue(pool);
+    int uploads = 0;
+    for (int i = 0; i < 10; ++i) {
+      queue.Enqueue({}, [&]() {
+        SpinMs(2.0);
+        ++uploads;
+        return true;
+      });
+    }
+    const uint32_t first = queue.Update(0.0);
+    CHECK(first == 1 && uploads == 1, "A zero budget still uploads one item");
+    const uint32_t second = queue.Update(3.0);
+    CHECK(second >= 1 && second <= 3,
+          "Uploads stop once the frame budget is spent");
+    int frames = 2;
+    while (!queue.IsIdle()) {
+      queue.Update(3.0);
+      ++frames;
+    }
+    CHECK(uploads == 10 && queue.GetStats().frames ==
+                               static_cast<uint64_t>(frames) &&
+              queue.GetStats().worstUploadMs >= 2.0,
+          "Uploads spread across frames and are recorded in the stats");
+  }
+
+  // 5) done から次のロードを登録できる。Clear は結果を知らせずに捨てる
+  {
+    AsyncLoadQueue queue(pool);
+    LoadTicket second = 0;
+    bool secondDone = false;
+    queue.Enqueue({}, {}, [&](bool) {
+      second = queue.Enqueue([]() { return true; }, {},
+                             [&](bool success) { secondDone = success; });
+    });
+    queue.Flush();
+    CHECK(second != 0 && secondDone, "Done callbacks may enqueue more loads");
+
+    bool cancelledDone = false;
+    const LoadTicket slow = queue.Enqueue(
+        []() {
+          SpinMs(20.0);
+          return true;
+        },
+        {}, [&](bool) { cancelledDone = true; });
+    queue.Clear();
+    SpinMs(30.0);
+    queue.Update(1.0);
+    CHECK(!cancelledDone && queue.IsIdle() &&
+              queue.GetStatus(slow) == LoadStatus::Unknown,
+          "Clear drops pending loads without calling done");
+
+    // デストラクタは実行中の decode を待つ
+    queue.Enqueue(
+        []() {
+          SpinMs(10.0);
+          return true;
+        },
+        {});
+  }
+
+  std::cout << "All async load queue tests passed!\n";
+  return 0;
+}
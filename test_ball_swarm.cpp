@@ -0,0 +1,148 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/BallSwarm.h"
+#include "src/game/systems/SpatialHashGrid.h"
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <set>
+#include <utility>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using game::systems::BallSwarm;
+using game::systems::BallSwarmConfig;
+using game::systems::SpatialHashGrid;
+
+static void FillSwarm(BallSwarm &swarm, int count, uint32_t seed) {
+  std::mt19937 rng(seed);
+  const auto &c = swarm.GetConfig();
+  std::uniform_real_distribution<float> distX(-c.wallX, c.wallX);
+  std::uniform_real_distribution<float> distZ(-c.wallZ, c.wallZ);
+  std::uniform_real_distribution<float> distY(c.floorY, c.floorY + 60.0f);
+  std::uniform_real_distribution<float> distV(-15.0f, 15.0f);
+  for (int i = 0; i < count; ++i) {
+    swarm.AddBall(distX(rng), distY(rng), distZ(rng), distV(rng), -16.0f,
+                  distV(rng));
+  }
+}
+
+int main() {
+  // 1) 空間ハッシュの候補ペアが総当たりの接触ペアを全て含む
+  {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> dist(-20.0f, 20.0f);
+    const int n = 800;
+    const float radius = 1.0f;
+    std::vector<float> xs(n), ys(n), zs(n);
+    for (int i = 0; i < n; ++i) {
+      xs[i] = dist(rng);
+      ys[i] = dist(rng);
+      zs[i] = dist(rng);
+    }
+
+    std::set<std::pair<uint32_t, uint32_t>> brute;
+    for (int i = 0; i < n; ++i) {
+      for (int j = i + 1; j < n; ++j) {
+        float dx = xs[j] - xs[i], dy = ys[j] - ys[i], dz = zs[j] - zs[i];
+        if (dx * dx + dy * dy + dz * dz < 4.0f * radius * radius) {
+          brute.insert({static_cast<uint32_t>(i), static_cast<uint32_t>(j)});
+        }
+      }
+    }
+
+    SpatialHashGrid grid;
+    grid.Build(xs.data(), ys.data(), zs.data(), n, radius * 2.0f);
+    std::set<std::pair<uint32_t, uint32_t>> candidates;
+    bool duplicate = false;
+    grid.ForEachPair(xs.data(), ys.data(), zs.data(),
+                     [&](uint32_t i, uint32_t j) {
+                       if (!candidates.insert({i, j}).second) {
+                         duplicate = true;
+                       }
+                     });
+
+    bool coversAll = true;
+    for (const auto &p : brute) {
+      if (!candidates.count(p)) {
+        coversAll = false;
+      }
+    }
+    CHECK(!brute.empty(), "Brute force finds some overlapping pairs");
+    CHECK(coversAll, "Spatial hash candidates cover every brute-force contact");
+    CHECK(!duplicate, "Spatial hash never reports a pair twice");
+  }
+
+  // 2) スレッド数に関わらず結果がビット一致する
+  {
+    BallSwarmConfig config;
+    BallSwarm serial(config), pooled1(config), pooled4(config);
+    FillSwarm(serial, 3000, 42);
+    FillSwarm(pooled1, 3000, 42);
+    FillSwarm(pooled4, 3000, 42);
+
+    core::ThreadPool pool1(1);
+    core::ThreadPool pool4(4);
+    for (int frame = 0; frame < 30; ++frame) {
+      serial.Step(1.0f / 60.0f, nullptr);
+      pooled1.Step(1.0f / 60.0f, &pool1);
+      pooled4.Step(1.0f / 60.0f, &pool4);
+    }
+
+    bool identical = true;
+    for (size_t i = 0; i < serial.GetCount(); ++i) {
+      if (serial.GetX(i) != pooled4.GetX(i) ||
+          serial.GetY(i) != pooled4.GetY(i) ||
+          serial.GetZ(i) != pooled4.GetZ(i) ||
+          serial.GetX(i) != pooled1.GetX(i) ||
+          serial.GetY(i) != pooled1.GetY(i)) {
+        identical = false;
+        break;
+      }
+    }
+    CHECK(identical, "Parallel Jacobi solve is bit-identical to serial");
+  }
+
+  // 3) 350球が落ち着き、床と壁の内側で大きくめり込まない
+  {
+    BallSwarmConfig config;
+    BallSwarm swarm(config);
+    FillSwarm(swarm, 350, 3);
+    for (int frame = 0; frame < 600; ++frame) {
+      swarm.Step(1.0f / 60.0f, &core::ThreadPool::Shared());
+    }
+
+    bool inside = true;
+    float worstOverlap = 0.0f;
+    for (size_t i = 0; i < swarm.GetCount(); ++i) {
+      if (swarm.GetY(i) < config.floorY - 1e-3f ||
+          std::fabs(swarm.GetX(i)) > config.wallX + 1e-3f ||
+          std::fabs(swarm.GetZ(i)) > config.wallZ + 1e-3f) {
+        inside = false;
+      }
+      for (size_t j = i + 1; j < swarm.GetCount(); ++j) {
+        float dx = swarm.GetX(j) - swarm.GetX(i);
+        float dy = swarm.GetY(j) - swarm.GetY(i);
+        float dz = swarm.GetZ(j) - swarm.GetZ(i);
+        float overlap = config.radius * 2.0f - std::sqrt(dx * dx + dy * dy +
+                                                         dz * dz);
+        worstOverlap = std::max(worstOverlap, overlap);
+      }
+    }
+    CHECK(inside, "Balls stay inside the arena");
+    CHECK(worstOverlap < config.radius * 0.5f,
+          "Contacts keep ball overlap under half a radius");
+    CHECK(swarm.GetStats().settledCount > 0, "Some balls settle on the floor");
+  }
+
+  std::cout << "All ball swarm tests passed!\n";
+  return 0;
+}
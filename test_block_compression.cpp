@@ -0,0 +1,240 @@
+#include "src/core/MappedFile.h"
+#include "src/core/ThreadPool.h"
+#include "src/graphics/BlockCompression.h"
+#include "src/graphics/SkyboxCache.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using graphics::BlockFormat;
+
+/// 空のような滑らかなグラデーション + 弱いノイズ
+static std::vector<uint8_t> SkyLike(uint32_t w, uint32_t h, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::vector<uint8_t> image(static_cast<size_t>(w) * h * 4);
+  for (uint32_t y = 0; y < h; ++y) {
+    for (uint32_t x = 0; x < w; ++x) {
+      const float t = static_cast<float>(y) / h;
+      const float s = static_cast<float>(x) / w;
+      const int noise = static_cast<int>(rng() % 5) - 2;
+      uint8_t *p = &image[(static_cast<size_t>(y) * w + x) * 4];
+      p[0] = static_cast<uint8_t>(std::clamp(
+          static_cast<int>(90 + 100 * t + 20 * s) + noise, 0, 255));
+      p[1] = static_cast<uint8_t>(std::clamp(
+          static_cast<int>(140 + 70 * t) + noise, 0, 255));
+      p[2] = static_cast<uint8_t>(std::clamp(
+          static_cast<int>(230 - 40 * t + 10 * s) + noise, 0, 255));
+      p[3] = 255;
+    }
+  }
+  return image;
+}
+
+static double Psnr(const std::vector<uint8_t> &a,
+                   const std::vector<uint8_t> &b, int channels) {
+  double sum = 0.0;
+  size_t n = 0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (static_cast<int>(i % 4) < channels) {
+      const double d = static_cast<double>(a[i]) - b[i];
+      sum += d * d;
+      ++n;
+    }
+  }
+  if (sum == 0.0) {
+    return 99.0;
+  }
+  return 10.0 * std::log10(255.0 * 255.0 / (sum / n));
+}
+
+static std::vector<uint8_t> RoundTrip(const std::vector<uint8_t> &image,
+                                      uint32_t w, uint32_t h,
+                                      BlockFormat format,
+                                      core::ThreadPool *pool = nullptr) {
+  std::vector<uint8_t> blocks(graphics::CompressedSize(format, w, h));
+  graphics::CompressImage(image.data(), w, h, w * 4, format, blocks.data(),
+                          pool);
+  std::vector<uint8_t> decoded(image.size());
+  graphics::DecompressImage(blocks.data(), w, h, format, decoded.data());
+  return decoded;
+}
+
+int main() {
+  // 1) 大きさ
+  {
+    CHECK(graphics::CompressedSize(BlockFormat::BC1, 512, 512) ==
+                  512 * 512 / 2 &&
+              graphics::CompressedSize(BlockFormat::BC7, 512, 512) ==
+                  512 * 512 &&
+              graphics::CompressedSize(BlockFormat::BC7, 1, 1) == 16 &&
+              graphics::CompressedSize(BlockFormat::BC1, 5, 9) == 6 * 8,
+          "Compressed sizes round up to whole blocks");
+  }
+
+  // 2) 単色ブロック: BC7 は pbit の偶奇の分 ±1、BC1 は 565 の精度で再現する
+  {
+    uint8_t block[64];
+    for (int i = 0; i < 16; ++i) {
+      block[i * 4 + 0] = 37;
+      block[i * 4 + 1] = 201;
+      block[i * 4 + 2] = 118;
+      block[i * 4 + 3] = 255;
+    }
+    uint8_t bc7[16], bc1[8], out[64];
+    graphics::EncodeBC7Block(block, bc7);
+    CHECK((bc7[0] & 0x7f) == 0x40, "BC7 blocks use mode 6");
+    bool close = graphics::DecodeBC7Block(bc7, out);
+    for (int i = 0; i < 64; ++i) {
+      close &= std::abs(out[i] - block[i]) <= 1;
+    }
+    CHECK(close, "BC7 reproduces a solid block within one step");
+    graphics::EncodeBC1Block(block, bc1);
+    graphics::DecodeBC1Block(bc1, out);
+    close = true;
+    for (int i = 0; i < 64; ++i) {
+      close &= std::abs(out[i] - block[i]) <= 4;
+    }
+    CHECK(close, "BC1 reproduces a solid block within 565 precision");
+
+    uint8_t mode5[16] = {0x20};
+    CHECK(!graphics::DecodeBC7Block(mode5, out),
+          "BC7 decoder rejects modes it does not write");
+  }
+
+  // 3) 画質: 空のような画像で BC7 は 44 dB、BC1 は 36 dB 以上
+  {
+    const uint32_t w = 67, h = 45; // 端数ブロックも通す
+    const std::vector<uint8_t> image = SkyLike(w, h, 1);
+    const double bc7 =
+        Psnr(image, RoundTrip(image, w, h, BlockFormat::BC7), 4);
+    const double bc1 =
+        Psnr(image, RoundTrip(image, w, h, BlockFormat::BC1), 3);
+    std::cout << "  BC7 " << bc7 << " dB, BC1 " << bc1 << " dB\n";
+    CHECK(bc7 >= 44.0, "BC7 keeps smooth gradients");
+    CHECK(bc1 >= 36.0, "BC1 keeps smooth gradients");
+  }
+
+  // 4) 鋭い縁（ブロックの途中で切り替わる）と透明度（BC7 はアルファも持つ）
+  {
+    std::vector<uint8_t> image(64 * 64 * 4);
+    for (uint32_t y = 0; y < 64; ++y) {
+      for (uint32_t x = 0; x < 64; ++x) {
+        const uint8_t v = ((x + 2) / 4 + y / 8) % 2 ? 235 : 20;
+        uint8_t *p = &image[(y * 64 + x) * 4];
+        p[0] = p[1] = p[2] = v;
+        p[3] = 255;
+      }
+    }
+    const double bc7 =
+        Psnr(image, RoundTrip(image, 64, 64, BlockFormat::BC7), 4);
+    const double bc1 =
+        Psnr(image, RoundTrip(image, 64, 64, BlockFormat::BC1), 3);
+    CHECK(bc7 >= 40.0 && bc1 >= 34.0, "Hard edges inside blocks stay sharp");
+
+    uint8_t block[64];
+    for (int i = 0; i < 16; ++i) {
+      const uint8_t v = static_cast<uint8_t>(i * 17);
+      block[i * 4 + 0] = block[i * 4 + 1] = block[i * 4 + 2] = 128;
+      block[i * 4 + 3] = v;
+    }
+    uint8_t bc7Block[16], out[64];
+    graphics::EncodeBC7Block(block, bc7Block);
+    graphics::DecodeBC7Block(bc7Block, out);
+    int maxError = 0;
+    for (int i = 0; i < 16; ++i) {
+      maxError =
+          std::max(maxError, std::abs(out[i * 4 + 3] - block[i * 4 + 3]));
+    }
+    CHECK(maxError <= 3, "BC7 encodes an alpha ramp");
+  }
+
+  // 5) スレッド数によらず同じブロック列
+  {
+    core::ThreadPool pool(3);
+    const std::vector<uint8_t> image = SkyLike(256, 96, 3);
+    for (BlockFormat format : {BlockFormat::BC1, BlockFormat::BC7}) {
+      std::vector<uint8_t> serial(graphics::CompressedSize(format, 256, 96));
+      std::vector<uint8_t> parallel(serial.size());
+      graphics::CompressImage(image.data(), 256, 96, 256 * 4, format,
+                              serial.data());
+      graphics::CompressImage(image.data(), 256, 96, 256 * 4, format,
+                              parallel.data(), &pool);
+      CHECK(serial == parallel, "Pool output matches single thread");
+    }
+  }
+
+  // 6) キャッシュファイル: 書いてマップして全段を読める
+  {
+    const uint32_t faceSize = 64;
+    std::vector<std::vector<uint8_t>> faces;
+    for (unsigned f = 0; f < 6; ++f) {
+      faces.push_back(SkyLike(faceSize, faceSize, 10 + f));
+    }
+    graphics::MipChainSettings mips;
+    mips.filter = graphics::MipFilter::Kaiser;
+    mips.srgb = true;
+    std::vector<uint8_t> bytes;
+    CHECK(graphics::EncodeSkyboxCache(faces, faceSize, BlockFormat::BC7, mips,
+                                      bytes),
+          "Encode a 64px cubemap");
+
+    const std::filesystem::path path =
+        std::filesystem::temp_directory_path() / "test_skybox_cache.wgsky";
+    CHECK(graphics::WriteSkyboxCache(path, bytes), "Write the cache file");
+
+    core::MappedFile file;
+    graphics::SkyboxCacheView view;
+    CHECK(file.Open(path) && view.Parse(file.Data(), file.Size()),
+          "Map and parse the cache file");
+    CHECK(view.GetFormat() == BlockFormat::BC7 &&
+              view.GetFaceSize() == faceSize && view.GetMipLevels() == 7 &&
+              view.LevelSize(6) == 1 && view.LevelRowPitch(0) == 16 * 16 &&
+              view.PayloadBytes() + 64 == file.Size(),
+          "Header describes the full mip chain");
+
+    bool layout = true;
+    size_t expectedOffset = 0;
+    for (uint32_t face = 0; face < 6; ++face) {
+      for (uint32_t mip = 0; mip < view.GetMipLevels(); ++mip) {
+        layout &= view.Level(face, mip) == view.Level(0, 0) + expectedOffset;
+        expectedOffset += view.LevelBytes(mip);
+      }
+    }
+    CHECK(layout && expectedOffset == view.PayloadBytes(),
+          "Levels follow D3D subresource order");
+
+    std::vector<uint8_t> decoded(faceSize * faceSize * 4);
+    CHECK(graphics::DecompressImage(view.Level(3, 0), faceSize, faceSize,
+                                    BlockFormat::BC7, decoded.data()) &&
+              Psnr(faces[3], decoded, 4) >= 44.0,
+          "Top level decodes back to the face");
+
+    std::vector<uint8_t> corrupt = bytes;
+    corrupt[corrupt.size() / 2] ^= 0x55;
+    graphics::SkyboxCacheView bad;
+    CHECK(!bad.Parse(corrupt.data(), corrupt.size()) &&
+              !bad.Parse(bytes.data(), bytes.size() - 16) &&
+              !bad.Parse(bytes.data(), 10),
+          "Corrupt or truncated files are rejected");
+
+    file.Close();
+    std::filesystem::remove(path);
+  }
+
+  std::cout << "All block compression tests passed!\n";
+  return 0;
+}
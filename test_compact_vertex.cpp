@@ -0,0 +1,203 @@
+#include "src/graphics/CompactVertex.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using graphics::CompactVertex;
+using graphics::PositionEncoding;
+using graphics::PositionQuantization;
+using graphics::Vertex;
+
+namespace {
+
+float Dot(const DirectX::XMFLOAT3 &a, const DirectX::XMFLOAT3 &b) {
+  return a.x * b.x + a.y * b.y + a.z * b.z;
+}
+
+DirectX::XMFLOAT3 Cross(const DirectX::XMFLOAT3 &a,
+                        const DirectX::XMFLOAT3 &b) {
+  return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z,
+          a.x * b.y - a.y * b.x};
+}
+
+/// 球面上に散らばった単位ベクトル（黄金角の螺旋）と軸方向
+std::vector<DirectX::XMFLOAT3> MakeDirections(int count) {
+  std::vector<DirectX::XMFLOAT3> directions = {
+      {1, 0, 0}, {-1, 0, 0}, {0, 1, 0}, {0, -1, 0}, {0, 0, 1}, {0, 0, -1}};
+  for (int i = 0; i < count; ++i) {
+    const float y = 1.0f - 2.0f * (i + 0.5f) / count;
+    const float r = std::sqrt(1.0f - y * y);
+    const float phi = 2.39996323f * i;
+    directions.push_back({r * std::cos(phi), y, r * std::sin(phi)});
+  }
+  return directions;
+}
+
+} // namespace
+
+int main() {
+  // 1) half: 表せる値はそのまま戻り、丸めは最近接偶数
+  {
+    const float exact[] = {0.0f, 1.0f, -2.0f, 0.5f, 65504.0f, 0.000061035156f,
+                           0.000000059604645f};
+    bool same = true;
+    for (float v : exact) {
+      same &= graphics::HalfToFloat(graphics::FloatToHalf(v)) == v;
+    }
+    CHECK(same, "Representable values round-trip through half");
+    CHECK(graphics::FloatToHalf(1.0f) == 0x3c00 &&
+              graphics::FloatToHalf(-1.0f) == 0xbc00,
+          "Half bit patterns match IEEE 754 binary16");
+    // 1 + 2^-11 は 1 と 1 + 2^-10 のちょうど中間 → 偶数側の 1
+    CHECK(graphics::FloatToHalf(1.0f + 1.0f / 2048.0f) == 0x3c00 &&
+              graphics::FloatToHalf(1.0f + 3.0f / 2048.0f) == 0x3c02,
+          "Ties round to even");
+    CHECK(graphics::FloatToHalf(70000.0f) == 0x7c00 &&
+              std::isinf(graphics::HalfToFloat(0x7c00)),
+          "Out-of-range values become infinity");
+    float worst = 0.0f;
+    for (float v = -4.0f; v <= 4.0f; v += 0.001f) {
+      const float back = graphics::HalfToFloat(graphics::FloatToHalf(v));
+      worst = std::max(worst, std::fabs(back - v) / std::max(std::fabs(v),
+                                                             1e-3f));
+    }
+    CHECK(worst <= 1.0f / 2048.0f, "Relative half error is within 2^-11");
+  }
+
+  // 2) 八面体写像: 下半球と軸方向も含めて誤差が小さい
+  {
+    float worst = 0.0f;
+    for (const DirectX::XMFLOAT3 &d : MakeDirections(4096)) {
+      int16_t encoded[2];
+      graphics::EncodeOctahedral(d, encoded);
+      const DirectX::XMFLOAT3 back = graphics::DecodeOctahedral(encoded);
+      const DirectX::XMFLOAT3 c = Cross(d, back);
+      worst = std::max(worst, std::atan2(std::sqrt(Dot(c, c)), Dot(d, back)) *
+                                  57.2957795f);
+    }
+    CHECK(worst < 0.01f, "Octahedral snorm16 directions stay within 0.01 deg");
+  }
+
+  // 3) 頂点をまとめて詰める
+  std::vector<Vertex> vertices;
+  for (const DirectX::XMFLOAT3 &d : MakeDirections(500)) {
+    Vertex v{};
+    v.position = {3.0f + d.x * 2.0f, -1.0f + d.y * 0.5f, 10.0f + d.z};
+    v.normal = d;
+    // 法線に直交する接線と、左右両方の手系の従法線
+    DirectX::XMFLOAT3 t = Cross({0.0f, 1.0f, 0.0f}, d);
+    if (Dot(t, t) < 1e-6f) {
+      t = {1.0f, 0.0f, 0.0f};
+    }
+    const float len = std::sqrt(Dot(t, t));
+    v.tangent = {t.x / len, t.y / len, t.z / len};
+    const float hand = vertices.size() % 2 ? -1.0f : 1.0f;
+    const DirectX::XMFLOAT3 b = Cross(v.normal, v.tangent);
+    v.bitangent = {b.x * hand, b.y * hand, b.z * hand};
+    v.texCoord = {d.x * 4.0f, d.y * 0.5f + 0.5f};
+    v.color = {0.5f + d.x * 0.5f, 0.25f, 1.0f, 0.8f};
+    vertices.push_back(v);
+  }
+
+  {
+    const PositionQuantization q =
+        graphics::ComputePositionQuantization(vertices.data(),
+                                              vertices.size());
+    CHECK(std::fabs(q.scale - 2.0f) < 1e-3f && std::fabs(q.center.x - 3.0f) <
+                                                   1e-2f,
+          "Quantization uses the bounds center and the longest half side");
+
+    std::vector<CompactVertex> compact;
+    PositionQuantization used;
+    graphics::EncodeCompactVertices(vertices.data(), vertices.size(),
+                                    PositionEncoding::kSnorm16, compact, used);
+    CHECK(compact.size() == vertices.size() && used.scale == q.scale,
+          "Every vertex is encoded with the computed quantization");
+
+    const graphics::CompactVertexError e = graphics::MeasureCompactVertexError(
+        vertices.data(), compact.data(), vertices.size(),
+        PositionEncoding::kSnorm16, used);
+    // 各軸で最大 scale / 32767 / 2 の丸め誤差
+    CHECK(e.position <= used.scale / 32767.0f, "Snorm16 position error bound");
+    CHECK(e.normalDegrees < 0.01f && e.tangentDegrees < 0.01f,
+          "Normals and tangents survive octahedral encoding");
+    CHECK(e.bitangentDegrees < 0.05f,
+          "Bitangent is rebuilt with the right handedness");
+    CHECK(e.texCoord <= 4.0f / 2048.0f && e.color <= 0.5f / 255.0f + 1e-6f,
+          "Half UVs and unorm8 colors stay within half a step");
+
+    std::vector<CompactVertex> half;
+    graphics::EncodeCompactVertices(vertices.data(), vertices.size(),
+                                    PositionEncoding::kHalf, half, used);
+    const graphics::CompactVertexError h = graphics::MeasureCompactVertexError(
+        vertices.data(), half.data(), vertices.size(), PositionEncoding::kHalf,
+        used);
+    CHECK(h.position <= used.scale / 1024.0f && h.position > e.position,
+          "Half positions are coarser than snorm16 near the bounds");
+    CHECK(h.bitangentDegrees < 0.05f, "Half keeps the handedness sign too");
+  }
+
+  // 4) 長さ 0 の法線や平らな（大きさのない）メッシュでも壊れない
+  {
+    Vertex flat{};
+    flat.position = {1.0f, 2.0f, 3.0f};
+    std::vector<CompactVertex> compact;
+    PositionQuantization q;
+    graphics::EncodeCompactVertices(&flat, 1, PositionEncoding::kSnorm16,
+                                    compact, q);
+    const Vertex back = graphics::DecodeCompactVertex(
+        compact[0], PositionEncoding::kSnorm16, q);
+    CHECK(q.scale == 1.0f && back.position.x == 1.0f &&
+              back.position.z == 3.0f && std::fabs(back.normal.z - 1.0f) <
+                                             1e-4f,
+          "Degenerate input decodes to the position and a default frame");
+  }
+
+  // 5) 入力レイアウトと位置の行列
+  {
+    const auto layout = graphics::GetCompactInputLayout(
+        PositionEncoding::kSnorm16);
+    CHECK(layout.size() == 5 && layout[0].Format ==
+                                    DXGI_FORMAT_R16G16B16A16_SNORM &&
+              layout[1].AlignedByteOffset == 8 &&
+              layout[2].AlignedByteOffset == 12 &&
+              layout[3].AlignedByteOffset == 16 &&
+              layout[4].AlignedByteOffset == 20 &&
+              layout[4].Format == DXGI_FORMAT_R8G8B8A8_UNORM,
+          "Input layout matches the 24-byte vertex");
+    CHECK(graphics::GetCompactInputLayout(PositionEncoding::kHalf)[0].Format ==
+              DXGI_FORMAT_R16G16B16A16_FLOAT,
+          "Half positions use a float format");
+
+    PositionQuantization q;
+    q.center = {1.0f, 2.0f, 3.0f};
+    q.scale = 4.0f;
+    const DirectX::XMFLOAT4X4 m = q.ToMatrix();
+    // 行ベクトル (0.5, -1, 0, 1) * m
+    const float p[4] = {0.5f, -1.0f, 0.0f, 1.0f};
+    float out[3] = {0, 0, 0};
+    for (int c = 0; c < 3; ++c) {
+      for (int r = 0; r < 4; ++r) {
+        out[c] += p[r] * m.m[r][c];
+      }
+    }
+    CHECK(out[0] == 3.0f && out[1] == -2.0f && out[2] == 3.0f,
+          "Position matrix maps normalized positions back");
+  }
+
+  std::cout << "All compact vertex tests passed!\n";
+  return 0;
+}
@@ -0,0 +1,199 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/HeightFieldFilter.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using namespace game::systems;
+
+static std::vector<float> RandomField(int w, int h, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(-5.0f, 5.0f);
+  std::vector<float> field(static_cast<size_t>(w) * h);
+  for (float &v : field) {
+    v = dist(rng);
+  }
+  return field;
+}
+
+/// @brief 旧 TerrainGenerator::ApplySmoothing と同じ 3x3 平均
+static void NaiveSmooth3x3(std::vector<float> &map, int w, int h, int iters) {
+  std::vector<float> temp = map;
+  for (int it = 0; it < iters; ++it) {
+    for (int z = 1; z < h - 1; ++z) {
+      for (int x = 1; x < w - 1; ++x) {
+        float sum = 0.0f;
+        for (int dz = -1; dz <= 1; ++dz) {
+          for (int dx = -1; dx <= 1; ++dx) {
+            sum += map[(z + dz) * w + (x + dx)];
+          }
+        }
+        temp[z * w + x] = sum / 9.0f;
+      }
+    }
+    map = temp;
+  }
+}
+
+/// @brief 端を複製する素朴な箱型平均
+static void NaiveBoxClamp(std::vector<float> &map, int w, int h, int r) {
+  std::vector<float> out(map.size());
+  for (int z = 0; z < h; ++z) {
+    for (int x = 0; x < w; ++x) {
+      double sum = 0.0;
+      for (int dz = -r; dz <= r; ++dz) {
+        for (int dx = -r; dx <= r; ++dx) {
+          sum += map[std::clamp(z + dz, 0, h - 1) * w +
+                     std::clamp(x + dx, 0, w - 1)];
+        }
+      }
+      out[z * w + x] = static_cast<float>(sum / ((2 * r + 1) * (2 * r + 1)));
+    }
+  }
+  map = out;
+}
+
+static float MaxDiff(const std::vector<float> &a, const std::vector<float> &b) {
+  float m = 0.0f;
+  for (size_t i = 0; i < a.size(); ++i) {
+    m = std::max(m, std::fabs(a[i] - b[i]));
+  }
+  return m;
+}
+
+int main() {
+  // 1) radius 1 / Keep は従来の 3x3 平均と一致する（丸め誤差の範囲）
+  {
+    const int w = 203, h = 150;
+    std::vector<float> expected = RandomField(w, h, 1);
+    std::vector<float> actual = expected;
+    NaiveSmooth3x3(expected, w, h, 3);
+
+    SmoothingSettings settings; // Box, r=1, Keep, 3回
+    SmoothHeightField(actual, w, h, settings, nullptr);
+    CHECK(MaxDiff(expected, actual) < 1e-5f,
+          "Radius 1 matches the legacy 3x3 filter");
+    CHECK(actual[0] == expected[0] && actual[w - 1] == expected[w - 1] &&
+              actual[(h - 1) * w + 5] == expected[(h - 1) * w + 5],
+          "Keep mode leaves the border ring untouched");
+  }
+
+  // 2) 任意半径・端複製が素朴な実装と一致する
+  {
+    const int w = 97, h = 131;
+    std::vector<float> expected = RandomField(w, h, 2);
+    std::vector<float> actual = expected;
+    NaiveBoxClamp(expected, w, h, 5);
+
+    std::vector<float> scratch;
+    BoxBlurHeightField(actual, w, h, 5, SmoothingEdge::Clamp, scratch,
+                       nullptr);
+    CHECK(MaxDiff(expected, actual) < 1e-4f,
+          "Radius 5 clamped box matches brute force");
+  }
+
+  // 3) 一定の高さは変わらない
+  {
+    const int w = 64, h = 64;
+    std::vector<float> field(w * h, 2.5f);
+    SmoothingSettings settings;
+    settings.mode = SmoothingMode::Gaussian;
+    settings.edge = SmoothingEdge::Clamp;
+    settings.sigma = 4.0f;
+    SmoothHeightField(field, w, h, settings, nullptr);
+    CHECK(MaxDiff(field, std::vector<float>(w * h, 2.5f)) < 1e-5f,
+          "Gaussian mode preserves a flat field");
+  }
+
+  // 4) ガウス近似の分散が sigma^2 に近い
+  {
+    const float sigma = 3.0f;
+    const std::vector<int> radii = ComputeGaussianBoxRadii(sigma, 3);
+    double variance = 0.0;
+    for (int r : radii) {
+      const double width = 2.0 * r + 1.0;
+      variance += (width * width - 1.0) / 12.0;
+    }
+    CHECK(radii.size() == 3 &&
+              std::fabs(std::sqrt(variance) - sigma) < 0.25,
+          "Box radii approximate the requested sigma");
+  }
+
+  // 5) スレッド数によらずビット単位で一致する
+  {
+    const int w = 300, h = 517;
+    std::vector<float> serial = RandomField(w, h, 3);
+    std::vector<float> parallel = serial;
+    SmoothingSettings settings;
+    settings.mode = SmoothingMode::Gaussian;
+    settings.edge = SmoothingEdge::Clamp;
+    settings.sigma = 2.5f;
+    settings.iterations = 2;
+
+    core::ThreadPool pool(4);
+    SmoothHeightField(serial, w, h, settings, nullptr);
+    SmoothHeightField(parallel, w, h, settings, &pool);
+    CHECK(std::memcmp(serial.data(), parallel.data(),
+                      serial.size() * sizeof(float)) == 0,
+          "Parallel smoothing is bit-identical to serial");
+  }
+
+  // 6) 矩形だけの再計算は全体の平滑化と一致し、矩形外は書き換えない
+  {
+    const int w = 150, h = 120;
+    const std::vector<float> source = RandomField(w, h, 11);
+    for (SmoothingEdge edge : {SmoothingEdge::Keep, SmoothingEdge::Clamp}) {
+      SmoothingSettings settings;
+      settings.mode = SmoothingMode::Gaussian;
+      settings.edge = edge;
+      settings.sigma = 1.5f;
+      settings.iterations = 2;
+
+      std::vector<float> full = source;
+      SmoothHeightField(full, w, h, settings, nullptr);
+
+      // 左端に接する矩形と内側の矩形
+      std::vector<float> patched(source.size(), -1.0f);
+      SmoothHeightFieldRegion(source, patched, w, h, settings, 0, 10, 40, 50,
+                              nullptr);
+      SmoothHeightFieldRegion(source, patched, w, h, settings, 70, 60, 130,
+                              100, nullptr);
+      float worst = 0.0f;
+      bool outsideKept = true;
+      for (int z = 0; z < h; ++z) {
+        for (int x = 0; x < w; ++x) {
+          const bool inA = x < 40 && z >= 10 && z < 50;
+          const bool inB = x >= 70 && x < 130 && z >= 60 && z < 100;
+          const float v = patched[z * w + x];
+          if (inA || inB) {
+            worst = std::max(worst, std::abs(v - full[z * w + x]));
+          } else {
+            outsideKept = outsideKept && v == -1.0f;
+          }
+        }
+      }
+      CHECK(worst < 1e-5f, "Region smoothing matches full smoothing");
+      CHECK(outsideKept, "Region smoothing leaves other cells untouched");
+    }
+    SmoothingSettings box;
+    box.radius = 2;
+    box.iterations = 3;
+    CHECK(SmoothingHalo(box) == 6, "Halo is radius times iterations");
+  }
+
+  std::cout << "All heightfield filter tests passed!\n";
+  return 0;
+}
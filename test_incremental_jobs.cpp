@@ -0,0 +1,198 @@
+#include "src/core/IncrementalJob.h"
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/TerrainGenerationJob.h"
+#include "src/game/systems/TerrainGenerator.h"
+#include "src/graphics/SkyboxFaceGenerator.h"
+#include "src/graphics/SkyboxGenerationJob.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using game::systems::TerrainConfig;
+using game::systems::TerrainData;
+using game::systems::TerrainGenerationJob;
+using game::systems::TerrainGenerator;
+using graphics::SkyboxGenerationJob;
+using graphics::SkyboxTheme;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+/// @brief 1 Step ごとに stepMs だけ待つジョブ
+class SpinJob : public core::IncrementalJob {
+public:
+  SpinJob(int steps, double stepMs) : m_steps(steps), m_stepMs(stepMs) {}
+
+  float GetProgress() const override {
+    return static_cast<float>(m_done) / m_steps;
+  }
+  int GetQuality() const override { return m_done == m_steps ? 1 : 0; }
+  int GetMaxQuality() const override { return 1; }
+  int GetDone() const { return m_done; }
+
+protected:
+  bool Step() override {
+    const auto start = Clock::now();
+    while (std::chrono::duration<double, std::milli>(Clock::now() - start)
+               .count() < m_stepMs) {
+    }
+    return ++m_done < m_steps;
+  }
+
+private:
+  int m_steps;
+  double m_stepMs;
+  int m_done = 0;
+};
+
+template <typename T>
+bool SameBits(const std::vector<T> &a, const std::vector<T> &b) {
+  return a.size() == b.size() &&
+         (a.empty() ||
+          std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) == 0);
+}
+
+bool SameTerrain(const TerrainData &a, const TerrainData &b) {
+  return SameBits(a.heightMap, b.heightMap) &&
+         SameBits(a.materialMap, b.materialMap) &&
+         SameBits(a.normals, b.normals) && SameBits(a.vertices, b.vertices) &&
+         SameBits(a.indices, b.indices);
+}
+
+} // namespace
+
+int main() {
+  // 1) 予算の範囲で止まり、最低1 Step は進む
+  // （時間の上限はスケジューラに横取りされても通るよう緩めにとる）
+  {
+    SpinJob job(100, 1.0);
+    const core::JobSliceStats slice = job.RunFor(5.5);
+    CHECK(slice.steps >= 1 && slice.steps <= 6 && !slice.finished,
+          "RunFor stops near the budget");
+    CHECK(slice.elapsedMs < 5.5 + 10.0, "RunFor does not run far past it");
+    CHECK(job.RunFor(0.0).steps == 1, "A zero budget still makes progress");
+
+    job.Cancel();
+    CHECK(job.RunFor(100.0).steps == 0 && job.IsCancelled() &&
+              !job.IsFinished(),
+          "Cancelled jobs do no more work");
+  }
+
+  // 2) 複数ジョブを順に進め、終わったものは外す
+  {
+    core::FrameBudgetRunner runner;
+    auto first = std::make_shared<SpinJob>(6, 0.5);
+    auto second = std::make_shared<SpinJob>(6, 0.5);
+    auto cancelled = std::make_shared<SpinJob>(6, 0.5);
+    runner.Add(first);
+    runner.Add(cancelled);
+    runner.Add(second);
+    cancelled->Cancel();
+    int frames = 0;
+    while (!runner.IsIdle() && frames < 100) {
+      runner.Tick(2.0);
+      ++frames;
+    }
+    CHECK(first->IsFinished() && second->IsFinished() &&
+              cancelled->GetDone() == 0,
+          "Runner finishes jobs and skips cancelled ones");
+    CHECK(runner.GetStats().frames == static_cast<uint64_t>(frames) &&
+              runner.GetStats().worstMs >= runner.GetStats().lastMs &&
+              runner.GetStats().worstMs >= 0.5 &&
+              runner.GetStats().worstMs < 2.0 + 10.0,
+          "Runner records the worst frame");
+  }
+
+  // 3) スカイボックス: プレビュー → 本番。結果は一括生成と同じ
+  {
+    const int size = 48;
+    SkyboxGenerationJob job(SkyboxTheme::SpaceAstronomy, size, 8);
+    std::vector<int> qualities;
+    float lastProgress = 0.0f;
+    bool monotonic = true;
+    while (!job.IsFinished()) {
+      job.RunFor(0.0);
+      monotonic &= job.GetProgress() >= lastProgress;
+      lastProgress = job.GetProgress();
+      if (qualities.empty() || qualities.back() != job.GetQuality()) {
+        qualities.push_back(job.GetQuality());
+      }
+    }
+    CHECK(qualities.size() >= 2 && qualities.back() == 2 &&
+              (qualities.front() == 1 || qualities[1] == 1),
+          "Skybox preview arrives before the full faces");
+    CHECK(monotonic && lastProgress == 1.0f, "Skybox progress reaches 1");
+
+    DirectX::XMFLOAT3 top, horizon, bottom;
+    graphics::GetSkyboxThemeColors(SkyboxTheme::SpaceAstronomy, top, horizon,
+                                   bottom);
+    std::vector<std::vector<uint8_t>> reference;
+    graphics::GenerateSkyboxFaces(top, horizon, bottom, size,
+                                  SkyboxTheme::SpaceAstronomy, reference);
+    CHECK(job.GetFaceSize() == size && job.GetFaces() == reference,
+          "Sliced skybox matches the blocking generator");
+
+    core::ThreadPool pool(3);
+    SkyboxGenerationJob pooled(SkyboxTheme::SpaceAstronomy, size, 0, &pool);
+    CHECK(pooled.GetQuality() == 0 && pooled.GetFaces().empty(),
+          "Nothing is usable before the first step");
+    pooled.RunToCompletion();
+    CHECK(pooled.GetFaces() == reference, "Pool slices match as well");
+  }
+
+  // 4) 地形: プレビュー → 本番。結果は一括生成と同じ
+  {
+    TerrainConfig config;
+    config.resolutionX = 96;
+    config.resolutionZ = 140;
+    config.worldWidth = 20.0f;
+    config.worldDepth = 30.0f;
+    config.noiseAmplitude = 0.4f;
+    const std::vector<DirectX::XMFLOAT2> holes = {
+        {-5.0f, 8.0f}, {4.0f, -6.5f}, {6.0f, 10.0f}};
+    const TerrainData reference =
+        TerrainGenerator::GenerateTerrain("Mount Fuji", holes, config, nullptr);
+
+    TerrainGenerationJob job("Mount Fuji", holes, config, 4);
+    job.RunFor(0.0);
+    CHECK(job.GetQuality() == 1 && job.GetData() &&
+              job.GetData()->config.resolutionX == 24,
+          "Terrain preview comes first at a quarter resolution");
+    int steps = 1;
+    while (!job.IsFinished()) {
+      steps += job.RunFor(0.0).steps;
+    }
+    CHECK(steps > 10 && job.GetQuality() == 2 && job.GetProgress() == 1.0f,
+          "Terrain is built over many steps");
+    CHECK(SameTerrain(*job.GetData(), reference),
+          "Sliced terrain matches the blocking generator");
+
+    core::ThreadPool pool(3);
+    TerrainGenerationJob pooled("Mount Fuji", holes, config, 0, &pool);
+    pooled.RunToCompletion();
+    CHECK(SameTerrain(pooled.TakeData(), reference),
+          "Pool slices match as well");
+
+    TerrainGenerationJob cancelled("Mount Fuji", holes, config);
+    cancelled.RunFor(0.0);
+    cancelled.Cancel();
+    cancelled.RunToCompletion();
+    CHECK(!cancelled.IsFinished() && cancelled.GetQuality() == 1,
+          "Cancelling keeps the preview and stops the rest");
+  }
+
+  std::cout << "All incremental job tests passed!\n";
+  return 0;
+}
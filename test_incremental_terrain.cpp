@@ -0,0 +1,228 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/IncrementalTerrainGenerator.h"
+#include "src/game/systems/TerrainGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using game::systems::IncrementalTerrainGenerator;
+using game::systems::SmoothingMode;
+using game::systems::TerrainConfig;
+using game::systems::TerrainData;
+using game::systems::TerrainGenerator;
+using game::systems::TerrainRect;
+using game::systems::TerrainUpdateStats;
+using Holes = std::vector<DirectX::XMFLOAT2>;
+
+template <typename T>
+static bool SameBits(const std::vector<T> &a, const std::vector<T> &b) {
+  return a.size() == b.size() &&
+         (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) ==
+                           0);
+}
+
+static bool SameTerrain(const TerrainData &a, const TerrainData &b) {
+  return SameBits(a.heightMap, b.heightMap) &&
+         SameBits(a.materialMap, b.materialMap) &&
+         SameBits(a.normals, b.normals) && SameBits(a.vertices, b.vertices) &&
+         SameBits(a.indices, b.indices);
+}
+
+/// @brief 差分更新の結果が全体生成と一致するか
+/// @details 平滑化の窓の切り方による丸め誤差だけを許す。
+static bool MatchesFull(const TerrainData &patched, const TerrainData &full) {
+  if (!SameBits(patched.materialMap, full.materialMap) ||
+      !SameBits(patched.indices, full.indices) ||
+      patched.vertices.size() != full.vertices.size()) {
+    return false;
+  }
+  float worst = 0.0f;
+  for (size_t i = 0; i < full.heightMap.size(); ++i) {
+    worst = std::max(worst, std::abs(patched.heightMap[i] - full.heightMap[i]));
+  }
+  for (size_t i = 0; i < full.vertices.size(); ++i) {
+    const auto &a = patched.vertices[i];
+    const auto &b = full.vertices[i];
+    worst = std::max(worst, std::abs(a.position.y - b.position.y));
+    worst = std::max(worst, std::abs(a.normal.x - b.normal.x));
+    worst = std::max(worst, std::abs(a.normal.y - b.normal.y));
+    worst = std::max(worst, std::abs(a.tangent.y - b.tangent.y));
+    if (std::memcmp(&a.color, &b.color, sizeof(a.color)) != 0 ||
+        std::memcmp(&a.texCoord, &b.texCoord, sizeof(a.texCoord)) != 0) {
+      return false;
+    }
+  }
+  return worst < 1e-4f;
+}
+
+/// @brief 矩形外の高さ・頂点がビット単位で変わっていないか
+static bool UntouchedOutside(const TerrainData &before,
+                             const TerrainData &after, const TerrainRect &r,
+                             const TerrainRect &vertexRect) {
+  const int resX = before.config.resolutionX;
+  const int resZ = before.config.resolutionZ;
+  auto inside = [](const TerrainRect &rect, int x, int z) {
+    return x >= rect.x0 && x < rect.x1 && z >= rect.z0 && z < rect.z1;
+  };
+  for (int z = 0; z < resZ; ++z) {
+    for (int x = 0; x < resX; ++x) {
+      const size_t i = static_cast<size_t>(z) * resX + x;
+      if (!inside(r, x, z) && before.heightMap[i] != after.heightMap[i]) {
+        return false;
+      }
+      if (!inside(vertexRect, x, z) &&
+          std::memcmp(&before.vertices[i], &after.vertices[i],
+                      sizeof(before.vertices[i])) != 0) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+int main() {
+  TerrainConfig config;
+  config.resolutionX = 200;
+  config.resolutionZ = 300;
+  config.worldWidth = 40.0f;
+  config.worldDepth = 60.0f;
+  config.heightScale = 2.5f;
+  config.noiseAmplitude = 0.4f;
+
+  // 2番目のホールの中心は1番目の適用範囲に入っている
+  // （1番目を動かすと2番目のグリーン高さも変わる）
+  const Holes holes = {
+      {-10.0f, 12.0f}, {-7.0f, 9.0f}, {8.0f, -18.0f}, {12.0f, 20.0f}};
+
+  IncrementalTerrainGenerator inc;
+  inc.Generate("Incremental", holes, config, nullptr);
+
+  // 1) 初回生成は TerrainGenerator と完全に一致する
+  {
+    const TerrainData full =
+        TerrainGenerator::GenerateTerrain("Incremental", holes, config,
+                                          nullptr);
+    CHECK(SameTerrain(inc.GetData(), full), "Initial build matches full build");
+    CHECK(!inc.HasPendingChanges(), "No pending changes after build");
+    const TerrainUpdateStats stats = inc.Update(nullptr);
+    CHECK(stats.heightRect.IsEmpty() && stats.vertexRect.IsEmpty(),
+          "Update without edits touches nothing");
+  }
+
+  // 2) 離れたホールを1つ動かす: 範囲は局所的で、範囲外は変わらない
+  {
+    Holes moved = holes;
+    moved[2] = {9.0f, -16.5f};
+    const TerrainData before = inc.GetData();
+    inc.SetHoles(moved);
+    CHECK(inc.HasPendingChanges(), "Moving a hole marks changes");
+    const TerrainUpdateStats stats = inc.Update(nullptr);
+    const TerrainData full =
+        TerrainGenerator::GenerateTerrain("Incremental", moved, config,
+                                          nullptr);
+    CHECK(stats.changedPlatforms == 2, "Old and new platform are dirty");
+    CHECK(stats.smoothRect.Area() < full.heightMap.size() / 2,
+          "Dirty region is local");
+    CHECK(MatchesFull(inc.GetData(), full),
+          "Single-hole edit matches full rebuild");
+    CHECK(UntouchedOutside(before, inc.GetData(), stats.smoothRect,
+                           stats.vertexRect),
+          "Cells outside the dirty rectangles are untouched");
+  }
+
+  // 3) 先行ホールを動かすと、中心が重なる後続ホールも作り直される
+  {
+    Holes moved = holes;
+    moved[0] = {-10.5f, 12.5f};
+    moved[2] = {9.0f, -16.5f};
+    inc.SetHoles(moved);
+    const TerrainUpdateStats stats = inc.Update(nullptr);
+    const TerrainData full =
+        TerrainGenerator::GenerateTerrain("Incremental", moved, config,
+                                          nullptr);
+    CHECK(stats.changedPlatforms >= 3, "Dependent platform is re-resolved");
+    CHECK(MatchesFull(inc.GetData(), full),
+          "Chained edit matches full rebuild");
+  }
+
+  // 4) 追加・削除・並べ替え
+  {
+    Holes edited = {{-10.5f, 12.5f}, {9.0f, -16.5f}, {12.0f, 20.0f},
+                    {0.0f, 0.0f}};
+    inc.SetHoles(edited);
+    inc.Update(nullptr);
+    CHECK(MatchesFull(inc.GetData(),
+                      TerrainGenerator::GenerateTerrain("Incremental", edited,
+                                                        config, nullptr)),
+          "Add/remove matches full rebuild");
+
+    std::swap(edited[0], edited[3]);
+    inc.SetHoles(edited);
+    inc.Update(nullptr);
+    CHECK(MatchesFull(inc.GetData(),
+                      TerrainGenerator::GenerateTerrain("Incremental", edited,
+                                                        config, nullptr)),
+          "Reordering matches full rebuild");
+  }
+
+  // 5) 基本形状の dirty 矩形と、平滑化設定を含むパラメータ変更
+  {
+    const Holes &current = holes;
+    inc.SetHoles(current);
+    inc.Update(nullptr);
+    config.heightScale = 3.0f;
+    config.smoothing.mode = SmoothingMode::Gaussian;
+    config.smoothing.sigma = 2.0f;
+    inc.SetConfig(config);
+    const TerrainUpdateStats stats = inc.Update(nullptr);
+    CHECK(!stats.fullRebuild && stats.heightRect.Area() ==
+                                    inc.GetData().heightMap.size(),
+          "Parameter change dirties the whole field");
+    CHECK(SameTerrain(inc.GetData(),
+                      TerrainGenerator::GenerateTerrain("Incremental", current,
+                                                        config, nullptr)),
+          "Whole-field update is bit-identical to full build");
+
+    config.resolutionX = 160;
+    inc.SetConfig(config);
+    CHECK(inc.Update(nullptr).fullRebuild, "Resolution change rebuilds");
+    CHECK(SameTerrain(inc.GetData(),
+                      TerrainGenerator::GenerateTerrain("Incremental", current,
+                                                        config, nullptr)),
+          "Rebuild after resize matches full build");
+  }
+
+  // 6) 並列の差分更新は単一スレッドとビット単位で一致する
+  {
+    core::ThreadPool pool(4);
+    IncrementalTerrainGenerator serial;
+    IncrementalTerrainGenerator parallel;
+    serial.Generate("Incremental", holes, config, nullptr);
+    parallel.Generate("Incremental", holes, config, &pool);
+    Holes moved = holes;
+    moved[1] = {-4.0f, 5.0f};
+    serial.SetHoles(moved);
+    parallel.SetHoles(moved);
+    serial.MarkDirty({10, 10, 60, 40});
+    parallel.MarkDirty({10, 10, 60, 40});
+    serial.Update(nullptr);
+    parallel.Update(&pool);
+    CHECK(SameTerrain(serial.GetData(), parallel.GetData()),
+          "Parallel update matches serial update");
+  }
+
+  std::cout << "All incremental terrain tests passed!\n";
+  return 0;
+}
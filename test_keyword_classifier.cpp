@@ -0,0 +1,139 @@
+#include "src/core/KeywordClassifier.h"
+#include "src/game/systems/TerrainBiome.h"
+#include "src/graphics/SkyboxThemeClassifier.h"
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using core::KeywordClassifier;
+using core::KeywordScore;
+using graphics::SkyboxTheme;
+
+int main() {
+  // 1) 採点・順位・確信度
+  {
+    KeywordClassifier classifier;
+    const uint32_t space = classifier.AddLabel("space");
+    const uint32_t ocean = classifier.AddLabel("ocean");
+    const uint32_t music = classifier.AddLabel("music");
+    classifier.AddKeywords(space, {"galaxy", "宇宙"}, 2.0f);
+    classifier.AddKeyword(ocean, "sea");
+    classifier.AddKeyword(music, "concert");
+    classifier.Compile();
+
+    std::vector<KeywordScore> ranked;
+    classifier.Classify({{"A Sea voyage under the GALAXY", 1.0f}}, ranked);
+    CHECK(ranked.size() == 2 && ranked[0].label == space &&
+              ranked[0].score == 2.0f && ranked[1].label == ocean,
+          "Heavier keyword ranks first, ASCII case is ignored");
+    CHECK(std::abs(ranked[0].confidence + ranked[1].confidence - 1.0f) <
+                  1e-6f &&
+              std::abs(ranked[0].confidence - 2.0f / 3.0f) < 1e-6f,
+          "Confidences are shares of the total score");
+
+    classifier.Classify({{"sea", 1.0f}, {"宇宙", 0.25f}}, ranked);
+    CHECK(ranked[0].label == ocean && ranked[1].score == 0.5f,
+          "Source weights scale the keyword weights");
+
+    classifier.Classify({{"concert sea", 1.0f}}, ranked);
+    CHECK(ranked.size() == 2 && ranked[0].label == ocean &&
+              ranked[1].label == music,
+          "Ties keep the order labels were added");
+
+    classifier.Classify({{"nothing here", 1.0f}}, ranked);
+    CHECK(ranked.empty(), "No match gives no ranking");
+  }
+
+  // 2) 英単語は単語単位（複数形の s は許す）、日本語は部分一致
+  {
+    KeywordClassifier classifier;
+    const uint32_t label = classifier.AddLabel("x");
+    classifier.AddKeywords(label, {"ai", "planet", "海"});
+    classifier.SetMaxHitsPerKeyword(10);
+    classifier.Compile();
+
+    std::vector<KeywordScore> ranked;
+    classifier.Classify({{"she said the plain planetarium", 1.0f}}, ranked);
+    CHECK(ranked.empty(), "English keywords do not match inside words");
+    classifier.Classify({{"AI, planets and (planet)", 1.0f}}, ranked);
+    CHECK(ranked.size() == 1 && ranked[0].score == 3.0f,
+          "Whole words and plurals match");
+    classifier.Classify({{"日本海と海洋", 1.0f}}, ranked);
+    CHECK(ranked.size() == 1 && ranked[0].score == 2.0f,
+          "Japanese keywords match inside words");
+  }
+
+  // 3) 1キーワードの出現は上限まで
+  {
+    KeywordClassifier classifier;
+    const uint32_t a = classifier.AddLabel("a");
+    const uint32_t b = classifier.AddLabel("b");
+    classifier.AddKeyword(a, "war");
+    classifier.AddKeywords(b, {"music", "concert"});
+    classifier.Compile();
+    std::vector<KeywordScore> ranked;
+    classifier.Classify(
+        {{"war war war war war war war music concert", 1.0f}}, ranked);
+    CHECK(ranked[0].label == a && ranked[0].score == 3.0f &&
+              ranked[1].score == 2.0f,
+          "A repeated keyword is counted at most three times");
+  }
+
+  // 4) スカイボックステーマ
+  {
+    CHECK(graphics::ClassifySkyboxTheme("ブラックホール", "") ==
+              SkyboxTheme::SpaceAstronomy,
+          "Black hole title picks the space theme");
+    CHECK(graphics::ClassifySkyboxTheme(
+              "Mount Fuji", "Mount Fuji is an active volcano.") ==
+              SkyboxTheme::Volcano,
+          "Volcano in the extract picks the volcano theme");
+    CHECK(graphics::ClassifySkyboxTheme(
+              "織田信長", "1534年6月23日 - 1582年6月21日。戦国時代の武将。") ==
+              SkyboxTheme::Default,
+          "Dates alone do not pick the space theme");
+    CHECK(graphics::ClassifySkyboxTheme("Research", "He said it was said.") ==
+              SkyboxTheme::Default,
+          "Substrings of other words do not pick a theme");
+
+    std::vector<graphics::SkyboxThemeScore> ranked;
+    const SkyboxTheme theme = graphics::ClassifySkyboxTheme(
+        "オーケストラ", "交響楽団の歴史。戦争中も演奏会を続けた。", &ranked);
+    CHECK(theme == SkyboxTheme::Music && ranked.size() >= 3 &&
+              ranked[0].theme == SkyboxTheme::Music,
+          "Title outweighs other themes in the extract");
+    CHECK(std::string(graphics::GetSkyboxThemeName(SkyboxTheme::SciFi)) ==
+              "SciFi",
+          "Theme names follow the enum");
+  }
+
+  // 5) 地形のバイオーム
+  {
+    using game::systems::ClassifyTerrainBiome;
+    float confidence = 0.0f;
+    CHECK(ClassifyTerrainBiome({"日本の歴史", "戦国時代の人物"},
+                               &confidence) == 1 &&
+              confidence == 1.0f,
+          "History categories pick biome 1");
+    CHECK(ClassifyTerrainBiome({"日本の山", "火山", "地理"}) == 3,
+          "Geography categories pick biome 3");
+    CHECK(ClassifyTerrainBiome({"物理学", "数学の定理", "科学史"}) == 2,
+          "Majority across categories wins");
+    CHECK(ClassifyTerrainBiome({"存命人物", "日本の俳優"}) == -1,
+          "No match leaves the choice to the caller");
+  }
+
+  std::cout << "All keyword classifier tests passed!\n";
+  return 0;
+}
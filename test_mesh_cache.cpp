@@ -0,0 +1,224 @@
+#include "src/core/MappedFile.h"
+#include "src/graphics/MeshCache.h"
+#include "src/graphics/ObjLoader.h"
+#include <cstdlib>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using graphics::MeshCacheView;
+using graphics::Submesh;
+using graphics::Vertex;
+
+namespace {
+
+/// n x n の格子（2 三角形 / マス）を OBJ で書く
+void WriteGridObj(const std::string &path, int n, float height) {
+  std::ofstream file(path);
+  for (int y = 0; y <= n; ++y) {
+    for (int x = 0; x <= n; ++x) {
+      file << "v " << x << " " << height * ((x + y) % 3) << " " << y << "\n";
+      file << "vt " << static_cast<float>(x) / n << " "
+           << static_cast<float>(y) / n << "\n";
+    }
+  }
+  file << "vn 0 1 0\n";
+  const int row = n + 1;
+  for (int y = 0; y < n; ++y) {
+    for (int x = 0; x < n; ++x) {
+      const int a = y * row + x + 1;
+      const int b = a + 1;
+      const int c = a + row;
+      const int d = c + 1;
+      file << "f " << a << "/" << a << "/1 " << c << "/" << c << "/1 " << b
+           << "/" << b << "/1\n";
+      file << "f " << b << "/" << b << "/1 " << c << "/" << c << "/1 " << d
+           << "/" << d << "/1\n";
+    }
+  }
+}
+
+bool SameVertices(const Vertex *a, const std::vector<Vertex> &b) {
+  return b.empty() || std::memcmp(a, b.data(), b.size() * sizeof(Vertex)) == 0;
+}
+
+} // namespace
+
+int main() {
+  // 1) 往復: 頂点・インデックス・サブメッシュ・境界がそのまま読める
+  std::vector<Vertex> vertices(5);
+  for (size_t i = 0; i < vertices.size(); ++i) {
+    vertices[i].position = {static_cast<float>(i) - 2.0f,
+                            static_cast<float>(i * i), -1.0f * i};
+    vertices[i].texCoord = {0.25f * i, 1.0f};
+  }
+  const std::vector<uint32_t> indices = {0, 1, 2, 2, 3, 4};
+  const std::vector<Submesh> submeshes = {{0, 3, 0, 3}, {3, 3, 2, 3}};
+  std::vector<uint8_t> bytes;
+  CHECK(graphics::EncodeMeshCache(vertices, indices, submeshes, {}, 42, bytes),
+        "Encode succeeds");
+
+  MeshCacheView view;
+  CHECK(view.Parse(bytes.data(), bytes.size()), "Parse accepts the encoding");
+  CHECK(view.GetVertexCount() == 5 && view.GetIndexCount() == 6 &&
+            view.GetSubmeshCount() == 2 && view.GetSourceHash() == 42,
+        "Counts and source hash round-trip");
+  CHECK(SameVertices(view.Vertices(), vertices) &&
+            std::memcmp(view.Indices(), indices.data(),
+                        indices.size() * sizeof(uint32_t)) == 0,
+        "Vertices and indices round-trip byte for byte");
+  CHECK(view.Submeshes()[1].indexOffset == 3 &&
+            view.Submeshes()[1].vertexOffset == 2,
+        "Submeshes round-trip");
+  CHECK(reinterpret_cast<uintptr_t>(view.Vertices()) % 16 == 0,
+        "Vertices start on a 16-byte boundary");
+  CHECK(view.GetBoundsMin().x == -2.0f && view.GetBoundsMax().x == 2.0f &&
+            view.GetBoundsMin().y == 0.0f && view.GetBoundsMax().y == 16.0f &&
+            view.GetBoundsMin().z == -4.0f && view.GetBoundsMax().z == 0.0f,
+        "Bounds cover every position");
+
+  // 2) サブメッシュなしは全体で1つ。範囲外は書かない
+  CHECK(view.GetLodCount() == 1 && view.Lods()[0].indexCount == 6,
+        "Missing LODs default to one covering every index");
+  CHECK(graphics::EncodeMeshCache(vertices, indices, {}, {}, 0, bytes) &&
+            view.Parse(bytes.data(), bytes.size()) &&
+            view.GetSubmeshCount() == 1 &&
+            view.Submeshes()[0].indexCount == 6 &&
+            view.Submeshes()[0].vertexCount == 5,
+        "Missing submeshes default to one covering the mesh");
+  {
+    // LOD1 は LOD0 の後ろに足した範囲。サブメッシュは LOD0 だけを覆う
+    std::vector<uint32_t> withLod = indices;
+    withLod.insert(withLod.end(), {0, 2, 4});
+    std::vector<uint8_t> lodBytes;
+    CHECK(graphics::EncodeMeshCache(vertices, withLod, {},
+                                    {{0, 6, 0.0f}, {6, 3, 0.125f}}, 0,
+                                    lodBytes) &&
+              view.Parse(lodBytes.data(), lodBytes.size()) &&
+              view.GetLodCount() == 2 && view.Lods()[1].indexOffset == 6 &&
+              view.Lods()[1].error == 0.125f &&
+              view.Submeshes()[0].indexCount == 6 &&
+              reinterpret_cast<uintptr_t>(view.Vertices()) % 16 == 0,
+          "LOD ranges round-trip after the submeshes");
+    CHECK(!graphics::EncodeMeshCache(vertices, withLod, {}, {{6, 6, 0.0f}},
+                                     0, lodBytes),
+          "Out-of-range LODs are rejected");
+  }
+  std::vector<uint8_t> rejected;
+  CHECK(!graphics::EncodeMeshCache(vertices, {0, 1, 5}, {}, {}, 0, rejected) &&
+            !graphics::EncodeMeshCache(vertices, indices, {{4, 3, 0, 5}}, {},
+                                       0, rejected),
+        "Out-of-range indices and submeshes are rejected");
+
+  // 3) 壊れたファイル・切れたファイルは読まない
+  {
+    std::vector<uint8_t> corrupt = bytes;
+    corrupt[corrupt.size() - 3] ^= 0x40;
+    std::vector<uint8_t> badHeader = bytes;
+    badHeader[20] ^= 0x01;
+    const std::vector<uint8_t> truncated(bytes.begin(), bytes.end() - 4);
+    CHECK(!view.Parse(corrupt.data(), corrupt.size()) &&
+              !view.Parse(badHeader.data(), badHeader.size()) &&
+              !view.Parse(truncated.data(), truncated.size()) &&
+              !view.Parse(bytes.data(), 10) && view.GetVertexCount() == 0,
+          "Corrupt, truncated and short files are rejected");
+  }
+
+  // 4) 変換: ObjLoader の結果と同じものがマップで読める
+  const std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / "test_mesh_cache";
+  std::filesystem::create_directories(dir);
+  const std::string source = (dir / "grid.obj").string();
+  const std::filesystem::path cachePath = graphics::MeshCachePathFor(source);
+  std::filesystem::remove(cachePath);
+  WriteGridObj(source, 16, 0.5f);
+
+  std::vector<Vertex> objVertices;
+  std::vector<uint32_t> objIndices;
+  CHECK(graphics::ObjLoader::Load(source, objVertices, objIndices),
+        "ObjLoader reads the generated grid");
+
+  const graphics::MeshSourceLoader loader =
+      [](const std::string &path, std::vector<Vertex> &v,
+         std::vector<uint32_t> &i, std::vector<Submesh> &) {
+        return graphics::ObjLoader::Load(path, v, i);
+      };
+  {
+    core::MappedFile file;
+    CHECK(!graphics::OpenMeshCache(source, file, view),
+          "No cache before conversion");
+    std::vector<Vertex> v;
+    std::vector<uint32_t> i;
+    std::vector<Submesh> s;
+    bool written = false;
+    CHECK(graphics::ConvertMeshToCache(source, loader, v, i, s, &written) &&
+              written && std::filesystem::exists(cachePath),
+          "Conversion writes the cache next to the source");
+    CHECK(v.size() == objVertices.size() && i == objIndices,
+          "Conversion returns what the loader read");
+  }
+  {
+    core::MappedFile file;
+    CHECK(graphics::OpenMeshCache(source, file, view) &&
+              view.GetVertexCount() == objVertices.size() &&
+              view.GetIndexCount() == objIndices.size() &&
+              SameVertices(view.Vertices(), objVertices) &&
+              std::memcmp(view.Indices(), objIndices.data(),
+                          objIndices.size() * sizeof(uint32_t)) == 0,
+          "Mapped cache matches ObjLoader output exactly");
+  }
+
+  // 5) ソースが変わったら古いキャッシュは使わない。ソースがなければ使う
+  {
+    WriteGridObj(source, 16, 0.75f);
+    core::MappedFile file;
+    CHECK(!graphics::OpenMeshCache(source, file, view) && !file.IsOpen(),
+          "A changed source invalidates the cache");
+    std::vector<Vertex> v;
+    std::vector<uint32_t> i;
+    std::vector<Submesh> s;
+    CHECK(graphics::ConvertMeshToCache(source, loader, v, i, s) &&
+              graphics::OpenMeshCache(source, file, view),
+          "Reconverting replaces the stale cache");
+    file.Close();
+
+    // LOD 付きで変換すると、LOD の範囲とインデックスがキャッシュに入る
+    std::vector<graphics::MeshLod> lods;
+    CHECK(graphics::ConvertMeshToCache(source, loader, v, i, s, nullptr,
+                                       nullptr, &lods) &&
+              lods.size() > 1 && lods[0].indexCount == objIndices.size() &&
+              s.size() == 1 && s[0].indexCount == objIndices.size() &&
+              graphics::OpenMeshCache(source, file, view) &&
+              view.GetLodCount() == lods.size() &&
+              view.GetIndexCount() == i.size() &&
+              view.Lods()[1].indexCount == lods[1].indexCount,
+          "Conversion can append LODs to the cache");
+    file.Close();
+
+    std::filesystem::remove(source);
+    CHECK(graphics::OpenMeshCache(source, file, view) &&
+              view.Lods()[0].indexCount == objIndices.size(),
+          "A cache without its source is used as shipped");
+    file.Close();
+
+    std::vector<Vertex> none;
+    CHECK(!graphics::ConvertMeshToCache(source, loader, none, i, s),
+          "Conversion fails when the loader fails");
+  }
+  std::filesystem::remove_all(dir);
+
+  std::cout << "All mesh cache tests passed!\n";
+  return 0;
+}
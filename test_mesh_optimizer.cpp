@@ -0,0 +1,250 @@
+#include "src/graphics/MeshOptimizer.h"
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using graphics::Submesh;
+using graphics::Vertex;
+
+namespace {
+
+/// n x n マスの格子。三角形の順序は乱数で崩す
+void MakeGrid(int n, unsigned seed, std::vector<Vertex> &vertices,
+              std::vector<uint32_t> &indices) {
+  vertices.clear();
+  indices.clear();
+  for (int y = 0; y <= n; ++y) {
+    for (int x = 0; x <= n; ++x) {
+      Vertex v{};
+      v.position = {static_cast<float>(x), 0.1f * ((x * 3 + y) % 5),
+                    static_cast<float>(y)};
+      v.normal = {0.0f, 1.0f, 0.0f};
+      v.texCoord = {static_cast<float>(x) / n, static_cast<float>(y) / n};
+      v.color = {1.0f, 1.0f, 1.0f, 1.0f};
+      vertices.push_back(v);
+    }
+  }
+  std::vector<std::array<uint32_t, 3>> triangles;
+  const uint32_t row = n + 1;
+  for (int y = 0; y < n; ++y) {
+    for (int x = 0; x < n; ++x) {
+      const uint32_t a = y * row + x;
+      triangles.push_back({a, a + row, a + 1});
+      triangles.push_back({a + 1, a + row, a + row + 1});
+    }
+  }
+  std::mt19937 rng(seed);
+  std::shuffle(triangles.begin(), triangles.end(), rng);
+  for (const auto &t : triangles) {
+    indices.insert(indices.end(), t.begin(), t.end());
+  }
+}
+
+/// 頂点の中身で表した三角形（巡回は保ち、最小の頂点を先頭へ回す）
+using TriangleKey = std::array<std::array<float, 5>, 3>;
+
+std::vector<TriangleKey> Triangles(const std::vector<Vertex> &vertices,
+                                   const std::vector<uint32_t> &indices,
+                                   size_t begin, size_t end) {
+  std::vector<TriangleKey> out;
+  for (size_t i = begin; i + 2 < end; i += 3) {
+    TriangleKey key;
+    for (int c = 0; c < 3; ++c) {
+      const Vertex &v = vertices[indices[i + c]];
+      key[c] = {v.position.x, v.position.y, v.position.z, v.texCoord.x,
+                v.texCoord.y};
+    }
+    const auto smallest = std::min_element(key.begin(), key.end());
+    std::rotate(key.begin(), smallest, key.end());
+    out.push_back(key);
+  }
+  std::sort(out.begin(), out.end());
+  return out;
+}
+
+} // namespace
+
+int main() {
+  // 1) 解析: 1 三角形は 3 回の変換、共有頂点はキャッシュに当たる
+  {
+    const std::vector<uint32_t> quad = {0, 1, 2, 2, 1, 3};
+    const graphics::VertexCacheStats stats =
+        graphics::AnalyzeVertexCache(quad, 4);
+    CHECK(stats.transforms == 4 && stats.triangles == 2 &&
+              stats.vertices == 4 && stats.acmr == 2.0f &&
+              stats.atvr == 1.0f,
+          "ACMR / ATVR count shared vertices once");
+    const graphics::VertexCacheStats tiny =
+        graphics::AnalyzeVertexCache({0, 1, 2, 3, 4, 5, 0, 1, 2}, 6, 3);
+    CHECK(tiny.transforms == 9, "Evicted vertices are transformed again");
+  }
+
+  // 2) 頂点キャッシュ: 三角形の集合と向きを保ったまま ACMR を下げる
+  std::vector<Vertex> vertices;
+  std::vector<uint32_t> indices;
+  MakeGrid(64, 1, vertices, indices);
+  const auto original = Triangles(vertices, indices, 0, indices.size());
+  const float before =
+      graphics::AnalyzeVertexCache(indices, vertices.size()).acmr;
+  std::vector<uint32_t> clusters;
+  graphics::OptimizeVertexCache(indices, vertices.size(),
+                                graphics::kVertexCacheSize, &clusters);
+  const float after =
+      graphics::AnalyzeVertexCache(indices, vertices.size()).acmr;
+  CHECK(Triangles(vertices, indices, 0, indices.size()) == original,
+        "Vertex cache reordering keeps every triangle and its winding");
+  CHECK(before > 2.0f && after < 0.8f,
+        "Vertex cache reordering brings a shuffled grid near 0.5 ACMR");
+  CHECK(!clusters.empty() && clusters.front() == 0 &&
+            std::is_sorted(clusters.begin(), clusters.end()) &&
+            clusters.back() < indices.size() / 3,
+        "Cluster starts are sorted triangle numbers");
+
+  // 3) オーバードロー: クラスタ単位で入れ替えても三角形は同じ
+  {
+    std::vector<uint32_t> reordered = indices;
+    graphics::OptimizeOverdraw(reordered, vertices, clusters, 1.05f);
+    CHECK(Triangles(vertices, reordered, 0, reordered.size()) == original,
+          "Overdraw ordering keeps every triangle and its winding");
+    CHECK(graphics::AnalyzeVertexCache(reordered, vertices.size()).acmr <=
+              after * 1.05f + 0.05f,
+          "Overdraw ordering stays within the ACMR threshold");
+
+    // 箱の内側を向いた面（奥の面）は外向きの面より後に描く
+    std::vector<Vertex> box(8);
+    for (int i = 0; i < 8; ++i) {
+      box[i].position = {i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f,
+                         i & 4 ? 1.0f : -1.0f};
+    }
+    // 外向きの +X 面と、反対側で内側（+X）を向いた -X 側の面
+    std::vector<uint32_t> boxIndices = {0, 2, 4, 1, 3, 5};
+    graphics::OptimizeOverdraw(boxIndices, box, {0, 1}, 1.05f);
+    CHECK(boxIndices[0] == 1, "Outward-facing clusters are drawn first");
+  }
+
+  // 4) 重複除去と頂点フェッチ
+  {
+    std::vector<Vertex> v(5);
+    for (int i = 0; i < 5; ++i) {
+      v[i].position = {static_cast<float>(i), 0.0f, 0.0f};
+    }
+    v[3] = v[1]; // 1 と 3 は同じ
+    std::vector<uint32_t> idx = {4, 3, 0, 0, 1, 4};
+    CHECK(graphics::RemoveDuplicateVertices(v, idx) == 1 && v.size() == 4 &&
+              idx[1] == idx[4] && v[idx[1]].position.x == 1.0f,
+          "Bitwise duplicates are merged");
+
+    v.push_back(Vertex{}); // 使われない頂点
+    graphics::OptimizeVertexFetch(v, idx);
+    CHECK(v.size() == 3 && idx == std::vector<uint32_t>({0, 1, 2, 2, 1, 0}) &&
+              v[0].position.x == 4.0f && v[2].position.x == 0.0f,
+          "Vertices follow first use and unused ones are dropped");
+  }
+  {
+    std::vector<uint32_t> shuffled;
+    std::vector<Vertex> grid;
+    MakeGrid(64, 2, grid, shuffled);
+    graphics::OptimizeVertexCache(shuffled, grid.size());
+    const float fetchBefore =
+        graphics::AnalyzeVertexFetch(shuffled, grid.size(), sizeof(Vertex))
+            .overfetch;
+    std::vector<Vertex> scrambled(grid.size());
+    std::vector<uint32_t> permutation(grid.size());
+    for (uint32_t i = 0; i < permutation.size(); ++i) {
+      permutation[i] = i;
+    }
+    std::shuffle(permutation.begin(), permutation.end(), std::mt19937(3));
+    for (size_t i = 0; i < grid.size(); ++i) {
+      scrambled[permutation[i]] = grid[i];
+    }
+    for (uint32_t &index : shuffled) {
+      index = permutation[index];
+    }
+    const float scrambledFetch =
+        graphics::AnalyzeVertexFetch(shuffled, grid.size(), sizeof(Vertex))
+            .overfetch;
+    graphics::OptimizeVertexFetch(scrambled, shuffled);
+    const float fetchAfter =
+        graphics::AnalyzeVertexFetch(shuffled, scrambled.size(),
+                                     sizeof(Vertex))
+            .overfetch;
+    // 行順の元の並びと同程度まで戻る
+    CHECK(scrambledFetch > fetchAfter * 1.5f &&
+              fetchAfter <= fetchBefore * 1.1f && fetchAfter < 1.3f,
+          "Fetch reordering removes overfetch from scrambled vertices");
+  }
+
+  // 5) まとめて: サブメッシュの中だけで並べ替え、頂点範囲を付け直す
+  {
+    std::vector<Vertex> a, b;
+    std::vector<uint32_t> ai, bi;
+    MakeGrid(16, 4, a, ai);
+    MakeGrid(8, 5, b, bi);
+    for (Vertex &v : b) {
+      v.position.y += 10.0f;
+    }
+    std::vector<Vertex> merged = a;
+    merged.insert(merged.end(), b.begin(), b.end());
+    merged.insert(merged.end(), a.begin(), a.begin() + 10); // 重複
+    std::vector<uint32_t> mergedIndices = ai;
+    for (uint32_t index : bi) {
+      mergedIndices.push_back(index + static_cast<uint32_t>(a.size()));
+    }
+    std::vector<Submesh> parts = {
+        {0, static_cast<uint32_t>(ai.size()), 0,
+         static_cast<uint32_t>(a.size())},
+        {static_cast<uint32_t>(ai.size()), static_cast<uint32_t>(bi.size()),
+         static_cast<uint32_t>(a.size()), static_cast<uint32_t>(b.size())}};
+    const auto firstBefore =
+        Triangles(merged, mergedIndices, 0, ai.size());
+    const auto secondBefore = Triangles(merged, mergedIndices, ai.size(),
+                                        mergedIndices.size());
+    const float acmrBefore =
+        graphics::AnalyzeVertexCache(mergedIndices, merged.size()).acmr;
+
+    graphics::OptimizeMesh(merged, mergedIndices, &parts);
+    CHECK(merged.size() == a.size() + b.size(),
+          "Duplicates and unused vertices are removed");
+    CHECK(Triangles(merged, mergedIndices, 0, ai.size()) == firstBefore &&
+              Triangles(merged, mergedIndices, ai.size(),
+                        mergedIndices.size()) == secondBefore,
+          "Triangles stay inside their submesh");
+    bool rangesCover = true;
+    for (const Submesh &part : parts) {
+      for (uint32_t i = 0; i < part.indexCount; ++i) {
+        const uint32_t index = mergedIndices[part.indexOffset + i];
+        rangesCover &= index >= part.vertexOffset &&
+                       index < part.vertexOffset + part.vertexCount;
+      }
+    }
+    CHECK(rangesCover && parts[0].vertexOffset == 0 &&
+              parts[1].vertexOffset == a.size(),
+          "Submesh vertex ranges are rebuilt");
+    CHECK(graphics::AnalyzeVertexCache(mergedIndices, merged.size()).acmr <
+              acmrBefore * 0.5f,
+          "OptimizeMesh improves ACMR");
+
+    std::vector<uint32_t> broken = {0, 1, 99};
+    std::vector<Vertex> small(3);
+    graphics::OptimizeMesh(small, broken);
+    CHECK(broken[2] == 99 && small.size() == 3,
+          "Out-of-range indices leave the mesh untouched");
+  }
+
+  std::cout << "All mesh optimizer tests passed!\n";
+  return 0;
+}
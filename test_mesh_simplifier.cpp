@@ -0,0 +1,245 @@
+#include "src/graphics/MeshSimplifier.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using graphics::MeshLod;
+using graphics::Vertex;
+
+namespace {
+
+/// MeshPrimitives::CreateSphere と同じ並び（u = 0 と 1 の列が継ぎ目）
+void MakeSphere(int segments, std::vector<Vertex> &vertices,
+                std::vector<uint32_t> &indices) {
+  const float pi = 3.14159265358979f;
+  const float r = 1.0f / (segments - 1);
+  for (int ring = 0; ring < segments; ++ring) {
+    for (int s = 0; s < segments; ++s) {
+      const float y = std::sin(-pi * 0.5f + pi * ring * r);
+      const float x = std::cos(2 * pi * s * r) * std::sin(pi * ring * r);
+      const float z = std::sin(2 * pi * s * r) * std::sin(pi * ring * r);
+      Vertex v{};
+      v.position = {x * 0.5f, y * 0.5f, z * 0.5f};
+      v.normal = {x, y, z};
+      v.texCoord = {s * r, ring * r};
+      v.color = {1, 1, 1, 1};
+      vertices.push_back(v);
+    }
+  }
+  // 継ぎ目の列は位置をそろえる（浮動小数の誤差で割れないように）
+  for (int ring = 0; ring < segments; ++ring) {
+    const int row = ring * segments;
+    vertices[row + segments - 1].position = vertices[row].position;
+  }
+  for (int ring = 0; ring < segments - 1; ++ring) {
+    for (int s = 0; s < segments - 1; ++s) {
+      const uint32_t current = ring * segments + s;
+      const uint32_t next = current + segments;
+      indices.insert(indices.end(), {current, next, current + 1,
+                                     current + 1, next, next + 1});
+    }
+  }
+}
+
+/// n x n マスの平らな格子（縁が開いている）
+void MakeGrid(int n, std::vector<Vertex> &vertices,
+              std::vector<uint32_t> &indices) {
+  for (int y = 0; y <= n; ++y) {
+    for (int x = 0; x <= n; ++x) {
+      Vertex v{};
+      v.position = {static_cast<float>(x), 0.0f, static_cast<float>(y)};
+      v.normal = {0, 1, 0};
+      v.texCoord = {static_cast<float>(x) / n, static_cast<float>(y) / n};
+      vertices.push_back(v);
+    }
+  }
+  const uint32_t row = n + 1;
+  for (int y = 0; y < n; ++y) {
+    for (int x = 0; x < n; ++x) {
+      const uint32_t a = y * row + x;
+      indices.insert(indices.end(),
+                     {a, a + row, a + 1, a + 1, a + row, a + row + 1});
+    }
+  }
+}
+
+/// UV 上で裏返った三角形の数（継ぎ目をまたぐと UV が折り返して裏返る）
+size_t CountUvFlips(const std::vector<Vertex> &vertices,
+                    const uint32_t *indices, size_t count) {
+  size_t positive = 0, negative = 0;
+  for (size_t i = 0; i + 2 < count; i += 3) {
+    const auto &a = vertices[indices[i]].texCoord;
+    const auto &b = vertices[indices[i + 1]].texCoord;
+    const auto &c = vertices[indices[i + 2]].texCoord;
+    const float area =
+        (b.x - a.x) * (c.y - a.y) - (b.y - a.y) * (c.x - a.x);
+    positive += area > 1e-9f ? 1 : 0;
+    negative += area < -1e-9f ? 1 : 0;
+  }
+  return std::min(positive, negative);
+}
+
+/// y 上向きの平面上の面積（裏返った三角形は負）
+float SignedArea(const std::vector<Vertex> &vertices,
+                 const std::vector<uint32_t> &indices) {
+  float area = 0.0f;
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    const auto &a = vertices[indices[i]].position;
+    const auto &b = vertices[indices[i + 1]].position;
+    const auto &c = vertices[indices[i + 2]].position;
+    // 格子の巻き順では (b - a) x (c - a) の y が正 = 表
+    area += 0.5f * ((b.z - a.z) * (c.x - a.x) - (b.x - a.x) * (c.z - a.z));
+  }
+  return area;
+}
+
+} // namespace
+
+int main() {
+  // 1) 球: 減らしても継ぎ目をまたぐ三角形を作らない
+  std::vector<Vertex> sphere;
+  std::vector<uint32_t> sphereIndices;
+  MakeSphere(32, sphere, sphereIndices);
+  {
+    std::vector<uint32_t> lod;
+    float error = 0.0f;
+    const size_t target = sphereIndices.size() / 4;
+    graphics::SimplifyMesh(sphere, sphereIndices, target, 0.05f, lod,
+                           &error);
+    CHECK(lod.size() % 3 == 0 && lod.size() <= target + 6 && !lod.empty(),
+          "Sphere is reduced to about a quarter of its triangles");
+    CHECK(error > 0.0f && error < 0.05f, "Reported error stays in budget");
+    CHECK(std::all_of(lod.begin(), lod.end(),
+                      [&](uint32_t i) { return i < sphere.size(); }),
+          "Simplified indices reference the original vertices");
+    CHECK(CountUvFlips(sphere, lod.data(), lod.size()) == 0,
+          "No triangle crosses the UV seam");
+    // 頂点は動かないので、残った頂点は元の球面上（半径 0.5）
+    float farthest = 0.0f;
+    for (size_t i = 0; i + 2 < lod.size(); i += 3) {
+      float c[3] = {0, 0, 0};
+      for (int k = 0; k < 3; ++k) {
+        const auto &p = sphere[lod[i + k]].position;
+        c[0] += p.x / 3, c[1] += p.y / 3, c[2] += p.z / 3;
+      }
+      const float d = std::sqrt(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]);
+      farthest = std::max(farthest, 0.5f - d);
+    }
+    CHECK(farthest < 0.05f, "Triangle centers stay close to the surface");
+
+    std::vector<uint32_t> strict;
+    graphics::SimplifyMesh(sphere, sphereIndices, 0, 1e-4f, strict);
+    CHECK(strict.size() > lod.size(), "A tighter error budget keeps more");
+  }
+
+  // 2) 平らな格子: 縁の形（面積）を保ったまま大きく減らせる
+  {
+    std::vector<Vertex> grid;
+    std::vector<uint32_t> gridIndices;
+    MakeGrid(32, grid, gridIndices);
+    std::vector<uint32_t> lod;
+    float error = 1.0f;
+    graphics::SimplifyMesh(grid, gridIndices, 0, 0.01f, lod, &error);
+    CHECK(lod.size() < gridIndices.size() / 10 && error < 1e-4f,
+          "A flat grid collapses almost completely at zero error");
+    CHECK(std::fabs(SignedArea(grid, lod) - 32.0f * 32.0f) < 1e-2f,
+          "Open borders keep their outline and no triangle flips");
+  }
+
+  // 3) 角ごとに法線が違う立方体は、どの頂点も継ぎ目の交点なので減らさない
+  {
+    std::vector<Vertex> cube(24);
+    std::vector<uint32_t> cubeIndices;
+    const int axes[6][3] = {{0, 1, 2}, {0, 1, 2}, {1, 2, 0},
+                            {1, 2, 0}, {2, 0, 1}, {2, 0, 1}};
+    for (int face = 0; face < 6; ++face) {
+      const float side = face % 2 ? 1.0f : -1.0f;
+      for (int k = 0; k < 4; ++k) {
+        float p[3];
+        p[axes[face][2]] = side;
+        p[axes[face][0]] = k & 1 ? 1.0f : -1.0f;
+        p[axes[face][1]] = k & 2 ? 1.0f : -1.0f;
+        cube[face * 4 + k].position = {p[0], p[1], p[2]};
+      }
+      const uint32_t b = face * 4;
+      if (side > 0) {
+        cubeIndices.insert(cubeIndices.end(),
+                           {b, b + 1, b + 2, b + 2, b + 1, b + 3});
+      } else {
+        cubeIndices.insert(cubeIndices.end(),
+                           {b, b + 2, b + 1, b + 1, b + 2, b + 3});
+      }
+    }
+    std::vector<uint32_t> lod;
+    graphics::SimplifyMesh(cube, cubeIndices, 0, 1.0f, lod);
+    CHECK(lod.size() == cubeIndices.size(), "Hard-edged corners are locked");
+
+    std::vector<uint32_t> broken = {0, 1, 99};
+    graphics::SimplifyMesh(cube, broken, 0, 1.0f, lod);
+    CHECK(lod == broken, "Out-of-range indices are returned unchanged");
+  }
+
+  // 4) LOD の列: 同じインデックスバッファの後ろに粗い段が並ぶ
+  {
+    std::vector<uint32_t> indices = sphereIndices;
+    const std::vector<MeshLod> lods =
+        graphics::BuildMeshLods(sphere, indices);
+    CHECK(lods.size() >= 3 && lods[0].indexOffset == 0 &&
+              lods[0].indexCount == sphereIndices.size() &&
+              lods[0].error == 0.0f,
+          "LOD0 is the original index range");
+    bool chained = true;
+    for (size_t i = 1; i < lods.size(); ++i) {
+      chained &= lods[i].indexOffset ==
+                     lods[i - 1].indexOffset + lods[i - 1].indexCount &&
+                 lods[i].indexCount < lods[i - 1].indexCount &&
+                 lods[i].error >= lods[i - 1].error &&
+                 CountUvFlips(sphere, indices.data() + lods[i].indexOffset,
+                              lods[i].indexCount) == 0;
+    }
+    CHECK(chained && indices.size() == lods.back().indexOffset +
+                                           lods.back().indexCount,
+          "Coarser levels follow with growing error and fewer triangles");
+    CHECK(std::equal(sphereIndices.begin(), sphereIndices.end(),
+                     indices.begin()),
+          "LOD0 indices are untouched");
+  }
+
+  // 5) 画面上の大きさで選ぶ
+  {
+    const std::vector<MeshLod> lods = {
+        {0, 300, 0.0f}, {300, 150, 0.01f}, {450, 60, 0.04f}};
+    CHECK(graphics::SelectMeshLod(lods.data(), lods.size(), 1000.0f) == 0 &&
+              graphics::SelectMeshLod(lods.data(), lods.size(), 100.0f) ==
+                  1 &&
+              graphics::SelectMeshLod(lods.data(), lods.size(), 20.0f) == 2,
+          "Smaller on screen selects coarser levels");
+    CHECK(graphics::SelectMeshLod(lods.data(), lods.size(), 100.0f, 4.0f) ==
+              2,
+          "A looser pixel error selects coarser levels sooner");
+    // 縦の画角 90 度・高さ 720 で、距離 10 の 1m は 36 ピクセル
+    const float scaleY = 1.0f / std::tan(3.14159265f / 4.0f);
+    CHECK(std::fabs(graphics::ProjectedSizePixels(1.0f, 10.0f, scaleY,
+                                                  720.0f) -
+                    36.0f) < 1e-3f,
+          "Projected size uses half the viewport per unit NDC");
+    CHECK(graphics::ProjectedSizePixels(1.0f, 0.0f, scaleY, 720.0f) >
+              1e30f,
+          "Objects at the camera use the finest level");
+  }
+
+  std::cout << "All mesh simplifier tests passed!\n";
+  return 0;
+}
@@ -0,0 +1,227 @@
+#include "src/core/ThreadPool.h"
+#include "src/graphics/MipChain.h"
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using graphics::MipChainSettings;
+using graphics::MipFilter;
+using graphics::MipLevel;
+
+static std::vector<uint8_t> RandomImage(uint32_t w, uint32_t h,
+                                        unsigned seed) {
+  std::mt19937 rng(seed);
+  std::vector<uint8_t> image(static_cast<size_t>(w) * h * 4);
+  for (uint8_t &v : image) {
+    v = static_cast<uint8_t>(rng());
+  }
+  return image;
+}
+
+static std::vector<uint8_t> SolidImage(uint32_t w, uint32_t h,
+                                       const uint8_t rgba[4]) {
+  std::vector<uint8_t> image(static_cast<size_t>(w) * h * 4);
+  for (size_t i = 0; i < image.size(); ++i) {
+    image[i] = rgba[i % 4];
+  }
+  return image;
+}
+
+static bool AllPixels(const MipLevel &level, const uint8_t rgba[4]) {
+  for (size_t i = 0; i < level.pixels.size(); ++i) {
+    if (level.pixels[i] != rgba[i % 4]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+int main() {
+  // 1) 段数と大きさ
+  {
+    CHECK(graphics::CountMipLevels(1, 1) == 1 &&
+              graphics::CountMipLevels(256, 256) == 9 &&
+              graphics::CountMipLevels(3000, 700) == 12,
+          "Level count follows the longer side");
+
+    const std::vector<uint8_t> image = RandomImage(37, 10, 1);
+    std::vector<MipLevel> levels;
+    graphics::GenerateMipChain(image.data(), 37, 10, 37 * 4, {}, levels);
+    bool sizes = levels.size() == 5;
+    uint32_t w = 37, h = 10;
+    for (const MipLevel &level : levels) {
+      w = std::max(w / 2, 1u);
+      h = std::max(h / 2, 1u);
+      sizes &= level.width == w && level.height == h &&
+               level.pixels.size() == static_cast<size_t>(w) * h * 4;
+    }
+    CHECK(sizes && levels.back().width == 1 && levels.back().height == 1,
+          "Each level halves with floor down to 1x1");
+
+    MipChainSettings capped;
+    capped.maxLevels = 3;
+    graphics::GenerateMipChain(image.data(), 37, 10, 37 * 4, capped, levels);
+    CHECK(levels.size() == 2, "maxLevels counts level 0");
+  }
+
+  // 2) Box は 2x2 の平均（四捨五入）
+  {
+    const uint8_t image[] = {
+        10, 20, 30, 255, 11, 21, 31, 255, //
+        12, 22, 32, 0,   13, 23, 33, 0,   //
+    };
+    MipLevel level;
+    graphics::DownsampleMip(image, 2, 2, 8, level, {});
+    CHECK(level.width == 1 && level.height == 1 && level.pixels[0] == 12 &&
+              level.pixels[1] == 22 && level.pixels[2] == 32 &&
+              level.pixels[3] == 128,
+          "Box averages 2x2 with rounding");
+
+    // SSE2 で処理する幅とはみ出しの列がスカラー計算と一致する
+    const std::vector<uint8_t> random = RandomImage(67, 9, 2);
+    graphics::DownsampleMip(random.data(), 67, 9, 67 * 4, level, {});
+    bool exact = true;
+    for (uint32_t y = 0; y < level.height; ++y) {
+      for (uint32_t x = 0; x < level.width; ++x) {
+        for (int c = 0; c < 4; ++c) {
+          auto at = [&](uint32_t sx, uint32_t sy) {
+            return static_cast<uint32_t>(random[(sy * 67 + sx) * 4 + c]);
+          };
+          const uint32_t expected = (at(2 * x, 2 * y) + at(2 * x + 1, 2 * y) +
+                                     at(2 * x, 2 * y + 1) +
+                                     at(2 * x + 1, 2 * y + 1) + 2) /
+                                    4;
+          exact &= level.pixels[(y * level.width + x) * 4 + c] == expected;
+        }
+      }
+    }
+    CHECK(exact, "Box matches the reference on odd widths");
+  }
+
+  // 3) sRGB は線形で平均する（黒と白の平均は 188。単純平均なら 128）
+  {
+    const uint8_t image[] = {
+        0, 0, 0, 255, 255, 255, 255, 255, //
+        0, 0, 0, 255, 255, 255, 255, 255, //
+    };
+    MipChainSettings srgb;
+    srgb.srgb = true;
+    MipLevel level;
+    graphics::DownsampleMip(image, 2, 2, 8, level, srgb);
+    CHECK(level.pixels[0] == 188 && level.pixels[2] == 188 &&
+              level.pixels[3] == 255,
+          "sRGB filtering averages in linear light");
+  }
+
+  // 4) 一様な画像は全フィルタで変わらない（Kaiser の重みは和が 1）
+  {
+    const uint8_t rgba[4] = {200, 90, 17, 128};
+    const std::vector<uint8_t> image = SolidImage(41, 23, rgba);
+    bool unchanged = true;
+    for (MipFilter filter : {MipFilter::Box, MipFilter::Kaiser}) {
+      for (bool srgb : {false, true}) {
+        MipChainSettings settings;
+        settings.filter = filter;
+        settings.srgb = srgb;
+        std::vector<MipLevel> levels;
+        graphics::GenerateMipChain(image.data(), 41, 23, 41 * 4, settings,
+                                   levels);
+        for (const MipLevel &level : levels) {
+          unchanged &= AllPixels(level, rgba);
+        }
+      }
+    }
+    CHECK(unchanged, "Solid images stay solid under every filter");
+  }
+
+  // 5) Kaiser は負の裾で振れても 0..255 に収まり、縞を残さない
+  {
+    std::vector<uint8_t> image(64 * 64 * 4);
+    for (uint32_t y = 0; y < 64; ++y) {
+      for (uint32_t x = 0; x < 64; ++x) {
+        const uint8_t v = (x / 2) % 2 ? 255 : 0; // 2 画素幅の縞
+        for (int c = 0; c < 4; ++c) {
+          image[(y * 64 + x) * 4 + c] = c == 3 ? 255 : v;
+        }
+      }
+    }
+    MipChainSettings kaiser;
+    kaiser.filter = MipFilter::Kaiser;
+    std::vector<MipLevel> levels;
+    graphics::GenerateMipChain(image.data(), 64, 64, 64 * 4, kaiser, levels);
+    // 縞の周期 4 は 1 段目で 2（ナイキスト）、2 段目で消える
+    const MipLevel &second = levels[1];
+    int minV = 255, maxV = 0;
+    for (uint32_t x = 2; x + 2 < second.width; ++x) {
+      const int v = second.pixels[(8 * second.width + x) * 4];
+      minV = std::min(minV, v);
+      maxV = std::max(maxV, v);
+    }
+    CHECK(maxV - minV <= 8 && std::abs((minV + maxV) / 2 - 128) <= 8,
+          "Kaiser removes stripes above the new Nyquist rate");
+  }
+
+  // 6) タイル: 偶数境界に揃った Box のミップは全体のミップの一部と一致
+  {
+    const uint32_t w = 128, h = 96;
+    const std::vector<uint8_t> image = RandomImage(w, h, 3);
+    std::vector<MipLevel> full, tile;
+    graphics::GenerateMipChain(image.data(), w, h, w * 4, {}, full);
+    const uint32_t tx = 32, ty = 64, ts = 32;
+    graphics::GenerateMipChain(image.data() + (ty * w + tx) * 4, ts, ts, w * 4,
+                               {}, tile);
+    bool match = tile.size() == 5;
+    for (size_t l = 0; l < tile.size() && match; ++l) {
+      const uint32_t shift = static_cast<uint32_t>(l + 1);
+      for (uint32_t y = 0; y < tile[l].height; ++y) {
+        for (uint32_t x = 0; x < tile[l].width; ++x) {
+          const size_t fi =
+              (((ty >> shift) + y) * full[l].width + (tx >> shift) + x) * 4;
+          const size_t ti = (y * tile[l].width + x) * 4;
+          for (int c = 0; c < 4; ++c) {
+            match &= tile[l].pixels[ti + c] == full[l].pixels[fi + c];
+          }
+        }
+      }
+    }
+    CHECK(match, "Aligned tile mips match the full-image mips");
+  }
+
+  // 7) スレッド数によらず同じ結果
+  {
+    core::ThreadPool pool(3);
+    const std::vector<uint8_t> image = RandomImage(300, 257, 4);
+    bool same = true;
+    for (MipFilter filter : {MipFilter::Box, MipFilter::Kaiser}) {
+      for (bool srgb : {false, true}) {
+        MipChainSettings settings;
+        settings.filter = filter;
+        settings.srgb = srgb;
+        std::vector<MipLevel> serial, parallel;
+        graphics::GenerateMipChain(image.data(), 300, 257, 300 * 4, settings,
+                                   serial);
+        graphics::GenerateMipChain(image.data(), 300, 257, 300 * 4, settings,
+                                   parallel, &pool);
+        for (size_t l = 0; l < serial.size(); ++l) {
+          same &= serial[l].pixels == parallel[l].pixels;
+        }
+      }
+    }
+    CHECK(same, "Thread pool output is bit-identical to single thread");
+  }
+
+  std::cout << "All mip chain tests passed!\n";
+  return 0;
+}
@@ -0,0 +1,204 @@
+#include "src/core/Noise.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+namespace noise = core::noise;
+
+// 旧 SkyboxTextureGenerator の実装（互換性確認用）
+static float LegacyHash(int a, int b, int c) {
+  int n = a * 374761393 + b * 668265263 + c;
+  n = (n ^ (n >> 13)) * 1274126177;
+  return static_cast<float>((n ^ (n >> 16)) & 0x7FFFFFFF) / 2147483647.0f;
+}
+
+static float LegacyNoise(float x, float y, float z) {
+  int xi = static_cast<int>(std::floor(x));
+  int yi = static_cast<int>(std::floor(y));
+  int zi = static_cast<int>(std::floor(z));
+  float xf = x - xi;
+  float yf = y - yi;
+  float zf = z - zi;
+  float u = xf * xf * (3.0f - 2.0f * xf);
+  float v = yf * yf * (3.0f - 2.0f * yf);
+  float w = zf * zf * (3.0f - 2.0f * zf);
+  float c00 = LegacyHash(xi, yi, zi) * (1 - u) + LegacyHash(xi + 1, yi, zi) * u;
+  float c10 =
+      LegacyHash(xi, yi + 1, zi) * (1 - u) + LegacyHash(xi + 1, yi + 1, zi) * u;
+  float c01 =
+      LegacyHash(xi, yi, zi + 1) * (1 - u) + LegacyHash(xi + 1, yi, zi + 1) * u;
+  float c11 = LegacyHash(xi, yi + 1, zi + 1) * (1 - u) +
+              LegacyHash(xi + 1, yi + 1, zi + 1) * u;
+  float c0 = c00 * (1 - v) + c10 * v;
+  float c1 = c01 * (1 - v) + c11 * v;
+  return c0 * (1 - w) + c1 * w;
+}
+
+static float LegacyFBM(float x, float y, float z, int octaves) {
+  float value = 0.0f, amplitude = 1.0f, frequency = 1.0f, maxValue = 0.0f;
+  for (int i = 0; i < octaves; ++i) {
+    value +=
+        LegacyNoise(x * frequency, y * frequency, z * frequency) * amplitude;
+    maxValue += amplitude;
+    amplitude *= 0.5f;
+    frequency *= 2.0f;
+  }
+  return value / maxValue;
+}
+
+static float LegacyWorley(float x, float y, float z) {
+  int xi = static_cast<int>(std::floor(x));
+  int yi = static_cast<int>(std::floor(y));
+  int zi = static_cast<int>(std::floor(z));
+  float minDist = 10.0f;
+  for (int dx = -1; dx <= 1; ++dx) {
+    for (int dy = -1; dy <= 1; ++dy) {
+      for (int dz = -1; dz <= 1; ++dz) {
+        int cx = xi + dx, cy = yi + dy, cz = zi + dz;
+        float px = cx + LegacyHash(cx, cy, cz);
+        float py = cy + LegacyHash(cx + 1, cy, cz);
+        float pz = cz + LegacyHash(cx, cy + 1, cz);
+        float dist = std::sqrt((x - px) * (x - px) + (y - py) * (y - py) +
+                               (z - pz) * (z - pz));
+        minDist = std::min(minDist, dist);
+      }
+    }
+  }
+  return minDist;
+}
+
+template <typename Fn> static bool ForAll(const std::vector<float> &v, Fn fn) {
+  return std::all_of(v.begin(), v.end(), fn);
+}
+
+int main() {
+  // スカイボックスの方向ベクトル相当の座標（負数・整数境界を含む）
+  const size_t count = 4099; // 4 の倍数 + 端数
+  std::vector<float> xs(count), ys(count), zs(count);
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> dist(-20.0f, 20.0f);
+  for (size_t i = 0; i < count; ++i) {
+    xs[i] = dist(rng);
+    ys[i] = dist(rng);
+    zs[i] = (i % 97 == 0) ? std::floor(dist(rng)) : dist(rng);
+  }
+
+  // 1) 従来のスカイボックス関数とビット単位で一致する
+  {
+    bool value = true, fbm = true, worley = true;
+    noise::FractalSettings fbmSettings;
+    fbmSettings.basis = noise::Basis::Value;
+    fbmSettings.octaves = 5;
+    for (size_t i = 0; i < count; ++i) {
+      value = value &&
+              noise::Value3(xs[i], ys[i], zs[i]) ==
+                  LegacyNoise(xs[i], ys[i], zs[i]);
+      fbm = fbm && noise::Fbm3(xs[i], ys[i], zs[i], fbmSettings) ==
+                       LegacyFBM(xs[i], ys[i], zs[i], 5);
+      worley = worley && noise::Worley3(xs[i], ys[i], zs[i]) ==
+                             LegacyWorley(xs[i], ys[i], zs[i]);
+    }
+    CHECK(value, "Value3 matches the legacy skybox noise");
+    CHECK(fbm, "Value FBM matches the legacy skybox FBM");
+    CHECK(worley, "Worley3 matches the legacy skybox Worley noise");
+  }
+
+  // 2) バッチ版（SIMD）とスカラー版が一致する
+  {
+    std::vector<float> out(count);
+    auto same = [&](auto scalar) {
+      for (size_t i = 0; i < count; ++i) {
+        const float expected = scalar(i);
+        if (std::memcmp(&out[i], &expected, sizeof(float)) != 0) {
+          return false;
+        }
+      }
+      return true;
+    };
+    const uint32_t seed = 7;
+    noise::FractalSettings settings;
+    settings.octaves = 4;
+
+    noise::Value3Batch(xs.data(), ys.data(), zs.data(), out.data(), count,
+                       seed);
+    CHECK(same([&](size_t i) {
+            return noise::Value3(xs[i], ys[i], zs[i], seed);
+          }),
+          "Value3Batch matches scalar");
+    noise::Perlin3Batch(xs.data(), ys.data(), zs.data(), out.data(), count,
+                        seed);
+    CHECK(same([&](size_t i) {
+            return noise::Perlin3(xs[i], ys[i], zs[i], seed);
+          }),
+          "Perlin3Batch matches scalar");
+    noise::Simplex2Batch(xs.data(), ys.data(), out.data(), count, seed);
+    CHECK(same([&](size_t i) { return noise::Simplex2(xs[i], ys[i], seed); }),
+          "Simplex2Batch matches scalar");
+    noise::Worley3Batch(xs.data(), ys.data(), zs.data(), out.data(), count,
+                        seed);
+    CHECK(same([&](size_t i) {
+            return noise::Worley3(xs[i], ys[i], zs[i], seed);
+          }),
+          "Worley3Batch matches scalar");
+    noise::Fbm3Batch(xs.data(), ys.data(), zs.data(), out.data(), count,
+                     settings, seed);
+    CHECK(same([&](size_t i) {
+            return noise::Fbm3(xs[i], ys[i], zs[i], settings, seed);
+          }),
+          "Fbm3Batch matches scalar");
+    noise::Ridged3Batch(xs.data(), ys.data(), zs.data(), out.data(), count,
+                        settings, seed);
+    CHECK(same([&](size_t i) {
+            return noise::Ridged3(xs[i], ys[i], zs[i], settings, seed);
+          }),
+          "Ridged3Batch matches scalar");
+
+    settings.basis = noise::Basis::Simplex;
+    noise::Fbm2Row(-3.0f, 1.25f, 0.01f, count, settings, seed, out.data());
+    CHECK(same([&](size_t i) {
+            return noise::Fbm3(-3.0f + static_cast<float>(i) * 0.01f, 1.25f,
+                               0.0f, settings, seed);
+          }),
+          "Fbm2Row matches scalar FBM along the row");
+  }
+
+  // 3) 値域とシードの効き
+  {
+    std::vector<float> perlin(count), simplex(count), ridged(count);
+    noise::Perlin3Batch(xs.data(), ys.data(), zs.data(), perlin.data(), count);
+    noise::Simplex2Batch(xs.data(), ys.data(), simplex.data(), count);
+    noise::FractalSettings settings;
+    noise::Ridged3Batch(xs.data(), ys.data(), zs.data(), ridged.data(), count,
+                        settings);
+    CHECK(ForAll(perlin, [](float v) { return std::fabs(v) <= 1.05f; }),
+          "Perlin3 stays within [-1, 1]");
+    CHECK(ForAll(simplex, [](float v) { return std::fabs(v) <= 1.05f; }),
+          "Simplex2 stays within [-1, 1]");
+    CHECK(ForAll(ridged, [](float v) { return v >= 0.0f && v <= 1.0f; }),
+          "Ridged3 stays within [0, 1]");
+    CHECK(noise::Perlin3(0.5f, 0.5f, 0.5f, 1) !=
+              noise::Perlin3(0.5f, 0.5f, 0.5f, 2),
+          "Different seeds give different noise");
+    CHECK(noise::Perlin3(3.0f, -2.0f, 5.0f) == 0.0f,
+          "Perlin3 is zero on lattice points");
+    CHECK(noise::SeedFromString("Tokyo") == noise::SeedFromString("Tokyo") &&
+              noise::SeedFromString("Tokyo") != noise::SeedFromString("Kyoto"),
+          "SeedFromString is stable and text dependent");
+  }
+
+  std::cout << "All noise tests passed!\n";
+  return 0;
+}
@@ -1,9 +1,12 @@
 #include "src/core/Logger.h"
+#include "src/core/ThreadPool.h"
 #include "src/graphics/ObjLoader.h"
 #include <cassert>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <random>
 
 
 // テスト用ユーティリティ
@@ -43,6 +46,67 @@ void CreateTestObj(const std::string &path) {
   file.close();
 }
 
+// 並列読み込みの境界をまたぐ大きさ（数 MB）の OBJ を作成
+// 多角形・負のインデックス・欠けた要素・CRLF・壊れた行を混ぜる
+void CreateLargeObj(const std::string &path, unsigned seed, bool brokenLines) {
+  std::ofstream file(path, std::ios::binary);
+  std::mt19937 rng(seed);
+  const char *eol = seed % 2 ? "\r\n" : "\n";
+  int positions = 0, texCoords = 0, normals = 0;
+  for (int line = 0; line < 300000; ++line) {
+    const unsigned r = rng() % 100;
+    if (r < 30 || positions == 0) {
+      file << "v " << rng() % 1000 * 0.1f << " " << rng() % 700 * 0.1f << " "
+           << static_cast<int>(rng() % 50) - 25 << eol;
+      ++positions;
+    } else if (r < 45) {
+      file << "vt " << rng() % 100 * 0.01f << " " << rng() % 100 * 0.01f
+           << eol;
+      ++texCoords;
+    } else if (r < 55) {
+      file << "vn 0 " << rng() % 3 << " 1" << eol;
+      ++normals;
+    } else if (r < 95) {
+      // 負数は末尾から、0 は要素なし
+      auto pick = [&](int count) {
+        if (count == 0)
+          return 0;
+        const int k = static_cast<int>(rng() % count);
+        return rng() % 5 == 0 ? -(k + 1) : k + 1;
+      };
+      const int corners = 3 + rng() % 3;
+      file << "f";
+      for (int c = 0; c < corners; ++c) {
+        file << " " << pick(positions);
+        const int vt = pick(texCoords);
+        const int vn = pick(normals);
+        if (vt != 0 || vn != 0) {
+          file << "/";
+          if (vt != 0)
+            file << vt;
+          if (vn != 0)
+            file << "/" << vn;
+        }
+      }
+      file << eol;
+    } else if (r < 97) {
+      file << "# comment f 1 2 3" << eol;
+    } else if (brokenLines && r < 98) {
+      file << "v 1 2" << eol; // 次の行の数値まで読む壊れた行
+    } else {
+      file << "usemtl material" << eol;
+    }
+  }
+}
+
+bool SameMesh(const std::vector<graphics::Vertex> &a,
+              const std::vector<uint32_t> &ai,
+              const std::vector<graphics::Vertex> &b,
+              const std::vector<uint32_t> &bi) {
+  return a.size() == b.size() && ai == bi &&
+         std::memcmp(a.data(), b.data(), a.size() * sizeof(a[0])) == 0;
+}
+
 int main() {
   // ロガー初期化（テスト用）
   core::Logger::Instance().Initialize("test_obj_loader.log");
@@ -60,6 +124,42 @@ int main() {
   CHECK(success, "Load function returned true");
   CHECK(indices.size() == 12, "Index count is correct (4 faces * 3 vertices)");
 
+  // 並列読み込みは 1 スレッドで読んだ結果とバイト単位で一致する
+  {
+    core::ThreadPool pool(3);
+    const std::string largeFile = "temp_test_large.obj";
+    for (unsigned seed = 0; seed < 4; ++seed) {
+      CreateLargeObj(largeFile, seed, seed >= 2);
+      std::vector<graphics::Vertex> serialVertices, parallelVertices;
+      std::vector<uint32_t> serialIndices, parallelIndices;
+      const bool serialOk =
+          graphics::ObjLoader::Load(largeFile, serialVertices, serialIndices);
+      const bool parallelOk = graphics::ObjLoader::Load(
+          largeFile, parallelVertices, parallelIndices, &pool);
+      CHECK(serialOk && parallelOk && !serialIndices.empty() &&
+                SameMesh(serialVertices, serialIndices, parallelVertices,
+                         parallelIndices),
+            (seed >= 2 ? "Parallel parse matches serial (broken lines)"
+                       : "Parallel parse matches serial"));
+    }
+    std::filesystem::remove(largeFile);
+  }
+
+  // 数値でない頂点番号は読み飛ばす（以前は同じ位置を読み続けて止まった）
+  {
+    const std::string badFile = "temp_test_bad.obj";
+    {
+      std::ofstream file(badFile);
+      file << "v 0 0 0\nv 1 0 0\nv 0 1 0\nf 1 x 2 3\n";
+    }
+    std::vector<graphics::Vertex> badVertices;
+    std::vector<uint32_t> badIndices;
+    CHECK(graphics::ObjLoader::Load(badFile, badVertices, badIndices) &&
+              badIndices.size() == 3,
+          "Non-numeric face corners are skipped");
+    std::filesystem::remove(badFile);
+  }
+
   // クリーンアップ
   std::filesystem::remove(testFile);
   core::Logger::Instance().Shutdown();
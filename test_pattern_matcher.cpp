@@ -0,0 +1,190 @@
+#include "src/core/PatternMatcher.h"
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using core::PatternMatch;
+using core::PatternMatcher;
+using core::WPatternMatcher;
+
+namespace {
+
+/// @brief 旧実装と同じく find(title, pos + 1) を繰り返して全出現を集める
+template <typename String>
+std::vector<PatternMatch> NaiveFindAll(const String &text,
+                                       const std::vector<String> &patterns) {
+  std::vector<PatternMatch> out;
+  for (size_t p = 0; p < patterns.size(); ++p) {
+    if (patterns[p].empty()) {
+      continue;
+    }
+    size_t pos = text.find(patterns[p]);
+    while (pos != String::npos) {
+      out.push_back({pos, static_cast<uint32_t>(patterns[p].size()),
+                     static_cast<uint32_t>(p)});
+      pos = text.find(patterns[p], pos + 1);
+    }
+  }
+  return out;
+}
+
+/// @brief (パターン, 位置) 順に並べる
+void SortByPattern(std::vector<PatternMatch> &matches) {
+  std::sort(matches.begin(), matches.end(), [](const auto &a, const auto &b) {
+    return std::tie(a.pattern, a.position) < std::tie(b.pattern, b.position);
+  });
+}
+
+bool Same(std::vector<PatternMatch> a, std::vector<PatternMatch> b) {
+  SortByPattern(a);
+  SortByPattern(b);
+  if (a.size() != b.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (a[i].position != b[i].position || a[i].length != b[i].length ||
+        a[i].pattern != b[i].pattern) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <typename CharT>
+std::vector<std::basic_string_view<CharT>>
+Views(const std::vector<std::basic_string<CharT>> &patterns) {
+  return {patterns.begin(), patterns.end()};
+}
+
+} // namespace
+
+int main() {
+  // 1) 重なり・接頭辞・接尾辞・重複パターンを含む基本ケース
+  {
+    const std::string text = "ushers she said hers; his history shehe";
+    const std::vector<std::string> patterns = {"he", "she", "his", "hers",
+                                               "", "she", "s", "history"};
+    PatternMatcher matcher;
+    matcher.Build(Views(patterns));
+    std::vector<PatternMatch> matches;
+    matcher.FindAll(text, matches);
+    CHECK(matcher.GetPatternCount() == patterns.size(),
+          "All patterns are registered");
+    CHECK(Same(matches, NaiveFindAll(text, patterns)),
+          "Overlapping and duplicate patterns match like repeated find");
+
+    bool ordered = true;
+    for (size_t i = 1; i < matches.size(); ++i) {
+      const size_t endPrev = matches[i - 1].position + matches[i - 1].length;
+      const size_t end = matches[i].position + matches[i].length;
+      ordered &= endPrev < end ||
+                 (endPrev == end && matches[i - 1].length >= matches[i].length);
+    }
+    CHECK(ordered, "Matches are ordered by end, longest first");
+
+    std::vector<bool> present;
+    matcher.FindPresent("a shell", present);
+    CHECK(present[0] && present[1] && !present[2] && !present[3] &&
+              !present[4] && present[5] && present[6] && !present[7],
+          "FindPresent flags the patterns that occur");
+  }
+
+  // 2) 自己重複するパターン
+  {
+    const std::string text(40, 'a');
+    const std::vector<std::string> patterns = {"a", "aa", "aaa", "aaaaaaa"};
+    PatternMatcher matcher;
+    matcher.Build(Views(patterns));
+    std::vector<PatternMatch> matches;
+    matcher.FindAll(text, matches);
+    CHECK(Same(matches, NaiveFindAll(text, patterns)),
+          "Self-overlapping patterns report every shift");
+  }
+
+  // 3) ランダムな本文とパターンで素朴な検索と一致する
+  {
+    std::mt19937 rng(2024);
+    bool same = true;
+    for (int trial = 0; trial < 200; ++trial) {
+      const char alphabet[] = "abcab";
+      std::string text(500 + rng() % 500, 'a');
+      for (char &c : text) {
+        c = alphabet[rng() % 5];
+      }
+      std::vector<std::string> patterns(1 + rng() % 40);
+      for (auto &p : patterns) {
+        p.resize(rng() % 7);
+        for (char &c : p) {
+          c = alphabet[rng() % 5];
+        }
+      }
+      PatternMatcher matcher;
+      matcher.Build(Views(patterns));
+      std::vector<PatternMatch> matches;
+      matcher.FindAll(text, matches);
+      same &= Same(matches, NaiveFindAll(text, patterns));
+    }
+    CHECK(same, "Random texts match repeated find");
+  }
+
+  // 4) UTF-8: 文字の途中から始まる・途中で終わる出現は返さない
+  {
+    // "日本" = E6 97 A5 E6 9C AC、"本" の2バイト目からの断片を混ぜる
+    const std::string text = "日本語の本と日本";
+    const std::vector<std::string> patterns = {
+        "本", "日本", "\x97\xA5", "\xE6\x97", "語の本"};
+    PatternMatcher matcher;
+    matcher.Build(Views(patterns));
+    std::vector<PatternMatch> matches;
+    matcher.FindAll(text, matches);
+    std::vector<PatternMatch> expected = NaiveFindAll(text, patterns);
+    expected.erase(std::remove_if(expected.begin(), expected.end(),
+                                  [](const PatternMatch &m) {
+                                    return m.pattern == 2 || m.pattern == 3;
+                                  }),
+                   expected.end());
+    CHECK(Same(matches, expected),
+          "UTF-8 matches stay on character boundaries");
+  }
+
+  // 5) ワイド文字（日本語の記事タイトルを想定）
+  {
+    const std::wstring text =
+        L"東京都は日本の首都である。東京タワーと東京駅は東京都にある。";
+    const std::vector<std::wstring> patterns = {L"東京", L"東京都",
+                                                L"東京タワー", L"日本",
+                                                L"大阪", L"首都"};
+    WPatternMatcher matcher;
+    matcher.Build(Views(patterns));
+    std::vector<PatternMatch> matches;
+    matcher.FindAll(text, matches);
+    CHECK(Same(matches, NaiveFindAll(text, patterns)),
+          "Wide-character titles match repeated find");
+  }
+
+  // 6) 空のオートマトンは何も返さない
+  {
+    PatternMatcher matcher;
+    std::vector<PatternMatch> matches;
+    matcher.FindAll("anything", matches);
+    std::vector<bool> present;
+    matcher.FindPresent("anything", present);
+    CHECK(matches.empty() && present.empty(), "Empty matcher finds nothing");
+  }
+
+  std::cout << "All pattern matcher tests passed!\n";
+  return 0;
+}
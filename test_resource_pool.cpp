@@ -56,5 +56,12 @@ int main() {
     return 1;
   }
 
+  // 4. Replace は同じスロットの中身を差し替え、解放済みのハンドルは拒む
+  CHECK(pool.Replace(handle1, {42, {}}) && pool.Get(handle1) == ptr1 &&
+            ptr1->value == 42,
+        "Replace swaps the resource in place");
+  pool.Remove(handle1);
+  CHECK(!pool.Replace(handle1, {7, {}}), "Replace rejects a removed handle");
+
   return 0;
 }
@@ -0,0 +1,205 @@
+#include "src/graphics/ArticleGlyphInstances.h"
+#include "src/graphics/SdfGlyphAtlas.h"
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using graphics::ArticleFont;
+using graphics::GlyphInstance;
+using graphics::GlyphOutline;
+using graphics::GlyphOutlineProvider;
+using graphics::SdfAtlasConfig;
+using graphics::SdfGlyph;
+using graphics::SdfGlyphAtlas;
+
+namespace {
+
+/// @brief 反時計回りの長方形（em 単位）
+std::vector<graphics::GlyphPoint> Box(float x0, float y0, float x1, float y1,
+                                      bool clockwise = false) {
+  if (clockwise) {
+    return {{x0, y0}, {x0, y1}, {x1, y1}, {x1, y0}};
+  }
+  return {{x0, y0}, {x1, y0}, {x1, y1}, {x0, y1}};
+}
+
+/// @brief 合成アウトライン: 'o' は穴あきの四角、空白は輪郭なし、
+///        '?' はアウトラインなし、それ以外は塗りつぶしの四角
+class BoxOutlines final : public GlyphOutlineProvider {
+public:
+  bool GetOutline(ArticleFont, char32_t c,
+                  GlyphOutline &outline) const override {
+    outline.contours.clear();
+    if (c == U'?') {
+      return false;
+    }
+    if (c == U' ') {
+      return true;
+    }
+    outline.contours.push_back(Box(0.1f, 0.0f, 0.5f, 0.7f));
+    if (c == U'o') {
+      outline.contours.push_back(Box(0.2f, 0.1f, 0.4f, 0.6f, true));
+    }
+    return true;
+  }
+};
+
+/// @brief アトラス上のグリフの (px, py) ピクセル（グリフ内の座標）
+uint8_t PixelAt(const SdfGlyphAtlas &atlas, const SdfGlyph &glyph, int px,
+                int py) {
+  return atlas.GetPixels()[(glyph.y + py) * atlas.GetSize() + glyph.x + px];
+}
+
+} // namespace
+
+int main() {
+  BoxOutlines outlines;
+
+  // 1) 距離場の値: 輪郭で 0.5、内側ほど大きく、spread より外は 0
+  {
+    GlyphOutline square;
+    square.contours.push_back(Box(0.0f, 0.0f, 1.0f, 1.0f));
+    const uint32_t size = 48;
+    std::vector<uint8_t> pixels(size * size);
+    // 1em = 32 ピクセルの正方形を (8, 8) から置く（y は下向き）
+    SdfGlyphAtlas::Rasterize(square, 32.0f, 4.0f, 8.0f, 40.0f, size, size,
+                             pixels.data(), size);
+    auto at = [&](int x, int y) { return pixels[y * size + x] / 255.0f; };
+    CHECK(at(24, 24) == 1.0f, "Deep inside saturates to 1");
+    CHECK(at(0, 0) == 0.0f, "Far outside saturates to 0");
+    // ピクセル 9 の中心は輪郭から 1.5 内側、6 の中心は 1.5 外側
+    CHECK(std::abs(at(9, 24) - (0.5f + 1.5f / 8.0f)) < 0.01f &&
+              std::abs(at(6, 24) - (0.5f - 1.5f / 8.0f)) < 0.01f,
+          "Values are linear in the distance to the outline");
+    CHECK(std::abs(at(24, 9) - at(9, 24)) < 0.01f,
+          "Horizontal and vertical edges agree");
+  }
+
+  // 2) 逆向きの輪郭は穴になる（非ゼロ規則）
+  {
+    SdfGlyphAtlas atlas;
+    const SdfGlyph *ring = atlas.GetOrAdd(ArticleFont::Body, U'o', outlines);
+    CHECK(ring && !ring->IsEmpty(), "Glyph with a hole is placed");
+    // 穴の中心は em (0.3, 0.35)。左上は (left, top) em
+    const float ppem = atlas.GetConfig().pixelsPerEm;
+    const int hx = static_cast<int>((0.3f - ring->left) * ppem);
+    const int hy = static_cast<int>((-0.35f - ring->top) * ppem);
+    const int sx = static_cast<int>((0.15f - ring->left) * ppem);
+    CHECK(PixelAt(atlas, *ring, hx, hy) < 128 &&
+              PixelAt(atlas, *ring, sx, hy) > 128,
+          "Counter-wound contour is a hole, the stroke is inside");
+  }
+
+  // 3) キャッシュ・空白・描けない文字
+  {
+    SdfGlyphAtlas atlas;
+    const SdfGlyph *a = atlas.GetOrAdd(ArticleFont::Body, U'a', outlines);
+    const SdfGlyph *b = atlas.GetOrAdd(ArticleFont::Body, U'a', outlines);
+    const SdfGlyph *title = atlas.GetOrAdd(ArticleFont::Title, U'a', outlines);
+    CHECK(a && a == b, "Second lookup returns the cached glyph");
+    CHECK(title && title != a, "Fonts are cached separately");
+    CHECK(atlas.GetStats().rasterized == 2, "Each glyph is rasterized once");
+
+    const SdfGlyph *space = atlas.GetOrAdd(ArticleFont::Body, U' ', outlines);
+    CHECK(space && space->IsEmpty(), "Blank glyphs take no atlas space");
+    CHECK(!atlas.GetOrAdd(ArticleFont::Body, U'?', outlines) &&
+              atlas.GetStats().failed == 1,
+          "Glyphs without an outline are reported");
+
+    // 箱は輪郭 + spread を含む（em 単位）
+    const float spreadEm =
+        atlas.GetConfig().spread / atlas.GetConfig().pixelsPerEm;
+    CHECK(a->left <= 0.1f - spreadEm + 1e-4f && a->top <= -0.7f - spreadEm &&
+              a->left + a->emWidth >= 0.5f + spreadEm - 1e-4f &&
+              a->top + a->emHeight >= spreadEm - 1e-4f,
+          "Glyph box covers the outline plus the spread");
+
+    uint32_t x0, y0, x1, y1;
+    CHECK(atlas.TakeDirtyRect(x0, y0, x1, y1) && x0 == 0 && y0 == 0 &&
+              x1 >= title->x + title->width && y1 >= a->y + a->height,
+          "Dirty rect covers the new glyphs");
+    CHECK(!atlas.TakeDirtyRect(x0, y0, x1, y1), "Dirty rect is consumed");
+  }
+
+  // 4) 満杯になったら置かず、Clear で置き直せる
+  {
+    SdfAtlasConfig config;
+    config.size = 64;
+    SdfGlyphAtlas atlas(config);
+    size_t placed = 0;
+    for (char32_t c = U'A'; c < U'A' + 40; ++c) {
+      placed += atlas.GetOrAdd(ArticleFont::Body, c, outlines) != nullptr;
+    }
+    CHECK(placed > 0 && placed < 40, "A small atlas fills up");
+    CHECK(atlas.GetStats().failed == 40 - placed, "Overflow is counted");
+    CHECK(atlas.GetStats().usedHeight <= 64, "Shelves stay inside the atlas");
+    atlas.Clear();
+    CHECK(atlas.GetStats().glyphs == 0 &&
+              atlas.GetOrAdd(ArticleFont::Body, U'Z', outlines),
+          "Clear frees the atlas");
+  }
+
+  // 5) レイアウトから四角形を作る
+  {
+    graphics::TableGlyphMetrics metrics;
+    graphics::ArticleLayoutEngine engine(metrics);
+    graphics::ArticleLayoutInput input;
+    input.title = "Ab";
+    input.text = "ab cd\nab";
+    input.links = {{"cd", "CD"}, {"zz", "ZZ"}};
+    const graphics::ArticleLayout layout = engine.Layout(input, 1200, 2000);
+
+    SdfGlyphAtlas atlas;
+    std::vector<GlyphInstance> instances;
+    graphics::GlyphInstanceStats stats;
+    graphics::GlyphInstanceColors colors;
+    graphics::BuildGlyphInstances(layout, atlas, outlines, instances, &stats,
+                                  colors);
+
+    // 文字: タイトル 2 + 本文 6 + ボタンのラベル 2（空白は四角形なし）
+    CHECK(stats.glyphs == 10 && stats.missing == 0,
+          "One quad per visible character");
+    // 罫線は 1160px を 256px ずつ 5 本に分ける
+    CHECK(stats.rects == 6 && instances.size() == 16,
+          "Header rule segments and see-also button are solid rects");
+    CHECK(instances[4].x + instances[4].width == 1180.0f,
+          "Header rule segments end at the right margin");
+    CHECK((instances[5].flags & graphics::kGlyphInstanceSolid) &&
+              instances[5].color == colors.link &&
+              instances[5].x == layout.buttons[0].x,
+          "Buttons come before the text drawn on them");
+
+    const graphics::ArticleGlyphRun &body = layout.runs[1];
+    const SdfGlyph *a = atlas.GetOrAdd(body.font, U'a', outlines);
+    const GlyphInstance &first = instances[stats.rects + 2];
+    CHECK(std::abs(first.x - (body.x + a->left * body.fontSize)) < 1e-3f &&
+              std::abs(first.y - (body.baseline + a->top * body.fontSize)) <
+                  1e-3f &&
+              std::abs(first.width - a->emWidth * body.fontSize) < 1e-3f,
+          "Quads are placed at the pen position and baseline");
+
+    bool linkColored = false;
+    bool uvInside = true;
+    for (const GlyphInstance &instance : instances) {
+      linkColored |= instance.color == colors.link && instance.flags == 0;
+      uvInside &= instance.u0 >= 0.0f && instance.u1 <= 1.0f &&
+                  instance.v0 >= 0.0f && instance.v1 <= 1.0f &&
+                  instance.u0 <= instance.u1 && instance.v0 <= instance.v1;
+    }
+    CHECK(linkColored, "Link glyphs use the link color");
+    CHECK(uvInside, "Atlas coordinates are normalized");
+  }
+
+  std::cout << "All SDF glyph atlas tests passed!\n";
+  return 0;
+}
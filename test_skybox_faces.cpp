@@ -0,0 +1,380 @@
+#include "src/core/Noise.h"
+#include "src/core/ThreadPool.h"
+#include "src/graphics/SkyboxFaceGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using namespace DirectX;
+using graphics::SkyboxTheme;
+using graphics::SkyboxThemeParams;
+
+// 並列・SIMD 化する前の1画素ずつの生成をそのまま写したもの（比較の基準）
+namespace reference {
+
+float HashNoise(int x, int y, int z) {
+  int n = x * 374761393 + y * 668265263 + z * 69069;
+  n = (n ^ (n >> 13)) * 1274126177;
+  return static_cast<float>((n ^ (n >> 16)) & 0x7FFFFFFF) / 2147483647.0f;
+}
+
+float GenerateStars(float starNoise) {
+  if (starNoise > 0.995f) {
+    return 1.0f;
+  }
+  return 0.0f;
+}
+
+core::noise::FractalSettings ValueFbmSettings(int octaves) {
+  core::noise::FractalSettings settings;
+  settings.basis = core::noise::Basis::Value;
+  settings.octaves = octaves;
+  return settings;
+}
+
+float GenerateFBM(float x, float y, float z, int octaves = 6) {
+  return core::noise::Fbm3(x, y, z, ValueFbmSettings(octaves));
+}
+
+float WorleyToCloud(float distance) { return 1.0f - std::min(distance, 1.0f); }
+
+float GenerateGalaxy(float x, float y, float z) {
+  float band = std::abs(y - 0.2f);
+  if (band > 0.3f)
+    return 0.0f;
+
+  float fbm = GenerateFBM(x * 3.0f, y * 3.0f, z * 3.0f, 4);
+  float intensity = (1.0f - band / 0.3f) * fbm;
+  return intensity * 0.3f;
+}
+
+float GenerateSun(const XMFLOAT3 &dir, const XMFLOAT3 &sunDir) {
+  XMVECTOR dirVec = XMLoadFloat3(&dir);
+  XMVECTOR sunDirVec = XMLoadFloat3(&sunDir);
+
+  XMVECTOR dotVec = XMVector3Dot(dirVec, sunDirVec);
+  float dot;
+  XMStoreFloat(&dot, dotVec);
+
+  float sunSize = 0.015f;
+  float dist = 1.0f - dot;
+
+  if (dist < sunSize) {
+    float intensity = 1.0f - (dist / sunSize);
+    return intensity * intensity * 2.0f;
+  }
+
+  if (dist < sunSize * 4.0f) {
+    float glowIntensity = 1.0f - (dist / (sunSize * 4.0f));
+    return glowIntensity * glowIntensity * 0.5f;
+  }
+
+  return 0.0f;
+}
+
+void GenerateFaceData(const XMFLOAT3 &topColor, const XMFLOAT3 &horizonColor,
+                      const XMFLOAT3 &bottomColor, int faceSize,
+                      std::vector<std::vector<uint8_t>> &outData,
+                      SkyboxTheme theme) {
+  outData.resize(6);
+  SkyboxThemeParams params = graphics::GetSkyboxThemeParams(theme);
+
+  std::vector<XMFLOAT3> rowDirs(faceSize);
+  std::vector<float> sampleX(faceSize), sampleY(faceSize), sampleZ(faceSize);
+  std::vector<float> noiseRow(faceSize), starRow(faceSize);
+  std::vector<float> fbmRow(faceSize), worleyRow(faceSize);
+  std::vector<float> detailRow(faceSize);
+  const core::noise::FractalSettings cloudFbm = ValueFbmSettings(5);
+
+  auto scaleRow = [&](float scale) {
+    for (int x = 0; x < faceSize; ++x) {
+      sampleX[x] = rowDirs[x].x * scale;
+      sampleY[x] = rowDirs[x].y * scale;
+      sampleZ[x] = rowDirs[x].z * scale;
+    }
+  };
+
+  for (int face = 0; face < 6; ++face) {
+    outData[face].resize(faceSize * faceSize * 4);
+
+    for (int y = 0; y < faceSize; ++y) {
+      for (int x = 0; x < faceSize; ++x) {
+        float u = (x / (float)(faceSize - 1)) * 2.0f - 1.0f;
+        float v = (y / (float)(faceSize - 1)) * 2.0f - 1.0f;
+
+        XMFLOAT3 dir;
+        switch (face) {
+        case 0:
+          dir = {1.0f, -v, -u};
+          break;
+        case 1:
+          dir = {-1.0f, -v, u};
+          break;
+        case 2:
+          dir = {u, 1.0f, v};
+          break;
+        case 3:
+          dir = {u, -1.0f, -v};
+          break;
+        case 4:
+          dir = {u, -v, 1.0f};
+          break;
+        case 5:
+          dir = {-u, -v, -1.0f};
+          break;
+        }
+
+        XMVECTOR dirVec = XMLoadFloat3(&dir);
+        dirVec = XMVector3Normalize(dirVec);
+        XMStoreFloat3(&rowDirs[x], dirVec);
+      }
+
+      const size_t rowLength = static_cast<size_t>(faceSize);
+      scaleRow(5.0f);
+      core::noise::Value3Batch(sampleX.data(), sampleY.data(), sampleZ.data(),
+                               noiseRow.data(), rowLength);
+      scaleRow(100.0f);
+      core::noise::Value3Batch(sampleX.data(), sampleY.data(), sampleZ.data(),
+                               starRow.data(), rowLength);
+      scaleRow(2.0f);
+      core::noise::Fbm3Batch(sampleX.data(), sampleY.data(), sampleZ.data(),
+                             fbmRow.data(), rowLength, cloudFbm);
+      scaleRow(3.0f);
+      core::noise::Worley3Batch(sampleX.data(), sampleY.data(),
+                                sampleZ.data(), worleyRow.data(), rowLength);
+      scaleRow(10.0f);
+      core::noise::Value3Batch(sampleX.data(), sampleY.data(), sampleZ.data(),
+                               detailRow.data(), rowLength);
+
+      for (int x = 0; x < faceSize; ++x) {
+        float u = (x / (float)(faceSize - 1)) * 2.0f - 1.0f;
+        float v = (y / (float)(faceSize - 1)) * 2.0f - 1.0f;
+        const XMFLOAT3 &dir = rowDirs[x];
+
+        float yFactor = dir.y;
+
+        XMFLOAT3 color;
+        if (yFactor > 0.0f) {
+          float t = std::pow(yFactor, params.gradientExponent);
+          color.x = horizonColor.x + (topColor.x - horizonColor.x) * t;
+          color.y = horizonColor.y + (topColor.y - horizonColor.y) * t;
+          color.z = horizonColor.z + (topColor.z - horizonColor.z) * t;
+        } else {
+          float t = std::pow(-yFactor, params.gradientExponent);
+          color.x = horizonColor.x + (bottomColor.x - horizonColor.x) * t;
+          color.y = horizonColor.y + (bottomColor.y - horizonColor.y) * t;
+          color.z = horizonColor.z + (bottomColor.z - horizonColor.z) * t;
+        }
+
+        XMFLOAT3 sunDir = {0.7f, 0.5f, 0.3f};
+
+        float noise = noiseRow[x] * params.noiseMult;
+        float starIntensity = GenerateStars(starRow[x]) * params.starMult;
+        float galaxyIntensity =
+            GenerateGalaxy(dir.x, dir.y, dir.z) * params.galaxyMult;
+        float sunIntensity =
+            GenerateSun(dir, sunDir) * (params.sunSize / 0.015f);
+
+        float fbmCloud = fbmRow[x];
+        float worleyCloud = WorleyToCloud(worleyRow[x]);
+        float cloudPattern =
+            (fbmCloud * 0.6f + worleyCloud * 0.4f) * params.cloudMult;
+
+        float detail = detailRow[x] * 0.1f;
+        cloudPattern += detail;
+        cloudPattern = std::max(0.0f, std::min(1.0f, cloudPattern));
+
+        float noiseInfluence = 0.05f * params.noiseMult;
+        color.x += (noise - 0.5f) * noiseInfluence;
+        color.y += (noise - 0.5f) * noiseInfluence;
+        color.z += (noise - 0.5f) * noiseInfluence;
+
+        if (sunIntensity > 0.0f && params.cloudMult > 0.0f) {
+          color.x += sunIntensity * 0.9f;
+          color.y += sunIntensity * 0.8f;
+          color.z += sunIntensity * 0.5f;
+        }
+
+        if (yFactor > -0.2f && yFactor < 0.8f && params.cloudMult > 0.0f) {
+          float cloudBase = cloudPattern * 0.2f * params.cloudMult;
+          float lightingFactor = std::max(0.0f, -dir.x * 0.5f + 0.5f);
+          float cloudHighlight = cloudPattern * cloudPattern * 0.3f *
+                                 lightingFactor * params.cloudMult;
+
+          color.x += cloudBase + cloudHighlight;
+          color.y += cloudBase + cloudHighlight;
+          color.z += cloudBase + cloudHighlight;
+        }
+
+        float brightness = (color.x + color.y + color.z) / 3.0f;
+        if (brightness < 0.3f && starIntensity > 0.9f &&
+            params.starMult > 0.0f) {
+          float starBoost = (starIntensity - 0.9f) * 10.0f * params.starMult;
+          color.x += starBoost * (0.8f + noise * 0.2f);
+          color.y += starBoost * (0.8f + noise * 0.15f);
+          color.z += starBoost * (1.0f + noise * 0.1f);
+        }
+
+        if (brightness < 0.4f && galaxyIntensity > 0.0f &&
+            params.starMult > 1.5f) {
+          color.x += galaxyIntensity * 0.5f * params.galaxyMult;
+          color.y += galaxyIntensity * 0.4f * params.galaxyMult;
+          color.z += galaxyIntensity * 0.6f * params.galaxyMult;
+        }
+
+        if (params.accentStrength > 0.0f) {
+          float accentBase =
+              0.5f * (std::sin((dir.x + dir.z) * params.accentFrequency +
+                               dir.y * params.accentFrequency * 0.5f) +
+                      1.0f);
+          float accent = std::pow(accentBase, 4.0f) * params.accentStrength;
+          color.x += accent * params.accentColor.x;
+          color.y += accent * params.accentColor.y;
+          color.z += accent * params.accentColor.z;
+        }
+
+        if (params.nebulaStrength > 0.0f) {
+          float nebula =
+              GenerateFBM(dir.x * 4.0f, dir.y * 2.0f, dir.z * 4.0f, 6);
+          nebula = std::pow(nebula, 3.0f) * params.nebulaStrength;
+          color.x += nebula * params.nebulaColor.x;
+          color.y += nebula * params.nebulaColor.y;
+          color.z += nebula * params.nebulaColor.z;
+        }
+
+        if (params.ribbonStrength > 0.0f) {
+          float ribbonWave = std::sin(dir.x * params.ribbonFrequency) *
+                             std::cos(dir.z * params.ribbonFrequency * 0.7f);
+          float ribbon =
+              std::pow(std::abs(ribbonWave), params.ribbonSharpness) *
+              params.ribbonStrength;
+          ribbon *= 0.5f + 0.5f * (1.0f - std::abs(dir.y));
+          color.x += ribbon * params.ribbonColor.x;
+          color.y += ribbon * params.ribbonColor.y;
+          color.z += ribbon * params.ribbonColor.z;
+        }
+
+        float fog = std::pow(1.0f - std::abs(dir.y), params.fogExponent) *
+                    params.fogStrength;
+        color.x = color.x * (1.0f - fog) + horizonColor.x * fog;
+        color.y = color.y * (1.0f - fog) + horizonColor.y * fog;
+        color.z = color.z * (1.0f - fog) + horizonColor.z * fog;
+
+        float lum = color.x * 0.299f + color.y * 0.587f + color.z * 0.114f;
+        color.x = lum + (color.x - lum) * params.saturation;
+        color.y = lum + (color.y - lum) * params.saturation;
+        color.z = lum + (color.z - lum) * params.saturation;
+
+        color.x = (color.x - 0.5f) * params.contrast + 0.5f;
+        color.y = (color.y - 0.5f) * params.contrast + 0.5f;
+        color.z = (color.z - 0.5f) * params.contrast + 0.5f;
+
+        color.x *= params.tint.x;
+        color.y *= params.tint.y;
+        color.z *= params.tint.z;
+
+        float radius = std::sqrt(u * u + v * v);
+        float vignette =
+            std::pow(std::min(1.0f, radius), 2.2f) * params.vignette;
+        color.x *= (1.0f - vignette);
+        color.y *= (1.0f - vignette);
+        color.z *= (1.0f - vignette);
+
+        float dither = HashNoise(x, y, face) - 0.5f;
+        color.x = std::max(0.0f, std::min(1.0f, color.x + dither * 0.003f));
+        color.y = std::max(0.0f, std::min(1.0f, color.y + dither * 0.003f));
+        color.z = std::max(0.0f, std::min(1.0f, color.z + dither * 0.003f));
+
+        int idx = (y * faceSize + x) * 4;
+        outData[face][idx + 0] = static_cast<uint8_t>(color.x * 255.0f);
+        outData[face][idx + 1] = static_cast<uint8_t>(color.y * 255.0f);
+        outData[face][idx + 2] = static_cast<uint8_t>(color.z * 255.0f);
+        outData[face][idx + 3] = 255;
+      }
+    }
+  }
+}
+
+} // namespace reference
+
+using Faces = std::vector<std::vector<uint8_t>>;
+
+static Faces Reference(SkyboxTheme theme, int faceSize) {
+  XMFLOAT3 top, horizon, bottom;
+  graphics::GetSkyboxThemeColors(theme, top, horizon, bottom);
+  Faces faces;
+  reference::GenerateFaceData(top, horizon, bottom, faceSize, faces, theme);
+  return faces;
+}
+
+static Faces Generate(SkyboxTheme theme, int faceSize,
+                      core::ThreadPool *pool) {
+  XMFLOAT3 top, horizon, bottom;
+  graphics::GetSkyboxThemeColors(theme, top, horizon, bottom);
+  Faces faces;
+  graphics::GenerateSkyboxFaces(top, horizon, bottom, faceSize, theme, faces,
+                                pool);
+  return faces;
+}
+
+int main() {
+  core::ThreadPool pool(3);
+
+  // 1) 全テーマで従来の1画素ずつの生成とビット単位で一致する
+  //    （奇数サイズで SIMD の端数列も通す）
+  {
+    bool serial = true, parallel = true;
+    for (int t = 0; t < graphics::kSkyboxThemeCount; ++t) {
+      const SkyboxTheme theme = static_cast<SkyboxTheme>(t);
+      const Faces expected = Reference(theme, 45);
+      serial &= Generate(theme, 45, nullptr) == expected;
+      parallel &= Generate(theme, 45, &pool) == expected;
+      if (!serial || !parallel) {
+        std::cerr << "theme " << t << " differs\n";
+        break;
+      }
+    }
+    CHECK(serial, "Every theme matches the reference on one thread");
+    CHECK(parallel, "Every theme matches the reference on the pool");
+  }
+
+  // 2) 大きめの面でもチャンク分割によらず一致する
+  {
+    const SkyboxTheme themes[] = {SkyboxTheme::Default,
+                                  SkyboxTheme::SpaceAstronomy,
+                                  SkyboxTheme::Fantasy};
+    bool same = true;
+    for (SkyboxTheme theme : themes) {
+      same &= Generate(theme, 128, &pool) == Reference(theme, 128);
+    }
+    CHECK(same, "128px faces match the reference");
+  }
+
+  // 3) 形式: 6面 × faceSize² × RGBA、アルファは不透明
+  {
+    const Faces faces = Generate(SkyboxTheme::Ocean, 16, &pool);
+    bool layout = faces.size() == 6;
+    for (const std::vector<uint8_t> &face : faces) {
+      layout &= face.size() == 16 * 16 * 4;
+      for (size_t i = 3; i < face.size(); i += 4) {
+        layout &= face[i] == 255;
+      }
+    }
+    CHECK(layout, "Six opaque RGBA faces");
+  }
+
+  std::cout << "All skybox face tests passed!\n";
+  return 0;
+}
@@ -0,0 +1,124 @@
+#include "src/game/systems/SphereContactSolver.h"
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+#define CHECK_CLOSE(actual, expected, eps, message)                            \
+  CHECK(std::fabs((actual) - (expected)) <= (eps), message)
+
+using game::systems::SphereBody;
+using game::systems::SphereContactSolver;
+
+static SphereBody MakeBall(uint32_t id, float x, float y, float z,
+                           float invMass = 1.0f) {
+  SphereBody b;
+  b.id = id;
+  b.position[0] = x;
+  b.position[1] = y;
+  b.position[2] = z;
+  b.radius = 0.5f;
+  b.invMass = invMass;
+  b.restitution = 0.0f;
+  return b;
+}
+
+/// @brief 静的球の床の上に num 個の球を縦に積む
+static std::vector<SphereBody> MakeColumn(int num) {
+  std::vector<SphereBody> bodies;
+  bodies.push_back(MakeBall(1000, 0.0f, 0.0f, 0.0f, 0.0f));
+  for (int i = 0; i < num; ++i) {
+    bodies.push_back(MakeBall(i, 0.0f, 0.99f * (i + 1), 0.0f));
+  }
+  return bodies;
+}
+
+static int StepColumn(SphereContactSolver &solver,
+                      std::vector<SphereBody> &bodies, int frames) {
+  const float dt = 1.0f / 240.0f;
+  int lastIterations = 0;
+  for (int f = 0; f < frames; ++f) {
+    for (auto &b : bodies) {
+      if (b.invMass > 0.0f) {
+        b.velocity[1] += -9.8f * dt;
+      }
+    }
+    lastIterations = solver.Solve(bodies, dt).iterations;
+    for (auto &b : bodies) {
+      for (int k = 0; k < 3; ++k) {
+        b.position[k] += b.velocity[k] * dt;
+      }
+    }
+  }
+  return lastIterations;
+}
+
+int main() {
+  // 1) 等質量・完全弾性の正面衝突で速度が入れ替わる
+  {
+    std::vector<SphereBody> bodies = {MakeBall(1, 0.0f, 0.0f, 0.0f),
+                                      MakeBall(2, 0.95f, 0.0f, 0.0f)};
+    bodies[0].velocity[0] = 4.0f;
+    bodies[1].velocity[0] = -4.0f;
+    bodies[0].restitution = bodies[1].restitution = 1.0f;
+
+    SphereContactSolver solver;
+    const auto &stats = solver.Solve(bodies, 1.0f / 60.0f);
+    CHECK(stats.contactCount == 1, "Overlapping pair produces one contact");
+    CHECK_CLOSE(bodies[0].velocity[0], -4.0f, 1e-3f,
+                "Elastic collision reverses body A");
+    CHECK_CLOSE(bodies[1].velocity[0], 4.0f, 1e-3f,
+                "Elastic collision reverses body B");
+  }
+
+  // 2) 静的球は動かず、動的球だけが押し返される
+  {
+    std::vector<SphereBody> bodies = {MakeBall(1, 0.0f, 0.0f, 0.0f, 0.0f),
+                                      MakeBall(2, 0.0f, 0.9f, 0.0f)};
+    bodies[1].velocity[1] = -3.0f;
+    SphereContactSolver solver;
+    solver.Solve(bodies, 1.0f / 60.0f);
+    CHECK(bodies[0].velocity[1] == 0.0f, "Static sphere keeps zero velocity");
+    CHECK(bodies[1].velocity[1] >= 0.0f,
+          "Dynamic sphere stops approaching the static one");
+  }
+
+  // 3) 積み重ねはウォームスタートで少ない反復に収束する
+  {
+    std::vector<SphereBody> warmBodies = MakeColumn(8);
+    std::vector<SphereBody> coldBodies = MakeColumn(8);
+
+    SphereContactSolver warm;
+    SphereContactSolver cold;
+    auto settings = cold.GetSettings();
+    settings.warmStart = false;
+    settings.maxIterations = 50;
+    cold.SetSettings(settings);
+    settings.warmStart = true;
+    warm.SetSettings(settings);
+
+    const int warmIterations = StepColumn(warm, warmBodies, 240);
+    const int coldIterations = StepColumn(cold, coldBodies, 240);
+    std::cout << "  column iterations warm=" << warmIterations
+              << " cold=" << coldIterations << "\n";
+    CHECK(warm.GetStats().warmStartedCount > 0,
+          "Resting contacts are warm-started from the cache");
+    CHECK(warmIterations < coldIterations,
+          "Warm starting converges in fewer iterations than a cold start");
+
+    const float top = warmBodies.back().position[1];
+    CHECK(top > 7.5f && top < 8.5f, "Column of 8 balls holds its height");
+  }
+
+  std::cout << "All sphere contact solver tests passed!\n";
+  return 0;
+}
@@ -0,0 +1,195 @@
+#include "src/core/Logger.h"
+#include "src/game/systems/TerrainCache.h"
+#include "src/game/systems/TerrainGenerator.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using game::systems::TerrainCache;
+using game::systems::TerrainCacheKey;
+using game::systems::TerrainCacheStats;
+using game::systems::TerrainConfig;
+using game::systems::TerrainData;
+using game::systems::TerrainGenerator;
+using Holes = std::vector<DirectX::XMFLOAT2>;
+
+template <typename T>
+static bool SameBits(const std::vector<T> &a, const std::vector<T> &b) {
+  return a.size() == b.size() &&
+         (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) ==
+                           0);
+}
+
+static bool SameTerrain(const TerrainData &a, const TerrainData &b) {
+  return SameBits(a.heightMap, b.heightMap) &&
+         SameBits(a.materialMap, b.materialMap) &&
+         SameBits(a.normals, b.normals) && SameBits(a.vertices, b.vertices) &&
+         SameBits(a.indices, b.indices);
+}
+
+/// @brief ファイルの指定位置のバイトを反転する
+static void FlipByte(const std::filesystem::path &path, std::streamoff pos) {
+  std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+  file.seekg(pos);
+  char c = 0;
+  file.read(&c, 1);
+  c = static_cast<char>(~c);
+  file.seekp(pos);
+  file.write(&c, 1);
+}
+
+int main() {
+  const std::filesystem::path dir =
+      std::filesystem::temp_directory_path() / "wikigolf_terrain_cache_test";
+  std::filesystem::remove_all(dir);
+
+  TerrainConfig config;
+  config.resolutionX = 96;
+  config.resolutionZ = 128;
+  config.heightScale = 2.5f;
+  config.noiseAmplitude = 0.4f;
+  const Holes holes = {{-5.0f, 8.0f}, {3.0f, -6.0f}, {6.0f, 10.0f}};
+  const TerrainData reference =
+      TerrainGenerator::GenerateTerrain("Cache", holes, config, nullptr);
+
+  // 1) キーは入力のどれが変わっても変わる
+  {
+    const TerrainCacheKey key = TerrainCache::MakeKey("Cache", holes, config);
+    CHECK(key == TerrainCache::MakeKey("Cache", holes, config),
+          "Key is deterministic");
+    TerrainConfig other = config;
+    other.smoothing.iterations = 2;
+    Holes moved = holes;
+    moved[1].x += 0.01f;
+    CHECK(!(key == TerrainCache::MakeKey("Cache2", holes, config)) &&
+              !(key == TerrainCache::MakeKey("Cache", moved, config)) &&
+              !(key == TerrainCache::MakeKey("Cache", holes, other)),
+          "Key changes with text, holes and config");
+    CHECK(key.ToString().size() == 32, "Key string is 32 hex digits");
+  }
+
+  // 2) 初回は生成して保存、2回目はファイルから同じ地形を読む
+  {
+    TerrainCache cache(dir);
+    TerrainCacheStats cold;
+    const TerrainData first =
+        cache.GetOrGenerate("Cache", holes, config, nullptr, &cold);
+    CHECK(!cold.hit && SameTerrain(first, reference),
+          "Cold load generates the terrain");
+    CHECK(cache.GetEntryCount() == 1 && cold.fileBytes > 0,
+          "Cold load stores one file");
+    CHECK(cold.fileBytes < cold.rawBytes / 2,
+          "Stored file is compressed (" << cold.fileBytes << " of "
+                                        << cold.rawBytes << " bytes)");
+
+    TerrainCacheStats warm;
+    const TerrainData second =
+        cache.GetOrGenerate("Cache", holes, config, nullptr, &warm);
+    CHECK(warm.hit, "Warm load hits the cache");
+    CHECK(SameTerrain(second, reference), "Cached terrain is bit-identical");
+    CHECK(second.config.resolutionX == config.resolutionX &&
+              second.config.heightScale == config.heightScale,
+          "Cached terrain carries the requested config");
+  }
+
+  // 3) 再起動後（新しいインスタンス）も既存ファイルを使う
+  {
+    TerrainCache cache(dir);
+    CHECK(cache.GetEntryCount() == 1, "Existing files are indexed on start");
+    TerrainData loaded;
+    const TerrainCacheKey key = TerrainCache::MakeKey("Cache", holes, config);
+    CHECK(cache.Load(key, config, loaded) && SameTerrain(loaded, reference),
+          "Fresh instance loads the stored terrain");
+
+    TerrainConfig resized = config;
+    resized.resolutionX = 64;
+    TerrainData untouched;
+    CHECK(!cache.Load(key, resized, untouched) && untouched.heightMap.empty(),
+          "Header resolution mismatch is rejected");
+  }
+
+  // 4) 壊れたファイルは検証で弾いて削除し、生成し直す
+  {
+    const TerrainCacheKey key = TerrainCache::MakeKey("Cache", holes, config);
+    const std::vector<std::streamoff> offsets = {0, 40, 200, 2000};
+    for (std::streamoff offset : offsets) {
+      TerrainCache cache(dir);
+      const std::filesystem::path path = cache.PathFor(key);
+      if (!std::filesystem::exists(path)) {
+        cache.GetOrGenerate("Cache", holes, config, nullptr);
+      }
+      FlipByte(path, offset);
+      TerrainData out;
+      CHECK(!cache.Load(key, config, out) && out.heightMap.empty(),
+            "Corrupted byte " << offset << " is rejected");
+      CHECK(!std::filesystem::exists(path) && cache.GetEntryCount() == 0,
+            "Corrupted file is removed");
+    }
+
+    TerrainCache cache(dir);
+    cache.GetOrGenerate("Cache", holes, config, nullptr);
+    const std::filesystem::path path = cache.PathFor(key);
+    std::filesystem::resize_file(path, std::filesystem::file_size(path) / 2);
+    TerrainCache reopened(dir);
+    TerrainCacheStats stats;
+    const TerrainData regenerated =
+        reopened.GetOrGenerate("Cache", holes, config, nullptr, &stats);
+    CHECK(!stats.hit && SameTerrain(regenerated, reference),
+          "Truncated file is regenerated");
+  }
+
+  // 5) 上限を超えたら最後に使った時刻が古いものから消す
+  {
+    std::filesystem::remove_all(dir);
+    TerrainCache probe(dir);
+    TerrainCacheStats stats;
+    probe.GetOrGenerate("A", holes, config, nullptr, &stats);
+    const uint64_t fileBytes = probe.GetTotalBytes();
+    probe.Clear();
+    CHECK(probe.GetEntryCount() == 0 && probe.GetTotalBytes() == 0,
+          "Clear removes all files");
+
+    // 3ファイル分より少し大きい上限
+    TerrainCache cache(dir, fileBytes * 3 + fileBytes / 2);
+    cache.GetOrGenerate("A", holes, config, nullptr);
+    cache.GetOrGenerate("B", holes, config, nullptr);
+    cache.GetOrGenerate("C", holes, config, nullptr);
+    CHECK(cache.GetEntryCount() == 3, "Three entries fit");
+
+    // A を使い直すと、次に追加したとき最も古いのは B になる
+    TerrainCacheStats hitA;
+    cache.GetOrGenerate("A", holes, config, nullptr, &hitA);
+    cache.GetOrGenerate("D", holes, config, nullptr);
+    auto exists = [&](const char *text) {
+      return std::filesystem::exists(
+          cache.PathFor(TerrainCache::MakeKey(text, holes, config)));
+    };
+    CHECK(hitA.hit && cache.GetEntryCount() == 3, "Fourth entry evicts one");
+    CHECK(exists("A") && !exists("B") && exists("C") && exists("D"),
+          "Least recently used entry is evicted");
+    CHECK(cache.GetTotalBytes() <= cache.GetMaxBytes(),
+          "Total size stays within the limit");
+
+    // 最後に使った順は再起動後も保たれる
+    TerrainCache reopened(dir, fileBytes * 3 + fileBytes / 2);
+    reopened.GetOrGenerate("E", holes, config, nullptr);
+    CHECK(exists("A") && !exists("C") && exists("D") && exists("E"),
+          "Recency survives a restart");
+  }
+
+  std::filesystem::remove_all(dir);
+  std::cout << "All terrain cache tests passed!\n";
+  return 0;
+}
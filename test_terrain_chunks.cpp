@@ -0,0 +1,315 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/TerrainChunks.h"
+#include "src/game/systems/TerrainGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using game::systems::TerrainChunk;
+using game::systems::TerrainChunkSettings;
+using game::systems::TerrainChunkTree;
+using game::systems::TerrainConfig;
+using game::systems::TerrainData;
+using game::systems::TerrainGenerator;
+using game::systems::TerrainLodQuery;
+
+template <typename T>
+static bool SameBits(const std::vector<T> &a, const std::vector<T> &b) {
+  return a.size() == b.size() &&
+         (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) ==
+                           0);
+}
+
+static bool SameTree(const TerrainChunkTree &a, const TerrainChunkTree &b) {
+  if (a.GetChunks().size() != b.GetChunks().size()) {
+    return false;
+  }
+  for (size_t i = 0; i < a.GetChunks().size(); ++i) {
+    const TerrainChunk &ca = a.GetChunks()[i];
+    const TerrainChunk &cb = b.GetChunks()[i];
+    if (!SameBits(ca.vertices, cb.vertices) ||
+        !SameBits(ca.indices, cb.indices) ||
+        ca.geometricError != cb.geometricError) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// @brief チャンクの間引き格子の一辺の頂点数
+static int SampleCount(int first, int last, int stride) {
+  return (last - first + stride - 1) / stride + 1;
+}
+
+/// @brief チャンクの地表メッシュ上の高さ（(x, z) は元の格子の頂点番号）
+static float ChunkSurfaceHeight(const TerrainChunk &c, int x, int z) {
+  const int nx = SampleCount(c.cellX0, c.cellX1, c.stride);
+  const int nz = SampleCount(c.cellZ0, c.cellZ1, c.stride);
+  auto sample = [&](int i, int n, int first, int last) {
+    return (i == n - 1) ? last : first + i * c.stride;
+  };
+  int col = std::min((x - c.cellX0) / c.stride, nx - 2);
+  int row = std::min((z - c.cellZ0) / c.stride, nz - 2);
+  const int xa = sample(col, nx, c.cellX0, c.cellX1);
+  const int xb = sample(col + 1, nx, c.cellX0, c.cellX1);
+  const int za = sample(row, nz, c.cellZ0, c.cellZ1);
+  const int zb = sample(row + 1, nz, c.cellZ0, c.cellZ1);
+  const float fx = static_cast<float>(x - xa) / (xb - xa);
+  const float fz = static_cast<float>(z - za) / (zb - za);
+  auto h = [&](int cc, int rr) { return c.vertices[rr * nx + cc].position.y; };
+  const float h0 = h(col, row), h1 = h(col + 1, row);
+  const float h2 = h(col, row + 1), h3 = h(col + 1, row + 1);
+  return (fx + fz <= 1.0f)
+             ? h0 + (h1 - h0) * fx + (h2 - h0) * fz
+             : h3 + (h2 - h3) * (1.0f - fx) + (h1 - h3) * (1.0f - fz);
+}
+
+static bool Covers(const TerrainChunk &c, int x, int z) {
+  return x >= c.cellX0 && x <= c.cellX1 && z >= c.cellZ0 && z <= c.cellZ1;
+}
+
+/// @brief 選ばれたチャンクがセルをちょうど1回ずつ覆うか
+static bool TilesExactly(const TerrainChunkTree &tree,
+                         const std::vector<uint32_t> &selected, int cellsX,
+                         int cellsZ) {
+  std::vector<int> hits(static_cast<size_t>(cellsX) * cellsZ, 0);
+  for (uint32_t i : selected) {
+    const TerrainChunk &c = tree.GetChunks()[i];
+    for (int z = c.cellZ0; z < c.cellZ1; ++z) {
+      for (int x = c.cellX0; x < c.cellX1; ++x) {
+        ++hits[static_cast<size_t>(z) * cellsX + x];
+      }
+    }
+  }
+  return std::all_of(hits.begin(), hits.end(), [](int n) { return n == 1; });
+}
+
+int main() {
+  TerrainConfig config;
+  config.resolutionX = 256;
+  config.resolutionZ = 384;
+  config.worldWidth = 40.0f;
+  config.worldDepth = 60.0f;
+  config.heightScale = 2.5f;
+  config.noiseAmplitude = 0.4f;
+  const std::vector<DirectX::XMFLOAT2> holes = {
+      {-10.0f, 12.0f}, {5.0f, -20.0f}, {12.0f, 3.0f}};
+  const TerrainData data =
+      TerrainGenerator::GenerateTerrain("Chunks", holes, config, nullptr);
+  const int cellsX = config.resolutionX - 1;
+  const int cellsZ = config.resolutionZ - 1;
+
+  TerrainChunkSettings settings;
+  settings.chunkCells = 32;
+  TerrainChunkTree tree;
+  tree.Build(data, settings, nullptr);
+  const auto &chunks = tree.GetChunks();
+
+  // 1) 四分木の形: 383 セルを覆うには 32 * 2^4 = 512 が必要
+  {
+    CHECK(tree.GetLevelCount() == 5, "Root level covers the longest side");
+    std::vector<uint32_t> leaves;
+    for (uint32_t i = 0; i < chunks.size(); ++i) {
+      if (chunks[i].IsLeaf()) {
+        leaves.push_back(i);
+      }
+    }
+    bool leafLevel = std::all_of(leaves.begin(), leaves.end(), [&](auto i) {
+      return chunks[i].level == 0;
+    });
+    CHECK(leafLevel, "Every leaf is at full resolution");
+    CHECK(TilesExactly(tree, leaves, cellsX, cellsZ),
+          "Leaves tile the height field without overlap");
+  }
+
+  // 2) 葉の地表頂点は単一メッシュ版の頂点そのもの
+  {
+    bool same = true;
+    for (const auto &c : chunks) {
+      if (c.level != 0) {
+        continue;
+      }
+      const int nx = c.cellX1 - c.cellX0 + 1;
+      for (int z = c.cellZ0; z <= c.cellZ1; ++z) {
+        for (int x = c.cellX0; x <= c.cellX1; ++x) {
+          const auto &a = c.vertices[(z - c.cellZ0) * nx + (x - c.cellX0)];
+          const auto &b = data.vertices[z * config.resolutionX + x];
+          same = same && std::memcmp(&a, &b, sizeof(a)) == 0;
+        }
+      }
+    }
+    CHECK(same, "Leaf vertices match the monolithic mesh");
+  }
+
+  // 3) 誤差は子孫以上で、葉は 0。実際の地表の差も誤差以内
+  {
+    bool monotonic = true;
+    bool leafZero = true;
+    for (const auto &c : chunks) {
+      for (int32_t child : c.children) {
+        if (child >= 0) {
+          monotonic = monotonic &&
+                      c.geometricError >= chunks[child].geometricError;
+        }
+      }
+      if (c.level == 0) {
+        leafZero = leafZero && c.geometricError == 0.0f;
+      }
+    }
+    CHECK(monotonic, "Parent error bounds its children");
+    CHECK(leafZero, "Leaves have zero geometric error");
+    CHECK(chunks[0].geometricError > 0.0f, "Root error is positive");
+
+    bool within = true;
+    for (const auto &c : chunks) {
+      for (int z = c.cellZ0; z <= c.cellZ1; ++z) {
+        for (int x = c.cellX0; x <= c.cellX1; ++x) {
+          const float truth =
+              data.vertices[z * config.resolutionX + x].position.y;
+          within = within && std::abs(ChunkSurfaceHeight(c, x, z) - truth) <=
+                                 c.geometricError + 1e-5f;
+        }
+      }
+    }
+    CHECK(within, "Surface deviation stays within the chunk error");
+  }
+
+  // 4) 境界は全頂点（スカート込み）を含む
+  {
+    bool contained = true;
+    for (const auto &c : chunks) {
+      for (const auto &v : c.vertices) {
+        const float p[3] = {v.position.x, v.position.y, v.position.z};
+        for (int a = 0; a < 3; ++a) {
+          contained = contained && p[a] >= c.bounds.min[a] - 1e-5f &&
+                      p[a] <= c.bounds.max[a] + 1e-5f;
+        }
+      }
+    }
+    CHECK(contained, "Bounds enclose surface and skirt");
+    CHECK(tree.GetSkirtDepth() >= 2.0f * chunks[0].geometricError,
+          "Automatic skirt covers the worst LOD gap");
+  }
+
+  TerrainLodQuery query;
+  query.projectionScale = TerrainChunkTree::ComputeProjectionScale(
+      DirectX::XM_PIDIV4, 1080.0f);
+  query.maxScreenError = 2.0f;
+  std::vector<uint32_t> selected;
+
+  // 5) 遠くからは根だけ、地表すれすれでは近くほど細かい
+  {
+    query.cameraPosition[0] = 0.0f;
+    query.cameraPosition[1] = 1.0e6f;
+    query.cameraPosition[2] = 0.0f;
+    auto stats = tree.SelectLod(query, selected);
+    CHECK(selected.size() == 1 && selected[0] == 0,
+          "Distant camera selects the root only");
+    CHECK(stats.triangleCount == chunks[0].TriangleCount(),
+          "Stats report selected triangles");
+
+    query.cameraPosition[0] = -19.0f;
+    query.cameraPosition[1] = 2.0f;
+    query.cameraPosition[2] = 29.0f; // 左奥の角（セル 0, 0 付近）
+    stats = tree.SelectLod(query, selected);
+    CHECK(TilesExactly(tree, selected, cellsX, cellsZ),
+          "Selection tiles the field exactly once");
+    int nearLevel = -1;
+    int maxLevel = 0;
+    for (uint32_t i : selected) {
+      if (Covers(chunks[i], 0, 0)) {
+        nearLevel = chunks[i].level;
+      }
+      maxLevel = std::max(maxLevel, chunks[i].level);
+    }
+    CHECK(nearLevel == 0, "Chunk under the camera is full resolution");
+    CHECK(maxLevel > 0, "Far chunks use coarser levels");
+    std::cout << "  selected " << stats.chunkCount << " chunks, "
+              << stats.triangleCount << " triangles (full mesh "
+              << data.indices.size() / 3 << ")\n";
+    CHECK(stats.triangleCount < data.indices.size() / 3,
+          "Selection draws fewer triangles than the full mesh");
+
+    // 隣接チャンクの縁の高さの差はスカートで隠れる
+    float worstGap = 0.0f;
+    for (uint32_t i : selected) {
+      const TerrainChunk &a = chunks[i];
+      for (uint32_t j : selected) {
+        const TerrainChunk &b = chunks[j];
+        if (i == j) {
+          continue;
+        }
+        for (int z = a.cellZ0; z <= a.cellZ1; ++z) {
+          for (int x = a.cellX0; x <= a.cellX1; ++x) {
+            const bool edge = x == a.cellX0 || x == a.cellX1 ||
+                              z == a.cellZ0 || z == a.cellZ1;
+            if (edge && Covers(b, x, z)) {
+              worstGap = std::max(worstGap,
+                                  std::abs(ChunkSurfaceHeight(a, x, z) -
+                                           ChunkSurfaceHeight(b, x, z)));
+            }
+          }
+        }
+      }
+    }
+    CHECK(worstGap <= tree.GetSkirtDepth(), "Skirts hide LOD cracks");
+  }
+
+  // 6) 視錐台カリング（x >= 0 の半空間だけを残す）
+  {
+    query.cameraPosition[0] = 0.0f;
+    query.cameraPosition[1] = 3.0f;
+    query.cameraPosition[2] = 0.0f;
+    const float inside[4] = {0.0f, 1.0f, 0.0f, 1.0e6f}; // 常に内側
+    for (auto &plane : query.frustumPlanes) {
+      std::copy(inside, inside + 4, plane);
+    }
+    query.frustumPlanes[0][0] = 1.0f;
+    query.frustumPlanes[0][1] = 0.0f;
+    query.frustumPlanes[0][3] = 0.0f;
+    query.cullFrustum = true;
+    std::vector<uint32_t> culled;
+    auto stats = tree.SelectLod(query, selected, &culled);
+    bool allInside = std::all_of(selected.begin(), selected.end(),
+                                 [&](auto i) {
+                                   return chunks[i].bounds.max[0] >= 0.0f;
+                                 });
+    CHECK(stats.culledCount > 0, "Chunks behind a plane are culled");
+    CHECK(allInside && !selected.empty(), "Visible chunks are kept");
+    CHECK(culled.size() == stats.culledCount, "Culled nodes are reported");
+    size_t culledTriangles = 0;
+    for (uint32_t i : culled) {
+      culledTriangles += chunks[i].TriangleCount();
+    }
+    CHECK(stats.culledTriangleCount == culledTriangles &&
+              stats.chunkCount == selected.size(),
+          "Draw and culled counts match the lists");
+    selected.insert(selected.end(), culled.begin(), culled.end());
+    CHECK(TilesExactly(tree, selected, cellsX, cellsZ),
+          "Visible and culled nodes together cover the field");
+    query.cullFrustum = false;
+  }
+
+  // 7) 並列構築は単一スレッドとビット単位で一致する
+  {
+    core::ThreadPool pool(4);
+    TerrainChunkTree parallel;
+    parallel.Build(data, settings, &pool);
+    CHECK(SameTree(tree, parallel), "Parallel build matches serial build");
+  }
+
+  std::cout << "All terrain chunk tests passed!\n";
+  return 0;
+}
@@ -0,0 +1,110 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/TerrainGenerator.h"
+#include "src/graphics/TangentGenerator.h"
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using game::systems::TerrainConfig;
+using game::systems::TerrainData;
+using game::systems::TerrainGenerator;
+
+template <typename T>
+static bool SameBits(const std::vector<T> &a, const std::vector<T> &b) {
+  return a.size() == b.size() &&
+         (a.empty() || std::memcmp(a.data(), b.data(), a.size() * sizeof(T)) ==
+                           0);
+}
+
+static bool SameTerrain(const TerrainData &a, const TerrainData &b) {
+  return SameBits(a.heightMap, b.heightMap) &&
+         SameBits(a.materialMap, b.materialMap) &&
+         SameBits(a.normals, b.normals) && SameBits(a.vertices, b.vertices) &&
+         SameBits(a.indices, b.indices);
+}
+
+int main() {
+  // 行バンドが複数に分かれる大きさ・非正方形にする
+  TerrainConfig config;
+  config.resolutionX = 256;
+  config.resolutionZ = 384;
+  config.worldWidth = 40.0f;
+  config.worldDepth = 60.0f;
+  config.heightScale = 2.5f;
+  config.noiseAmplitude = 0.4f; // 記事シードのノイズ層も並列経路に含める
+
+  // 影響範囲が重なるホール（適用順に依存する）と、範囲外のホールを含める
+  const std::vector<DirectX::XMFLOAT2> holes = {
+      {-10.0f, 12.0f}, {-8.5f, 11.0f}, {5.0f, -20.0f},
+      {6.0f, -18.5f},  {19.9f, 29.9f}, {35.0f, 0.0f},
+  };
+
+  const TerrainData serial =
+      TerrainGenerator::GenerateTerrain("Test", holes, config, nullptr);
+
+  // 1) スレッド数に関わらずビット単位で一致する
+  {
+    core::ThreadPool one(1);
+    core::ThreadPool four(4);
+    const TerrainData t1 =
+        TerrainGenerator::GenerateTerrain("Test", holes, config, &one);
+    const TerrainData t4 =
+        TerrainGenerator::GenerateTerrain("Test", holes, config, &four);
+    CHECK(SameTerrain(serial, t1), "1-worker pool matches serial output");
+    CHECK(SameTerrain(serial, t4), "4-worker pool matches serial output");
+  }
+
+  // 2) 繰り返し生成しても同じ（チャンクの割り当て順に依存しない）
+  {
+    core::ThreadPool pool(3);
+    bool stable = true;
+    for (int i = 0; i < 4; ++i) {
+      stable = stable && SameTerrain(serial, TerrainGenerator::GenerateTerrain(
+                                                 "Test", holes, config, &pool));
+    }
+    CHECK(stable, "Repeated parallel runs are bit-identical");
+  }
+
+  // 3) 格子用の接線収集は汎用の ComputeTangents と完全に一致する
+  {
+    std::vector<graphics::Vertex> reference = serial.vertices;
+    graphics::ComputeTangents(reference, serial.indices);
+    CHECK(SameBits(reference, serial.vertices),
+          "Grid tangents match graphics::ComputeTangents bit for bit");
+  }
+
+  // 4) 記事タイトルが変わると起伏も変わる（シードは座標と記事から作る）
+  {
+    const TerrainData other =
+        TerrainGenerator::GenerateTerrain("Other", holes, config, nullptr);
+    CHECK(!SameBits(serial.heightMap, other.heightMap),
+          "Article seed changes the noise layer");
+  }
+
+  // 5) ホールがあるとグリーンが作られる
+  {
+    int greens = 0;
+    for (uint8_t m : serial.materialMap) {
+      greens += (m == 3) ? 1 : 0;
+    }
+    CHECK(greens > 0, "Platforms mark green cells");
+    CHECK(serial.indices.size() ==
+              static_cast<size_t>(config.resolutionX - 1) *
+                  (config.resolutionZ - 1) * 6,
+          "Index count covers every quad");
+  }
+
+  std::cout << "All terrain generator tests passed!\n";
+  return 0;
+}
@@ -0,0 +1,352 @@
+#include "src/core/ThreadPool.h"
+#include "src/game/systems/TerrainGenerator.h"
+#include "src/game/systems/TerrainHeightPyramid.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using DirectX::XMFLOAT3;
+using game::systems::TerrainConfig;
+using game::systems::TerrainData;
+using game::systems::TerrainGenerator;
+using game::systems::TerrainHeightPyramid;
+using game::systems::TerrainRayHit;
+
+namespace {
+
+struct V3 {
+  float x, y, z;
+};
+V3 operator+(V3 a, V3 b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+V3 operator-(V3 a, V3 b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+V3 operator*(V3 a, float s) { return {a.x * s, a.y * s, a.z * s}; }
+float Dot(V3 a, V3 b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+float Length(V3 a) { return std::sqrt(Dot(a, a)); }
+
+/// @brief 地形メッシュの頂点位置（WriteVertices と同じ式）
+V3 Vertex(const TerrainData &d, int x, int z) {
+  const TerrainConfig &c = d.config;
+  const float u = (float)x / (c.resolutionX - 1);
+  const float v = (float)z / (c.resolutionZ - 1);
+  return {(u - 0.5f) * c.worldWidth, d.heightMap[z * c.resolutionX + x],
+          (0.5f - v) * c.worldDepth};
+}
+
+/// @brief メッシュ（0-1-2 / 2-1-3 分割）上の高さ。フィールド外なら false
+bool SurfaceHeight(const TerrainData &d, float x, float z, float &h) {
+  const TerrainConfig &c = d.config;
+  const float gx = (x / c.worldWidth + 0.5f) * (c.resolutionX - 1);
+  const float gz = (0.5f - z / c.worldDepth) * (c.resolutionZ - 1);
+  if (gx < 0.0f || gz < 0.0f || gx > c.resolutionX - 1 ||
+      gz > c.resolutionZ - 1) {
+    return false;
+  }
+  const int cx = std::min((int)gx, c.resolutionX - 2);
+  const int cz = std::min((int)gz, c.resolutionZ - 2);
+  const float fx = gx - cx, fz = gz - cz;
+  const float h00 = Vertex(d, cx, cz).y, h10 = Vertex(d, cx + 1, cz).y;
+  const float h01 = Vertex(d, cx, cz + 1).y, h11 = Vertex(d, cx + 1, cz + 1).y;
+  if (fx + fz <= 1.0f) {
+    h = h00 + fx * (h10 - h00) + fz * (h01 - h00);
+  } else {
+    h = h11 + (1.0f - fx) * (h01 - h11) + (1.0f - fz) * (h10 - h11);
+  }
+  return true;
+}
+
+/// @brief (x, z) を含むセルの2つの三角形の上向き法線
+void CellNormals(const TerrainData &d, float x, float z, V3 out[2]) {
+  const TerrainConfig &c = d.config;
+  const float gx = (x / c.worldWidth + 0.5f) * (c.resolutionX - 1);
+  const float gz = (0.5f - z / c.worldDepth) * (c.resolutionZ - 1);
+  const int cx = std::min((int)gx, c.resolutionX - 2);
+  const int cz = std::min((int)gz, c.resolutionZ - 2);
+  const V3 p0 = Vertex(d, cx, cz), p1 = Vertex(d, cx + 1, cz);
+  const V3 p2 = Vertex(d, cx, cz + 1), p3 = Vertex(d, cx + 1, cz + 1);
+  const V3 tris[2][3] = {{p0, p1, p2}, {p2, p1, p3}};
+  for (int i = 0; i < 2; ++i) {
+    const V3 e1 = tris[i][1] - tris[i][0], e2 = tris[i][2] - tris[i][0];
+    V3 n = {e1.y * e2.z - e1.z * e2.y, e1.z * e2.x - e1.x * e2.z,
+            e1.x * e2.y - e1.y * e2.x};
+    n = n * ((n.y < 0.0f ? -1.0f : 1.0f) / Length(n));
+    out[i] = n;
+  }
+}
+
+/// @brief 点と三角形の最近点（Real-Time Collision Detection 5.1.5）
+V3 ClosestOnTriangle(V3 p, V3 a, V3 b, V3 c) {
+  const V3 ab = b - a, ac = c - a, ap = p - a;
+  const float d1 = Dot(ab, ap), d2 = Dot(ac, ap);
+  if (d1 <= 0 && d2 <= 0) return a;
+  const V3 bp = p - b;
+  const float d3 = Dot(ab, bp), d4 = Dot(ac, bp);
+  if (d3 >= 0 && d4 <= d3) return b;
+  const float vc = d1 * d4 - d3 * d2;
+  if (vc <= 0 && d1 >= 0 && d3 <= 0) return a + ab * (d1 / (d1 - d3));
+  const V3 cp = p - c;
+  const float d5 = Dot(ab, cp), d6 = Dot(ac, cp);
+  if (d6 >= 0 && d5 <= d6) return c;
+  const float vb = d5 * d2 - d1 * d6;
+  if (vb <= 0 && d2 >= 0 && d6 <= 0) return a + ac * (d2 / (d2 - d6));
+  const float va = d3 * d6 - d5 * d4;
+  if (va <= 0 && (d4 - d3) >= 0 && (d5 - d6) >= 0)
+    return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+  const float denom = 1.0f / (va + vb + vc);
+  return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+/// @brief 点から地形メッシュまでの距離（総当たり）
+float DistanceToSurface(const TerrainData &d, V3 p) {
+  const int resX = d.config.resolutionX, resZ = d.config.resolutionZ;
+  float best = 1e30f;
+  for (int z = 0; z + 1 < resZ; ++z) {
+    for (int x = 0; x + 1 < resX; ++x) {
+      const V3 p0 = Vertex(d, x, z), p1 = Vertex(d, x + 1, z);
+      const V3 p2 = Vertex(d, x, z + 1), p3 = Vertex(d, x + 1, z + 1);
+      best = std::min(best, Length(p - ClosestOnTriangle(p, p0, p1, p2)));
+      best = std::min(best, Length(p - ClosestOnTriangle(p, p2, p1, p3)));
+    }
+  }
+  return best;
+}
+
+/// @brief 細かい刻みで [0, tEnd] の間に地表より下へ潜るか
+bool MarchBelow(const TerrainData &d, V3 o, V3 dir, float tEnd) {
+  const float step = 0.002f;
+  for (float t = 0.0f; t <= tEnd; t += step) {
+    const V3 p = o + dir * t;
+    float h;
+    if (SurfaceHeight(d, p.x, p.z, h) && p.y < h - 1e-4f) {
+      return true;
+    }
+  }
+  return false;
+}
+
+V3 ToV3(const XMFLOAT3 &v) { return {v.x, v.y, v.z}; }
+XMFLOAT3 ToF3(V3 v) { return {v.x, v.y, v.z}; }
+
+} // namespace
+
+int main() {
+  TerrainConfig config;
+  config.resolutionX = 48;
+  config.resolutionZ = 40;
+  config.worldWidth = 16.0f;
+  config.worldDepth = 12.0f;
+  config.heightScale = 2.5f;
+  config.noiseAmplitude = 0.6f;
+  const TerrainData data = TerrainGenerator::GenerateTerrain(
+      "Pyramid", {{-3.0f, 2.0f}, {4.0f, -3.0f}}, config, nullptr);
+
+  TerrainHeightPyramid pyramid;
+  pyramid.Build(data, nullptr);
+
+  // 1) ピラミッドの構造
+  {
+    float rootMin, rootMax;
+    pyramid.GetNodeRange(pyramid.GetLevelCount() - 1, 0, 0, rootMin, rootMax);
+    const auto [lo, hi] =
+        std::minmax_element(data.heightMap.begin(), data.heightMap.end());
+    CHECK(pyramid.GetLevelCount() == 7, "47x39 cells need 7 levels");
+    CHECK(rootMin == *lo && rootMax == *hi, "Root covers the whole range");
+
+    bool nested = true;
+    for (int level = 1; level < pyramid.GetLevelCount(); ++level) {
+      const int w = ((config.resolutionX - 1) + (1 << level) - 1) >> level;
+      const int h = ((config.resolutionZ - 1) + (1 << level) - 1) >> level;
+      const int cw = ((config.resolutionX - 1) + (1 << (level - 1)) - 1) >>
+                     (level - 1);
+      const int ch = ((config.resolutionZ - 1) + (1 << (level - 1)) - 1) >>
+                     (level - 1);
+      for (int z = 0; z < h; ++z) {
+        for (int x = 0; x < w; ++x) {
+          float pmin, pmax;
+          pyramid.GetNodeRange(level, x, z, pmin, pmax);
+          for (int j = 0; j < 2; ++j) {
+            for (int i = 0; i < 2; ++i) {
+              if (x * 2 + i < cw && z * 2 + j < ch) {
+                float cmin, cmax;
+                pyramid.GetNodeRange(level - 1, x * 2 + i, z * 2 + j, cmin,
+                                     cmax);
+                nested = nested && pmin <= cmin && pmax >= cmax;
+              }
+            }
+          }
+        }
+      }
+    }
+    CHECK(nested, "Parent ranges contain their children");
+
+    core::ThreadPool pool(3);
+    TerrainHeightPyramid parallel;
+    parallel.Build(data, &pool);
+    bool same = parallel.GetLevelCount() == pyramid.GetLevelCount();
+    for (int z = 0; z < config.resolutionZ - 1 && same; ++z) {
+      for (int x = 0; x < config.resolutionX - 1; ++x) {
+        float a0, a1, b0, b1;
+        pyramid.GetNodeRange(0, x, z, a0, a1);
+        parallel.GetNodeRange(0, x, z, b0, b1);
+        same = same && a0 == b0 && a1 == b1;
+      }
+    }
+    CHECK(same, "Parallel build matches serial build");
+  }
+
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> ux(-7.5f, 7.5f);
+  std::uniform_real_distribution<float> uz(-5.5f, 5.5f);
+  std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+
+  // 2) 真下へのレイは地表の高さと法線を正確に返す
+  {
+    bool ok = true;
+    for (int i = 0; i < 500 && ok; ++i) {
+      const float x = ux(rng), z = uz(rng);
+      float h;
+      SurfaceHeight(data, x, z, h);
+      TerrainRayHit hit;
+      ok = pyramid.Raycast({x, 10.0f, z}, {0.0f, -1.0f, 0.0f}, 100.0f, hit) &&
+           std::abs(hit.point.y - h) < 1e-4f &&
+           std::abs(hit.distance - (10.0f - h)) < 1e-4f &&
+           std::abs(hit.point.x - x) < 1e-5f && hit.normal.y > 0.0f;
+      // 法線は接触したセルのどちらかの三角形の面法線
+      V3 facets[2];
+      CellNormals(data, x, z, facets);
+      const V3 n = ToV3(hit.normal);
+      ok = ok && (Length(n - facets[0]) < 1e-4f ||
+                  Length(n - facets[1]) < 1e-4f);
+    }
+    CHECK(ok, "Vertical rays hit the mesh height with the facet normal");
+  }
+
+  // 3) 斜めのレイ: 接触点は地表上で、それより手前では地表より上にいる
+  {
+    int hits = 0, misses = 0;
+    bool ok = true;
+    for (int i = 0; i < 300 && ok; ++i) {
+      const V3 o = {ux(rng), 3.0f + 2.0f * unit(rng), uz(rng)};
+      V3 dir = {unit(rng), -0.15f - 0.5f * std::abs(unit(rng)), unit(rng)};
+      dir = dir * (1.0f / Length(dir));
+      const float maxDistance = 12.0f;
+      float h0;
+      if (!SurfaceHeight(data, o.x, o.z, h0) || o.y <= h0) {
+        continue;
+      }
+      TerrainRayHit hit;
+      if (pyramid.Raycast(ToF3(o), ToF3(dir), maxDistance, hit)) {
+        ++hits;
+        float h;
+        const V3 p = o + dir * hit.distance;
+        ok = SurfaceHeight(data, p.x, p.z, h) &&
+             std::abs(hit.point.y - h) < 1e-3f &&
+             Length(ToV3(hit.point) - p) < 1e-3f &&
+             Dot(ToV3(hit.normal), dir) < 0.0f &&
+             !MarchBelow(data, o, dir, hit.distance - 0.01f);
+      } else {
+        ++misses;
+        ok = !MarchBelow(data, o, dir, maxDistance);
+      }
+    }
+    CHECK(ok && hits > 100 && misses > 0,
+          "Oblique rays find the first crossing (" << hits << " hits, "
+                                                   << misses << " misses)");
+  }
+
+  // 4) 当たらないケース
+  {
+    TerrainRayHit hit;
+    float h;
+    SurfaceHeight(data, 1.0f, 1.0f, h);
+    CHECK(!pyramid.Raycast({1.0f, h - 0.5f, 1.0f}, {0.0f, 1.0f, 0.0f}, 10.0f,
+                           hit),
+          "Rays leaving the ground from below are ignored");
+    CHECK(!pyramid.Raycast({30.0f, 5.0f, 0.0f}, {0.0f, -1.0f, 0.0f}, 10.0f,
+                           hit),
+          "Rays outside the field miss");
+    CHECK(!pyramid.Raycast({1.0f, h + 2.0f, 1.0f}, {0.0f, -1.0f, 0.0f}, 1.0f,
+                           hit),
+          "Hits beyond maxDistance are not reported");
+    CHECK(!pyramid.Raycast({1.0f, h + 2.0f, 1.0f}, {0.0f, 0.0f, 0.0f}, 10.0f,
+                           hit),
+          "Zero direction is rejected");
+  }
+
+  // 5) 球キャスト: 接触時に地表との距離がちょうど半径になる
+  {
+    bool ok = true;
+    int hits = 0;
+    for (int i = 0; i < 60 && ok; ++i) {
+      const float r = 0.2f + 0.3f * std::abs(unit(rng));
+      const V3 o = {ux(rng) * 0.8f, 4.0f, uz(rng) * 0.8f};
+      V3 dir = {unit(rng), -0.4f - std::abs(unit(rng)), unit(rng)};
+      dir = dir * (1.0f / Length(dir));
+      if (DistanceToSurface(data, o) <= r) {
+        continue;
+      }
+      TerrainRayHit hit;
+      if (!pyramid.SphereCast(ToF3(o), ToF3(dir), r, 20.0f, hit)) {
+        continue;
+      }
+      ++hits;
+      const V3 centre = o + dir * hit.distance;
+      const V3 n = ToV3(hit.normal);
+      ok = std::abs(DistanceToSurface(data, centre) - r) < 1e-3f &&
+           std::abs(Length(centre - ToV3(hit.point)) - r) < 1e-3f &&
+           Length(centre - n * r - ToV3(hit.point)) < 1e-3f &&
+           DistanceToSurface(data, o + dir * std::max(0.0f, hit.distance -
+                                                                0.01f)) > r;
+    }
+    CHECK(ok && hits > 40, "Sphere casts stop exactly at radius distance ("
+                               << hits << " hits)");
+  }
+
+  // 6) 半径 0 の球キャストはレイキャストと同じ
+  {
+    TerrainRayHit ray, sphere;
+    const XMFLOAT3 o = {0.5f, 5.0f, -1.0f};
+    const XMFLOAT3 dir = {0.3f, -1.0f, 0.2f};
+    CHECK(pyramid.Raycast(o, dir, 20.0f, ray) &&
+              pyramid.SphereCast(o, dir, 0.0f, 20.0f, sphere) &&
+              ray.distance == sphere.distance && ray.cellX == sphere.cellX,
+          "Zero-radius sphere cast equals raycast");
+  }
+
+  // 7) 平面では解析解と一致し、めり込んだ始点は距離 0
+  {
+    TerrainData flat = data;
+    std::fill(flat.heightMap.begin(), flat.heightMap.end(), 1.0f);
+    TerrainHeightPyramid plane;
+    plane.Build(flat, nullptr);
+    TerrainRayHit hit;
+    CHECK(plane.SphereCast({0.3f, 5.0f, 0.7f}, {0.0f, -1.0f, 0.0f}, 0.5f,
+                           10.0f, hit) &&
+              std::abs(hit.distance - 3.5f) < 1e-5f &&
+              std::abs(hit.normal.y - 1.0f) < 1e-6f,
+          "Sphere falling onto a plane stops at height + radius");
+    const float s = 1.0f / std::sqrt(2.0f);
+    CHECK(plane.Raycast({-2.0f, 3.0f, 0.0f}, {s, -s, 0.0f}, 10.0f, hit) &&
+              std::abs(hit.distance - 2.0f * std::sqrt(2.0f)) < 1e-5f &&
+              std::abs(hit.point.x) < 1e-5f,
+          "45-degree ray hits the plane at the analytic distance");
+    CHECK(plane.SphereCast({0.0f, 1.2f, 0.0f}, {1.0f, 0.0f, 0.0f}, 0.5f, 10.0f,
+                           hit) &&
+              hit.distance == 0.0f,
+          "Embedded sphere reports distance 0");
+  }
+
+  std::cout << "All terrain height pyramid tests passed!\n";
+  return 0;
+}
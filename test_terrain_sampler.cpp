@@ -0,0 +1,229 @@
+#include "src/game/systems/TerrainGenerator.h"
+#include "src/game/systems/TerrainSampler.h"
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using DirectX::XMFLOAT3;
+using game::systems::TerrainConfig;
+using game::systems::TerrainData;
+using game::systems::TerrainGenerator;
+using game::systems::TerrainSampler;
+using game::systems::TerrainSamples;
+
+namespace {
+
+/// @brief SoA の出力バッファ
+struct Columns {
+  std::vector<float> height, nx, ny, nz;
+  std::vector<uint8_t> material;
+
+  explicit Columns(size_t n)
+      : height(n), nx(n), ny(n), nz(n), material(n, 0xFF) {}
+
+  TerrainSamples View() {
+    TerrainSamples out;
+    out.height = height.data();
+    out.normalX = nx.data();
+    out.normalY = ny.data();
+    out.normalZ = nz.data();
+    out.material = material.data();
+    return out;
+  }
+};
+
+/// @brief 頂点 (x, z) のワールド座標
+void VertexXZ(const TerrainConfig &c, int x, int z, float &wx, float &wz) {
+  wx = ((float)x / (c.resolutionX - 1) - 0.5f) * c.worldWidth;
+  wz = (0.5f - (float)z / (c.resolutionZ - 1)) * c.worldDepth;
+}
+
+bool SameBits(float a, float b) { return std::memcmp(&a, &b, 4) == 0; }
+
+} // namespace
+
+int main() {
+  TerrainConfig config;
+  config.resolutionX = 96;
+  config.resolutionZ = 128;
+  config.worldWidth = 40.0f;
+  config.worldDepth = 60.0f;
+  config.heightScale = 2.5f;
+  config.noiseAmplitude = 0.5f;
+  const TerrainData data = TerrainGenerator::GenerateTerrain(
+      "Sampler", {{-5.0f, 8.0f}, {3.0f, -6.0f}}, config, nullptr);
+
+  TerrainSampler sampler;
+  sampler.Build(data);
+  CHECK(!sampler.IsEmpty(), "Sampler is built");
+
+  // 1) 頂点上ではハイトマップの値そのもの、マテリアルもその頂点の値
+  {
+    bool heightOk = true;
+    bool materialOk = true;
+    for (int z = 0; z < config.resolutionZ - 1; z += 7) {
+      for (int x = 0; x < config.resolutionX - 1; x += 5) {
+        float wx, wz;
+        VertexXZ(config, x, z, wx, wz);
+        float h;
+        XMFLOAT3 n;
+        uint8_t m;
+        sampler.SamplePoint(wx, wz, h, n, m);
+        const size_t idx = static_cast<size_t>(z) * config.resolutionX + x;
+        heightOk &= std::fabs(h - data.heightMap[idx]) < 1e-4f;
+        materialOk &= m == data.materialMap[idx];
+      }
+    }
+    CHECK(heightOk, "Height equals the heightmap at vertices");
+    CHECK(materialOk, "Material is the nearest vertex's");
+  }
+
+  // 2) 法線は補間面の勾配と一致する（セル内部の中心差分と比べる）
+  {
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<float> cell(0.2f, 0.8f);
+    const float cellW = config.worldWidth / (config.resolutionX - 1);
+    const float cellD = config.worldDepth / (config.resolutionZ - 1);
+    const float eps = 0.05f * cellW;
+    float worst = 0.0f;
+    for (int i = 0; i < 500; ++i) {
+      const int cx = static_cast<int>(rng() % (config.resolutionX - 1));
+      const int cz = static_cast<int>(rng() % (config.resolutionZ - 1));
+      float x0, z0;
+      VertexXZ(config, cx, cz, x0, z0);
+      const float x = x0 + cell(rng) * cellW;
+      const float z = z0 - cell(rng) * cellD;
+      float h;
+      XMFLOAT3 n;
+      uint8_t m;
+      sampler.SamplePoint(x, z, h, n, m);
+      const float dhdx = (sampler.SampleHeight(x + eps, z) -
+                          sampler.SampleHeight(x - eps, z)) /
+                         (2.0f * eps);
+      const float dhdz = (sampler.SampleHeight(x, z + eps) -
+                          sampler.SampleHeight(x, z - eps)) /
+                         (2.0f * eps);
+      const float len = std::sqrt(dhdx * dhdx + 1.0f + dhdz * dhdz);
+      const float dot = (-dhdx * n.x + n.y - dhdz * n.z) / len;
+      const float unit = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+      worst = std::max(worst, std::max(1.0f - dot, std::fabs(unit - 1.0f)));
+    }
+    CHECK(worst < 1e-3f, "Analytic normal matches the height gradient (worst "
+                             << worst << ")");
+  }
+
+  // 3) 傾いた平面では高さ・法線とも厳密な値になる
+  {
+    TerrainData plane;
+    plane.config = config;
+    plane.config.resolutionX = 17;
+    plane.config.resolutionZ = 33;
+    const float a = 0.25f, b = -0.4f; // h = a x + b z
+    for (int z = 0; z < plane.config.resolutionZ; ++z) {
+      for (int x = 0; x < plane.config.resolutionX; ++x) {
+        float wx, wz;
+        VertexXZ(plane.config, x, z, wx, wz);
+        plane.heightMap.push_back(a * wx + b * wz);
+      }
+    }
+    TerrainSampler planeSampler;
+    planeSampler.Build(plane);
+    const float len = std::sqrt(a * a + 1.0f + b * b);
+    bool ok = true;
+    for (float x = -19.0f; x < 19.0f; x += 1.7f) {
+      for (float z = -29.0f; z < 29.0f; z += 2.3f) {
+        float h;
+        XMFLOAT3 n;
+        uint8_t m;
+        planeSampler.SamplePoint(x, z, h, n, m);
+        ok &= std::fabs(h - (a * x + b * z)) < 1e-4f;
+        ok &= std::fabs(n.x + a / len) < 1e-5f &&
+              std::fabs(n.y - 1.0f / len) < 1e-5f &&
+              std::fabs(n.z + b / len) < 1e-5f;
+        ok &= m == 0; // マテリアルなし
+      }
+    }
+    CHECK(ok, "Tilted plane gives exact height and normal");
+  }
+
+  // 4) バッチ（SIMD）と1点ずつの結果がビット単位で一致する
+  {
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dx(-22.0f, 22.0f);
+    std::uniform_real_distribution<float> dz(-32.0f, 32.0f);
+    const size_t count = 1003; // 4 の倍数でない端数も含める
+    std::vector<float> xs(count), zs(count);
+    for (size_t i = 0; i < count; ++i) {
+      xs[i] = dx(rng);
+      zs[i] = dz(rng);
+    }
+    xs[5] = std::nanf("");
+    Columns batch(count);
+    sampler.Sample(xs.data(), zs.data(), count, batch.View());
+
+    bool same = true;
+    for (size_t i = 0; i < count; ++i) {
+      float h;
+      XMFLOAT3 n;
+      uint8_t m;
+      sampler.SamplePoint(xs[i], zs[i], h, n, m);
+      same &= SameBits(h, batch.height[i]) && SameBits(n.x, batch.nx[i]) &&
+              SameBits(n.y, batch.ny[i]) && SameBits(n.z, batch.nz[i]) &&
+              m == batch.material[i];
+    }
+    CHECK(same, "Batch and single-point results are bit-identical");
+
+    // 一部の列だけ要求しても値は変わらない
+    std::vector<float> heights(count);
+    TerrainSamples onlyHeight;
+    onlyHeight.height = heights.data();
+    sampler.Sample(xs.data(), zs.data(), count, onlyHeight);
+    CHECK(std::memcmp(heights.data(), batch.height.data(),
+                      count * sizeof(float)) == 0,
+          "Height-only request gives the same heights");
+  }
+
+  // 5) 範囲外（NaN を含む）は高さ 0・上向き・マテリアル 0
+  {
+    const float xs[6] = {-20.5f, 25.0f, 0.0f, 0.0f, std::nanf(""), 19.0f};
+    const float zs[6] = {0.0f, 0.0f, 30.5f, -31.0f, 0.0f, 29.0f};
+    Columns out(6);
+    sampler.Sample(xs, zs, 6, out.View());
+    bool flat = true;
+    for (int i = 0; i < 5; ++i) {
+      flat &= out.height[i] == 0.0f && out.nx[i] == 0.0f &&
+              out.ny[i] == 1.0f && out.nz[i] == 0.0f && out.material[i] == 0;
+      flat &= !sampler.Contains(xs[i], zs[i]);
+    }
+    CHECK(flat, "Points outside the field are flat ground");
+    CHECK(sampler.Contains(xs[5], zs[5]) && out.material[5] != 0xFF,
+          "Point inside the field is sampled");
+  }
+
+  // 6) 空のサンプラーはどこでも平ら
+  {
+    TerrainSampler empty;
+    float h;
+    XMFLOAT3 n;
+    uint8_t m;
+    empty.SamplePoint(1.0f, 2.0f, h, n, m);
+    CHECK(empty.IsEmpty() && h == 0.0f && n.y == 1.0f && m == 0 &&
+              !empty.Contains(1.0f, 2.0f),
+          "Empty sampler returns flat ground");
+  }
+
+  std::cout << "All terrain sampler tests passed!\n";
+  return 0;
+}
@@ -0,0 +1,202 @@
+#include "src/graphics/VirtualTextureCache.h"
+#include <iostream>
+#include <set>
+#include <vector>
+
+#define CHECK(condition, message)                                              \
+  do {                                                                         \
+    if (!(condition)) {                                                        \
+      std::cerr << "[FAIL] " << message << "\n";                               \
+      std::exit(1);                                                            \
+    } else {                                                                   \
+      std::cout << "[PASS] " << message << "\n";                               \
+    }                                                                          \
+  } while (0)
+
+using graphics::VirtualTextureCache;
+using graphics::VirtualTextureConfig;
+using graphics::VirtualTileUpload;
+
+namespace {
+
+/// @brief 2048 x 8192 の記事を 256 のタイルで（8 x 32 タイル）
+VirtualTextureConfig MakeConfig(uint32_t slots) {
+  VirtualTextureConfig config;
+  config.width = 2048;
+  config.height = 8192;
+  config.tileSize = 256;
+  config.border = 1;
+  config.fallbackScale = 0.125f;
+  config.marginTiles = 1;
+  config.maxUploadsPerFrame = 1000;
+  const uint64_t fallback = 256ull * 1024 * 4;
+  const uint64_t pageTable = 8ull * 32 * 16;
+  config.memoryBudget = fallback + pageTable + slots * 258ull * 258 * 4;
+  return config;
+}
+
+/// @brief 1フレーム分を要求して常駐を更新する
+std::vector<VirtualTileUpload> Frame(VirtualTextureCache &cache, float u0,
+                                     float v0, float u1, float v1) {
+  cache.BeginFrame();
+  cache.RequestRegion(u0, v0, u1, v1, 0.0f);
+  return cache.EndFrame();
+}
+
+} // namespace
+
+int main() {
+  std::cout << "=== Virtual Texture Cache Tests ===\n";
+
+  // 1) 予算からスロット数とアトラスが決まり、予算を超えない
+  {
+    const VirtualTextureConfig config = MakeConfig(20);
+    VirtualTextureCache cache(config);
+    CHECK(cache.GetTilesX() == 8 && cache.GetTilesY() == 32,
+          "Tile grid covers the texture");
+    CHECK(cache.GetSlotCount() == 20 && cache.GetSlotSize() == 258,
+          "Slot count follows the memory budget");
+    CHECK(cache.GetAtlasWidth() == 5 * 258 && cache.GetAtlasHeight() == 4 * 258,
+          "Atlas is a near-square grid of slots");
+    CHECK(cache.GetFallbackWidth() == 256 && cache.GetFallbackHeight() == 1024,
+          "Fallback is scaled down");
+    CHECK(cache.GetStats().TotalBytes() <= config.memoryBudget,
+          "Resident memory stays within the budget");
+    CHECK(cache.GetStats().TotalBytes() < cache.GetFullTextureBytes() / 2,
+          "Budgeted memory is far below the full texture");
+
+    // 格子に収まらない端数のスロットは予算を超えないように削る
+    const VirtualTextureConfig odd = MakeConfig(23);
+    VirtualTextureCache oddCache(odd);
+    CHECK(oddCache.GetSlotCount() == 20 &&
+              oddCache.GetStats().TotalBytes() <= odd.memoryBudget,
+          "Atlas grid never exceeds the budget");
+  }
+
+  // 2) 表示範囲とその周り1枚が常駐し、表示範囲が先に来る
+  {
+    VirtualTextureCache cache(MakeConfig(20));
+    // タイル (2..3, 4..5) を表示
+    const auto uploads = Frame(cache, 0.25f, 0.125f, 0.49f, 0.18f);
+    CHECK(uploads.size() == 16, "Visible tiles and margin are uploaded");
+    bool visibleFirst = true;
+    for (size_t i = 0; i < uploads.size(); ++i) {
+      const bool inside = uploads[i].tileX >= 2 && uploads[i].tileX <= 3 &&
+                          uploads[i].tileY >= 4 && uploads[i].tileY <= 5;
+      visibleFirst &= (i < 4) == inside;
+    }
+    CHECK(visibleFirst, "Visible tiles are rasterized before the margin");
+    CHECK(uploads[0].sourceX == 2 * 256 - 1 &&
+              uploads[0].sourceY == 4 * 256 - 1 && uploads[0].size == 258,
+          "Upload source includes the border");
+    CHECK(cache.GetSlot(2, 4) >= 0 && cache.GetSlot(0, 0) < 0,
+          "Slot lookup reflects residency");
+
+    std::set<uint32_t> slots;
+    for (const auto &u : uploads) {
+      slots.insert(u.slot);
+    }
+    CHECK(slots.size() == uploads.size(), "Each upload gets its own slot");
+
+    // 同じ範囲をもう一度見ても何も作り直さない
+    const auto again = Frame(cache, 0.25f, 0.125f, 0.49f, 0.18f);
+    CHECK(again.empty() && cache.GetStats().missingTiles == 0,
+          "Resident tiles are reused without uploads");
+  }
+
+  // 3) 予算が尽きたら最も古いタイルから追い出す
+  {
+    VirtualTextureCache cache(MakeConfig(6));
+    Frame(cache, 0.0f, 0.0f, 0.1f, 0.01f); // タイル (0,0) と周り 3 枚
+    CHECK(cache.GetStats().residentTiles == 4, "First view is resident");
+    Frame(cache, 0.0f, 0.5f, 0.1f, 0.51f); // (0,16) と周り 5 枚
+    CHECK(cache.GetStats().residentTiles == 6 && cache.GetSlot(0, 0) < 0 &&
+              cache.GetSlot(0, 16) >= 0,
+          "Old tiles are evicted for the new view");
+    CHECK(cache.GetStats().evictions == 4, "Eviction count is tracked");
+  }
+
+  // 4) 予算を超える要求は表示範囲を優先し、残りは低解像度版
+  {
+    VirtualTextureCache cache(MakeConfig(4));
+    Frame(cache, 0.0f, 0.25f, 0.3f, 0.3f); // 3 x 2 の表示 + 周り
+    const auto &stats = cache.GetStats();
+    CHECK(stats.residentTiles == 4 &&
+              stats.missingTiles == stats.requestedTiles - 4,
+          "Overflow falls back to the low-res texture");
+    CHECK(cache.GetSlot(0, 8) >= 0 && cache.GetSlot(1, 8) >= 0,
+          "Nearest visible tiles win the slots");
+  }
+
+  // 5) 1フレームの上限を超えた分は次のフレームに回す
+  {
+    VirtualTextureConfig config = MakeConfig(20);
+    config.maxUploadsPerFrame = 3;
+    VirtualTextureCache cache(config);
+    size_t frames = 0;
+    size_t total = 0;
+    for (; frames < 10; ++frames) {
+      const auto uploads = Frame(cache, 0.25f, 0.125f, 0.49f, 0.18f);
+      CHECK(uploads.size() <= 3, "Uploads per frame are capped");
+      total += uploads.size();
+      if (uploads.empty()) {
+        break;
+      }
+    }
+    CHECK(total == 16 && cache.GetStats().missingTiles == 0,
+          "Capped uploads complete over several frames");
+  }
+
+  // 6) 優先度の小さい範囲から常駐する
+  {
+    VirtualTextureConfig config = MakeConfig(20);
+    config.marginTiles = 0;
+    config.maxUploadsPerFrame = 1;
+    VirtualTextureCache cache(config);
+    cache.BeginFrame();
+    cache.RequestRegion(0.0f, 0.9f, 0.01f, 0.91f, 50.0f);
+    cache.RequestRegion(0.5f, 0.1f, 0.51f, 0.11f, 5.0f);
+    const auto uploads = cache.EndFrame();
+    CHECK(uploads.size() == 1 && uploads[0].tileX == 4 && uploads[0].tileY == 3,
+          "Closer region is uploaded first");
+  }
+
+  // 7) ページテーブルは常駐タイルだけアトラス上の位置を指す
+  {
+    VirtualTextureCache cache(MakeConfig(20));
+    CHECK(cache.IsPageTableDirty(), "Page table starts dirty");
+    cache.ClearPageTableDirty();
+    const auto uploads = Frame(cache, 0.0f, 0.0f, 0.01f, 0.01f);
+    CHECK(cache.IsPageTableDirty(), "Uploads dirty the page table");
+
+    std::vector<float> table(8 * 32 * 4, -1.0f);
+    cache.WritePageTable(table.data());
+    const VirtualTileUpload &u = uploads[0];
+    const float *entry = &table[(u.tileY * 8 + u.tileX) * 4];
+    const float aw = static_cast<float>(cache.GetAtlasWidth());
+    const float ah = static_cast<float>(cache.GetAtlasHeight());
+    CHECK(entry[0] == (u.atlasX + 1) / aw && entry[1] == (u.atlasY + 1) / ah &&
+              entry[2] == 256 / aw && entry[3] == 256 / ah,
+          "Resident entry points at the slot interior");
+    const float *empty = &table[(31 * 8 + 7) * 4];
+    CHECK(empty[0] == 0.0f && empty[2] == 0.0f,
+          "Missing tiles have an empty entry");
+
+    cache.Reset();
+    CHECK(cache.GetSlot(u.tileX, u.tileY) < 0 &&
+              cache.GetStats().residentTiles == 0,
+          "Reset evicts everything");
+  }
+
+  // 8) 範囲外・不正な要求は無視される
+  {
+    VirtualTextureCache cache(MakeConfig(20));
+    const auto uploads = Frame(cache, 0.5f, 0.5f, 0.4f, 0.6f);
+    CHECK(uploads.empty(), "Inverted region is ignored");
+    const auto outside = Frame(cache, 2.0f, 2.0f, 3.0f, 3.0f);
+    CHECK(outside.empty(), "Region outside the texture is ignored");
+  }
+
+  std::cout << "All virtual texture cache tests passed!\n";
+  return 0;
+}